@@ -50,6 +50,7 @@
 #include "util/data/msgreply.h"
 #include "util/data/msgencode.h"
 #include "services/cache/dns.h"
+#include "services/mesh.h"
 #include "validator/val_neg.h"
 #include "validator/val_secalgo.h"
 #include "iterator/iter_utils.h"
@@ -598,7 +599,7 @@ cachedb_intcache_lookup(struct module_qstate* qstate)
 			qstate->region, qstate->env->rrset_cache,
 			qstate->env->scratch_buffer,
 			*qstate->env->now, 1/*add SOA*/, NULL,
-			qstate->env->cfg);
+			qstate->env->cfg, qstate->env->mesh);
 	}
 	if(!msg)
 		return 0;
@@ -670,6 +671,8 @@ cachedb_handle_query(struct module_qstate* qstate,
 
 	/* ask backend cache to see if we have data */
 	if(cachedb_extcache_lookup(qstate, ie)) {
+		if(qstate->mesh_info->trace)
+			mesh_trace_event(qstate, mesh_trace_cache, 1);
 		if(verbosity >= VERB_ALGO)
 			log_dns_msg(ie->backend->name,
 				&qstate->return_msg->qinfo,
@@ -681,6 +684,8 @@ cachedb_handle_query(struct module_qstate* qstate,
 		return;
 	}
 
+	if(qstate->mesh_info->trace)
+		mesh_trace_event(qstate, mesh_trace_cache, 0);
 	/* no cache fetches */
 	/* pass request to next module */
 	qstate->ext_state[id] = module_wait_module;
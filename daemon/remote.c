@@ -708,6 +708,7 @@ static int
 print_stats(RES* ssl, const char* nm, struct ub_stats_info* s)
 {
 	struct timeval sumwait, avg;
+	int i;
 	if(!ssl_printf(ssl, "%s.num.queries"SQ"%lu\n", nm, 
 		(unsigned long)s->svr.num_queries)) return 0;
 	if(!ssl_printf(ssl, "%s.num.queries_ip_ratelimited"SQ"%lu\n", nm,
@@ -719,10 +720,20 @@ print_stats(RES* ssl, const char* nm, struct ub_stats_info* s)
 		(unsigned long)s->svr.num_queries_missed_cache)) return 0;
 	if(!ssl_printf(ssl, "%s.num.prefetch"SQ"%lu\n", nm, 
 		(unsigned long)s->svr.num_queries_prefetch)) return 0;
+	if(!ssl_printf(ssl, "%s.num.refresh"SQ"%lu\n", nm,
+		(unsigned long)s->svr.num_refresh)) return 0;
+	if(!ssl_printf(ssl, "%s.num.refresh.useful"SQ"%lu\n", nm,
+		(unsigned long)s->svr.num_refresh_useful)) return 0;
+	if(!ssl_printf(ssl, "%s.num.refresh.upstream"SQ"%lu\n", nm,
+		(unsigned long)s->svr.num_refresh_upstream)) return 0;
 	if(!ssl_printf(ssl, "%s.num.zero_ttl"SQ"%lu\n", nm,
 		(unsigned long)s->svr.zero_ttl_responses)) return 0;
 	if(!ssl_printf(ssl, "%s.num.recursivereplies"SQ"%lu\n", nm, 
 		(unsigned long)s->mesh_replies_sent)) return 0;
+	if(!ssl_printf(ssl, "%s.num.handoff.out"SQ"%lu\n", nm,
+		(unsigned long)s->svr.num_handoff_out)) return 0;
+	if(!ssl_printf(ssl, "%s.num.handoff.in"SQ"%lu\n", nm,
+		(unsigned long)s->svr.num_handoff_in)) return 0;
 #ifdef USE_DNSCRYPT
 	if(!ssl_printf(ssl, "%s.num.dnscrypt.crypted"SQ"%lu\n", nm,
 		(unsigned long)s->svr.num_query_dnscrypt_crypted)) return 0;
@@ -740,14 +751,39 @@ print_stats(RES* ssl, const char* nm, struct ub_stats_info* s)
 			s->svr.num_queries_prefetch) : 0.0)) return 0;
 	if(!ssl_printf(ssl, "%s.requestlist.max"SQ"%lu\n", nm,
 		(unsigned long)s->svr.max_query_list_size)) return 0;
+	if(!ssl_printf(ssl, "%s.requestlist.imbalance"SQ"%g\n", nm,
+		s->mesh_imbalance)) return 0;
 	if(!ssl_printf(ssl, "%s.requestlist.overwritten"SQ"%lu\n", nm,
 		(unsigned long)s->mesh_jostled)) return 0;
 	if(!ssl_printf(ssl, "%s.requestlist.exceeded"SQ"%lu\n", nm,
 		(unsigned long)s->mesh_dropped)) return 0;
+	if(!ssl_printf(ssl, "%s.requestlist.fairshare.clients"SQ"%lu\n", nm,
+		(unsigned long)s->mesh_fair_clients)) return 0;
+	if(!ssl_printf(ssl, "%s.requestlist.fairshare.evicted"SQ"%lu\n", nm,
+		(unsigned long)s->mesh_fair_evicted)) return 0;
+	if(!ssl_printf(ssl, "%s.requestlist.fairshare.dropped"SQ"%lu\n", nm,
+		(unsigned long)s->mesh_fair_dropped)) return 0;
 	if(!ssl_printf(ssl, "%s.requestlist.current.all"SQ"%lu\n", nm,
 		(unsigned long)s->mesh_num_states)) return 0;
 	if(!ssl_printf(ssl, "%s.requestlist.current.user"SQ"%lu\n", nm,
 		(unsigned long)s->mesh_num_reply_states)) return 0;
+	for(i=0; i<UB_STATS_MESH_CLASS_NUM; i++) {
+		const char* cl = mesh_class_to_str((enum mesh_class)i);
+		if(!ssl_printf(ssl, "%s.requestlist.class.%s.current"SQ"%lu\n",
+			nm, cl, (unsigned long)s->mesh_class_num[i])) return 0;
+		if(!ssl_printf(ssl, "%s.requestlist.class.%s.exceeded"SQ"%lu\n",
+			nm, cl, (unsigned long)s->mesh_class_dropped[i])) return 0;
+		if(!ssl_printf(ssl, "%s.requestlist.class.%s.finished"SQ"%lu\n",
+			nm, cl, (unsigned long)s->mesh_class_done[i])) return 0;
+#ifndef S_SPLINT_S
+		sumwait.tv_sec = s->mesh_class_sum_wait_sec[i];
+		sumwait.tv_usec = s->mesh_class_sum_wait_usec[i];
+#endif
+		timeval_divide(&avg, &sumwait, s->mesh_class_done[i]);
+		if(!ssl_printf(ssl, "%s.requestlist.class.%s.time.avg"SQ ARG_LL
+			"d.%6.6d\n", nm, cl, (long long)avg.tv_sec,
+			(int)avg.tv_usec)) return 0;
+	}
 #ifndef S_SPLINT_S
 	sumwait.tv_sec = s->mesh_replies_sum_wait_sec;
 	sumwait.tv_usec = s->mesh_replies_sum_wait_usec;
@@ -901,6 +937,42 @@ print_hist(RES* ssl, struct ub_stats_info* s)
 	return 1;
 }
 
+/** print the per module query trace stats */
+static int
+print_trace(RES* ssl, struct module_stack* mods, struct ub_stats_info* s)
+{
+	int m, b;
+	struct timeval sum, avg, lo, hi;
+	if(!ssl_printf(ssl, "trace.queries"SQ"%lu\n",
+		(unsigned long)s->svr.trace_num)) return 0;
+	if(!ssl_printf(ssl, "trace.slow"SQ"%lu\n",
+		(unsigned long)s->svr.trace_num_slow)) return 0;
+	for(m=0; m<mods->num && m<UB_STATS_TRACE_MODULE_NUM; m++) {
+		const char* nm = mods->mod[m]->name;
+		if(!ssl_printf(ssl, "trace.module.%s.queries"SQ"%lu\n", nm,
+			(unsigned long)s->svr.trace_mod_num[m])) return 0;
+#ifndef S_SPLINT_S
+		sum.tv_sec = s->svr.trace_mod_sum_sec[m];
+		sum.tv_usec = s->svr.trace_mod_sum_usec[m];
+#endif
+		timeval_divide(&avg, &sum, s->svr.trace_mod_num[m]);
+		if(!ssl_printf(ssl, "trace.module.%s.time.avg"SQ ARG_LL
+			"d.%6.6d\n", nm, (long long)avg.tv_sec,
+			(int)avg.tv_usec)) return 0;
+		for(b=0; b<UB_STATS_TRACE_BUCKET_NUM; b++) {
+			mesh_trace_bucket_lower(b, &lo);
+			mesh_trace_bucket_lower(b+1, &hi);
+			if(!ssl_printf(ssl, "trace.module.%s.histogram."
+				"%6.6d.%6.6d.to.%6.6d.%6.6d"SQ"%lu\n", nm,
+				(int)lo.tv_sec, (int)lo.tv_usec,
+				(int)hi.tv_sec, (int)hi.tv_usec,
+				(unsigned long)s->svr.trace_mod_hist[m][b]))
+				return 0;
+		}
+	}
+	return 1;
+}
+
 /** print extended stats */
 static int
 print_ext(RES* ssl, struct ub_stats_info* s)
@@ -1020,6 +1092,12 @@ print_ext(RES* ssl, struct ub_stats_info* s)
 	/* iteration */
 	if(!ssl_printf(ssl, "num.query.ratelimited"SQ"%lu\n", 
 		(unsigned long)s->svr.queries_ratelimited)) return 0;
+	if(!ssl_printf(ssl, "num.query.hedged"SQ"%lu\n",
+		(unsigned long)s->svr.queries_hedged)) return 0;
+	if(!ssl_printf(ssl, "num.query.hedge_denied"SQ"%lu\n",
+		(unsigned long)s->svr.queries_hedge_denied)) return 0;
+	if(!ssl_printf(ssl, "num.query.minimise.skipped"SQ"%lu\n",
+		(unsigned long)s->svr.queries_minimise_skipped)) return 0;
 	/* validation */
 	if(!ssl_printf(ssl, "num.answer.secure"SQ"%lu\n", 
 		(unsigned long)s->svr.ans_secure)) return 0;
@@ -1027,10 +1105,16 @@ print_ext(RES* ssl, struct ub_stats_info* s)
 		(unsigned long)s->svr.ans_bogus)) return 0;
 	if(!ssl_printf(ssl, "num.rrset.bogus"SQ"%lu\n", 
 		(unsigned long)s->svr.rrset_bogus)) return 0;
+	if(!ssl_printf(ssl, "num.rrset.unchanged"SQ"%lu\n", 
+		(unsigned long)s->svr.rrset_unchanged)) return 0;
 	if(!ssl_printf(ssl, "num.query.aggressive.NOERROR"SQ"%lu\n", 
 		(unsigned long)s->svr.num_neg_cache_noerror)) return 0;
 	if(!ssl_printf(ssl, "num.query.aggressive.NXDOMAIN"SQ"%lu\n", 
 		(unsigned long)s->svr.num_neg_cache_nxdomain)) return 0;
+	if(!ssl_printf(ssl, "num.query.aggressive.nsec3"SQ"%lu\n", 
+		(unsigned long)s->svr.num_neg_cache_nsec3)) return 0;
+	if(!ssl_printf(ssl, "num.query.dname.synth"SQ"%lu\n", 
+		(unsigned long)s->svr.num_dname_synth)) return 0;
 	/* threat detection */
 	if(!ssl_printf(ssl, "unwanted.queries"SQ"%lu\n", 
 		(unsigned long)s->svr.unwanted_queries)) return 0;
@@ -1045,6 +1129,36 @@ print_ext(RES* ssl, struct ub_stats_info* s)
 		(unsigned)s->svr.infra_cache_count)) return 0;
 	if(!ssl_printf(ssl, "key.cache.count"SQ"%u\n",
 		(unsigned)s->svr.key_cache_count)) return 0;
+	if(!ssl_printf(ssl, "sig.cache.count"SQ"%u\n",
+		(unsigned)s->svr.sig_cache_count)) return 0;
+	if(!ssl_printf(ssl, "num.sig.cache.hit"SQ"%lu\n",
+		(unsigned long)s->svr.num_sig_cache_hit)) return 0;
+	if(!ssl_printf(ssl, "num.sig.cache.miss"SQ"%lu\n",
+		(unsigned long)s->svr.num_sig_cache_miss)) return 0;
+	if(!ssl_printf(ssl, "nsec3.hash.cache.count"SQ"%u\n",
+		(unsigned)s->svr.nsec3_hash_cache_count)) return 0;
+	if(!ssl_printf(ssl, "num.nsec3.hash.cache.hit"SQ"%lu\n",
+		(unsigned long)s->svr.num_nsec3_hash_hit)) return 0;
+	if(!ssl_printf(ssl, "num.nsec3.hash.cache.miss"SQ"%lu\n",
+		(unsigned long)s->svr.num_nsec3_hash_miss)) return 0;
+	if(!ssl_printf(ssl, "num.nsec3.hash.ratelimited"SQ"%lu\n",
+		(unsigned long)s->svr.num_nsec3_hash_ratelimited)) return 0;
+	for(i=0; i<UB_STATS_ALGO_NUM; i++) {
+		char alg[32];
+		if(inhibit_zero && s->svr.num_sig_verify[i] == 0 &&
+			s->svr.num_sig_skip[i] == 0)
+			continue;
+		lt = sldns_lookup_by_id(sldns_algorithms, i);
+		if(lt && lt->name) {
+			snprintf(alg, sizeof(alg), "%s", lt->name);
+		} else {
+			snprintf(alg, sizeof(alg), "ALG%d", i);
+		}
+		if(!ssl_printf(ssl, "num.val.sig.verify.%s"SQ"%lu\n",
+			alg, (unsigned long)s->svr.num_sig_verify[i])) return 0;
+		if(!ssl_printf(ssl, "num.val.sig.skip.%s"SQ"%lu\n",
+			alg, (unsigned long)s->svr.num_sig_skip[i])) return 0;
+	}
 #ifdef USE_DNSCRYPT
 	if(!ssl_printf(ssl, "dnscrypt_shared_secret.cache.count"SQ"%u\n",
 		(unsigned)s->svr.shared_secret_cache_count)) return 0;
@@ -1059,6 +1173,14 @@ print_ext(RES* ssl, struct ub_stats_info* s)
 		(unsigned long)s->svr.num_query_authzone_up)) return 0;
 	if(!ssl_printf(ssl, "num.query.authzone.down"SQ"%lu\n",
 		(unsigned long)s->svr.num_query_authzone_down)) return 0;
+	if(!ssl_printf(ssl, "num.alloc.regional.reused"SQ"%lu\n",
+		(unsigned long)s->svr.num_alloc_reg_reused)) return 0;
+	if(!ssl_printf(ssl, "num.alloc.regional.new"SQ"%lu\n",
+		(unsigned long)s->svr.num_alloc_reg_new)) return 0;
+	if(!ssl_printf(ssl, "num.alloc.chunk.reused"SQ"%lu\n",
+		(unsigned long)s->svr.num_alloc_chunk_reused)) return 0;
+	if(!ssl_printf(ssl, "num.alloc.chunk.new"SQ"%lu\n",
+		(unsigned long)s->svr.num_alloc_chunk_new)) return 0;
 #ifdef CLIENT_SUBNET
 	if(!ssl_printf(ssl, "num.query.subnet"SQ"%lu\n",
 		(unsigned long)s->svr.num_query_subnet)) return 0;
@@ -1074,19 +1196,30 @@ do_stats(RES* ssl, struct daemon_remote* rc, int reset)
 {
 	struct daemon* daemon = rc->worker->daemon;
 	struct ub_stats_info total;
-	struct ub_stats_info s;
+	struct ub_stats_info* s;
 	int i;
 	memset(&total, 0, sizeof(total));
 	log_assert(daemon->num > 0);
+	s = (struct ub_stats_info*)calloc((size_t)daemon->num, sizeof(*s));
+	if(!s) {
+		(void)ssl_printf(ssl, "error out of memory\n");
+		return;
+	}
 	/* gather all thread statistics in one place */
+	for(i=0; i<daemon->num; i++)
+		server_stats_obtain(rc->worker, daemon->workers[i], &s[i],
+			reset);
+	server_stats_imbalance(s, daemon->num);
 	for(i=0; i<daemon->num; i++) {
-		server_stats_obtain(rc->worker, daemon->workers[i], &s, reset);
-		if(!print_thread_stats(ssl, i, &s))
+		if(!print_thread_stats(ssl, i, &s[i])) {
+			free(s);
 			return;
+		}
 		if(i == 0)
-			total = s;
-		else	server_stats_add(&total, &s);
+			total = s[i];
+		else	server_stats_add(&total, &s[i]);
 	}
+	free(s);
 	/* print the thread statistics */
 	total.mesh_time_median /= (double)daemon->num;
 	if(!print_stats(ssl, "total", &total)) 
@@ -1101,6 +1234,10 @@ do_stats(RES* ssl, struct daemon_remote* rc, int reset)
 		if(!print_ext(ssl, &total))
 			return;
 	}
+	if(daemon->cfg->trace_sample_rate != 0) {
+		if(!print_trace(ssl, &rc->worker->env.mesh->mods, &total))
+			return;
+	}
 }
 
 /** parse commandline argument domain name */
@@ -2381,6 +2518,104 @@ do_dump_requestlist(RES* ssl, struct worker* worker)
 	}
 }
 
+/** print the events of a slow query trace */
+static int
+print_trace_events(RES* ssl, struct mesh_area* mesh, struct mesh_trace* t)
+{
+	size_t i;
+	struct timeval d;
+	for(i=0; i<t->num && i<MESH_TRACE_MAX; i++) {
+		struct mesh_trace_event* e = &t->ev[i];
+		const char* arg = "";
+		char argbuf[16];
+		switch(e->type) {
+		case mesh_trace_module:
+			arg = strmodulevent((enum module_ev)e->arg);
+			break;
+		case mesh_trace_module_exit:
+			arg = strextstate((enum module_ext_state)e->arg);
+			break;
+		case mesh_trace_cache:
+			arg = e->arg?"hit":"miss";
+			break;
+		case mesh_trace_reply:
+			snprintf(argbuf, sizeof(argbuf), "%d", e->arg);
+			arg = argbuf;
+			break;
+		case mesh_trace_send:
+		default:
+			break;
+		}
+		timeval_subtract(&d, &e->tv, &t->start);
+		if(!ssl_printf(ssl, "    +" ARG_LL "d.%6.6d %s %s %s\n",
+			(long long)d.tv_sec, (int)d.tv_usec,
+			(e->module>=0 && e->module<mesh->mods.num)?
+			mesh->mods.mod[e->module]->name:"-",
+			mesh_trace_type_to_str(e->type), arg))
+			return 0;
+	}
+	if(t->num > MESH_TRACE_MAX) {
+		if(!ssl_printf(ssl, "    ... %u more events\n",
+			(unsigned)(t->num - MESH_TRACE_MAX)))
+			return 0;
+	}
+	return 1;
+}
+
+/** do the dump_slow_queries command */
+static void
+do_dump_slow_queries(RES* ssl, struct worker* worker)
+{
+	struct mesh_area* mesh = worker->env.mesh;
+	size_t i;
+	int m;
+	char buf[257];
+	if(!ssl_printf(ssl, "thread #%d\n", worker->thread_num))
+		return;
+	if(!mesh || !mesh->trace_slow) {
+		(void)ssl_printf(ssl, "query tracing is disabled, "
+			"set trace-sample-rate\n");
+		return;
+	}
+	if(!ssl_printf(ssl, "%u traced, %u slow, last %u shown\n",
+		(unsigned)mesh->trace_num, (unsigned)mesh->trace_num_slow,
+		(unsigned)mesh->trace_slow_num))
+		return;
+	/* print the oldest first */
+	for(i=0; i<mesh->trace_slow_num; i++) {
+		struct mesh_trace_slow* s = &mesh->trace_slow[
+			(mesh->trace_slow_pos + MESH_TRACE_SLOW_MAX -
+			mesh->trace_slow_num + i) % MESH_TRACE_SLOW_MAX];
+		struct timeval total;
+		char* t = sldns_wire2str_type(s->qtype);
+		char* c = sldns_wire2str_class(s->qclass);
+		dname_str(s->qname, buf);
+		timeval_subtract(&total, &s->trace.end, &s->trace.start);
+		if(!ssl_printf(ssl, "%s %s %s " ARG_LL "d.%6.6d\n", buf,
+			(t?t:"TYPE??"), (c?c:"CLASS??"),
+			(long long)total.tv_sec, (int)total.tv_usec)) {
+			free(t);
+			free(c);
+			return;
+		}
+		free(t);
+		free(c);
+		for(m=0; m<mesh->mods.num && m<MAX_MODULE; m++) {
+			if(!(s->trace.mod_used & (1u<<m)))
+				continue;
+			if(!ssl_printf(ssl, "  %s time " ARG_LL "d.%6.6d busy "
+				ARG_LL "d.%6.6d\n", mesh->mods.mod[m]->name,
+				(long long)s->trace.mod_time[m].tv_sec,
+				(int)s->trace.mod_time[m].tv_usec,
+				(long long)s->trace.mod_busy[m].tv_sec,
+				(int)s->trace.mod_busy[m].tv_usec))
+				return;
+		}
+		if(!print_trace_events(ssl, mesh, &s->trace))
+			return;
+	}
+}
+
 /** structure for argument data for dump infra host */
 struct infra_arg {
 	/** the infra cache */
@@ -2425,11 +2660,12 @@ dump_infra_host(struct lruhash_entry* e, void* arg)
 		return;
 	}
 	if(!ssl_printf(a->ssl, "%s %s ttl %lu ping %d var %d rtt %d rto %d "
-		"tA %d tAAAA %d tother %d "
+		"p50 %d p99 %d tA %d tAAAA %d tother %d "
 		"ednsknown %d edns %d delay %d lame dnssec %d rec %d A %d "
 		"other %d\n", ip_str, name, (unsigned long)(d->ttl - a->now),
 		d->rtt.srtt, d->rtt.rttvar, rtt_notimeout(&d->rtt), d->rtt.rto,
-		d->timeout_A, d->timeout_AAAA, d->timeout_other,
+		rtt_sketch_percentile(&d->lat, 50),
+		rtt_sketch_percentile(&d->lat, 99), d->timeout_A, d->timeout_AAAA, d->timeout_other,
 		(int)d->edns_lame_known, (int)d->edns_version,
 		(int)(a->now<d->probedelay?(d->probedelay - a->now):0),
 		(int)d->isdnsseclame, (int)d->rec_lame, (int)d->lame_type_A,
@@ -3003,6 +3239,8 @@ execute_cmd(struct daemon_remote* rc, RES* ssl, char* cmd,
 		do_flush_name(ssl, worker, skipwhite(p+5));
 	} else if(cmdcmp(p, "dump_requestlist", 16)) {
 		do_dump_requestlist(ssl, worker);
+	} else if(cmdcmp(p, "dump_slow_queries", 17)) {
+		do_dump_slow_queries(ssl, worker);
 	} else if(cmdcmp(p, "dump_infra", 10)) {
 		do_dump_infra(ssl, worker);
 	} else if(cmdcmp(p, "log_reopen", 10)) {
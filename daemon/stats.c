@@ -62,6 +62,9 @@
 #include "services/cache/infra.h"
 #include "services/authzone.h"
 #include "validator/val_kcache.h"
+#include "validator/val_sigcache.h"
+#include "iterator/iter_nocut.h"
+#include "validator/val_nsec3cache.h"
 #include "validator/val_neg.h"
 #ifdef CLIENT_SUBNET
 #include "edns-subnet/subnetmod.h"
@@ -157,28 +160,94 @@ set_subnet_stats(struct worker* worker, struct ub_server_stats* svr,
 }
 #endif /* CLIENT_SUBNET */
 
-/** Set the neg cache stats. */
+/** Set the neg cache stats, counted per thread in the mesh. */
 static void
-set_neg_cache_stats(struct worker* worker, struct ub_server_stats* svr,
+set_neg_cache_stats(struct worker* worker, struct ub_server_stats* svr)
+{
+	struct mesh_area* mesh = worker->env.mesh;
+	svr->num_neg_cache_noerror = (long long)mesh->stats_neg_noerror;
+	svr->num_neg_cache_nxdomain = (long long)mesh->stats_neg_nxdomain;
+	svr->num_neg_cache_nsec3 = (long long)mesh->stats_neg_nsec3;
+}
+
+/** get signature cache entries and hit and miss counts from validator */
+static void
+get_sigcache_stats(struct worker* worker, struct ub_server_stats* svr,
 	int reset)
 {
 	int m = modstack_find(&worker->env.mesh->mods, "validator");
 	struct val_env* ve;
-	struct val_neg_cache* neg;
+	size_t hit, miss;
+	svr->sig_cache_count = 0;
+	svr->num_sig_cache_hit = 0;
+	svr->num_sig_cache_miss = 0;
 	if(m == -1)
 		return;
 	ve = (struct val_env*)worker->env.modinfo[m];
-	if(!ve->neg_cache)
+	if(!ve || !ve->sigcache)
 		return;
-	neg = ve->neg_cache;
-	lock_basic_lock(&neg->lock);
-	svr->num_neg_cache_noerror = (long long)neg->num_neg_cache_noerror;
-	svr->num_neg_cache_nxdomain = (long long)neg->num_neg_cache_nxdomain;
-	if(reset && !worker->env.cfg->stat_cumulative) {
-		neg->num_neg_cache_noerror = 0;
-		neg->num_neg_cache_nxdomain = 0;
+	val_sigcache_get_stats(ve->sigcache, &hit, &miss,
+		reset && !worker->env.cfg->stat_cumulative);
+	svr->sig_cache_count = (long long)count_slabhash_entries(
+		ve->sigcache->slab);
+	svr->num_sig_cache_hit = (long long)hit;
+	svr->num_sig_cache_miss = (long long)miss;
+}
+
+/** get NSEC3 hash cache entries and counters from validator */
+static void
+get_nsec3cache_stats(struct worker* worker, struct ub_server_stats* svr,
+	int reset)
+{
+	int m = modstack_find(&worker->env.mesh->mods, "validator");
+	struct val_env* ve;
+	size_t hit, miss, limited;
+	svr->nsec3_hash_cache_count = 0;
+	svr->num_nsec3_hash_hit = 0;
+	svr->num_nsec3_hash_miss = 0;
+	svr->num_nsec3_hash_ratelimited = 0;
+	if(m == -1)
+		return;
+	ve = (struct val_env*)worker->env.modinfo[m];
+	if(!ve || !ve->nsec3cache)
+		return;
+	val_nsec3cache_get_stats(ve->nsec3cache, &hit, &miss, &limited,
+		reset && !worker->env.cfg->stat_cumulative);
+	if(ve->nsec3cache->slab)
+		svr->nsec3_hash_cache_count = (long long)
+			count_slabhash_entries(ve->nsec3cache->slab);
+	svr->num_nsec3_hash_hit = (long long)hit;
+	svr->num_nsec3_hash_miss = (long long)miss;
+	svr->num_nsec3_hash_ratelimited = (long long)limited;
+}
+
+/** get signature checks and skips by algorithm from validator */
+static void
+get_sigalgo_stats(struct worker* worker, struct ub_server_stats* svr,
+	int reset)
+{
+	int m = modstack_find(&worker->env.mesh->mods, "validator");
+	struct val_env* ve;
+	int i;
+	for(i=0; i<UB_STATS_ALGO_NUM; i++) {
+		svr->num_sig_verify[i] = 0;
+		svr->num_sig_skip[i] = 0;
 	}
-	lock_basic_unlock(&neg->lock);
+	if(m == -1)
+		return;
+	ve = (struct val_env*)worker->env.modinfo[m];
+	if(!ve)
+		return;
+	lock_basic_lock(&ve->sigstat_lock);
+	for(i=0; i<UB_STATS_ALGO_NUM && i<VAL_ALGO_STATS_NUM; i++) {
+		svr->num_sig_verify[i] = (long long)ve->num_sig_verify[i];
+		svr->num_sig_skip[i] = (long long)ve->num_sig_skip[i];
+		if(reset && !worker->env.cfg->stat_cumulative) {
+			ve->num_sig_verify[i] = 0;
+			ve->num_sig_skip[i] = 0;
+		}
+	}
+	lock_basic_unlock(&ve->sigstat_lock);
 }
 
 /** get rrsets bogus number from validator */
@@ -217,6 +286,21 @@ get_queries_ratelimit(struct worker* worker, int reset)
 	return r;
 }
 
+/** get number of minimised queries skipped by the iterator */
+static void
+get_queries_minimise_skipped(struct worker* worker,
+	struct ub_server_stats* svr, int reset)
+{
+	int m = modstack_find(&worker->env.mesh->mods, "iterator");
+	struct iter_env* ie;
+	svr->queries_minimise_skipped = 0;
+	if(m == -1)
+		return;
+	ie = (struct iter_env*)worker->env.modinfo[m];
+	svr->queries_minimise_skipped = (long long)iter_nocut_get_skipped(
+		ie->nocut, reset && !worker->env.cfg->stat_cumulative);
+}
+
 #ifdef USE_DNSCRYPT
 /** get the number of shared secret cache miss */
 static size_t
@@ -250,6 +334,26 @@ get_dnscrypt_replay(struct worker* worker, int reset)
 }
 #endif /* USE_DNSCRYPT */
 
+/** Set the per module query trace stats */
+static void
+set_trace_stats(struct mesh_area* mesh, struct ub_server_stats* svr)
+{
+	int i, b;
+	svr->trace_num = (long long)mesh->trace_num;
+	svr->trace_num_slow = (long long)mesh->trace_num_slow;
+	for(i=0; i<UB_STATS_TRACE_MODULE_NUM && i<MAX_MODULE; i++) {
+		svr->trace_mod_num[i] = (long long)mesh->trace_mod_num[i];
+		svr->trace_mod_sum_sec[i] =
+			(long long)mesh->trace_mod_sum[i].tv_sec;
+		svr->trace_mod_sum_usec[i] =
+			(long long)mesh->trace_mod_sum[i].tv_usec;
+		for(b=0; b<UB_STATS_TRACE_BUCKET_NUM &&
+			b<MESH_TRACE_BUCKETS; b++)
+			svr->trace_mod_hist[i][b] =
+				(long long)mesh->trace_mod_hist[i][b];
+	}
+}
+
 void
 server_stats_compile(struct worker* worker, struct ub_stats_info* s, int reset)
 {
@@ -264,13 +368,35 @@ server_stats_compile(struct worker* worker, struct ub_stats_info* s, int reset)
 	s->mesh_replies_sent = (long long)worker->env.mesh->replies_sent;
 	s->mesh_replies_sum_wait_sec = (long long)worker->env.mesh->replies_sum_wait.tv_sec;
 	s->mesh_replies_sum_wait_usec = (long long)worker->env.mesh->replies_sum_wait.tv_usec;
+	for(i=0; i<UB_STATS_MESH_CLASS_NUM; i++) {
+		s->mesh_class_num[i] = (long long)worker->env.mesh->class_num[i];
+		s->mesh_class_dropped[i] = (long long)worker->env.mesh->
+			class_dropped[i];
+		s->mesh_class_done[i] = (long long)worker->env.mesh->
+			class_done[i];
+		s->mesh_class_sum_wait_sec[i] = (long long)worker->env.mesh->
+			class_sum_wait[i].tv_sec;
+		s->mesh_class_sum_wait_usec[i] = (long long)worker->env.mesh->
+			class_sum_wait[i].tv_usec;
+	}
+	s->mesh_fair_clients = (long long)worker->env.mesh->clients.count;
+	s->mesh_fair_evicted = (long long)worker->env.mesh->stats_fair_evicted;
+	s->mesh_fair_dropped = (long long)worker->env.mesh->stats_fair_dropped;
 	s->mesh_time_median = timehist_quartile(worker->env.mesh->histogram,
 		0.50);
 
 	/* add in the values from the mesh */
 	s->svr.ans_secure += (long long)worker->env.mesh->ans_secure;
 	s->svr.ans_bogus += (long long)worker->env.mesh->ans_bogus;
+	s->svr.zero_ttl_responses += (long long)worker->env.mesh->ans_expired;
+	s->svr.num_dname_synth += (long long)worker->env.mesh->num_dname_synth;
 	s->svr.ans_rcode_nodata += (long long)worker->env.mesh->ans_nodata;
+	s->svr.rrset_unchanged += (long long)worker->env.mesh->
+		num_rrset_unchanged;
+	s->svr.queries_hedged += (long long)worker->env.mesh->
+		num_queries_hedged;
+	s->svr.queries_hedge_denied += (long long)worker->env.mesh->
+		num_hedges_denied;
 	for(i=0; i<16; i++)
 		s->svr.ans_rcode[i] += (long long)worker->env.mesh->ans_rcode[i];
 	timehist_export(worker->env.mesh->histogram, s->svr.hist, 
@@ -285,6 +411,9 @@ server_stats_compile(struct worker* worker, struct ub_stats_info* s, int reset)
 	/* get and reset iterator query ratelimit number */
 	s->svr.queries_ratelimited = (long long)get_queries_ratelimit(worker, reset);
 
+	/* get and reset the skipped minimised query number */
+	get_queries_minimise_skipped(worker, &s->svr, reset);
+
 	/* get cache sizes */
 	s->svr.msg_cache_count = (long long)count_slabhash_entries(worker->env.msg_cache);
 	s->svr.rrset_cache_count = (long long)count_slabhash_entries(&worker->env.rrset_cache->table);
@@ -292,6 +421,9 @@ server_stats_compile(struct worker* worker, struct ub_stats_info* s, int reset)
 	if(worker->env.key_cache)
 		s->svr.key_cache_count = (long long)count_slabhash_entries(worker->env.key_cache->slab);
 	else	s->svr.key_cache_count = 0;
+	get_sigcache_stats(worker, &s->svr, reset);
+	get_sigalgo_stats(worker, &s->svr, reset);
+	get_nsec3cache_stats(worker, &s->svr, reset);
 
 #ifdef USE_DNSCRYPT
 	if(worker->daemon->dnscenv) {
@@ -333,9 +465,15 @@ server_stats_compile(struct worker* worker, struct ub_stats_info* s, int reset)
 	}
 	s->svr.mem_stream_wait =
 		(long long)tcp_req_info_get_stream_buffer_size();
+	s->svr.num_alloc_reg_reused = (long long)worker->alloc.num_reg_reused;
+	s->svr.num_alloc_reg_new = (long long)worker->alloc.num_reg_new;
+	s->svr.num_alloc_chunk_reused =
+		(long long)worker->alloc.chunks.num_reused;
+	s->svr.num_alloc_chunk_new = (long long)worker->alloc.chunks.num_new;
+	set_trace_stats(worker->env.mesh, &s->svr);
 
 	/* Set neg cache usage numbers */
-	set_neg_cache_stats(worker, &s->svr, reset);
+	set_neg_cache_stats(worker, &s->svr);
 #ifdef CLIENT_SUBNET
 	/* EDNS Subnet usage numbers */
 	set_subnet_stats(worker, &s->svr, reset);
@@ -393,10 +531,14 @@ void server_stats_reply(struct worker* worker, int reset)
 
 void server_stats_add(struct ub_stats_info* total, struct ub_stats_info* a)
 {
+	int i;
 	total->svr.num_queries += a->svr.num_queries;
 	total->svr.num_queries_ip_ratelimited += a->svr.num_queries_ip_ratelimited;
 	total->svr.num_queries_missed_cache += a->svr.num_queries_missed_cache;
 	total->svr.num_queries_prefetch += a->svr.num_queries_prefetch;
+	total->svr.num_refresh += a->svr.num_refresh;
+	total->svr.num_refresh_useful += a->svr.num_refresh_useful;
+	total->svr.num_refresh_upstream += a->svr.num_refresh_upstream;
 	total->svr.sum_query_list_size += a->svr.sum_query_list_size;
 #ifdef USE_DNSCRYPT
 	total->svr.num_query_dnscrypt_crypted += a->svr.num_query_dnscrypt_crypted;
@@ -411,7 +553,6 @@ void server_stats_add(struct ub_stats_info* total, struct ub_stats_info* a)
 		total->svr.max_query_list_size = a->svr.max_query_list_size;
 
 	if(a->svr.extended) {
-		int i;
 		total->svr.qtype_big += a->svr.qtype_big;
 		total->svr.qclass_big += a->svr.qclass_big;
 		total->svr.qtcp += a->svr.qtcp;
@@ -433,9 +574,23 @@ void server_stats_add(struct ub_stats_info* total, struct ub_stats_info* a)
 		total->svr.zero_ttl_responses += a->svr.zero_ttl_responses;
 		total->svr.ans_secure += a->svr.ans_secure;
 		total->svr.ans_bogus += a->svr.ans_bogus;
+		total->svr.num_dname_synth += a->svr.num_dname_synth;
+		total->svr.num_neg_cache_noerror +=
+			a->svr.num_neg_cache_noerror;
+		total->svr.num_neg_cache_nxdomain +=
+			a->svr.num_neg_cache_nxdomain;
+		total->svr.num_neg_cache_nsec3 += a->svr.num_neg_cache_nsec3;
+		total->svr.rrset_unchanged += a->svr.rrset_unchanged;
+		total->svr.queries_hedged += a->svr.queries_hedged;
+		total->svr.queries_hedge_denied += a->svr.queries_hedge_denied;
 		total->svr.unwanted_replies += a->svr.unwanted_replies;
 		total->svr.unwanted_queries += a->svr.unwanted_queries;
 		total->svr.tcp_accept_usage += a->svr.tcp_accept_usage;
+		total->svr.num_alloc_reg_reused += a->svr.num_alloc_reg_reused;
+		total->svr.num_alloc_reg_new += a->svr.num_alloc_reg_new;
+		total->svr.num_alloc_chunk_reused +=
+			a->svr.num_alloc_chunk_reused;
+		total->svr.num_alloc_chunk_new += a->svr.num_alloc_chunk_new;
 		for(i=0; i<UB_STATS_QTYPE_NUM; i++)
 			total->svr.qtype[i] += a->svr.qtype[i];
 		for(i=0; i<UB_STATS_QCLASS_NUM; i++)
@@ -458,6 +613,62 @@ void server_stats_add(struct ub_stats_info* total, struct ub_stats_info* a)
 	 * taking the median over all of the data, but is good and fast
 	 * added up here, division later*/
 	total->mesh_time_median += a->mesh_time_median;
+	total->mesh_fair_clients += a->mesh_fair_clients;
+	total->mesh_fair_evicted += a->mesh_fair_evicted;
+	total->mesh_fair_dropped += a->mesh_fair_dropped;
+	total->svr.num_handoff_out += a->svr.num_handoff_out;
+	total->svr.num_handoff_in += a->svr.num_handoff_in;
+	if(a->mesh_imbalance > total->mesh_imbalance)
+		total->mesh_imbalance = a->mesh_imbalance;
+	total->svr.trace_num += a->svr.trace_num;
+	total->svr.trace_num_slow += a->svr.trace_num_slow;
+	for(i=0; i<UB_STATS_TRACE_MODULE_NUM; i++) {
+		int b;
+		total->svr.trace_mod_num[i] += a->svr.trace_mod_num[i];
+		stats_timeval_add(&total->svr.trace_mod_sum_sec[i],
+			&total->svr.trace_mod_sum_usec[i],
+			a->svr.trace_mod_sum_sec[i],
+			a->svr.trace_mod_sum_usec[i]);
+		for(b=0; b<UB_STATS_TRACE_BUCKET_NUM; b++)
+			total->svr.trace_mod_hist[i][b] +=
+				a->svr.trace_mod_hist[i][b];
+	}
+	for(i=0; i<UB_STATS_MESH_CLASS_NUM; i++) {
+		total->mesh_class_num[i] += a->mesh_class_num[i];
+		total->mesh_class_dropped[i] += a->mesh_class_dropped[i];
+		total->mesh_class_done[i] += a->mesh_class_done[i];
+		stats_timeval_add(&total->mesh_class_sum_wait_sec[i],
+			&total->mesh_class_sum_wait_usec[i],
+			a->mesh_class_sum_wait_sec[i],
+			a->mesh_class_sum_wait_usec[i]);
+	}
+}
+
+/** average request list size of the thread */
+static double
+stats_requestlist_avg(struct ub_stats_info* s)
+{
+	long long n = s->svr.num_queries_missed_cache +
+		s->svr.num_queries_prefetch;
+	if(n == 0)
+		return 0.0;
+	return (double)s->svr.sum_query_list_size / (double)n;
+}
+
+void
+server_stats_imbalance(struct ub_stats_info* stats, int num)
+{
+	double mean = 0.0;
+	int i;
+	for(i=0; i<num; i++)
+		mean += stats_requestlist_avg(&stats[i]);
+	mean /= (double)num;
+	for(i=0; i<num; i++) {
+		if(mean > 0.0)
+			stats[i].mesh_imbalance =
+				stats_requestlist_avg(&stats[i]) / mean;
+		else	stats[i].mesh_imbalance = 1.0;
+	}
 }
 
 void server_stats_insquery(struct ub_server_stats* stats, struct comm_point* c,
@@ -106,6 +106,15 @@ void server_stats_reply(struct worker* worker, int reset);
  */
 void server_stats_add(struct ub_stats_info* total, struct ub_stats_info* a);
 
+/**
+ * Compute the request list imbalance of the threads. The average
+ * request list size of every thread is divided by the mean over the
+ * threads, 1.0 is an evenly loaded thread.
+ * @param stats: array of thread statistics, mesh_imbalance is set.
+ * @param num: number of threads in the array.
+ */
+void server_stats_imbalance(struct ub_stats_info* stats, int num);
+
 /**
  * Add stats for this query
  * @param stats: the stats
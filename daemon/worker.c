@@ -58,6 +58,7 @@
 #include "services/cache/rrset.h"
 #include "services/cache/infra.h"
 #include "services/cache/dns.h"
+#include "services/cache/refresh.h"
 #include "services/authzone.h"
 #include "services/mesh.h"
 #include "services/localzone.h"
@@ -157,7 +158,8 @@ worker_mem_report(struct worker* ATTR_UNUSED(worker),
 		+ sizeof(*worker->env.scratch_buffer) 
 		+ sldns_buffer_capacity(worker->env.scratch_buffer)
 		+ forwards_get_mem(worker->env.fwds)
-		+ hints_get_mem(worker->env.hints);
+		+ hints_get_mem(worker->env.hints)
+		+ refresh_get_mem(worker->refresh);
 	if(worker->thread_num == 0)
 		me += acl_list_get_mem(worker->daemon->acl);
 	if(cur_serv) {
@@ -415,6 +417,208 @@ worker_handle_control_cmd(struct tube* ATTR_UNUSED(tube), uint8_t* msg,
 	}
 }
 
+/** append an entry to the handoff queue of a worker, signal if needed */
+static void
+worker_handoff_push(struct worker* to, struct worker_handoff* h)
+{
+	uint8_t sig = 0;
+	h->next = NULL;
+	lock_basic_lock(&to->handoff_lock);
+	if(to->handoff_last)
+		to->handoff_last->next = h;
+	else	to->handoff_first = h;
+	to->handoff_last = h;
+	/* one signal is pending at most, so the pipe does not fill up,
+	 * and a thread that has stopped cannot block the writer */
+	if(!to->handoff_signalled) {
+		if(tube_write_msg(to->handoff_tube, &sig, sizeof(sig), 1) == 1)
+			to->handoff_signalled = 1;
+		else	log_err("could not signal handoff to thread %d",
+				to->thread_num);
+	}
+	lock_basic_unlock(&to->handoff_lock);
+}
+
+/** create a handoff entry with room for len bytes of data */
+static struct worker_handoff*
+worker_handoff_create(size_t len)
+{
+	struct worker_handoff* h = (struct worker_handoff*)malloc(
+		sizeof(*h) + len);
+	if(!h)
+		return NULL;
+	memset(h, 0, sizeof(*h));
+	h->data = (uint8_t*)(h+1);
+	h->len = len;
+	return h;
+}
+
+/** free the handoff queue and comm points of a worker, at shutdown,
+ * after the mesh is deleted */
+static void
+worker_handoff_clear(struct worker* worker)
+{
+	struct worker_handoff* h, *n;
+	struct worker_handoff_cp* p, *np;
+	lock_basic_lock(&worker->handoff_lock);
+	h = worker->handoff_first;
+	worker->handoff_first = NULL;
+	worker->handoff_last = NULL;
+	lock_basic_unlock(&worker->handoff_lock);
+	while(h) {
+		n = h->next;
+		free(h);
+		h = n;
+	}
+	for(p = worker->handoff_cps; p; p = np) {
+		np = p->next;
+		free(p);
+	}
+	worker->handoff_cps = NULL;
+}
+
+/** publish the load of the worker, for the other workers to read */
+static void
+worker_handoff_load(struct worker* worker)
+{
+	lock_basic_lock(&worker->handoff_lock);
+	worker->handoff_load = worker->env.mesh->num_reply_states;
+	lock_basic_unlock(&worker->handoff_lock);
+}
+
+/**
+ * Hand a client query to a less busy worker, if this worker is busy.
+ * Uses the load that the other workers last published, as a hint.
+ * @return true if the query was handed off.
+ */
+static int
+worker_handoff_query(struct worker* worker, struct query_info* qinfo,
+	uint16_t qflags, struct edns_data* edns, struct comm_reply* repinfo,
+	uint16_t qid)
+{
+	struct daemon* daemon = worker->daemon;
+	size_t load = worker->env.mesh->num_reply_states;
+	size_t max = worker->env.mesh->max_reply_states;
+	size_t min = load;
+	struct worker* to = NULL;
+	struct worker_handoff* h;
+	int i;
+	worker_handoff_load(worker);
+	if(load < max/2)
+		return 0;
+	for(i=0; i<daemon->num; i++) {
+		struct worker* w = daemon->workers[i];
+		size_t wload;
+		if(!w || w == worker)
+			continue;
+		lock_basic_lock(&w->handoff_lock);
+		wload = w->handoff_load;
+		lock_basic_unlock(&w->handoff_lock);
+		if(wload < min) {
+			min = wload;
+			to = w;
+		}
+	}
+	if(!to || load - min <= max/4)
+		return 0;
+	if(!(h = worker_handoff_create(qinfo->qname_len)))
+		return 0;
+	h->repinfo = *repinfo;
+	memmove(h->data, qinfo->qname, qinfo->qname_len);
+	h->qinfo.qname = h->data;
+	h->qinfo.qname_len = qinfo->qname_len;
+	h->qinfo.qtype = qinfo->qtype;
+	h->qinfo.qclass = qinfo->qclass;
+	h->qflags = qflags;
+	h->qid = qid;
+	h->edns = *edns;
+	h->edns.opt_list = NULL;
+	verbose(VERB_ALGO, "hand query to thread %d, load %d, other %d",
+		to->thread_num, (int)load, (int)min);
+	worker->stats.num_handoff_out++;
+	worker_handoff_push(to, h);
+	return 1;
+}
+
+/**
+ * Get the comm point of this worker that sends replies on the socket of
+ * a comm point of another worker.  Made when first needed.
+ * @return NULL on malloc failure.
+ */
+static struct comm_point*
+worker_handoff_cp(struct worker* worker, struct comm_point* orig)
+{
+	struct worker_handoff_cp* p;
+	for(p = worker->handoff_cps; p; p = p->next) {
+		if(p->orig == orig)
+			return &p->cp;
+	}
+	p = (struct worker_handoff_cp*)calloc(1, sizeof(*p));
+	if(!p)
+		return NULL;
+	p->orig = orig;
+	p->cp.type = comm_udp;
+	p->cp.fd = orig->fd;
+	p->cp.do_not_close = 1;
+	p->cp.buffer = worker->front->udp_buff;
+#ifdef USE_DNSCRYPT
+	p->cp.dnscrypt_buffer = p->cp.buffer;
+#endif
+#ifdef USE_DNSTAP
+	if(orig->dtenv)
+		p->cp.dtenv = &worker->dtenv;
+#endif
+	p->next = worker->handoff_cps;
+	worker->handoff_cps = p;
+	return &p->cp;
+}
+
+/** resolve a query that was handed off by another worker, as a client
+ * query of this worker, so that the request list limits, the reply
+ * stats and the reply logging are the same as for its own queries */
+static void
+worker_handoff_resolve(struct worker* worker, struct worker_handoff* h)
+{
+	struct comm_point* c = worker_handoff_cp(worker, h->repinfo.c);
+	worker->stats.num_handoff_in++;
+	if(!c) {
+		/* the client retries */
+		log_err("could not resolve handed off query");
+		return;
+	}
+	h->repinfo.c = c;
+	mesh_new_client(worker->env.mesh, &h->qinfo, NULL, h->qflags,
+		&h->edns, &h->repinfo, h->qid);
+	worker_mem_report(worker, NULL);
+}
+
+void
+worker_handle_handoff(struct tube* ATTR_UNUSED(tube), uint8_t* msg,
+	size_t ATTR_UNUSED(len), int error, void* arg)
+{
+	struct worker* worker = (struct worker*)arg;
+	struct worker_handoff* h, *n;
+	free(msg);
+	if(error != NETEVENT_NOERROR) {
+		if(error != NETEVENT_CLOSED)
+			log_info("handoff event: %d", error);
+		return;
+	}
+	lock_basic_lock(&worker->handoff_lock);
+	h = worker->handoff_first;
+	worker->handoff_first = NULL;
+	worker->handoff_last = NULL;
+	worker->handoff_signalled = 0;
+	lock_basic_unlock(&worker->handoff_lock);
+	while(h) {
+		n = h->next;
+		worker_handoff_resolve(worker, h);
+		free(h);
+		h = n;
+	}
+	worker_handoff_load(worker);
+}
+
 /** check if a delegation is secure */
 static enum sec_status
 check_delegation_secure(struct reply_info *rep) 
@@ -632,6 +836,11 @@ answer_from_cache(struct worker* worker, struct query_info* qinfo,
 		if(worker->env.cfg->serve_expired_ttl &&
 			rep->serve_expired_ttl < timenow)
 			return 0;
+		/* with a client timeout the expired answer waits for the
+		 * resolution, the mesh serves it when the timer fires */
+		if(worker->env.cfg->serve_expired_client_timeout &&
+			rep->ttl < timenow)
+			return 0;
 		if(!rrset_array_lock(rep->ref, rep->rrset_count, 0))
 			return 0;
 		/* below, rrsets with ttl before timenow become TTL 0 in
@@ -782,6 +991,62 @@ reply_and_prefetch(struct worker* worker, struct query_info* qinfo,
 		PREFETCH_EXPIRY_ADD);
 }
 
+/** set the timer for the refresh of popular entries, if not set already */
+static void
+worker_refresh_timer_start(struct worker* worker)
+{
+	struct timeval tv;
+	if(worker->refresh_timer_set)
+		return;
+#ifndef S_SPLINT_S
+	tv.tv_sec = REFRESH_TICK_MSEC/1000;
+	tv.tv_usec = (REFRESH_TICK_MSEC%1000)*1000;
+#endif
+	comm_timer_set(worker->refresh_timer, &tv);
+	worker->refresh_timer_set = 1;
+}
+
+/** count a cache hit for the refresh of popular entries */
+static void
+worker_refresh_note(struct worker* worker, struct query_info* qinfo,
+	uint16_t flags, struct reply_info* rep)
+{
+	if(refresh_note(worker->refresh, qinfo, flags, rep->ttl,
+		rep->prefetch_ttl, *worker->env.now))
+		worker->stats.num_refresh_useful++;
+	worker_refresh_timer_start(worker);
+}
+
+void worker_refresh_timer_cb(void* arg)
+{
+	struct worker* worker = (struct worker*)arg;
+	struct refresh_entry* e;
+	struct query_info qinfo;
+	time_t now = *worker->env.now;
+	size_t i, num;
+
+	worker->refresh_timer_set = 0;
+	num = refresh_select(worker->refresh, now);
+	for(i=0; i<num; i++) {
+		e = worker->refresh->pick[i];
+		memset(&qinfo, 0, sizeof(qinfo));
+		qinfo.qname = e->qname;
+		qinfo.qname_len = e->qname_len;
+		qinfo.qtype = e->qtype;
+		qinfo.qclass = e->qclass;
+		if(verbosity >= VERB_ALGO)
+			log_query_info(VERB_ALGO, "refresh popular entry",
+				&qinfo);
+		worker->stats.num_refresh++;
+		/* like a prefetch, it replaces the entry that has not
+		 * expired yet */
+		mesh_new_refresh(worker->env.mesh, &qinfo, e->qflags,
+			e->expire - now + PREFETCH_EXPIRY_ADD);
+	}
+	if(worker->refresh->due.count > 0)
+		worker_refresh_timer_start(worker);
+}
+
 /**
  * Fill CH class answer into buffer. Keeps query.
  * @param pkt: buffer
@@ -1461,6 +1726,12 @@ lookup_cache:
 				*(uint16_t*)(void *)sldns_buffer_begin(c->buffer),
 				sldns_buffer_read_u16_at(c->buffer, 2), repinfo,
 				&edns)) {
+				if(worker->refresh)
+					worker_refresh_note(worker,
+						lookup_qinfo,
+						sldns_buffer_read_u16_at(
+						c->buffer, 2),
+						(struct reply_info*)e->data);
 				/* prefetch it if the prefetch TTL expired.
 				 * Note that if there is more than one pass
 				 * its qname must be that used for cache
@@ -1536,6 +1807,21 @@ lookup_cache:
 				&repinfo->addr, repinfo->addrlen);
 	}
 
+	/* a busy thread hands the query to a less busy thread, that
+	 * sends the reply on the socket of this comm point */
+	if(worker->env.cfg->work_stealing && worker->daemon->num > 1 &&
+		c->type == comm_udp && !cinfo && !edns.opt_list &&
+		!qinfo.local_alias &&
+#ifdef USE_DNSCRYPT
+		!repinfo->is_dnscrypted &&
+#endif
+		worker_handoff_query(worker, &qinfo,
+		sldns_buffer_read_u16_at(c->buffer, 2), &edns, repinfo,
+		*(uint16_t*)(void *)sldns_buffer_begin(c->buffer))) {
+		regional_free_all(worker->scratchpad);
+		return 0;
+	}
+
 	/* grab a work request structure for this new request */
 	mesh_new_client(worker->env.mesh, &qinfo, cinfo,
 		sldns_buffer_read_u16_at(c->buffer, 2),
@@ -1666,6 +1952,23 @@ worker_create(struct daemon* daemon, int id, int* ports, int n)
 		free(worker);
 		return NULL;
 	}
+	if(!(worker->handoff_tube = tube_create())) {
+		tube_delete(worker->cmd);
+		free(worker->ports);
+		free(worker);
+		return NULL;
+	}
+	lock_basic_init(&worker->handoff_lock);
+	lock_protect(&worker->handoff_lock, &worker->handoff_first,
+		sizeof(worker->handoff_first));
+	lock_protect(&worker->handoff_lock, &worker->handoff_last,
+		sizeof(worker->handoff_last));
+	lock_protect(&worker->handoff_lock, &worker->handoff_signalled,
+		sizeof(worker->handoff_signalled));
+	lock_protect(&worker->handoff_lock, &worker->handoff_load,
+		sizeof(worker->handoff_load));
+	/* no queries are handed to the worker before it has a mesh */
+	worker->handoff_load = (size_t)-1;
 	/* create random state here to avoid locking trouble in RAND_bytes */
 	seed = (unsigned int)time(NULL) ^ (unsigned int)getpid() ^
 		(((unsigned int)worker->thread_num)<<17);
@@ -1673,6 +1976,8 @@ worker_create(struct daemon* daemon, int id, int* ports, int n)
 	if(!(worker->rndstate = ub_initstate(seed, daemon->rand))) {
 		explicit_bzero(&seed, sizeof(seed));
 		log_err("could not init random numbers.");
+		lock_basic_destroy(&worker->handoff_lock);
+		tube_delete(worker->handoff_tube);
 		tube_delete(worker->cmd);
 		free(worker->ports);
 		free(worker);
@@ -1781,6 +2086,12 @@ worker_init(struct worker* worker, struct config_file *cfg,
 		worker_delete(worker);
 		return 0;
 	}
+	if(!tube_setup_bg_listen(worker->handoff_tube, worker->base,
+		&worker_handle_handoff, worker)) {
+		log_err("could not create handoff compt.");
+		worker_delete(worker);
+		return 0;
+	}
 	worker->stat_timer = comm_timer_create(worker->base, 
 		worker_stat_timer_cb, worker);
 	if(!worker->stat_timer) {
@@ -1868,6 +2179,18 @@ worker_init(struct worker* worker, struct config_file *cfg,
 		worker_delete(worker);
 		return 0;
 	}
+	worker_handoff_load(worker);
+	if(cfg->refresh_popular) {
+		worker->refresh = refresh_create(cfg->refresh_popular_size,
+			cfg->refresh_popular_rate, worker->rndstate);
+		worker->refresh_timer = comm_timer_create(worker->base,
+			worker_refresh_timer_cb, worker);
+		if(!worker->refresh || !worker->refresh_timer) {
+			log_err("could not create refresh of popular entries");
+			worker_delete(worker);
+			return 0;
+		}
+	}
 	worker_mem_report(worker, NULL);
 	/* if statistics enabled start timer */
 	if(worker->env.cfg->stat_interval > 0) {
@@ -1903,8 +2226,13 @@ worker_delete(struct worker* worker)
 	outside_network_delete(worker->back);
 	comm_signal_delete(worker->comsig);
 	tube_delete(worker->cmd);
+	tube_delete(worker->handoff_tube);
+	worker_handoff_clear(worker);
+	lock_basic_destroy(&worker->handoff_lock);
 	comm_timer_delete(worker->stat_timer);
+	comm_timer_delete(worker->refresh_timer);
 	comm_timer_delete(worker->env.probe_timer);
+	refresh_delete(worker->refresh);
 	free(worker->ports);
 	if(worker->thread_num == 0) {
 #ifdef UB_ON_WINDOWS
@@ -1938,6 +2266,10 @@ worker_send_query(struct query_info* qinfo, uint16_t flags, int dnssec,
 	if(!e->qsent) {
 		return NULL;
 	}
+	if(q->mesh_info->refresh)
+		worker->stats.num_refresh_upstream++;
+	if(q->mesh_info->trace)
+		mesh_trace_event(q, mesh_trace_send, 0);
 	return e;
 }
 
@@ -1945,7 +2277,7 @@ void
 worker_alloc_cleanup(void* arg)
 {
 	struct worker* worker = (struct worker*)arg;
-	slabhash_clear(&worker->env.rrset_cache->table);
+	rrset_cache_clear(worker->env.rrset_cache);
 	slabhash_clear(worker->env.msg_cache);
 }
 
@@ -1953,6 +2285,7 @@ void worker_stats_clear(struct worker* worker)
 {
 	server_stats_init(&worker->stats, worker->env.cfg);
 	mesh_stats_clear(worker->env.mesh);
+	alloc_reg_stats_clear(&worker->alloc);
 	worker->back->unwanted_replies = 0;
 	worker->back->num_tcp_outgoing = 0;
 }
@@ -62,6 +62,7 @@ struct regional;
 struct tube;
 struct daemon_remote;
 struct query_info;
+struct refresh_table;
 
 /** worker commands */
 enum worker_commands {
@@ -88,6 +89,22 @@ struct worker {
 	ub_thread_type thr_id;
 	/** pipe, for commands for this worker */
 	struct tube* cmd;
+	/** pipe, signals that the handoff queue has entries */
+	struct tube* handoff_tube;
+	/** lock on the handoff queue, other threads append to it */
+	lock_basic_type handoff_lock;
+	/** queue of queries handed to this worker */
+	struct worker_handoff* handoff_first;
+	/** last entry of the handoff queue, to append to */
+	struct worker_handoff* handoff_last;
+	/** if a signal for the handoff queue is pending in the pipe */
+	int handoff_signalled;
+	/** the number of reply states of this worker, as it last published
+	 * it for the other workers, under the handoff lock */
+	size_t handoff_load;
+	/** comm points of this worker that send the replies to handed
+	 * off queries, on the sockets of the other workers */
+	struct worker_handoff_cp* handoff_cps;
 	/** the event base this worker works with */
 	struct comm_base* base;
 	/** the frontside listening interface where request events come in */
@@ -104,6 +121,12 @@ struct worker {
 	struct comm_point* cmd_com;
 	/** timer for statistics */
 	struct comm_timer* stat_timer;
+	/** popular message cache entries to refresh, or NULL if disabled */
+	struct refresh_table* refresh;
+	/** timer for the refresh of popular entries */
+	struct comm_timer* refresh_timer;
+	/** if the refresh timer is set */
+	int refresh_timer_set;
 	/** ratelimit for errors, time value */
 	time_t err_limit_time;
 	/** ratelimit for errors, packet count */
@@ -129,6 +152,46 @@ struct worker {
 #endif
 };
 
+/**
+ * Query passed between workers for work stealing.
+ * A busy worker hands a client query to a less busy worker, that
+ * resolves it as a client query of its own.  The reply is sent on the
+ * socket that received the query.
+ */
+struct worker_handoff {
+	/** next in the handoff queue */
+	struct worker_handoff* next;
+	/** client reply information, the comm point is of the worker that
+	 * received the query */
+	struct comm_reply repinfo;
+	/** query info, the qname points into data */
+	struct query_info qinfo;
+	/** flags of the query */
+	uint16_t qflags;
+	/** query id, network format */
+	uint16_t qid;
+	/** edns data from the query, no options */
+	struct edns_data edns;
+	/** the qname for the query */
+	uint8_t* data;
+	/** length of data */
+	size_t len;
+};
+
+/**
+ * UDP comm point that sends replies on the socket of a comm point of
+ * another worker.  It has the buffer of this worker, the mesh encodes
+ * the reply in it.  It does not listen.
+ */
+struct worker_handoff_cp {
+	/** next in the list of the worker */
+	struct worker_handoff_cp* next;
+	/** the comm point of the other worker */
+	struct comm_point* orig;
+	/** the comm point that sends the replies */
+	struct comm_point cp;
+};
+
 /**
  * Create the worker structure. Bare bones version, zeroed struct,
  * with backpointers only. Use worker_init on it later.
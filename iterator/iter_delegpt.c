@@ -50,6 +50,32 @@
 #include "sldns/rrdef.h"
 #include "sldns/sbuffer.h"
 
+int
+delegpt_ns_cmp(const void* k1, const void* k2)
+{
+	struct delegpt_ns* n1 = (struct delegpt_ns*)k1;
+	struct delegpt_ns* n2 = (struct delegpt_ns*)k2;
+	if(n1->namelen != n2->namelen)
+		return (n1->namelen < n2->namelen)?-1:1;
+	return query_dname_compare(n1->name, n2->name);
+}
+
+int
+delegpt_addr_cmp(const void* k1, const void* k2)
+{
+	struct delegpt_addr* a1 = (struct delegpt_addr*)k1;
+	struct delegpt_addr* a2 = (struct delegpt_addr*)k2;
+	return sockaddr_cmp(&a1->addr, a1->addrlen, &a2->addr, a2->addrlen);
+}
+
+/** init the name and address index of the delegation point */
+static void
+delegpt_init_trees(struct delegpt* dp)
+{
+	rbtree_init(&dp->nstree, &delegpt_ns_cmp);
+	rbtree_init(&dp->addrtree, &delegpt_addr_cmp);
+}
+
 struct delegpt* 
 delegpt_create(struct regional* region)
 {
@@ -58,6 +84,7 @@ delegpt_create(struct regional* region)
 	if(!dp)
 		return NULL;
 	memset(dp, 0, sizeof(*dp));
+	delegpt_init_trees(dp);
 	return dp;
 }
 
@@ -107,7 +134,7 @@ delegpt_add_ns(struct delegpt* dp, struct regional* region, uint8_t* name,
 	size_t len;
 	(void)dname_count_size_labels(name, &len);
 	log_assert(!dp->dp_type_mlc);
-	/* slow check for duplicates to avoid counting failures when
+	/* check for duplicates to avoid counting failures when
 	 * adding the same server as a dependency twice */
 	if(delegpt_find_ns(dp, name, len))
 		return 1;
@@ -115,47 +142,44 @@ delegpt_add_ns(struct delegpt* dp, struct regional* region, uint8_t* name,
 		sizeof(struct delegpt_ns));
 	if(!ns)
 		return 0;
-	ns->next = dp->nslist;
 	ns->namelen = len;
-	dp->nslist = ns;
 	ns->name = regional_alloc_init(region, name, ns->namelen);
+	if(!ns->name)
+		return 0;
+	ns->next = dp->nslist;
+	dp->nslist = ns;
+	ns->node.key = ns;
+	(void)rbtree_insert(&dp->nstree, &ns->node);
 	ns->resolved = 0;
 	ns->got4 = 0;
 	ns->got6 = 0;
 	ns->lame = lame;
 	ns->done_pside4 = 0;
 	ns->done_pside6 = 0;
-	return ns->name != 0;
+	return 1;
 }
 
 struct delegpt_ns*
 delegpt_find_ns(struct delegpt* dp, uint8_t* name, size_t namelen)
 {
-	struct delegpt_ns* p = dp->nslist;
-	while(p) {
-		if(namelen == p->namelen && 
-			query_dname_compare(name, p->name) == 0) {
-			return p;
-		}
-		p = p->next;
-	}
-	return NULL;
+	struct delegpt_ns key;
+	key.node.key = &key;
+	key.name = name;
+	key.namelen = namelen;
+	return (struct delegpt_ns*)rbtree_search(&dp->nstree, &key);
 }
 
 struct delegpt_addr*
 delegpt_find_addr(struct delegpt* dp, struct sockaddr_storage* addr, 
 	socklen_t addrlen)
 {
-	struct delegpt_addr* p = dp->target_list;
-	while(p) {
-		if(sockaddr_cmp_addr(addr, addrlen, &p->addr, p->addrlen)==0
-			&& ((struct sockaddr_in*)addr)->sin_port ==
-			   ((struct sockaddr_in*)&p->addr)->sin_port) {
-			return p;
-		}
-		p = p->next_target;
-	}
-	return NULL;
+	struct delegpt_addr key;
+	if(addrlen > (socklen_t)sizeof(key.addr))
+		return NULL;
+	key.node.key = &key;
+	memmove(&key.addr, addr, addrlen);
+	key.addrlen = addrlen;
+	return (struct delegpt_addr*)rbtree_search(&dp->addrtree, &key);
 }
 
 int 
@@ -206,6 +230,8 @@ delegpt_add_addr(struct delegpt* dp, struct regional* region,
 	dp->usable_list = a;
 	memcpy(&a->addr, addr, addrlen);
 	a->addrlen = addrlen;
+	a->node.key = a;
+	(void)rbtree_insert(&dp->addrtree, &a->node);
 	a->attempts = 0;
 	a->bogus = bogus;
 	a->lame = lame;
@@ -524,6 +550,7 @@ struct delegpt* delegpt_create_mlc(uint8_t* name)
 	if(!dp)
 		return NULL;
 	dp->dp_type_mlc = 1;
+	delegpt_init_trees(dp);
 	if(name) {
 		dp->namelabs = dname_count_size_labels(name, &dp->namelen);
 		dp->name = memdup(name, dp->namelen);
@@ -573,7 +600,7 @@ int delegpt_add_ns_mlc(struct delegpt* dp, uint8_t* name, uint8_t lame)
 	size_t len;
 	(void)dname_count_size_labels(name, &len);
 	log_assert(dp->dp_type_mlc);
-	/* slow check for duplicates to avoid counting failures when
+	/* check for duplicates to avoid counting failures when
 	 * adding the same server as a dependency twice */
 	if(delegpt_find_ns(dp, name, len))
 		return 1;
@@ -588,6 +615,8 @@ int delegpt_add_ns_mlc(struct delegpt* dp, uint8_t* name, uint8_t lame)
 	}
 	ns->next = dp->nslist;
 	dp->nslist = ns;
+	ns->node.key = ns;
+	(void)rbtree_insert(&dp->nstree, &ns->node);
 	ns->resolved = 0;
 	ns->got4 = 0;
 	ns->got6 = 0;
@@ -614,6 +643,15 @@ int delegpt_add_addr_mlc(struct delegpt* dp, struct sockaddr_storage* addr,
 	a = (struct delegpt_addr*)malloc(sizeof(struct delegpt_addr));
 	if(!a)
 		return 0;
+	if(tls_auth_name) {
+		a->tls_auth_name = strdup(tls_auth_name);
+		if(!a->tls_auth_name) {
+			free(a);
+			return 0;
+		}
+	} else {
+		a->tls_auth_name = NULL;
+	}
 	a->next_target = dp->target_list;
 	dp->target_list = a;
 	a->next_result = 0;
@@ -621,19 +659,12 @@ int delegpt_add_addr_mlc(struct delegpt* dp, struct sockaddr_storage* addr,
 	dp->usable_list = a;
 	memcpy(&a->addr, addr, addrlen);
 	a->addrlen = addrlen;
+	a->node.key = a;
+	(void)rbtree_insert(&dp->addrtree, &a->node);
 	a->attempts = 0;
 	a->bogus = bogus;
 	a->lame = lame;
 	a->dnsseclame = 0;
-	if(tls_auth_name) {
-		a->tls_auth_name = strdup(tls_auth_name);
-		if(!a->tls_auth_name) {
-			free(a);
-			return 0;
-		}
-	} else {
-		a->tls_auth_name = NULL;
-	}
 	return 1;
 }
 
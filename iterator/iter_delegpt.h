@@ -43,6 +43,7 @@
 #ifndef ITERATOR_ITER_DELEGPT_H
 #define ITERATOR_ITER_DELEGPT_H
 #include "util/log.h"
+#include "util/rbtree.h"
 struct regional;
 struct delegpt_ns;
 struct delegpt_addr;
@@ -71,6 +72,11 @@ struct delegpt {
 	struct delegpt_addr* usable_list;
 	/** the list of returned targets; subset of target_list */
 	struct delegpt_addr* result_list;
+	/** index of the nslist by name, of struct delegpt_ns */
+	rbtree_type nstree;
+	/** index of the target_list by address and port,
+	 * of struct delegpt_addr */
+	rbtree_type addrtree;
 
 	/** if true, the NS RRset was bogus. All info is bad. */
 	int bogus;
@@ -93,6 +99,8 @@ struct delegpt {
  * Nameservers for a delegation point.
  */
 struct delegpt_ns {
+	/** node in the nstree of the delegation point, key is this */
+	rbnode_type node;
 	/** next in list */
 	struct delegpt_ns* next;
 	/** name of nameserver */
@@ -129,6 +137,8 @@ struct delegpt_ns {
  * Address of target nameserver in delegation point.
  */
 struct delegpt_addr {
+	/** node in the addrtree of the delegation point, key is this */
+	rbnode_type node;
 	/** next delegation point in results */
 	struct delegpt_addr* next_result;
 	/** next delegation point in usable list */
@@ -424,4 +434,10 @@ int delegpt_add_target_mlc(struct delegpt* dp, uint8_t* name, size_t namelen,
 /** get memory in use by dp */
 size_t delegpt_get_mem(struct delegpt* dp);
 
+/** compare delegpt_ns by name, for the nstree */
+int delegpt_ns_cmp(const void* k1, const void* k2);
+
+/** compare delegpt_addr by address and port, for the addrtree */
+int delegpt_addr_cmp(const void* k1, const void* k2);
+
 #endif /* ITERATOR_ITER_DELEGPT_H */
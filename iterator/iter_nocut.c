@@ -0,0 +1,205 @@
+/*
+ * iterator/iter_nocut.c - cache of names that are not zone cuts
+ *
+ *
+ * Copyright (c) 2026, NLnet Labs. All rights reserved.
+ *
+ * This software is open source.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 
+ * Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ * 
+ * Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ * 
+ * Neither the name of the NLNET LABS nor the names of its contributors may
+ * be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ * TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+/**
+ * \file
+ *
+ * This file contains the cache of names that are known not to be zone
+ * cuts, for qname minimisation.
+ */
+#include "config.h"
+#include "iterator/iter_nocut.h"
+#include "util/log.h"
+#include "util/config_file.h"
+#include "util/net_help.h"
+#include "util/data/dname.h"
+
+struct iter_nocut*
+iter_nocut_create(struct config_file* cfg)
+{
+	struct iter_nocut* nc;
+	if(!cfg->qname_minimisation)
+		return NULL;
+	nc = (struct iter_nocut*)calloc(1, sizeof(*nc));
+	if(!nc) {
+		log_err("malloc failure");
+		return NULL;
+	}
+	nc->slab = slabhash_create(cfg->msg_cache_slabs,
+		HASH_DEFAULT_STARTARRAY, cfg->msg_cache_size/8,
+		&nocut_sizefunc, &nocut_compfunc,
+		&nocut_delkeyfunc, &nocut_deldatafunc, NULL);
+	if(!nc->slab) {
+		log_err("malloc failure");
+		free(nc);
+		return NULL;
+	}
+	lock_basic_init(&nc->lock);
+	lock_protect(&nc->lock, &nc->num_skipped, sizeof(nc->num_skipped));
+	return nc;
+}
+
+void
+iter_nocut_delete(struct iter_nocut* nc)
+{
+	if(!nc)
+		return;
+	lock_basic_destroy(&nc->lock);
+	slabhash_delete(nc->slab);
+	free(nc);
+}
+
+/** setup key for lookup */
+static void
+nocut_setup_key(struct nocut_key* k, uint8_t* name, size_t namelen,
+	uint16_t dclass, uint8_t* dpname)
+{
+	memset(k, 0, sizeof(*k));
+	k->entry.key = k;
+	k->name = name;
+	k->namelen = namelen;
+	k->dclass = dclass;
+	k->dplabs = dname_count_labels(dpname);
+	k->entry.hash = dname_query_hash(name, (hashvalue_type)(dclass +
+		(k->dplabs<<16)));
+}
+
+void
+iter_nocut_insert(struct iter_nocut* nc, uint8_t* name, size_t namelen,
+	uint16_t dclass, uint8_t* dpname, time_t ttl, time_t now)
+{
+	struct nocut_key* k = (struct nocut_key*)malloc(sizeof(*k));
+	struct nocut_data* d;
+	if(!k)
+		return;
+	nocut_setup_key(k, name, namelen, dclass, dpname);
+	k->name = memdup(name, namelen);
+	if(!k->name) {
+		free(k);
+		return;
+	}
+	d = (struct nocut_data*)malloc(sizeof(*d));
+	if(!d) {
+		free(k->name);
+		free(k);
+		return;
+	}
+	d->ttl = now + ttl;
+	lock_rw_init(&k->entry.lock);
+	k->entry.data = d;
+	slabhash_insert(nc->slab, k->entry.hash, &k->entry, d, NULL);
+}
+
+int
+iter_nocut_lookup(struct iter_nocut* nc, uint8_t* name, size_t namelen,
+	uint16_t dclass, uint8_t* dpname, time_t now)
+{
+	int found = 0;
+	struct nocut_key k;
+	struct lruhash_entry* e;
+	nocut_setup_key(&k, name, namelen, dclass, dpname);
+	e = slabhash_lookup(nc->slab, k.entry.hash, &k, 0);
+	if(!e)
+		return 0;
+	found = (((struct nocut_data*)e->data)->ttl > now);
+	lock_rw_unlock(&e->lock);
+	if(found) {
+		lock_basic_lock(&nc->lock);
+		nc->num_skipped++;
+		lock_basic_unlock(&nc->lock);
+	}
+	return found;
+}
+
+size_t
+iter_nocut_get_skipped(struct iter_nocut* nc, int reset)
+{
+	size_t r;
+	if(!nc)
+		return 0;
+	lock_basic_lock(&nc->lock);
+	r = nc->num_skipped;
+	if(reset)
+		nc->num_skipped = 0;
+	lock_basic_unlock(&nc->lock);
+	return r;
+}
+
+size_t
+iter_nocut_get_mem(struct iter_nocut* nc)
+{
+	if(!nc)
+		return 0;
+	return sizeof(*nc) + slabhash_get_mem(nc->slab);
+}
+
+size_t
+nocut_sizefunc(void* key, void* ATTR_UNUSED(data))
+{
+	struct nocut_key* k = (struct nocut_key*)key;
+	return sizeof(*k) + k->namelen + sizeof(struct nocut_data)
+		+ lock_get_mem(&k->entry.lock);
+}
+
+int
+nocut_compfunc(void* key1, void* key2)
+{
+	struct nocut_key* k1 = (struct nocut_key*)key1;
+	struct nocut_key* k2 = (struct nocut_key*)key2;
+	if(k1->dclass != k2->dclass)
+		return k1->dclass < k2->dclass ? -1 : 1;
+	if(k1->dplabs != k2->dplabs)
+		return k1->dplabs < k2->dplabs ? -1 : 1;
+	if(k1->namelen != k2->namelen)
+		return k1->namelen < k2->namelen ? -1 : 1;
+	return query_dname_compare(k1->name, k2->name);
+}
+
+void
+nocut_delkeyfunc(void* key, void* ATTR_UNUSED(arg))
+{
+	struct nocut_key* k = (struct nocut_key*)key;
+	lock_rw_destroy(&k->entry.lock);
+	free(k->name);
+	free(k);
+}
+
+void
+nocut_deldatafunc(void* data, void* ATTR_UNUSED(arg))
+{
+	free(data);
+}
@@ -0,0 +1,160 @@
+/*
+ * iterator/iter_nocut.h - cache of names that are not zone cuts
+ *
+ *
+ * Copyright (c) 2026, NLnet Labs. All rights reserved.
+ *
+ * This software is open source.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 
+ * Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ * 
+ * Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ * 
+ * Neither the name of the NLNET LABS nor the names of its contributors may
+ * be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ * TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+/**
+ * \file
+ *
+ * This file contains the cache of names that are known not to be zone
+ * cuts.  With qname minimisation every label of the name is probed, and
+ * a NOERROR answer without data from the servers of the delegation point
+ * shows that the probed name is not a zone cut.  Later resolutions below the same
+ * delegation point skip those probes.
+ */
+
+#ifndef ITERATOR_ITER_NOCUT_H
+#define ITERATOR_ITER_NOCUT_H
+#include "util/storage/slabhash.h"
+#include "util/locks.h"
+struct config_file;
+
+/**
+ * The no zone cut cache.
+ */
+struct iter_nocut {
+	/** uses slabhash for storage, type nocut_key, nocut_data */
+	struct slabhash* slab;
+	/** lock on the statistics counter */
+	lock_basic_type lock;
+	/** number of minimised queries that were not sent */
+	size_t num_skipped;
+};
+
+/**
+ * Key of a no zone cut entry.  The name is below the delegation point,
+ * that is identified by its number of labels.
+ */
+struct nocut_key {
+	/** lru hash entry, data is struct nocut_data */
+	struct lruhash_entry entry;
+	/** the name that is not a zone cut, uncompressed wireformat */
+	uint8_t* name;
+	/** length of name */
+	size_t namelen;
+	/** number of labels of the delegation point, it is a suffix of name */
+	int dplabs;
+	/** class (host order) */
+	uint16_t dclass;
+};
+
+/**
+ * Data of a no zone cut entry.
+ */
+struct nocut_data {
+	/** absolute time when the entry expires */
+	time_t ttl;
+};
+
+/**
+ * Create the no zone cut cache.  It is sized at an eighth of the
+ * msg-cache-size.
+ * @param cfg: config settings.
+ * @return new cache, or NULL if qname minimisation is off or on malloc
+ *	failure (logged).
+ */
+struct iter_nocut* iter_nocut_create(struct config_file* cfg);
+
+/**
+ * Delete the no zone cut cache.
+ * @param nc: to delete.
+ */
+void iter_nocut_delete(struct iter_nocut* nc);
+
+/**
+ * Store that a name is not a zone cut.  Silently fails on malloc failure.
+ * @param nc: the no zone cut cache.
+ * @param name: the name, below dpname.
+ * @param namelen: length of name.
+ * @param dclass: class (host order).
+ * @param dpname: the delegation point that answered for the name.
+ * @param ttl: TTL of the answer, relative.
+ * @param now: current time.
+ */
+void iter_nocut_insert(struct iter_nocut* nc, uint8_t* name, size_t namelen,
+	uint16_t dclass, uint8_t* dpname, time_t ttl, time_t now);
+
+/**
+ * Lookup if a name is known not to be a zone cut below the delegation
+ * point.  Counts a skipped query when it is.
+ * @param nc: the no zone cut cache.
+ * @param name: the name, below dpname.
+ * @param namelen: length of name.
+ * @param dclass: class (host order).
+ * @param dpname: the current delegation point.
+ * @param now: current time.
+ * @return true if the name is not a zone cut.
+ */
+int iter_nocut_lookup(struct iter_nocut* nc, uint8_t* name, size_t namelen,
+	uint16_t dclass, uint8_t* dpname, time_t now);
+
+/**
+ * Get the skipped query counter, and reset it if asked.
+ * @param nc: the no zone cut cache, may be NULL.
+ * @param reset: if true, the counter is zeroed.
+ * @return number of minimised queries that were not sent.
+ */
+size_t iter_nocut_get_skipped(struct iter_nocut* nc, int reset);
+
+/**
+ * Get memory in use by the no zone cut cache.
+ * @param nc: the no zone cut cache, may be NULL.
+ * @return memory in use in bytes.
+ */
+size_t iter_nocut_get_mem(struct iter_nocut* nc);
+
+/** size function for the no zone cut cache, for lruhash */
+size_t nocut_sizefunc(void* key, void* data);
+
+/** compare function for the no zone cut cache, for lruhash */
+int nocut_compfunc(void* key1, void* key2);
+
+/** delete key function for the no zone cut cache, for lruhash */
+void nocut_delkeyfunc(void* key, void* arg);
+
+/** delete data function for the no zone cut cache, for lruhash */
+void nocut_deldatafunc(void* data, void* arg);
+
+#endif /* ITERATOR_ITER_NOCUT_H */
@@ -50,6 +50,7 @@
 #include "services/cache/infra.h"
 #include "services/cache/dns.h"
 #include "services/cache/rrset.h"
+#include "services/mesh.h"
 #include "util/net_help.h"
 #include "util/module.h"
 #include "util/log.h"
@@ -175,6 +176,9 @@ iter_apply_cfg(struct iter_env* iter_env, struct config_file* cfg)
 	}
 	iter_env->supports_ipv6 = cfg->do_ip6;
 	iter_env->supports_ipv4 = cfg->do_ip4;
+	iter_env->target_fetch_parallel = cfg->target_fetch_parallel;
+	iter_env->hedge_percentile = cfg->hedge_percentile;
+	iter_env->hedge_budget = cfg->hedge_budget;
 	return 1;
 }
 
@@ -561,6 +565,56 @@ iter_server_selection(struct iter_env* iter_env,
 	return a;
 }
 
+struct delegpt_addr*
+iter_server_hedge_selection(struct iter_env* iter_env,
+	struct module_env* env, struct delegpt* dp, uint8_t* name,
+	size_t namelen, uint16_t qtype, struct sock_list* blacklist,
+	struct delegpt_addr* busy)
+{
+	int low_rtt = 0;
+	size_t num;
+	struct delegpt_addr* a, *best = NULL;
+	if(!iter_fill_rtt(iter_env, env, name, namelen, qtype, *env->now, dp,
+		&low_rtt, blacklist, &num))
+		return NULL;
+	for(a = dp->result_list; a; a = a->next_result) {
+		if(a == busy || a->sel_rtt == -1 ||
+			a->sel_rtt >= USEFUL_SERVER_TOP_TIMEOUT ||
+			a->attempts >= OUTBOUND_MSG_RETRY)
+			continue;
+		if(busy && sockaddr_cmp(&a->addr, a->addrlen, &busy->addr,
+			busy->addrlen) == 0)
+			continue;
+		if(!best || a->sel_rtt < best->sel_rtt)
+			best = a;
+	}
+	if(best)
+		best->attempts++;
+	return best;
+}
+
+void
+iter_hedge_budget_add(struct iter_env* iter_env, struct module_env* env)
+{
+	struct mesh_area* mesh = env->mesh;
+	mesh->hedge_tokens += iter_env->hedge_budget;
+	if(mesh->hedge_tokens > HEDGE_TOKENS_MAX)
+		mesh->hedge_tokens = HEDGE_TOKENS_MAX;
+}
+
+int
+iter_hedge_budget_take(struct module_env* env)
+{
+	struct mesh_area* mesh = env->mesh;
+	if(mesh->hedge_tokens < 100) {
+		mesh->num_hedges_denied++;
+		return 0;
+	}
+	mesh->hedge_tokens -= 100;
+	mesh->num_queries_hedged++;
+	return 1;
+}
+
 struct dns_msg* 
 dns_alloc_msg(sldns_buffer* pkt, struct msg_parse* msg, 
 	struct regional* region)
@@ -100,6 +100,41 @@ struct delegpt_addr* iter_server_selection(struct iter_env* iter_env,
 	int* chase_to_rd, int open_target, struct sock_list* blacklist,
 	time_t prefetch);
 
+/**
+ * Select the target to send a hedged query to, while the query to
+ * another target is outstanding.  This is the fastest other target in
+ * the result list, lame, blacklisted and timed out servers are not used.
+ *
+ * @param iter_env: iterator module global state.
+ * @param env: environment with infra cache (lameness, rtt info).
+ * @param dp: delegation point with result list.
+ * @param name: zone name (for lameness check).
+ * @param namelen: length of name.
+ * @param qtype: query type that we want to send.
+ * @param blacklist: the IP blacklist to use.
+ * @param busy: the target with the outstanding query.
+ * @return target or NULL if there is no other good target.
+ */
+struct delegpt_addr* iter_server_hedge_selection(struct iter_env* iter_env,
+	struct module_env* env, struct delegpt* dp, uint8_t* name,
+	size_t namelen, uint16_t qtype, struct sock_list* blacklist,
+	struct delegpt_addr* busy);
+
+/**
+ * Add the share of an outgoing query to the hedge budget of the thread.
+ * @param iter_env: iterator module global state, with the hedge-budget.
+ * @param env: module environment, the budget is in its mesh.
+ */
+void iter_hedge_budget_add(struct iter_env* iter_env,
+	struct module_env* env);
+
+/**
+ * Take a hedged query from the hedge budget of the thread.
+ * @param env: module environment, the budget is in its mesh.
+ * @return false if the budget is used up, the hedge is not sent.
+ */
+int iter_hedge_budget_take(struct module_env* env);
+
 /**
  * Allocate dns_msg from parsed msg, in regional.
  * @param pkt: packet.
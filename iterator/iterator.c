@@ -50,10 +50,12 @@
 #include "iterator/iter_resptype.h"
 #include "iterator/iter_scrub.h"
 #include "iterator/iter_priv.h"
+#include "iterator/iter_nocut.h"
 #include "validator/val_neg.h"
 #include "services/cache/dns.h"
 #include "services/cache/infra.h"
 #include "services/authzone.h"
+#include "services/mesh.h"
 #include "util/module.h"
 #include "util/netevent.h"
 #include "util/net_help.h"
@@ -92,6 +94,7 @@ iter_init(struct module_env* env, int id)
 		log_err("iterator: could not apply configuration settings.");
 		return 0;
 	}
+	iter_env->nocut = iter_nocut_create(env->cfg);
 
 	return 1;
 }
@@ -117,6 +120,7 @@ iter_deinit(struct module_env* env, int id)
 	free(iter_env->target_fetch_policy);
 	priv_delete(iter_env->priv);
 	donotq_delete(iter_env->donotq);
+	iter_nocut_delete(iter_env->nocut);
 	if(iter_env->caps_white) {
 		traverse_postorder(iter_env->caps_white, caps_free, NULL);
 		free(iter_env->caps_white);
@@ -939,8 +943,7 @@ auth_zone_delegpt(struct module_qstate* qstate, struct iter_qstate* iq,
 				lock_rw_unlock(&z->lock);
 				return 1;
 			}
-			dp = (struct delegpt*)regional_alloc_zero(
-				qstate->region, sizeof(*dp));
+			dp = delegpt_create(qstate->region);
 			if(!dp) {
 				log_err("alloc failure");
 				if(z->fallback_enabled) {
@@ -1271,8 +1274,11 @@ processInitRequest(struct module_qstate* qstate, struct iter_qstate* iq,
 				qstate->region, qstate->env->rrset_cache,
 				qstate->env->scratch_buffer, 
 				*qstate->env->now, 1/*add SOA*/, NULL, 
-				qstate->env->cfg);
+				qstate->env->cfg, qstate->env->mesh);
 		}
+		if(qstate->mesh_info->trace)
+			mesh_trace_event(qstate, mesh_trace_cache,
+				msg != NULL);
 		/* item taken from cache does not match our query name, thus
 		 * security needs to be re-examined later */
 		if(msg && query_dname_compare(qstate->qinfo.qname,
@@ -1848,6 +1854,31 @@ query_for_targets(struct module_qstate* qstate, struct iter_qstate* iq,
 	return 1;
 }
 
+/**
+ * Get the number of missing targets to fetch at the same time, when
+ * there is no usable target.  The A and AAAA lookups for them run in
+ * parallel, and the first usable address lets the query continue.  The
+ * number is kept within the budget of MAX_TARGET_COUNT target queries.
+ * @param iq: iterator query state.
+ * @param ie: iterator shared global environment.
+ * @return number of targets to fetch, at least 1.
+ */
+static int
+target_fetch_fanout(struct iter_qstate* iq, struct iter_env* ie)
+{
+	int fanout = ie->target_fetch_parallel;
+	int per_target = (ie->supports_ipv4?1:0) + (ie->supports_ipv6?1:0);
+	if(fanout > 1 && iq->target_count && per_target > 0) {
+		int room = (MAX_TARGET_COUNT - iq->target_count[1]) /
+			per_target;
+		if(fanout > room)
+			fanout = room;
+	}
+	if(fanout < 1)
+		fanout = 1;
+	return fanout;
+}
+
 /**
  * Called by processQueryTargets when it would like extra targets to query
  * but it seems to be out of options.  At last resort some less appealing
@@ -2081,6 +2112,123 @@ processDSNSFind(struct module_qstate* qstate, struct iter_qstate* iq, int id)
 	return 0;
 }
 	
+/** send the query to the target, returns outbound entry or NULL */
+static struct outbound_entry*
+send_target_query(struct module_qstate* qstate, struct iter_qstate* iq,
+	struct iter_env* ie, struct delegpt_addr* target)
+{
+	fptr_ok(fptr_whitelist_modenv_send_query(qstate->env->send_query));
+	return (*qstate->env->send_query)(&iq->qinfo_out,
+		iq->chase_flags | (iq->chase_to_rd?BIT_RD:0), 
+		/* unset CD if to forwarder(RD set) and not dnssec retry
+		 * (blacklist nonempty) and no trust-anchors are configured
+		 * above the qname or on the first attempt when dnssec is on */
+		EDNS_DO| ((iq->chase_to_rd||(iq->chase_flags&BIT_RD)!=0)&&
+		!qstate->blacklist&&(!iter_qname_indicates_dnssec(qstate->env,
+		&iq->qinfo_out)||target->attempts==1)?0:BIT_CD), 
+		iq->dnssec_expected, iq->caps_fallback || is_caps_whitelisted(
+		ie, iq), &target->addr, target->addrlen,
+		iq->dp->name, iq->dp->namelen,
+		(iq->dp->ssl_upstream || qstate->env->cfg->ssl_upstream),
+		target->tls_auth_name, qstate);
+}
+
+/**
+ * Start the hedge timer for the query that was sent to the target.  It
+ * fires at the tracked rtt percentile of the target.
+ * @param qstate: query state.
+ * @param iq: iterator query state.
+ * @param ie: iterator shared global environment.
+ * @param target: the target the query was sent to.
+ */
+static void
+hedge_arm(struct module_qstate* qstate, struct iter_qstate* iq,
+	struct iter_env* ie, struct delegpt_addr* target)
+{
+	struct timeval tv;
+	int rtt;
+	iq->hedge_target = target;
+	iq->hedge_due = 0;
+	iter_hedge_budget_add(ie, qstate->env);
+	/* a second query confuses the serial 0x20 fallback */
+	if(iq->caps_fallback || iq->num_current_queries != 1)
+		return;
+	rtt = infra_get_hedge_rtt(qstate->env->infra_cache, &target->addr,
+		target->addrlen, iq->dp->name, iq->dp->namelen,
+		*qstate->env->now);
+	if(rtt <= 0)
+		return;
+	if(!iq->hedge_timer) {
+		iq->hedge_timer = comm_timer_create(qstate->env->worker_base,
+			iter_hedge_timer_cb, qstate);
+		if(!iq->hedge_timer) {
+			log_err("iterator: out of memory for hedge timer");
+			return;
+		}
+	}
+	tv.tv_sec = rtt/1000;
+	tv.tv_usec = (rtt%1000)*1000;
+	comm_timer_set(iq->hedge_timer, &tv);
+}
+
+/**
+ * Send the outstanding query to a second server, if the hedge budget
+ * allows it.  The first reply that comes in is used, the answer
+ * processing cancels the other query.
+ * @param qstate: query state.
+ * @param iq: iterator query state.
+ * @param ie: iterator shared global environment.
+ */
+static void
+hedge_send(struct module_qstate* qstate, struct iter_qstate* iq,
+	struct iter_env* ie)
+{
+	struct delegpt_addr* target;
+	struct outbound_entry* outq;
+	iq->hedge_due = 0;
+	target = iter_server_hedge_selection(ie, qstate->env, iq->dp,
+		iq->dp->name, iq->dp->namelen, iq->qchase.qtype,
+		qstate->blacklist, iq->hedge_target);
+	if(!target) {
+		verbose(VERB_ALGO, "hedge: no other target");
+		return;
+	}
+	if(!iter_hedge_budget_take(qstate->env)) {
+		verbose(VERB_ALGO, "hedge: over the hedge budget");
+		return;
+	}
+	if(verbosity >= VERB_QUERY)
+		log_name_addr(VERB_QUERY, "hedge query to target:",
+			iq->dp->name, &target->addr, target->addrlen);
+	outq = send_target_query(qstate, iq, ie, target);
+	if(!outq) {
+		log_addr(VERB_DETAIL, "error sending hedge query to auth "
+			"server", &target->addr, target->addrlen);
+		return;
+	}
+	outbound_list_insert(&iq->outlist, outq);
+	iq->num_current_queries++;
+	iq->sent_count++;
+}
+
+void
+iter_hedge_timer_cb(void* arg)
+{
+	struct module_qstate* qstate = (struct module_qstate*)arg;
+	struct iter_qstate* iq;
+	int id = qstate->curmod;
+	if(qstate->ext_state[id] != module_wait_reply)
+		return;
+	iq = (struct iter_qstate*)qstate->minfo[id];
+	if(!iq || iq->state != QUERYTARGETS_STATE ||
+		iq->num_current_queries != 1)
+		return;
+	verbose(VERB_ALGO, "hedge timer: no reply within the hedge time");
+	iq->hedge_due = 1;
+	mesh_run(qstate->env->mesh, qstate->mesh_info, module_event_pass,
+		NULL);
+}
+
 /** 
  * This is the request event state where the request will be sent to one of
  * its current query targets. This state also handles issuing target lookup
@@ -2144,6 +2292,10 @@ processQueryTargets(struct module_qstate* qstate, struct iter_qstate* iq,
 	delegpt_log(VERB_ALGO, iq->dp);
 
 	if(iq->num_current_queries>0) {
+		/* the outstanding query is slow, hedge it to another
+		 * server */
+		if(iq->hedge_due)
+			hedge_send(qstate, iq, ie);
 		/* already busy answering a query, this restart is because
 		 * more delegpt addrs became available, wait for existing
 		 * query. */
@@ -2220,6 +2372,20 @@ processQueryTargets(struct module_qstate* qstate, struct iter_qstate* iq,
 				&iq->qinfo_out.qname_len, 
 				labdiff-1);
 		}
+		/* skip the names that earlier queries showed are not zone
+		 * cuts below this delegation point */
+		while(labdiff > 1 && ie->nocut && !qstate->no_cache_lookup &&
+			iter_nocut_lookup(ie->nocut, iq->qinfo_out.qname,
+			iq->qinfo_out.qname_len, iq->qinfo_out.qclass,
+			iq->dp->name, *qstate->env->now)) {
+			labdiff--;
+			verbose(VERB_ALGO, "no zone cut, removing %d labels",
+				labdiff-1);
+			iq->qinfo_out.qname = iq->qchase.qname;
+			iq->qinfo_out.qname_len = iq->qchase.qname_len;
+			dname_remove_labels(&iq->qinfo_out.qname,
+				&iq->qinfo_out.qname_len, labdiff-1);
+		}
 		if(labdiff < 1 || (labdiff < 2 
 			&& (iq->qchase.qtype == LDNS_RR_TYPE_DS
 			|| iq->qchase.qtype == LDNS_RR_TYPE_A)))
@@ -2398,10 +2564,12 @@ processQueryTargets(struct module_qstate* qstate, struct iter_qstate* iq,
 			 * query, or failing. */
 			if(delegpt_count_missing_targets(iq->dp) > 0) {
 				int qs = 0;
+				int fanout = target_fetch_fanout(iq, ie);
 				verbose(VERB_ALGO, "querying for next "
-					"missing target");
+					"%d missing target%s", fanout,
+					fanout==1?"":"s");
 				if(!query_for_targets(qstate, iq, ie, id, 
-					1, &qs)) {
+					fanout, &qs)) {
 					errinf(qstate, "could not fetch nameserver");
 					errinf_dname(qstate, "at zone", iq->dp->name);
 					return error_response(qstate, id,
@@ -2490,20 +2658,7 @@ processQueryTargets(struct module_qstate* qstate, struct iter_qstate* iq,
 			iq->dnssec_expected?"expected": "not expected",
 			iq->dnssec_lame_query?" but lame_query anyway": "");
 	}
-	fptr_ok(fptr_whitelist_modenv_send_query(qstate->env->send_query));
-	outq = (*qstate->env->send_query)(&iq->qinfo_out,
-		iq->chase_flags | (iq->chase_to_rd?BIT_RD:0), 
-		/* unset CD if to forwarder(RD set) and not dnssec retry
-		 * (blacklist nonempty) and no trust-anchors are configured
-		 * above the qname or on the first attempt when dnssec is on */
-		EDNS_DO| ((iq->chase_to_rd||(iq->chase_flags&BIT_RD)!=0)&&
-		!qstate->blacklist&&(!iter_qname_indicates_dnssec(qstate->env,
-		&iq->qinfo_out)||target->attempts==1)?0:BIT_CD), 
-		iq->dnssec_expected, iq->caps_fallback || is_caps_whitelisted(
-		ie, iq), &target->addr, target->addrlen,
-		iq->dp->name, iq->dp->namelen,
-		(iq->dp->ssl_upstream || qstate->env->cfg->ssl_upstream),
-		target->tls_auth_name, qstate);
+	outq = send_target_query(qstate, iq, ie, target);
 	if(!outq) {
 		log_addr(VERB_DETAIL, "error sending query to auth server", 
 			&target->addr, target->addrlen);
@@ -2518,6 +2673,8 @@ processQueryTargets(struct module_qstate* qstate, struct iter_qstate* iq,
 	iq->num_current_queries++;
 	iq->sent_count++;
 	qstate->ext_state[id] = module_wait_reply;
+	if(ie->hedge_percentile > 0)
+		hedge_arm(qstate, iq, ie, target);
 
 	return 0;
 }
@@ -2535,6 +2692,44 @@ find_NS(struct reply_info* rep, size_t from, size_t to)
 }
 
 
+/**
+ * Store that the name of a minimised query is not a zone cut, the servers
+ * of the delegation point answered it with NOERROR and no data. An answer
+ * with data can come from a child zone that the servers also host, and
+ * the SOA in the authority section of a nodata answer is of the zone of
+ * the name, if that is the name itself it is the apex of a zone.
+ * @param qstate: query state.
+ * @param iq: iterator query state, with the response.
+ * @param id: module id.
+ */
+static void
+iter_store_nocut(struct module_qstate* qstate, struct iter_qstate* iq,
+	int id)
+{
+	struct iter_env* ie = (struct iter_env*)qstate->env->modinfo[id];
+	struct reply_info* rep = iq->response->rep;
+	size_t i;
+	if(!ie->nocut || qstate->no_cache_store || !iq->dp ||
+		(iq->chase_flags & BIT_RD))
+		return;
+	if(FLAGS_GET_RCODE(rep->flags) != LDNS_RCODE_NOERROR ||
+		rep->an_numrrsets != 0)
+		return;
+	if(!dname_strict_subdomain_c(iq->response->qinfo.qname, iq->dp->name))
+		return;
+	/* the SOA of the zone of the name, it also gives the TTL */
+	for(i=0; i<rep->ns_numrrsets; i++) {
+		if(ntohs(rep->rrsets[i]->rk.type) == LDNS_RR_TYPE_SOA)
+			break;
+	}
+	if(i == rep->ns_numrrsets || query_dname_compare(
+		rep->rrsets[i]->rk.dname, iq->response->qinfo.qname) == 0)
+		return;
+	iter_nocut_insert(ie->nocut, iq->response->qinfo.qname,
+		iq->response->qinfo.qname_len, iq->response->qinfo.qclass,
+		iq->dp->name, rep->ttl, *qstate->env->now);
+}
+
 /** 
  * Process the query response. All queries end up at this state first. This
  * process generally consists of analyzing the response and routing the
@@ -2683,6 +2878,8 @@ processQueryResponse(struct module_qstate* qstate, struct iter_qstate* iq,
 				iq->response->rep, 0, qstate->prefetch_leeway,
 				iq->dp&&iq->dp->has_parent_side_NS,
 				qstate->region, qstate->query_flags);
+		if(iq->minimisation_state == MINIMISE_STATE)
+			iter_store_nocut(qstate, iq, id);
 		/* close down outstanding requests to be discarded */
 		outbound_list_clear(&iq->outlist);
 		iq->num_current_queries = 0;
@@ -3565,6 +3762,9 @@ process_response(struct module_qstate* qstate, struct iter_qstate* iq,
 	sldns_buffer* pkt;
 
 	verbose(VERB_ALGO, "process_response: new external response event");
+	if(iq->hedge_timer)
+		comm_timer_disable(iq->hedge_timer);
+	iq->hedge_due = 0;
 	iq->response = NULL;
 	iq->state = QUERY_RESP_STATE;
 	if(event == module_event_noreply || event == module_event_error) {
@@ -3798,6 +3998,8 @@ iter_clear(struct module_qstate* qstate, int id)
 		if(iq->target_count && --iq->target_count[0] == 0)
 			free(iq->target_count);
 		iq->num_current_queries = 0;
+		comm_timer_delete(iq->hedge_timer);
+		iq->hedge_timer = NULL;
 	}
 	qstate->minfo[id] = NULL;
 }
@@ -3809,7 +4011,8 @@ iter_get_mem(struct module_env* env, int id)
 	if(!ie)
 		return 0;
 	return sizeof(*ie) + sizeof(int)*((size_t)ie->max_dependency_depth+1)
-		+ donotq_get_mem(ie->donotq) + priv_get_mem(ie->priv);
+		+ donotq_get_mem(ie->donotq) + priv_get_mem(ie->priv)
+		+ iter_nocut_get_mem(ie->nocut);
 }
 
 /**
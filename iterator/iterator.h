@@ -48,10 +48,12 @@
 struct delegpt;
 struct iter_hints;
 struct iter_forwards;
+struct iter_nocut;
 struct iter_donotq;
 struct iter_prep_list;
 struct iter_priv;
 struct rbtree_type;
+struct comm_timer;
 
 /** max number of targets spawned for a query and its subqueries */
 #define MAX_TARGET_COUNT	64
@@ -97,6 +99,8 @@ extern int UNKNOWN_SERVER_NICENESS;
 #define RTT_BAND 400
 /** Start value for blacklisting a host, 2*USEFUL_SERVER_TOP_TIMEOUT in sec */
 #define INFRA_BACKOFF_INITIAL 240
+/** most hedged queries that the hedge budget saves up, in hundredths */
+#define HEDGE_TOKENS_MAX 10000
 
 /**
  * Global state for the iterator. 
@@ -130,10 +134,25 @@ struct iter_env {
 	 */
 	int* target_fetch_policy;
 
+	/** number of missing targets that are fetched at the same time
+	 * when there is no usable target */
+	int target_fetch_parallel;
+
 	/** lock on ratelimit counter */
 	lock_basic_type queries_ratelimit_lock;
 	/** number of queries that have been ratelimited */
 	size_t num_queries_ratelimited;
+
+	/** percentile of the server rtt after which the query is hedged,
+	 * 0 if hedging is off */
+	int hedge_percentile;
+	/** hedged queries allowed, in percent of the outgoing queries.
+	 * The budget itself is kept per thread, in the mesh */
+	int hedge_budget;
+
+	/** names known not to be zone cuts, for qname minimisation, or
+	 * NULL if minimisation is off */
+	struct iter_nocut* nocut;
 };
 
 /**
@@ -395,6 +414,14 @@ struct iter_qstate {
 	int auth_zone_response;
 	/** True if the auth_zones should not be consulted for the query */
 	int auth_zone_avoid;
+
+	/** timer that hedges the outstanding query to another server,
+	 * NULL if not created yet */
+	struct comm_timer* hedge_timer;
+	/** the target that the outstanding query was sent to */
+	struct delegpt_addr* hedge_target;
+	/** True if the hedge timer fired for the outstanding query */
+	int hedge_due;
 };
 
 /**
@@ -456,4 +483,11 @@ void iter_clear(struct module_qstate* qstate, int id);
 /** iterator alloc size routine */
 size_t iter_get_mem(struct module_env* env, int id);
 
+/**
+ * Timer callback for a query that has not been answered within the
+ * hedge time of the server, wakes up the query to hedge it.
+ * @param arg: the module_qstate.
+ */
+void iter_hedge_timer_cb(void* arg);
+
 #endif /* ITERATOR_ITERATOR_H */
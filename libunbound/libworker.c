@@ -846,7 +846,7 @@ handle_newq(struct libworker* w, uint8_t* buf, uint32_t len)
 void libworker_alloc_cleanup(void* arg)
 {
 	struct libworker* w = (struct libworker*)arg;
-	slabhash_clear(&w->env->rrset_cache->table);
+	rrset_cache_clear(w->env->rrset_cache);
         slabhash_clear(w->env->msg_cache);
 }
 
@@ -869,6 +869,8 @@ struct outbound_entry* libworker_send_query(struct query_info* qinfo,
 	if(!e->qsent) {
 		return NULL;
 	}
+	if(q->mesh_info->trace)
+		mesh_trace_event(q, mesh_trace_send, 0);
 	return e;
 }
 
@@ -935,6 +937,13 @@ void worker_handle_control_cmd(struct tube* ATTR_UNUSED(tube),
 	log_assert(0);
 }
 
+void worker_handle_handoff(struct tube* ATTR_UNUSED(tube),
+	uint8_t* ATTR_UNUSED(buffer), size_t ATTR_UNUSED(len),
+	int ATTR_UNUSED(error), void* ATTR_UNUSED(arg))
+{
+	log_assert(0);
+}
+
 int worker_handle_request(struct comm_point* ATTR_UNUSED(c), 
 	void* ATTR_UNUSED(arg), int ATTR_UNUSED(error),
         struct comm_reply* ATTR_UNUSED(repinfo))
@@ -1008,6 +1017,11 @@ void worker_probe_timer_cb(void* ATTR_UNUSED(arg))
 	log_assert(0);
 }
 
+void worker_refresh_timer_cb(void* ATTR_UNUSED(arg))
+{
+	log_assert(0);
+}
+
 void worker_start_accept(void* ATTR_UNUSED(arg))
 {
 	log_assert(0);
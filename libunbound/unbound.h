@@ -654,6 +654,14 @@ struct ub_shm_stat_info {
 #define UB_STATS_OPCODE_NUM 16
 /** number of histogram buckets */
 #define UB_STATS_BUCKET_NUM 40
+/** number of mesh scheduling classes (client, prefetch, internal) */
+#define UB_STATS_MESH_CLASS_NUM 3
+/** number of DNSKEY algorithms in the signature check stats */
+#define UB_STATS_ALGO_NUM 32
+/** number of modules in the query trace stats */
+#define UB_STATS_TRACE_MODULE_NUM 16
+/** number of buckets in the per module histogram, log2 of msec */
+#define UB_STATS_TRACE_BUCKET_NUM 16
 
 /** per worker statistics. */
 struct ub_server_stats {
@@ -665,6 +673,14 @@ struct ub_server_stats {
 	long long num_queries_missed_cache;
 	/** number of prefetch queries - cachehits with prefetch */
 	long long num_queries_prefetch;
+	/** number of refreshes of popular cache entries */
+	long long num_refresh;
+	/** number of refreshes that were used, hit after the time the
+	 * entry would have expired */
+	long long num_refresh_useful;
+	/** number of upstream queries sent for refreshes of popular entries,
+	 * with their subqueries */
+	long long num_refresh_upstream;
 
 	/**
 	 * Sum of the querylistsize of the worker for 
@@ -725,8 +741,17 @@ struct ub_server_stats {
 	long long ans_bogus;
 	/** rrsets marked bogus by validator */
 	long long rrset_bogus;
+	/** secure rrsets fetched again unchanged, that were not validated
+	 * again */
+	long long rrset_unchanged;
 	/** number of queries that have been ratelimited by domain recursion. */
 	long long queries_ratelimited;
+	/** number of queries hedged to a second server */
+	long long queries_hedged;
+	/** number of hedged queries not sent because of the hedge budget */
+	long long queries_hedge_denied;
+	/** number of minimised queries not sent, the name is not a zone cut */
+	long long queries_minimise_skipped;
 	/** unwanted traffic received on server-facing ports */
 	long long unwanted_replies;
 	/** unwanted traffic received on client-facing ports */
@@ -776,6 +801,11 @@ struct ub_server_stats {
 	/** number of times neg cache records were used to generate NXDOMAIN
 	 * responses. */
 	long long num_neg_cache_nxdomain;
+	/** number of the aggressive NOERROR and NXDOMAIN responses that
+	 * were made from NSEC3 records */
+	long long num_neg_cache_nsec3;
+	/** number of answers synthesized from insecure cached DNAMEs */
+	long long num_dname_synth;
 	/** number of queries answered from edns-subnet specific data */
 	long long num_query_subnet;
 	/** number of queries answered from edns-subnet specific data, and
@@ -785,6 +815,49 @@ struct ub_server_stats {
 	long long mem_stream_wait;
 	/** number of TLS connection resume */
 	long long qtls_resume;
+	/** number of query regionals reused from the thread cache */
+	long long num_alloc_reg_reused;
+	/** number of query regionals malloced */
+	long long num_alloc_reg_new;
+	/** number of regional chunks reused from the thread cache */
+	long long num_alloc_chunk_reused;
+	/** number of regional chunks malloced */
+	long long num_alloc_chunk_new;
+	/** number of client queries handed to another thread */
+	long long num_handoff_out;
+	/** number of queries resolved for another thread */
+	long long num_handoff_in;
+	/** number of traced (sampled) queries */
+	long long trace_num;
+	/** number of traced queries slower than the threshold */
+	long long trace_num_slow;
+	/** number of traced queries that used the module, by module index */
+	long long trace_mod_num[UB_STATS_TRACE_MODULE_NUM];
+	/** sum of the time in the module of traced queries */
+	long long trace_mod_sum_sec[UB_STATS_TRACE_MODULE_NUM],
+		trace_mod_sum_usec[UB_STATS_TRACE_MODULE_NUM];
+	/** histogram of the time in the module of traced queries */
+	long long trace_mod_hist[UB_STATS_TRACE_MODULE_NUM]
+		[UB_STATS_TRACE_BUCKET_NUM];
+	/** number of signature verification cache entries */
+	long long sig_cache_count;
+	/** number of signature checks answered from the cache */
+	long long num_sig_cache_hit;
+	/** number of signature checks that did the public key operation */
+	long long num_sig_cache_miss;
+	/** number of NSEC3 hash cache entries */
+	long long nsec3_hash_cache_count;
+	/** number of NSEC3 hashes from the cache */
+	long long num_nsec3_hash_hit;
+	/** number of NSEC3 hashes that were computed */
+	long long num_nsec3_hash_miss;
+	/** number of NSEC3 hashes refused by the zone rate limit */
+	long long num_nsec3_hash_ratelimited;
+	/** number of signatures checked, by DNSKEY algorithm */
+	long long num_sig_verify[UB_STATS_ALGO_NUM];
+	/** number of signatures not checked, because cheaper signatures
+	 * made the rrset secure, by DNSKEY algorithm */
+	long long num_sig_skip[UB_STATS_ALGO_NUM];
 };
 
 /** 
@@ -810,6 +883,24 @@ struct ub_stats_info {
 	long long mesh_replies_sum_wait_sec, mesh_replies_sum_wait_usec;
 	/** mesh stats: median of waiting times for replies (in sec) */
 	double mesh_time_median;
+	/** mesh stats: current number of states per scheduling class */
+	long long mesh_class_num[UB_STATS_MESH_CLASS_NUM];
+	/** mesh stats: states not created due to the class limit */
+	long long mesh_class_dropped[UB_STATS_MESH_CLASS_NUM];
+	/** mesh stats: states finished per class */
+	long long mesh_class_done[UB_STATS_MESH_CLASS_NUM];
+	/** mesh stats: sum of the lifetimes of finished states per class */
+	long long mesh_class_sum_wait_sec[UB_STATS_MESH_CLASS_NUM],
+		mesh_class_sum_wait_usec[UB_STATS_MESH_CLASS_NUM];
+	/** mesh stats: current number of client prefixes with states */
+	long long mesh_fair_clients;
+	/** mesh stats: states of clients over their share removed */
+	long long mesh_fair_evicted;
+	/** mesh stats: queries of clients over their share dropped */
+	long long mesh_fair_dropped;
+	/** mesh stats: average request list size relative to the mean
+	 * over the threads, for the total the largest thread value */
+	double mesh_imbalance;
 };
 
 #ifdef __cplusplus
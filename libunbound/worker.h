@@ -142,6 +142,18 @@ struct outbound_entry* worker_send_query(struct query_info* qinfo,
 void worker_handle_control_cmd(struct tube* tube, uint8_t* msg, size_t len,
 	int error, void* arg);
 
+/**
+ * Handle entries in the handoff queue. Called when the handoff pipe
+ * signals. Resolves the queries that other workers handed off.
+ * @param tube: the handoff pipe.
+ * @param msg: the signal message, freed.
+ * @param len: length of msg.
+ * @param error: if an error happened on the pipe.
+ * @param arg: the worker.
+ */
+void worker_handle_handoff(struct tube* tube, uint8_t* msg, size_t len,
+	int error, void* arg);
+
 /** handles callbacks from listening event interface */
 int worker_handle_request(struct comm_point* c, void* arg, int error,
 	struct comm_reply* repinfo);
@@ -163,6 +175,9 @@ void worker_stat_timer_cb(void* arg);
 /** probe timer callback handler */
 void worker_probe_timer_cb(void* arg);
 
+/** refresh of popular cache entries timer callback handler */
+void worker_refresh_timer_cb(void* arg);
+
 /** start accept callback handler */
 void worker_start_accept(void* arg);
 
@@ -0,0 +1,441 @@
+/*
+ * services/cache/delegcache.c - index of the zone cuts in the rrset cache.
+ *
+ * Copyright (c) 2026, NLnet Labs. All rights reserved.
+ *
+ * This software is open source.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * Neither the name of the NLNET LABS nor the names of its contributors may
+ * be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ * TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * \file
+ *
+ * This file contains the delegation cache, the tree of zone cuts that
+ * have an NS rrset in the rrset cache.
+ */
+#include "config.h"
+#include "services/cache/delegcache.h"
+#include "services/cache/rrset.h"
+#include "util/data/packed_rrset.h"
+#include "util/log.h"
+#include "util/storage/lookup3.h"
+#include "sldns/rrdef.h"
+#include <ctype.h>
+
+/** size of a key buffer: class and the labels of a name without the root */
+#define DELEG_CACHE_KEYLEN (2+LDNS_MAX_DOMAINLEN)
+
+int
+deleg_cache_cmp(const void* k1, const void* k2)
+{
+	struct deleg_cache_node* n1 = (struct deleg_cache_node*)k1;
+	struct deleg_cache_node* n2 = (struct deleg_cache_node*)k2;
+	int c = memcmp(n1->key, n2->key, (n1->keylen<n2->keylen)?
+		n1->keylen:n2->keylen);
+	if(c != 0)
+		return c;
+	if(n1->keylen != n2->keylen)
+		return (n1->keylen < n2->keylen)?-1:1;
+	return 0;
+}
+
+/** make the tree key for a name, the class and the labels from the top
+ * down, lowercased; buffer has DELEG_CACHE_KEYLEN. returns length */
+static size_t
+deleg_cache_key(uint8_t* key, uint8_t* name, uint16_t dclass)
+{
+	uint8_t* labs[LDNS_MAX_DOMAINLEN/2+1];
+	size_t p = 2;
+	int n = 0, i;
+	uint8_t j;
+	key[0] = (uint8_t)(dclass>>8);
+	key[1] = (uint8_t)(dclass&0xff);
+	while(*name && n < (int)(sizeof(labs)/sizeof(labs[0]))) {
+		labs[n++] = name;
+		name += *name + 1;
+	}
+	for(i=n-1; i>=0; i--) {
+		key[p++] = *labs[i];
+		for(j=1; j<=*labs[i]; j++)
+			key[p++] = (uint8_t)tolower((unsigned char)labs[i][j]);
+	}
+	return p;
+}
+
+/** length of the longest common prefix of whole labels of two keys,
+ * 0 if the class differs */
+static size_t
+deleg_cache_common(uint8_t* k1, size_t len1, uint8_t* k2, size_t len2)
+{
+	size_t p = 2;
+	if(len1 < 2 || len2 < 2 || k1[0] != k2[0] || k1[1] != k2[1])
+		return 0;
+	while(p < len1 && p < len2 && k1[p] == k2[p] &&
+		p+1+k1[p] <= len1 && p+1+k1[p] <= len2 &&
+		memcmp(k1+p+1, k2+p+1, k1[p]) == 0)
+		p += 1+k1[p];
+	return p;
+}
+
+/** see if the node is at or below the zone cut, those nodes follow it in
+ * the tree */
+static int
+deleg_cache_below(struct deleg_cache_node* n, struct deleg_cache_node* cut)
+{
+	return n->keylen >= cut->keylen && memcmp(n->key, cut->key,
+		cut->keylen) == 0;
+}
+
+/** find the closest zone cut at or above the key, or NULL */
+static struct deleg_cache_node*
+deleg_cache_closest(struct deleg_cache_shard* s, struct deleg_cache_node* key)
+{
+	rbnode_type* res = NULL;
+	struct deleg_cache_node* n;
+	size_t m;
+	if(rbtree_find_less_equal(&s->tree, key, &res))
+		return (struct deleg_cache_node*)res;
+	n = (struct deleg_cache_node*)res;
+	if(!n)
+		return NULL;
+	/* go up until the cut encloses the key */
+	m = deleg_cache_common(n->key, n->keylen, key->key, key->keylen);
+	while(n && n->keylen > m)
+		n = n->parent;
+	return n;
+}
+
+/** length of the start of the key with the class and at most labs labels
+ * from the top down */
+static size_t
+deleg_cache_prefix(struct deleg_cache_node* key, int labs)
+{
+	size_t p = 2;
+	while(labs-- > 0 && p < key->keylen)
+		p += 1+key->key[p];
+	return p;
+}
+
+/** the shard for the start of the key, of length len */
+static struct deleg_cache_shard*
+deleg_cache_shard(struct deleg_cache* dc, struct deleg_cache_node* key,
+	size_t len)
+{
+	return &dc->shard[hashlittle(key->key, len, 0) & dc->mask];
+}
+
+struct deleg_cache*
+deleg_cache_create(size_t shards)
+{
+	size_t i;
+	struct deleg_cache* dc = (struct deleg_cache*)calloc(1, sizeof(*dc));
+	if(!dc)
+		return NULL;
+	log_assert(shards > 0 && (shards & (shards-1)) == 0);
+	dc->size = shards;
+	dc->mask = (uint32_t)(shards-1);
+	dc->shard = (struct deleg_cache_shard*)calloc(shards,
+		sizeof(struct deleg_cache_shard));
+	if(!dc->shard) {
+		free(dc);
+		return NULL;
+	}
+	for(i=0; i<dc->size; i++) {
+		lock_rw_init(&dc->shard[i].lock);
+		lock_protect(&dc->shard[i].lock, &dc->shard[i],
+			sizeof(dc->shard[i]));
+		rbtree_init(&dc->shard[i].tree, &deleg_cache_cmp);
+		dc->shard[i].sweep_at = DELEG_CACHE_SWEEP_MIN;
+		dc->shard[i].sweep_next = RBTREE_NULL;
+	}
+	return dc;
+}
+
+/** delete node in traverse */
+static void
+deleg_cache_delnode(rbnode_type* n, void* ATTR_UNUSED(arg))
+{
+	free(n);
+}
+
+void
+deleg_cache_delete(struct deleg_cache* dc)
+{
+	size_t i;
+	if(!dc)
+		return;
+	for(i=0; i<dc->size; i++) {
+		lock_rw_destroy(&dc->shard[i].lock);
+		traverse_postorder(&dc->shard[i].tree, &deleg_cache_delnode,
+			NULL);
+	}
+	free(dc->shard);
+	free(dc);
+}
+
+void
+deleg_cache_clear(struct deleg_cache* dc)
+{
+	size_t i;
+	struct deleg_cache_shard* s;
+	if(!dc)
+		return;
+	for(i=0; i<dc->size; i++) {
+		s = &dc->shard[i];
+		lock_rw_wrlock(&s->lock);
+		traverse_postorder(&s->tree, &deleg_cache_delnode, NULL);
+		rbtree_init(&s->tree, &deleg_cache_cmp);
+		s->sweep_at = DELEG_CACHE_SWEEP_MIN;
+		s->sweep_due = 0;
+		s->sweep_next = RBTREE_NULL;
+		s->incomplete = 0;
+		lock_rw_unlock(&s->lock);
+	}
+}
+
+/** add a node to the tree, and make it the parent of the nodes that
+ * were directly below its own parent */
+static void
+deleg_cache_link(struct deleg_cache_shard* s, struct deleg_cache_node* n)
+{
+	struct deleg_cache_node* p, *c;
+	rbnode_type* nx;
+	/* the closest encloser, before it is inserted */
+	p = deleg_cache_closest(s, n);
+	n->node.key = n;
+	(void)rbtree_insert(&s->tree, &n->node);
+	n->parent = p;
+	for(nx = rbtree_next(&n->node); nx != RBTREE_NULL;
+		nx = rbtree_next(nx)) {
+		c = (struct deleg_cache_node*)nx;
+		if(!deleg_cache_below(c, n))
+			break;
+		if(c->parent == p)
+			c->parent = n;
+	}
+}
+
+/** remove a node from the tree, the nodes directly below it get its
+ * parent, and free it */
+static void
+deleg_cache_unlink(struct deleg_cache_shard* s, struct deleg_cache_node* n)
+{
+	struct deleg_cache_node* c;
+	rbnode_type* nx;
+	for(nx = rbtree_next(&n->node); nx != RBTREE_NULL;
+		nx = rbtree_next(nx)) {
+		c = (struct deleg_cache_node*)nx;
+		if(!deleg_cache_below(c, n))
+			break;
+		if(c->parent == n)
+			c->parent = n->parent;
+	}
+	(void)rbtree_delete(&s->tree, n);
+	free(n);
+}
+
+/** see if the referenced NS rrset is still in the cache and not expired */
+static int
+deleg_cache_valid(struct rrset_ref* ref, time_t now)
+{
+	int valid;
+	lock_rw_rdlock(&ref->key->entry.lock);
+	valid = (ref->key->id == ref->id && now <= ((struct packed_rrset_data*)
+		ref->key->entry.data)->ttl);
+	lock_rw_unlock(&ref->key->entry.lock);
+	return valid;
+}
+
+/** remove the nodes of which the NS rrset is gone or expired, they are
+ * added again when the NS rrset is stored again.  A step of the sweep
+ * checks a limited number of nodes, the lookups continue it */
+static void
+deleg_cache_sweep_step(struct deleg_cache_shard* s, time_t now)
+{
+	rbnode_type* nx, *next;
+	int i;
+	lock_rw_wrlock(&s->lock);
+	nx = s->sweep_next;
+	for(i=0; s->sweep_due && i<DELEG_CACHE_SWEEP_STEP &&
+		nx != RBTREE_NULL; i++) {
+		next = rbtree_next(nx);
+		if(!deleg_cache_valid(&((struct deleg_cache_node*)nx)->ns, now))
+			deleg_cache_unlink(s, (struct deleg_cache_node*)nx);
+		nx = next;
+	}
+	s->sweep_next = nx;
+	if(s->sweep_due && nx == RBTREE_NULL) {
+		s->sweep_due = 0;
+		s->sweep_at = s->tree.count*2;
+		if(s->sweep_at < DELEG_CACHE_SWEEP_MIN)
+			s->sweep_at = DELEG_CACHE_SWEEP_MIN;
+	}
+	lock_rw_unlock(&s->lock);
+}
+
+void
+deleg_cache_note(struct deleg_cache* dc, uint8_t* name, size_t len,
+	uint16_t dclass, struct rrset_ref* ref)
+{
+	uint8_t buf[DELEG_CACHE_KEYLEN];
+	struct deleg_cache_node key, *n;
+	struct deleg_cache_shard* s;
+	if(!dc)
+		return;
+	key.node.key = &key;
+	key.key = buf;
+	key.keylen = deleg_cache_key(buf, name, dclass);
+	s = deleg_cache_shard(dc, &key, deleg_cache_prefix(&key,
+		DELEG_CACHE_SHARD_LABELS));
+	/* the NS rrset is mostly refreshed under the same key */
+	lock_rw_rdlock(&s->lock);
+	n = (struct deleg_cache_node*)rbtree_search(&s->tree, &key);
+	if(n && n->ns.key == ref->key && n->ns.id == ref->id) {
+		lock_rw_unlock(&s->lock);
+		return;
+	}
+	lock_rw_unlock(&s->lock);
+
+	lock_rw_wrlock(&s->lock);
+	n = (struct deleg_cache_node*)rbtree_search(&s->tree, &key);
+	if(n) {
+		n->ns = *ref;
+		lock_rw_unlock(&s->lock);
+		return;
+	}
+	n = (struct deleg_cache_node*)malloc(sizeof(*n) + key.keylen + len);
+	if(!n) {
+		log_err("delegation cache: out of memory");
+		s->incomplete = 1;
+		lock_rw_unlock(&s->lock);
+		return;
+	}
+	memset(n, 0, sizeof(*n));
+	n->key = (uint8_t*)(n+1);
+	n->keylen = key.keylen;
+	memmove(n->key, buf, key.keylen);
+	n->name = n->key + key.keylen;
+	n->len = len;
+	memmove(n->name, name, len);
+	n->ns = *ref;
+	deleg_cache_link(s, n);
+	if(!s->sweep_due && s->tree.count >= s->sweep_at) {
+		/* the lookups remove the outdated nodes */
+		s->sweep_due = 1;
+		s->sweep_next = rbtree_first(&s->tree);
+	}
+	lock_rw_unlock(&s->lock);
+}
+
+/** find the closest cut at or above the key in the shard, that has not
+ * expired and has a key of at least minlen, the NS rrset is returned
+ * readlocked, or NULL */
+static struct ub_packed_rrset_key*
+deleg_cache_find(struct deleg_cache_shard* s, struct rrset_cache* r,
+	struct deleg_cache_node* key, size_t minlen, uint16_t qclass,
+	time_t now)
+{
+	struct deleg_cache_node* n;
+	struct rrset_ref* ref;
+	struct ub_packed_rrset_key* ns;
+	for(n = deleg_cache_closest(s, key); n && n->keylen >= minlen;
+		n = n->parent) {
+		ref = &n->ns;
+		lock_rw_rdlock(&ref->key->entry.lock);
+		if(ref->key->id == ref->id) {
+			if(now <= ((struct packed_rrset_data*)ref->key->
+				entry.data)->ttl)
+				return ref->key;
+			/* expired, try the cut above it */
+			lock_rw_unlock(&ref->key->entry.lock);
+			continue;
+		}
+		lock_rw_unlock(&ref->key->entry.lock);
+		/* the rrset has been stored again under another key, or it
+		 * is gone from the cache */
+		if((ns = rrset_cache_lookup(r, n->name, n->len,
+			LDNS_RR_TYPE_NS, qclass, 0, now, 0)))
+			return ns;
+	}
+	return NULL;
+}
+
+/** search the shard for the closest cut with a key of at least minlen,
+ * continue the sweep of the shard first if it is busy.  returns false if
+ * the shard is incomplete */
+static int
+deleg_cache_search(struct deleg_cache_shard* s, struct rrset_cache* r,
+	struct deleg_cache_node* key, size_t minlen, uint16_t qclass,
+	time_t now, struct ub_packed_rrset_key** ns)
+{
+	lock_rw_rdlock(&s->lock);
+	if(s->sweep_due) {
+		/* no rrset is locked by this thread during the sweep */
+		lock_rw_unlock(&s->lock);
+		deleg_cache_sweep_step(s, now);
+		lock_rw_rdlock(&s->lock);
+	}
+	if(s->incomplete) {
+		lock_rw_unlock(&s->lock);
+		return 0;
+	}
+	*ns = deleg_cache_find(s, r, key, minlen, qclass, now);
+	lock_rw_unlock(&s->lock);
+	return 1;
+}
+
+int
+deleg_cache_lookup(struct deleg_cache* dc, struct rrset_cache* r,
+	uint8_t* qname, size_t ATTR_UNUSED(qnamelen), uint16_t qclass,
+	time_t now, struct ub_packed_rrset_key** ns)
+{
+	uint8_t buf[DELEG_CACHE_KEYLEN];
+	struct deleg_cache_node key;
+	size_t len;
+	int labs;
+	if(!dc)
+		return 0;
+	key.node.key = &key;
+	key.key = buf;
+	key.keylen = deleg_cache_key(buf, qname, qclass);
+	*ns = NULL;
+	/* the cuts with the labels at the start of the key are in its
+	 * shard, the ones with fewer labels in the shard of their own key */
+	for(labs = DELEG_CACHE_SHARD_LABELS; labs >= 0; labs--) {
+		len = deleg_cache_prefix(&key, labs);
+		if(labs > 0 && len == deleg_cache_prefix(&key, labs-1))
+			continue; /* the name has fewer labels */
+		if(!deleg_cache_search(deleg_cache_shard(dc, &key, len), r,
+			&key, len, qclass, now, ns))
+			return 0;
+		if(*ns)
+			return 1;
+	}
+	return 1;
+}
@@ -0,0 +1,182 @@
+/*
+ * services/cache/delegcache.h - index of the zone cuts in the rrset cache.
+ *
+ * Copyright (c) 2026, NLnet Labs. All rights reserved.
+ *
+ * This software is open source.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * Neither the name of the NLNET LABS nor the names of its contributors may
+ * be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ * TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * \file
+ *
+ * This file contains the delegation cache, a tree of the names that have
+ * an NS rrset in the rrset cache.  The closest zone cut above a name is
+ * found with one tree lookup, instead of an rrset cache lookup for every
+ * label of the name.  The tree is keyed on the class and the labels from
+ * the top down, so the names below a zone cut have its key as a prefix
+ * and follow it in the tree.  The tree holds references to the NS rrsets,
+ * the rrsets themselves (and their addresses) stay in the rrset cache.
+ */
+
+#ifndef SERVICES_CACHE_DELEGCACHE_H
+#define SERVICES_CACHE_DELEGCACHE_H
+#include "util/locks.h"
+#include "util/rbtree.h"
+#include "util/data/msgreply.h"
+struct rrset_cache;
+struct ub_packed_rrset_key;
+
+/** minimum number of nodes in a shard before outdated nodes are removed */
+#define DELEG_CACHE_SWEEP_MIN 1024
+/** number of nodes that are checked in one step of the sweep */
+#define DELEG_CACHE_SWEEP_STEP 64
+/** number of labels from the top down that select the shard of a name */
+#define DELEG_CACHE_SHARD_LABELS 2
+
+/**
+ * Zone cut in the delegation cache.
+ */
+struct deleg_cache_node {
+	/** rbtree node, key is this struct */
+	rbnode_type node;
+	/** the closest zone cut above this one in the shard, or NULL; kept
+	 * up to date when nodes are added and removed */
+	struct deleg_cache_node* parent;
+	/** the tree key: class (network order) and the labels from the top
+	 * down, lowercased */
+	uint8_t* key;
+	/** length of key */
+	size_t keylen;
+	/** name of the zone cut, in wireformat */
+	uint8_t* name;
+	/** length of name */
+	size_t len;
+	/** reference to the NS rrset in the rrset cache */
+	struct rrset_ref ns;
+};
+
+/**
+ * Shard of the delegation cache.  The names below a domain two labels
+ * below the root, like example.com, are in the same shard, so the cuts
+ * there are found in one shard.  The top level domains and the root are
+ * in the shard of their own key, they are looked up there when the shard
+ * of the name has no usable cut.
+ */
+struct deleg_cache_shard {
+	/** lock on the tree */
+	lock_rw_type lock;
+	/** tree of struct deleg_cache_node, the zone cuts */
+	rbtree_type tree;
+	/** number of nodes at which outdated nodes are removed */
+	size_t sweep_at;
+	/** if outdated nodes are being removed, a step at a time by the
+	 * lookups */
+	int sweep_due;
+	/** the next node that the sweep checks, RBTREE_NULL at the end */
+	rbnode_type* sweep_next;
+	/** if a zone cut could not be added, out of memory; the shard is
+	 * not used any more because it could give a cut that is too high */
+	int incomplete;
+};
+
+/**
+ * Delegation cache, shared by the threads like the rrset cache it indexes.
+ */
+struct deleg_cache {
+	/** number of shards, a power of 2 */
+	size_t size;
+	/** mask on the hash for the shard */
+	uint32_t mask;
+	/** the shards, array of size */
+	struct deleg_cache_shard* shard;
+};
+
+/**
+ * Compare two delegation cache nodes, on their key.
+ * @param k1: node.
+ * @param k2: node.
+ * @return -1, 0, +1 comparison value.
+ */
+int deleg_cache_cmp(const void* k1, const void* k2);
+
+/**
+ * Create delegation cache.
+ * @param shards: number of shards, a power of 2.
+ * @return new delegation cache or NULL on alloc failure.
+ */
+struct deleg_cache* deleg_cache_create(size_t shards);
+
+/**
+ * Delete delegation cache.
+ * @param dc: delegation cache to delete.
+ */
+void deleg_cache_delete(struct deleg_cache* dc);
+
+/**
+ * Clear delegation cache, remove all zone cuts.  The references to the
+ * NS rrsets are not valid any more when the rrset cache is cleared.
+ * @param dc: delegation cache, if NULL nothing happens.
+ */
+void deleg_cache_clear(struct deleg_cache* dc);
+
+/**
+ * Note the NS rrset of a zone cut, that is stored in the rrset cache.
+ * Caller may not hold a lock on any rrset.
+ * @param dc: delegation cache, if NULL nothing happens.
+ * @param name: owner name of the NS rrset.
+ * @param len: length of name.
+ * @param dclass: class of the rrset (host order).
+ * @param ref: reference to the NS rrset as stored in the rrset cache.
+ */
+void deleg_cache_note(struct deleg_cache* dc, uint8_t* name, size_t len,
+	uint16_t dclass, struct rrset_ref* ref);
+
+/**
+ * Lookup the closest zone cut at or above the name.
+ * Caller may not hold a lock on any rrset.
+ * @param dc: delegation cache.
+ * @param r: the rrset cache, for NS rrsets that were stored under a
+ *	different key than the one noted.
+ * @param qname: name to find the zone cut for.
+ * @param qnamelen: length of qname.
+ * @param qclass: class to lookup (host order).
+ * @param now: current time, to check the TTL.  The lookup also removes
+ *	some outdated cuts, when the shard has grown.
+ * @param ns: returns the NS rrset of the closest cut that has not expired,
+ *	readlocked, or NULL if there is none.
+ * @return false if the delegation cache cannot be used, NULL or
+ *	incomplete, then ns is not set and the caller has to find the cut
+ *	itself.
+ */
+int deleg_cache_lookup(struct deleg_cache* dc, struct rrset_cache* r,
+	uint8_t* qname, size_t qnamelen, uint16_t qclass, time_t now,
+	struct ub_packed_rrset_key** ns);
+
+#endif /* SERVICES_CACHE_DELEGCACHE_H */
@@ -40,10 +40,13 @@
  */
 #include "config.h"
 #include "iterator/iter_delegpt.h"
+#include "iterator/iter_fwd.h"
+#include "iterator/iter_hints.h"
 #include "validator/val_nsec.h"
 #include "validator/val_utils.h"
 #include "services/cache/dns.h"
 #include "services/cache/rrset.h"
+#include "services/mesh.h"
 #include "util/data/msgreply.h"
 #include "util/data/packed_rrset.h"
 #include "util/data/dname.h"
@@ -83,6 +86,12 @@ store_rrsets(struct module_env* env, struct reply_info* rep, time_t now,
 			LDNS_RR_TYPE_NS && !pside)?0:leeway))) {
 		case 0: /* ref unchanged, item inserted */
 			break;
+		case 3: /* ref updated, item inserted, secure status of
+			 * the unchanged rrset is carried over */
+			if(env->mesh)
+				env->mesh->num_rrset_unchanged++;
+			rep->rrsets[i] = rep->ref[i].key;
+			break;
 		case 2: /* ref updated, cache is superior */
 			if(region) {
 				struct ub_packed_rrset_key* ck;
@@ -464,8 +473,10 @@ dns_cache_find_delegation(struct module_env* env, uint8_t* qname,
 	struct packed_rrset_data* nsdata;
 	struct delegpt* dp;
 
-	nskey = find_closest_of_type(env, qname, qnamelen, qclass, now,
-		LDNS_RR_TYPE_NS, 0);
+	/* the types at the zone apex are mostly asked for the zone name */
+	nskey = rrset_cache_lookup_cut(env->rrset_cache, qname, qnamelen,
+		qclass, (qtype == LDNS_RR_TYPE_NS || qtype == LDNS_RR_TYPE_SOA ||
+		qtype == LDNS_RR_TYPE_DNSKEY), now);
 	if(!nskey) /* hope the caller has hints to prime or something */
 		return NULL;
 	nsdata = (struct packed_rrset_data*)nskey->entry.data;
@@ -532,18 +543,24 @@ gen_dns_msg(struct regional* region, struct query_info* q, size_t num)
 
 struct dns_msg*
 tomsg(struct module_env* env, struct query_info* q, struct reply_info* r, 
-	struct regional* region, time_t now, struct regional* scratch)
+	struct regional* region, time_t now, int allow_expired,
+	struct regional* scratch)
 {
 	struct dns_msg* msg;
 	size_t i;
-	if(now > r->ttl)
-		return NULL;
+	int expired = 0;
+	if(now > r->ttl) {
+		if(!allow_expired || (env && env->cfg->serve_expired_ttl &&
+			r->serve_expired_ttl < now))
+			return NULL;
+		expired = 1;
+	}
 	msg = gen_dns_msg(region, q, r->rrset_count);
 	if(!msg)
 		return NULL;
 	msg->rep->flags = r->flags;
 	msg->rep->qdcount = r->qdcount;
-	msg->rep->ttl = r->ttl - now;
+	msg->rep->ttl = expired?0:r->ttl - now;
 	if(r->prefetch_ttl > now)
 		msg->rep->prefetch_ttl = r->prefetch_ttl - now;
 	else	msg->rep->prefetch_ttl = PREFETCH_TTL_CALC(msg->rep->ttl);
@@ -554,7 +571,8 @@ tomsg(struct module_env* env, struct query_info* q, struct reply_info* r,
 	msg->rep->ar_numrrsets = r->ar_numrrsets;
 	msg->rep->rrset_count = r->rrset_count;
         msg->rep->authoritative = r->authoritative;
-	if(!rrset_array_lock(r->ref, r->rrset_count, now))
+	/* the rrsets of an expired entry become TTL 0 in the copy */
+	if(!rrset_array_lock(r->ref, r->rrset_count, expired?0:now))
 		return NULL;
 	if(r->an_numrrsets > 0 && (r->rrsets[0]->rk.type == htons(
 		LDNS_RR_TYPE_CNAME) || r->rrsets[0]->rk.type == htons(
@@ -688,7 +706,7 @@ synth_dname_msg(struct ub_packed_rrset_key* rrset, struct regional* region,
 	if(!newd)
 		return NULL;
 	ck->entry.data = newd;
-	newd->ttl = 0; /* 0 for synthesized CNAME TTL */
+	newd->ttl = d->ttl - now; /* the DNAME TTL, RFC 6672 */
 	newd->count = 1;
 	newd->rrsig_count = 0;
 	newd->trust = rrset_trust_ans_noAA;
@@ -707,6 +725,41 @@ synth_dname_msg(struct ub_packed_rrset_key* rrset, struct regional* region,
 	return msg;
 }
 
+/** see if an insecure cached DNAME can be used to synthesize the answer,
+ * with synth-insecure-dname. The dname is the copy in the synthesized msg */
+static int
+insecure_dname_usable(struct module_env* env, struct ub_packed_rrset_key* dname,
+	enum sec_status sec_status, uint8_t* qname, uint16_t qclass)
+{
+	struct packed_rrset_data* d = (struct packed_rrset_data*)
+		dname->entry.data;
+	struct delegpt* dp;
+	struct iter_hints_stub* stub;
+	if(!env->cfg->synth_insecure_dname)
+		return 0;
+	/* with a validator the DNAME must be insecure, or outside of the
+	 * trust anchors, without one it is unchecked; bogus DNAMEs are never
+	 * used */
+	if(sec_status != sec_status_insecure &&
+		sec_status != sec_status_indeterminate &&
+		(env->need_to_validate || sec_status != sec_status_unchecked))
+		return 0;
+	/* only DNAMEs from the answer section of a reply, not from the
+	 * authority or additional section */
+	if(d->trust != rrset_trust_ans_noAA && d->trust < rrset_trust_ans_AA)
+		return 0;
+	/* a configured forward or stub zone below the DNAME owner is where
+	 * the name is resolved, the DNAME is out of bailiwick for it */
+	if(env->fwds && (dp=forwards_lookup(env->fwds, qname, qclass)) &&
+		dname_strict_subdomain_c(dp->name, dname->rk.dname))
+		return 0;
+	if(env->hints && (stub=hints_lookup_stub(env->hints, qname, qclass,
+		NULL)) && dname_strict_subdomain_c(stub->dp->name,
+		dname->rk.dname))
+		return 0;
+	return 1;
+}
+
 /** Fill TYPE_ANY response with some data from cache */
 static struct dns_msg*
 fill_any(struct module_env* env,
@@ -795,7 +848,7 @@ dns_cache_lookup(struct module_env* env,
 		struct msgreply_entry* key = (struct msgreply_entry*)e->key;
 		struct reply_info* data = (struct reply_info*)e->data;
 		struct dns_msg* msg = tomsg(env, &key->key, data, region, now, 
-			scratch);
+			0, scratch);
 		if(msg) {
 			lock_rw_unlock(&e->lock);
 			return msg;
@@ -824,6 +877,13 @@ dns_cache_lookup(struct module_env* env,
 			/* normally, only secure DNAMEs allowed from cache*/
 			if(sec_status == sec_status_secure)
 				return msg;
+			/* insecure DNAMEs with synth-insecure-dname */
+			if(insecure_dname_usable(env, msg->rep->rrsets[0],
+				sec_status, qname, qclass)) {
+				if(env->mesh)
+					env->mesh->num_dname_synth++;
+				return msg;
+			}
 			/* but if we have a CNAME cached with this name, then we
 			 * have previously already allowed this name to pass.
 			 * the next cache lookup is going to fetch that CNAME itself,
@@ -912,7 +972,7 @@ dns_cache_lookup(struct module_env* env,
 			struct dns_msg* msg;
 			if(FLAGS_GET_RCODE(data->flags) == LDNS_RCODE_NXDOMAIN
 			  && data->security == sec_status_secure
-			  && (msg=tomsg(env, &k, data, region, now, scratch))){
+			  && (msg=tomsg(env, &k, data, region, now, 0, scratch))){
 				lock_rw_unlock(&e->lock);
 				msg->qinfo.qname=qname;
 				msg->qinfo.qname_len=qnamelen;
@@ -242,6 +242,8 @@ infra_create(struct config_file* cfg)
 		return NULL;
 	}
 	infra->host_ttl = cfg->host_ttl;
+	infra->hedge_percentile = cfg->hedge_percentile;
+	infra->rtt_percentile = cfg->infra_cache_rtt_percentile;
 	infra_dp_ratelimit = cfg->ratelimit;
 	infra->domain_rates = slabhash_create(cfg->ratelimit_slabs,
 		INFRA_HOST_STARTSIZE, cfg->ratelimit_size,
@@ -295,6 +297,8 @@ infra_adjust(struct infra_cache* infra, struct config_file* cfg)
 	if(!infra)
 		return infra_create(cfg);
 	infra->host_ttl = cfg->host_ttl;
+	infra->hedge_percentile = cfg->hedge_percentile;
+	infra->rtt_percentile = cfg->infra_cache_rtt_percentile;
 	infra_dp_ratelimit = cfg->ratelimit;
 	infra_ip_ratelimit = cfg->ip_ratelimit;
 	maxmem = cfg->infra_cache_numhosts * (sizeof(struct infra_key)+
@@ -379,6 +383,7 @@ data_entry_init(struct infra_cache* infra, struct lruhash_entry* e,
 	struct infra_data* data = (struct infra_data*)e->data;
 	data->ttl = timenow + infra->host_ttl;
 	rtt_init(&data->rtt);
+	rtt_sketch_init(&data->lat);
 	data->edns_version = 0;
 	data->edns_lame_known = 0;
 	data->probedelay = 0;
@@ -431,6 +436,53 @@ new_entry(struct infra_cache* infra, struct sockaddr_storage* addr,
 	return &key->entry;
 }
 
+/**
+ * Get the timeout for a query to the host.  This is the rto, but with
+ * infra-cache-rtt-percentile, when there is no timeout backoff and the
+ * host has enough samples, the timeout is shortened to a margin over the
+ * 99th percentile.  Then a query to a server that replies consistently
+ * is retried sooner.
+ */
+static int
+infra_data_timeout(struct infra_cache* infra, struct infra_data* data)
+{
+	int to = rtt_timeout(&data->rtt), p99;
+	if(!infra->rtt_percentile)
+		return to;
+	if(to != rtt_notimeout(&data->rtt))
+		return to; /* timeout backoff in effect */
+	p99 = rtt_sketch_percentile(&data->lat, 99);
+	if(p99 > 0) {
+		p99 += p99/4;
+		if(p99 < RTT_MIN_TIMEOUT)
+			p99 = RTT_MIN_TIMEOUT;
+		if(p99 < to)
+			to = p99;
+	}
+	return to;
+}
+
+/**
+ * Get the rtt of the host for server selection.  With
+ * infra-cache-rtt-percentile and enough samples, the mean of the median
+ * and the 99th percentile, so that a server with latency outliers is
+ * ranked after a server that is consistent.
+ */
+static int
+infra_data_sel_rtt(struct infra_cache* infra, struct infra_data* data)
+{
+	int p50, p99;
+	if(!infra->rtt_percentile)
+		return rtt_unclamped(&data->rtt);
+	if(rtt_timeout(&data->rtt) != rtt_notimeout(&data->rtt))
+		return rtt_unclamped(&data->rtt); /* timeout backoff */
+	p50 = rtt_sketch_percentile(&data->lat, 50);
+	p99 = rtt_sketch_percentile(&data->lat, 99);
+	if(p50 == 0 || p99 == 0)
+		return rtt_unclamped(&data->rtt);
+	return (p50+p99)/2;
+}
+
 int 
 infra_host(struct infra_cache* infra, struct sockaddr_storage* addr,
         socklen_t addrlen, uint8_t* nm, size_t nmlen, time_t timenow,
@@ -471,7 +523,7 @@ infra_host(struct infra_cache* infra, struct sockaddr_storage* addr,
 		data = (struct infra_data*)e->data;
 		*edns_vs = data->edns_version;
 		*edns_lame_known = data->edns_lame_known;
-		*to = rtt_timeout(&data->rtt);
+		*to = infra_data_timeout(infra, data);
 		slabhash_insert(infra->hosts, e->hash, e, data, NULL);
 		return 1;
 	}
@@ -479,7 +531,7 @@ infra_host(struct infra_cache* infra, struct sockaddr_storage* addr,
 	data = (struct infra_data*)e->data;
 	*edns_vs = data->edns_version;
 	*edns_lame_known = data->edns_lame_known;
-	*to = rtt_timeout(&data->rtt);
+	*to = infra_data_timeout(infra, data);
 	if(*to >= PROBE_MAXRTO && rtt_notimeout(&data->rtt)*4 <= *to) {
 		/* delay other queries, this is the probe query */
 		if(!wr) {
@@ -576,6 +628,16 @@ infra_rtt_update(struct infra_cache* infra, struct sockaddr_storage* addr,
 	/* have an entry, update the rtt */
 	data = (struct infra_data*)e->data;
 	if(roundtrip == -1) {
+		/* the query took at least its timeout, without it the
+		 * percentiles of the replies would shorten the timeout
+		 * of a lossy host further */
+		if(infra->rtt_percentile && orig_rtt > 0)
+			rtt_sketch_add(&data->lat, orig_rtt);
+		/* a timeout shortened by the latency percentile is backed
+		 * off from the rto, that then disables the shortcut until
+		 * the next reply */
+		if(orig_rtt < rtt_notimeout(&data->rtt))
+			orig_rtt = rtt_notimeout(&data->rtt);
 		rtt_lost(&data->rtt, orig_rtt);
 		if(qtype == LDNS_RR_TYPE_A) {
 			if(data->timeout_A < TIMEOUT_COUNT_MAX)
@@ -594,6 +656,7 @@ infra_rtt_update(struct infra_cache* infra, struct sockaddr_storage* addr,
 		if(rtt_unclamped(&data->rtt) >= USEFUL_SERVER_TOP_TIMEOUT)
 			rtt_init(&data->rtt);
 		rtt_update(&data->rtt, roundtrip);
+		rtt_sketch_add(&data->lat, roundtrip);
 		data->probedelay = 0;
 		if(qtype == LDNS_RR_TYPE_A)
 			data->timeout_A = 0;
@@ -635,6 +698,25 @@ long long infra_get_host_rto(struct infra_cache* infra,
 	return ttl;
 }
 
+int
+infra_get_hedge_rtt(struct infra_cache* infra, struct sockaddr_storage* addr,
+	socklen_t addrlen, uint8_t* nm, size_t nmlen, time_t timenow)
+{
+	struct lruhash_entry* e;
+	struct infra_data* data;
+	int r = 0;
+	if(infra->hedge_percentile <= 0)
+		return 0;
+	e = infra_lookup_nottl(infra, addr, addrlen, nm, nmlen, 0);
+	if(!e)
+		return 0;
+	data = (struct infra_data*)e->data;
+	if(data->ttl >= timenow)
+		r = rtt_sketch_percentile(&data->lat, infra->hedge_percentile);
+	lock_rw_unlock(&e->lock);
+	return r;
+}
+
 int 
 infra_edns_update(struct infra_cache* infra, struct sockaddr_storage* addr,
 	socklen_t addrlen, uint8_t* nm, size_t nmlen, int edns_version,
@@ -678,7 +760,7 @@ infra_get_lame_rtt(struct infra_cache* infra,
 	if(!e) 
 		return 0;
 	host = (struct infra_data*)e->data;
-	*rtt = rtt_unclamped(&host->rtt);
+	*rtt = infra_data_sel_rtt(infra, host);
 	if(host->rtt.rto >= PROBE_MAXRTO && timenow < host->probedelay
 		&& rtt_notimeout(&host->rtt)*4 <= host->rtt.rto) {
 		/* single probe for this domain, and we are not probing */
@@ -80,6 +80,9 @@ struct infra_data {
 	time_t probedelay;
 	/** round trip times for timeout calculation */
 	struct rtt_info rtt;
+	/** distribution of the roundtrip times, for server selection,
+	 * timeouts and hedging */
+	struct rtt_sketch lat;
 
 	/** edns version that the host supports, -1 means no EDNS */
 	int edns_version;
@@ -114,6 +117,12 @@ struct infra_cache {
 	struct slabhash* hosts;
 	/** TTL value for host information, in seconds */
 	int host_ttl;
+	/** percentile of the roundtrip times of a host after which a
+	 * query is hedged, 0 is off */
+	int hedge_percentile;
+	/** if the roundtrip time percentiles of a host shorten its
+	 * timeout and are used for server selection */
+	int rtt_percentile;
 	/** hash table with query rates per name: rate_key, rate_data */
 	struct slabhash* domain_rates;
 	/** ratelimit settings for domains, struct domain_limit_data */
@@ -288,6 +297,22 @@ int infra_rtt_update(struct infra_cache* infra, struct sockaddr_storage* addr,
 	socklen_t addrlen, uint8_t* name, size_t namelen, int qtype,
 	int roundtrip, int orig_rtt, time_t timenow);
 
+/**
+ * Get the hedge percentile of the roundtrip times of the host, that is
+ * used to decide when to hedge a query to another server.
+ * @param infra: infrastructure cache.
+ * @param addr: host address.
+ * @param addrlen: length of addr.
+ * @param name: zone name
+ * @param namelen: zone name length
+ * @param timenow: what time it is now.
+ * @return the percentile in msec, or 0 if not known (no samples, expired
+ *	or hedging not configured).
+ */
+int infra_get_hedge_rtt(struct infra_cache* infra,
+	struct sockaddr_storage* addr, socklen_t addrlen, uint8_t* name,
+	size_t namelen, time_t timenow);
+
 /**
  * Update information for the host, store that a TCP transaction works.
  * @param infra: infrastructure cache.
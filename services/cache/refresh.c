@@ -0,0 +1,309 @@
+/*
+ * services/cache/refresh.c - refresh of popular message cache entries.
+ *
+ * Copyright (c) 2026, NLnet Labs. All rights reserved.
+ *
+ * This software is open source.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 
+ * Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ * 
+ * Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ * 
+ * Neither the name of the NLNET LABS nor the names of its contributors may
+ * be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ * TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * \file
+ *
+ * This file keeps track of the popular entries in the message cache, so
+ * that they can be refreshed before they expire.
+ */
+#include "config.h"
+#include "services/cache/refresh.h"
+#include "util/data/msgreply.h"
+#include "util/data/dname.h"
+#include "util/net_help.h"
+#include "util/random.h"
+#include "util/log.h"
+
+int
+refresh_query_cmp(const void* k1, const void* k2)
+{
+	struct refresh_entry* e1 = (struct refresh_entry*)k1;
+	struct refresh_entry* e2 = (struct refresh_entry*)k2;
+	if(e1->qtype != e2->qtype)
+		return (e1->qtype < e2->qtype)?-1:1;
+	if(e1->qclass != e2->qclass)
+		return (e1->qclass < e2->qclass)?-1:1;
+	if(e1->qflags != e2->qflags)
+		return (e1->qflags < e2->qflags)?-1:1;
+	if(e1->qname_len != e2->qname_len)
+		return (e1->qname_len < e2->qname_len)?-1:1;
+	return query_dname_compare(e1->qname, e2->qname);
+}
+
+int
+refresh_due_cmp(const void* k1, const void* k2)
+{
+	struct refresh_entry* e1 = (struct refresh_entry*)k1;
+	struct refresh_entry* e2 = (struct refresh_entry*)k2;
+	if(e1->due != e2->due)
+		return (e1->due < e2->due)?-1:1;
+	return refresh_query_cmp(k1, k2);
+}
+
+struct refresh_table*
+refresh_create(size_t max, int rate, struct ub_randstate* rnd)
+{
+	struct refresh_table* r = (struct refresh_table*)calloc(1,
+		sizeof(*r));
+	if(!r)
+		return NULL;
+	rbtree_init(&r->queries, &refresh_query_cmp);
+	rbtree_init(&r->due, &refresh_due_cmp);
+	r->max = max;
+	r->rate = rate;
+	r->rnd = rnd;
+	r->pick = (struct refresh_entry**)calloc((size_t)rate,
+		sizeof(*r->pick));
+	if(!r->pick) {
+		free(r);
+		return NULL;
+	}
+	r->mem = sizeof(*r) + sizeof(*r->pick) * (size_t)rate;
+	return r;
+}
+
+/** delete a refresh entry, from traverse */
+static void
+refresh_entry_del(rbnode_type* n, void* ATTR_UNUSED(arg))
+{
+	struct refresh_entry* e = (struct refresh_entry*)n;
+	free(e->qname);
+	free(e);
+}
+
+void
+refresh_delete(struct refresh_table* r)
+{
+	if(!r)
+		return;
+	traverse_postorder(&r->queries, &refresh_entry_del, NULL);
+	free(r->pick);
+	free(r);
+}
+
+/** remove entry from the lru list */
+static void
+refresh_lru_remove(struct refresh_table* r, struct refresh_entry* e)
+{
+	if(e->lru_prev)
+		e->lru_prev->lru_next = e->lru_next;
+	else	r->lru_first = e->lru_next;
+	if(e->lru_next)
+		e->lru_next->lru_prev = e->lru_prev;
+	else	r->lru_last = e->lru_prev;
+	e->lru_prev = NULL;
+	e->lru_next = NULL;
+}
+
+/** put entry at the front of the lru list */
+static void
+refresh_lru_front(struct refresh_table* r, struct refresh_entry* e)
+{
+	e->lru_prev = NULL;
+	e->lru_next = r->lru_first;
+	if(r->lru_first)
+		r->lru_first->lru_prev = e;
+	else	r->lru_last = e;
+	r->lru_first = e;
+}
+
+/** remove entry from the table and free it */
+static void
+refresh_entry_remove(struct refresh_table* r, struct refresh_entry* e)
+{
+	(void)rbtree_delete(&r->due, e);
+	(void)rbtree_delete(&r->queries, e);
+	refresh_lru_remove(r, e);
+	r->mem -= sizeof(*e) + e->qname_len;
+	free(e->qname);
+	free(e);
+}
+
+/** set the expiry and due time for a newly cached reply and put the
+ * entry in the due tree. The due time is a random point in the span of
+ * time before the prefetch time that is as long as the prefetch span,
+ * so that refreshes of entries stored at the same time are spread out. */
+static void
+refresh_entry_schedule(struct refresh_table* r, struct refresh_entry* e,
+	time_t ttl, time_t prefetch_ttl, time_t now)
+{
+	time_t span = ttl - prefetch_ttl;
+	e->expire = ttl;
+	if(span <= 0)
+		e->due = ttl - 1;
+	else	e->due = prefetch_ttl - (time_t)ub_random_max(r->rnd,
+			(long int)span + 1);
+	if(e->due < now)
+		e->due = now;
+	e->hits = 0;
+	e->since = now;
+	e->refreshed = 0;
+	e->due_node.key = e;
+	(void)rbtree_insert(&r->due, &e->due_node);
+}
+
+int
+refresh_note(struct refresh_table* r, struct query_info* qinfo,
+	uint16_t qflags, time_t ttl, time_t prefetch_ttl, time_t now)
+{
+	struct refresh_entry key, *e;
+	int useful = 0;
+	if(ttl <= now)
+		return 0; /* expired answer, it is not refreshed here */
+	key.node.key = &key;
+	key.qname = qinfo->qname;
+	key.qname_len = qinfo->qname_len;
+	key.qtype = qinfo->qtype;
+	key.qclass = qinfo->qclass;
+	key.qflags = qflags&(BIT_RD|BIT_CD);
+	e = (struct refresh_entry*)rbtree_search(&r->queries, &key);
+	if(e) {
+		if(e->expire != ttl) {
+			/* the cached reply has been replaced */
+			(void)rbtree_delete(&r->due, e);
+			e->useful_after = (e->refreshed && ttl > e->expire)?
+				e->expire:0;
+			refresh_entry_schedule(r, e, ttl, prefetch_ttl, now);
+		}
+		if(e->useful_after && now >= e->useful_after) {
+			useful = 1;
+			e->useful_after = 0;
+		}
+		e->hits++;
+		refresh_lru_remove(r, e);
+		refresh_lru_front(r, e);
+		return useful;
+	}
+
+	if(r->queries.count >= r->max && r->lru_last)
+		refresh_entry_remove(r, r->lru_last);
+	e = (struct refresh_entry*)calloc(1, sizeof(*e));
+	if(!e)
+		return 0;
+	e->qname = memdup(qinfo->qname, qinfo->qname_len);
+	if(!e->qname) {
+		free(e);
+		return 0;
+	}
+	e->node.key = e;
+	e->qname_len = qinfo->qname_len;
+	e->qtype = qinfo->qtype;
+	e->qclass = qinfo->qclass;
+	e->qflags = key.qflags;
+	(void)rbtree_insert(&r->queries, &e->node);
+	r->mem += sizeof(*e) + e->qname_len;
+	refresh_entry_schedule(r, e, ttl, prefetch_ttl, now);
+	e->hits = 1;
+	refresh_lru_front(r, e);
+	return 0;
+}
+
+/** see if a is more popular than b, by hits per second */
+static int
+refresh_more_popular(struct refresh_entry* a, struct refresh_entry* b,
+	time_t now)
+{
+	return (uint64_t)a->hits * (uint64_t)(now - b->since + 1) >
+		(uint64_t)b->hits * (uint64_t)(now - a->since + 1);
+}
+
+/** add entry to the picks, that are sorted by popularity, if there is
+ * room or it is more popular than the least popular pick.
+ * @return the new number of picks. */
+static size_t
+refresh_pick_add(struct refresh_table* r, struct refresh_entry* e,
+	size_t num, size_t max, time_t now)
+{
+	size_t i;
+	if(num == max) {
+		if(!refresh_more_popular(e, r->pick[num-1], now))
+			return num;
+		num--;
+	}
+	i = num;
+	while(i > 0 && refresh_more_popular(e, r->pick[i-1], now)) {
+		r->pick[i] = r->pick[i-1];
+		i--;
+	}
+	r->pick[i] = e;
+	return num+1;
+}
+
+size_t
+refresh_select(struct refresh_table* r, time_t now)
+{
+	rbnode_type* n, *next;
+	struct refresh_entry* e;
+	size_t num = 0, max, i;
+
+	r->credit += r->rate * REFRESH_TICK_MSEC;
+	max = (size_t)(r->credit / 1000);
+	if(max > (size_t)r->rate)
+		max = (size_t)r->rate;
+	n = rbtree_first(&r->due);
+	while(n != RBTREE_NULL) {
+		e = (struct refresh_entry*)n->key;
+		if(e->due > now)
+			break;
+		next = rbtree_next(n);
+		/* entries that were not hit enough are not refreshed, and
+		 * are not scanned again every tick */
+		if(e->expire <= now || e->hits < REFRESH_MIN_HITS)
+			refresh_entry_remove(r, e);
+		else if(!e->refreshed && max > 0)
+			num = refresh_pick_add(r, e, num, max, now);
+		n = next;
+	}
+	for(i=0; i<num; i++) {
+		r->pick[i]->refreshed = 1;
+		/* it is scheduled again when the new reply is noted */
+		(void)rbtree_delete(&r->due, r->pick[i]);
+	}
+	/* save up less than one refresh for the next tick, so that the
+	 * rate is kept, also for small rates, and idle time is not saved */
+	r->credit -= (int)num * 1000;
+	if(r->credit > 999)
+		r->credit = 999;
+	return num;
+}
+
+size_t
+refresh_get_mem(struct refresh_table* r)
+{
+	if(!r)
+		return 0;
+	return r->mem;
+}
@@ -0,0 +1,177 @@
+/*
+ * services/cache/refresh.h - refresh of popular message cache entries.
+ *
+ * Copyright (c) 2026, NLnet Labs. All rights reserved.
+ *
+ * This software is open source.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 
+ * Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ * 
+ * Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ * 
+ * Neither the name of the NLNET LABS nor the names of its contributors may
+ * be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ * TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * \file
+ *
+ * This file keeps track of the popular entries in the message cache, so
+ * that they can be refreshed before they expire.  Prefetch only refreshes
+ * an entry when a client asks for it in the last part of its TTL; here the
+ * hits are counted and the most popular entries that are about to expire
+ * are picked for refresh, a few every tick.
+ */
+
+#ifndef SERVICES_CACHE_REFRESH_H
+#define SERVICES_CACHE_REFRESH_H
+#include "util/rbtree.h"
+struct query_info;
+struct ub_randstate;
+
+/** msec between refresh ticks, the refresh rate is spread over them */
+#define REFRESH_TICK_MSEC 200
+/** hits needed in the TTL of an entry before it is refreshed */
+#define REFRESH_MIN_HITS 2
+
+/**
+ * A message cache entry that has been hit by clients.
+ */
+struct refresh_entry {
+	/** node in the tree by query, key is this structure */
+	rbnode_type node;
+	/** node in the tree by refresh time, key is this structure */
+	rbnode_type due_node;
+	/** previous in the lru list, more recently hit */
+	struct refresh_entry* lru_prev;
+	/** next in the lru list, less recently hit */
+	struct refresh_entry* lru_next;
+	/** query name, malloced */
+	uint8_t* qname;
+	/** length of qname */
+	size_t qname_len;
+	/** query type, host order */
+	uint16_t qtype;
+	/** query class, host order */
+	uint16_t qclass;
+	/** query flags, RD and CD */
+	uint16_t qflags;
+	/** number of hits since the cached reply was stored */
+	unsigned int hits;
+	/** time the hits are counted from */
+	time_t since;
+	/** absolute time the cached reply expires */
+	time_t expire;
+	/** absolute time to refresh the reply, a jittered point before the
+	 * prefetch time */
+	time_t due;
+	/** if a refresh has been picked for this reply */
+	int refreshed;
+	/** if not 0, the expiry time of the reply that was refreshed; a hit
+	 * after that time was made possible by the refresh */
+	time_t useful_after;
+};
+
+/**
+ * The refresh table of a thread.
+ */
+struct refresh_table {
+	/** entries by query, of struct refresh_entry */
+	rbtree_type queries;
+	/** entries by due time, of struct refresh_entry */
+	rbtree_type due;
+	/** most recently hit entry */
+	struct refresh_entry* lru_first;
+	/** least recently hit entry, removed when the table is full */
+	struct refresh_entry* lru_last;
+	/** max number of entries */
+	size_t max;
+	/** max refreshes per second */
+	int rate;
+	/** refreshes per tick, times 1000, saved up from earlier ticks */
+	int credit;
+	/** random state for the jitter */
+	struct ub_randstate* rnd;
+	/** the entries picked by the last refresh_select, array of rate
+	 * elements */
+	struct refresh_entry** pick;
+	/** memory used by the table and the entries, in bytes */
+	size_t mem;
+};
+
+/**
+ * Create the refresh table.
+ * @param max: max number of entries to track.
+ * @param rate: max number of refreshes per second.
+ * @param rnd: random state, for the jitter.
+ * @return new table or NULL on alloc failure.
+ */
+struct refresh_table* refresh_create(size_t max, int rate,
+	struct ub_randstate* rnd);
+
+/**
+ * Delete the refresh table.
+ * @param r: the table, or NULL.
+ */
+void refresh_delete(struct refresh_table* r);
+
+/**
+ * Note a client hit of a message cache entry.
+ * @param r: the table.
+ * @param qinfo: the query name, type and class of the cache entry.
+ * @param qflags: the query flags, RD and CD are used.
+ * @param ttl: absolute expiry time of the cached reply.
+ * @param prefetch_ttl: absolute prefetch time of the cached reply.
+ * @param now: the current time.
+ * @return true if this hit is the first one after the time the reply
+ *	would have expired had it not been refreshed.
+ */
+int refresh_note(struct refresh_table* r, struct query_info* qinfo,
+	uint16_t qflags, time_t ttl, time_t prefetch_ttl, time_t now);
+
+/**
+ * Pick the entries to refresh for this tick.  Removes expired entries and
+ * the due entries with too few hits, and takes the most popular of the
+ * entries that are due, up to the rate for the tick.  The picked entries
+ * are marked as refreshed and leave the due tree, until the refreshed
+ * reply is noted.
+ * @param r: the table.
+ * @param now: the current time.
+ * @return number of entries in r->pick.
+ */
+size_t refresh_select(struct refresh_table* r, time_t now);
+
+/**
+ * Get memory used by the refresh table.
+ * @param r: the table.
+ * @return memory in bytes.
+ */
+size_t refresh_get_mem(struct refresh_table* r);
+
+/** compare refresh entries by query */
+int refresh_query_cmp(const void* k1, const void* k2);
+
+/** compare refresh entries by due time */
+int refresh_due_cmp(const void* k1, const void* k2);
+
+#endif /* SERVICES_CACHE_REFRESH_H */
@@ -40,11 +40,13 @@
  */
 #include "config.h"
 #include "services/cache/rrset.h"
+#include "services/cache/delegcache.h"
 #include "sldns/rrdef.h"
 #include "util/storage/slabhash.h"
 #include "util/config_file.h"
 #include "util/data/packed_rrset.h"
 #include "util/data/msgreply.h"
+#include "util/data/msgparse.h"
 #include "util/regional.h"
 #include "util/alloc.h"
 #include "util/net_help.h"
@@ -63,10 +65,23 @@ struct rrset_cache* rrset_cache_create(struct config_file* cfg,
 	size_t startarray = HASH_DEFAULT_STARTARRAY;
 	size_t maxmem = (cfg?cfg->rrset_cache_size:HASH_DEFAULT_MAXMEM);
 
-	struct rrset_cache *r = (struct rrset_cache*)slabhash_create(slabs,
-		startarray, maxmem, ub_rrset_sizefunc, ub_rrset_compare,
-		ub_rrset_key_delete, rrset_data_delete, alloc);
+	struct slabhash* table = slabhash_create(slabs, startarray, maxmem,
+		ub_rrset_sizefunc, ub_rrset_compare, ub_rrset_key_delete,
+		rrset_data_delete, alloc);
+	struct rrset_cache *r;
+	if(!table)
+		return NULL;
+	/* the table is first in struct, it is extended with the rest */
+	r = (struct rrset_cache*)realloc(table, sizeof(*r));
+	if(!r) {
+		slabhash_delete(table);
+		return NULL;
+	}
 	slabhash_setmarkdel(&r->table, &rrset_markdel);
+	if(!(r->cuts = deleg_cache_create(slabs))) {
+		slabhash_delete(&r->table);
+		return NULL;
+	}
 	return r;
 }
 
@@ -74,10 +89,19 @@ void rrset_cache_delete(struct rrset_cache* r)
 {
 	if(!r) 
 		return;
+	deleg_cache_delete(r->cuts);
 	slabhash_delete(&r->table);
 	/* slabhash delete also does free(r), since table is first in struct*/
 }
 
+void rrset_cache_clear(struct rrset_cache* r)
+{
+	if(!r)
+		return;
+	slabhash_clear(&r->table);
+	deleg_cache_clear(r->cuts);
+}
+
 struct rrset_cache* rrset_cache_adjust(struct rrset_cache *r, 
 	struct config_file* cfg, struct alloc_cache* alloc)
 {
@@ -165,6 +189,61 @@ need_to_update_rrset(void* nd, void* cd, time_t timenow, int equal, int ns)
 	return 0;
 }
 
+/**
+ * Carry the security status of a secure rrset in the cache over to the
+ * same rrset that replaces it, when it is fetched again for prefetch or
+ * serve-expired.  The rdata and signatures are equal, so if the
+ * signatures are still valid the validator does not need to check them
+ * again.  The TTL is reduced like the validator does, to the original TTL
+ * and the signature expiration.
+ * @param newd: the new rrset data, absolute TTLs, changed if carried.
+ * @param cached: the rrset data in the cache, locked.
+ * @param timenow: current time.
+ * @return true if the security status is carried over.
+ */
+static int
+rrset_carry_sec_status(struct packed_rrset_data* newd,
+	struct packed_rrset_data* cached, time_t timenow)
+{
+	uint32_t now = (uint32_t)timenow, origttl, expi, incep;
+	time_t until = 0;
+	size_t i;
+	if(cached->security != sec_status_secure ||
+		newd->security == sec_status_secure || newd->rrsig_count == 0)
+		return 0;
+	for(i=newd->count; i<newd->count+newd->rrsig_count; i++) {
+		time_t sigend;
+		/* rdlength, type covered, algorithm and labels, then
+		 * original TTL, expiration and inception */
+		if(newd->rr_len[i] < 2+16)
+			return 0;
+		memmove(&origttl, newd->rr_data[i]+2+4, sizeof(origttl));
+		memmove(&expi, newd->rr_data[i]+2+8, sizeof(expi));
+		memmove(&incep, newd->rr_data[i]+2+12, sizeof(incep));
+		origttl = ntohl(origttl);
+		expi = ntohl(expi);
+		incep = ntohl(incep);
+		/* serial number arithmetic, RFC 4034 section 3.1.5 */
+		if((int32_t)(now - incep) < 0 || (int32_t)(expi - now) <= 0)
+			return 0;
+		sigend = timenow + (time_t)(int32_t)(expi - now);
+		if((time_t)origttl < MIN_TTL)
+			origttl = (uint32_t)MIN_TTL;
+		if(sigend > timenow + (time_t)origttl)
+			sigend = timenow + (time_t)origttl;
+		if(until == 0 || sigend < until)
+			until = sigend;
+	}
+	newd->security = sec_status_secure;
+	newd->trust = cached->trust;
+	if(newd->ttl > until)
+		newd->ttl = until;
+	for(i=0; i<newd->count+newd->rrsig_count; i++)
+		if(newd->rr_ttl[i] > until)
+			newd->rr_ttl[i] = until;
+	return 1;
+}
+
 /** Update RRSet special key ID */
 static void
 rrset_update_id(struct rrset_ref* ref, struct alloc_cache* alloc)
@@ -181,6 +260,18 @@ rrset_update_id(struct rrset_ref* ref, struct alloc_cache* alloc)
 	lock_rw_unlock(&ref->key->entry.lock);
 }
 
+/** note the NS rrset of a zone cut in the delegation cache, ref is the
+ * rrset as it is stored in the cache */
+static void
+rrset_note_cut(struct rrset_cache* r, struct ub_packed_rrset_key* k,
+	struct rrset_ref* ref)
+{
+	if(k->rk.type != htons(LDNS_RR_TYPE_NS) || k->rk.flags != 0)
+		return;
+	deleg_cache_note(r->cuts, k->rk.dname, k->rk.dname_len,
+		ntohs(k->rk.rrset_class), ref);
+}
+
 int 
 rrset_cache_update(struct rrset_cache* r, struct rrset_ref* ref,
 	struct alloc_cache* alloc, time_t timenow)
@@ -189,7 +280,7 @@ rrset_cache_update(struct rrset_cache* r, struct rrset_ref* ref,
 	struct ub_packed_rrset_key* k = ref->key;
 	hashvalue_type h = k->entry.hash;
 	uint16_t rrset_type = ntohs(k->rk.type);
-	int equal = 0;
+	int equal = 0, carried = 0;
 	log_assert(ref->id != 0 && k->id != 0);
 	log_assert(k->rk.dname != NULL);
 	/* looks up item with a readlock - no editing! */
@@ -209,10 +300,15 @@ rrset_cache_update(struct rrset_cache* r, struct rrset_ref* ref,
 			equal, (rrset_type==LDNS_RR_TYPE_NS))) {
 			/* cache is superior, return that value */
 			lock_rw_unlock(&e->lock);
+			rrset_note_cut(r, k, ref);
 			ub_packed_rrset_parsedelete(k, alloc);
 			if(equal) return 2;
 			return 1;
 		}
+		if(equal)
+			carried = rrset_carry_sec_status((struct
+				packed_rrset_data*)k->entry.data,
+				(struct packed_rrset_data*)e->data, timenow);
 		lock_rw_unlock(&e->lock);
 		/* Go on and insert the passed item.
 		 * small gap here, where entry is not locked.
@@ -223,6 +319,8 @@ rrset_cache_update(struct rrset_cache* r, struct rrset_ref* ref,
 		 * cache size values nicely. */
 	}
 	log_assert(ref->key->id != 0);
+	/* before the insert, that can delete k if it is already stored */
+	rrset_note_cut(r, k, ref);
 	slabhash_insert(&r->table, h, &k->entry, k->entry.data, alloc);
 	if(e) {
 		/* For NSEC, NSEC3, DNAME, when rdata is updated, update 
@@ -233,6 +331,7 @@ rrset_cache_update(struct rrset_cache* r, struct rrset_ref* ref,
 			|| rrset_type == LDNS_RR_TYPE_DNAME) && !equal) {
 			rrset_update_id(ref, alloc);
 		}
+		if(carried) return 3;
 		return 1;
 	}
 	return 0;
@@ -303,6 +402,31 @@ rrset_cache_lookup(struct rrset_cache* r, uint8_t* qname, size_t qnamelen,
 	return NULL;
 }
 
+struct ub_packed_rrset_key*
+rrset_cache_lookup_cut(struct rrset_cache* r, uint8_t* qname, size_t qnamelen,
+	uint16_t qclass, int at_name, time_t timenow)
+{
+	struct ub_packed_rrset_key* rrset;
+	uint8_t lablen;
+	/* a cut at the name itself is found with one hash lookup */
+	if(at_name && (rrset = rrset_cache_lookup(r, qname, qnamelen,
+		LDNS_RR_TYPE_NS, qclass, 0, timenow, 0)))
+		return rrset;
+	if(deleg_cache_lookup(r->cuts, r, qname, qnamelen, qclass, timenow,
+		&rrset))
+		return rrset;
+	/* without the delegation cache, snip off labels until it is found */
+	while(qnamelen > 0) {
+		if((rrset = rrset_cache_lookup(r, qname, qnamelen,
+			LDNS_RR_TYPE_NS, qclass, 0, timenow, 0)))
+			return rrset;
+		lablen = *qname;
+		qname += lablen + 1;
+		qnamelen -= lablen + 1;
+	}
+	return NULL;
+}
+
 int 
 rrset_array_lock(struct rrset_ref* ref, size_t count, time_t timenow)
 {
@@ -431,6 +555,15 @@ rrset_check_sec_status(struct rrset_cache* r,
 					updata->rr_ttl[i] = 0;
 				else updata->rr_ttl[i] = 
 					cachedata->rr_ttl[i]-now;
+		} else if(cachedata->security == sec_status_secure) {
+			/* the cached TTL can be reduced to the signature
+			 * expiration, without the validator seeing it */
+			size_t i;
+			if(updata->ttl > cachedata->ttl - now)
+				updata->ttl = cachedata->ttl - now;
+			for(i=0; i<updata->count+updata->rrsig_count; i++)
+				if(updata->rr_ttl[i] > cachedata->ttl - now)
+					updata->rr_ttl[i] = cachedata->ttl - now;
 		}
 		if(cachedata->trust > updata->trust)
 			updata->trust = cachedata->trust;
@@ -48,14 +48,17 @@ struct config_file;
 struct alloc_cache;
 struct rrset_ref;
 struct regional;
+struct deleg_cache;
 
 /**
  * The rrset cache
- * Thin wrapper around hashtable, like a typedef.
+ * Thin wrapper around hashtable, with an index of the zone cuts.
  */
 struct rrset_cache {
 	/** uses partitioned hash table */
 	struct slabhash table;
+	/** the zone cuts, names with an NS rrset in the table */
+	struct deleg_cache* cuts;
 };
 
 /**
@@ -73,6 +76,13 @@ struct rrset_cache* rrset_cache_create(struct config_file* cfg,
  */
 void rrset_cache_delete(struct rrset_cache* r);
 
+/**
+ * Clear the rrset cache, and the delegation cache that refers to its
+ * rrsets.  Done before the rrset keys are freed or their ids recycled.
+ * @param r: rrset cache to clear.
+ */
+void rrset_cache_clear(struct rrset_cache* r);
+
 /**
  * Adjust settings of the cache to settings from the config file.
  * May purge the cache. May recreate the cache.
@@ -129,6 +139,9 @@ void rrset_cache_touch(struct rrset_cache* r, struct ub_packed_rrset_key* key,
  * 	1: reference updated, item is inserted in cache.
  * 	2: reference updated, item in cache is considered superior.
  *	   also the rdata is equal (but other parameters in cache are superior).
+ *	3: reference updated, item is inserted in cache.  The cached item
+ *	   was secure, and the rdata and signatures are equal and the
+ *	   signatures still valid, the security status is carried over.
  */
 int rrset_cache_update(struct rrset_cache* r, struct rrset_ref* ref, 
 	struct alloc_cache* alloc, time_t timenow);
@@ -169,6 +182,23 @@ struct ub_packed_rrset_key* rrset_cache_lookup(struct rrset_cache* r,
 	uint8_t* qname, size_t qnamelen, uint16_t qtype, uint16_t qclass,
 	uint32_t flags, time_t timenow, int wr);
 
+/**
+ * Lookup the NS rrset of the closest zone cut at or above the name.
+ * You obtain a readlock. You must unlock before lookup anything else.
+ * @param r: the rrset cache.
+ * @param qname: name to find the zone cut for.
+ * @param qnamelen: length of qname.
+ * @param qclass: class of rrset to lookup (host order).
+ * @param at_name: if the cut is likely at the name itself, it is looked up
+ *	first, without the delegation cache.
+ * @param timenow: used to compare with TTL.
+ * @return packed rrset key pointer. Remember to unlock the key.entry.lock.
+ * 	or NULL if no NS rrset could be found that has not timed out.
+ */
+struct ub_packed_rrset_key* rrset_cache_lookup_cut(struct rrset_cache* r,
+	uint8_t* qname, size_t qnamelen, uint16_t qclass, int at_name,
+	time_t timenow);
+
 /**
  * Obtain readlock on a (sorted) list of rrset references.
  * Checks TTLs and IDs of the rrsets and rollbacks locking if not Ok.
@@ -43,6 +43,7 @@
  * send back to clients.
  */
 #include "config.h"
+#include <sys/time.h>
 #include "services/mesh.h"
 #include "services/outbound_list.h"
 #include "services/cache/dns.h"
@@ -52,10 +53,12 @@
 #include "util/regional.h"
 #include "util/data/msgencode.h"
 #include "util/timehist.h"
+#include "util/tube.h"
 #include "util/fptr_wlist.h"
 #include "util/alloc.h"
 #include "util/config_file.h"
 #include "util/edns.h"
+#include "util/storage/slabhash.h"
 #include "sldns/sbuffer.h"
 #include "sldns/wire2str.h"
 #include "services/localzone.h"
@@ -225,25 +228,115 @@ mesh_state_ref_compare(const void* ap, const void* bp)
 	return mesh_state_compare(a->s, b->s);
 }
 
+int
+mesh_client_compare(const void* ap, const void* bp)
+{
+	struct mesh_client* a = (struct mesh_client*)ap;
+	struct mesh_client* b = (struct mesh_client*)bp;
+	return sockaddr_cmp_addr(&a->addr, a->addrlen, &b->addr, b->addrlen);
+}
+
+int
+mesh_client_num_compare(const void* ap, const void* bp)
+{
+	struct mesh_client* a = (struct mesh_client*)ap;
+	struct mesh_client* b = (struct mesh_client*)bp;
+	if(a->num != b->num)
+		return (a->num < b->num)?-1:1;
+	return mesh_client_compare(ap, bp);
+}
+
+const char*
+mesh_class_to_str(enum mesh_class c)
+{
+	switch(c) {
+	case mesh_class_client: return "client";
+	case mesh_class_prefetch: return "prefetch";
+	case mesh_class_internal: return "internal";
+	}
+	return "unknown";
+}
+
+int
+mesh_class_cfg_parse(const char* str, int* res)
+{
+	char* s = (char*)str, *e;
+	int i;
+	if(!str || cfg_count_numbers(str) != MESH_NUM_CLASSES)
+		return 0;
+	for(i=0; i<MESH_NUM_CLASSES; i++) {
+		res[i] = (int)strtol(s, &e, 10);
+		if(s == e || res[i] < 0)
+			return 0;
+		s = e;
+	}
+	return 1;
+}
+
 struct mesh_area* 
 mesh_create(struct module_stack* stack, struct module_env* env)
 {
+	int i, limit[MESH_NUM_CLASSES];
 	struct mesh_area* mesh = calloc(1, sizeof(struct mesh_area));
 	if(!mesh) {
 		log_err("mesh area alloc: out of memory");
 		return NULL;
 	}
+	if(!mesh_class_cfg_parse(env->cfg->mesh_class_weight,
+		mesh->class_weight)) {
+		log_err("cannot parse mesh-class-weight: \"%s\"",
+			env->cfg->mesh_class_weight);
+		free(mesh);
+		return NULL;
+	}
+	if(!mesh_class_cfg_parse(env->cfg->mesh_class_limit, limit)) {
+		log_err("cannot parse mesh-class-limit: \"%s\"",
+			env->cfg->mesh_class_limit);
+		free(mesh);
+		return NULL;
+	}
 	mesh->histogram = timehist_setup();
 	mesh->qbuf_bak = sldns_buffer_new(env->cfg->msg_buffer_size);
 	if(!mesh->histogram || !mesh->qbuf_bak) {
+		timehist_delete(mesh->histogram);
 		free(mesh);
 		log_err("mesh area alloc: out of memory");
 		return NULL;
 	}
+	mesh->trace_rate = (size_t)env->cfg->trace_sample_rate;
+	mesh->trace_slow_max.tv_sec = env->cfg->trace_slow_threshold / 1000;
+	mesh->trace_slow_max.tv_usec = (env->cfg->trace_slow_threshold % 1000)
+		* 1000;
+	if(mesh->trace_rate != 0) {
+		mesh->trace_slow = (struct mesh_trace_slow*)calloc(
+			MESH_TRACE_SLOW_MAX, sizeof(struct mesh_trace_slow));
+		if(!mesh->trace_slow) {
+			timehist_delete(mesh->histogram);
+			sldns_buffer_free(mesh->qbuf_bak);
+			free(mesh);
+			log_err("mesh area alloc: out of memory");
+			return NULL;
+		}
+	}
 	mesh->mods = *stack;
 	mesh->env = env;
-	rbtree_init(&mesh->run, &mesh_state_compare);
+	for(i=0; i<MESH_NUM_CLASSES; i++) {
+		rbtree_init(&mesh->run[i], &mesh_state_compare);
+		mesh->class_limit[i] = (size_t)limit[i];
+	}
 	rbtree_init(&mesh->all, &mesh_state_compare);
+	rbtree_init(&mesh->clients, &mesh_client_compare);
+	rbtree_init(&mesh->clients_num, &mesh_client_num_compare);
+	mesh->fair_share = env->cfg->mesh_fair_share;
+	mesh->fair_prefix4 = env->cfg->mesh_fair_share_prefix4;
+	mesh->fair_prefix6 = env->cfg->mesh_fair_share_prefix6;
+	lock_basic_init(&mesh->async_lock);
+	lock_protect(&mesh->async_lock, &mesh->async_first,
+		sizeof(mesh->async_first));
+	lock_protect(&mesh->async_lock, &mesh->async_last,
+		sizeof(mesh->async_last));
+	lock_protect(&mesh->async_lock, &mesh->async_signalled,
+		sizeof(mesh->async_signalled));
 	mesh->num_reply_addrs = 0;
 	mesh->num_reply_states = 0;
 	mesh->num_detached_states = 0;
@@ -260,6 +353,33 @@ mesh_create(struct module_stack* stack, struct module_env* env)
 	return mesh;
 }
 
+/** take the list of posted async items */
+static struct mesh_async*
+mesh_async_take(struct mesh_area* mesh)
+{
+	struct mesh_async* list;
+	lock_basic_lock(&mesh->async_lock);
+	list = mesh->async_first;
+	mesh->async_first = NULL;
+	mesh->async_last = NULL;
+	mesh->async_signalled = 0;
+	lock_basic_unlock(&mesh->async_lock);
+	return list;
+}
+
+/** free the posted async items, at mesh delete */
+static void
+mesh_async_clear(struct mesh_area* mesh)
+{
+	struct mesh_async* a = mesh_async_take(mesh), *n;
+	while(a) {
+		n = a->next;
+		fptr_ok(fptr_whitelist_mesh_async(a->cb));
+		(void)(*a->cb)(NULL, a);
+		a = n;
+	}
+}
+
 /** help mesh delete delete mesh states */
 static void
 mesh_delete_helper(rbnode_type* n)
@@ -281,20 +401,29 @@ mesh_delete(struct mesh_area* mesh)
 	/* free all query states */
 	while(mesh->all.count)
 		mesh_delete_helper(mesh->all.root);
+	/* the query states are gone, nothing is posted to us any more */
+	tube_delete(mesh->async_tube);
+	mesh_async_clear(mesh);
+	lock_basic_destroy(&mesh->async_lock);
 	timehist_delete(mesh->histogram);
 	sldns_buffer_free(mesh->qbuf_bak);
+	free(mesh->trace_slow);
 	free(mesh);
 }
 
 void
 mesh_delete_all(struct mesh_area* mesh)
 {
+	int i;
 	/* free all query states */
 	while(mesh->all.count)
 		mesh_delete_helper(mesh->all.root);
 	mesh->stats_dropped += mesh->num_reply_addrs;
 	/* clear mesh area references */
-	rbtree_init(&mesh->run, &mesh_state_compare);
+	for(i=0; i<MESH_NUM_CLASSES; i++) {
+		rbtree_init(&mesh->run[i], &mesh_state_compare);
+		mesh->class_num[i] = 0;
+	}
 	rbtree_init(&mesh->all, &mesh_state_compare);
 	mesh->num_reply_addrs = 0;
 	mesh->num_reply_states = 0;
@@ -306,6 +435,369 @@ mesh_delete_all(struct mesh_area* mesh)
 	mesh->jostle_last = NULL;
 }
 
+const char*
+mesh_trace_type_to_str(enum mesh_trace_type t)
+{
+	switch(t) {
+	case mesh_trace_module: return "module";
+	case mesh_trace_module_exit: return "exit";
+	case mesh_trace_send: return "send";
+	case mesh_trace_reply: return "reply";
+	case mesh_trace_cache: return "cache";
+	}
+	return "unknown";
+}
+
+void
+mesh_trace_bucket_lower(int i, struct timeval* tv)
+{
+	long ms = (i == 0)?0:(1L<<(i-1));
+#ifndef S_SPLINT_S
+	tv->tv_sec = (time_t)(ms / 1000);
+	tv->tv_usec = (suseconds_t)((ms % 1000) * 1000);
+#endif
+}
+
+/** get the current time for a trace, the event time is not precise enough */
+static void
+mesh_trace_now(struct mesh_area* mesh, struct timeval* now)
+{
+	if(gettimeofday(now, NULL) < 0)
+		*now = *mesh->env->now_tv;
+}
+
+/** add an event to the trace */
+static void
+mesh_trace_add(struct mesh_trace* t, enum mesh_trace_type type, int module,
+	int arg, struct timeval* now)
+{
+	if(t->num < MESH_TRACE_MAX) {
+		struct mesh_trace_event* e = &t->ev[t->num];
+		e->tv = *now;
+		e->type = type;
+		e->module = module;
+		e->arg = arg;
+	}
+	t->num++;
+}
+
+/** account the time of the module that had control, and switch to module */
+static void
+mesh_trace_switch(struct mesh_trace* t, int module, struct timeval* now)
+{
+	if(t->cur_mod != -1) {
+		struct timeval d;
+		timeval_subtract(&d, now, &t->cur_start);
+		timeval_add(&t->mod_time[t->cur_mod], &d);
+	}
+	t->cur_mod = module;
+	t->cur_start = *now;
+	if(module != -1)
+		t->mod_used |= (1u<<module);
+}
+
+/** start the trace of the state, if it is picked by the sample rate */
+static void
+mesh_trace_sample(struct mesh_area* mesh, struct mesh_state* m)
+{
+	if(mesh->trace_rate == 0 || ++mesh->trace_count < mesh->trace_rate)
+		return;
+	mesh->trace_count = 0;
+	m->trace = (struct mesh_trace*)regional_alloc_zero(m->s.region,
+		sizeof(*m->trace));
+	if(!m->trace)
+		return;
+	m->trace->cur_mod = -1;
+	mesh_trace_now(mesh, &m->trace->start);
+}
+
+void
+mesh_trace_event(struct module_qstate* qstate, enum mesh_trace_type type,
+	int arg)
+{
+	struct timeval now;
+	struct mesh_trace* t = qstate->mesh_info->trace;
+	log_assert(t);
+	mesh_trace_now(qstate->env->mesh, &now);
+	mesh_trace_add(t, type, qstate->curmod, arg, &now);
+}
+
+/** the trace of the state is complete, add it to the stats */
+static void
+mesh_trace_finish(struct mesh_area* mesh, struct mesh_state* m)
+{
+	struct mesh_trace* t = m->trace;
+	struct timeval total;
+	int i, b;
+	mesh_trace_now(mesh, &t->end);
+	mesh_trace_switch(t, -1, &t->end);
+	mesh->trace_num++;
+	for(i=0; i<mesh->mods.num && i<MAX_MODULE; i++) {
+		long ms;
+		if(!(t->mod_used & (1u<<i)))
+			continue;
+		mesh->trace_mod_num[i]++;
+		timeval_add(&mesh->trace_mod_sum[i], &t->mod_time[i]);
+		ms = (long)t->mod_time[i].tv_sec*1000 +
+			(long)t->mod_time[i].tv_usec/1000;
+		for(b=0; ms && b<MESH_TRACE_BUCKETS-1; b++)
+			ms >>= 1;
+		mesh->trace_mod_hist[i][b]++;
+	}
+	timeval_subtract(&total, &t->end, &t->start);
+	if(timeval_smaller(&total, &mesh->trace_slow_max))
+		return;
+	mesh->trace_num_slow++;
+	if(mesh->trace_slow) {
+		struct mesh_trace_slow* s = &mesh->trace_slow[
+			mesh->trace_slow_pos];
+		log_assert(m->s.qinfo.qname_len <= sizeof(s->qname));
+		memmove(s->qname, m->s.qinfo.qname, m->s.qinfo.qname_len);
+		s->qname_len = m->s.qinfo.qname_len;
+		s->qtype = m->s.qinfo.qtype;
+		s->qclass = m->s.qinfo.qclass;
+		s->trace = *t;
+		mesh->trace_slow_pos = (mesh->trace_slow_pos+1)%
+			MESH_TRACE_SLOW_MAX;
+		if(mesh->trace_slow_num < MESH_TRACE_SLOW_MAX)
+			mesh->trace_slow_num++;
+	}
+}
+
+/** see if the limit of states for a scheduling class is reached */
+static int
+mesh_class_full(struct mesh_area* mesh, enum mesh_class c)
+{
+	return mesh->class_limit[c] != 0 &&
+		mesh->class_num[c] >= mesh->class_limit[c];
+}
+
+/** make the state runnable */
+static void
+mesh_run_insert(struct mesh_area* mesh, struct mesh_state* m)
+{
+	(void)rbtree_insert(&mesh->run[m->sched_class], &m->run_node);
+}
+
+/**
+ * Pick the next runnable state.  The classes are picked with smooth
+ * weighted round robin, classes with weight 0 only when no other class
+ * has work.  Inside the class a random element is picked.
+ * @param mesh: the mesh area.
+ * @return the state, removed from the runnable set, or NULL if none.
+ */
+static struct mesh_state*
+mesh_run_pop(struct mesh_area* mesh)
+{
+	struct mesh_state* m;
+	int i, best = -1, total = 0;
+	for(i=0; i<MESH_NUM_CLASSES; i++) {
+		if(mesh->run[i].count == 0 || mesh->class_weight[i] == 0)
+			continue;
+		mesh->class_credit[i] += mesh->class_weight[i];
+		total += mesh->class_weight[i];
+		if(best == -1 || mesh->class_credit[i] >
+			mesh->class_credit[best])
+			best = i;
+	}
+	if(best != -1) {
+		mesh->class_credit[best] -= total;
+	} else {
+		for(i=0; i<MESH_NUM_CLASSES; i++) {
+			if(mesh->run[i].count != 0) {
+				best = i;
+				break;
+			}
+		}
+		if(best == -1)
+			return NULL;
+	}
+	m = (struct mesh_state*)mesh->run[best].root->key;
+	(void)rbtree_delete(&mesh->run[best], m);
+	return m;
+}
+
+void
+mesh_state_set_class(struct mesh_area* mesh, struct mesh_state* m,
+	enum mesh_class c)
+{
+	if(m->sched_class == c)
+		return;
+	if(rbtree_delete(&mesh->run[m->sched_class], m))
+		(void)rbtree_insert(&mesh->run[c], &m->run_node);
+	log_assert(mesh->class_num[m->sched_class] > 0);
+	mesh->class_num[m->sched_class]--;
+	mesh->class_num[c]++;
+	m->sched_class = c;
+}
+
+/** raise the priority of the state, and of the states it waits for */
+static void
+mesh_state_promote(struct mesh_area* mesh, struct mesh_state* m,
+	enum mesh_class c, size_t* count)
+{
+	struct mesh_state_ref* ref;
+	if(m->sched_class <= c || (*count)++ > MESH_MAX_SUBSUB)
+		return;
+	mesh_state_set_class(mesh, m, c);
+	RBTREE_FOR(ref, struct mesh_state_ref*, &m->sub_set) {
+		mesh_state_promote(mesh, ref->s, c, count);
+	}
+}
+
+/** set the client key to the prefix of the address */
+static void
+mesh_client_key(struct mesh_area* mesh, struct mesh_client* key,
+	struct sockaddr_storage* addr, socklen_t addrlen)
+{
+	memset(&key->addr, 0, sizeof(key->addr));
+	memmove(&key->addr, addr, addrlen);
+	key->addrlen = addrlen;
+	addr_mask(&key->addr, addrlen, addr_is_ip6(addr, addrlen)?
+		mesh->fair_prefix6:mesh->fair_prefix4);
+	key->node.key = key;
+	key->num_node.key = key;
+}
+
+/** find the client entry for the address, or NULL */
+static struct mesh_client*
+mesh_client_lookup(struct mesh_area* mesh, struct sockaddr_storage* addr,
+	socklen_t addrlen)
+{
+	struct mesh_client key;
+	mesh_client_key(mesh, &key, addr, addrlen);
+	return (struct mesh_client*)rbtree_search(&mesh->clients, &key);
+}
+
+/** charge the reply to its client prefix */
+static void
+mesh_client_charge(struct mesh_area* mesh, struct mesh_reply* r)
+{
+	struct mesh_client* cl = mesh_client_lookup(mesh,
+		&r->query_reply.addr, r->query_reply.addrlen);
+	if(!cl) {
+		cl = (struct mesh_client*)calloc(1, sizeof(*cl));
+		if(!cl)
+			return; /* the reply is not accounted */
+		mesh_client_key(mesh, cl, &r->query_reply.addr,
+			r->query_reply.addrlen);
+		(void)rbtree_insert(&mesh->clients, &cl->node);
+	} else	(void)rbtree_delete(&mesh->clients_num, cl);
+	r->client = cl;
+	r->client_next = NULL;
+	r->client_prev = cl->last;
+	if(cl->last)
+		cl->last->client_next = r;
+	else	cl->first = r;
+	cl->last = r;
+	cl->num++;
+	(void)rbtree_insert(&mesh->clients_num, &cl->num_node);
+}
+
+/** release the charge of the reply from its client prefix, the reply
+ * is answered or removed */
+static void
+mesh_client_release(struct mesh_area* mesh, struct mesh_reply* r)
+{
+	struct mesh_client* cl = r->client;
+	if(!cl)
+		return;
+	if(r->client_prev)
+		r->client_prev->client_next = r->client_next;
+	else	cl->first = r->client_next;
+	if(r->client_next)
+		r->client_next->client_prev = r->client_prev;
+	else	cl->last = r->client_prev;
+	r->client = NULL;
+	log_assert(cl->num > 0);
+	(void)rbtree_delete(&mesh->clients_num, cl);
+	if(--cl->num == 0) {
+		(void)rbtree_delete(&mesh->clients, cl);
+		free(cl);
+	} else	(void)rbtree_insert(&mesh->clients_num, &cl->num_node);
+}
+
+/** see if all the replies of the state are of the client */
+static int
+mesh_state_only_client(struct mesh_state* m, struct mesh_client* cl)
+{
+	struct mesh_reply* r;
+	for(r = m->reply_list; r; r = r->next) {
+		if(r->client != cl)
+			return 0;
+	}
+	return 1;
+}
+
+/** delete a reply state to make space, the supers get servfail */
+static void
+mesh_state_evict(struct mesh_area* mesh, struct mesh_state* m,
+	sldns_buffer* qbuf)
+{
+	/* backup the query */
+	if(qbuf) sldns_buffer_copy(mesh->qbuf_bak, qbuf);
+	/* notify supers */
+	if(m->super_set.count > 0) {
+		verbose(VERB_ALGO, "notify supers of failure");
+		m->s.return_msg = NULL;
+		m->s.return_rcode = LDNS_RCODE_SERVFAIL;
+		mesh_walk_supers(mesh, m);
+	}
+	mesh_state_delete(&m->s);
+	/* restore the query - note that the qinfo ptr to
+	 * the querybuffer is then correct again. */
+	if(qbuf) sldns_buffer_copy(qbuf, mesh->qbuf_bak);
+}
+
+/**
+ * Make space in a full mesh by fair share. A client under its share of
+ * the waiting replies may take the oldest state of the client that is
+ * furthest over its share. A client at its share is not admitted.
+ * @param mesh: the mesh area.
+ * @param rep: the reply of the new query.
+ * @return false if the query cannot be admitted.
+ */
+static int
+mesh_fair_make_space(struct mesh_area* mesh, struct comm_reply* rep)
+{
+	struct mesh_client* cl, *big;
+	rbnode_type* n;
+	struct mesh_reply* r;
+	struct mesh_state* m = NULL;
+	size_t share;
+	if(mesh->num_reply_states < mesh->max_reply_states)
+		return 1;
+	cl = mesh_client_lookup(mesh, &rep->addr, rep->addrlen);
+	share = mesh->max_reply_states / (mesh->clients.count + (cl?0:1));
+	if(share == 0)
+		share = 1;
+	if(cl && cl->num >= share) {
+		mesh->stats_fair_dropped++;
+		return 0;
+	}
+	/* the client with the most replies */
+	n = rbtree_last(&mesh->clients_num);
+	if(n == RBTREE_NULL)
+		return mesh_make_new_space(mesh, rep->c->buffer);
+	big = (struct mesh_client*)n->key;
+	if(big->num <= share)
+		return mesh_make_new_space(mesh, rep->c->buffer);
+	/* the oldest state that only has replies of the big client */
+	for(r = big->first; r; r = r->client_next) {
+		m = r->mstate;
+		if(!m->cb_list && mesh_state_only_client(m, big))
+			break;
+	}
+	if(!r)
+		return mesh_make_new_space(mesh, rep->c->buffer);
+	log_nametypeclass(VERB_ALGO, "query of client over its share "
+		"removed to make space for a new one", m->s.qinfo.qname,
+		m->s.qinfo.qtype, m->s.qinfo.qclass);
+	mesh->stats_fair_evicted++;
+	mesh_state_evict(mesh, m, rep->c->buffer);
+	return 1;
+}
+
 int mesh_make_new_space(struct mesh_area* mesh, sldns_buffer* qbuf)
 {
 	struct mesh_state* m = mesh->jostle_first;
@@ -324,20 +816,8 @@ int mesh_make_new_space(struct mesh_area* mesh, sldns_buffer* qbuf)
 				"make space for a new one",
 				m->s.qinfo.qname, m->s.qinfo.qtype,
 				m->s.qinfo.qclass);
-			/* backup the query */
-			if(qbuf) sldns_buffer_copy(mesh->qbuf_bak, qbuf);
-			/* notify supers */
-			if(m->super_set.count > 0) {
-				verbose(VERB_ALGO, "notify supers of failure");
-				m->s.return_msg = NULL;
-				m->s.return_rcode = LDNS_RCODE_SERVFAIL;
-				mesh_walk_supers(mesh, m);
-			}
 			mesh->stats_jostled ++;
-			mesh_state_delete(&m->s);
-			/* restore the query - note that the qinfo ptr to
-			 * the querybuffer is then correct again. */
-			if(qbuf) sldns_buffer_copy(qbuf, mesh->qbuf_bak);
+			mesh_state_evict(mesh, m, qbuf);
 			return 1;
 		}
 	}
@@ -345,6 +825,132 @@ int mesh_make_new_space(struct mesh_area* mesh, sldns_buffer* qbuf)
 	return 0;
 }
 
+static void mesh_send_reply(struct mesh_state* m, int rcode,
+	struct reply_info* rep, struct mesh_reply* r,
+	struct sldns_buffer* r_buffer, struct mesh_reply* prev,
+	struct sldns_buffer* prev_buffer);
+
+/** see if the message cache has an entry for the query of the state, that
+ * can be served expired */
+static int
+mesh_serve_expired_cached(struct mesh_state* m)
+{
+	struct module_env* env = m->s.env;
+	struct lruhash_entry* e;
+	if(m->s.client_info)
+		return 0;
+	e = slabhash_lookup(env->msg_cache, query_info_hash(&m->s.qinfo,
+		m->s.query_flags), &m->s.qinfo, 0);
+	if(!e)
+		return 0;
+	lock_rw_unlock(&e->lock);
+	return 1;
+}
+
+/** set the serve-expired client timer of the mesh state */
+static void
+mesh_serve_expired_arm(struct mesh_area* mesh, struct mesh_state* s)
+{
+	struct timeval tv;
+	int msec = mesh->env->cfg->serve_expired_client_timeout;
+	/* the timer is only needed if there is an answer to serve when it
+	 * fires, the resolution itself stores the answer */
+	if(!mesh_serve_expired_cached(s))
+		return;
+	if(!s->serve_expired_timer) {
+		s->serve_expired_timer = comm_timer_create(
+			mesh->env->worker_base, mesh_serve_expired_callback, s);
+		if(!s->serve_expired_timer) {
+			log_err("mesh_new_client: out of memory for the serve "
+				"expired timer");
+			return;
+		}
+	}
+#ifndef S_SPLINT_S
+	tv.tv_sec = msec/1000;
+	tv.tv_usec = (msec%1000)*1000;
+#endif
+	comm_timer_set(s->serve_expired_timer, &tv);
+}
+
+/** lookup the expired answer for the mesh state in the message cache.
+ * @return the message, with TTL 0 for the expired rrsets, allocated in the
+ *	state region, or NULL if there is no usable answer. */
+static struct dns_msg*
+mesh_serve_expired_lookup(struct mesh_state* m)
+{
+	struct module_env* env = m->s.env;
+	struct lruhash_entry* e;
+	struct dns_msg* msg;
+	int must_validate = (!(m->s.query_flags&BIT_CD) ||
+		env->cfg->ignore_cd) && env->need_to_validate;
+	/* response-ip actions are applied by the respip module, that the
+	 * expired answer does not pass through */
+	if(m->s.client_info)
+		return NULL;
+	e = slabhash_lookup(env->msg_cache, query_info_hash(&m->s.qinfo,
+		m->s.query_flags), &m->s.qinfo, 0);
+	if(!e)
+		return NULL;
+	msg = tomsg(env, &((struct msgreply_entry*)e->key)->key,
+		(struct reply_info*)e->data, m->s.region, *env->now, 1,
+		env->scratch);
+	lock_rw_unlock(&e->lock);
+	if(!msg)
+		return NULL;
+	if(must_validate && (msg->rep->security <= sec_status_bogus ||
+		msg->rep->security == sec_status_unchecked ||
+		msg->rep->security == sec_status_secure_sentinel_fail)) {
+		verbose(VERB_ALGO, "serve expired: cached answer is not "
+			"validated");
+		return NULL;
+	}
+	return msg;
+}
+
+void
+mesh_serve_expired_callback(void* arg)
+{
+	struct mesh_state* m = (struct mesh_state*)arg;
+	struct mesh_area* mesh = m->s.env->mesh;
+	struct mesh_reply* r;
+	struct mesh_reply* prev = NULL;
+	struct sldns_buffer* prev_buffer = NULL;
+	struct dns_msg* msg;
+	if(!m->reply_list || m->replies_sent || m->s.is_drop)
+		return;
+	if(!(msg = mesh_serve_expired_lookup(m))) {
+		log_query_info(VERB_ALGO, "serve expired: client timeout, "
+			"no expired answer for", &m->s.qinfo);
+		return;
+	}
+	log_query_info(VERB_ALGO, "serve expired: client timeout, "
+		"expired answer for", &m->s.qinfo);
+	for(r = m->reply_list; r; r = r->next) {
+		struct sldns_buffer* r_buffer = r->query_reply.c->buffer;
+		if(r->query_reply.c->tcp_req_info)
+			r_buffer = r->query_reply.c->tcp_req_info->spool_buffer;
+		mesh_send_reply(m, LDNS_RCODE_NOERROR, msg->rep, r, r_buffer,
+			prev, prev_buffer);
+		if(r->query_reply.c->tcp_req_info)
+			tcp_req_info_remove_mesh_state(
+				r->query_reply.c->tcp_req_info, m);
+		mesh_client_release(mesh, r);
+		mesh->ans_expired++;
+		prev = r;
+		prev_buffer = r_buffer;
+	}
+	/* the clients have their answer, the state continues without them
+	 * and stores the fresh answer in the cache */
+	m->reply_list = NULL;
+	if(!m->cb_list) {
+		log_assert(mesh->num_reply_states > 0);
+		mesh->num_reply_states--;
+		if(m->super_set.count == 0)
+			mesh->num_detached_states++;
+	}
+}
+
 void mesh_new_client(struct mesh_area* mesh, struct query_info* qinfo,
 	struct respip_client_info* cinfo, uint16_t qflags,
 	struct edns_data* edns, struct comm_reply* rep, uint16_t qid)
@@ -353,18 +959,28 @@ void mesh_new_client(struct mesh_area* mesh, struct query_info* qinfo,
 	int unique = unique_mesh_state(edns->opt_list, mesh->env);
 	int was_detached = 0;
 	int was_noreply = 0;
+	int arm_serve_expired = 0;
 	int added = 0;
 	if(!unique)
 		s = mesh_area_find(mesh, cinfo, qinfo, qflags&(BIT_RD|BIT_CD), 0, 0);
 	/* does this create a new reply state? */
 	if(!s || s->list_select == mesh_no_list) {
-		if(!mesh_make_new_space(mesh, rep->c->buffer)) {
+		if(!(mesh->fair_share?mesh_fair_make_space(mesh, rep):
+			mesh_make_new_space(mesh, rep->c->buffer))) {
 			verbose(VERB_ALGO, "Too many queries. dropping "
 				"incoming query.");
 			comm_point_drop_reply(rep);
 			mesh->stats_dropped ++;
 			return;
 		}
+		if(!s && mesh_class_full(mesh, mesh_class_client)) {
+			verbose(VERB_ALGO, "Too many client queries. dropping "
+				"incoming query.");
+			comm_point_drop_reply(rep);
+			mesh->class_dropped[mesh_class_client]++;
+			mesh->stats_dropped ++;
+			return;
+		}
 		/* for this new reply state, the reply address is free,
 		 * so the limit of reply addresses does not stop reply states*/
 	} else {
@@ -419,14 +1035,21 @@ void mesh_new_client(struct mesh_area* mesh, struct query_info* qinfo,
 #endif
 		rbtree_insert(&mesh->all, &s->node);
 		log_assert(n != NULL);
+		mesh->class_num[s->sched_class]++;
+		mesh_trace_sample(mesh, s);
 		/* set detached (it is now) */
 		mesh->num_detached_states++;
 		added = 1;
+	} else if(s->sched_class != mesh_class_client) {
+		size_t count = 0;
+		mesh_state_promote(mesh, s, mesh_class_client, &count);
 	}
 	if(!s->reply_list && !s->cb_list && s->super_set.count == 0)
 		was_detached = 1;
 	if(!s->reply_list && !s->cb_list)
 		was_noreply = 1;
+	if(!s->reply_list)
+		arm_serve_expired = 1;
 	/* add reply to s */
 	if(!mesh_state_add_reply(s, edns, rep, qid, qflags, qinfo)) {
 			log_err("mesh_new_client: out of memory; SERVFAIL");
@@ -469,6 +1092,9 @@ void mesh_new_client(struct mesh_area* mesh, struct query_info* qinfo,
 			s->list_select = mesh_jostle_list;
 		}
 	}
+	if(arm_serve_expired && mesh->env->cfg->serve_expired &&
+		mesh->env->cfg->serve_expired_client_timeout > 0)
+		mesh_serve_expired_arm(mesh, s);
 	if(added)
 		mesh_run(mesh, s, module_event_new, NULL);
 }
@@ -514,9 +1140,14 @@ mesh_new_callback(struct mesh_area* mesh, struct query_info* qinfo,
 #endif
 		rbtree_insert(&mesh->all, &s->node);
 		log_assert(n != NULL);
+		mesh->class_num[s->sched_class]++;
+		mesh_trace_sample(mesh, s);
 		/* set detached (it is now) */
 		mesh->num_detached_states++;
 		added = 1;
+	} else if(s->sched_class != mesh_class_client) {
+		size_t count = 0;
+		mesh_state_promote(mesh, s, mesh_class_client, &count);
 	}
 	if(!s->reply_list && !s->cb_list && s->super_set.count == 0)
 		was_detached = 1;
@@ -543,21 +1174,30 @@ mesh_new_callback(struct mesh_area* mesh, struct query_info* qinfo,
 }
 
 static void mesh_schedule_prefetch(struct mesh_area* mesh,
-	struct query_info* qinfo, uint16_t qflags, time_t leeway, int run);
+	struct query_info* qinfo, uint16_t qflags, time_t leeway, int run,
+	int refresh);
 
 void mesh_new_prefetch(struct mesh_area* mesh, struct query_info* qinfo,
         uint16_t qflags, time_t leeway)
 {
-	mesh_schedule_prefetch(mesh, qinfo, qflags, leeway, 1);
+	mesh_schedule_prefetch(mesh, qinfo, qflags, leeway, 1, 0);
+}
+
+void mesh_new_refresh(struct mesh_area* mesh, struct query_info* qinfo,
+        uint16_t qflags, time_t leeway)
+{
+	mesh_schedule_prefetch(mesh, qinfo, qflags, leeway, 1, 1);
 }
 
 /* Internal backend routine of mesh_new_prefetch().  It takes one additional
  * parameter, 'run', which controls whether to run the prefetch state
  * immediately.  When this function is called internally 'run' could be
  * 0 (false), in which case the new state is only made runnable so it
- * will not be run recursively on top of the current state. */
+ * will not be run recursively on top of the current state.  With
+ * 'refresh' the new state is marked as a refresh of a popular entry. */
 static void mesh_schedule_prefetch(struct mesh_area* mesh,
-	struct query_info* qinfo, uint16_t qflags, time_t leeway, int run)
+	struct query_info* qinfo, uint16_t qflags, time_t leeway, int run,
+	int refresh)
 {
 	struct mesh_state* s = mesh_area_find(mesh, NULL, qinfo,
 		qflags&(BIT_RD|BIT_CD), 0, 0);
@@ -579,6 +1219,12 @@ static void mesh_schedule_prefetch(struct mesh_area* mesh,
 		mesh->stats_dropped ++;
 		return;
 	}
+	if(mesh_class_full(mesh, mesh_class_prefetch)) {
+		verbose(VERB_ALGO, "Too many prefetch queries. dropped "
+			"prefetch.");
+		mesh->class_dropped[mesh_class_prefetch]++;
+		return;
+	}
 
 	s = mesh_state_create(mesh->env, qinfo, NULL,
 		qflags&(BIT_RD|BIT_CD), 0, 0);
@@ -586,6 +1232,8 @@ static void mesh_schedule_prefetch(struct mesh_area* mesh,
 		log_err("prefetch mesh_state_create: out of memory");
 		return;
 	}
+	s->sched_class = mesh_class_prefetch;
+	s->refresh = refresh;
 #ifdef UNBOUND_DEBUG
 	n =
 #else
@@ -593,6 +1241,7 @@ static void mesh_schedule_prefetch(struct mesh_area* mesh,
 #endif
 	rbtree_insert(&mesh->all, &s->node);
 	log_assert(n != NULL);
+	mesh->class_num[s->sched_class]++;
 	/* set detached (it is now) */
 	mesh->num_detached_states++;
 	/* make it ignore the cache */
@@ -619,7 +1268,7 @@ static void mesh_schedule_prefetch(struct mesh_area* mesh,
 #else
 		(void)
 #endif
-		rbtree_insert(&mesh->run, &s->run_node);
+		rbtree_insert(&mesh->run[s->sched_class], &s->run_node);
 		log_assert(n != NULL);
 		return;
 	}
@@ -631,6 +1280,8 @@ void mesh_report_reply(struct mesh_area* mesh, struct outbound_entry* e,
         struct comm_reply* reply, int what)
 {
 	enum module_ev event = module_event_reply;
+	if(e->qstate->mesh_info->trace)
+		mesh_trace_event(e->qstate, mesh_trace_reply, what);
 	e->qstate->reply = reply;
 	if(what != NETEVENT_NOERROR) {
 		event = module_event_noreply;
@@ -668,6 +1319,11 @@ mesh_state_create(struct module_env* env, struct query_info* qinfo,
 	rbtree_init(&mstate->sub_set, &mesh_state_ref_compare);
 	mstate->num_activated = 0;
 	mstate->unique = NULL;
+	mstate->sched_class = mesh_class_client;
+	mstate->start_time = *env->now_tv;
+	mstate->trace = NULL;
+	mstate->serve_expired_timer = NULL;
+	mstate->refresh = 0;
 	/* init module qstate */
 	mstate->s.qinfo.qtype = qinfo->qtype;
 	mstate->s.qinfo.qclass = qinfo->qclass;
@@ -738,6 +1394,12 @@ mesh_state_cleanup(struct mesh_state* mstate)
 	if(!mstate)
 		return;
 	mesh = mstate->s.env->mesh;
+	comm_timer_delete(mstate->serve_expired_timer);
+	if(mesh->fair_share) {
+		struct mesh_reply* rep;
+		for(rep = mstate->reply_list; rep; rep = rep->next)
+			mesh_client_release(mesh, rep);
+	}
 	/* drop unsent replies */
 	if(!mstate->replies_sent) {
 		struct mesh_reply* rep = mstate->reply_list;
@@ -802,8 +1464,18 @@ mesh_state_delete(struct module_qstate* qstate)
 	RBTREE_FOR(super, struct mesh_state_ref*, &mstate->super_set) {
 		(void)rbtree_delete(&super->s->sub_set, &ref);
 	}
-	(void)rbtree_delete(&mesh->run, mstate);
-	(void)rbtree_delete(&mesh->all, mstate);
+	(void)rbtree_delete(&mesh->run[mstate->sched_class], mstate);
+	if(rbtree_delete(&mesh->all, mstate)) {
+		struct timeval wait;
+		log_assert(mesh->class_num[mstate->sched_class] > 0);
+		mesh->class_num[mstate->sched_class]--;
+		mesh->class_done[mstate->sched_class]++;
+		timeval_subtract(&wait, mesh->env->now_tv,
+			&mstate->start_time);
+		timeval_add(&mesh->class_sum_wait[mstate->sched_class], &wait);
+		if(mstate->trace)
+			mesh_trace_finish(mesh, mstate);
+	}
 	mesh_state_cleanup(mstate);
 }
 
@@ -864,9 +1536,16 @@ void mesh_detach_subs(struct module_qstate* qstate)
 	rbtree_init(&qstate->mesh_info->sub_set, &mesh_state_ref_compare);
 }
 
-int mesh_add_sub(struct module_qstate* qstate, struct query_info* qinfo,
+/**
+ * Find or create a subquery state.  Like mesh_add_sub.
+ * @param c: scheduling class for a newly created state.
+ * 	If it is the internal class, the class limit applies.
+ * other params and return value like mesh_add_sub.
+ */
+static int
+mesh_find_or_add_sub(struct module_qstate* qstate, struct query_info* qinfo,
         uint16_t qflags, int prime, int valrec, struct module_qstate** newq,
-	struct mesh_state** sub)
+	struct mesh_state** sub, enum mesh_class c)
 {
 	/* find it, if not, create it */
 	struct mesh_area* mesh = qstate->env->mesh;
@@ -880,6 +1559,14 @@ int mesh_add_sub(struct module_qstate* qstate, struct query_info* qinfo,
 #ifdef UNBOUND_DEBUG
 		struct rbnode_type* n;
 #endif
+		if(c == mesh_class_internal &&
+			mesh_class_full(mesh, mesh_class_internal)) {
+			verbose(VERB_ALGO, "Too many internal queries. "
+				"dropped subquery.");
+			mesh->class_dropped[mesh_class_internal]++;
+			*newq = NULL;
+			return 1;
+		}
 		/* create a new one */
 		*sub = mesh_state_create(qstate->env, qinfo, NULL, qflags, prime,
 			valrec);
@@ -887,6 +1574,8 @@ int mesh_add_sub(struct module_qstate* qstate, struct query_info* qinfo,
 			log_err("mesh_attach_sub: out of memory");
 			return 0;
 		}
+		(*sub)->sched_class = c;
+		(*sub)->refresh = qstate->mesh_info->refresh;
 #ifdef UNBOUND_DEBUG
 		n =
 #else
@@ -894,6 +1583,7 @@ int mesh_add_sub(struct module_qstate* qstate, struct query_info* qinfo,
 #endif
 		rbtree_insert(&mesh->all, &(*sub)->node);
 		log_assert(n != NULL);
+		mesh->class_num[c]++;
 		/* set detached (it is now) */
 		mesh->num_detached_states++;
 		/* set new query state to run */
@@ -902,7 +1592,7 @@ int mesh_add_sub(struct module_qstate* qstate, struct query_info* qinfo,
 #else
 		(void)
 #endif
-		rbtree_insert(&mesh->run, &(*sub)->run_node);
+		rbtree_insert(&mesh->run[c], &(*sub)->run_node);
 		log_assert(n != NULL);
 		*newq = &(*sub)->s;
 	} else
@@ -910,17 +1600,35 @@ int mesh_add_sub(struct module_qstate* qstate, struct query_info* qinfo,
 	return 1;
 }
 
+int mesh_add_sub(struct module_qstate* qstate, struct query_info* qinfo,
+        uint16_t qflags, int prime, int valrec, struct module_qstate** newq,
+	struct mesh_state** sub)
+{
+	/* a detached query, nobody waits for it */
+	return mesh_find_or_add_sub(qstate, qinfo, qflags, prime, valrec,
+		newq, sub, mesh_class_internal);
+}
+
 int mesh_attach_sub(struct module_qstate* qstate, struct query_info* qinfo,
         uint16_t qflags, int prime, int valrec, struct module_qstate** newq)
 {
 	struct mesh_area* mesh = qstate->env->mesh;
 	struct mesh_state* sub = NULL;
+	size_t count = 0;
 	int was_detached;
-	if(!mesh_add_sub(qstate, qinfo, qflags, prime, valrec, newq, &sub))
+	if(!mesh_find_or_add_sub(qstate, qinfo, qflags, prime, valrec, newq,
+		&sub, qstate->mesh_info->sched_class))
+		return 0;
+	if(!sub) {
+		/* the class is full, the super cannot wait for a subquery
+		 * that is not there */
 		return 0;
+	}
 	was_detached = (sub->super_set.count == 0);
 	if(!mesh_state_attachment(qstate->mesh_info, sub))
 		return 0;
+	/* the super is waiting for it, run it at the priority of the super */
+	mesh_state_promote(mesh, sub, qstate->mesh_info->sched_class, &count);
 	/* if it was a duplicate  attachment, the count was not zero before */
 	if(!sub->reply_list && !sub->cb_list && was_detached && 
 		sub->super_set.count == 1) {
@@ -1166,6 +1874,24 @@ void mesh_query_done(struct mesh_state* mstate)
 	struct mesh_cb* c;
 	struct reply_info* rep = (mstate->s.return_msg?
 		mstate->s.return_msg->rep:NULL);
+	struct reply_info* reply_rep = rep;
+	int reply_rcode = mstate->s.return_rcode;
+	int expired = 0;
+	if(mstate->serve_expired_timer) {
+		comm_timer_disable(mstate->serve_expired_timer);
+		/* the clients get the expired answer, if there is one,
+		 * instead of SERVFAIL */
+		if(mstate->reply_list && !mstate->s.is_drop &&
+			(reply_rcode == LDNS_RCODE_SERVFAIL || (rep &&
+			FLAGS_GET_RCODE(rep->flags) == LDNS_RCODE_SERVFAIL))) {
+			struct dns_msg* msg = mesh_serve_expired_lookup(mstate);
+			if(msg) {
+				reply_rep = msg->rep;
+				reply_rcode = LDNS_RCODE_NOERROR;
+				expired = 1;
+			}
+		}
+	}
 	if((mstate->s.return_rcode == LDNS_RCODE_SERVFAIL ||
 		(rep && FLAGS_GET_RCODE(rep->flags) == LDNS_RCODE_SERVFAIL))
 		&& mstate->s.env->cfg->log_servfail
@@ -1194,13 +1920,16 @@ void mesh_query_done(struct mesh_state* mstate)
 			struct sldns_buffer* r_buffer = r->query_reply.c->buffer;
 			if(r->query_reply.c->tcp_req_info)
 				r_buffer = r->query_reply.c->tcp_req_info->spool_buffer;
-			mesh_send_reply(mstate, mstate->s.return_rcode, rep,
+			mesh_send_reply(mstate, reply_rcode, reply_rep,
 				r, r_buffer, prev, prev_buffer);
 			if(r->query_reply.c->tcp_req_info)
 				tcp_req_info_remove_mesh_state(r->query_reply.c->tcp_req_info, mstate);
+			if(expired)
+				mstate->s.env->mesh->ans_expired++;
 			prev = r;
 			prev_buffer = r_buffer;
 		}
+		mesh_client_release(mstate->s.env->mesh, r);
 	}
 	mstate->replies_sent = 1;
 	while((c = mstate->cb_list) != NULL) {
@@ -1224,7 +1953,7 @@ void mesh_walk_supers(struct mesh_area* mesh, struct mesh_state* mstate)
 	RBTREE_FOR(ref, struct mesh_state_ref*, &mstate->super_set)
 	{
 		/* make super runnable */
-		(void)rbtree_insert(&mesh->run, &ref->s->run_node);
+		mesh_run_insert(mesh, ref->s);
 		/* callback the function to inform super of result */
 		fptr_ok(fptr_whitelist_mod_inform_super(
 			mesh->mods.mod[ref->s->s.curmod]->inform_super));
@@ -1361,6 +2090,10 @@ int mesh_state_add_reply(struct mesh_state* s, struct edns_data* edns,
 		r->local_alias = NULL;
 
 	s->reply_list = r;
+	r->mstate = s;
+	r->client = NULL;
+	if(s->s.env->mesh->fair_share)
+		mesh_client_charge(s->s.env->mesh, r);
 	return 1;
 }
 
@@ -1472,7 +2205,7 @@ mesh_continue(struct mesh_area* mesh, struct mesh_state* mstate,
 			mesh_state_delete(&mstate->s);
 			if(qinfo) {
 				mesh_schedule_prefetch(mesh, qinfo, qflags,
-					0, 1);
+					0, 1, 0);
 			}
 			return 0;
 		}
@@ -1488,8 +2221,16 @@ void mesh_run(struct mesh_area* mesh, struct mesh_state* mstate,
 	enum module_ev ev, struct outbound_entry* e)
 {
 	enum module_ext_state s;
+	struct timeval trace_start, trace_now;
 	verbose(VERB_ALGO, "mesh_run: start");
 	while(mstate) {
+		if(mstate->trace) {
+			mesh_trace_now(mesh, &trace_start);
+			mesh_trace_switch(mstate->trace, mstate->s.curmod,
+				&trace_start);
+			mesh_trace_add(mstate->trace, mesh_trace_module,
+				mstate->s.curmod, (int)ev, &trace_start);
+		}
 		/* run the module */
 		fptr_ok(fptr_whitelist_mod_operate(
 			mesh->mods.mod[mstate->s.curmod]->operate));
@@ -1500,6 +2241,15 @@ void mesh_run(struct mesh_area* mesh, struct mesh_state* mstate,
 		mstate->s.reply = NULL;
 		regional_free_all(mstate->s.env->scratch);
 		s = mstate->s.ext_state[mstate->s.curmod];
+		if(mstate->trace) {
+			struct timeval d;
+			mesh_trace_now(mesh, &trace_now);
+			timeval_subtract(&d, &trace_now, &trace_start);
+			timeval_add(&mstate->trace->mod_busy[mstate->s.curmod],
+				&d);
+			mesh_trace_add(mstate->trace, mesh_trace_module_exit,
+				mstate->s.curmod, (int)s, &trace_now);
+		}
 		verbose(VERB_ALGO, "mesh_run: %s module exit state is %s", 
 			mesh->mods.mod[mstate->s.curmod]->name, strextstate(s));
 		e = NULL;
@@ -1508,11 +2258,7 @@ void mesh_run(struct mesh_area* mesh, struct mesh_state* mstate,
 
 		/* run more modules */
 		ev = module_event_pass;
-		if(mesh->run.count > 0) {
-			/* pop random element off the runnable tree */
-			mstate = (struct mesh_state*)mesh->run.root->key;
-			(void)rbtree_delete(&mesh->run, mstate);
-		} else mstate = NULL;
+		mstate = mesh_run_pop(mesh);
 	}
 	if(verbosity >= VERB_ALGO) {
 		mesh_stats(mesh, "mesh_run: end");
@@ -1576,11 +2322,29 @@ mesh_stats_clear(struct mesh_area* mesh)
 	mesh->replies_sum_wait.tv_usec = 0;
 	mesh->stats_jostled = 0;
 	mesh->stats_dropped = 0;
+	mesh->stats_fair_evicted = 0;
+	mesh->stats_fair_dropped = 0;
+	mesh->stats_neg_noerror = 0;
+	mesh->stats_neg_nxdomain = 0;
+	mesh->stats_neg_nsec3 = 0;
+	memset(mesh->class_dropped, 0, sizeof(mesh->class_dropped));
+	memset(mesh->class_done, 0, sizeof(mesh->class_done));
+	memset(mesh->class_sum_wait, 0, sizeof(mesh->class_sum_wait));
+	mesh->trace_num = 0;
+	mesh->trace_num_slow = 0;
+	memset(mesh->trace_mod_num, 0, sizeof(mesh->trace_mod_num));
+	memset(mesh->trace_mod_sum, 0, sizeof(mesh->trace_mod_sum));
+	memset(mesh->trace_mod_hist, 0, sizeof(mesh->trace_mod_hist));
 	timehist_clear(mesh->histogram);
 	mesh->ans_secure = 0;
 	mesh->ans_bogus = 0;
 	memset(&mesh->ans_rcode[0], 0, sizeof(size_t)*16);
 	mesh->ans_nodata = 0;
+	mesh->num_rrset_unchanged = 0;
+	mesh->ans_expired = 0;
+	mesh->num_dname_synth = 0;
+	mesh->num_queries_hedged = 0;
+	mesh->num_hedges_denied = 0;
 }
 
 size_t 
@@ -1590,6 +2354,9 @@ mesh_get_mem(struct mesh_area* mesh)
 	size_t s = sizeof(*mesh) + sizeof(struct timehist) +
 		sizeof(struct th_buck)*mesh->histogram->num +
 		sizeof(sldns_buffer) + sldns_buffer_capacity(mesh->qbuf_bak);
+	if(mesh->trace_slow)
+		s += sizeof(struct mesh_trace_slow)*MESH_TRACE_SLOW_MAX;
+	s += sizeof(struct mesh_client)*mesh->clients.count;
 	RBTREE_FOR(m, struct mesh_state*, &mesh->all) {
 		/* all, including m itself allocated in qstate region */
 		s += regional_get_mem(m->s.region);
@@ -1646,6 +2413,7 @@ void mesh_state_remove_reply(struct mesh_area* mesh, struct mesh_state* m,
 			else m->reply_list = n->next;
 			/* delete it, but allocated in m region */
 			mesh->num_reply_addrs--;
+			mesh_client_release(mesh, n);
 
 			/* prev = prev; */
 			n = n->next;
@@ -1665,3 +2433,86 @@ void mesh_state_remove_reply(struct mesh_area* mesh, struct mesh_state* m,
 		mesh->num_reply_states--;
 	}
 }
+
+int
+mesh_async_setup(struct mesh_area* mesh)
+{
+	if(mesh->async_tube)
+		return 1;
+	if(!(mesh->async_tube = tube_create())) {
+		log_err("mesh: could not create async tube");
+		return 0;
+	}
+	if(!tube_setup_bg_listen(mesh->async_tube, mesh->env->worker_base,
+		&mesh_async_handle, mesh)) {
+		log_err("mesh: could not listen on async tube");
+		tube_delete(mesh->async_tube);
+		mesh->async_tube = NULL;
+		return 0;
+	}
+	return 1;
+}
+
+void
+mesh_async_post(struct mesh_area* mesh, struct mesh_async* item)
+{
+	uint8_t sig = 0;
+	item->next = NULL;
+	lock_basic_lock(&mesh->async_lock);
+	if(mesh->async_last)
+		mesh->async_last->next = item;
+	else	mesh->async_first = item;
+	mesh->async_last = item;
+	/* one doorbell is enough until the list is taken */
+	if(!mesh->async_signalled) {
+		if(tube_write_msg(mesh->async_tube, &sig, sizeof(sig), 1) == 1)
+			mesh->async_signalled = 1;
+		else	log_err("mesh: could not signal async item");
+	}
+	lock_basic_unlock(&mesh->async_lock);
+}
+
+void
+mesh_async_run(struct mesh_area* mesh)
+{
+	struct mesh_async* a = mesh_async_take(mesh), *n;
+	struct module_qstate* qstate;
+	while(a) {
+		n = a->next;
+		if(mesh->async_waiting > 0)
+			mesh->async_waiting--;
+		fptr_ok(fptr_whitelist_mesh_async(a->cb));
+		qstate = (*a->cb)(mesh, a);
+		if(qstate)
+			mesh_run(mesh, qstate->mesh_info, module_event_pass,
+				NULL);
+		a = n;
+	}
+}
+
+void
+mesh_async_wait(struct mesh_area* mesh)
+{
+	uint8_t* msg = NULL;
+	uint32_t len = 0;
+	if(!tube_wait(mesh->async_tube))
+		return;
+	/* read the doorbell, the list is taken after it */
+	if(tube_read_msg(mesh->async_tube, &msg, &len, 1) == 1)
+		free(msg);
+	mesh_async_run(mesh);
+}
+
+void
+mesh_async_handle(struct tube* ATTR_UNUSED(tube), uint8_t* msg,
+	size_t ATTR_UNUSED(len), int error, void* arg)
+{
+	struct mesh_area* mesh = (struct mesh_area*)arg;
+	free(msg);
+	if(error != NETEVENT_NOERROR) {
+		if(error != NETEVENT_CLOSED)
+			log_info("mesh async event: %d", error);
+		return;
+	}
+	mesh_async_run(mesh);
+}
@@ -47,6 +47,7 @@
 #define SERVICES_MESH_H
 
 #include "util/rbtree.h"
+#include "util/locks.h"
 #include "util/netevent.h"
 #include "util/data/msgparse.h"
 #include "util/module.h"
@@ -60,6 +61,8 @@ struct reply_info;
 struct outbound_entry;
 struct timehist;
 struct respip_client_info;
+struct tube;
+struct mesh_async;
 
 /**
  * Maximum number of mesh state activations. Any more is likely an
@@ -74,6 +77,95 @@ struct respip_client_info;
  */
 #define MESH_MAX_SUBSUB 1024
 
+/** number of scheduling classes for mesh states */
+#define MESH_NUM_CLASSES 3
+
+/** max number of events recorded in a query trace */
+#define MESH_TRACE_MAX 64
+/** number of slow query traces kept per thread */
+#define MESH_TRACE_SLOW_MAX 16
+/** number of buckets in the per module trace histogram, log2 of msec */
+#define MESH_TRACE_BUCKETS 16
+
+/**
+ * Scheduling class of a mesh state. Runnable states are picked per class,
+ * by weight, so that background work yields to client queries.
+ */
+enum mesh_class {
+	/** work that a client (or callback) is waiting for */
+	mesh_class_client = 0,
+	/** prefetch and serve-expired refresh of cached answers */
+	mesh_class_prefetch,
+	/** detached internal queries, that nobody is waiting for */
+	mesh_class_internal
+};
+
+/** type of event in a query trace */
+enum mesh_trace_type {
+	/** module operate is called, arg is the module event */
+	mesh_trace_module = 0,
+	/** module operate returned, arg is the module ext state */
+	mesh_trace_module_exit,
+	/** outbound query is sent */
+	mesh_trace_send,
+	/** outbound reply (or timeout) arrives, arg is the netevent code */
+	mesh_trace_reply,
+	/** cache lookup by the module, arg is 1 on a hit */
+	mesh_trace_cache
+};
+
+/** an event in a query trace */
+struct mesh_trace_event {
+	/** time of the event */
+	struct timeval tv;
+	/** type of event */
+	enum mesh_trace_type type;
+	/** module that has control */
+	int module;
+	/** argument, depends on type */
+	int arg;
+};
+
+/**
+ * Trace of a sampled query.  Records the events, and the time spent per
+ * module, counted from when the module is called until another module
+ * is called, so that waits for replies and subqueries are included.
+ */
+struct mesh_trace {
+	/** time the trace started */
+	struct timeval start;
+	/** time the trace ended */
+	struct timeval end;
+	/** module that has control, or -1 */
+	int cur_mod;
+	/** when the current module got control */
+	struct timeval cur_start;
+	/** time spent per module */
+	struct timeval mod_time[MAX_MODULE];
+	/** time spent in the operate call of the module */
+	struct timeval mod_busy[MAX_MODULE];
+	/** bitmask of the modules that got control */
+	unsigned mod_used;
+	/** number of events, can be more than the recorded MESH_TRACE_MAX */
+	size_t num;
+	/** the recorded events */
+	struct mesh_trace_event ev[MESH_TRACE_MAX];
+};
+
+/** copy of the trace of a slow query, for unbound-control */
+struct mesh_trace_slow {
+	/** query name, wireformat */
+	uint8_t qname[LDNS_MAX_DOMAINLEN];
+	/** length of qname */
+	size_t qname_len;
+	/** query type */
+	uint16_t qtype;
+	/** query class */
+	uint16_t qclass;
+	/** the trace */
+	struct mesh_trace trace;
+};
+
 /** 
  * Mesh of query states
  */
@@ -83,8 +175,8 @@ struct mesh_area {
 	/** environment for new states */
 	struct module_env* env;
 
-	/** set of runnable queries (mesh_state.run_node) */
-	rbtree_type run;
+	/** set of runnable queries (mesh_state.run_node), per class */
+	rbtree_type run[MESH_NUM_CLASSES];
 	/** rbtree of all current queries (mesh_state.node)*/
 	rbtree_type all;
 
@@ -124,6 +216,22 @@ struct mesh_area {
 	size_t ans_rcode[16];
 	/** (extended stats) rcode nodata in replies */
 	size_t ans_nodata;
+	/** secure rrsets fetched again unchanged, for prefetch or
+	 * serve-expired, that kept their security status without being
+	 * validated again */
+	size_t num_rrset_unchanged;
+	/** replies with an expired answer, after the serve-expired client
+	 * timeout or a failed resolution */
+	size_t ans_expired;
+	/** answers synthesized from insecure cached DNAMEs */
+	size_t num_dname_synth;
+	/** hedge budget of the thread, in hundredths of a query.  Every
+	 * outgoing query adds hedge-budget, every hedged query takes 100 */
+	int hedge_tokens;
+	/** number of hedged queries sent */
+	size_t num_queries_hedged;
+	/** number of hedged queries not sent because of the budget */
+	size_t num_hedges_denied;
 
 	/** backup of query if other operations recurse and need the
 	 * network buffers */
@@ -142,6 +250,98 @@ struct mesh_area {
 	struct mesh_state* jostle_last;
 	/** timeout for jostling. if age is lower, it does not get jostled. */
 	struct timeval jostle_max;
+
+	/** scheduling weight of the classes, 0 runs only if others idle */
+	int class_weight[MESH_NUM_CLASSES];
+	/** smooth weighted round robin, current credit of the classes */
+	int class_credit[MESH_NUM_CLASSES];
+	/** max number of states in the class, 0 is unlimited */
+	size_t class_limit[MESH_NUM_CLASSES];
+	/** number of states in the class (in the all tree) */
+	size_t class_num[MESH_NUM_CLASSES];
+	/** stats, number of new states dropped because of the class limit */
+	size_t class_dropped[MESH_NUM_CLASSES];
+	/** stats, number of states of the class that have been finished */
+	size_t class_done[MESH_NUM_CLASSES];
+	/** stats, sum of the time finished states spent in the mesh */
+	struct timeval class_sum_wait[MESH_NUM_CLASSES];
+
+	/** trace one in this many client queries, 0 disables tracing */
+	size_t trace_rate;
+	/** counter for the trace sample rate */
+	size_t trace_count;
+	/** traced queries that take longer than this are kept as slow */
+	struct timeval trace_slow_max;
+	/** stats, number of traced queries */
+	size_t trace_num;
+	/** stats, number of traced queries slower than trace_slow_max */
+	size_t trace_num_slow;
+	/** stats, number of traced queries that used the module */
+	size_t trace_mod_num[MAX_MODULE];
+	/** stats, sum of the time in the module of traced queries */
+	struct timeval trace_mod_sum[MAX_MODULE];
+	/** stats, histogram of the time in the module, per log2 of msec */
+	size_t trace_mod_hist[MAX_MODULE][MESH_TRACE_BUCKETS];
+	/** ring buffer with slow traces, NULL if tracing is disabled */
+	struct mesh_trace_slow* trace_slow;
+	/** number of entries in the slow trace ring buffer */
+	size_t trace_slow_num;
+	/** position in the ring buffer for the next slow trace */
+	size_t trace_slow_pos;
+
+	/** if admission to a full mesh is by fair share per client */
+	int fair_share;
+	/** prefix length for IPv4 and IPv6 clients in the fair share */
+	int fair_prefix4, fair_prefix6;
+	/** client prefixes that own reply states, of struct mesh_client */
+	rbtree_type clients;
+	/** the same clients, sorted by their number of replies, the
+	 * client with the most replies is last */
+	rbtree_type clients_num;
+	/** stats, states of clients over their share deleted for others */
+	size_t stats_fair_evicted;
+	/** stats, queries of clients over their share dropped */
+	size_t stats_fair_dropped;
+	/** stats, NOERROR answers made from the negative cache */
+	size_t stats_neg_noerror;
+	/** stats, NXDOMAIN answers made from the negative cache */
+	size_t stats_neg_nxdomain;
+	/** stats, of those answers the ones made from NSEC3 records */
+	size_t stats_neg_nsec3;
+
+	/** lock on the async list, other threads post items to it */
+	lock_basic_type async_lock;
+	/** doorbell for posted async items, created on first use */
+	struct tube* async_tube;
+	/** items posted by other threads, to continue on this thread */
+	struct mesh_async* async_first;
+	/** last of the posted async items */
+	struct mesh_async* async_last;
+	/** if the doorbell has been rung and the list not yet taken */
+	int async_signalled;
+	/** number of async items this thread waits for, the submitter
+	 * counts them up and they are counted down when they run */
+	size_t async_waiting;
+};
+
+/**
+ * A client prefix with replies that wait in the mesh, for fair admission.
+ */
+struct mesh_client {
+	/** node in the mesh clients tree, key is this struct */
+	rbnode_type node;
+	/** node in the mesh clients by number tree, key is this struct */
+	rbnode_type num_node;
+	/** the client address, masked to the prefix length */
+	struct sockaddr_storage addr;
+	/** length of addr */
+	socklen_t addrlen;
+	/** number of replies of the client that wait in the mesh */
+	size_t num;
+	/** the waiting replies of the client, oldest first */
+	struct mesh_reply* first;
+	/** last of the waiting replies */
+	struct mesh_reply* last;
 };
 
 /**
@@ -183,6 +383,17 @@ struct mesh_state {
 		mesh_jostle_list } list_select;
 	/** pointer to this state for uniqueness or NULL */
 	struct mesh_state* unique;
+	/** scheduling class of the state */
+	enum mesh_class sched_class;
+	/** the time when the state was created */
+	struct timeval start_time;
+	/** trace of the query, if it is sampled, or NULL */
+	struct mesh_trace* trace;
+	/** timer for the serve-expired client timeout, or NULL */
+	struct comm_timer* serve_expired_timer;
+	/** if the state refreshes a popular cache entry, or is a subquery
+	 * created for such a refresh */
+	int refresh;
 
 	/** true if replies have been sent out (at end for alignment) */
 	uint8_t replies_sent;
@@ -219,6 +430,14 @@ struct mesh_reply {
 	uint8_t* qname;
 	/** same as that in query_info. */
 	struct local_rrset* local_alias;
+	/** the mesh state the reply waits for */
+	struct mesh_state* mstate;
+	/** the client prefix the reply is charged to, or NULL */
+	struct mesh_client* client;
+	/** previous in the list of replies of the client */
+	struct mesh_reply* client_prev;
+	/** next in the list of replies of the client */
+	struct mesh_reply* client_next;
 };
 
 /** 
@@ -251,6 +470,28 @@ struct mesh_cb {
 	void* cb_arg;
 };
 
+/**
+ * Callback for work that another thread has finished.  Called on the
+ * thread of the mesh, or with a NULL mesh when the mesh is deleted and the
+ * item can only be freed.
+ * @param mesh: the mesh area, or NULL.
+ * @param item: the posted item, the callback frees it.
+ * @return the query state to continue with module_event_pass, or NULL.
+ */
+typedef struct module_qstate* mesh_async_func_type(struct mesh_area* mesh,
+	struct mesh_async* item);
+
+/**
+ * Work done by another thread, posted back to the thread of the mesh.
+ * It is embedded in the structure of the caller.
+ */
+struct mesh_async {
+	/** next in the list of posted items */
+	struct mesh_async* next;
+	/** callback routine, on the thread of the mesh */
+	mesh_async_func_type* cb;
+};
+
 /* ------------------- Functions for worker -------------------- */
 
 /**
@@ -319,6 +560,19 @@ int mesh_new_callback(struct mesh_area* mesh, struct query_info* qinfo,
 void mesh_new_prefetch(struct mesh_area* mesh, struct query_info* qinfo,
 	uint16_t qflags, time_t leeway);
 
+/**
+ * New refresh of a popular cache entry.  Like a prefetch, but the state
+ * and its subqueries are marked, so their upstream queries are counted
+ * as refreshes.
+ *
+ * @param mesh: the mesh.
+ * @param qinfo: query of the cache entry.
+ * @param qflags: flags of the cache entry, RD and CD.
+ * @param leeway: TTL leeway what to expire earlier for this update.
+ */
+void mesh_new_refresh(struct mesh_area* mesh, struct query_info* qinfo,
+	uint16_t qflags, time_t leeway);
+
 /**
  * Handle new event from the wire. A serviced query has returned.
  * The query state will be made runnable, and the mesh_area will process
@@ -393,6 +647,8 @@ int mesh_attach_sub(struct module_qstate* qstate, struct query_info* qinfo,
  * @param newq: If the new subquery needs initialisation, it is returned,
  * 	otherwise NULL is returned.
  * @param sub: The added mesh state, created if it did not exist already.
+ * 	It is NULL if the state did not exist and the limit for the
+ * 	internal scheduling class stopped it from being created.
  * @return: false on error, true if success (and init may be needed).
  */
 int mesh_add_sub(struct module_qstate* qstate, struct query_info* qinfo,
@@ -601,6 +857,45 @@ int mesh_state_compare(const void* ap, const void* bp);
 /** compare two mesh references */
 int mesh_state_ref_compare(const void* ap, const void* bp);
 
+/** compare two mesh clients, by prefix address */
+int mesh_client_compare(const void* ap, const void* bp);
+
+/** compare two mesh clients, by number of replies and then address */
+int mesh_client_num_compare(const void* ap, const void* bp);
+
+/**
+ * Setup the mesh to receive items that other threads post to it.  Called
+ * on the thread of the mesh, it is done once, on first use.
+ * @param mesh: mesh area.
+ * @return false on failure, the caller then does the work itself.
+ */
+int mesh_async_setup(struct mesh_area* mesh);
+
+/**
+ * Post an item to the thread of the mesh.  Can be called from any
+ * thread.  The callback of the item is run on the thread of the mesh.
+ * @param mesh: mesh area, mesh_async_setup has been done.
+ * @param item: the item, with the callback set.
+ */
+void mesh_async_post(struct mesh_area* mesh, struct mesh_async* item);
+
+/**
+ * Run the posted items, continues the query states they return.
+ * @param mesh: mesh area.
+ */
+void mesh_async_run(struct mesh_area* mesh);
+
+/**
+ * Wait for posted items and run them, without the event loop.  Blocks
+ * until an item arrives.  For the test programs.
+ * @param mesh: mesh area, mesh_async_setup has been done.
+ */
+void mesh_async_wait(struct mesh_area* mesh);
+
+/** tube listen callback for the async doorbell of the mesh */
+void mesh_async_handle(struct tube* tube, uint8_t* msg, size_t len,
+	int error, void* arg);
+
 /**
  * Make space for another recursion state for a reply in the mesh
  * @param mesh: mesh area
@@ -615,6 +910,56 @@ int mesh_state_ref_compare(const void* ap, const void* bp);
  */
 int mesh_make_new_space(struct mesh_area* mesh, struct sldns_buffer* qbuf);
 
+/**
+ * Set the scheduling class of a mesh state.  Moves the state between the
+ * runnable sets and updates the class counters.
+ * @param mesh: mesh area.
+ * @param m: mesh state, it is in the mesh area all tree.
+ * @param c: the new class.
+ */
+void mesh_state_set_class(struct mesh_area* mesh, struct mesh_state* m,
+	enum mesh_class c);
+
+/**
+ * Parse a mesh class config string, with a number per scheduling class.
+ * @param str: the string, "client prefetch internal", eg. "4 1 1".
+ * @param res: array of MESH_NUM_CLASSES where the result is stored.
+ * @return false on parse error.
+ */
+int mesh_class_cfg_parse(const char* str, int* res);
+
+/**
+ * Get the name of a mesh scheduling class.
+ * @param c: the class.
+ * @return static string.
+ */
+const char* mesh_class_to_str(enum mesh_class c);
+
+/**
+ * Record an event in the trace of the query.  The caller checks that the
+ * query is traced, so untraced queries do not read the clock.
+ * The module is the current module of the query state.
+ * @param qstate: the query state.
+ * @param type: type of event.
+ * @param arg: argument for the event.
+ */
+void mesh_trace_event(struct module_qstate* qstate,
+	enum mesh_trace_type type, int arg);
+
+/**
+ * Get the lower bound of a trace histogram bucket.
+ * @param i: bucket number.
+ * @param tv: returns the lower bound, the upper bound is that of i+1.
+ */
+void mesh_trace_bucket_lower(int i, struct timeval* tv);
+
+/**
+ * Get a string for a trace event type.
+ * @param t: the type.
+ * @return static string.
+ */
+const char* mesh_trace_type_to_str(enum mesh_trace_type t);
+
 /**
  * Insert mesh state into a double linked list.  Inserted at end.
  * @param m: mesh state.
@@ -643,4 +988,12 @@ void mesh_list_remove(struct mesh_state* m, struct mesh_state** fp,
 void mesh_state_remove_reply(struct mesh_area* mesh, struct mesh_state* m,
 	struct comm_point* cp);
 
+/**
+ * Callback for the serve-expired client timeout of a mesh state.  Answers
+ * the waiting clients from the expired cache entry, if there is one, and
+ * the state continues to resolve the query to update the cache.
+ * @param arg: the mesh state.
+ */
+void mesh_serve_expired_callback(void* arg);
+
 #endif /* SERVICES_MESH_H */
@@ -58,6 +58,7 @@
 #include "util/net_help.h"
 #include "util/random.h"
 #include "util/fptr_wlist.h"
+#include "util/storage/lookup3.h"
 #include "sldns/sbuffer.h"
 #include "dnstap/dnstap.h"
 #ifdef HAVE_OPENSSL_SSL_H
@@ -131,6 +132,154 @@ serviced_cmp(const void* key1, const void* key2)
 	return sockaddr_cmp(&q1->addr, q1->addrlen, &q2->addr, q2->addrlen);
 }
 
+int
+outnet_hash_init(struct outnet_hash* h, size_t size)
+{
+	h->array = (struct outnet_hash_node**)calloc(size, sizeof(*h->array));
+	if(!h->array)
+		return 0;
+	h->size = size;
+	h->mask = size-1;
+	h->count = 0;
+	return 1;
+}
+
+void
+outnet_hash_clear(struct outnet_hash* h)
+{
+	free(h->array);
+	h->array = NULL;
+	h->size = 0;
+	h->mask = 0;
+	h->count = 0;
+}
+
+/** double the number of buckets of the hash table */
+static void
+outnet_hash_grow(struct outnet_hash* h)
+{
+	size_t newsize = h->size*2, i;
+	struct outnet_hash_node** newarray = (struct outnet_hash_node**)
+		calloc(newsize, sizeof(*newarray));
+	if(!newarray)
+		return; /* keep the longer chains */
+	for(i=0; i<h->size; i++) {
+		struct outnet_hash_node* n = h->array[i], *nx;
+		while(n) {
+			nx = n->next;
+			n->next = newarray[n->hash&(newsize-1)];
+			newarray[n->hash&(newsize-1)] = n;
+			n = nx;
+		}
+	}
+	free(h->array);
+	h->array = newarray;
+	h->size = newsize;
+	h->mask = newsize-1;
+}
+
+void
+outnet_hash_insert(struct outnet_hash* h, struct outnet_hash_node* n)
+{
+	if(h->count >= h->size)
+		outnet_hash_grow(h);
+	n->next = h->array[n->hash&h->mask];
+	h->array[n->hash&h->mask] = n;
+	h->count++;
+}
+
+int
+outnet_hash_remove(struct outnet_hash* h, struct outnet_hash_node* n)
+{
+	struct outnet_hash_node** pp;
+	if(!h->array)
+		return 0;
+	for(pp = &h->array[n->hash&h->mask]; *pp; pp = &(*pp)->next) {
+		if(*pp == n) {
+			*pp = n->next;
+			n->next = NULL;
+			h->count--;
+			return 1;
+		}
+	}
+	return 0;
+}
+
+/** call the function for every entry of the hash table, it may free the
+ * entry */
+static void
+outnet_hash_traverse(struct outnet_hash* h,
+	void (*func)(struct outnet_hash_node*, void*), void* arg)
+{
+	size_t i;
+	struct outnet_hash_node* n, *nx;
+	if(!h->array)
+		return;
+	for(i=0; i<h->size; i++) {
+		for(n = h->array[i]; n; n = nx) {
+			nx = n->next;
+			(*func)(n, arg);
+		}
+	}
+}
+
+/** hash the address fields that sockaddr_cmp compares */
+static hashvalue_type
+addr_hash(struct sockaddr_storage* addr, socklen_t addrlen,
+	hashvalue_type h)
+{
+	struct sockaddr_in* in = (struct sockaddr_in*)addr;
+	struct sockaddr_in6* in6 = (struct sockaddr_in6*)addr;
+	if(in->sin_family == AF_INET) {
+		h = hashlittle(&in->sin_port, sizeof(in->sin_port), h);
+		return hashlittle(&in->sin_addr, INET_SIZE, h);
+	} else if(in6->sin6_family == AF_INET6) {
+		h = hashlittle(&in6->sin6_port, sizeof(in6->sin6_port), h);
+		return hashlittle(&in6->sin6_addr, INET6_SIZE, h);
+	}
+	return hashlittle(addr, (size_t)addrlen, h);
+}
+
+hashvalue_type
+pending_hash(struct pending* p, uint32_t seed)
+{
+	uint16_t id = (uint16_t)p->id;
+	return addr_hash(&p->addr, p->addrlen, hashlittle(&id, sizeof(id),
+		seed));
+}
+
+hashvalue_type
+serviced_hash(struct serviced_query* sq, uint32_t seed)
+{
+	hashvalue_type h = hashlittle(sq->qbuf, 10, seed);
+	h = hashlittle(sq->qbuf+sq->qbuflen-4, 4, h);
+	h = hashlittle(&sq->dnssec, sizeof(sq->dnssec), h);
+	h = dname_query_hash(sq->qbuf+10, h);
+	return addr_hash(&sq->addr, sq->addrlen, h);
+}
+
+struct pending*
+outnet_pending_lookup(struct outnet_hash* h, struct pending* key)
+{
+	struct outnet_hash_node* n;
+	for(n = h->array[key->node.hash&h->mask]; n; n = n->next) {
+		if(n->hash == key->node.hash && pending_cmp(n, key) == 0)
+			return (struct pending*)n;
+	}
+	return NULL;
+}
+
+struct serviced_query*
+outnet_serviced_lookup(struct outnet_hash* h, struct serviced_query* key)
+{
+	struct outnet_hash_node* n;
+	for(n = h->array[key->node.hash&h->mask]; n; n = n->next) {
+		if(n->hash == key->node.hash && serviced_cmp(n, key) == 0)
+			return (struct serviced_query*)n;
+	}
+	return NULL;
+}
+
 /** delete waiting_tcp entry. Does not unlink from waiting list. 
  * @param w: to delete.
  */
@@ -566,13 +715,14 @@ outnet_udp_cb(struct comm_point* c, void* arg, int error,
 	key.id = (unsigned)LDNS_ID_WIRE(sldns_buffer_begin(c->buffer));
 	memcpy(&key.addr, &reply_info->addr, reply_info->addrlen);
 	key.addrlen = reply_info->addrlen;
+	key.node.hash = pending_hash(&key, outnet->hash_seed);
 	verbose(VERB_ALGO, "Incoming reply id = %4.4x", key.id);
 	log_addr(VERB_ALGO, "Incoming reply addr =", 
 		&reply_info->addr, reply_info->addrlen);
 
 	/* find it, see if this thing is a valid query response */
-	verbose(VERB_ALGO, "lookup size is %d entries", (int)outnet->pending->count);
-	p = (struct pending*)rbtree_search(outnet->pending, &key);
+	verbose(VERB_ALGO, "lookup size is %d entries", (int)outnet->pending.count);
+	p = outnet_pending_lookup(&outnet->pending, &key);
 	if(!p) {
 		verbose(VERB_QUERY, "received unwanted or unsolicited udp reply dropped.");
 		log_buf(VERB_ALGO, "dropped message", c->buffer);
@@ -612,8 +762,8 @@ outnet_udp_cb(struct comm_point* c, void* arg, int error,
 	}
 	comm_timer_disable(p->timer);
 	verbose(VERB_ALGO, "outnet handle udp reply");
-	/* delete from tree first in case callback creates a retry */
-	(void)rbtree_delete(outnet->pending, p->node.key);
+	/* delete from table first in case callback creates a retry */
+	outnet_hash_remove(&outnet->pending, &p->node);
 	if(p->cb) {
 		fptr_ok(fptr_whitelist_pending_udp(p->cb));
 		(void)(*p->cb)(p->pc->cp, p->cb_arg, NETEVENT_NOERROR, reply_info);
@@ -757,6 +907,7 @@ outside_network_create(struct comm_base *base, size_t bufsize,
 	outnet->num_tcp_outgoing = 0;
 	outnet->infra = infra;
 	outnet->rnd = rnd;
+	outnet->hash_seed = (uint32_t)ub_random(rnd);
 	outnet->sslctx = sslctx;
 #ifdef USE_DNSTAP
 	outnet->dtenv = dtenv;
@@ -805,8 +956,8 @@ outside_network_create(struct comm_base *base, size_t bufsize,
 		}
 	}
 	if(	!(outnet->udp_buff = sldns_buffer_new(bufsize)) ||
-		!(outnet->pending = rbtree_create(pending_cmp)) ||
-		!(outnet->serviced = rbtree_create(serviced_cmp)) ||
+		!outnet_hash_init(&outnet->pending, OUTNET_HASH_START) ||
+		!outnet_hash_init(&outnet->serviced, OUTNET_HASH_START) ||
 		!create_pending_tcp(outnet, bufsize)) {
 		log_err("malloc failed");
 		outside_network_delete(outnet);
@@ -877,7 +1028,7 @@ outside_network_create(struct comm_base *base, size_t bufsize,
 
 /** helper pending delete */
 static void
-pending_node_del(rbnode_type* node, void* arg)
+pending_node_del(struct outnet_hash_node* node, void* arg)
 {
 	struct pending* pend = (struct pending*)node;
 	struct outside_network* outnet = (struct outside_network*)arg;
@@ -886,7 +1037,7 @@ pending_node_del(rbnode_type* node, void* arg)
 
 /** helper serviced delete */
 static void
-serviced_node_del(rbnode_type* node, void* ATTR_UNUSED(arg))
+serviced_node_del(struct outnet_hash_node* node, void* ATTR_UNUSED(arg))
 {
 	struct serviced_query* sq = (struct serviced_query*)node;
 	struct service_callback* p = sq->cblist, *np;
@@ -918,15 +1069,11 @@ outside_network_delete(struct outside_network* outnet)
 		return;
 	outnet->want_to_quit = 1;
 	/* check every element, since we can be called on malloc error */
-	if(outnet->pending) {
-		/* free pending elements, but do no unlink from tree. */
-		traverse_postorder(outnet->pending, pending_node_del, NULL);
-		free(outnet->pending);
-	}
-	if(outnet->serviced) {
-		traverse_postorder(outnet->serviced, serviced_node_del, NULL);
-		free(outnet->serviced);
-	}
+	/* free pending elements, but do no unlink from table. */
+	outnet_hash_traverse(&outnet->pending, pending_node_del, NULL);
+	outnet_hash_clear(&outnet->pending);
+	outnet_hash_traverse(&outnet->serviced, serviced_node_del, NULL);
+	outnet_hash_clear(&outnet->serviced);
 	if(outnet->udp_buff)
 		sldns_buffer_free(outnet->udp_buff);
 	if(outnet->unused_fds) {
@@ -1019,7 +1166,7 @@ pending_delete(struct outside_network* outnet, struct pending* p)
 		}
 	}
 	if(outnet) {
-		(void)rbtree_delete(outnet->pending, p->node.key);
+		outnet_hash_remove(&outnet->pending, &p->node);
 	}
 	if(p->timer)
 		comm_timer_delete(p->timer);
@@ -1082,8 +1229,7 @@ udp_sockport(struct sockaddr_storage* addr, socklen_t addrlen, int pfxlen,
 	return fd;
 }
 
-/** Select random ID */
-static int
+int
 select_id(struct outside_network* outnet, struct pending* pend,
 	sldns_buffer* packet)
 {
@@ -1091,12 +1237,13 @@ select_id(struct outside_network* outnet, struct pending* pend,
 	pend->id = ((unsigned)ub_random(outnet->rnd)>>8) & 0xffff;
 	LDNS_ID_SET(sldns_buffer_begin(packet), pend->id);
 
-	/* insert in tree */
-	pend->node.key = pend;
-	while(!rbtree_insert(outnet->pending, &pend->node)) {
+	/* insert in table */
+	pend->node.hash = pending_hash(pend, outnet->hash_seed);
+	while(outnet_pending_lookup(&outnet->pending, pend)) {
 		/* change ID to avoid collision */
 		pend->id = ((unsigned)ub_random(outnet->rnd)>>8) & 0xffff;
 		LDNS_ID_SET(sldns_buffer_begin(packet), pend->id);
+		pend->node.hash = pending_hash(pend, outnet->hash_seed);
 		id_tries++;
 		if(id_tries == MAX_ID_RETRY) {
 			pend->id=99999; /* non existant ID */
@@ -1104,6 +1251,7 @@ select_id(struct outside_network* outnet, struct pending* pend,
 			return 0;
 		}
 	}
+	outnet_hash_insert(&outnet->pending, &pend->node);
 	verbose(VERB_ALGO, "inserted new pending reply id=%4.4x", pend->id);
 	return 1;
 }
@@ -1239,7 +1387,6 @@ pending_udp_query(struct serviced_query* sq, struct sldns_buffer* packet,
 	memmove(&pend->addr, &sq->addr, sq->addrlen);
 	pend->cb = cb;
 	pend->cb_arg = cb_arg;
-	pend->node.key = pend;
 	pend->timer = comm_timer_create(sq->outnet->base, pending_udp_timer_cb,
 		pend);
 	if(!pend->timer) {
@@ -1387,14 +1534,12 @@ serviced_gen_query(sldns_buffer* buff, uint8_t* qname, size_t qnamelen,
 	sldns_buffer_flip(buff);
 }
 
-/** lookup serviced query in serviced query rbtree */
-static struct serviced_query*
+struct serviced_query*
 lookup_serviced(struct outside_network* outnet, sldns_buffer* buff, int dnssec,
 	struct sockaddr_storage* addr, socklen_t addrlen,
 	struct edns_option* opt_list)
 {
 	struct serviced_query key;
-	key.node.key = &key;
 	key.qbuf = sldns_buffer_begin(buff);
 	key.qbuflen = sldns_buffer_limit(buff);
 	key.dnssec = dnssec;
@@ -1402,7 +1547,8 @@ lookup_serviced(struct outside_network* outnet, sldns_buffer* buff, int dnssec,
 	key.addrlen = addrlen;
 	key.outnet = outnet;
 	key.opt_list = opt_list;
-	return (struct serviced_query*)rbtree_search(outnet->serviced, &key);
+	key.node.hash = serviced_hash(&key, outnet->hash_seed);
+	return outnet_serviced_lookup(&outnet->serviced, &key);
 }
 
 /** Create new serviced entry */
@@ -1413,12 +1559,8 @@ serviced_create(struct outside_network* outnet, sldns_buffer* buff, int dnssec,
 	uint8_t* zone, size_t zonelen, int qtype, struct edns_option* opt_list)
 {
 	struct serviced_query* sq = (struct serviced_query*)malloc(sizeof(*sq));
-#ifdef UNBOUND_DEBUG
-	rbnode_type* ins;
-#endif
 	if(!sq) 
 		return NULL;
-	sq->node.key = sq;
 	sq->qbuf = memdup(sldns_buffer_begin(buff), sldns_buffer_limit(buff));
 	if(!sq->qbuf) {
 		free(sq);
@@ -1468,13 +1610,9 @@ serviced_create(struct outside_network* outnet, sldns_buffer* buff, int dnssec,
 	sq->status = serviced_initial;
 	sq->retry = 0;
 	sq->to_be_deleted = 0;
-#ifdef UNBOUND_DEBUG
-	ins = 
-#else
-	(void)
-#endif
-	rbtree_insert(outnet->serviced, &sq->node);
-	log_assert(ins != NULL); /* must not be already present */
+	/* the caller has looked it up, it is not already present */
+	sq->node.hash = serviced_hash(sq, outnet->hash_seed);
+	outnet_hash_insert(&outnet->serviced, &sq->node);
 	return sq;
 }
 
@@ -1710,14 +1848,14 @@ serviced_callbacks(struct serviced_query* sq, int error, struct comm_point* c,
 	uint8_t *backup_p = NULL;
 	size_t backlen = 0;
 #ifdef UNBOUND_DEBUG
-	rbnode_type* rem =
+	int rem =
 #else
 	(void)
 #endif
-	/* remove from tree, and schedule for deletion, so that callbacks
+	/* remove from table, and schedule for deletion, so that callbacks
 	 * can safely deregister themselves and even create new serviced
 	 * queries that are identical to this one. */
-	rbtree_delete(sq->outnet->serviced, sq);
+	outnet_hash_remove(&sq->outnet->serviced, &sq->node);
 	log_assert(rem); /* should have been present */
 	sq->to_be_deleted = 1; 
 	verbose(VERB_ALGO, "svcd callbacks start");
@@ -2138,7 +2276,8 @@ outnet_serviced_query(struct outside_network* outnet,
 		/* perform first network action */
 		if(outnet->do_udp && !(tcp_upstream || ssl_upstream)) {
 			if(!serviced_udp_send(sq, buff)) {
-				(void)rbtree_delete(outnet->serviced, sq);
+				(void)outnet_hash_remove(&outnet->serviced,
+					&sq->node);
 				free(sq->qbuf);
 				free(sq->zone);
 				free(sq);
@@ -2147,7 +2286,8 @@ outnet_serviced_query(struct outside_network* outnet,
 			}
 		} else {
 			if(!serviced_tcp_send(sq, buff)) {
-				(void)rbtree_delete(outnet->serviced, sq);
+				(void)outnet_hash_remove(&outnet->serviced,
+					&sq->node);
 				free(sq->qbuf);
 				free(sq->zone);
 				free(sq);
@@ -2187,7 +2327,7 @@ void outnet_serviced_query_stop(struct serviced_query* sq, void* cb_arg)
 	callback_list_remove(sq, cb_arg);
 	/* if callbacks() routine scheduled deletion, let it do that */
 	if(!sq->cblist && !sq->to_be_deleted) {
-		(void)rbtree_delete(sq->outnet->serviced, sq);
+		(void)outnet_hash_remove(&sq->outnet->serviced, &sq->node);
 		serviced_delete(sq); 
 	}
 }
@@ -2464,6 +2604,7 @@ size_t outnet_get_mem(struct outside_network* outnet)
 	struct waiting_tcp* w;
 	struct pending* u;
 	struct serviced_query* sq;
+	struct outnet_hash_node* n;
 	struct service_callback* sb;
 	struct port_comm* pc;
 	size_t s = sizeof(*outnet) + sizeof(*outnet->base) + 
@@ -2489,15 +2630,18 @@ size_t outnet_get_mem(struct outside_network* outnet)
 	}
 	for(w=outnet->tcp_wait_first; w; w = w->next_waiting)
 		s += waiting_tcp_get_mem(w);
-	s += sizeof(*outnet->pending);
+	s += sizeof(struct outnet_hash_node*) * outnet->pending.size;
 	s += (sizeof(struct pending) + comm_timer_get_mem(NULL)) * 
-		outnet->pending->count;
-	s += sizeof(*outnet->serviced);
+		outnet->pending.count;
+	s += sizeof(struct outnet_hash_node*) * outnet->serviced.size;
 	s += outnet->svcd_overhead;
-	RBTREE_FOR(sq, struct serviced_query*, outnet->serviced) {
-		s += sizeof(*sq) + sq->qbuflen;
-		for(sb = sq->cblist; sb; sb = sb->next)
-			s += sizeof(*sb);
+	for(i=0; i<outnet->serviced.size; i++) {
+		for(n = outnet->serviced.array[i]; n; n = n->next) {
+			sq = (struct serviced_query*)n;
+			s += sizeof(*sq) + sq->qbuflen;
+			for(sb = sq->cblist; sb; sb = sb->next)
+				s += sizeof(*sb);
+		}
 	}
 	return s;
 }
@@ -43,7 +43,7 @@
 #ifndef OUTSIDE_NETWORK_H
 #define OUTSIDE_NETWORK_H
 
-#include "util/rbtree.h"
+#include "util/storage/lruhash.h"
 #include "util/netevent.h"
 #include "dnstap/dnstap_config.h"
 struct pending;
@@ -63,6 +63,36 @@ struct module_env;
 struct module_qstate;
 struct query_info;
 
+/** start size of the hash tables of pending and serviced queries */
+#define OUTNET_HASH_START 1024
+
+/**
+ * Entry in a hash table of the outside network, the first member of the
+ * struct that is hashed.
+ */
+struct outnet_hash_node {
+	/** next entry in the same bucket */
+	struct outnet_hash_node* next;
+	/** hash value of the entry */
+	hashvalue_type hash;
+};
+
+/**
+ * Hash table of pending or serviced queries.  The entries are chained
+ * in the buckets, and the table doubles when it holds more entries than
+ * buckets.  It is used by one thread, and has no locks.
+ */
+struct outnet_hash {
+	/** the buckets, size is a power of two */
+	struct outnet_hash_node** array;
+	/** number of buckets */
+	size_t size;
+	/** size-1, to find the bucket for a hash value */
+	size_t mask;
+	/** number of entries */
+	size_t count;
+};
+
 /**
  * Send queries to outside servers and wait for answers from servers.
  * Contains answer-listen sockets.
@@ -122,10 +152,13 @@ struct outside_network {
 	/** last pending udp query in list */
 	struct pending* udp_wait_last;
 
-	/** pending udp answers. sorted by id, addr */
-	rbtree_type* pending;
-	/** serviced queries, sorted by qbuf, addr, dnssec */
-	rbtree_type* serviced;
+	/** pending udp answers, hashed by id, addr */
+	struct outnet_hash pending;
+	/** serviced queries, hashed by qbuf, addr, dnssec */
+	struct outnet_hash serviced;
+	/** random seed for the hash values, so that the buckets of the
+	 * queries cannot be picked by whoever picks the query names */
+	uint32_t hash_seed;
 	/** host cache, pointer but not owned by outnet. */
 	struct infra_cache* infra;
 	/** where to get random numbers */
@@ -209,11 +242,11 @@ struct port_comm {
  * A query that has an answer pending for it.
  */
 struct pending {
-	/** redblacktree entry, key is the pending struct(id, addr). */
-	rbnode_type node;
+	/** hash table entry, key is the pending struct(id, addr). */
+	struct outnet_hash_node node;
 	/** the ID for the query. int so that a value out of range can
 	 * be used to signify a pending that is for certain not present in
-	 * the rbtree. (and for which deletion is safe). */
+	 * the hash table. */
 	unsigned int id;
 	/** remote address. */
 	struct sockaddr_storage addr;
@@ -318,8 +351,8 @@ struct service_callback {
  * receive a callback.
  */
 struct serviced_query {
-	/** The rbtree node, key is this record */
-	rbnode_type node;
+	/** The hash table entry, key is this record */
+	struct outnet_hash_node node;
 	/** The query that needs to be answered. Starts with flags u16,
 	 * then qdcount, ..., including qname, qtype, qclass. Does not include
 	 * EDNS record. */
@@ -627,10 +660,102 @@ int serviced_udp_callback(struct comm_point* c, void* arg, int error,
 int serviced_tcp_callback(struct comm_point* c, void* arg, int error,
         struct comm_reply* rep);
 
-/** compare function of pending rbtree */
+/** compare function of pending queries, on id and address */
 int pending_cmp(const void* key1, const void* key2);
 
-/** compare function of serviced query rbtree */
+/** compare function of serviced queries, on qbuf, addr, dnssec */
 int serviced_cmp(const void* key1, const void* key2);
 
+/**
+ * Setup the buckets of a hash table of the outside network.
+ * @param h: hash table to setup.
+ * @param size: number of buckets, a power of two.
+ * @return false on malloc failure.
+ */
+int outnet_hash_init(struct outnet_hash* h, size_t size);
+
+/**
+ * Free the buckets of a hash table, the entries are not freed.
+ * @param h: hash table.
+ */
+void outnet_hash_clear(struct outnet_hash* h);
+
+/**
+ * Insert an entry in a hash table, its hash value is set.  The table
+ * doubles when it is full, if that fails the chains become longer.
+ * @param h: hash table.
+ * @param n: the entry, not already in the table.
+ */
+void outnet_hash_insert(struct outnet_hash* h, struct outnet_hash_node* n);
+
+/**
+ * Remove an entry from a hash table.  This is the entry itself, not one
+ * that is equal to it.  Nothing happens if it is not in the table.
+ * @param h: hash table.
+ * @param n: the entry.
+ * @return true if it was in the table.
+ */
+int outnet_hash_remove(struct outnet_hash* h, struct outnet_hash_node* n);
+
+/**
+ * Hash value of a pending query, on the id and the address.
+ * @param p: pending query with id and addr.
+ * @param seed: random seed of the outside network.
+ * @return hash value.
+ */
+hashvalue_type pending_hash(struct pending* p, uint32_t seed);
+
+/**
+ * Hash value of a serviced query, on the same fields that serviced_cmp
+ * compares, except for the EDNS options.
+ * @param sq: serviced query with qbuf, addr, dnssec.
+ * @param seed: random seed of the outside network.
+ * @return hash value.
+ */
+hashvalue_type serviced_hash(struct serviced_query* sq, uint32_t seed);
+
+/**
+ * Find the pending query that is equal to the key.
+ * @param h: hash table of pending queries.
+ * @param key: with id, addr and the hash value in node.hash.
+ * @return the pending query or NULL.
+ */
+struct pending* outnet_pending_lookup(struct outnet_hash* h,
+	struct pending* key);
+
+/**
+ * Find the serviced query that is equal to the key.
+ * @param h: hash table of serviced queries.
+ * @param key: with qbuf, addr, dnssec, opt_list and the hash value in
+ *	node.hash.
+ * @return the serviced query or NULL.
+ */
+struct serviced_query* outnet_serviced_lookup(struct outnet_hash* h,
+	struct serviced_query* key);
+
+/**
+ * Select a random ID for a pending query, one that is not in use for
+ * the address, and insert the query in the pending table.
+ * @param outnet: outside network with the pending table.
+ * @param pend: pending query with addr, its id and node.hash are set.
+ * @param packet: the query packet, the ID is written in it.
+ * @return false if no unused ID was found, the query is not inserted.
+ */
+int select_id(struct outside_network* outnet, struct pending* pend,
+	struct sldns_buffer* packet);
+
+/**
+ * Lookup a serviced query in the serviced query hash table.
+ * @param outnet: outside network with the serviced table.
+ * @param buff: the query packet.
+ * @param dnssec: the dnssec flags of the query.
+ * @param addr: upstream address.
+ * @param addrlen: length of addr.
+ * @param opt_list: EDNS options of the query.
+ * @return the serviced query or NULL.
+ */
+struct serviced_query* lookup_serviced(struct outside_network* outnet,
+	struct sldns_buffer* buff, int dnssec, struct sockaddr_storage* addr,
+	socklen_t addrlen, struct edns_option* opt_list);
+
 #endif /* OUTSIDE_NETWORK_H */
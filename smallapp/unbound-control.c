@@ -42,6 +42,7 @@
  */
 
 #include "config.h"
+#include <ctype.h>
 #ifdef HAVE_GETOPT_H
 #include <getopt.h>
 #endif
@@ -61,6 +62,7 @@
 #include "util/shm_side/shm_main.h"
 #include "daemon/stats.h"
 #include "sldns/wire2str.h"
+#include "sldns/parseutil.h"
 #include "sldns/pkthdr.h"
 
 #ifdef HAVE_SYS_IPC_H
@@ -123,6 +125,7 @@ usage(void)
 	printf("  flush_stats 			flush statistics, make zero\n");
 	printf("  flush_requestlist 		drop queries that are worked on\n");
 	printf("  dump_requestlist		show what is worked on by first thread\n");
+	printf("  dump_slow_queries		show slow traced queries of first thread\n");
 	printf("  flush_infra [all | ip] 	remove ping, edns for one IP or all\n");
 	printf("  dump_infra			show ping and edns entries\n");
 	printf("  set_option opt: val		set option to value, no reload\n");
@@ -197,10 +200,15 @@ timeval_divide(struct timeval* avg, const struct timeval* sum, long long d)
 	(long long)var ## _sec, (int)var ## _usec);
 #define PR_LL(str, var) printf(str SQ ARG_LL"d\n", (long long)(var));
 
+/** names of the mesh scheduling classes, in stats order */
+static const char* mesh_class_names[UB_STATS_MESH_CLASS_NUM] = {
+	"client", "prefetch", "internal" };
+
 /** print stat block */
 static void pr_stats(const char* nm, struct ub_stats_info* s)
 {
 	struct timeval sumwait, avg;
+	int i;
 	PR_UL_NM("num.queries", s->svr.num_queries);
 	PR_UL_NM("num.queries_ip_ratelimited", 
 		s->svr.num_queries_ip_ratelimited);
@@ -208,8 +216,13 @@ static void pr_stats(const char* nm, struct ub_stats_info* s)
 		s->svr.num_queries - s->svr.num_queries_missed_cache);
 	PR_UL_NM("num.cachemiss", s->svr.num_queries_missed_cache);
 	PR_UL_NM("num.prefetch", s->svr.num_queries_prefetch);
+	PR_UL_NM("num.refresh", s->svr.num_refresh);
+	PR_UL_NM("num.refresh.useful", s->svr.num_refresh_useful);
+	PR_UL_NM("num.refresh.upstream", s->svr.num_refresh_upstream);
 	PR_UL_NM("num.zero_ttl", s->svr.zero_ttl_responses);
 	PR_UL_NM("num.recursivereplies", s->mesh_replies_sent);
+	PR_UL_NM("num.handoff.out", s->svr.num_handoff_out);
+	PR_UL_NM("num.handoff.in", s->svr.num_handoff_in);
 #ifdef USE_DNSCRYPT
     PR_UL_NM("num.dnscrypt.crypted", s->svr.num_query_dnscrypt_crypted);
     PR_UL_NM("num.dnscrypt.cert", s->svr.num_query_dnscrypt_cert);
@@ -223,10 +236,31 @@ static void pr_stats(const char* nm, struct ub_stats_info* s)
 			(double)(s->svr.num_queries_missed_cache+
 			s->svr.num_queries_prefetch) : 0.0);
 	PR_UL_NM("requestlist.max", s->svr.max_query_list_size);
+	printf("%s.requestlist.imbalance"SQ"%g\n", nm, s->mesh_imbalance);
 	PR_UL_NM("requestlist.overwritten", s->mesh_jostled);
 	PR_UL_NM("requestlist.exceeded", s->mesh_dropped);
+	PR_UL_NM("requestlist.fairshare.clients", s->mesh_fair_clients);
+	PR_UL_NM("requestlist.fairshare.evicted", s->mesh_fair_evicted);
+	PR_UL_NM("requestlist.fairshare.dropped", s->mesh_fair_dropped);
 	PR_UL_NM("requestlist.current.all", s->mesh_num_states);
 	PR_UL_NM("requestlist.current.user", s->mesh_num_reply_states);
+	for(i=0; i<UB_STATS_MESH_CLASS_NUM; i++) {
+		printf("%s.requestlist.class.%s.current"SQ"%lu\n", nm,
+			mesh_class_names[i], (unsigned long)s->mesh_class_num[i]);
+		printf("%s.requestlist.class.%s.exceeded"SQ"%lu\n", nm,
+			mesh_class_names[i],
+			(unsigned long)s->mesh_class_dropped[i]);
+		printf("%s.requestlist.class.%s.finished"SQ"%lu\n", nm,
+			mesh_class_names[i], (unsigned long)s->mesh_class_done[i]);
+#ifndef S_SPLINT_S
+		sumwait.tv_sec = s->mesh_class_sum_wait_sec[i];
+		sumwait.tv_usec = s->mesh_class_sum_wait_usec[i];
+#endif
+		timeval_divide(&avg, &sumwait, s->mesh_class_done[i]);
+		printf("%s.requestlist.class.%s.time.avg"SQ ARG_LL
+			"d.%6.6d\n", nm, mesh_class_names[i],
+			(long long)avg.tv_sec, (int)avg.tv_usec);
+	}
 #ifndef S_SPLINT_S
 	sumwait.tv_sec = s->mesh_replies_sum_wait_sec;
 	sumwait.tv_usec = s->mesh_replies_sum_wait_usec;
@@ -358,12 +392,18 @@ static void print_extended(struct ub_stats_info* s)
 	}
 	/* iteration */
 	PR_UL("num.query.ratelimited", s->svr.queries_ratelimited);
+	PR_UL("num.query.hedged", s->svr.queries_hedged);
+	PR_UL("num.query.hedge_denied", s->svr.queries_hedge_denied);
+	PR_UL("num.query.minimise.skipped", s->svr.queries_minimise_skipped);
 	/* validation */
 	PR_UL("num.answer.secure", s->svr.ans_secure);
 	PR_UL("num.answer.bogus", s->svr.ans_bogus);
 	PR_UL("num.rrset.bogus", s->svr.rrset_bogus);
+	PR_UL("num.rrset.unchanged", s->svr.rrset_unchanged);
 	PR_UL("num.query.aggressive.NOERROR", s->svr.num_neg_cache_noerror);
 	PR_UL("num.query.aggressive.NXDOMAIN", s->svr.num_neg_cache_nxdomain);
+	PR_UL("num.query.aggressive.nsec3", s->svr.num_neg_cache_nsec3);
+	PR_UL("num.query.dname.synth", s->svr.num_dname_synth);
 	/* threat detection */
 	PR_UL("unwanted.queries", s->svr.unwanted_queries);
 	PR_UL("unwanted.replies", s->svr.unwanted_replies);
@@ -372,6 +412,26 @@ static void print_extended(struct ub_stats_info* s)
 	PR_UL("rrset.cache.count", s->svr.rrset_cache_count);
 	PR_UL("infra.cache.count", s->svr.infra_cache_count);
 	PR_UL("key.cache.count", s->svr.key_cache_count);
+	PR_UL("sig.cache.count", s->svr.sig_cache_count);
+	PR_UL("num.sig.cache.hit", s->svr.num_sig_cache_hit);
+	PR_UL("num.sig.cache.miss", s->svr.num_sig_cache_miss);
+	PR_UL("nsec3.hash.cache.count", s->svr.nsec3_hash_cache_count);
+	PR_UL("num.nsec3.hash.cache.hit", s->svr.num_nsec3_hash_hit);
+	PR_UL("num.nsec3.hash.cache.miss", s->svr.num_nsec3_hash_miss);
+	PR_UL("num.nsec3.hash.ratelimited", s->svr.num_nsec3_hash_ratelimited);
+	for(i=0; i<UB_STATS_ALGO_NUM; i++) {
+		sldns_lookup_table* lt;
+		char alg[32];
+		if(inhibit_zero && s->svr.num_sig_verify[i] == 0 &&
+			s->svr.num_sig_skip[i] == 0)
+			continue;
+		lt = sldns_lookup_by_id(sldns_algorithms, i);
+		if(lt && lt->name)
+			snprintf(alg, sizeof(alg), "%s", lt->name);
+		else	snprintf(alg, sizeof(alg), "ALG%d", i);
+		PR_UL_SUB("num.val.sig.verify", alg, s->svr.num_sig_verify[i]);
+		PR_UL_SUB("num.val.sig.skip", alg, s->svr.num_sig_skip[i]);
+	}
 #ifdef USE_DNSCRYPT
 	PR_UL("dnscrypt_shared_secret.cache.count",
 			 s->svr.shared_secret_cache_count);
@@ -383,12 +443,57 @@ static void print_extended(struct ub_stats_info* s)
 #endif /* USE_DNSCRYPT */
 	PR_UL("num.query.authzone.up", s->svr.num_query_authzone_up);
 	PR_UL("num.query.authzone.down", s->svr.num_query_authzone_down);
+	PR_UL("num.alloc.regional.reused", s->svr.num_alloc_reg_reused);
+	PR_UL("num.alloc.regional.new", s->svr.num_alloc_reg_new);
+	PR_UL("num.alloc.chunk.reused", s->svr.num_alloc_chunk_reused);
+	PR_UL("num.alloc.chunk.new", s->svr.num_alloc_chunk_new);
 #ifdef CLIENT_SUBNET
 	PR_UL("num.query.subnet", s->svr.num_query_subnet);
 	PR_UL("num.query.subnet_cache", s->svr.num_query_subnet_cache);
 #endif
 }
 
+/** print the per module query trace stats, module names from config */
+static void print_trace(struct config_file* cfg, struct ub_stats_info* s)
+{
+	char nm[64];
+	const char* p = cfg->module_conf;
+	struct timeval sum, avg;
+	int m, b;
+	size_t len;
+	PR_UL("trace.queries", s->svr.trace_num);
+	PR_UL("trace.slow", s->svr.trace_num_slow);
+	for(m=0; p && m<UB_STATS_TRACE_MODULE_NUM; m++) {
+		while(*p && isspace((unsigned char)*p))
+			p++;
+		if(!*p)
+			break;
+		len = 0;
+		while(p[len] && !isspace((unsigned char)p[len]))
+			len++;
+		snprintf(nm, sizeof(nm), "%.*s", (int)len, p);
+		p += len;
+		printf("trace.module.%s.queries"SQ"%lu\n", nm,
+			(unsigned long)s->svr.trace_mod_num[m]);
+#ifndef S_SPLINT_S
+		sum.tv_sec = s->svr.trace_mod_sum_sec[m];
+		sum.tv_usec = s->svr.trace_mod_sum_usec[m];
+#endif
+		timeval_divide(&avg, &sum, s->svr.trace_mod_num[m]);
+		printf("trace.module.%s.time.avg"SQ ARG_LL "d.%6.6d\n", nm,
+			(long long)avg.tv_sec, (int)avg.tv_usec);
+		for(b=0; b<UB_STATS_TRACE_BUCKET_NUM; b++) {
+			/* bucket b is from 2^(b-1) to 2^b msec */
+			long lo = (b==0)?0:(1L<<(b-1)), hi = 1L<<b;
+			printf("trace.module.%s.histogram.%6.6d.%6.6d.to."
+				"%6.6d.%6.6d"SQ"%lu\n", nm,
+				(int)(lo/1000), (int)((lo%1000)*1000),
+				(int)(hi/1000), (int)((hi%1000)*1000),
+				(unsigned long)s->svr.trace_mod_hist[m][b]);
+		}
+	}
+}
+
 /** print statistics out of memory structures */
 static void do_stats_shm(struct config_file* cfg, struct ub_stats_info* stats,
 	struct ub_shm_stat_info* shm_stat)
@@ -406,6 +511,8 @@ static void do_stats_shm(struct config_file* cfg, struct ub_stats_info* stats,
 		print_hist(stats);
 		print_extended(stats);
 	}
+	if(cfg->trace_sample_rate != 0)
+		print_trace(cfg, stats);
 }
 #endif /* HAVE_SHMGET */
 
@@ -56,6 +56,10 @@
 #include "services/listen_dnsport.h"
 #include "services/outside_network.h"
 #include "services/cache/infra.h"
+#include "services/mesh.h"
+#include "daemon/worker.h"
+#include "daemon/stats.h"
+#include "libunbound/unbound.h"
 #include "testcode/replay.h"
 #include "testcode/testpkts.h"
 #include "util/log.h"
@@ -165,6 +169,7 @@ repevt_string(enum replay_event_type t)
 	case repevt_assign:	 return "ASSIGN";
 	case repevt_traffic:	 return "TRAFFIC";
 	case repevt_infra_rtt:	 return "INFRA_RTT";
+	case repevt_stats_check: return "CHECK_STATS";
 	default:		 return "UNKNOWN";
 	}
 }
@@ -698,6 +703,85 @@ do_infra_rtt(struct replay_runtime* runtime)
 	free(dp);
 }
 
+/** statistics that CHECK_STATS can check, with their place in the
+ * server statistics */
+static const struct {
+	/** name as printed by unbound-control stats */
+	const char* name;
+	/** offset of the value in struct ub_server_stats */
+	size_t offset;
+} stats_check_list[] = {
+	{ "num.answer.secure", offsetof(struct ub_server_stats, ans_secure) },
+	{ "num.answer.bogus", offsetof(struct ub_server_stats, ans_bogus) },
+	{ "num.zero_ttl", offsetof(struct ub_server_stats,
+		zero_ttl_responses) },
+	{ "num.rrset.unchanged", offsetof(struct ub_server_stats,
+		rrset_unchanged) },
+	{ "num.query.hedged", offsetof(struct ub_server_stats,
+		queries_hedged) },
+	{ "num.query.hedge_denied", offsetof(struct ub_server_stats,
+		queries_hedge_denied) },
+	{ "num.query.dname.synth", offsetof(struct ub_server_stats,
+		num_dname_synth) },
+	{ "trace.queries", offsetof(struct ub_server_stats, trace_num) },
+	{ "trace.slow", offsetof(struct ub_server_stats, trace_num_slow) },
+	{ NULL, 0 }
+};
+
+/** find the offset of a trace.module.<name>.queries statistic, by the
+ * module name, returns 0 if it is not such a statistic */
+static size_t
+stats_check_trace_module(struct worker* worker, const char* name)
+{
+	const char* pre = "trace.module.", *post = ".queries";
+	size_t len = strlen(name), prelen = strlen(pre),
+		postlen = strlen(post);
+	int m;
+	if(len <= prelen + postlen || strncmp(name, pre, prelen) != 0 ||
+		strcmp(name + len - postlen, post) != 0)
+		return 0;
+	for(m=0; m<worker->env.mesh->mods.num &&
+		m<UB_STATS_TRACE_MODULE_NUM; m++) {
+		const char* nm = worker->env.mesh->mods.mod[m]->name;
+		if(strlen(nm) == len - prelen - postlen &&
+			strncmp(name + prelen, nm, strlen(nm)) == 0)
+			return offsetof(struct ub_server_stats, trace_mod_num)
+				+ m*sizeof(long long);
+	}
+	return 0;
+}
+
+/** check a statistic of the worker */
+static void
+stats_check(struct replay_runtime* runtime, struct replay_moment* mom)
+{
+	struct worker* worker = (struct worker*)runtime->cb_arg;
+	struct ub_stats_info s;
+	long long val;
+	size_t offset;
+	int i;
+	if(!worker)
+		fatal_exit("stats_check STEP %d: no worker", mom->time_step);
+	for(i=0; stats_check_list[i].name; i++) {
+		if(strcmp(stats_check_list[i].name, mom->variable) == 0)
+			break;
+	}
+	if(stats_check_list[i].name)
+		offset = stats_check_list[i].offset;
+	else if(!(offset = stats_check_trace_module(worker, mom->variable)))
+		fatal_exit("stats_check STEP %d: unknown statistic %s",
+			mom->time_step, mom->variable);
+	memset(&s, 0, sizeof(s));
+	server_stats_compile(worker, &s, 0);
+	memmove(&val, ((uint8_t*)&s.svr) + offset, sizeof(val));
+	if(val != atoll(mom->string)) {
+		log_err("stats_check STEP %d: %s=%lld, expected %s",
+			mom->time_step, mom->variable, val, mom->string);
+		fatal_exit("stats_check STEP %d failed", mom->time_step);
+	}
+	log_info("stats %s=%lld is OK", mom->variable, val);
+}
+
 /** perform exponential backoff on the timeout */
 static void
 expon_timeout_backoff(struct replay_runtime* runtime)
@@ -803,6 +887,10 @@ do_moment_and_advance(struct replay_runtime* runtime)
 		do_infra_rtt(runtime);
 		advance_moment(runtime);
 		break;
+	case repevt_stats_check:
+		stats_check(runtime, runtime->now);
+		advance_moment(runtime);
+		break;
 	default:
 		fatal_exit("testbound: unknown event type %d", 
 			runtime->now->evt_type);
@@ -820,6 +908,13 @@ run_scenario(struct replay_runtime* runtime)
 	runtime->now = runtime->scenario->mom_first;
 	log_info("testbound: entering fake runloop");
 	do {
+		/* the fake event base does not listen on the tube of the
+		 * crypto threads, wait for the work they do */
+		if(runtime->cb_arg) {
+			struct worker* worker = (struct worker*)runtime->cb_arg;
+			while(worker->env.mesh->async_waiting > 0)
+				mesh_async_wait(worker->env.mesh);
+		}
 		/* if moment matches pending query do it. */
 		/* else if moment matches given answer, do it */
 		/* else if precoded_range matches pending, do it */
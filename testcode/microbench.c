@@ -0,0 +1,894 @@
+/*
+ * testcode/microbench.c - micro benchmarks of internal code paths.
+ *
+ * Copyright (c) 2026, NLnet Labs. All rights reserved.
+ *
+ * This software is open source.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 
+ * Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ * 
+ * Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ * 
+ * Neither the name of the NLNET LABS nor the names of its contributors may
+ * be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ * TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * \file
+ *
+ * This program times internal code paths, before and after optimisations.
+ * It is not run by the tests, use it by hand, eg.
+ * microbench verify testdata/test_sigs.rsasha256 20070829144150
+ * microbench negcache 8
+ * microbench delegpt 1000
+ * microbench outnet 20000
+ */
+
+#include "config.h"
+#ifdef HAVE_GETOPT_H
+#include <getopt.h>
+#endif
+#include <sys/time.h>
+#include "util/log.h"
+#include "util/locks.h"
+#include "util/alloc.h"
+#include "util/regional.h"
+#include "util/module.h"
+#include "util/config_file.h"
+#include "util/data/msgreply.h"
+#include "util/data/msgparse.h"
+#include "util/storage/slabhash.h"
+#include "validator/validator.h"
+#include "validator/val_sigcrypt.h"
+#include "validator/val_secalgo.h"
+#include "validator/val_sigcache.h"
+#include "validator/val_neg.h"
+#include "services/cache/rrset.h"
+#include "services/mesh.h"
+#include "services/outside_network.h"
+#include "iterator/iter_delegpt.h"
+#include "util/net_help.h"
+#include "util/data/dname.h"
+#include "testcode/testpkts.h"
+#include "sldns/sbuffer.h"
+#include "sldns/rrdef.h"
+#include "sldns/str2wire.h"
+
+/** give microbench usage, and exit (1). */
+static void
+usage(char* nm)
+{
+	printf("usage: %s [options] test [args]\n", nm);
+	printf("-n num	number of repeats, default 1000\n");
+	printf("-h	this help text\n");
+	printf("tests:\n");
+	printf("  verify file date	RRSIG verification of a signature test\n");
+	printf("			file, without and with the parsed\n");
+	printf("			public key cache, and with the\n");
+	printf("			signature cache\n");
+	printf("  negcache threads	aggressive NSEC lookups, with some\n");
+	printf("			inserts, in the negative cache from\n");
+	printf("			1, 2, 4 .. threads at the same time\n");
+	printf("  delegpt names	build a delegation point with that\n");
+	printf("			many nameservers and glue, region and\n");
+	printf("			malloced, and look up every name\n");
+	printf("  delegcache depth	find the closest zone cut for names\n");
+	printf("			that many labels below it, label by\n");
+	printf("			label, with the delegation cache and\n");
+	printf("			with the name itself looked up first\n");
+	printf("  outnet queries	send and answer outgoing queries, with\n");
+	printf("			that many outstanding, the lookups of\n");
+	printf("			the outside network in rbtrees and in\n");
+	printf("			hash tables\n");
+	exit(1);
+}
+
+/** get time in seconds */
+static double
+bench_now(void)
+{
+	struct timeval tv;
+	if(gettimeofday(&tv, NULL) < 0)
+		fatal_exit("gettimeofday: %s", strerror(errno));
+	return (double)tv.tv_sec + (double)tv.tv_usec / 1000000.0;
+}
+
+/** print the result of a timed loop */
+static void
+bench_report(const char* test, const char* variant, size_t count,
+	double elapsed)
+{
+	printf("%s %s: %u in %.3f sec, %.0f per sec\n", test, variant,
+		(unsigned)count, elapsed,
+		elapsed > 0.0 ? (double)count/elapsed : 0.0);
+}
+
+/** parse the reply of a testpkts entry */
+static struct reply_info*
+bench_parse_entry(struct entry* e, struct alloc_cache* alloc,
+	struct regional* region, sldns_buffer* pkt)
+{
+	struct query_info qinfo;
+	struct reply_info* rep = NULL;
+	struct edns_data edns;
+	int ret;
+	if(!e->reply_list)
+		return NULL;
+	if(e->reply_list->reply_from_hex) {
+		sldns_buffer_copy(pkt, e->reply_list->reply_from_hex);
+	} else {
+		sldns_buffer_clear(pkt);
+		sldns_buffer_write(pkt, e->reply_list->reply_pkt,
+			e->reply_list->reply_len);
+		sldns_buffer_flip(pkt);
+	}
+	lock_quick_lock(&alloc->lock);
+	ret = reply_info_parse(pkt, alloc, &qinfo, &rep, region, &edns);
+	lock_quick_unlock(&alloc->lock);
+	if(ret != 0)
+		return NULL;
+	query_info_clear(&qinfo);
+	return rep;
+}
+
+/** time verification of the signed rrsets in the file */
+static void
+bench_verify(const char* fname, const char* at_date, int num)
+{
+	struct regional* region = regional_create();
+	struct alloc_cache alloc;
+	sldns_buffer* buf = sldns_buffer_new(65535);
+	struct entry* list = read_datafile(fname, 1);
+	struct entry* e;
+	struct reply_info* keyrep, *reps[256];
+	struct ub_packed_rrset_key* dnskey = NULL;
+	struct module_env env;
+	struct val_env ve;
+	struct config_file* cfg = NULL;
+	time_t now = time(NULL);
+	size_t nreps = 0, i, j, count;
+	int pass, n;
+	double start;
+
+	if(!region || !buf)
+		fatal_exit("out of memory");
+	if(!list)
+		fatal_exit("could not read %s: %s", fname, strerror(errno));
+	alloc_init(&alloc, NULL, 1);
+	memset(&env, 0, sizeof(env));
+	memset(&ve, 0, sizeof(ve));
+	env.scratch = region;
+	env.scratch_buffer = buf;
+	env.now = &now;
+	ve.date_override = cfg_convert_timeval(at_date);
+
+	/* the first entry has the DNSKEY rrset, the others the data */
+	if(!(keyrep = bench_parse_entry(list, &alloc, region, buf)))
+		fatal_exit("could not parse the DNSKEY entry");
+	for(i=0; i<keyrep->an_numrrsets; i++) {
+		if(ntohs(keyrep->rrsets[i]->rk.type) == LDNS_RR_TYPE_DNSKEY)
+			dnskey = keyrep->rrsets[i];
+	}
+	if(!dnskey)
+		fatal_exit("no DNSKEY in the first entry");
+	for(e = list->next; e && nreps < sizeof(reps)/sizeof(reps[0]);
+		e = e->next) {
+		if((reps[nreps] = bench_parse_entry(e, &alloc, region, buf)))
+			nreps++;
+	}
+
+	for(pass = 0; pass < 3; pass++) {
+		if(pass == 1) {
+			ve.pkey_cache = secalgo_keycache_create(1024*1024, 4);
+			if(!ve.pkey_cache)
+				fatal_exit("out of memory");
+		} else if(pass == 2) {
+			if(!(cfg = config_create()) ||
+				!(ve.sigcache = val_sigcache_create(cfg)))
+				fatal_exit("out of memory");
+		}
+		count = 0;
+		start = bench_now();
+		for(n = 0; n < num; n++) {
+			for(i=0; i<nreps; i++) {
+				for(j=0; j<reps[i]->rrset_count; j++) {
+					char* reason = NULL;
+					regional_free_all(region);
+					(void)dnskeyset_verify_rrset(&env, &ve,
+						reps[i]->rrsets[j], dnskey,
+						NULL, &reason,
+						LDNS_SECTION_ANSWER, NULL);
+					count++;
+				}
+			}
+		}
+		bench_report("verify", pass==0?"no-keycache":(pass==1?
+			"keycache":"sigcache"), count, bench_now() - start);
+	}
+
+	val_sigcache_delete(ve.sigcache);
+	config_delete(cfg);
+	slabhash_delete(ve.pkey_cache);
+	for(i=0; i<nreps; i++)
+		reply_info_parsedelete(reps[i], &alloc);
+	reply_info_parsedelete(keyrep, &alloc);
+	delete_entry(list);
+	regional_destroy(region);
+	alloc_clear(&alloc);
+	sldns_buffer_free(buf);
+}
+
+/** number of zones in the negcache test */
+#define BENCH_NEG_ZONES 16
+/** number of NSEC records per zone in the negcache test */
+#define BENCH_NEG_NSECS 256
+
+/** make the wire format name n<k><suffix>.z<z>.bench., or the zone name
+ * z<z>.bench. if k is -1 */
+static size_t
+bench_neg_name(uint8_t* buf, int z, int k, const char* suffix)
+{
+	char str[64];
+	size_t len = LDNS_MAX_DOMAINLEN+1;
+	if(k < 0)
+		snprintf(str, sizeof(str), "z%d.bench.", z);
+	else	snprintf(str, sizeof(str), "n%3.3d%s.z%d.bench.", k, suffix,
+			z);
+	if(sldns_str2wire_dname_buf(str, buf, &len) != 0)
+		fatal_exit("could not parse %s", str);
+	return len;
+}
+
+/** store the NSEC of n<k>.z<z>.bench., or of the zone apex if k is -1,
+ * in the rrset cache and the negative cache */
+static void
+bench_neg_add(struct val_neg_cache* neg, struct rrset_cache* rrset_cache,
+	struct alloc_cache* alloc, struct regional* region, int z, int k,
+	time_t now)
+{
+	uint8_t owner[LDNS_MAX_DOMAINLEN+1], next[LDNS_MAX_DOMAINLEN+1];
+	uint8_t zname[LDNS_MAX_DOMAINLEN+1];
+	size_t ownerlen, nextlen, zlen, rdlen;
+	struct ub_packed_rrset_key key, *ck;
+	struct packed_rrset_data* d;
+	struct val_neg_zone* zone;
+	struct rrset_ref ref;
+
+	ownerlen = bench_neg_name(owner, z, k, "");
+	nextlen = bench_neg_name(next, z, (k+1)%BENCH_NEG_NSECS, "");
+	zlen = bench_neg_name(zname, z, -1, "");
+	/* rdata length, next name, and a bitmap with type A */
+	rdlen = 2 + nextlen + 3;
+	d = (struct packed_rrset_data*)regional_alloc_zero(region, sizeof(*d)
+		+ sizeof(size_t) + sizeof(uint8_t*) + sizeof(time_t) + rdlen);
+	if(!d)
+		fatal_exit("out of memory");
+	d->ttl = 3600;
+	d->count = 1;
+	d->trust = rrset_trust_validated;
+	d->security = sec_status_secure;
+	d->rr_len = (size_t*)(d+1);
+	d->rr_len[0] = rdlen;
+	packed_rrset_ptr_fixup(d);
+	d->rr_ttl[0] = 3600;
+	sldns_write_uint16(d->rr_data[0], (uint16_t)(rdlen-2));
+	memmove(d->rr_data[0]+2, next, nextlen);
+	d->rr_data[0][2+nextlen] = 0;
+	d->rr_data[0][2+nextlen+1] = 1;
+	d->rr_data[0][2+nextlen+2] = 0x40;
+	memset(&key, 0, sizeof(key));
+	key.rk.dname = owner;
+	key.rk.dname_len = ownerlen;
+	key.rk.type = htons(LDNS_RR_TYPE_NSEC);
+	key.rk.rrset_class = htons(LDNS_RR_CLASS_IN);
+	if(k < 0)
+		key.rk.flags = PACKED_RRSET_NSEC_AT_APEX;
+	key.entry.key = &key;
+	key.entry.data = d;
+	key.entry.hash = rrset_key_hash(&key.rk);
+	if(!(ck = packed_rrset_copy_alloc(&key, alloc, now)))
+		fatal_exit("out of memory");
+	ref.key = ck;
+	ref.id = ck->id;
+	(void)rrset_cache_update(rrset_cache, &ref, alloc, now);
+
+	lock_rw_wrlock(&neg->lock);
+	zone = neg_find_zone(neg, zname, zlen, LDNS_RR_CLASS_IN);
+	if(!zone && !(zone = neg_create_zone(neg, zname, zlen,
+		LDNS_RR_CLASS_IN)))
+		fatal_exit("out of memory");
+	val_neg_zone_take_inuse(zone);
+	neg_insert_data(neg, zone, &key);
+	lock_rw_unlock(&neg->lock);
+}
+
+/** a thread of the negcache test */
+struct bench_neg_thr {
+	/** thread id */
+	ub_thread_type tid;
+	/** thread number */
+	int num;
+	/** number of lookups to do */
+	int count;
+	/** number of lookups that made an answer */
+	int found;
+	/** the negative cache */
+	struct val_neg_cache* neg;
+	/** the rrset cache with the NSEC records */
+	struct rrset_cache* rrset_cache;
+	/** config with aggressive-nsec */
+	struct config_file* cfg;
+	/** the per thread stats of the answers */
+	struct mesh_area mesh;
+};
+
+/** the negcache test thread: look up names that the NSECs deny, and
+ * insert an NSEC again every 64 lookups */
+static void*
+bench_neg_thread(void* arg)
+{
+	struct bench_neg_thr* t = (struct bench_neg_thr*)arg;
+	struct regional* region = regional_create();
+	sldns_buffer* buf = sldns_buffer_new(65535);
+	struct alloc_cache alloc;
+	uint8_t qname[LDNS_MAX_DOMAINLEN+1];
+	struct query_info qinfo;
+	unsigned int rnd = (unsigned int)t->num + 1;
+	time_t now = time(NULL);
+	int i, z, k;
+
+	if(!region || !buf)
+		fatal_exit("out of memory");
+	alloc_init(&alloc, NULL, t->num+1);
+	memset(&qinfo, 0, sizeof(qinfo));
+	qinfo.qname = qname;
+	qinfo.qtype = LDNS_RR_TYPE_A;
+	qinfo.qclass = LDNS_RR_CLASS_IN;
+	for(i=0; i<t->count; i++) {
+		rnd = rnd*1103515245 + 12345;
+		z = (int)((rnd>>16)%BENCH_NEG_ZONES);
+		k = (int)((rnd>>4)%BENCH_NEG_NSECS);
+		regional_free_all(region);
+		if(i%64 == 63) {
+			bench_neg_add(t->neg, t->rrset_cache, &alloc, region,
+				z, k, now);
+			continue;
+		}
+		qinfo.qname_len = bench_neg_name(qname, z, k, "a");
+		if(val_neg_getmsg(t->neg, &qinfo, region, t->rrset_cache,
+			buf, now, 0, NULL, t->cfg, &t->mesh))
+			t->found++;
+	}
+	alloc_clear(&alloc);
+	regional_destroy(region);
+	sldns_buffer_free(buf);
+	return NULL;
+}
+
+/** time negative cache lookups from an increasing number of threads */
+static void
+bench_negcache(int maxthreads, int num)
+{
+	struct regional* region = regional_create();
+	struct config_file* cfg = config_create();
+	struct alloc_cache alloc;
+	struct rrset_cache* rrset_cache;
+	struct val_neg_cache* neg;
+	struct bench_neg_thr* thr;
+	time_t now = time(NULL);
+	int nthr, i, z, k, found;
+	char variant[32];
+	double start;
+
+	if(!region || !cfg)
+		fatal_exit("out of memory");
+	cfg->aggressive_nsec = 1;
+	cfg->neg_cache_size = 64*1024*1024;
+	alloc_init(&alloc, NULL, 0);
+	if(!(rrset_cache = rrset_cache_create(cfg, &alloc)) ||
+		!(neg = val_neg_create(cfg, 150)) ||
+		!(thr = (struct bench_neg_thr*)calloc((size_t)maxthreads,
+		sizeof(*thr))))
+		fatal_exit("out of memory");
+	for(z=0; z<BENCH_NEG_ZONES; z++) {
+		for(k=-1; k<BENCH_NEG_NSECS; k++) {
+			bench_neg_add(neg, rrset_cache, &alloc, region, z, k,
+				now);
+			regional_free_all(region);
+		}
+	}
+
+	for(nthr=1; nthr <= maxthreads; nthr *= 2) {
+		start = bench_now();
+		for(i=0; i<nthr; i++) {
+			memset(&thr[i], 0, sizeof(thr[i]));
+			thr[i].num = i;
+			thr[i].count = num;
+			thr[i].neg = neg;
+			thr[i].rrset_cache = rrset_cache;
+			thr[i].cfg = cfg;
+			ub_thread_create(&thr[i].tid, bench_neg_thread,
+				&thr[i]);
+		}
+		found = 0;
+		for(i=0; i<nthr; i++) {
+			ub_thread_join(thr[i].tid);
+			found += thr[i].found;
+			if((size_t)thr[i].found !=
+				thr[i].mesh.stats_neg_noerror +
+				thr[i].mesh.stats_neg_nxdomain)
+				fatal_exit("negative cache answers not counted");
+		}
+		if(found == 0)
+			fatal_exit("no answers from the negative cache");
+		snprintf(variant, sizeof(variant), "%d threads", nthr);
+		bench_report("negcache", variant, (size_t)nthr*(size_t)num,
+			bench_now() - start);
+	}
+
+	free(thr);
+	neg_cache_delete(neg);
+	rrset_cache_delete(rrset_cache);
+	config_delete(cfg);
+	alloc_clear(&alloc);
+	regional_destroy(region);
+}
+
+/** make the synthetic nameserver name number i, in wire format */
+static uint8_t*
+bench_dp_name(int i)
+{
+	char str[64];
+	uint8_t buf[LDNS_MAX_DOMAINLEN+1];
+	size_t len = sizeof(buf);
+	uint8_t* nm;
+	snprintf(str, sizeof(str), "ns%d.host%d.example.net.", i, i%97);
+	if(sldns_str2wire_dname_buf(str, buf, &len) != 0)
+		fatal_exit("could not parse %s", str);
+	if(!(nm = memdup(buf, len)))
+		fatal_exit("out of memory");
+	return nm;
+}
+
+/** make the synthetic glue address number i */
+static void
+bench_dp_addr(int i, struct sockaddr_storage* addr, socklen_t* addrlen)
+{
+	char str[32];
+	snprintf(str, sizeof(str), "10.%d.%d.%d", (i>>16)&0xff,
+		(i>>8)&0xff, i&0xff);
+	if(!ipstrtoaddr(str, UNBOUND_DNS_PORT, addr, addrlen))
+		fatal_exit("could not parse %s", str);
+}
+
+/** check that every name is in the delegation point, with its address */
+static void
+bench_dp_lookup(struct delegpt* dp, uint8_t** names, int nsnum)
+{
+	struct sockaddr_storage addr;
+	socklen_t addrlen;
+	struct delegpt_ns* ns;
+	int i;
+	for(i=0; i<nsnum; i++) {
+		ns = delegpt_find_ns(dp, names[i], dname_valid(names[i],
+			LDNS_MAX_DOMAINLEN+1));
+		bench_dp_addr(i, &addr, &addrlen);
+		if(!ns || !ns->got4 || !delegpt_find_addr(dp, &addr,
+			addrlen))
+			fatal_exit("delegpt lookup failed for %d", i);
+	}
+}
+
+/** build delegation points with many nameservers and glue, time the adds
+ * and the lookups */
+static void
+bench_delegpt(int nsnum, int num)
+{
+	struct regional* region = regional_create();
+	uint8_t** names;
+	uint8_t* zone;
+	struct sockaddr_storage addr;
+	socklen_t addrlen;
+	struct delegpt* dp;
+	size_t len;
+	int i, r;
+	double start;
+
+	if(!region || !(names = (uint8_t**)calloc((size_t)nsnum,
+		sizeof(*names))))
+		fatal_exit("out of memory");
+	for(i=0; i<nsnum; i++)
+		names[i] = bench_dp_name(i);
+	zone = names[0] + 4; /* skip the ns0 label, host0.example.net */
+
+	start = bench_now();
+	for(r=0; r<num; r++) {
+		if(!(dp = delegpt_create(region)) ||
+			!delegpt_set_name(dp, region, zone))
+			fatal_exit("out of memory");
+		for(i=0; i<nsnum; i++) {
+			if(!delegpt_add_ns(dp, region, names[i], 0))
+				fatal_exit("out of memory");
+		}
+		for(i=0; i<nsnum; i++) {
+			len = dname_valid(names[i], LDNS_MAX_DOMAINLEN+1);
+			bench_dp_addr(i, &addr, &addrlen);
+			if(!delegpt_add_target(dp, region, names[i], len,
+				&addr, addrlen, 0, 0))
+				fatal_exit("out of memory");
+		}
+		bench_dp_lookup(dp, names, nsnum);
+		regional_free_all(region);
+	}
+	bench_report("delegpt", "region", (size_t)num*(size_t)nsnum,
+		bench_now() - start);
+
+	start = bench_now();
+	for(r=0; r<num; r++) {
+		if(!(dp = delegpt_create_mlc(zone)))
+			fatal_exit("out of memory");
+		for(i=0; i<nsnum; i++) {
+			if(!delegpt_add_ns_mlc(dp, names[i], 0))
+				fatal_exit("out of memory");
+		}
+		for(i=0; i<nsnum; i++) {
+			len = dname_valid(names[i], LDNS_MAX_DOMAINLEN+1);
+			bench_dp_addr(i, &addr, &addrlen);
+			if(!delegpt_add_target_mlc(dp, names[i], len, &addr,
+				addrlen, 0, 0))
+				fatal_exit("out of memory");
+		}
+		bench_dp_lookup(dp, names, nsnum);
+		delegpt_free_mlc(dp);
+	}
+	bench_report("delegpt", "malloc", (size_t)num*(size_t)nsnum,
+		bench_now() - start);
+
+	for(i=0; i<nsnum; i++)
+		free(names[i]);
+	free(names);
+	regional_destroy(region);
+}
+
+/** number of zones in the delegcache test, half has a cut below it */
+#define BENCH_CUT_ZONES 1000
+
+/** make the name of zone z, with the sub. cut if sub is true, and lab
+ * labels in front of it, in wire format. returns length */
+static size_t
+bench_cut_name(uint8_t* buf, int z, int sub, int lab)
+{
+	char str[LDNS_MAX_DOMAINLEN+1];
+	size_t len = LDNS_MAX_DOMAINLEN+1, p = 0;
+	int i;
+	for(i=0; i<lab; i++)
+		p += (size_t)snprintf(str+p, sizeof(str)-p, "l%d.", i);
+	snprintf(str+p, sizeof(str)-p, "%sz%d.bench.", sub?"sub.":"", z);
+	if(sldns_str2wire_dname_buf(str, buf, &len) != 0)
+		fatal_exit("could not parse %s", str);
+	return len;
+}
+
+/** store an NS rrset for the name in the rrset cache */
+static void
+bench_cut_add(struct rrset_cache* rrset_cache, struct alloc_cache* alloc,
+	struct regional* region, uint8_t* nm, size_t nmlen, time_t now)
+{
+	uint8_t rdata[] = "\000\004\002ns\000";
+	struct ub_packed_rrset_key key, *ck;
+	struct packed_rrset_data* d;
+	struct rrset_ref ref;
+	d = (struct packed_rrset_data*)regional_alloc_zero(region, sizeof(*d)
+		+ sizeof(size_t) + sizeof(uint8_t*) + sizeof(time_t) + 6);
+	if(!d)
+		fatal_exit("out of memory");
+	d->ttl = 3600;
+	d->count = 1;
+	d->trust = rrset_trust_auth_AA;
+	d->rr_len = (size_t*)(d+1);
+	d->rr_len[0] = 6;
+	packed_rrset_ptr_fixup(d);
+	d->rr_ttl[0] = 3600;
+	memmove(d->rr_data[0], rdata, 6);
+	memset(&key, 0, sizeof(key));
+	key.rk.dname = nm;
+	key.rk.dname_len = nmlen;
+	key.rk.type = htons(LDNS_RR_TYPE_NS);
+	key.rk.rrset_class = htons(LDNS_RR_CLASS_IN);
+	key.entry.key = &key;
+	key.entry.data = d;
+	key.entry.hash = rrset_key_hash(&key.rk);
+	if(!(ck = packed_rrset_copy_alloc(&key, alloc, now)))
+		fatal_exit("out of memory");
+	ref.key = ck;
+	ref.id = ck->id;
+	(void)rrset_cache_update(rrset_cache, &ref, alloc, now);
+}
+
+/** find the closest cut by a lookup for every label, like before the
+ * delegation cache */
+static struct ub_packed_rrset_key*
+bench_cut_walk(struct rrset_cache* rrset_cache, uint8_t* nm, size_t nmlen,
+	time_t now)
+{
+	struct ub_packed_rrset_key* k;
+	while(nmlen > 0) {
+		if((k = rrset_cache_lookup(rrset_cache, nm, nmlen,
+			LDNS_RR_TYPE_NS, LDNS_RR_CLASS_IN, 0, now, 0)))
+			return k;
+		nmlen -= (size_t)*nm + 1;
+		nm += (size_t)*nm + 1;
+	}
+	return NULL;
+}
+
+/** time the lookup of the closest zone cut for names depth labels below
+ * the cut */
+static void
+bench_delegcache(int depth, int num)
+{
+	struct regional* region = regional_create();
+	struct alloc_cache alloc;
+	struct rrset_cache* rrset_cache;
+	uint8_t nm[LDNS_MAX_DOMAINLEN+1];
+	uint8_t** names;
+	size_t* lens;
+	struct ub_packed_rrset_key* k;
+	time_t now = time(NULL);
+	int i, z, variant;
+	double start;
+
+	if(!region || !(names = (uint8_t**)calloc(BENCH_CUT_ZONES,
+		sizeof(*names))) || !(lens = (size_t*)calloc(BENCH_CUT_ZONES,
+		sizeof(*lens))))
+		fatal_exit("out of memory");
+	alloc_init(&alloc, NULL, 0);
+	if(!(rrset_cache = rrset_cache_create(NULL, &alloc)))
+		fatal_exit("out of memory");
+	bench_cut_add(rrset_cache, &alloc, region, (uint8_t*)"", 1, now);
+	bench_cut_add(rrset_cache, &alloc, region, (uint8_t*)"\005bench",
+		7, now);
+	for(z=0; z<BENCH_CUT_ZONES; z++) {
+		size_t len = bench_cut_name(nm, z, 0, 0);
+		bench_cut_add(rrset_cache, &alloc, region, nm, len, now);
+		if(z%2 == 0) {
+			len = bench_cut_name(nm, z, 1, 0);
+			bench_cut_add(rrset_cache, &alloc, region, nm, len,
+				now);
+		}
+		lens[z] = bench_cut_name(nm, z, z%2 == 0, depth);
+		if(!(names[z] = memdup(nm, lens[z])))
+			fatal_exit("out of memory");
+		regional_free_all(region);
+	}
+
+	for(variant=0; variant<3; variant++) {
+		start = bench_now();
+		for(i=0; i<num; i++) {
+			z = i%BENCH_CUT_ZONES;
+			if(variant == 0)
+				k = bench_cut_walk(rrset_cache, names[z],
+					lens[z], now);
+			else	k = rrset_cache_lookup_cut(rrset_cache,
+					names[z], lens[z], LDNS_RR_CLASS_IN,
+					variant==2, now);
+			if(!k || dname_count_labels(k->rk.dname) !=
+				dname_count_labels(names[z]) - depth)
+				fatal_exit("wrong zone cut for %d", z);
+			lock_rw_unlock(&k->entry.lock);
+		}
+		bench_report("delegcache", variant==0?"label walk":(
+			variant==1?"delegation cache":"name first"),
+			(size_t)num, bench_now() - start);
+	}
+
+	for(z=0; z<BENCH_CUT_ZONES; z++)
+		free(names[z]);
+	free(names);
+	free(lens);
+	rrset_cache_delete(rrset_cache);
+	alloc_clear(&alloc);
+	regional_destroy(region);
+}
+
+/** number of upstream servers in the outnet test */
+#define BENCH_OUTNET_SERVERS 100
+
+/** make the serviced query for query i, to one of the servers */
+static void
+bench_outnet_query(struct serviced_query* sq, int i)
+{
+	char str[64];
+	uint8_t nm[LDNS_MAX_DOMAINLEN+1];
+	size_t len = sizeof(nm);
+	struct sockaddr_in* in = (struct sockaddr_in*)&sq->addr;
+	snprintf(str, sizeof(str), "q%d.z%d.bench.", i,
+		i%BENCH_OUTNET_SERVERS);
+	if(sldns_str2wire_dname_buf(str, nm, &len) != 0)
+		fatal_exit("could not parse %s", str);
+	memset(sq, 0, sizeof(*sq));
+	sq->qbuflen = 10 + len + 4;
+	if(!(sq->qbuf = (uint8_t*)calloc(1, sq->qbuflen)))
+		fatal_exit("out of memory");
+	sldns_write_uint16(sq->qbuf+2, 1);
+	memmove(sq->qbuf+10, nm, len);
+	sldns_write_uint16(sq->qbuf+10+len, LDNS_RR_TYPE_A);
+	sldns_write_uint16(sq->qbuf+10+len+2, LDNS_RR_CLASS_IN);
+	sq->dnssec = 1;
+	in->sin_family = AF_INET;
+	in->sin_port = htons(53);
+	in->sin_addr.s_addr = htonl(0x0a000000 + i%BENCH_OUTNET_SERVERS);
+	sq->addrlen = (socklen_t)sizeof(*in);
+}
+
+/** time the lookups of the outside network for queries that are sent,
+ * with a serviced query and a pending id, and answered, with outstanding
+ * queries in flight */
+static void
+bench_outnet(int outstanding, int num)
+{
+	/* twice as many query names as outstanding, so the outstanding
+	 * names are all different */
+	int nq = outstanding*2, i, slot, variant;
+	struct serviced_query* sqs, *sq;
+	struct pending* pends, *p, key;
+	rbnode_type* snodes, *pnodes;
+	rbtree_type stree, ptree;
+	struct outnet_hash shash, phash;
+	unsigned int rnd = 12345;
+	uint32_t seed = 0x5eed;
+	double start;
+
+	if(!(sqs = (struct serviced_query*)calloc((size_t)nq,
+		sizeof(*sqs))) || !(pends = (struct pending*)calloc(
+		(size_t)outstanding, sizeof(*pends))) ||
+		!(snodes = (rbnode_type*)calloc((size_t)nq,
+		sizeof(*snodes))) || !(pnodes = (rbnode_type*)calloc(
+		(size_t)outstanding, sizeof(*pnodes))))
+		fatal_exit("out of memory");
+	for(i=0; i<nq; i++)
+		bench_outnet_query(&sqs[i], i);
+
+	for(variant=0; variant<3; variant++) {
+		rbtree_init(&stree, &serviced_cmp);
+		rbtree_init(&ptree, &pending_cmp);
+		if(!outnet_hash_init(&shash, OUTNET_HASH_START) ||
+			!outnet_hash_init(&phash, OUTNET_HASH_START))
+			fatal_exit("out of memory");
+		start = bench_now();
+		for(i=0; i<num; i++) {
+			slot = i%outstanding;
+			p = &pends[slot];
+			if(i >= outstanding) {
+				/* the reply for the oldest query */
+				sq = &sqs[(i-outstanding)%nq];
+				memset(&key, 0, sizeof(key));
+				key.id = p->id;
+				memmove(&key.addr, &p->addr, p->addrlen);
+				key.addrlen = p->addrlen;
+				if(variant == 0) {
+					if(!rbtree_search(&ptree, &key))
+						fatal_exit("pending not found");
+					(void)rbtree_delete(&ptree, p);
+					(void)rbtree_delete(&stree, sq);
+				} else {
+					key.node.hash = pending_hash(&key, seed);
+					if(!outnet_pending_lookup(&phash, &key))
+						fatal_exit("pending not found");
+					outnet_hash_remove(&phash, &p->node);
+					outnet_hash_remove(&shash, &sq->node);
+				}
+			}
+			/* a new query, with a serviced query and pending id */
+			sq = &sqs[i%nq];
+			memmove(&p->addr, &sq->addr, sq->addrlen);
+			p->addrlen = sq->addrlen;
+			if(variant == 0) {
+				if(rbtree_search(&stree, sq))
+					fatal_exit("serviced query exists");
+				snodes[i%nq].key = sq;
+				(void)rbtree_insert(&stree, &snodes[i%nq]);
+				pnodes[slot].key = p;
+				do {
+					rnd = rnd*1103515245 + 12345;
+					p->id = (rnd>>8)&0xffff;
+				} while(!rbtree_insert(&ptree, &pnodes[slot]));
+			} else {
+				sq->node.hash = serviced_hash(sq, seed);
+				if(outnet_serviced_lookup(&shash, sq))
+					fatal_exit("serviced query exists");
+				outnet_hash_insert(&shash, &sq->node);
+				do {
+					rnd = rnd*1103515245 + 12345;
+					p->id = (rnd>>8)&0xffff;
+					p->node.hash = pending_hash(p, seed);
+				} while(outnet_pending_lookup(&phash, p));
+				outnet_hash_insert(&phash, &p->node);
+			}
+		}
+		bench_report("outnet", variant==0?"rbtree":"hash table",
+			(size_t)num, bench_now() - start);
+		outnet_hash_clear(&shash);
+		outnet_hash_clear(&phash);
+	}
+
+	for(i=0; i<nq; i++)
+		free(sqs[i].qbuf);
+	free(sqs);
+	free(pends);
+	free(snodes);
+	free(pnodes);
+}
+
+/** getopt global, in case header files fail to declare it. */
+extern int optind;
+/** getopt global, in case header files fail to declare it. */
+extern char* optarg;
+
+/** main program for microbench */
+int main(int argc, char* argv[])
+{
+	char* nm = argv[0];
+	int c, num = 1000;
+
+	log_init(NULL, 0, NULL);
+	log_ident_set("microbench");
+	checklock_start();
+	while( (c=getopt(argc, argv, "hn:")) != -1) {
+		switch(c) {
+		case 'n':
+			num = atoi(optarg);
+			if(num < 1)
+				fatal_exit("bad number: %s", optarg);
+			break;
+		case 'h':
+		case '?':
+		default:
+			usage(nm);
+		}
+	}
+	argc -= optind;
+	argv += optind;
+	if(argc < 1)
+		usage(nm);
+
+	if(strcmp(argv[0], "verify") == 0 && argc == 3) {
+		bench_verify(argv[1], argv[2], num);
+	} else if(strcmp(argv[0], "negcache") == 0 && argc == 2) {
+		c = atoi(argv[1]);
+		bench_negcache(c<1?1:c, num*100);
+	} else if(strcmp(argv[0], "delegpt") == 0 && argc == 2) {
+		c = atoi(argv[1]);
+		bench_delegpt(c<1?1:c, num);
+	} else if(strcmp(argv[0], "delegcache") == 0 && argc == 2) {
+		c = atoi(argv[1]);
+		bench_delegcache(c<0?0:(c>30?30:c), num*1000);
+	} else if(strcmp(argv[0], "outnet") == 0 && argc == 2) {
+		c = atoi(argv[1]);
+		bench_outnet(c<1?1:c, num*1000);
+	} else {
+		usage(nm);
+	}
+	checklock_stop();
+	return 0;
+}
@@ -365,6 +365,24 @@ replay_moment_read(char* remain, FILE* in, const char* name,
 		mom->string = strdup(m);
 		if(!mom->string) fatal_exit("out of memory");
 		if(!mom->variable) fatal_exit("out of memory");
+	} else if(parse_keyword(&remain, "CHECK_STATS")) {
+		char* m;
+		mom->evt_type = repevt_stats_check;
+		while(isspace((unsigned char)*remain))
+			remain++;
+		m = strchr(remain, ' ');
+		if(!m) fatal_exit("expected two args for CHECK_STATS");
+		m[0] = 0;
+		m++;
+		while(isspace((unsigned char)*m))
+			m++;
+		if(strlen(m)>0 && m[strlen(m)-1]=='\n')
+			m[strlen(m)-1] = 0;
+		mom->variable = strdup(remain);
+		mom->string = strdup(m);
+		if(!mom->string) fatal_exit("out of memory");
+		if(!mom->variable) fatal_exit("out of memory");
+		remain = m + strlen(m);
 	} else {
 		log_err("%d: unknown event type %s", pstate->lineno, remain);
 		free(mom);
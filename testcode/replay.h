@@ -85,6 +85,9 @@
  *      	The file contents is macro expanded before match.
  *      o CHECK_TEMPFILE [fname] - followed by FILE_BEGIN [to match] FILE_END
  *      o INFRA_RTT [ip] [dp] [rtt] - update infra cache entry with rtt.
+ *      o CHECK_STATS [name] [value] - check the statistic, num.query.hedged
+ *		and the other names in the list in fake_event.c, and
+ *		trace.module.<name>.queries.
  *      o ERROR
  * ; following entry starts on the next line, ENTRY_BEGIN.
  * ; more STEP items
@@ -212,6 +215,8 @@ struct replay_moment {
 		repevt_assign,
 		/** store infra rtt cache entry: addr and string (int) */
 		repevt_infra_rtt,
+		/** check a statistic: variable (name) and string (value) */
+		repevt_stats_check,
 		/** cause traffic to flow */
 		repevt_traffic
 	}
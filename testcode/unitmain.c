@@ -401,6 +401,59 @@ config_tag_test(void)
 		(uint8_t*)"\001\000\001", 3, (uint8_t*)"\001", 1
 		) == 1);
 }
+
+/** read config file text with the lexer and parser, they are generated
+ * files and the new options have to be in them */
+static struct config_file*
+config_read_str(const char* str)
+{
+	struct config_file* cfg = config_create();
+	char fname[64];
+	FILE* out;
+	unit_assert(cfg);
+	snprintf(fname, sizeof(fname), "/tmp/unittest_%u_cfg.tmp",
+		(unsigned)getpid());
+	out = fopen(fname, "w");
+	unit_assert(out);
+	fputs(str, out);
+	fclose(out);
+	unit_assert(config_read(cfg, fname, NULL));
+	unlink(fname);
+	return cfg;
+}
+
+/** test config_file: options read from a config file */
+static void
+config_options_test(void)
+{
+	struct config_file* cfg;
+	unit_show_func("util/configparser.y", "server options");
+	cfg = config_read_str("server:\n"
+		"	hedge-percentile: 90\n"
+		"	hedge-budget: 10\n");
+	unit_assert(cfg->hedge_percentile == 90);
+	unit_assert(cfg->hedge_budget == 10);
+	config_delete(cfg);
+
+	cfg = config_read_str("server:\n"
+		"	refresh-popular: yes\n"
+		"	refresh-popular-rate: 50\n"
+		"	refresh-popular-size: 1000\n");
+	unit_assert(cfg->refresh_popular == 1);
+	unit_assert(cfg->refresh_popular_rate == 50);
+	unit_assert(cfg->refresh_popular_size == 1000);
+	config_delete(cfg);
+
+	cfg = config_read_str("server:\n"
+		"	serve-expired-client-timeout: 1800\n");
+	unit_assert(cfg->serve_expired_client_timeout == 1800);
+	config_delete(cfg);
+
+	cfg = config_read_str("server:\n"
+		"	synth-insecure-dname: yes\n");
+	unit_assert(cfg->synth_insecure_dname == 1);
+	config_delete(cfg);
+}
 	
 #include "util/rtt.h"
 #include "util/timehist.h"
@@ -413,6 +466,7 @@ rtt_test(void)
 	int init = UNKNOWN_SERVER_NICENESS;
 	int i;
 	struct rtt_info r;
+	struct rtt_sketch s;
 	unit_show_func("util/rtt.c", "rtt_timeout");
 	rtt_init(&r);
 	/* initial value sensible */
@@ -431,6 +485,32 @@ rtt_test(void)
 	}
 	/* must be the same, timehist bucket is used in stats */
 	unit_assert(UB_STATS_BUCKET_NUM == NUM_BUCKETS_HIST);
+
+	unit_show_func("util/rtt.c", "rtt_sketch_percentile");
+	rtt_sketch_init(&s);
+	for(i=0; i<RTT_SKETCH_MIN-1; i++)
+		rtt_sketch_add(&s, 50);
+	/* too few samples */
+	unit_assert( rtt_sketch_percentile(&s, 50) == 0 );
+	rtt_sketch_add(&s, 50);
+	unit_assert( rtt_sketch_percentile(&s, 50) >= 48 &&
+		rtt_sketch_percentile(&s, 50) < 64 );
+	unit_assert( rtt_sketch_percentile(&s, 99) >= 48 &&
+		rtt_sketch_percentile(&s, 99) < 64 );
+	/* 5 msec with 10% outliers at 800 msec */
+	rtt_sketch_init(&s);
+	for(i=0; i<1000; i++)
+		rtt_sketch_add(&s, (i%10==0)?800:5);
+	unit_assert( s.total <= RTT_SKETCH_DECAY );
+	unit_assert( rtt_sketch_percentile(&s, 50) >= 4 &&
+		rtt_sketch_percentile(&s, 50) < 6 );
+	unit_assert( rtt_sketch_percentile(&s, 99) >= 768 &&
+		rtt_sketch_percentile(&s, 99) < 1024 );
+	/* old samples fade out */
+	for(i=0; i<2000; i++)
+		rtt_sketch_add(&s, 100);
+	unit_assert( rtt_sketch_percentile(&s, 99) >= 96 &&
+		rtt_sketch_percentile(&s, 99) < 128 );
 }
 
 #include "services/cache/infra.h"
@@ -457,8 +537,8 @@ static struct infra_data* infra_lookup_host(struct infra_cache* infra,
 static void
 infra_test(void)
 {
-	struct sockaddr_storage one;
-	socklen_t onelen;
+	struct sockaddr_storage one, two;
+	socklen_t onelen, twolen;
 	uint8_t* zone = (uint8_t*)"\007example\003com\000";
 	size_t zonelen = 13;
 	struct infra_cache* slab;
@@ -469,6 +549,7 @@ infra_test(void)
 	struct infra_key* k;
 	struct infra_data* d;
 	int init = 376;
+	int lame, dlame, rlame, rtt1, rtt2;
 
 	unit_show_feature("infra cache");
 	unit_assert(ipstrtoaddr("127.0.0.1", 53, &one, &onelen));
@@ -526,6 +607,129 @@ infra_test(void)
 			now, &vs, &edns_lame, &to) );
 	unit_assert( vs == 0 && to == init && edns_lame == 1 );
 
+	/* hedging is off, no hedge time */
+	unit_assert( infra_rtt_update(slab, &one, onelen, zone, zonelen,
+		LDNS_RR_TYPE_A, 50, 0, now) );
+	unit_assert( infra_get_hedge_rtt(slab, &one, onelen, zone, zonelen,
+		now) == 0 );
+	infra_delete(slab);
+
+	/* the 90th percentile of 90 fast and 10 slow replies is between */
+	cfg->hedge_percentile = 90;
+	slab = infra_create(cfg);
+	unit_assert( infra_get_hedge_rtt(slab, &one, onelen, zone, zonelen,
+		now) == 0 );
+	for(vs = 0; vs < 2000; vs++) {
+		unit_assert( infra_rtt_update(slab, &one, onelen, zone,
+			zonelen, LDNS_RR_TYPE_A, (vs%10==0)?400:(20+vs%7), 0,
+			now) );
+	}
+	to = infra_get_hedge_rtt(slab, &one, onelen, zone, zonelen, now);
+	unit_assert( to >= 20 && to < 400 );
+	/* timeouts do not change it */
+	unit_assert( infra_rtt_update(slab, &one, onelen, zone, zonelen,
+		LDNS_RR_TYPE_A, -1, to, now) );
+	unit_assert( infra_get_hedge_rtt(slab, &one, onelen, zone, zonelen,
+		now) == to );
+	/* expired entries have no percentile */
+	unit_assert( infra_get_hedge_rtt(slab, &one, onelen, zone, zonelen,
+		now + cfg->host_ttl + 10) == 0 );
+	infra_delete(slab);
+
+	/* without infra-cache-rtt-percentile the rto is the timeout, and
+	 * is used for server selection */
+	slab = infra_create(cfg);
+	for(vs = 0; vs < 1000; vs++) {
+		unit_assert( infra_rtt_update(slab, &one, onelen, zone,
+			zonelen, LDNS_RR_TYPE_A, (vs%10==0)?800:5, 0, now) );
+	}
+	unit_assert( infra_host(slab, &one, onelen, zone, zonelen, now, &vs,
+		&edns_lame, &to) );
+	unit_assert( infra_get_lame_rtt(slab, &one, onelen, zone, zonelen,
+		LDNS_RR_TYPE_A, &lame, &dlame, &rlame, &rtt1, now) );
+	unit_assert( (d=infra_lookup_host(slab, &one, onelen, zone, zonelen,
+		0, now, &k)) );
+	unit_assert( to == rtt_timeout(&d->rtt) );
+	unit_assert( rtt1 == rtt_unclamped(&d->rtt) );
+	lock_rw_unlock(&k->entry.lock);
+	infra_delete(slab);
+
+	/* a consistent 50 msec server is selected before a 5 msec server
+	 * with 10% outliers at 800 msec */
+	cfg->infra_cache_rtt_percentile = 1;
+	slab = infra_create(cfg);
+	unit_assert(ipstrtoaddr("127.0.0.2", 53, &two, &twolen));
+	for(vs = 0; vs < 1000; vs++) {
+		unit_assert( infra_rtt_update(slab, &one, onelen, zone,
+			zonelen, LDNS_RR_TYPE_A, (vs%10==0)?800:5, 0, now) );
+		unit_assert( infra_rtt_update(slab, &two, twolen, zone,
+			zonelen, LDNS_RR_TYPE_A, 50, 0, now) );
+	}
+	unit_assert( infra_get_lame_rtt(slab, &one, onelen, zone, zonelen,
+		LDNS_RR_TYPE_A, &lame, &dlame, &rlame, &rtt1, now) );
+	unit_assert( infra_get_lame_rtt(slab, &two, twolen, zone, zonelen,
+		LDNS_RR_TYPE_A, &lame, &dlame, &rlame, &rtt2, now) );
+	unit_assert( rtt2 < rtt1 );
+	/* the timeout of the consistent server is short */
+	unit_assert( infra_host(slab, &two, twolen, zone, zonelen, now, &vs,
+		&edns_lame, &to) );
+	unit_assert( to < init );
+	infra_delete(slab);
+
+	/* the timeout is shortened by the latency percentile, and still
+	 * backs off when queries are lost */
+	slab = infra_create(cfg);
+	for(vs = 0; vs < 1006; vs++) {
+		/* a few recent slow replies make the rto high, but not
+		 * the 99th percentile */
+		unit_assert( infra_rtt_update(slab, &one, onelen, zone,
+			zonelen, LDNS_RR_TYPE_A, (vs>=1000&&vs%2==0)?400:10,
+			0, now) );
+	}
+	unit_assert( infra_host(slab, &one, onelen, zone, zonelen, now, &vs,
+		&edns_lame, &to) );
+	unit_assert( (d=infra_lookup_host(slab, &one, onelen, zone, zonelen,
+		0, now, &k)) );
+	unit_assert( to*2 < rtt_notimeout(&d->rtt) );
+	lock_rw_unlock(&k->entry.lock);
+	for(lame = 0; lame < 3; lame++) {
+		rtt1 = to;
+		unit_assert( infra_rtt_update(slab, &one, onelen, zone,
+			zonelen, LDNS_RR_TYPE_A, -1, rtt1, now) );
+		unit_assert( infra_host(slab, &one, onelen, zone, zonelen,
+			now, &vs, &edns_lame, &to) );
+		unit_assert( to > rtt1 );
+	}
+	/* simultaneous losses of the same query timeout back off once */
+	unit_assert( infra_rtt_update(slab, &one, onelen, zone, zonelen,
+		LDNS_RR_TYPE_A, -1, rtt1, now) );
+	unit_assert( infra_host(slab, &one, onelen, zone, zonelen, now, &vs,
+		&edns_lame, &to) );
+	unit_assert( to == rtt1*2 );
+	infra_delete(slab);
+
+	/* lost queries count at their timeout, the shortened timeout of
+	 * a host that loses queries goes up, not down */
+	slab = infra_create(cfg);
+	for(vs = 0; vs < 1006; vs++) {
+		unit_assert( infra_rtt_update(slab, &one, onelen, zone,
+			zonelen, LDNS_RR_TYPE_A, (vs>=1000&&vs%2==0)?400:10,
+			0, now) );
+	}
+	unit_assert( infra_host(slab, &one, onelen, zone, zonelen, now, &vs,
+		&edns_lame, &to) );
+	rtt2 = to;
+	for(lame = 0; lame < 20; lame++) {
+		unit_assert( infra_rtt_update(slab, &one, onelen, zone,
+			zonelen, LDNS_RR_TYPE_A, -1, to, now) );
+		unit_assert( infra_rtt_update(slab, &one, onelen, zone,
+			zonelen, LDNS_RR_TYPE_A, 10, 0, now) );
+		unit_assert( infra_host(slab, &one, onelen, zone, zonelen,
+			now, &vs, &edns_lame, &to) );
+		unit_assert( to >= rtt2 );
+	}
+	unit_assert( to > rtt2 );
+
 	infra_delete(slab);
 	config_delete(cfg);
 }
@@ -562,6 +766,514 @@ rnd_test(void)
 	ub_randfree(r);
 }
 
+#include "services/cache/refresh.h"
+/** make query info for the refresh test */
+static void
+refresh_test_qinfo(struct query_info* qinfo, uint8_t* qname, size_t len)
+{
+	memset(qinfo, 0, sizeof(*qinfo));
+	qinfo->qname = qname;
+	qinfo->qname_len = len;
+	qinfo->qtype = LDNS_RR_TYPE_A;
+	qinfo->qclass = LDNS_RR_CLASS_IN;
+}
+
+/** test refresh of popular cache entries */
+static void
+refresh_test(void)
+{
+	uint8_t n1[] = "\003www\007example\003com";
+	uint8_t n2[] = "\004mail\007example\003com";
+	uint8_t n3[] = "\002ns\007example\003com";
+	struct query_info a, b, c;
+	struct ub_randstate* rnd;
+	struct refresh_table* r;
+	time_t now = 1000;
+	size_t mem;
+	unit_show_feature("refresh popular");
+	unit_assert( (rnd = ub_initstate(42, NULL)) );
+	refresh_test_qinfo(&a, n1, sizeof(n1));
+	refresh_test_qinfo(&b, n2, sizeof(n2));
+	refresh_test_qinfo(&c, n3, sizeof(n3));
+
+	/* one refresh per tick, at most two entries */
+	unit_assert( (r = refresh_create(2, 1000/REFRESH_TICK_MSEC, rnd)) );
+	mem = refresh_get_mem(r);
+	unit_assert( !refresh_note(r, &a, BIT_RD, now+100, now+90, now) );
+	unit_assert( !refresh_note(r, &a, BIT_RD, now+100, now+90, now) );
+	unit_assert( !refresh_note(r, &b, BIT_RD, now+100, now+90, now) );
+	unit_assert( r->queries.count == 2 );
+	unit_assert( refresh_get_mem(r) == mem + 2*sizeof(struct refresh_entry)
+		+ sizeof(n1) + sizeof(n2) );
+	/* not due yet */
+	unit_assert( refresh_select(r, now) == 0 );
+	/* a is due, b has too few hits and is dropped */
+	unit_assert( refresh_select(r, now+95) == 1 );
+	unit_assert( r->pick[0]->qname_len == sizeof(n1) );
+	unit_assert( r->pick[0]->refreshed );
+	unit_assert( r->queries.count == 1 );
+	unit_assert( refresh_get_mem(r) == mem + sizeof(struct refresh_entry)
+		+ sizeof(n1) );
+	/* the picked entry is not scanned again */
+	unit_assert( r->due.count == 0 );
+	unit_assert( refresh_select(r, now+95) == 0 );
+	/* the refreshed reply is stored, and is used after the old one
+	 * would have expired */
+	unit_assert( !refresh_note(r, &a, BIT_RD, now+200, now+190, now+96) );
+	unit_assert( refresh_note(r, &a, BIT_RD, now+200, now+190, now+101) );
+	unit_assert( !refresh_note(r, &a, BIT_RD, now+200, now+190, now+102) );
+	unit_assert( r->due.count == 1 );
+	/* full, the least recently hit entry, a, is dropped */
+	unit_assert( !refresh_note(r, &c, BIT_RD, now+200, now+190, now+102) );
+	unit_assert( !refresh_note(r, &b, BIT_RD, now+200, now+190, now+103) );
+	unit_assert( r->queries.count == 2 );
+	unit_assert( r->lru_last->qname_len == sizeof(n3) );
+	unit_assert( r->lru_first->qname_len == sizeof(n2) );
+	/* expired entries are removed */
+	unit_assert( refresh_select(r, now+300) == 0 );
+	unit_assert( r->queries.count == 0 );
+	unit_assert( r->due.count == 0 );
+	unit_assert( refresh_get_mem(r) == mem );
+	refresh_delete(r);
+
+	/* two refreshes per tick, the most popular are picked */
+	unit_assert( (r = refresh_create(10, 2000/REFRESH_TICK_MSEC, rnd)) );
+	refresh_note(r, &a, 0, now+100, now+90, now);
+	refresh_note(r, &a, 0, now+100, now+90, now);
+	refresh_note(r, &a, 0, now+100, now+90, now);
+	refresh_note(r, &b, 0, now+100, now+90, now);
+	refresh_note(r, &b, 0, now+100, now+90, now);
+	refresh_note(r, &b, 0, now+100, now+90, now);
+	refresh_note(r, &b, 0, now+100, now+90, now);
+	refresh_note(r, &c, 0, now+100, now+90, now);
+	refresh_note(r, &c, 0, now+100, now+90, now);
+	unit_assert( refresh_select(r, now+95) == 2 );
+	unit_assert( r->pick[0]->qname_len == sizeof(n2) &&
+		r->pick[0]->hits == 4 );
+	unit_assert( r->pick[1]->qname_len == sizeof(n1) &&
+		r->pick[1]->hits == 3 );
+	/* the next tick gets the remaining one */
+	unit_assert( refresh_select(r, now+95) == 1 );
+	unit_assert( r->pick[0]->qname_len == sizeof(n3) );
+	refresh_delete(r);
+	ub_randfree(rnd);
+}
+
+#include "services/cache/rrset.h"
+#include "services/cache/delegcache.h"
+#include "util/data/dname.h"
+/** store an NS rrset for the name in the rrset cache */
+static void
+deleg_test_add(struct rrset_cache* r, struct alloc_cache* alloc,
+	uint8_t* nm, size_t nmlen, time_t ttl, time_t now)
+{
+	uint8_t rdata[] = "\000\004\002ns\000";
+	struct packed_rrset_data* d;
+	struct ub_packed_rrset_key key, *ck;
+	struct rrset_ref ref;
+	d = (struct packed_rrset_data*)calloc(1, sizeof(*d) + sizeof(size_t)
+		+ sizeof(uint8_t*) + sizeof(time_t) + 6);
+	unit_assert(d);
+	d->ttl = ttl;
+	d->count = 1;
+	d->trust = rrset_trust_auth_AA;
+	d->rr_len = (size_t*)(d+1);
+	d->rr_len[0] = 6;
+	packed_rrset_ptr_fixup(d);
+	d->rr_ttl[0] = ttl;
+	memmove(d->rr_data[0], rdata, 6);
+	memset(&key, 0, sizeof(key));
+	key.rk.dname = nm;
+	key.rk.dname_len = nmlen;
+	key.rk.type = htons(LDNS_RR_TYPE_NS);
+	key.rk.rrset_class = htons(LDNS_RR_CLASS_IN);
+	key.entry.key = &key;
+	key.entry.data = d;
+	key.entry.hash = rrset_key_hash(&key.rk);
+	unit_assert( (ck = packed_rrset_copy_alloc(&key, alloc, now)) );
+	free(d);
+	ref.key = ck;
+	ref.id = ck->id;
+	(void)rrset_cache_update(r, &ref, alloc, now);
+}
+
+/** lookup the closest cut for the name, and check it is the cut, with
+ * and without a lookup of the name itself first */
+static void
+deleg_test_cut(struct rrset_cache* r, uint8_t* nm, size_t nmlen,
+	uint8_t* cut, time_t now)
+{
+	struct ub_packed_rrset_key* k;
+	int at_name;
+	for(at_name=0; at_name<2; at_name++) {
+		k = rrset_cache_lookup_cut(r, nm, nmlen, LDNS_RR_CLASS_IN,
+			at_name, now);
+		if(!cut) {
+			unit_assert(k == NULL);
+			continue;
+		}
+		unit_assert(k != NULL);
+		unit_assert(query_dname_compare(k->rk.dname, cut) == 0);
+		lock_rw_unlock(&k->entry.lock);
+	}
+}
+
+/** number of zone cuts in the delegation cache */
+static size_t
+deleg_test_count(struct deleg_cache* dc)
+{
+	size_t i, n = 0;
+	for(i=0; i<dc->size; i++)
+		n += dc->shard[i].tree.count;
+	return n;
+}
+
+/** test the delegation cache, the index of zone cuts */
+static void
+deleg_cache_test(void)
+{
+	uint8_t root[] = "";
+	uint8_t com[] = "\003com";
+	uint8_t org[] = "\003org";
+	uint8_t ex[] = "\007example\003com";
+	uint8_t sub[] = "\003sub\007example\003com";
+	uint8_t www[] = "\003www\007example\003com";
+	uint8_t deep[] = "\001a\001b\003sub\007example\003com";
+	uint8_t wwworg[] = "\003www\003org";
+	struct alloc_cache alloc;
+	struct rrset_cache* r;
+	time_t now = 1000;
+	size_t i;
+	unit_show_feature("delegation cache");
+	alloc_init(&alloc, NULL, 1);
+	unit_assert( (r = rrset_cache_create(NULL, &alloc)) );
+	unit_assert( r->cuts != NULL );
+	deleg_test_cut(r, www, sizeof(www), NULL, now);
+
+	deleg_test_add(r, &alloc, com, sizeof(com), 3600, now);
+	deleg_test_cut(r, www, sizeof(www), com, now);
+	deleg_test_add(r, &alloc, sub, sizeof(sub), 3600, now);
+	deleg_test_add(r, &alloc, ex, sizeof(ex), 3600, now);
+	deleg_test_cut(r, www, sizeof(www), ex, now);
+	deleg_test_cut(r, deep, sizeof(deep), sub, now);
+	deleg_test_cut(r, ex, sizeof(ex), ex, now);
+	deleg_test_cut(r, wwworg, sizeof(wwworg), NULL, now);
+	/* a cut above the others becomes their parent */
+	deleg_test_add(r, &alloc, root, sizeof(root), 3600, now);
+	deleg_test_cut(r, wwworg, sizeof(wwworg), root, now);
+	deleg_test_cut(r, www, sizeof(www), ex, now);
+	deleg_test_cut(r, com, sizeof(com), com, now);
+	/* storing it again keeps the cut */
+	deleg_test_add(r, &alloc, ex, sizeof(ex), 3600, now);
+	deleg_test_cut(r, deep, sizeof(deep), sub, now);
+	unit_assert( deleg_test_count(r->cuts) == 4 );
+
+	/* an rrset removed from the cache is not used */
+	rrset_cache_remove(r, ex, sizeof(ex), LDNS_RR_TYPE_NS,
+		LDNS_RR_CLASS_IN, 0);
+	deleg_test_cut(r, www, sizeof(www), com, now);
+	deleg_test_cut(r, deep, sizeof(deep), sub, now);
+	deleg_test_add(r, &alloc, ex, sizeof(ex), 3600, now);
+	deleg_test_cut(r, www, sizeof(www), ex, now);
+
+	/* an expired cut is not used */
+	deleg_test_add(r, &alloc, org, sizeof(org), 10, now);
+	deleg_test_cut(r, wwworg, sizeof(wwworg), org, now);
+	deleg_test_cut(r, wwworg, sizeof(wwworg), root, now+20);
+	deleg_test_cut(r, www, sizeof(www), ex, now+20);
+
+	/* the lookups sweep the expired cut from the shards */
+	unit_assert( deleg_test_count(r->cuts) == 5 );
+	for(i=0; i<r->cuts->size; i++) {
+		r->cuts->shard[i].sweep_due = 1;
+		r->cuts->shard[i].sweep_next = rbtree_first(
+			&r->cuts->shard[i].tree);
+	}
+	deleg_test_cut(r, wwworg, sizeof(wwworg), root, now+20);
+	unit_assert( deleg_test_count(r->cuts) == 4 );
+	deleg_test_cut(r, wwworg, sizeof(wwworg), root, now+20);
+	deleg_test_cut(r, deep, sizeof(deep), sub, now+20);
+
+	/* after the cache is cleared, the rrset keys can be freed, and
+	 * the cuts are gone */
+	rrset_cache_clear(r);
+	alloc_clear_special(&alloc);
+	unit_assert( deleg_test_count(r->cuts) == 0 );
+	deleg_test_cut(r, www, sizeof(www), NULL, now+20);
+	deleg_test_add(r, &alloc, com, sizeof(com), 3600, now+20);
+	deleg_test_cut(r, www, sizeof(www), com, now+20);
+
+	rrset_cache_delete(r);
+	alloc_clear(&alloc);
+}
+
+/** store a signed A rrset in the rrset cache, return the update result */
+static int
+unchanged_test_add(struct rrset_cache* r, struct alloc_cache* alloc,
+	uint8_t* nm, size_t nmlen, uint32_t expi, uint32_t incep,
+	enum sec_status sec, time_t now)
+{
+	uint8_t rdata[] = "\000\004\001\002\003\004";
+	/* rdlength, type covered, algorithm, labels, original TTL,
+	 * expiration, inception, key tag, signer, signature */
+	uint8_t sig[] = "\000\027\000\001\010\002\000\000\016\020"
+		"EEEEIIII\060\071\000SSSS";
+	struct packed_rrset_data* d;
+	struct ub_packed_rrset_key key, *ck;
+	struct rrset_ref ref;
+	expi = htonl(expi);
+	incep = htonl(incep);
+	memmove(sig+2+8, &expi, sizeof(expi));
+	memmove(sig+2+12, &incep, sizeof(incep));
+	d = (struct packed_rrset_data*)calloc(1, sizeof(*d) +
+		2*(sizeof(size_t) + sizeof(uint8_t*) + sizeof(time_t)) + 6 +
+		25);
+	unit_assert(d);
+	d->ttl = 3600;
+	d->count = 1;
+	d->rrsig_count = 1;
+	d->trust = rrset_trust_ans_noAA;
+	d->security = sec;
+	d->rr_len = (size_t*)(d+1);
+	d->rr_len[0] = 6;
+	d->rr_len[1] = 25;
+	packed_rrset_ptr_fixup(d);
+	d->rr_ttl[0] = 3600;
+	d->rr_ttl[1] = 3600;
+	memmove(d->rr_data[0], rdata, 6);
+	memmove(d->rr_data[1], sig, 25);
+	memset(&key, 0, sizeof(key));
+	key.rk.dname = nm;
+	key.rk.dname_len = nmlen;
+	key.rk.type = htons(LDNS_RR_TYPE_A);
+	key.rk.rrset_class = htons(LDNS_RR_CLASS_IN);
+	key.entry.key = &key;
+	key.entry.data = d;
+	key.entry.hash = rrset_key_hash(&key.rk);
+	unit_assert( (ck = packed_rrset_copy_alloc(&key, alloc, now)) );
+	free(d);
+	ref.key = ck;
+	ref.id = ck->id;
+	return rrset_cache_update(r, &ref, alloc, now);
+}
+
+/** check the security status and TTL of the A rrset in the cache */
+static void
+unchanged_test_check(struct rrset_cache* r, uint8_t* nm, size_t nmlen,
+	enum sec_status sec, time_t ttl, time_t now)
+{
+	struct packed_rrset_data* d;
+	struct ub_packed_rrset_key* k = rrset_cache_lookup(r, nm, nmlen,
+		LDNS_RR_TYPE_A, LDNS_RR_CLASS_IN, 0, now, 0);
+	unit_assert(k != NULL);
+	d = (struct packed_rrset_data*)k->entry.data;
+	unit_assert(d->security == sec);
+	unit_assert(d->ttl == ttl);
+	unit_assert(d->rr_ttl[0] <= ttl && d->rr_ttl[1] <= ttl);
+	lock_rw_unlock(&k->entry.lock);
+}
+
+/** test that a refreshed rrset keeps the secure status if it is unchanged */
+static void
+rrset_unchanged_test(void)
+{
+	uint8_t nm[] = "\003www\007example\003com";
+	struct alloc_cache alloc;
+	struct rrset_cache* r;
+	time_t now = 1000;
+	unit_show_feature("rrset unchanged on refresh");
+	alloc_init(&alloc, NULL, 1);
+	unit_assert( (r = rrset_cache_create(NULL, &alloc)) );
+
+	/* a secure rrset, and it is fetched again after it expired */
+	unit_assert( unchanged_test_add(r, &alloc, nm, sizeof(nm), 100000,
+		100, sec_status_secure, now) == 0 );
+	unit_assert( unchanged_test_add(r, &alloc, nm, sizeof(nm), 100000,
+		100, sec_status_unchecked, now+4000) == 3 );
+	unchanged_test_check(r, nm, sizeof(nm), sec_status_secure,
+		now+4000+3600, now+4000);
+	/* the TTL is capped at the signature expiration */
+	unit_assert( unchanged_test_add(r, &alloc, nm, sizeof(nm), 100000,
+		100, sec_status_unchecked, 99000) == 3 );
+	unchanged_test_check(r, nm, sizeof(nm), sec_status_secure, 100000,
+		99000);
+
+	/* an expired signature is not carried over */
+	unit_assert( unchanged_test_add(r, &alloc, nm, sizeof(nm), 100000,
+		100, sec_status_unchecked, 100001) == 1 );
+	unchanged_test_check(r, nm, sizeof(nm), sec_status_unchecked,
+		100001+3600, 100001);
+	/* and not from an rrset that is not secure */
+	unit_assert( unchanged_test_add(r, &alloc, nm, sizeof(nm), 200000,
+		100, sec_status_unchecked, 110000) == 1 );
+	unit_assert( unchanged_test_add(r, &alloc, nm, sizeof(nm), 200000,
+		100, sec_status_unchecked, 120000) == 1 );
+	unchanged_test_check(r, nm, sizeof(nm), sec_status_unchecked,
+		120000+3600, 120000);
+
+	/* a changed signature is validated again */
+	unit_assert( unchanged_test_add(r, &alloc, nm, sizeof(nm), 200000,
+		100, sec_status_secure, 125000) == 1 );
+	unit_assert( unchanged_test_add(r, &alloc, nm, sizeof(nm), 200001,
+		100, sec_status_unchecked, 130000) == 1 );
+	unchanged_test_check(r, nm, sizeof(nm), sec_status_unchecked,
+		130000+3600, 130000);
+	/* a signature that is not valid yet is not carried over */
+	unit_assert( unchanged_test_add(r, &alloc, nm, sizeof(nm), 200001,
+		145000, sec_status_secure, 140000) == 1 );
+	unit_assert( unchanged_test_add(r, &alloc, nm, sizeof(nm), 200001,
+		145000, sec_status_unchecked, 144000) == 1 );
+	unchanged_test_check(r, nm, sizeof(nm), sec_status_unchecked,
+		144000+3600, 144000);
+
+	rrset_cache_delete(r);
+	alloc_clear(&alloc);
+}
+
+#include "services/outside_network.h"
+#include "sldns/sbuffer.h"
+/** make a serviced query packet, without the ID, for the outnet test */
+static void
+outnet_test_qbuf(sldns_buffer* buf, const char* qname)
+{
+	uint8_t hdr[10];
+	memset(hdr, 0, sizeof(hdr));
+	hdr[0] = BIT_RD >> 8;
+	hdr[3] = 1; /* qdcount */
+	sldns_buffer_clear(buf);
+	sldns_buffer_write(buf, hdr, sizeof(hdr));
+	sldns_buffer_write(buf, qname, strlen(qname)+1);
+	sldns_buffer_write_u16(buf, LDNS_RR_TYPE_A);
+	sldns_buffer_write_u16(buf, LDNS_RR_CLASS_IN);
+	sldns_buffer_flip(buf);
+}
+
+/** test the pending and serviced hash tables of the outside network */
+static void
+outnet_hash_test(void)
+{
+	struct outside_network outnet;
+	struct pending* pends, *p, key;
+	struct serviced_query sq;
+	struct edns_option opt;
+	struct sockaddr_storage addr;
+	socklen_t addrlen;
+	sldns_buffer* buf, *buf2;
+	uint8_t cookie[8] = {1, 2, 3, 4, 5, 6, 7, 8};
+	size_t i, num = 65536;
+	unit_show_feature("outside network hash");
+	memset(&outnet, 0, sizeof(outnet));
+	unit_assert( (outnet.rnd = ub_initstate(42, NULL)) );
+	outnet.hash_seed = 0x5a5a;
+	unit_assert( outnet_hash_init(&outnet.pending, OUTNET_HASH_START) );
+	unit_assert( outnet_hash_init(&outnet.serviced, OUTNET_HASH_START) );
+	unit_assert( ipstrtoaddr("192.0.2.1", 53, &addr, &addrlen) );
+	unit_assert( (buf = sldns_buffer_new(512)) );
+	unit_assert( (buf2 = sldns_buffer_new(512)) );
+	unit_assert( (pends = (struct pending*)calloc(num+1,
+		sizeof(*pends))) );
+	for(i=0; i<=num; i++) {
+		memcpy(&pends[i].addr, &addr, addrlen);
+		pends[i].addrlen = addrlen;
+	}
+
+	/* removing an entry that was never inserted, also when the
+	 * table has the same hash value in it */
+	pends[0].id = 1;
+	pends[0].node.hash = pending_hash(&pends[0], outnet.hash_seed);
+	unit_assert( !outnet_hash_remove(&outnet.pending, &pends[0].node) );
+	pends[1].id = 1;
+	pends[1].node.hash = pends[0].node.hash;
+	outnet_hash_insert(&outnet.pending, &pends[1].node);
+	unit_assert( !outnet_hash_remove(&outnet.pending, &pends[0].node) );
+	unit_assert( outnet.pending.count == 1 );
+	unit_assert( outnet_pending_lookup(&outnet.pending, &pends[0])
+		== &pends[1] );
+	unit_assert( outnet_hash_remove(&outnet.pending, &pends[1].node) );
+	unit_assert( !outnet_hash_remove(&outnet.pending, &pends[1].node) );
+	unit_assert( outnet.pending.count == 0 );
+	unit_assert( outnet_pending_lookup(&outnet.pending, &pends[0])
+		== NULL );
+
+	/* growth past the start size, every ID is still found */
+	for(i=0; i<num; i++) {
+		pends[i].id = (unsigned)i;
+		pends[i].node.hash = pending_hash(&pends[i], outnet.hash_seed);
+		outnet_hash_insert(&outnet.pending, &pends[i].node);
+	}
+	unit_assert( outnet.pending.count == num );
+	unit_assert( outnet.pending.size > OUTNET_HASH_START );
+	unit_assert( outnet.pending.size >= num );
+	for(i=0; i<num; i++) {
+		memset(&key, 0, sizeof(key));
+		memcpy(&key.addr, &addr, addrlen);
+		key.addrlen = addrlen;
+		key.id = (unsigned)i;
+		key.node.hash = pending_hash(&key, outnet.hash_seed);
+		unit_assert( outnet_pending_lookup(&outnet.pending, &key)
+			== &pends[i] );
+	}
+
+	/* every ID is in use, select_id gives up */
+	p = &pends[num];
+	outnet_test_qbuf(buf, "\003www\007example\003com");
+	unit_assert( !select_id(&outnet, p, buf) );
+	unit_assert( outnet.pending.count == num );
+
+	/* only the odd IDs are free, select_id retries on collision */
+	for(i=0; i<num; i+=2) {
+		unit_assert( outnet_hash_remove(&outnet.pending,
+			&pends[i+1].node) );
+	}
+	unit_assert( outnet.pending.count == num/2 );
+	for(i=0; i<64; i++) {
+		unit_assert( select_id(&outnet, p, buf) );
+		unit_assert( (p->id & 1) == 1 );
+		unit_assert( sldns_buffer_read_u16_at(buf, 0) == p->id );
+		unit_assert( outnet_pending_lookup(&outnet.pending, p) == p );
+		unit_assert( outnet_hash_remove(&outnet.pending, &p->node) );
+	}
+	outnet_hash_clear(&outnet.pending);
+	free(pends);
+
+	/* serviced lookup, the qname case does not matter, the EDNS
+	 * options do */
+	memset(&sq, 0, sizeof(sq));
+	outnet_test_qbuf(buf, "\003www\007example\003com");
+	sq.qbuf = sldns_buffer_begin(buf);
+	sq.qbuflen = sldns_buffer_limit(buf);
+	sq.dnssec = EDNS_DO;
+	memcpy(&sq.addr, &addr, addrlen);
+	sq.addrlen = addrlen;
+	sq.outnet = &outnet;
+	sq.opt_list = NULL;
+	sq.node.hash = serviced_hash(&sq, outnet.hash_seed);
+	outnet_hash_insert(&outnet.serviced, &sq.node);
+	unit_assert( lookup_serviced(&outnet, buf, EDNS_DO, &addr, addrlen,
+		NULL) == &sq );
+	unit_assert( lookup_serviced(&outnet, buf, 0, &addr, addrlen,
+		NULL) == NULL );
+	memset(&opt, 0, sizeof(opt));
+	opt.opt_code = LDNS_EDNS_NSID;
+	opt.opt_len = sizeof(cookie);
+	opt.opt_data = cookie;
+	unit_assert( lookup_serviced(&outnet, buf, EDNS_DO, &addr, addrlen,
+		&opt) == NULL );
+	/* the entry points into buf, the other casing goes in buf2 */
+	outnet_test_qbuf(buf2, "\003WwW\007ExAmPlE\003COM");
+	unit_assert( memcmp(sldns_buffer_begin(buf), sldns_buffer_begin(buf2),
+		sldns_buffer_limit(buf)) != 0 );
+	unit_assert( lookup_serviced(&outnet, buf2, EDNS_DO, &addr, addrlen,
+		NULL) == &sq );
+	unit_assert( lookup_serviced(&outnet, buf2, EDNS_DO, &addr, addrlen,
+		&opt) == NULL );
+	unit_assert( outnet_hash_remove(&outnet.serviced, &sq.node) );
+	outnet_hash_clear(&outnet.serviced);
+	sldns_buffer_free(buf);
+	sldns_buffer_free(buf2);
+	ub_randfree(outnet.rnd);
+}
+
 #include "respip/respip.h"
 #include "services/localzone.h"
 #include "util/data/packed_rrset.h"
@@ -893,6 +1605,7 @@ main(int argc, char* argv[])
 	net_test();
 	config_memsize_test();
 	config_tag_test();
+	config_options_test();
 	dname_test();
 	rtt_test();
 	anchors_test();
@@ -901,6 +1614,10 @@ main(int argc, char* argv[])
 	lruhash_test();
 	slabhash_test();
 	infra_test();
+	refresh_test();
+	deleg_cache_test();
+	rrset_unchanged_test();
+	outnet_hash_test();
 	ldns_test();
 	msgparse_test();
 #ifdef CLIENT_SUBNET
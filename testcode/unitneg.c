@@ -203,7 +203,7 @@ static void add_item(struct val_neg_cache* neg)
 	char* zname = get_random_zone();
 	char* from, *to;
 
-	lock_basic_lock(&neg->lock);
+	lock_rw_wrlock(&neg->lock);
 	if(negverbose)
 		log_nametypeclass(0, "add to zone", (uint8_t*)zname, 0, 0);
 	z = neg_find_zone(neg, (uint8_t*)zname, strlen(zname)+1, 
@@ -236,7 +236,7 @@ static void add_item(struct val_neg_cache* neg)
 	rr_data = (uint8_t*)to;
 
 	neg_insert_data(neg, z, &nsec);
-	lock_basic_unlock(&neg->lock);
+	lock_rw_unlock(&neg->lock);
 }
 
 /** remove a random item */
@@ -247,9 +247,9 @@ static void remove_item(struct val_neg_cache* neg)
 	rbnode_type* walk;
 	struct val_neg_zone* z;
 	
-	lock_basic_lock(&neg->lock);
+	lock_rw_wrlock(&neg->lock);
 	if(neg->tree.count == 0) {
-		lock_basic_unlock(&neg->lock);
+		lock_rw_unlock(&neg->lock);
 		return; /* nothing to delete */
 	}
 
@@ -269,11 +269,11 @@ static void remove_item(struct val_neg_cache* neg)
 			i++;
 	}
 	if(!walk || walk == RBTREE_NULL) {
-		lock_basic_unlock(&neg->lock);
+		lock_rw_unlock(&neg->lock);
 		return;
 	}
 	if(!z->in_use) {
-		lock_basic_unlock(&neg->lock);
+		lock_rw_unlock(&neg->lock);
 		return;
 	}
 	if(negverbose)
@@ -295,7 +295,7 @@ static void remove_item(struct val_neg_cache* neg)
 			i++;
 	}
 	if(!walk || walk == RBTREE_NULL) {
-		lock_basic_unlock(&neg->lock);
+		lock_rw_unlock(&neg->lock);
 		return;
 	}
 	if(d->in_use) {
@@ -303,7 +303,7 @@ static void remove_item(struct val_neg_cache* neg)
 			log_nametypeclass(0, "neg delete item:", d->name, 0, 0);
 		neg_delete_data(neg, d);
 	}
-	lock_basic_unlock(&neg->lock);
+	lock_rw_unlock(&neg->lock);
 }
 
 /** sum up the zone trees */
@@ -473,7 +473,7 @@ static void check_neg_invariants(struct val_neg_cache* neg)
 {
 	struct val_neg_zone* z;
 	/* check structure of LRU list */
-	lock_basic_lock(&neg->lock);
+	lock_rw_wrlock(&neg->lock);
 	check_lru(neg);
 	unit_assert(neg->max == 1024*1024);
 	unit_assert(neg->nsec3_max_iter == 1500);
@@ -485,7 +485,7 @@ static void check_neg_invariants(struct val_neg_cache* neg)
 		unit_assert(neg->first == NULL);
 		unit_assert(neg->last == NULL);
 		unit_assert(neg->use == 0);
-		lock_basic_unlock(&neg->lock);
+		lock_rw_unlock(&neg->lock);
 		return;
 	}
 
@@ -495,7 +495,7 @@ static void check_neg_invariants(struct val_neg_cache* neg)
 	RBTREE_FOR(z, struct val_neg_zone*, &neg->tree) {
 		check_zone_invariants(neg, z);
 	}
-	lock_basic_unlock(&neg->lock);
+	lock_rw_unlock(&neg->lock);
 }
 
 /** perform stress test on insert and delete in neg cache */
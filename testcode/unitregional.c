@@ -236,9 +236,59 @@ random_burden(void)
 		burden_test(max_alloc);
 }
 
+/** test that chunks and large objects are recycled by the chunk cache */
+static void
+chunk_cache_test(void)
+{
+	struct regional_chunk_cache cache;
+	struct regional* r = regional_create_custom(2048);
+	void* a;
+	int i;
+	memset(&cache, 0, sizeof(cache));
+	cache.max = 3;
+	unit_assert(r);
+	regional_set_chunk_cache(r, &cache);
+
+	/* two chunks and a large object in a chunk */
+	a = regional_alloc(r, 2000);
+	unit_assert(a);
+	a = regional_alloc(r, 1024);
+	unit_assert(a);
+	a = regional_alloc(r, 4000);
+	unit_assert(a);
+	memset(a, 0x42, 4000);
+	unit_assert(r->large_list == NULL);
+	a = regional_alloc(r, 1024);
+	unit_assert(a);
+	unit_assert(cache.num_new == 2 && cache.num_reused == 0);
+	unit_assert(regional_get_mem(r) == 2048 + 2*REGIONAL_CHUNK_SIZE);
+	/* too large for a chunk, malloced */
+	a = regional_alloc(r, REGIONAL_CHUNK_SIZE);
+	unit_assert(a);
+	unit_assert(r->large_list != NULL);
+	regional_free_all(r);
+	unit_assert(cache.num == 2 && cache.list != NULL);
+
+	/* chunks are reused, and the cache is capped at max */
+	for(i=0; i<5; i++) {
+		a = regional_alloc(r, 4000);
+		unit_assert(a);
+	}
+	unit_assert(cache.num == 0);
+	unit_assert(cache.num_reused == 2 && cache.num_new == 5);
+	regional_free_all(r);
+	unit_assert(cache.num == 3);
+
+	regional_destroy(r);
+	unit_assert(cache.num == 3);
+	regional_chunk_cache_clear(&cache);
+	unit_assert(cache.num == 0 && cache.list == NULL);
+}
+
 void regional_test(void)
 {
 	unit_show_feature("regional");
 	specific_cases();
 	random_burden();
+	chunk_cache_test();
 }
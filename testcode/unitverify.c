@@ -56,6 +56,12 @@
 #include "util/net_help.h"
 #include "util/module.h"
 #include "util/config_file.h"
+#include "util/storage/slabhash.h"
+#include "validator/val_sigcache.h"
+#include "validator/val_nsec3cache.h"
+#include "validator/val_cryptopool.h"
+#include "services/mesh.h"
+#include "util/tube.h"
 #include "sldns/sbuffer.h"
 #include "sldns/keyraw.h"
 #include "sldns/str2wire.h"
@@ -301,6 +307,9 @@ verifytest_file(const char* fname, const char* at_date)
 	struct module_env env;
 	struct val_env ve;
 	time_t now = time(NULL);
+	struct config_file* cfg = config_create();
+	size_t hit, miss;
+	int pass;
 	unit_show_func("signature verify", fname);
 
 	if(!list)
@@ -308,20 +317,102 @@ verifytest_file(const char* fname, const char* at_date)
 	alloc_init(&alloc, NULL, 1);
 	memset(&env, 0, sizeof(env));
 	memset(&ve, 0, sizeof(ve));
+	lock_basic_init(&ve.sigstat_lock);
 	env.scratch = region;
 	env.scratch_buffer = buf;
 	env.now = &now;
 	ve.date_override = cfg_convert_timeval(at_date);
-	unit_assert(region && buf);
+	ve.pkey_cache = secalgo_keycache_create(1024*1024, 4);
+	unit_assert(region && buf && ve.pkey_cache);
 	dnskey = extract_keys(list, &alloc, region, buf);
 	if(vsig) log_nametypeclass(VERB_QUERY, "test dnskey",
 			dnskey->rk.dname, ntohs(dnskey->rk.type), 
 			ntohs(dnskey->rk.rrset_class));
-	/* ready to go! */
-	for(e = list->next; e; e = e->next) {
-		verifytest_entry(e, &alloc, region, buf, dnskey, &env, &ve);
+	/* ready to go! the second pass uses the parsed keys from the cache,
+	 * the third pass fills the signature cache and the last uses it */
+	unit_assert(cfg);
+	for(pass = 0; pass < 4; pass++) {
+		if(pass == 2) {
+			ve.sigcache = val_sigcache_create(cfg);
+			unit_assert(ve.sigcache);
+		}
+		for(e = list->next; e; e = e->next) {
+			verifytest_entry(e, &alloc, region, buf, dnskey, &env,
+				&ve);
+		}
+		if(pass == 2)
+			val_sigcache_get_stats(ve.sigcache, &hit, &miss, 1);
 	}
+	val_sigcache_get_stats(ve.sigcache, &hit, &miss, 0);
+	/* checks that fail on format errors are not stored */
+	unit_assert(hit > 0);
+
+	val_sigcache_delete(ve.sigcache);
+	config_delete(cfg);
+	lock_basic_destroy(&ve.sigstat_lock);
+	slabhash_delete(ve.pkey_cache);
+	ub_packed_rrset_parsedelete(dnskey, &alloc);
+	delete_entry(list);
+	regional_destroy(region);
+	alloc_clear(&alloc);
+	sldns_buffer_free(buf);
+}
 
+/** check that the cheapest signature is verified first, from a file with
+ * two signatures on the first rrset, the expensive one first in the message.
+ * cheap and costly are the algorithms of the signatures. */
+static void
+sigorder_test(const char* fname, const char* at_date, int cheap, int costly)
+{
+	struct ub_packed_rrset_key* dnskey;
+	struct regional* region = regional_create();
+	struct alloc_cache alloc;
+	sldns_buffer* buf = sldns_buffer_new(65535);
+	struct entry* list = read_datafile(fname, 1);
+	struct module_env env;
+	struct val_env ve;
+	struct query_info qinfo;
+	struct reply_info* rep = NULL;
+	uint8_t sigalg[ALGO_NEEDS_MAX+1];
+	time_t now = time(NULL);
+	char* reason = NULL;
+	unit_show_func("signature order", fname);
+
+	if(!list)
+		fatal_exit("could not read %s: %s", fname, strerror(errno));
+	alloc_init(&alloc, NULL, 1);
+	memset(&env, 0, sizeof(env));
+	memset(&ve, 0, sizeof(ve));
+	lock_basic_init(&ve.sigstat_lock);
+	env.scratch = region;
+	env.scratch_buffer = buf;
+	env.now = &now;
+	ve.date_override = cfg_convert_timeval(at_date);
+	unit_assert(region && buf);
+	dnskey = extract_keys(list, &alloc, region, buf);
+	entry_to_repinfo(list->next, &alloc, region, buf, &qinfo, &rep);
+	unit_assert(rep->rrset_count > 0 && ((struct packed_rrset_data*)
+		rep->rrsets[0]->entry.data)->rrsig_count == 2);
+
+	/* one valid signature is enough, the cheap one is checked */
+	unit_assert(dnskeyset_verify_rrset(&env, &ve, rep->rrsets[0], dnskey,
+		NULL, &reason, LDNS_SECTION_ANSWER, NULL) == sec_status_secure);
+	unit_assert(ve.num_sig_verify[cheap] == 1);
+	unit_assert(ve.num_sig_skip[costly] == 1);
+	unit_assert(ve.num_sig_verify[costly] == 0);
+
+	/* with both algorithms signalled, both are checked */
+	setup_sigalg(dnskey, sigalg);
+	unit_assert(dnskeyset_verify_rrset(&env, &ve, rep->rrsets[0], dnskey,
+		sigalg, &reason, LDNS_SECTION_ANSWER, NULL) ==
+		sec_status_secure);
+	unit_assert(ve.num_sig_verify[cheap] == 2);
+	unit_assert(ve.num_sig_verify[costly] == 1);
+	unit_assert(ve.num_sig_skip[costly] == 1);
+
+	reply_info_parsedelete(rep, &alloc);
+	query_info_clear(&qinfo);
+	lock_basic_destroy(&ve.sigstat_lock);
 	ub_packed_rrset_parsedelete(dnskey, &alloc);
 	delete_entry(list);
 	regional_destroy(region);
@@ -415,10 +506,10 @@ nsectest(void)
 }
 
 /** Test hash algo - NSEC3 hash it and compare result */
-static void
+static int
 nsec3_hash_test_entry(struct entry* e, rbtree_type* ct,
 	struct alloc_cache* alloc, struct regional* region, 
-	sldns_buffer* buf)
+	sldns_buffer* buf, struct val_nsec3cache* hc)
 {
 	struct query_info qinfo;
 	struct reply_info* rep = NULL;
@@ -440,8 +531,14 @@ nsec3_hash_test_entry(struct entry* e, rbtree_type* ct,
 	/* check test is OK */
 	unit_assert(nsec3 && answer && qname);
 
-	ret = nsec3_hash_name(ct, region, buf, nsec3, 0, qname,
+	ret = nsec3_hash_name(ct, region, buf, hc, 1000, nsec3, 0, qname,
 		qinfo.qname_len, &hash);
+	if(ret == -2 && hc && hc->ratelimit) {
+		/* refused by the rate limit */
+		reply_info_parsedelete(rep, alloc);
+		query_info_clear(&qinfo);
+		return 0;
+	}
 	if(ret != 1) {
 		printf("Bad nsec3_hash_name retcode %d\n", ret);
 		unit_assert(ret == 1);
@@ -455,6 +552,7 @@ nsec3_hash_test_entry(struct entry* e, rbtree_type* ct,
 
 	reply_info_parsedelete(rep, alloc);
 	query_info_clear(&qinfo);
+	return 1;
 }
 
 
@@ -469,6 +567,8 @@ nsec3_hash_test(const char* fname)
 	 * 	The answer section AAAA RR name is the required result.
 	 * 	The auth section NSEC3 is used to get hash parameters.
 	 * The hash cache is maintained per file.
+	 * The first pass fills the shared cache, the second pass uses it,
+	 * and the last pass has a rate limit of one hash per second.
 	 *
 	 * The test does not perform canonicalization during the compare.
 	 */
@@ -478,25 +578,152 @@ nsec3_hash_test(const char* fname)
 	sldns_buffer* buf = sldns_buffer_new(65535);
 	struct entry* e;
 	struct entry* list = read_datafile(fname, 1);
+	struct config_file* cfg = config_create();
+	struct val_nsec3cache* hc;
+	size_t hit, miss, limited, num = 0, done = 0, first = 0;
+	int pass;
 	unit_show_func("NSEC3 hash", fname);
 
 	if(!list)
 		fatal_exit("could not read %s: %s", fname, strerror(errno));
-	rbtree_init(&ct, &nsec3_hash_cmp);
 	alloc_init(&alloc, NULL, 1);
-	unit_assert(region && buf);
+	unit_assert(region && buf && cfg);
+	hc = val_nsec3cache_create(cfg);
+	unit_assert(hc);
 
 	/* ready to go! */
-	for(e = list; e; e = e->next) {
-		nsec3_hash_test_entry(e, &ct, &alloc, region, buf);
+	for(pass = 0; pass < 2; pass++) {
+		rbtree_init(&ct, &nsec3_hash_cmp);
+		regional_free_all(region);
+		for(e = list; e; e = e->next) {
+			unit_assert(nsec3_hash_test_entry(e, &ct, &alloc,
+				region, buf, hc));
+			if(pass == 0)
+				num++;
+		}
+		val_nsec3cache_get_stats(hc, &hit, &miss, &limited, 0);
+		/* the second pass finds the hashes in the shared cache,
+		 * and computes none */
+		if(pass == 0) {
+			unit_assert(miss > 0);
+			first = miss;
+		} else	unit_assert(miss == first && hit >= first);
 	}
+	val_nsec3cache_delete(hc);
 
+	cfg->nsec3_hash_cache_size = 0;
+	cfg->nsec3_hash_ratelimit = 1;
+	hc = val_nsec3cache_create(cfg);
+	unit_assert(hc);
+	rbtree_init(&ct, &nsec3_hash_cmp);
+	regional_free_all(region);
+	for(e = list; e; e = e->next)
+		done += nsec3_hash_test_entry(e, &ct, &alloc, region, buf, hc);
+	val_nsec3cache_get_stats(hc, &hit, &miss, &limited, 0);
+	/* the names are all in one zone, one is hashed */
+	unit_assert(done >= 1 && done < num && limited > 0);
+	val_nsec3cache_delete(hc);
+
+	config_delete(cfg);
 	delete_entry(list);
 	regional_destroy(region);
 	alloc_clear(&alloc);
 	sldns_buffer_free(buf);
 }
 
+/** a worker that submits batches to the crypto threads */
+struct cryptopool_thr {
+	/** thread num */
+	int num;
+	/** id */
+	ub_thread_type id;
+	/** the crypto threads */
+	struct val_cryptopool* pool;
+	/** the mesh that the batches are posted back to */
+	struct mesh_area mesh;
+};
+
+/** main routine of a worker that submits batches */
+static void*
+cryptopool_thr_main(void* arg)
+{
+	struct cryptopool_thr* t = (struct cryptopool_thr*)arg;
+	struct val_crypto_batch* b;
+	struct sigcache_key sck;
+	uint8_t data[64], sig[32], key[32];
+	sldns_buffer buf;
+	int i, j;
+	log_thread_set(&t->num);
+	memset(data, 0, sizeof(data));
+	memset(sig, 0, sizeof(sig));
+	memset(key, 0, sizeof(key));
+	sldns_buffer_init_frm_data(&buf, data, sizeof(data));
+	for(i=0; i<200; i++) {
+		b = (struct val_crypto_batch*)calloc(1, sizeof(*b));
+		unit_assert(b);
+		b->async.cb = &val_cryptopool_batch_done;
+		b->mesh = &t->mesh;
+		for(j=0; j<20; j++) {
+			memset(&sck, 0, sizeof(sck));
+			sck.digest[0] = (uint8_t)t->num;
+			sck.digest[1] = (uint8_t)i;
+			sck.digest[2] = (uint8_t)j;
+			unit_assert(val_crypto_batch_add(b, &sck, &buf,
+				LDNS_RSASHA256, sig, sizeof(sig), key,
+				sizeof(key), 100, 10));
+		}
+		unit_assert(val_cryptopool_submit(t->pool, b));
+	}
+	/* every batch is posted back when its jobs are done */
+	while(t->mesh.async_waiting > 0)
+		mesh_async_wait(&t->mesh);
+	return NULL;
+}
+
+/** test the crypto threads with jobs submitted by several workers */
+static void
+cryptopool_test(void)
+{
+	struct config_file* cfg = config_create();
+	struct val_sigcache* sigcache;
+	struct val_cryptopool* pool;
+	struct cryptopool_thr t[4];
+	int i, numth = 4;
+	unit_show_func("validator/val_cryptopool.c", "val_cryptopool_submit");
+	unit_assert(cfg);
+	sigcache = val_sigcache_create(cfg);
+	unit_assert(sigcache);
+	pool = val_cryptopool_create(2, NULL, sigcache);
+	if(!pool) {
+		/* no thread support */
+		val_sigcache_delete(sigcache);
+		config_delete(cfg);
+		return;
+	}
+	for(i=0; i<numth; i++) {
+		memset(&t[i], 0, sizeof(t[i]));
+		t[i].num = i+1;
+		t[i].pool = pool;
+		lock_basic_init(&t[i].mesh.async_lock);
+		t[i].mesh.async_tube = tube_create();
+		unit_assert(t[i].mesh.async_tube);
+	}
+	for(i=0; i<numth; i++)
+		ub_thread_create(&t[i].id, cryptopool_thr_main, &t[i]);
+	for(i=0; i<numth; i++) {
+		ub_thread_join(t[i].id);
+		unit_assert(t[i].mesh.async_waiting == 0);
+		unit_assert(t[i].mesh.async_first == NULL);
+	}
+	val_cryptopool_delete(pool);
+	for(i=0; i<numth; i++) {
+		tube_delete(t[i].mesh.async_tube);
+		lock_basic_destroy(&t[i].mesh.async_lock);
+	}
+	val_sigcache_delete(sigcache);
+	config_delete(cfg);
+}
+
 #define xstr(s) str(s)
 #define str(s) #s
 
@@ -524,6 +751,8 @@ verify_test(void)
 	verifytest_file(SRCDIRSTR "/testdata/test_sigs.rsasha256", "20070829144150");
 #  ifdef USE_SHA1
 	verifytest_file(SRCDIRSTR "/testdata/test_sigs.sha1_and_256", "20070829144150");
+	sigorder_test(SRCDIRSTR "/testdata/test_sigs.sha1_and_256", "20070829144150",
+		LDNS_RSASHA1, LDNS_RSASHA256);
 #  endif
 	verifytest_file(SRCDIRSTR "/testdata/test_sigs.rsasha256_draft", "20090101000000");
 #endif
@@ -546,6 +775,13 @@ verify_test(void)
 		verifytest_file(SRCDIRSTR "/testdata/test_sigs.ecdsa_p256", "20100908100439");
 		verifytest_file(SRCDIRSTR "/testdata/test_sigs.ecdsa_p384", "20100908100439");
 	}
+#  if (defined(HAVE_EVP_SHA256) || defined(HAVE_NSS) || defined(HAVE_NETTLE)) && defined(USE_SHA2)
+	if(dnskey_algo_id_is_supported(LDNS_ECDSAP384SHA384)) {
+		verifytest_file(SRCDIRSTR "/testdata/test_sigs.ecdsa_and_rsa", "20070829144150");
+		sigorder_test(SRCDIRSTR "/testdata/test_sigs.ecdsa_and_rsa", "20070829144150",
+			LDNS_RSASHA256, LDNS_ECDSAP384SHA384);
+	}
+#  endif
 	dstest_file(SRCDIRSTR "/testdata/test_ds.sha384");
 #endif
 #ifdef USE_ED25519
@@ -563,4 +799,5 @@ verify_test(void)
 #endif
 	nsectest();
 	nsec3_hash_test(SRCDIRSTR "/testdata/test_nsec3_hash.1");
+	cryptopool_test();
 }
@@ -45,8 +45,8 @@
 #include "util/data/packed_rrset.h"
 #include "util/fptr_wlist.h"
 
-/** custom size of cached regional blocks */
-#define ALLOC_REG_SIZE	16384
+/** custom size of cached regional blocks, they grow with cached chunks */
+#define ALLOC_REG_SIZE	8192
 /** number of bits for ID part of uint64, rest for number of threads. */
 #define THRNUM_SHIFT	48	/* for 65k threads, 2^48 rrsets per thr. */
 
@@ -93,6 +93,7 @@ prealloc_blocks(struct alloc_cache* alloc, size_t num)
 			log_err("prealloc blocks: out of memory");
 			return;
 		}
+		regional_set_chunk_cache(r, &alloc->chunks);
 		r->next = (char*)alloc->reg_list;
 		alloc->reg_list = r;
 		alloc->num_reg_blocks ++;
@@ -116,6 +117,7 @@ alloc_init(struct alloc_cache* alloc, struct alloc_cache* super,
 	alloc->max_reg_blocks = 100;
 	alloc->num_reg_blocks = 0;
 	alloc->reg_list = NULL;
+	alloc->chunks.max = ALLOC_CHUNK_MAX;
 	alloc->cleanup = NULL;
 	alloc->cleanup_arg = NULL;
 	if(alloc->super)
@@ -189,6 +191,7 @@ alloc_clear(struct alloc_cache* alloc)
 	}
 	alloc->reg_list = NULL;
 	alloc->num_reg_blocks = 0;
+	regional_chunk_cache_clear(&alloc->chunks);
 }
 
 uint64_t
@@ -303,8 +306,14 @@ alloc_special_release(struct alloc_cache* alloc, alloc_special_type* mem)
 void 
 alloc_stats(struct alloc_cache* alloc)
 {
-	log_info("%salloc: %d in cache, %d blocks.", alloc->super?"":"sup",
-		(int)alloc->num_quar, (int)alloc->num_reg_blocks);
+	log_info("%salloc: %d in cache, %d blocks, %d chunks.",
+		alloc->super?"":"sup", (int)alloc->num_quar,
+		(int)alloc->num_reg_blocks, (int)alloc->chunks.num);
+	log_info("%salloc: blocks %u reused %u new, chunks %u reused %u new.",
+		alloc->super?"":"sup", (unsigned)alloc->num_reg_reused,
+		(unsigned)alloc->num_reg_new,
+		(unsigned)alloc->chunks.num_reused,
+		(unsigned)alloc->chunks.num_new);
 }
 
 size_t alloc_get_mem(struct alloc_cache* alloc)
@@ -319,6 +328,7 @@ size_t alloc_get_mem(struct alloc_cache* alloc)
 		s += lock_get_mem(&p->entry.lock);
 	}
 	s += alloc->num_reg_blocks * ALLOC_REG_SIZE;
+	s += alloc->chunks.num * REGIONAL_CHUNK_SIZE;
 	if(!alloc->super) {
 		lock_quick_unlock(&alloc->lock);
 	}
@@ -328,14 +338,20 @@ size_t alloc_get_mem(struct alloc_cache* alloc)
 struct regional* 
 alloc_reg_obtain(struct alloc_cache* alloc)
 {
+	struct regional* r;
 	if(alloc->num_reg_blocks > 0) {
-		struct regional* r = alloc->reg_list;
+		r = alloc->reg_list;
 		alloc->reg_list = (struct regional*)r->next;
 		r->next = NULL;
 		alloc->num_reg_blocks--;
+		alloc->num_reg_reused++;
 		return r;
 	}
-	return regional_create_custom(ALLOC_REG_SIZE);
+	alloc->num_reg_new++;
+	r = regional_create_custom(ALLOC_REG_SIZE);
+	if(r)
+		regional_set_chunk_cache(r, &alloc->chunks);
+	return r;
 }
 
 void 
@@ -353,6 +369,15 @@ alloc_reg_release(struct alloc_cache* alloc, struct regional* r)
 	alloc->num_reg_blocks++;
 }
 
+void
+alloc_reg_stats_clear(struct alloc_cache* alloc)
+{
+	alloc->num_reg_reused = 0;
+	alloc->num_reg_new = 0;
+	alloc->chunks.num_reused = 0;
+	alloc->chunks.num_new = 0;
+}
+
 void 
 alloc_set_id_cleanup(struct alloc_cache* alloc, void (*cleanup)(void*),
         void* arg)
@@ -49,8 +49,8 @@
 #define UTIL_ALLOC_H
 
 #include "util/locks.h"
+#include "util/regional.h"
 struct ub_packed_rrset_key;
-struct regional;
 
 /** The special type, packed rrset. Not allowed to be used for other memory */
 typedef struct ub_packed_rrset_key alloc_special_type;
@@ -64,6 +64,8 @@ typedef struct ub_packed_rrset_key alloc_special_type;
 
 /** how many blocks to cache locally. */
 #define ALLOC_SPECIAL_MAX 10
+/** how many regional chunks to cache locally. */
+#define ALLOC_CHUNK_MAX 200
 
 /**
  * Structure that provides allocation. Use one per thread.
@@ -95,6 +97,12 @@ struct alloc_cache {
 	size_t num_reg_blocks;
 	/** linked list of regional blocks, using regional->next */
 	struct regional* reg_list;
+	/** free chunks for the regional blocks, those grow with these */
+	struct regional_chunk_cache chunks;
+	/** number of regional blocks handed out from the list */
+	size_t num_reg_reused;
+	/** number of regional blocks malloced because the list was empty */
+	size_t num_reg_new;
 };
 
 /**
@@ -174,6 +182,12 @@ struct regional* alloc_reg_obtain(struct alloc_cache* alloc);
  */
 void alloc_reg_release(struct alloc_cache* alloc, struct regional* r);
 
+/**
+ * Clear the recycle statistics of the regional blocks and chunks.
+ * @param alloc: the alloc cache.
+ */
+void alloc_reg_stats_clear(struct alloc_cache* alloc);
+
 /**
  * Set cleanup on ID overflow callback function. This should remove all
  * RRset ID references from the program. Clear the caches.
@@ -148,6 +148,14 @@ config_create(void)
 	cfg->msg_cache_size = 4 * 1024 * 1024;
 	cfg->msg_cache_slabs = 4;
 	cfg->jostle_time = 200;
+	if(!(cfg->mesh_class_weight = strdup("4 1 1"))) goto error_exit;
+	if(!(cfg->mesh_class_limit = strdup("0 0 0"))) goto error_exit;
+	cfg->trace_sample_rate = 0;
+	cfg->trace_slow_threshold = 1000;
+	cfg->work_stealing = 0;
+	cfg->mesh_fair_share = 0;
+	cfg->mesh_fair_share_prefix4 = 24;
+	cfg->mesh_fair_share_prefix6 = 56;
 	cfg->rrset_cache_size = 4 * 1024 * 1024;
 	cfg->rrset_cache_slabs = 4;
 	cfg->host_ttl = 900;
@@ -157,10 +165,14 @@ config_create(void)
 	cfg->max_negative_ttl = 3600;
 	cfg->prefetch = 0;
 	cfg->prefetch_key = 0;
+	cfg->refresh_popular = 0;
+	cfg->refresh_popular_rate = 20;
+	cfg->refresh_popular_size = 10000;
 	cfg->deny_any = 0;
 	cfg->infra_cache_slabs = 4;
 	cfg->infra_cache_numhosts = 10000;
 	cfg->infra_cache_min_rtt = 50;
+	cfg->infra_cache_rtt_percentile = 0;
 	cfg->delay_close = 0;
 	if(!(cfg->outgoing_avail_ports = (int*)calloc(65536, sizeof(int))))
 		goto error_exit;
@@ -173,8 +185,11 @@ config_create(void)
 	if(!(cfg->logfile = strdup(""))) goto error_exit;
 	if(!(cfg->pidfile = strdup(PIDFILE))) goto error_exit;
 	if(!(cfg->target_fetch_policy = strdup("3 2 1 0 0"))) goto error_exit;
+	cfg->target_fetch_parallel = 1;
 	cfg->fast_server_permil = 0;
 	cfg->fast_server_num = 3;
+	cfg->hedge_percentile = 0;
+	cfg->hedge_budget = 5;
 	cfg->donotqueryaddrs = NULL;
 	cfg->donotquery_localhost = 1;
 	cfg->root_hints = NULL;
@@ -242,16 +257,24 @@ config_create(void)
 	cfg->val_log_squelch = 0;
 	cfg->val_permissive_mode = 0;
 	cfg->aggressive_nsec = 0;
+	cfg->synth_insecure_dname = 0;
 	cfg->ignore_cd = 0;
 	cfg->serve_expired = 0;
 	cfg->serve_expired_ttl = 0;
 	cfg->serve_expired_ttl_reset = 0;
+	cfg->serve_expired_client_timeout = 0;
 	cfg->add_holddown = 30*24*3600;
 	cfg->del_holddown = 30*24*3600;
 	cfg->keep_missing = 366*24*3600; /* one year plus a little leeway */
 	cfg->permit_small_holddown = 0;
 	cfg->key_cache_size = 4 * 1024 * 1024;
 	cfg->key_cache_slabs = 4;
+	cfg->sig_cache_size = 1 * 1024 * 1024;
+	cfg->sig_cache_slabs = 4;
+	cfg->val_crypto_threads = 0;
+	cfg->nsec3_hash_cache_size = 1 * 1024 * 1024;
+	cfg->nsec3_hash_cache_slabs = 4;
+	cfg->nsec3_hash_ratelimit = 0;
 	cfg->neg_cache_size = 1 * 1024 * 1024;
 	cfg->local_zones = NULL;
 	cfg->local_zones_nodefault = NULL;
@@ -352,6 +375,10 @@ struct config_file* config_create_forlib(void)
 	cfg->use_syslog = 0;
 	cfg->key_cache_size = 1024*1024;
 	cfg->key_cache_slabs = 1;
+	cfg->sig_cache_size = 256*1024;
+	cfg->sig_cache_slabs = 1;
+	cfg->nsec3_hash_cache_size = 128*1024;
+	cfg->nsec3_hash_cache_slabs = 1;
 	cfg->neg_cache_size = 100 * 1024;
 	cfg->donotquery_localhost = 0; /* allow, so that you can ask a
 		forward nameserver running on localhost */
@@ -504,6 +531,16 @@ int config_set_option(struct config_file* cfg, const char* opt,
 	else S_POW2("msg-cache-slabs:", msg_cache_slabs)
 	else S_SIZET_NONZERO("num-queries-per-thread:",num_queries_per_thread)
 	else S_SIZET_OR_ZERO("jostle-timeout:", jostle_time)
+	else S_STR("mesh-class-weight:", mesh_class_weight)
+	else S_STR("mesh-class-limit:", mesh_class_limit)
+	else S_NUMBER_OR_ZERO("trace-sample-rate:", trace_sample_rate)
+	else S_NUMBER_OR_ZERO("trace-slow-threshold:", trace_slow_threshold)
+	else S_YNO("work-stealing:", work_stealing)
+	else S_YNO("mesh-fair-share:", mesh_fair_share)
+	else S_NUMBER_OR_ZERO("mesh-fair-share-prefix-v4:",
+		mesh_fair_share_prefix4)
+	else S_NUMBER_OR_ZERO("mesh-fair-share-prefix-v6:",
+		mesh_fair_share_prefix6)
 	else S_MEMSIZE("so-rcvbuf:", so_rcvbuf)
 	else S_MEMSIZE("so-sndbuf:", so_sndbuf)
 	else S_YNO("so-reuseport:", so_reuseport)
@@ -513,6 +550,9 @@ int config_set_option(struct config_file* cfg, const char* opt,
 	else S_POW2("rrset-cache-slabs:", rrset_cache_slabs)
 	else S_YNO("prefetch:", prefetch)
 	else S_YNO("prefetch-key:", prefetch_key)
+	else S_YNO("refresh-popular:", refresh_popular)
+	else S_NUMBER_NONZERO("refresh-popular-rate:", refresh_popular_rate)
+	else S_SIZET_NONZERO("refresh-popular-size:", refresh_popular_size)
 	else S_YNO("deny-any:", deny_any)
 	else if(strcmp(opt, "cache-max-ttl:") == 0)
 	{ IS_NUMBER_OR_ZERO; cfg->max_ttl = atoi(val); MAX_TTL=(time_t)cfg->max_ttl;}
@@ -524,6 +564,7 @@ int config_set_option(struct config_file* cfg, const char* opt,
 	    IS_NUMBER_OR_ZERO; cfg->infra_cache_min_rtt = atoi(val);
 	    RTT_MIN_TIMEOUT=cfg->infra_cache_min_rtt;
 	}
+	else S_YNO("infra-cache-rtt-percentile:", infra_cache_rtt_percentile)
 	else S_NUMBER_OR_ZERO("infra-host-ttl:", host_ttl)
 	else S_POW2("infra-cache-slabs:", infra_cache_slabs)
 	else S_SIZET_NONZERO("infra-cache-numhosts:", infra_cache_numhosts)
@@ -539,6 +580,7 @@ int config_set_option(struct config_file* cfg, const char* opt,
 	else S_STR("version:", version)
 	else S_STRLIST("root-hints:", root_hints)
 	else S_STR("target-fetch-policy:", target_fetch_policy)
+	else S_NUMBER_NONZERO("target-fetch-parallel:", target_fetch_parallel)
 	else S_YNO("harden-glue:", harden_glue)
 	else S_YNO("harden-short-bufsize:", harden_short_bufsize)
 	else S_YNO("harden-large-queries:", harden_large_queries)
@@ -573,11 +615,14 @@ int config_set_option(struct config_file* cfg, const char* opt,
 	else S_YNO("log-servfail:", log_servfail)
 	else S_YNO("val-permissive-mode:", val_permissive_mode)
 	else S_YNO("aggressive-nsec:", aggressive_nsec)
+	else S_YNO("synth-insecure-dname:", synth_insecure_dname)
 	else S_YNO("ignore-cd-flag:", ignore_cd)
 	else S_YNO("serve-expired:", serve_expired)
 	else if(strcmp(opt, "serve_expired_ttl:") == 0)
 	{ IS_NUMBER_OR_ZERO; cfg->serve_expired_ttl = atoi(val); SERVE_EXPIRED_TTL=(time_t)cfg->serve_expired_ttl;}
 	else S_YNO("serve-expired-ttl-reset:", serve_expired_ttl_reset)
+	else S_NUMBER_OR_ZERO("serve-expired-client-timeout:",
+		serve_expired_client_timeout)
 	else S_STR("val-nsec3-keysize-iterations:", val_nsec3_key_iterations)
 	else S_UNSIGNED_OR_ZERO("add-holddown:", add_holddown)
 	else S_UNSIGNED_OR_ZERO("del-holddown:", del_holddown)
@@ -587,6 +632,12 @@ int config_set_option(struct config_file* cfg, const char* opt,
 	  autr_permit_small_holddown = cfg->permit_small_holddown; }
 	else S_MEMSIZE("key-cache-size:", key_cache_size)
 	else S_POW2("key-cache-slabs:", key_cache_slabs)
+	else S_MEMSIZE("sig-cache-size:", sig_cache_size)
+	else S_POW2("sig-cache-slabs:", sig_cache_slabs)
+	else S_NUMBER_OR_ZERO("val-crypto-threads:", val_crypto_threads)
+	else S_MEMSIZE("nsec3-hash-cache-size:", nsec3_hash_cache_size)
+	else S_POW2("nsec3-hash-cache-slabs:", nsec3_hash_cache_slabs)
+	else S_NUMBER_OR_ZERO("nsec3-hash-ratelimit:", nsec3_hash_ratelimit)
 	else S_MEMSIZE("neg-cache-size:", neg_cache_size)
 	else S_YNO("minimal-responses:", minimal_responses)
 	else S_YNO("rrset-roundrobin:", rrset_roundrobin)
@@ -662,6 +713,11 @@ int config_set_option(struct config_file* cfg, const char* opt,
 	else S_NUMBER_OR_ZERO("ratelimit-factor:", ratelimit_factor)
 	else S_SIZET_NONZERO("fast-server-num:", fast_server_num)
 	else S_NUMBER_OR_ZERO("fast-server-permil:", fast_server_permil)
+	else if(strcmp(opt, "hedge-percentile:") == 0) {
+		IS_NUMBER_OR_ZERO; cfg->hedge_percentile = atoi(val);
+		if(cfg->hedge_percentile > 99) return 0;
+	}
+	else S_NUMBER_OR_ZERO("hedge-budget:", hedge_budget)
 	else S_YNO("qname-minimisation:", qname_minimisation)
 	else S_YNO("qname-minimisation-strict:", qname_minimisation_strict)
 #ifdef USE_IPSECMOD
@@ -891,6 +947,14 @@ config_get_option(struct config_file* cfg, const char* opt,
 	else O_DEC(opt, "msg-cache-slabs", msg_cache_slabs)
 	else O_DEC(opt, "num-queries-per-thread", num_queries_per_thread)
 	else O_UNS(opt, "jostle-timeout", jostle_time)
+	else O_STR(opt, "mesh-class-weight", mesh_class_weight)
+	else O_STR(opt, "mesh-class-limit", mesh_class_limit)
+	else O_DEC(opt, "trace-sample-rate", trace_sample_rate)
+	else O_DEC(opt, "trace-slow-threshold", trace_slow_threshold)
+	else O_YNO(opt, "work-stealing", work_stealing)
+	else O_YNO(opt, "mesh-fair-share", mesh_fair_share)
+	else O_DEC(opt, "mesh-fair-share-prefix-v4", mesh_fair_share_prefix4)
+	else O_DEC(opt, "mesh-fair-share-prefix-v6", mesh_fair_share_prefix6)
 	else O_MEM(opt, "so-rcvbuf", so_rcvbuf)
 	else O_MEM(opt, "so-sndbuf", so_sndbuf)
 	else O_YNO(opt, "so-reuseport", so_reuseport)
@@ -900,6 +964,9 @@ config_get_option(struct config_file* cfg, const char* opt,
 	else O_DEC(opt, "rrset-cache-slabs", rrset_cache_slabs)
 	else O_YNO(opt, "prefetch-key", prefetch_key)
 	else O_YNO(opt, "prefetch", prefetch)
+	else O_YNO(opt, "refresh-popular", refresh_popular)
+	else O_DEC(opt, "refresh-popular-rate", refresh_popular_rate)
+	else O_DEC(opt, "refresh-popular-size", refresh_popular_size)
 	else O_YNO(opt, "deny-any", deny_any)
 	else O_DEC(opt, "cache-max-ttl", max_ttl)
 	else O_DEC(opt, "cache-max-negative-ttl", max_negative_ttl)
@@ -907,6 +974,8 @@ config_get_option(struct config_file* cfg, const char* opt,
 	else O_DEC(opt, "infra-host-ttl", host_ttl)
 	else O_DEC(opt, "infra-cache-slabs", infra_cache_slabs)
 	else O_DEC(opt, "infra-cache-min-rtt", infra_cache_min_rtt)
+	else O_YNO(opt, "infra-cache-rtt-percentile",
+		infra_cache_rtt_percentile)
 	else O_MEM(opt, "infra-cache-numhosts", infra_cache_numhosts)
 	else O_UNS(opt, "delay-close", delay_close)
 	else O_YNO(opt, "do-ip4", do_ip4)
@@ -948,6 +1017,7 @@ config_get_option(struct config_file* cfg, const char* opt,
 	else O_STR(opt, "identity", identity)
 	else O_STR(opt, "version", version)
 	else O_STR(opt, "target-fetch-policy", target_fetch_policy)
+	else O_DEC(opt, "target-fetch-parallel", target_fetch_parallel)
 	else O_YNO(opt, "harden-short-bufsize", harden_short_bufsize)
 	else O_YNO(opt, "harden-large-queries", harden_large_queries)
 	else O_YNO(opt, "harden-glue", harden_glue)
@@ -966,10 +1036,13 @@ config_get_option(struct config_file* cfg, const char* opt,
 	else O_DEC(opt, "val-log-level", val_log_level)
 	else O_YNO(opt, "val-permissive-mode", val_permissive_mode)
 	else O_YNO(opt, "aggressive-nsec", aggressive_nsec)
+	else O_YNO(opt, "synth-insecure-dname", synth_insecure_dname)
 	else O_YNO(opt, "ignore-cd-flag", ignore_cd)
 	else O_YNO(opt, "serve-expired", serve_expired)
 	else O_DEC(opt, "serve-expired-ttl", serve_expired_ttl)
 	else O_YNO(opt, "serve-expired-ttl-reset", serve_expired_ttl_reset)
+	else O_DEC(opt, "serve-expired-client-timeout",
+		serve_expired_client_timeout)
 	else O_STR(opt, "val-nsec3-keysize-iterations",val_nsec3_key_iterations)
 	else O_UNS(opt, "add-holddown", add_holddown)
 	else O_UNS(opt, "del-holddown", del_holddown)
@@ -977,6 +1050,12 @@ config_get_option(struct config_file* cfg, const char* opt,
 	else O_YNO(opt, "permit-small-holddown", permit_small_holddown)
 	else O_MEM(opt, "key-cache-size", key_cache_size)
 	else O_DEC(opt, "key-cache-slabs", key_cache_slabs)
+	else O_MEM(opt, "sig-cache-size", sig_cache_size)
+	else O_DEC(opt, "sig-cache-slabs", sig_cache_slabs)
+	else O_DEC(opt, "val-crypto-threads", val_crypto_threads)
+	else O_MEM(opt, "nsec3-hash-cache-size", nsec3_hash_cache_size)
+	else O_DEC(opt, "nsec3-hash-cache-slabs", nsec3_hash_cache_slabs)
+	else O_DEC(opt, "nsec3-hash-ratelimit", nsec3_hash_ratelimit)
 	else O_MEM(opt, "neg-cache-size", neg_cache_size)
 	else O_YNO(opt, "control-enable", remote_control_enable)
 	else O_DEC(opt, "control-port", control_port)
@@ -1068,6 +1147,8 @@ config_get_option(struct config_file* cfg, const char* opt,
 	else O_DEC(opt, "ratelimit-factor", ratelimit_factor)
 	else O_DEC(opt, "fast-server-num", fast_server_num)
 	else O_DEC(opt, "fast-server-permil", fast_server_permil)
+	else O_DEC(opt, "hedge-percentile", hedge_percentile)
+	else O_DEC(opt, "hedge-budget", hedge_budget)
 	else O_DEC(opt, "val-sig-skew-min", val_sig_skew_min)
 	else O_DEC(opt, "val-sig-skew-max", val_sig_skew_max)
 	else O_YNO(opt, "qname-minimisation", qname_minimisation)
@@ -1360,6 +1441,8 @@ config_delete(struct config_file* cfg)
 	free(cfg->logfile);
 	free(cfg->pidfile);
 	free(cfg->target_fetch_policy);
+	free(cfg->mesh_class_weight);
+	free(cfg->mesh_class_limit);
 	free(cfg->ssl_service_key);
 	free(cfg->ssl_service_pem);
 	free(cfg->tls_cert_bundle);
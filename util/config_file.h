@@ -150,6 +150,22 @@ struct config_file {
 	size_t num_queries_per_thread;
 	/** number of msec to wait before items can be jostled out */
 	size_t jostle_time;
+	/** mesh scheduler weights for the client, prefetch, internal class */
+	char* mesh_class_weight;
+	/** max number of states per mesh class, 0 is no limit, per thread */
+	char* mesh_class_limit;
+	/** trace one in this many client queries, 0 is off */
+	int trace_sample_rate;
+	/** traced queries slower than this, in msec, are kept for dumping */
+	int trace_slow_threshold;
+	/** hand client queries from busy threads to idle threads */
+	int work_stealing;
+	/** admit clients to a full mesh by fair share of the states */
+	int mesh_fair_share;
+	/** prefix length of IPv4 clients for the fair share */
+	int mesh_fair_share_prefix4;
+	/** prefix length of IPv6 clients for the fair share */
+	int mesh_fair_share_prefix6;
 	/** size of the rrset cache */
 	size_t rrset_cache_size;
 	/** slabs in the rrset cache */
@@ -162,16 +178,27 @@ struct config_file {
 	size_t infra_cache_numhosts;
 	/** min value for infra cache rtt */
 	int infra_cache_min_rtt;
+	/** use the roundtrip time percentiles of a host for its timeout
+	 * and for server selection */
+	int infra_cache_rtt_percentile;
 	/** delay close of udp-timeouted ports, if 0 no delayclose. in msec */
 	int delay_close;
 
 	/** the target fetch policy for the iterator */
 	char* target_fetch_policy;
+	/** number of missing nameserver targets fetched at the same time
+	 * when the iterator has no usable target */
+	int target_fetch_parallel;
 	/** percent*10, how many times in 1000 to pick from the fastest
 	 * destinations */
 	int fast_server_permil;
 	/** number of fastest server to select from */
 	size_t fast_server_num;
+	/** percentile of the server roundtrip time after which a query
+	 * is hedged to another server, 0 is off */
+	int hedge_percentile;
+	/** hedged queries allowed, in percent of the outgoing queries */
+	int hedge_budget;
 
 	/** automatic interface for incoming messages. Uses ipv6 remapping,
 	 * and recvmsg/sendmsg ancillary data to detect interfaces, boolean */
@@ -272,6 +299,12 @@ struct config_file {
 	int prefetch;
 	/** if prefetching of DNSKEYs should be performed. */
 	int prefetch_key;
+	/** if popular message cache entries are refreshed before expiry */
+	int refresh_popular;
+	/** max refreshes of popular entries per second, per thread */
+	int refresh_popular_rate;
+	/** number of popular entries tracked, per thread */
+	size_t refresh_popular_size;
 	/** deny queries of type ANY with an empty answer */
 	int deny_any;
 
@@ -354,6 +387,8 @@ struct config_file {
 	int val_permissive_mode;
 	/** use cached NSEC records to synthesise (negative) answers */
 	int aggressive_nsec;
+	/** use insecure cached DNAMEs to synthesize answers */
+	int synth_insecure_dname;
 	/** ignore the CD flag in incoming queries and refuse them bogus data */
 	int ignore_cd;
 	/** serve expired entries and prefetch them */
@@ -362,6 +397,9 @@ struct config_file {
 	int serve_expired_ttl;
 	/** reset serve expired TTL after failed update attempt */
 	int serve_expired_ttl_reset;
+	/** msec to wait for a fresh answer before serving expired, 0 serves
+	 * the expired answer at once */
+	int serve_expired_client_timeout;
 	/** nsec3 maximum iterations per key size, string */
 	char* val_nsec3_key_iterations;
 	/** autotrust add holddown time, in seconds */
@@ -377,6 +415,18 @@ struct config_file {
 	size_t key_cache_size;
 	/** slabs in the key cache. */
 	size_t key_cache_slabs;
+	/** size of the signature verification result cache, 0 disables */
+	size_t sig_cache_size;
+	/** slabs in the signature verification result cache. */
+	size_t sig_cache_slabs;
+	/** number of threads that verify signatures, 0 verifies inline */
+	int val_crypto_threads;
+	/** size of the NSEC3 hash cache, 0 disables */
+	size_t nsec3_hash_cache_size;
+	/** slabs in the NSEC3 hash cache. */
+	size_t nsec3_hash_cache_slabs;
+	/** max NSEC3 hashes computed per zone per second, 0 is no limit */
+	int nsec3_hash_ratelimit;
 	/** size of the neg cache */
 	size_t neg_cache_size;
 
@@ -363,8 +363,8 @@ static void yynoreturn yy_fatal_error (yyconst char* msg  );
 	*yy_cp = '\0'; \
 	(yy_c_buf_p) = yy_cp;
 
-#define YY_NUM_RULES 291
-#define YY_END_OF_BUFFER 292
+#define YY_NUM_RULES 314
+#define YY_END_OF_BUFFER 315
 /* This struct is not used in this scanner,
    but its presence is necessary. */
 struct yy_trans_info
@@ -372,328 +372,357 @@ struct yy_trans_info
 	flex_int32_t yy_verify;
 	flex_int32_t yy_nxt;
 	};
-static yyconst flex_int16_t yy_accept[2905] =
+static yyconst flex_int16_t yy_accept[3179] =
     {   0,
-        1,    1,  273,  273,  277,  277,  281,  281,  285,  285,
-        1,    1,  292,  289,    1,  271,  271,  290,    2,  290,
-      289,  289,  289,  289,  289,  289,  289,  289,  289,  289,
-      289,  289,  289,  289,  289,  289,  289,  289,  289,  289,
-      289,  289,  273,  274,  274,  275,  290,  277,  278,  278,
-      279,  290,  284,  281,  282,  282,  283,  290,  285,  286,
-      286,  287,  290,  288,  272,    2,  276,  290,  288,  289,
-        0,    1,    2,    2,    2,    2,  289,  289,  289,  289,
-      289,  289,  289,  289,  289,  289,  289,  289,  289,  289,
-      289,  289,  289,  289,  289,  289,  289,  289,  289,  289,
-
-      289,  289,  289,  289,  289,  289,  289,  289,  289,  289,
-      289,  289,  289,  289,  289,  289,  289,  289,  289,  289,
-      289,  289,  289,  289,  289,  289,  289,  289,  289,  289,
-      289,  289,  289,  289,  289,  289,  289,  289,  289,  273,
-        0,  277,    0,  284,    0,  281,  285,    0,  288,    0,
-        2,    2,  288,  289,  289,  289,  289,  289,  289,  289,
-      289,  289,  289,  289,  289,  289,  289,  289,  289,  289,
-      289,  289,  289,  289,  289,  289,  289,  289,  289,  289,
-      289,  289,  289,  289,  289,  289,  289,  289,  289,  289,
-      289,  289,  289,  289,  289,  289,  289,  289,  289,  289,
-
-      289,  289,  289,  289,  289,  289,  289,  289,  289,  289,
-      289,  289,  289,  289,  289,  289,  289,  289,  289,  289,
-      289,  289,  289,  289,  289,  289,  289,  289,  289,  289,
-      289,  289,  289,  289,  289,  289,  289,  289,  289,  289,
-      288,  289,  289,  289,  289,  289,  289,  289,  289,  289,
-      289,  289,  289,  289,  289,  289,  289,  289,  289,  289,
-      289,  289,  289,  289,  289,  289,  289,  289,  289,  289,
-      289,  289,  289,  289,  289,  289,  289,  289,  289,  289,
-      289,  289,  289,  289,  289,  289,  289,  289,  289,  289,
-      289,  289,  289,  289,  289,  289,  289,  289,  289,  289,
-
-      289,  289,  289,  289,  289,  289,  289,  289,  289,  289,
-      289,  289,  289,  289,  289,  289,  289,  289,  289,  289,
-      289,  289,  289,  289,  289,  289,  289,  289,  289,  289,
-      289,  289,  289,  289,  289,  289,  289,  289,  289,  114,
-      289,  289,  289,  289,  289,  289,  289,  288,  289,  289,
-      289,  289,  289,  289,  289,  289,  289,  289,  289,  289,
-      289,  289,  289,  289,  289,  289,  289,  289,  289,  289,
-      289,  289,  289,  289,  289,  289,  289,  289,  289,  289,
-      289,  289,  289,  289,  289,  289,  289,  289,  289,  289,
-      289,  289,  289,  289,  289,  289,  289,  289,  289,  289,
-
-      289,  289,  289,  289,  289,  289,  289,  289,  289,  289,
-      289,  289,  289,  289,  289,  289,  289,  289,  289,  289,
-       96,  289,  289,  289,  289,  289,  289,    8,  289,  289,
-      289,  289,  289,  289,  289,  289,  289,  289,  289,  289,
-      289,  289,  289,  289,  289,  289,  289,  289,  289,  289,
-      289,  289,  289,  289,  289,  289,  289,  289,  289,  289,
-      289,  289,  289,  289,  289,  289,  289,  289,  289,  289,
-      289,  289,  289,  289,  289,  289,  289,  289,  289,  289,
-      289,  289,  119,  289,  288,  289,  289,  289,  289,  289,
-      289,  289,  289,  289,  289,  289,  289,  289,  289,  289,
-
-      289,  289,  289,  289,  289,  289,  289,  289,  289,  289,
-      289,  289,  289,  289,  289,  289,  289,  289,  289,  289,
-      289,  289,  289,  289,  289,  289,  289,  289,  289,  289,
-      289,  289,  289,  289,  289,  289,  289,  289,  289,  289,
-      289,  289,  289,  289,  289,  289,  289,  289,  289,  289,
-      289,  289,  289,  289,  289,  289,  289,  289,  289,  289,
-      289,  289,  289,  289,  289,  289,  289,  289,  289,  289,
-      289,  289,  289,  289,  289,  289,  289,  289,  289,  289,
-      289,  289,  289,  289,  289,  289,  289,  289,  289,  289,
-      289,  289,  289,  289,  289,  289,  289,  289,  289,  289,
-
-      289,  289,  289,  289,  289,  289,  289,  289,  289,  289,
-      289,  289,  289,  289,  289,  289,  289,  289,  289,  289,
-      289,  289,  289,  289,  289,  289,  289,  289,  289,  289,
-      289,  289,  289,  289,  289,  289,  289,  288,  289,  289,
-      289,  289,  289,  289,  289,  289,  289,  289,  289,   54,
-      289,  289,  289,  289,  289,  289,  289,  289,  289,  289,
-      289,  289,  289,  289,  214,  289,   14,   15,  289,   18,
-       17,  289,  289,  289,  289,  289,  289,  289,  289,  289,
-      289,  289,  289,  289,  289,  289,  289,  289,  289,  289,
-      289,  289,  289,  289,  289,  289,  289,  289,  289,  289,
-
-      289,  289,  289,  289,  289,  289,  289,  289,  289,  289,
-      289,  289,  289,  289,  113,  289,  289,  289,  289,  289,
-      289,  289,  289,  289,  289,  289,  289,  289,  289,  289,
-      289,  289,  289,  198,  289,  289,  289,  289,  289,  289,
-      289,  289,  289,  289,  289,  289,  289,  289,    3,  289,
-      289,  289,  289,  289,  289,  289,  289,  289,  289,  289,
-      289,  289,  289,  289,  289,  289,  289,  289,  289,  289,
-      289,  289,  289,  289,  289,  289,  289,  289,  289,  289,
-      289,  289,  289,  289,  289,  289,  289,  289,  289,  289,
-      289,  289,  289,  289,  289,  289,  289,  289,  289,  289,
-
-      289,  288,  289,  289,  289,  289,  289,  289,  289,  264,
-      289,  289,  263,  289,  289,  289,  289,  289,  289,  289,
-      289,  289,  289,  289,  289,  289,  289,  289,  289,  289,
-      289,  289,  289,  289,  289,  289,  289,  289,  289,  289,
-      289,  289,  289,  289,  289,  289,  289,  289,  289,  289,
-      289,  289,  289,  289,  289,  289,  289,  280,  289,  289,
-      289,  289,  289,  289,  289,  289,  289,  289,  289,  289,
-      289,  289,  289,  289,  289,  289,  289,  289,  289,  289,
-      289,   57,  289,  238,  289,  289,  289,  289,  289,  289,
-      289,  289,  289,  289,  289,  289,  289,   58,  289,  289,
-
-      289,  289,  289,  289,  289,  289,  289,  289,  289,  289,
-      289,  289,  289,  289,  289,  289,  289,  289,  187,  289,
-      289,  289,  289,  289,  289,  289,  289,  289,  289,  289,
-      289,  289,  289,  289,  289,  289,  289,  289,  289,   20,
-      289,  289,  289,  289,  289,  289,  289,  289,  289,  289,
-      289,  289,  289,  289,  289,  289,  289,  289,  289,  289,
-      289,  289,  289,  289,  289,  289,  289,  138,  289,  289,
-      280,  289,  289,  289,  289,  289,  289,  289,  289,  289,
-      289,  289,  289,  289,  289,  289,  289,  289,  289,  289,
-      289,   94,  289,  289,  289,  289,  289,  289,  289,  246,
-
-      289,  289,  289,  289,  289,  289,  289,  289,  289,  289,
-      289,  289,  159,  289,  289,  289,  289,  289,  289,  289,
-      289,  289,  289,  289,  289,  289,  289,  289,  289,  289,
-      289,  289,  289,  289,  289,  137,  289,  289,  289,  289,
-      289,  289,  289,  289,  289,  289,  289,  289,  289,  289,
-      289,  289,  289,  289,  289,  289,  289,  289,  289,  289,
-      289,  289,  289,  289,  289,  289,  289,  289,  289,  289,
-      289,  289,  289,  289,  289,  289,   93,  289,  289,  289,
-      289,  289,  289,  289,  289,  289,  289,  289,  289,  289,
-      289,  289,  289,  289,  289,  289,  289,  289,  289,  289,
-
-       31,  289,  289,  289,  289,  289,  289,  289,  289,  289,
-      289,  289,  289,  289,  289,  289,  289,  289,  289,  289,
-       32,  289,  289,  289,  289,  289,  289,  289,  289,  289,
-      289,  289,  289,  289,   55,  289,  289,  289,  289,  289,
-      289,  289,  289,  289,  112,  289,  289,  289,  289,  289,
-      111,  289,  289,  289,  289,  289,  289,  289,  289,  289,
-      289,  289,  289,  289,  289,   56,  289,  289,  289,  289,
-      289,  289,  289,  289,  289,  289,  289,  289,  289,  289,
-      289,  289,  289,  289,  289,  289,  289,  160,  289,  289,
-      289,  289,  289,  289,  289,  289,  289,  289,  289,  289,
-
-      289,  289,  289,  289,  289,  289,  289,  289,  289,  289,
-      289,  289,  289,  289,  289,  289,   45,  289,  289,  289,
-      289,  289,  289,  289,  289,  289,  289,  289,  289,  289,
-      289,  289,  289,  289,  289,  289,  289,  289,  289,  289,
-      289,  289,  289,  289,  289,  289,  289,  289,  289,  289,
-      289,  289,  289,  289,  289,  289,  289,  289,  289,  289,
-      289,  289,  289,  289,  289,  229,  289,  289,  289,  289,
-      289,  289,  289,  289,  289,  289,  289,  289,  289,  289,
-       49,  289,   50,  289,  289,  289,  289,  289,   97,  289,
-       98,  289,  289,  289,  289,   95,  289,  289,  289,  289,
-
-      289,  289,  289,  289,  289,  289,  289,  289,  289,  289,
-      289,  289,  289,  289,  289,  289,  289,  289,  289,  289,
-      289,  289,  289,    7,  289,  289,  289,  289,  289,  289,
-      289,  289,  289,  289,  289,  289,  289,  289,  289,  289,
-      289,  289,  207,  289,  289,  289,  289,  140,  289,  289,
-      289,  289,  289,  289,  289,  289,  289,  289,  289,  289,
-      289,  289,  289,  289,  289,  289,  289,  289,  289,  289,
-      289,  289,  289,  289,  289,  289,  289,  289,  289,  289,
-      289,  289,  289,  289,  289,  289,  289,  289,  289,  289,
-      289,  289,  289,  289,  289,  289,  289,   46,  289,  289,
-
-      289,  289,  289,  289,  289,  289,  289,  289,  289,  289,
-      289,  179,  289,  178,  289,  289,  289,  289,  289,  289,
-      289,  289,  289,  289,  289,  289,  289,  289,  289,  289,
-      289,  289,  289,  289,  289,  289,  289,  289,  289,  289,
-       16,  289,  289,  289,  289,  289,  289,  289,  289,  289,
-      289,  289,  289,   59,  289,  289,  289,  289,  289,  289,
-      289,  289,  186,  289,  289,  289,  289,  289,  289,  100,
-      289,   99,  289,  289,  289,  289,  289,  289,  289,  289,
-      289,  289,  289,  289,  289,  289,  289,  289,  289,  289,
-      289,  289,  170,  289,  289,  289,  289,  289,  289,  289,
-
-      289,  120,  289,  289,  289,  289,  289,  289,  289,  289,
-      289,  289,  289,  289,  289,  289,  289,  289,  289,  289,
-      289,   78,  289,  289,  289,  289,  289,  289,  289,  289,
-      289,  289,  289,  289,  289,  289,  289,  289,  289,  289,
-      289,  289,  289,  289,  289,  289,  289,  289,  289,  289,
-      289,  289,  289,  289,  289,  289,  289,  289,  289,  289,
-      289,   82,  289,  289,  289,  289,  289,  289,  289,  289,
-      289,  289,  289,  289,  289,   53,  289,  289,  289,  289,
-      289,  289,  289,  289,  289,  289,  289,  289,  289,  289,
-      289,  289,  289,  173,  174,  289,  289,  289,  240,  289,
-
-      289,  289,  289,  289,  289,  289,  289,  289,  289,  289,
-      289,    6,  289,  289,  289,  289,  289,  289,  289,  289,
-      289,  289,  289,  289,  289,  289,  289,  289,  289,  289,
-      289,  289,  244,  289,  289,  289,  265,  289,  289,  289,
-      289,  289,  289,  289,  289,  289,  289,  289,  289,  289,
-      289,  289,  289,  289,  289,  289,  289,   41,  289,  289,
-      289,  289,  289,  289,  289,  289,  289,  289,  289,  289,
-       43,  289,  289,  289,  289,  289,  289,  289,  289,  166,
-      289,  289,  289,  115,  289,  289,  289,  289,  289,  289,
-      289,  289,  289,  289,  191,  289,  167,  289,  289,  289,
-
-      204,  289,  289,  289,  289,  289,  289,  289,  289,  289,
-      289,  289,  289,  289,  289,  289,  289,   44,  289,  289,
-      289,  289,  289,  289,  289,  289,  289,  117,  105,  289,
-      106,  289,  289,  289,  104,  289,  289,  289,  289,  289,
-      289,  289,  289,  135,  289,  289,  289,  289,  289,  289,
-      289,  289,  289,  289,  289,  228,  289,  289,  289,  289,
-      289,  289,  289,  289,  168,  289,  289,  289,  289,  289,
-      171,  289,  177,  289,  289,  289,  289,  289,  203,  289,
-      289,  289,  289,  289,  289,  289,  289,  289,  289,  289,
-      289,  289,  289,   92,  289,  289,  289,  289,  289,  289,
-
-      289,  289,  289,  289,  289,  289,  289,  289,  289,  289,
-      289,  289,  289,  289,  289,   51,  289,  289,  289,   25,
-      289,  289,  289,  289,  289,  289,  289,  289,  289,   19,
-      289,  289,  289,  289,  289,  289,   26,   35,  289,  145,
-      289,  289,  289,  289,  289,  289,  289,  289,  289,  289,
-      289,  289,  289,  289,  289,  289,  289,  289,  289,   67,
-       69,  289,  289,  289,  289,  289,  289,  289,  289,  289,
-      289,  289,  289,  289,  248,  289,  289,  289,  215,  289,
-      289,  289,  289,  289,  289,  289,  289,  289,  289,  289,
-      289,  289,  289,  289,  289,  289,  289,  107,  289,  289,
-
-      289,  289,  289,  289,  289,  289,  289,  134,  289,  289,
-      289,  289,  289,  289,  289,  289,  289,  289,  289,  289,
-      289,  289,  289,  259,  289,  289,  289,  289,  289,  289,
-      289,  289,  289,  289,  289,  289,  289,  289,  289,  289,
-      289,  289,  139,  289,  289,  289,  289,  289,  289,  289,
-      289,  289,  289,  289,  289,  289,  197,  289,  289,  289,
-      289,  289,  289,  289,  289,  268,  289,  289,  289,  289,
-      289,  289,  289,  289,  289,  156,  289,  289,  289,  289,
-      289,  289,  289,  289,  101,  289,  289,  289,  289,  289,
-      289,  289,  289,  289,  289,  289,  289,  289,  289,  289,
-
-      289,  289,  289,  289,  151,  289,  161,  289,  289,  289,
-      289,  289,  123,  289,  289,  289,  289,  289,   88,  289,
-      289,  289,  289,  189,  289,  289,  289,  289,  289,  289,
-      205,  289,  289,  289,  289,  289,  289,  289,  289,  289,
-      289,  289,  289,  220,  289,  289,  289,  289,  289,  289,
-      289,  289,  289,  116,  289,  289,  289,  289,  289,  289,
-      289,  289,  289,  289,  155,  289,  289,  289,  289,  289,
-       70,   71,  289,  289,  289,  289,  289,   52,  289,  289,
-      289,  289,  289,   77,  162,  289,  180,  289,  208,  289,
-      289,  172,  241,  289,  289,  289,  289,  289,   63,  289,
-
-      164,  289,  289,  289,  289,  289,    9,  289,  289,  289,
-       91,  289,  289,  289,  289,  233,  289,  289,  289,  188,
-      289,  289,  289,  289,  289,  289,  289,  289,  289,  289,
-      289,  289,  289,  289,  289,  289,  289,  289,  289,  289,
-      289,  289,  289,  289,  289,  289,  289,  289,  289,  289,
-      289,  289,  289,  289,  289,  289,  289,  289,  289,  289,
-      289,  289,  289,  289,  289,  154,  289,  289,  289,  289,
-      289,  289,  289,  289,  289,  289,  141,  289,  247,  289,
-      289,  289,  289,  219,  289,  289,  289,  289,  289,  289,
-      289,  289,  199,  289,  289,  289,  289,  239,  289,  289,
-
-      289,  289,  289,  289,  289,  289,  289,  289,  289,  289,
-      289,  289,  289,  289,  289,  289,  289,  289,  289,  289,
-      289,  289,  262,  289,  163,  289,  289,  289,  289,  289,
-      289,  289,   62,   64,  289,  289,  289,  289,  289,  289,
-      289,   90,  289,  289,  289,  289,  231,  289,  289,  289,
-      243,  289,  289,  289,  289,  289,  289,  289,  193,   33,
-       27,   29,  289,  289,  289,  289,  289,  289,  289,  289,
-      289,   34,  289,   28,   30,  289,  289,  289,  289,  289,
-      289,  289,  289,   87,  289,  289,  289,  289,  289,  289,
-      289,  289,  289,  289,  289,  289,  289,  289,  289,  289,
-
-      289,  195,  192,  289,  289,  289,  289,  289,  289,  289,
-      289,  289,  289,  289,  289,  289,  289,   61,  289,  289,
-      118,  289,  108,  289,  289,  289,  289,  289,  289,  289,
-      289,  136,   13,  289,  289,  289,  289,  289,  289,  289,
-      289,  289,  257,  289,  260,  289,  289,  289,  289,  289,
-      289,  289,  289,  289,  289,   12,  289,  289,   21,  289,
-      289,  289,  237,  289,  289,  289,  245,  289,   65,  289,
-      201,  289,  289,  194,  289,  289,   60,  289,  289,  289,
-      289,   22,  289,   42,  289,  289,  289,  289,  289,  289,
-      289,  289,  289,  289,  289,  289,  150,  149,  289,  289,
-
-      289,  289,  289,  289,  289,  289,  289,  196,  190,  289,
-      206,  289,  289,  249,  289,  289,  289,  289,  289,  289,
-      289,  289,  289,  289,  289,  289,  289,  289,  289,  289,
-      289,  289,  289,  289,  289,  289,  289,  289,   72,  289,
-      289,  289,  232,  289,  289,  289,  289,  176,  289,  289,
-      289,  289,  200,  289,  289,  289,  289,  289,  289,  289,
-      289,  266,  267,  147,   66,  289,  289,  157,  289,  289,
-      102,  103,  289,  289,  289,  289,  142,  289,  144,  289,
-      181,  289,  289,  289,  289,  148,  289,  289,  209,  289,
-      289,  289,  289,  289,  289,  289,  125,  289,  289,  289,
-
-      289,  289,  289,  289,  289,  289,  289,  289,  216,  289,
-      289,  289,   23,  289,  242,  289,  289,  289,  289,  289,
-      289,  289,  289,  289,  289,  289,  182,  289,  289,  230,
-      289,  261,  289,  175,  289,  289,  289,  289,   47,  289,
-      289,  289,  289,    4,  289,  289,  124,  289,  289,  289,
-      289,  289,  289,  289,  289,  289,  289,  289,  289,  289,
-      289,  289,  289,  212,   36,   37,  289,  289,  289,  289,
-      289,  289,  289,  250,  289,  289,  289,  289,  289,  289,
-      218,  289,  289,  289,  185,  289,  289,  289,  289,  289,
-      289,  289,  289,  289,   75,  289,   48,  236,  289,  213,
-
-      289,  289,  289,  289,   11,  289,  289,  289,  289,  289,
-      289,  289,  183,   79,  289,   39,  289,  289,  289,  289,
-      289,  289,  289,  289,  153,  289,  289,  289,  289,  289,
-      127,  289,  289,  289,  289,  289,  289,  289,  289,  289,
-      217,  121,  289,  289,  109,  110,  289,  289,  289,   81,
-       85,   80,  289,   73,  289,  289,  289,  289,  289,   10,
-      289,  289,  289,  234,  289,  289,  270,   38,  289,  289,
-      289,  289,  289,  152,  289,  289,  289,  289,  289,  289,
-      289,  289,  289,  289,  289,  289,  289,  289,  289,  289,
-      289,  289,   86,   84,  289,   74,  258,  289,  289,  289,
-
-      289,  289,  289,  289,  169,  289,  289,  289,  184,  289,
-      289,  289,  289,  289,  289,  289,  289,  143,   68,  289,
-      289,  289,  289,  289,  251,  289,  289,  289,  289,  289,
-      289,  289,  122,  289,   83,  128,  129,  132,  133,  130,
-      131,   76,  289,  235,  289,  289,  146,  289,  289,  289,
-      289,  289,  211,  289,  289,  289,  289,  289,  289,  289,
-      289,  289,  289,  289,  289,  289,  289,  158,   40,  289,
-      289,  289,  289,  289,  289,  289,  289,  289,  289,  289,
-      289,  289,  289,  289,  289,  289,  289,  289,  289,  289,
-       89,  289,  210,  289,  227,  255,  289,  289,  289,  289,
-
-      289,  289,  289,  289,  289,  289,    5,  289,  202,  289,
-      289,  256,  289,  289,  289,  289,  289,  289,  289,  289,
-       24,  289,  289,  289,  289,  289,  289,  289,  289,  289,
-      289,  289,  289,  289,  126,  289,  289,  289,  289,  289,
-      289,  289,  289,  289,  165,  289,  289,  289,  289,  289,
-      289,  289,  289,  289,  252,  289,  289,  289,  289,  289,
-      289,  289,  289,  289,  289,  289,  289,  289,  289,  289,
-      289,  289,  269,  289,  289,  223,  289,  289,  289,  289,
-      289,  253,  289,  289,  289,  289,  289,  289,  254,  289,
-      289,  289,  221,  289,  224,  225,  289,  289,  289,  289,
-
-      289,  222,  226,    0
+        1,    1,  296,  296,  300,  300,  304,  304,  308,  308,
+        1,    1,  315,  312,    1,  294,  294,  313,    2,  313,
+      312,  312,  312,  312,  312,  312,  312,  312,  312,  312,
+      312,  312,  312,  312,  312,  312,  312,  312,  312,  312,
+      312,  312,  312,  296,  297,  297,  298,  313,  300,  301,
+      301,  302,  313,  307,  304,  305,  305,  306,  313,  308,
+      309,  309,  310,  313,  311,  295,    2,  299,  313,  311,
+      312,    0,    1,    2,    2,    2,    2,  312,  312,  312,
+      312,  312,  312,  312,  312,  312,  312,  312,  312,  312,
+      312,  312,  312,  312,  312,  312,  312,  312,  312,  312,
+
+      312,  312,  312,  312,  312,  312,  312,  312,  312,  312,
+      312,  312,  312,  312,  312,  312,  312,  312,  312,  312,
+      312,  312,  312,  312,  312,  312,  312,  312,  312,  312,
+      312,  312,  312,  312,  312,  312,  312,  312,  312,  312,
+      312,  312,  312,  312,  312,  312,  312,  296,    0,  296,
+      300,    0,  300,  307,    0,  304,  307,  308,    0,  308,
+      311,    0,    2,    2,  311,  311,    2,  312,  312,  312,
+      312,  312,  312,  312,  312,  312,  312,  312,  312,  312,
+      312,  312,  312,  312,  312,  312,  312,  312,  312,  312,
+      312,  312,  312,  312,  312,  312,  312,  312,  312,  312,
+
+      312,  312,  312,  312,  312,  312,  312,  312,  312,  312,
+      312,  312,  312,  312,  312,  312,  312,  312,  312,  312,
+      312,  312,  312,  312,  312,  312,  312,  312,  312,  312,
+      312,  312,  312,  312,  312,  312,  312,  312,  312,  312,
+      312,  312,  312,  312,  312,  312,  312,  312,  312,  312,
+      312,  312,  312,  312,  312,  312,  312,  312,  312,  312,
+      312,  312,    2,  311,  312,  312,  312,  312,  312,  312,
+      312,  312,  312,  312,  312,  312,  312,  312,  312,  312,
+      312,  312,  312,  312,  312,  312,  312,  312,  312,  312,
+      312,  312,  312,  312,  312,  312,  312,  312,  312,  312,
+
+      312,  312,  312,  312,  312,  312,  312,  312,  312,  312,
+      312,  312,  312,  312,  312,  312,  312,  312,  312,  312,
+      312,  312,  312,  312,  312,  312,  312,  312,  312,  312,
+      312,  312,  312,  312,  312,  312,  312,  312,  312,  312,
+      312,  312,  312,  312,  312,  312,  312,  312,  312,  312,
+      312,  312,  312,  312,  312,  312,  312,  312,  312,  312,
+      312,  312,  312,  312,  312,  312,  312,  312,  312,  124,
+      312,  312,  312,  312,  312,  312,  312,  312,  311,  312,
+      312,  312,  312,  312,  312,  312,  312,  312,  312,  312,
+      312,  312,  312,  312,  312,  312,  312,  312,  312,  312,
+
+      312,  312,  312,  312,  312,  312,  312,  312,  312,  312,
+      312,  312,  312,  312,  312,  312,  312,  312,  312,  312,
+      312,  312,  312,  312,  312,  312,  312,  312,  312,  312,
+      312,  312,  312,  312,  312,  312,  312,  312,  312,  312,
+      312,  312,  312,  312,  312,  312,  312,  312,  312,  312,
+      312,  312,  312,  106,  312,  312,  312,  312,  312,  312,
+      312,    8,  312,  312,  312,  312,  312,  312,  312,  312,
+      312,  312,  312,  312,  312,  312,  312,  312,  312,  312,
+      312,  312,  312,  312,  312,  312,  312,  312,  312,  312,
+      312,  312,  312,  312,  312,  312,  312,  312,  312,  312,
+
+      312,  312,  312,  312,  312,  312,  312,  312,  312,  312,
+      312,  312,  312,  312,  312,  312,  312,  312,  312,  312,
+      129,  312,  312,  311,  312,  312,  312,  312,  312,  312,
+      312,  312,  312,  312,  312,  312,  312,  312,  312,  312,
+      312,  312,  312,  312,  312,  312,  312,  312,  312,  312,
+      312,  312,  312,  312,  312,  312,  312,  312,  312,  312,
+      312,  312,  312,  312,  312,  312,  312,  312,  312,  312,
+      312,  312,  312,  312,  312,  312,  312,  312,  312,  312,
+      312,  312,  312,  312,  312,  312,  312,  312,  312,  312,
+      312,  312,  312,  312,  312,  312,  312,  312,  312,  312,
+
+      312,  312,  312,  312,  312,  312,  312,  312,  312,  312,
+      312,  312,  312,  312,  312,  312,  312,  312,  312,  312,
+      312,  312,  312,  312,  312,  312,  312,  312,  312,  312,
+      312,  312,  312,  312,  312,  312,  312,  312,  312,  312,
+      312,  312,  312,  312,  312,  312,  312,  312,  312,  312,
+      312,  312,  312,  312,  312,  312,  312,  312,  312,  312,
+      312,  312,  312,  312,  312,  312,  312,  312,  312,  312,
+      312,  312,  312,  312,  312,  312,  312,  312,  312,  312,
+      312,  312,  312,  312,  312,  312,  311,  312,  312,  312,
+      312,  312,  312,  312,  312,  312,  312,  312,   54,  312,
+
+      312,  312,  312,  312,  312,  312,  312,  312,  312,  312,
+      312,  312,  312,  232,  312,   14,   15,  312,   18,   17,
+      312,  312,  312,  312,  312,  312,  312,  312,  312,  312,
+      312,  312,  312,  312,  312,  312,  312,  312,  312,  312,
+      312,  312,  312,  312,  312,  312,  312,  312,  312,  312,
+      312,  312,  312,  312,  312,  312,  312,  312,  312,  312,
+      312,  312,  312,  312,  312,  123,  312,  312,  312,  312,
+      312,  312,  312,  312,  312,  312,  312,  312,  312,  312,
+      312,  312,  312,  312,  312,  312,  312,  216,  312,  312,
+      312,  312,  312,  312,  312,  312,  312,  312,  312,  312,
+
+      312,  312,  312,    3,  312,  312,  312,  312,  312,  312,
+      312,  312,  312,  312,  312,  312,  312,  312,  312,  312,
+      312,  312,  312,  312,  312,  312,  312,  312,  312,  312,
+      312,  312,  312,  312,  312,  312,  312,  312,  312,  312,
+      312,  312,  312,  312,  312,  312,  312,  312,  312,  312,
+      312,  312,  312,  312,  312,  312,  312,  312,  312,  312,
+      312,  311,  312,  312,  312,  312,  312,  312,  312,  287,
+      312,  312,  286,  312,  312,  312,  312,  312,  312,  312,
+      312,  312,  312,  312,  312,  312,  312,  312,  312,  312,
+      312,  312,  312,  312,  312,  312,  312,  312,  312,  312,
+
+      312,  312,  312,  312,  312,  312,  312,  312,  312,  312,
+      312,  312,  312,  312,  312,  312,  312,  312,  312,  303,
+      312,  312,  312,  312,  312,  312,  312,  312,  312,  312,
+      312,  312,  312,  312,  312,  312,  312,  312,  312,  312,
+      312,  312,  312,   57,  312,  256,  312,  312,  312,  312,
+      312,  312,  312,  312,  312,  312,  312,  312,  312,  312,
+      312,  312,   58,  312,  312,  312,  312,  312,  312,  312,
+      312,  312,  312,  312,  312,  312,  312,  312,  312,  312,
+      312,  312,  312,  312,  205,  312,  312,  312,  312,  312,
+      312,  312,  312,  312,  312,  312,  312,  312,  312,  312,
+
+      312,  312,  312,  312,  312,  312,  312,   20,  312,  312,
+      312,  312,  312,  312,  312,  312,  312,  312,  312,  312,
+      312,  312,  312,  312,  312,  312,  312,  312,  312,  312,
+      312,  312,  312,  312,  312,  312,  312,  312,  148,  312,
+      312,  312,  303,  312,  312,  312,  312,  312,  312,  312,
+      312,  312,  312,  312,  312,  312,  312,  312,  312,  312,
+      312,  312,  312,  104,  312,  312,  312,  312,  312,  312,
+      312,  269,  312,  312,  312,  312,  312,  312,  312,  312,
+      312,  312,  312,  312,  171,  312,  312,  312,  312,  312,
+      312,  312,  312,  312,  312,  312,  312,  312,  312,  312,
+
+      312,  312,  312,  312,  312,  312,  312,  312,  312,  147,
+      312,  312,  312,  312,  312,  312,  312,  312,  312,  312,
+      312,  312,  312,  312,  312,  312,  312,  312,  312,  312,
+      312,  312,  312,  312,  312,  312,  312,  312,  312,  312,
+      312,  312,  312,  312,  312,  312,  312,  312,  312,  312,
+      312,  312,  312,  103,  312,  312,  312,  312,  312,  312,
+      312,  312,  312,  312,  312,  312,  312,  312,  312,  312,
+      312,  312,  312,  312,  312,  312,  312,  312,  312,   31,
+      312,  312,  312,  312,  312,  312,  312,  312,  312,  312,
+      312,  312,  312,  312,  312,  312,  312,  312,  312,  312,
+
+       32,  312,  312,  312,  312,  312,  312,  312,  312,  312,
+      312,  312,  312,  312,  312,  312,   55,  312,  312,  312,
+      312,  312,  312,  312,  312,  312,  312,  312,  122,  312,
+      312,  312,  312,  312,  121,  312,  312,  312,  312,  312,
+      312,  312,  312,  312,  312,  312,  312,  312,  312,   56,
+      312,  312,  312,  312,  312,  312,  312,  312,  312,  312,
+      312,  312,  312,  312,  312,  312,  312,  312,  312,  312,
+      312,  172,  312,  312,  312,  312,  312,  312,  312,  312,
+      312,  312,  312,  312,  312,  312,  312,  312,  312,  312,
+      312,  312,  312,  312,  312,  312,  312,  312,  312,  312,
+
+      312,  312,   45,  312,  312,  312,  312,  312,  312,  312,
+      312,  312,  312,  312,  312,  312,  312,  312,  312,  312,
+      312,  312,  312,  312,  312,  312,  312,  312,  312,  312,
+      312,  312,  312,  312,  312,  312,  312,  312,  312,  312,
+      312,  312,  312,  312,  312,  312,  312,  312,  312,  312,
+      312,  312,  312,  312,  247,  312,  312,  312,  312,  312,
+      312,  312,  312,  312,  312,  312,  312,  312,  312,  312,
+      312,   49,  312,   50,  312,  312,  312,  312,  312,  107,
+      312,  108,  312,  312,  312,  312,  105,  312,  312,  312,
+      312,  312,  312,  312,  312,  312,  312,  312,  312,  312,
+
+      312,  312,  312,  312,  312,  312,  312,  312,  312,  312,
+      312,  312,  312,  312,  312,  312,  312,  312,    7,  312,
+      312,  312,  312,  312,  312,  312,  312,  312,  312,  312,
+      312,  312,  312,  312,  312,  312,  312,  312,  225,  312,
+      312,  312,  312,  150,  312,  312,  312,  312,  312,  312,
+      312,  312,  312,  312,  312,  312,  312,  312,  312,  312,
+      312,  312,  312,  312,  312,  312,  312,  312,  312,  312,
+      312,  312,  312,  312,  312,  312,  312,  312,  312,  312,
+      312,  312,  312,  312,  312,  312,  312,  312,  312,  312,
+      312,  312,  312,  312,  312,   46,  312,  312,  312,  312,
+
+      312,  312,  312,  312,  312,  312,  312,  312,  312,  197,
+      312,  196,  312,  312,  312,  312,  312,  312,  312,  312,
+      312,  312,  312,  312,  312,  312,  312,  312,  312,  312,
+      312,  312,  312,  312,  312,  312,  312,  312,  312,  312,
+      312,   16,  312,  312,  312,  312,  312,  312,  312,  312,
+      312,  312,  312,  312,  312,   59,  312,  312,  312,  312,
+      312,  312,  312,  312,  204,  312,  312,  312,  312,  312,
+      312,  312,  110,  312,  109,  312,  312,  312,  312,  312,
+      312,  312,  312,  312,  312,  312,  312,  312,  312,  312,
+      312,  312,  312,  312,  312,  312,  312,  312,  188,  312,
+
+      312,  312,  312,  312,  312,  312,  312,  312,  130,  312,
+      312,  312,  312,  312,  312,  312,  312,  312,  312,  312,
+      312,  312,  312,  312,  312,  312,  312,  312,  312,   87,
+      312,  312,  312,  312,  312,  312,  312,  312,  312,  312,
+      312,  312,  312,  312,  312,  312,  312,  312,  312,  312,
+      312,  312,  312,  312,  312,  312,  312,  312,  312,  312,
+      312,  312,  312,  312,  312,  312,  312,  312,  312,   92,
+      312,  312,  312,  312,  312,  312,  312,  312,  312,  312,
+      312,  312,  312,  312,  312,   53,  312,  312,  312,  312,
+      312,  312,  312,  312,  312,  312,  312,  312,  312,  312,
+
+      312,  312,  312,  191,  192,  312,  312,  312,  258,  312,
+      312,  312,  312,  312,  312,  312,  312,  312,  312,  312,
+      312,  312,  312,  312,  312,  312,    6,  312,  312,  312,
+      312,  312,  312,  312,  312,  312,  312,  312,  312,  312,
+      312,  312,  312,  312,  312,  312,  312,  312,  267,  312,
+      312,  312,  288,  312,  312,  312,  312,  312,  312,  312,
+      312,  312,  312,  312,  312,  312,  312,  312,  312,  312,
+      312,  312,  312,  312,  312,  312,   41,  312,  312,  312,
+      312,  312,  312,  312,  312,  312,  312,  312,  312,  312,
+      312,   43,  312,  312,  312,  312,  312,  312,  312,  312,
+
+      312,  312,  184,  312,  312,  312,  125,  312,  312,  312,
+      312,  312,  312,  312,  312,  312,  312,  209,  312,  185,
+      312,  312,  312,  222,  312,  312,  312,  312,  312,  312,
+      312,  312,  312,  312,  312,  312,  312,  312,  312,  312,
+       44,  312,  312,  312,  312,  312,  312,  312,  312,  312,
+      127,  115,  312,  116,  312,  312,  312,  114,  312,  312,
+      312,  312,  312,  312,  261,  312,  312,  312,  145,  312,
+      312,  312,  312,  312,  312,  312,  312,  312,  312,  312,
+      312,  246,  312,  312,  312,  312,  312,  312,  312,  312,
+      186,  312,  312,  312,  312,  312,  189,  312,  195,  312,
+
+      312,  312,  312,  312,  221,  312,  312,  312,  312,  312,
+      312,  312,  312,  312,  312,  312,  312,  312,  312,  312,
+      312,  312,  312,  312,  102,  312,  312,  312,  312,  312,
+      312,  312,  312,  312,  312,  312,  312,  312,  312,  312,
+      312,  312,  312,  312,  312,  312,  312,  312,  312,   51,
+      312,  312,  312,   25,  312,  312,  312,  312,  312,  312,
+      312,  312,  312,  312,   19,  312,  312,  312,  312,  312,
+      312,   26,   35,  312,  312,  312,  155,  312,  312,  312,
+      312,  312,  312,  312,  312,  312,  312,  312,  312,  312,
+      312,  312,  312,  312,  312,  312,  312,  312,   67,   69,
+
+      312,  312,  312,  312,  312,  312,  312,  312,  312,  312,
+      312,  312,  312,  271,  312,  312,  312,  233,  312,  312,
+      312,  312,  312,  312,  312,  312,  312,  312,  312,  312,
+      312,  312,  312,  312,  312,  312,  117,  312,  312,  312,
+      312,  312,  312,  312,  312,  312,  312,  144,  312,  312,
+      312,  312,  312,  312,  312,  312,  312,  312,  312,  312,
+      312,  312,  312,  312,  282,  312,  312,  312,  312,  312,
+      312,  312,  312,  312,  312,  312,  312,  312,  312,  312,
+      312,  312,  312,  312,  312,  312,  149,  312,  312,  312,
+      312,  312,  312,  312,  312,  312,  312,  312,  312,  312,
+
+      312,  312,  215,  312,  312,  312,  312,  312,  312,  312,
+      312,  291,  312,  312,  312,  312,  312,  312,  312,  312,
+      312,  312,  167,  312,  312,  312,  312,  312,  312,  312,
+      312,  312,  312,  111,  312,  312,  312,  312,  312,  312,
+      312,  312,  312,  312,  312,  312,  312,  312,  312,  312,
+      312,  312,  312,  312,  312,  312,  161,  312,  312,  173,
+      312,  312,  312,  312,   83,  312,  133,  312,  312,  312,
+      312,  312,   98,  312,  312,  312,  312,  207,  312,  312,
+      312,  312,  312,  312,  223,  312,  312,  312,  312,  312,
+      312,  312,  312,  312,  312,  312,  312,  238,  312,  312,
+
+      312,  312,  312,  312,  312,  312,  312,  126,  312,  312,
+      312,  312,  312,  312,  312,  312,  312,  312,  312,  166,
+      312,  312,  312,  312,  312,  312,   70,   71,  312,  312,
+      312,  312,  312,   52,  312,  312,  312,  312,  312,   78,
+      174,  312,  198,  312,  226,  312,  312,  190,  259,  312,
+      312,  312,  312,  312,  312,  312,  312,   63,  312,  182,
+      312,  312,  312,  312,  312,  312,  312,    9,  312,  312,
+      312,  101,  312,  312,  312,  312,  251,  312,  312,  312,
+      312,  206,  312,  312,  312,  312,  312,  312,  312,  312,
+      312,  312,  312,  176,  312,  312,  312,  312,  312,  312,
+
+      312,  312,  312,  312,  312,  312,  312,  312,  312,  312,
+      312,  312,  312,  312,  312,  312,  312,  312,  312,  312,
+      312,  312,  312,  312,  312,  312,  312,  312,  312,  312,
+      312,  312,  312,  312,  312,  164,  312,  312,  312,  312,
+      312,  312,  312,  312,  312,  312,  151,  312,  270,  312,
+      312,  312,  312,  237,  312,  312,  312,  312,  312,  312,
+      312,  312,  217,  312,  312,  312,  312,  257,  312,  312,
+      312,  312,  312,  312,  312,  312,  312,  312,  312,  312,
+      312,  312,  312,  312,  312,  312,  312,  312,  312,  312,
+      312,  312,  312,  312,  285,  312,  175,  312,  312,  312,
+
+      312,  312,  312,  312,  312,   84,  312,  312,   62,   64,
+      312,  312,  312,  312,  312,  312,  312,  312,  312,  100,
+      312,  312,  312,  312,  249,  312,  312,  312,  262,  312,
+      266,  312,  312,  312,  312,  312,  312,  312,  312,  211,
+      177,   33,   27,   29,  312,  312,  312,  312,  312,  312,
+      312,  312,  312,  312,  312,   34,  312,   28,   30,  312,
+      312,  312,  312,  312,  312,  312,  312,  312,  312,   97,
+      312,  312,  312,  312,  312,  312,  312,  312,  312,  312,
+      312,  312,  312,  312,  312,  312,  312,  312,  213,  210,
+      312,  312,  312,  312,  312,  312,  312,  312,  312,  312,
+
+      312,  312,  312,  312,   61,  312,  312,  128,  312,  118,
+      312,  312,  312,  312,  312,  312,  312,  312,  260,  146,
+       13,  312,  312,  312,  312,  312,  312,  312,  312,  312,
+      312,  280,  312,  283,  312,  312,  312,  312,  312,  312,
+       80,  312,  312,  312,  312,  312,  312,  312,  312,   12,
+      312,  312,   21,  312,  312,  312,  255,  312,  312,  312,
+      312,  312,  268,  312,   65,  312,  219,  312,  312,  312,
+      212,  312,  312,   60,  312,  312,  312,  312,  312,  312,
+       22,  312,   42,  312,  312,  312,  312,  312,  312,  312,
+      312,  312,  312,  312,  312,  312,  312,  312,  160,  159,
+
+      312,  312,  312,  312,  312,  312,  312,  312,  312,  214,
+      208,  312,  224,  312,  312,  272,  312,  312,  312,  312,
+      312,  312,  312,  312,  312,  312,  312,  312,  312,  312,
+      312,  312,  312,  312,  312,  312,  312,  312,  312,  312,
+      312,   72,  312,  312,  312,  250,  312,  312,  312,  312,
+      194,  312,  312,  312,   79,  312,  312,  218,  312,  312,
+      312,  312,  312,  312,  312,  312,  312,  312,  289,  290,
+      312,  312,  157,   66,  312,  312,  312,  168,  312,  312,
+      112,  113,  312,  312,  312,  312,  312,  312,   81,  312,
+      152,  312,  154,  312,  199,  312,  312,  312,  312,  312,
+
+      158,  312,  312,  227,  312,  312,  312,  312,  312,  312,
+      312,  135,  312,  312,  312,  312,  312,  312,  312,  312,
+      312,  312,  312,  234,  312,  312,  312,   23,  312,  265,
+      312,  312,  312,  312,  312,  312,  312,  312,  312,  312,
+      312,  312,  200,  312,  312,  248,  312,  284,  312,  193,
+      312,  312,  312,  312,  312,  312,  312,  312,   47,  312,
+      312,  312,  312,    4,  312,  312,  312,  312,  134,  312,
+      312,  312,  312,  312,  312,  312,  312,  312,  312,  312,
+      312,  312,  312,  312,  312,  178,  312,  312,  312,  312,
+      230,   36,   37,  312,  312,  312,  312,  312,  312,  312,
+
+      273,  312,  312,  312,  312,  312,  312,  236,  312,  312,
+      312,  203,  312,  312,  312,  312,  312,  312,  312,  312,
+      312,   75,  312,  312,   48,  254,  312,  231,  312,  312,
+      312,  312,  312,  312,  312,  312,   11,  312,  312,  312,
+      312,  312,  312,  312,  312,  312,  312,  201,  312,  312,
+       88,  312,   39,  312,  312,  312,  312,  312,  312,  312,
+      312,  312,  163,  312,  312,  312,  312,  312,  137,  312,
+      312,  312,  312,  312,  312,  312,  312,  312,  235,  131,
+      312,  312,  119,  120,  312,  312,  312,   91,   95,   90,
+      312,   73,  312,  312,  312,  312,  312,  312,  312,  312,
+
+      181,  312,   10,  312,  312,  312,  252,  263,  264,  312,
+      312,  312,  165,  312,  293,   38,  312,   82,  312,  312,
+      312,  312,  162,  312,  312,  312,  312,  312,  312,  312,
+      312,  312,  312,  312,  312,  312,  312,  312,  312,  312,
+      312,   96,   94,  312,   74,  312,  281,  312,  312,  312,
+      312,  312,  312,  312,  179,  312,  312,  187,  312,  312,
+      312,  312,  202,   89,  312,  312,  312,  312,  312,  312,
+      312,  312,  153,   68,  312,  312,  312,  312,  312,  274,
+      312,  312,  312,  312,  312,  312,  312,  132,  312,   93,
+      312,  138,  139,  142,  143,  312,  140,  141,  180,   77,
+
+      312,  253,  312,  312,  312,  156,  312,  312,  312,  312,
+      312,  229,  312,  312,  312,  312,  312,  312,  312,  312,
+      312,  312,  312,  312,  312,  312,  312,  312,  312,  169,
+       40,  312,  312,  312,  312,  312,  312,  312,  312,  312,
+      312,  312,  312,  312,  312,  312,  312,  312,  312,  312,
+      312,  312,  312,  312,  312,  312,   99,  312,  228,  312,
+      245,  278,  312,  312,  312,  312,  312,  312,  312,  312,
+      312,  312,  312,   85,   86,    5,  312,  312,  220,  312,
+      312,  279,  312,  312,  312,  312,  312,  312,  312,  312,
+       24,   76,  312,  312,  312,  312,  312,  312,  312,  312,
+
+      312,  312,  312,  312,  312,  312,  312,  136,  312,  312,
+      312,  312,  312,  312,  312,  312,  170,  312,  183,  312,
+      312,  312,  312,  312,  312,  312,  312,  312,  275,  312,
+      312,  312,  312,  312,  312,  312,  312,  312,  312,  312,
+      312,  312,  312,  312,  312,  312,  292,  312,  312,  241,
+      312,  312,  312,  312,  312,  276,  312,  312,  312,  312,
+      312,  312,  277,  312,  312,  312,  239,  312,  242,  243,
+      312,  312,  312,  312,  312,  240,  244,    0
     } ;
 
 static yyconst YY_CHAR yy_ec[256] =
@@ -730,1926 +759,1688 @@ static yyconst YY_CHAR yy_ec[256] =
 
 static yyconst YY_CHAR yy_meta[41] =
     {   0,
-        1,    2,    3,    4,    5,    1,    6,    1,    1,    1,
-        1,    1,    7,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1
     } ;
 
-static yyconst flex_uint16_t yy_base[2919] =
+static yyconst flex_int16_t yy_base[3179] =
     {   0,
-        0,    0,   38,   41,   44,   46,   59,   65,   71,   77,
-       90,  112, 2146, 1869,   81, 5674, 5674, 5674,   96,   52,
-      106,   63,  107,  111,   70,  128,  130,  133,   57,   88,
-       76,  135,  141,  117,  148,  145,  160,  164,  185,  176,
-      191,  152, 1830, 5674, 5674, 5674,  107, 1790, 5674, 5674,
-     5674,  165, 1674, 1331, 5674, 5674, 5674,  211, 1221, 5674,
-     5674, 5674,  180, 1211, 5674,  217, 5674,  221,  168,  962,
-      225,  189,    0,  232,    0,    0,  226,  189,   85,  221,
-      114,  227,  234,  156,  219,  235,  239,  236,  238,  132,
-      246,  242,  241,  252,  244,  247,  266,  243,  258,  273,
-
-      275,  187,  277,  278,  267,  274,  280,  283,  287,  289,
-      295,  297,  298,  299,  304,  305,  306,  311,  307,  315,
-      309,  313,  330,  318,  329,  325,  320,  335,  336,  339,
-      340,  343,  345,  342,  346,  350,  349,  355,  357,  907,
-      373,  754,  376,  671,  382,  632,  365,  386,  198,  390,
-      394,    0,  386,  374,  396,  388,  392,  393,  257,  391,
-      395,  397,  398,  400,  402,  415,  404,  413,  421,  423,
-      427,  424,  431,  434,  435,  436,  437,  419,  448,  446,
-      451,  443,  452,  454,  455,  458,  459,  474,  460,  461,
-      410,  468,  476,  478,  485,  470,  488,  489,  486,  493,
-
-      491,  501,  503,  499,  500,  502,  504,  505,  509,  510,
-      512,  514,  517,  515,  516,  520,  522,  521,  529,  523,
-      534,  535,  542,  537,  538,  544,  541,  555,  556,  547,
-      558,  551,  559,  560,  565,  568,  575,  570,  567,  571,
-      579,  574,  577,  578,  582,  580,  594,  601,  592,  599,
-      602,  600,  605,  606,  607,  608,  584,  617,  610,  581,
-      622,  628,  612,  626,  631,  618,  614,  633,  635,  637,
-      644,  640,  647,  643,  648,  649,  650,  652,  661,  656,
-      659,  658,  660,  662,  664,  665,  668,  666,  674,  669,
-      678,  680,  688,  686,  685,  698,  690,  691,  695,  701,
-
-      693,  708,  702,  723,  712,  724,  713,  705,  694,  719,
-      732,  729,  735,  737,  738,  739,  740,  741,  742,  750,
-      745,  748,  755,  758,  762,  766,  746,  772,  747,  776,
-      770,  774,  781,  803,  778,  768,  780,  782,  785, 5674,
-      808,  786,  828,  792,  787,  815,  810,  812,  801,  817,
-      825,  818,  829,  813,  821,  835,  851,  836,  838,  846,
-      848,  852,  850,  860,  861,  853,  856,  864,  875,  867,
-      870,  871,  882,  874,  872,  877,  881,  883,  887,  896,
-      889,  897,  884,  898,  901,  904,  902,  908,  905,  909,
-      912,  926,  906,  923,  928,  925,  931,  933,  935,  936,
-
-      937,  938,  946,  943,  942,  944,  949,  953,  955,  959,
-      952,  945,  961,  966,  970,  967,  975,  977,  960,  983,
-     5674,  985,  968,  980,  978,  990,  991, 5674,  993,  992,
-      994, 1001,  996, 1004,  997, 1000, 1007, 1022,  999, 1006,
-     1023, 1020, 1021,  783, 1024, 1025, 1027, 1028, 1030, 1031,
-     1033, 1036, 1053, 1037, 1040, 1038, 1039, 1044, 1046, 1065,
-     1048, 1051, 1062, 1066, 1077, 1064, 1081, 1068, 1076, 1085,
-     1083, 1087, 1089, 1090, 1092, 1093, 1094, 1095, 1097, 1098,
-     1099, 1103, 5674, 1101, 1111, 1119, 1118, 1105, 1121, 1122,
-     1123, 1124, 1125, 1126, 1131, 1127, 1144, 1134, 1137, 1147,
-
-     1145, 1148, 1132, 1150, 1153, 1152, 1154, 1156, 1167, 1162,
-     1160, 1169, 1177, 1179, 1181, 1182, 1164, 1183, 1184, 1174,
-     1187, 1188, 1192, 1190, 1196, 1194, 1205, 1200, 1201, 1202,
-     1203, 1212, 1209, 1208, 1217, 1210, 1226, 1216, 1230, 1231,
-     1218, 1224, 1243, 1233, 1238, 1240, 1245, 1246, 1247, 1248,
-     1251, 1253, 1254, 1256, 1255, 1258, 1259, 1262, 1263, 1265,
-     1270, 1277, 1272, 1273, 1280, 1284, 1285, 1286, 1293, 1290,
-     1294, 1296, 1292, 1307, 1291, 1298, 1302, 1314, 1305, 1309,
-     1310, 1313, 1323, 1320, 1325, 1334, 1326, 1312, 1336, 1329,
-     1339, 1335, 1340, 1342, 1343, 1344, 1351, 1346, 1347, 1352,
-
-     1354, 1355, 1349, 1359, 1357, 1376, 1361, 1365, 1363, 1366,
-     1374, 1379, 1380, 1381, 1383, 1384, 1386, 1387, 1389, 1390,
-     1394, 1392, 1407, 1395, 1391, 1404, 1408, 1413, 1414, 1419,
-     1420, 1398, 1422, 1423, 1426, 1427, 1430, 1428, 1431, 1435,
-     1437, 1438, 1441, 1443, 1444, 1446, 1449, 1453, 1454, 5674,
-     1448, 1461, 1459, 1460, 1462, 1466, 1468, 1475, 1470, 1473,
-     1471, 1472, 1476, 1483, 5674, 1484, 5674, 5674, 1477, 5674,
-     5674, 1481, 1487, 1482, 1500, 1506, 1508, 1501, 1485, 1510,
-     1511, 1519, 1532, 1515, 1514, 1522, 1516, 1518, 1526, 1523,
-     1527, 1537, 1542, 1548, 1546, 1554, 1545, 1517, 1538, 1556,
-
-     1555, 1558, 1561, 1562, 1564, 1566, 1567, 1565, 1570, 1571,
-     1578, 1576, 1574, 1590, 5674, 1586, 1594, 1598, 1595, 1602,
-     1601, 1597, 1599, 1605, 1606, 1609, 1608, 1610, 1612, 1616,
-     1618, 1623, 1619, 5674, 1621, 1622, 1627, 1628, 1633, 1634,
-     1635, 1620, 1640, 1642, 1643, 1644, 1646, 1647, 5674, 1585,
-     1652, 1648, 1654, 1655, 1660, 1661, 1656, 1663, 1664, 1665,
-     1667, 1666, 1668, 1685, 1677, 1682, 1672, 1675, 1690, 1692,
-     1693, 1700, 1695, 1701, 1697, 1703, 1702, 1704, 1705, 1707,
-     1714, 1709, 1718, 1713, 1725, 1734, 1716, 1721, 1729, 1730,
-     1731, 1736, 1738, 1739, 1743, 1744, 1751, 1746, 1748, 1750,
-
-     1753, 1755, 1756, 1759, 1764, 1760, 1767, 1769, 1762, 5674,
-     1770, 1772, 5674, 1773, 1775, 1797, 1776, 1779, 1780, 1785,
-     1778, 1788, 1789, 1791, 1807, 1801, 1817, 1809, 1810, 1819,
-     1820, 1821, 1822, 1824, 1827, 1831, 1838, 1839, 1799, 1847,
-     1846, 1828, 1829, 1843, 1862, 1844, 1849, 1851, 1852, 1857,
-     1855, 1859, 1866, 1853, 1871, 1874, 1875, 5674, 1883, 1884,
-     1878, 1885, 1892, 1889, 1891, 1893, 1895, 1896, 1905, 1900,
-     1901, 1903, 1906, 1907, 1911, 1913, 1914, 1915, 1916, 1917,
-     1933, 5674, 1919, 5674, 1918, 1928, 1930, 1929, 1936, 1937,
-     1939, 1940, 1941, 1938, 1950, 1959, 1942, 5674, 1956, 1963,
-
-     1960, 1965, 1966, 1958, 1967, 1969, 1971, 1976, 1973, 1981,
-     1974, 1979, 1983, 1984, 1987, 1990, 1991, 1992, 5674, 1999,
-     1994, 2001, 2008, 1998, 2006, 2009, 2011, 2012, 2016, 2017,
-     2018, 2019, 2020, 2029, 2030, 2021, 2032, 2035, 2031, 5674,
-     2028, 2039, 2047, 2043, 2045, 2042, 2049, 2050, 2052, 2053,
-     2054, 2057, 2060, 2061, 2069, 2070, 2062, 2066, 2074, 2067,
-     2076, 2079, 2082, 2081, 2083, 2084, 2085, 5674, 2087, 2089,
-      124, 2093, 2094, 2096, 2095, 2102, 2098, 2101, 2118, 2119,
-     2115, 2114, 2117, 2123, 2124, 2125, 2126, 2127, 2128, 2129,
-     2131, 5674, 2105, 2133, 2134, 2136, 2139, 2140, 2143, 5674,
-
-     2153, 2156, 2142, 2155, 2163, 2158, 2164, 2165, 2167, 2172,
-     2168, 2171, 5674, 2175, 2178, 2180, 2181, 2182, 2184, 2189,
-     2191, 2192, 2193, 2196, 2194, 2195, 2199, 2197, 2200, 2204,
-     2213, 2203, 2205, 2210, 2214, 5674, 2226, 2215, 2224, 2217,
-     2228, 2227, 2241, 2231, 2234, 2236, 2242, 2251, 2244, 2238,
-     2252, 2253, 2258, 2262, 2261, 2267, 2268, 2265, 2269, 2275,
-     2277, 2278, 2279, 2283, 2281, 2284, 2285, 2286, 2293, 2294,
-     2291, 2302, 2300, 2307, 2305, 2310, 5674, 2311, 2312, 2295,
-     2317, 2325, 2322, 2323, 2329, 2330, 2331, 2332, 2333, 2334,
-     2335, 2338, 2336, 2337, 2342, 2349, 2347, 2353, 2357, 2358,
-
-     5674, 2359, 2361, 2363, 2364, 2370, 2365, 2372, 2374, 2376,
-     2377, 2378, 2380, 2383, 2384, 2386, 2388, 2391, 2390, 2389,
-     5674, 2394, 2395, 2396, 2404, 2405, 2411, 2412, 2414, 2418,
-     2402, 2419, 2421, 2422, 5674, 2430, 2432, 2429, 2433, 2431,
-     2436, 2437, 2439, 2441, 5674, 2442, 2443, 2450, 2451, 2446,
-     5674, 2453, 2449, 2454, 2456, 2457, 2458, 2459, 2464, 2465,
-     2467, 2470, 2473, 2477, 2478, 5674, 2479, 2487, 2488, 2480,
-     2491, 2482, 2492, 2493, 2497, 2501, 2495, 2510, 2512, 2513,
-     2514, 2494, 2517, 2518, 2519, 2521, 2522, 5674, 2515, 2525,
-     2527, 2530, 2528, 2534, 2536, 2544, 2539, 2540, 2546, 2541,
-
-     2547, 2548, 2549, 2550, 2553, 2561, 2563, 2564, 2566, 2568,
-     2569, 2570, 2577, 2582, 2583, 2585, 5674, 2588, 2589, 2591,
-     2578, 2580, 2592, 2595, 2597, 2599, 2601, 2603, 2604, 2605,
-     2612, 2616, 2613, 2620, 2617, 2622, 2614, 2625, 2626, 2627,
-     2628, 2635, 2632, 2631, 2640, 2639, 2638, 2648, 2643, 2649,
-     2650, 2651, 2652, 2653, 2656, 2654, 2660, 2661, 2665, 2667,
-     2675, 2676, 2677, 2678, 2681, 5674, 2680, 2682, 2684, 2690,
-     2693, 2694, 2696, 2698, 2703, 2688, 2695, 2705, 2715, 2711,
-     5674, 2712, 5674, 2714, 2716, 2717, 2726, 2719, 5674, 2723,
-     5674, 2724, 2729, 2731, 2732, 5674, 2733, 2734, 2737, 2740,
-
-     2738, 2742, 2743, 2744, 2745, 2750, 2752, 2756, 2755, 2757,
-     2760, 2761, 2764, 2766, 2768, 2772, 2765, 2777, 2773, 2775,
-     2783, 2782, 2784, 5674, 2791, 2788, 2793, 2792, 2794, 2796,
-     2797, 2799, 2800, 2802, 2805, 2810, 2803, 2816, 2819, 2831,
-     2809, 2832, 5674, 2813, 2834, 2817, 2835, 5674, 2837, 2828,
-     2838, 2843, 2840, 2830, 2845, 2846, 2850, 2847, 2853, 2858,
-     2862, 2863, 2857, 2865, 2855, 2869, 2877, 2874, 2881, 2883,
-     2891, 2887, 2875, 2878, 2867, 2889, 2890, 2900, 2901, 2897,
-     2904, 2899, 2903, 2906, 2907, 2910, 2911, 2913, 2915, 2916,
-     2914, 2919, 2923, 2918, 2920, 2921, 2924, 5674, 2937, 2927,
-
-     2934, 2941, 2943, 2946, 2925, 2944, 2948, 2950, 2952, 2954,
-     2951, 5674, 2953, 5674, 2955, 2961, 2970, 2972, 2974, 2975,
-     2976, 2978, 2981, 2982, 2983, 2984, 2985, 2987, 2990, 2991,
-     2996, 2997, 2998, 3012, 2995, 3000, 3002, 3007, 3009, 3014,
-     5674, 3016, 3017, 3018, 3022, 3023, 3024, 3027, 3031, 3030,
-     3033, 3034, 3045, 5674, 3036, 3053, 3037, 3057, 3064, 3046,
-     3065, 3060, 5674, 3049, 3061, 3068, 3063, 3070, 3077, 5674,
-     3072, 5674, 3067, 3074, 3081, 3078, 3082, 3083, 3084, 3085,
-     3091, 3094, 3103, 3092, 3100, 3101, 3102, 3104, 3113, 3106,
-     3108, 3109, 5674, 3111, 3114, 3118, 3125, 3126, 3132, 3129,
-
-     3116, 5674, 3133, 3136, 3123, 3140, 3141, 3144, 3145, 3146,
-     3149, 3150, 3147, 3151, 3163, 3155, 3154, 3158, 3169, 3170,
-     3175, 5674, 3176, 3156, 3183, 3179, 3180, 3182, 3185, 3186,
-     3187, 3189, 3190, 3191, 3193, 3198, 3197, 3194, 3195, 3200,
-     3201, 3214, 3211, 3203, 3215, 3219, 3218, 3221, 3225, 3226,
-     3229, 3231, 3222, 3233, 3236, 3240, 3243, 3245, 3246, 3253,
-     3248, 5674, 3255, 3252, 3260, 3256, 3259, 3258, 3265, 3269,
-     3271, 3267, 3268, 3278, 3273, 5674, 3280, 3275, 3292, 3286,
-     3276, 3301, 3296, 3282, 3277, 3300, 3303, 3306, 3304, 3308,
-     3309, 3312, 3313, 5674, 5674, 3315, 3316, 3317, 5674, 3318,
-
-     3319, 3328, 3321, 3323, 3331, 3325, 3334, 3335, 3336, 3338,
-     3339, 5674, 3342, 3351, 3348, 3349, 3358, 3359, 3363, 3360,
-     3357, 3350, 3354, 3367, 3369, 3371, 3374, 3375, 3383, 3378,
-     3380, 3381, 5674, 3382, 3384, 3390, 5674, 3387, 3388, 3391,
-     3399, 3394, 3407, 3404, 3410, 3396, 3412, 3413, 3414, 3416,
-     3418, 3427, 3422, 3423, 3425, 3429, 3431, 5674, 3433, 3434,
-     3439, 3441, 3444, 3452, 3453, 3454, 3449, 3455, 3456, 3463,
-     5674, 3458, 3461, 3462, 3464, 3472, 3469, 3473, 3471, 5674,
-     3476, 3477, 3479, 5674, 3478, 3485, 3493, 3495, 3480, 3503,
-     3498, 3482, 3499, 3501, 5674, 3502, 5674, 3506, 3508, 3511,
-
-     5674, 3513, 3514, 3516, 3518, 3515, 3522, 3523, 3530, 3519,
-     3531, 3532, 3533, 3534, 3536, 3543, 3535, 5674, 3544, 3542,
-     3546, 3547, 3553, 3551, 3554, 3559, 3557, 5674, 5674, 3566,
-     5674, 3558, 3567, 3568, 5674, 3571, 3573, 3578, 3574, 3576,
-     3579, 3589, 3582, 5674, 3585, 3580, 3593, 3595, 3596, 3597,
-     3598, 3599, 3601, 3603, 3602, 5674, 3605, 3607, 3613, 3606,
-     3614, 3620, 3626, 3615, 5674, 3628, 3630, 3622, 3636, 3637,
-     5674, 3629, 5674, 3639, 3642, 3643, 3645, 3646, 5674, 3648,
-     3649, 3653, 3654, 3656, 3658, 3659, 3662, 3666, 3668, 3675,
-     3671, 3670, 3673, 5674, 3672, 3678, 3686, 3689, 3679, 3677,
-
-     3693, 3695, 3696, 3699, 3702, 3704, 3705, 3708, 3703, 3710,
-     3711, 3714, 3724, 3717, 3720, 5674, 3721, 3725, 3729, 5674,
-     3727, 3728, 3736, 3738, 3731, 3739, 3742, 3741, 3744, 5674,
-     3750, 3751, 3746, 3747, 3756, 3760, 5674, 5674, 3764, 5674,
-     3765, 3753, 3767, 3754, 3743, 3775, 3774, 3777, 3779, 3780,
-     3781, 3787, 3788, 3795, 3796, 3797, 3800, 3674, 3793, 5674,
-     5674, 3805, 3806, 3802, 3809, 3814, 3798, 3812, 3822, 3818,
-     3819, 3825, 3826, 3833, 5674, 3834, 3817, 3835, 5674, 3828,
-     3836, 3829, 3840, 3842, 3843, 3844, 3846, 3850, 3848, 3851,
-     3849, 3857, 3858, 3859, 3865, 3862, 3867, 5674, 3868, 3870,
-
-     3871, 3872, 3873, 3874, 3879, 3882, 3881, 5674, 3883, 3885,
-     3888, 3886, 3887, 3892, 3903, 3907, 3909, 3896, 3910, 3912,
-     3915, 3917, 3914, 5674, 3920, 3918, 3921, 3922, 3929, 3931,
-     3926, 3933, 3935, 3937, 3939, 3942, 3944, 3949, 3946, 3950,
-     3951, 3952, 5674, 3956, 3958, 3955, 3963, 3964, 3966, 3967,
-     3968, 3976, 3973, 3978, 3977, 3980, 5674, 3981, 3983, 3985,
-     3986, 3988, 3989, 3994, 3995, 5674, 3998, 3991, 4005, 3999,
-     4002, 4003, 4007, 4015, 4014, 5674, 4018, 4019, 4020, 4021,
-     4022, 4023, 4026, 4027, 5674, 4032, 4033, 4036, 4045, 4029,
-     4047, 4043, 4049, 4040, 4042, 4056, 4052, 4057, 4058, 4060,
-
-     4062, 4070, 4074, 4071, 5674, 4063, 5674, 4072, 4077, 4079,
-     4084, 4080, 5674, 4082, 4087, 4089, 4086, 4090, 5674, 4092,
-     4091, 4094, 4096, 5674, 4110, 4106, 4095, 4105, 4119, 4120,
-     5674, 4123, 4124, 4125, 4132, 4134, 4136, 4129, 4137, 4133,
-     4139, 4097, 4140, 5674, 4142, 4144, 4149, 4150, 4151, 4152,
-     4154, 4157, 4161, 5674, 4159, 4162, 4163, 4165, 4166, 4167,
-     4168, 4175, 4171, 4176, 5674, 4180, 4181, 4184, 4185, 4112,
-     5674, 5674, 4188, 4189, 4192, 4191, 4197, 5674, 4199, 4206,
-     4201, 4205, 4207, 5674, 5674, 4209, 5674, 4210, 5674, 4211,
-     4214, 5674, 5674, 4215, 4212, 4218, 4219, 4222, 5674, 4227,
-
-     5674, 4235, 4231, 4233, 4234, 4236, 5674, 4239, 4240, 4243,
-     5674, 4237, 4250, 4245, 4247, 5674, 4254, 4248, 4251, 5674,
-     4259, 4265, 4261, 4268, 4255, 4270, 4271, 4272, 4274, 4276,
-     4278, 4281, 4283, 4286, 4287, 4288, 4289, 4294, 4291, 4296,
-     4297, 4299, 4301, 4302, 4307, 4310, 4311, 4304, 4312, 4313,
-     4314, 4318, 4320, 4324, 4327, 4328, 4329, 4330, 4332, 4333,
-     4335, 4338, 4342, 4331, 4341, 5674, 4336, 4343, 4347, 4358,
-     4348, 4359, 4363, 4353, 4367, 4371, 5674, 4373, 5674, 4375,
-     4360, 4369, 4377, 5674, 4379, 4382, 4381, 4384, 4383, 4385,
-     4388, 4386, 5674, 4390, 4391, 4393, 4395, 5674, 4398, 4409,
-
-     4397, 4401, 4410, 4411, 4412, 4414, 4418, 4416, 4421, 4423,
-     4431, 4424, 4428, 4427, 4433, 4429, 4436, 4439, 4445, 4441,
-     4448, 4452, 5674, 4453, 5674, 4454, 4455, 4457, 4458, 4459,
-     4460, 4462, 5674, 5674, 4465, 4467, 4476, 4468, 4461, 4487,
-     4473, 5674, 4482, 4484, 4490, 4491, 5674, 4492, 4493, 4495,
-     5674, 4496, 4499, 4500, 4502, 4466, 4503, 4506, 5674, 5674,
-     5674, 5674, 4509, 4507, 4517, 4511, 4514, 4521, 4522, 4526,
-     4518, 5674, 4535, 5674, 5674, 4523, 4532, 4536, 4538, 4539,
-     4540, 4542, 4541, 5674, 4545, 4548, 4552, 4546, 4555, 4563,
-     4558, 4564, 4556, 4566, 4573, 4570, 4571, 4568, 4576, 4578,
-
-     4580, 5674, 5674, 4582, 4586, 4587, 4594, 4591, 4592, 4604,
-     4599, 4600, 4601, 4602, 4606, 4607, 4608, 5674, 4611, 4615,
-     5674, 4609, 5674, 4619, 4622, 4613, 4623, 4625, 4626, 4628,
-     4630, 5674, 5674, 4632, 4633, 4637, 4641, 4638, 4643, 4644,
-     4646, 4642, 5674, 4647, 5674, 4648, 4650, 4664, 4649, 4666,
-     4671, 4673, 4670, 4672, 4676, 5674, 4675, 4677, 5674, 4678,
-     4679, 4683, 5674, 4685, 4688, 4692, 5674, 4695, 5674, 4697,
-     5674, 4689, 4705, 5674, 4700, 4701, 5674, 4707, 4711, 4655,
-     4703, 5674, 4708, 5674, 4712, 4714, 4717, 4722, 4715, 4724,
-     4725, 4719, 4727, 4734, 4736, 4729, 5674, 5674, 4745, 4731,
-
-     4740, 4742, 4743, 4752, 4747, 4751, 4757, 5674, 5674, 4748,
-     5674, 4750, 4761, 5674, 4759, 4763, 4765, 4768, 4767, 4769,
-     4774, 4771, 4775, 4778, 4793, 4776, 4780, 4790, 4796, 4798,
-     4800, 4802, 4803, 4804, 4781, 4805, 4806, 4809, 5674, 4811,
-     4812, 4813, 5674, 4817, 4820, 4822, 4823, 5674, 4833, 4825,
-     4830, 4835, 5674, 4819, 4841, 4838, 4836, 4843, 4852, 4847,
-     4848, 5674, 5674, 5674, 5674, 4850, 4853, 5674, 4854, 4855,
-     5674, 5674, 4856, 4859, 4862, 4870, 5674, 4861, 5674, 4865,
-     5674, 4869, 4872, 4875, 4878, 5674, 4879, 4888, 5674, 4891,
-     4894, 4896, 4897, 4880, 4866, 4898, 5674, 4905, 4902, 4904,
-
-     4911, 4883, 4908, 4912, 4913, 4920, 4915, 4919, 5674, 4916,
-     4921, 4922, 5674, 4924, 5674, 4925, 4926, 4928, 4934, 4930,
-     4933, 4937, 4944, 4927, 4948, 4941, 5674, 4951, 4955, 5674,
-     4956, 5674, 4958, 5674, 4959, 4962, 4963, 4961, 5674, 4965,
-     4967, 4968, 4969, 5674, 4970, 4972, 5674, 4976, 4973, 4983,
-     4985, 4974, 4990, 4992, 4993, 4980, 5004, 4996, 4999, 4997,
-     5006, 5007, 5012, 5674, 5674, 5674, 5008, 5001, 5022, 5019,
-     5023, 5030, 5014, 5674, 5028, 5029, 5025, 5037, 5035, 5039,
-     5674, 5041, 5027, 5036, 5674, 5043, 5048, 5049, 5050, 5051,
-     5058, 5060, 5062, 5063, 5674, 5066, 5674, 5674, 5055, 5674,
-
-     5067, 5069, 5070, 5071, 5674, 5076, 5073, 5077, 5079, 5081,
-     5082, 5078, 5674, 5674, 5085, 5674, 5094, 5090, 5086, 5102,
-     5098, 5099, 5104, 5106, 5674, 5105, 5108, 5109, 5112, 5113,
-     5674, 5115, 5116, 5117, 5118, 5121, 5120, 5126, 5127, 5129,
-     5674, 5674, 5122, 5132, 5674, 5674, 5131, 5141, 5146, 5674,
-     5674, 5674, 5152, 5674, 5154, 5158, 5162, 5166, 5157, 5674,
-     5168, 5147, 5169, 5674, 5170, 5172, 5674, 5674, 5149, 5173,
-     5177, 5176, 5178, 5674, 5179, 5182, 5186, 5189, 5195, 5184,
-     5196, 5198, 5206, 5208, 5190, 5203, 5192, 5204, 5211, 5212,
-     5220, 5217, 5674, 5674, 5224, 5674, 5674, 5226, 5228, 5230,
-
-     5233, 5235, 5237, 5239, 5674, 5240, 5242, 5243, 5674, 5245,
-     5247, 5244, 5248, 5250, 5251, 5253, 5255, 5674, 5674, 5256,
-     5257, 5258, 5265, 5267, 5674, 5269, 5276, 5273, 5275, 5271,
-     5277, 5278, 5674, 5281, 5674, 5674, 5674, 5674, 5674, 5674,
-     5674, 5674, 5279, 5674, 5289, 5292, 5674, 5283, 5293, 5297,
-     5298, 5286, 5674, 5299, 5303, 5304, 5305, 5308, 5310, 5312,
-     5313, 5315, 5319, 5316, 5321, 5317, 5320, 5674, 5674, 5328,
-     5324, 5327, 5330, 5346, 5347, 5350, 5352, 5334, 5337, 5355,
-     5354, 5356, 5343, 5360, 5369, 5362, 5364, 5366, 5367, 5371,
-     5674, 5372, 5674, 5373, 5674, 5674, 5378, 5379, 5374, 5381,
-
-     5389, 5394, 5385, 5390, 5392, 5396, 5674, 5393, 5674, 5398,
-     5397, 5674, 5402, 5404, 5405, 5406, 5407, 5408, 5410, 5416,
-     5674, 5414, 5417, 5426, 5418, 5434, 5429, 5433, 5435, 5437,
-     5431, 5445, 5441, 5444, 5674, 5447, 5448, 5214, 5449, 5452,
-     5459, 5454, 5456, 5457, 5674, 5461, 5463, 5465, 5455, 5462,
-     5464, 5478, 5480, 5476, 5674, 5466, 5482, 5484, 5486, 5490,
-     5488, 5494, 5495, 5497, 5499, 5329, 5506, 5500, 5502, 5498,
-     5508, 5510, 5674, 5512, 5515, 5674, 5516, 5518, 5519, 5520,
-     5524, 5674, 5527, 5522, 5528, 5530, 5533, 5535, 5674, 5537,
-     5544, 5545, 5674, 5546, 5674, 5674, 5548, 5540, 5549, 5555,
-
-     5557, 5674, 5674, 5674, 5582, 5589, 5596, 5603, 5610,   88,
-     5617, 5624, 5631, 5638, 5645, 5652, 5659, 5666
+        1,    1,   42,   42,   83,   83,  124,  124,  165,  165,
+      206,  206,  247,  288,  329, 4349, 4349, 4349,  336,  377,
+      401,  315,  406,  411,  405,  409,  410,  423,  303,  314,
+      305,  427,  430,  385,  429,  398,  440,  448,  447,  456,
+      471,  402,  418,  495, 4349, 4349, 4349,  536,  577, 4349,
+     4349, 4349,  618,  659,  476, 4349, 4349, 4349,  700,  741,
+     4349, 4349, 4349,  782,  823, 4349,  864, 4349,  905,  426,
+      454,  454,  454,  946,  457,  457,  987,  457,  440,  448,
+      454,  454,  449,  468, 1011,  459,  469,  465, 1009,  998,
+      996, 1000, 1026, 1008, 1004, 1014, 1010, 1011, 1026, 1027,
+
+     1027, 1020, 1032, 1042, 1018, 1035, 1039, 1024, 1022, 1030,
+     1041, 1040, 1036, 1043, 1048, 1041, 1035, 1038, 1053, 1040,
+     1054, 1044, 1064, 1046, 1063, 1053, 1051, 1069, 1058, 1066,
+     1080, 1063, 1076, 1064, 1061, 1064, 1062, 1083, 1069, 1084,
+     1076, 1084, 1078, 1073, 1087, 1075, 1082, 1110, 1110, 1110,
+     1110, 1110, 1110, 1110, 1110, 1110, 1110, 1110, 1110, 1110,
+     1110, 1110, 1110, 1122, 1112, 1095, 1112, 1094, 1155, 1082,
+     1086, 1142, 1140, 1144, 1083, 1088, 1100, 1086, 1145, 1159,
+     1138, 1150, 1157, 1165, 1169, 1164, 1160, 1150, 1165, 1166,
+     1162, 1155, 1182, 1173, 1172, 1175, 1167, 1167, 1171, 1169,
+
+     1183, 1185, 1190, 1187, 1173, 1178, 1201, 1196, 1205, 1204,
+     1180, 1207, 1194, 1209, 1210, 1212, 1202, 1215, 1209, 1219,
+     1207, 1203, 1209, 1197, 1214, 1216, 1214, 1210, 1219, 1217,
+     1210, 1214, 1214, 1212, 1228, 1216, 1231, 1214, 1243, 1245,
+     1222, 1248, 1223, 1239, 1243, 1226, 1240, 1254, 1255, 1247,
+     1232, 1258, 1241, 1240, 1254, 1257, 1263, 1264, 1257, 1255,
+     1250, 1257, 1276, 1251, 1246, 1258, 1247, 1264, 1247, 1277,
+     1278, 1268, 1269, 1281, 1264, 1266, 1264, 1269, 1276, 1264,
+     1292, 1284, 1286, 1289, 1294, 1274, 1292, 1293, 1279, 1281,
+     1295, 1295, 1291, 1307, 1288, 1309, 1302, 1311, 1302, 1306,
+
+     1303, 1304, 1316, 1291, 1294, 1319, 1320, 1314, 1313, 1299,
+     1314, 1301, 1319, 1303, 1319, 1312, 1331, 1323, 1315, 1319,
+     1320, 1312, 1327, 1338, 1340, 1332, 1329, 1332, 1343, 1348,
+     1345, 1353, 1333, 1336, 1343, 1345, 1356, 1352, 1359, 1346,
+     1357, 1351, 1356, 1360, 1346, 1352, 1374, 1349, 1365, 1377,
+     1367, 1368, 1371, 1373, 1363, 1377, 1372, 1381, 1389, 1391,
+     1379, 1388, 1387, 1381, 1367, 1368, 1377, 1379, 1381, 4349,
+     1397, 1388, 1409, 1389, 1396, 1419, 1413, 1413, 1394, 1398,
+     1405, 1413, 1407, 1433, 1417, 1410, 1417, 1438, 1428, 1414,
+     1415, 1421, 1432, 1423, 1445, 1439, 1421, 1432, 1431, 1452,
+
+     1438, 1439, 1444, 1455, 1430, 1438, 1440, 1443, 1456, 1457,
+     1455, 1463, 1446, 1451, 1451, 1474, 1455, 1476, 1462, 1463,
+     1468, 1471, 1468, 1484, 1458, 1474, 1477, 1478, 1465, 1485,
+     1474, 1483, 1476, 1489, 1497, 1489, 1480, 1475, 1492, 1493,
+     1498, 1488, 1481, 1484, 1491, 1501, 1501, 1503, 1496, 1510,
+     1507, 1492, 1513, 4349, 1514, 1522, 1496, 1513, 1510, 1500,
+     1510, 4349, 1505, 1504, 1512, 1533, 1519, 1535, 1511, 1526,
+     1518, 1525, 1540, 1515, 1534, 1544, 1525, 1535, 1540, 1527,
+     1522, 1540, 1540, 1531, 1542, 1539, 1531, 1538, 1551, 1559,
+     1534, 1541, 1554, 1541, 1545, 1559, 1559, 1551, 1564, 1556,
+
+     1564, 1580, 1581, 1560, 1575, 1574, 1560, 1580, 1562, 1582,
+     1569, 1573, 1573, 1570, 1568, 1587, 1584, 1575, 1580, 1595,
+     4349, 1579, 1590, 1596, 1608, 1591, 1589, 1586, 1592, 1592,
+     1594, 1605, 1597, 1617, 1605, 1615, 1621, 1604, 1623, 1606,
+     1618, 1608, 1608, 1620, 1623, 1618, 1612, 1636, 1616, 1632,
+     1633, 1639, 1637, 1639, 1645, 1646, 1638, 1637, 1624, 1636,
+     1642, 1641, 1624, 1629, 1645, 1656, 1649, 1648, 1635, 1649,
+     1635, 1662, 1652, 1644, 1656, 1642, 1660, 1644, 1658, 1661,
+     1655, 1655, 1677, 1663, 1670, 1670, 1671, 1674, 1673, 1663,
+     1662, 1674, 1669, 1678, 1664, 1686, 1677, 1668, 1672, 1677,
+
+     1689, 1682, 1680, 1700, 1692, 1694, 1696, 1692, 1696, 1684,
+     1689, 1710, 1700, 1712, 1704, 1703, 1715, 1697, 1698, 1693,
+     1707, 1722, 1698, 1709, 1714, 1717, 1727, 1710, 1718, 1730,
+     1724, 1722, 1724, 1726, 1711, 1730, 1715, 1716, 1718, 1718,
+     1718, 1745, 1736, 1733, 1728, 1729, 1727, 1727, 1736, 1734,
+     1741, 1757, 1738, 1741, 1735, 1736, 1752, 1739, 1742, 1741,
+     1742, 1743, 1749, 1745, 1764, 1762, 1748, 1774, 1755, 1765,
+     1755, 1753, 1760, 1768, 1769, 1751, 1770, 1773, 1774, 1762,
+     1774, 1773, 1769, 1775, 1767, 1776, 1784, 1787, 1787, 1778,
+     1784, 1779, 1781, 1791, 1803, 1797, 1800, 1791, 4349, 1782,
+
+     1809, 1784, 1801, 1795, 1783, 1791, 1816, 1817, 1806, 1796,
+     1790, 1796, 1812, 4349, 1803, 4349, 4349, 1810, 4349, 4349,
+     1810, 1814, 1810, 1824, 1828, 1829, 1821, 1815, 1821, 1816,
+     1843, 1837, 1819, 1837, 1838, 1824, 1828, 1822, 1845, 1851,
+     1844, 1851, 1838, 1853, 1852, 1855, 1854, 1858, 1849, 1843,
+     1859, 1844, 1847, 1859, 1867, 1854, 1856, 1870, 1854, 1861,
+     1865, 1881, 1871, 1878, 1884, 4349, 1874, 1886, 1887, 1881,
+     1875, 1880, 1892, 1885, 1883, 1882, 1883, 1891, 1875, 1889,
+     1888, 1877, 1898, 1889, 1891, 1906, 1882, 4349, 1893, 1894,
+     1899, 1896, 1912, 1904, 1903, 1895, 1885, 1910, 1897, 1894,
+
+     1905, 1894, 1913, 4349, 1915, 1920, 1912, 1914, 1917, 1902,
+     1905, 1906, 1905, 1908, 1920, 1918, 1927, 1914, 1914, 1940,
+     1927, 1925, 1919, 1925, 1926, 1936, 1929, 1939, 1946, 1926,
+     1938, 1928, 1941, 1930, 1929, 1933, 1933, 1960, 1954, 1942,
+     1963, 1938, 1965, 1966, 1957, 1943, 1951, 1959, 1944, 1966,
+     1960, 1975, 1967, 1954, 1964, 1980, 1955, 1979, 1961, 1975,
+     1976, 1983, 1968, 1980, 1984, 1964, 1967, 1983, 1970, 4349,
+     1988, 1977, 4349, 1972, 1972, 1992, 1993, 1992, 1983, 2000,
+     1980, 1998, 1989, 1992, 2002, 1995, 2016, 1997, 2010, 2001,
+     2012, 2013, 2005, 1999, 2007, 2023, 2029, 2030, 2026, 2031,
+
+     2034, 2008, 2012, 2014, 2032, 2033, 2030, 2022, 2025, 2040,
+     2037, 2039, 2040, 2030, 2035, 2031, 2034, 2055, 2051, 4349,
+     2062, 2054, 2040, 2066, 2067, 2057, 2044, 2059, 2056, 2051,
+     2075, 2061, 2052, 2068, 2054, 2061, 2056, 2065, 2069, 2071,
+     2075, 2081, 2089, 4349, 2068, 4349, 2071, 2066, 2068, 2069,
+     2071, 2076, 2073, 2077, 2088, 2089, 2090, 2077, 2088, 2098,
+     2106, 2088, 4349, 2086, 2109, 2103, 2102, 2092, 2089, 2092,
+     2098, 2096, 2098, 2120, 2095, 2122, 2114, 2117, 2114, 2115,
+     2105, 2117, 2118, 2112, 4349, 2120, 2120, 2111, 2122, 2135,
+     2131, 2122, 2114, 2130, 2133, 2117, 2117, 2117, 2136, 2127,
+
+     2147, 2148, 2138, 2125, 2140, 2141, 2153, 4349, 2130, 2129,
+     2157, 2147, 2154, 2145, 2146, 2138, 2154, 2145, 2144, 2157,
+     2150, 2144, 2151, 2145, 2172, 2173, 2153, 2164, 2171, 2152,
+     2158, 2153, 2162, 2179, 2158, 2168, 2159, 2163, 4349, 2161,
+     2180, 2183, 2196, 2169, 2169, 2173, 2181, 2178, 2190, 2170,
+     2197, 2198, 2189, 2193, 2191, 2183, 2184, 2195, 2186, 2183,
+     2200, 2189, 2186, 4349, 2207, 2194, 2191, 2195, 2217, 2192,
+     2208, 4349, 2213, 2210, 2209, 2203, 2215, 2201, 2211, 2216,
+     2206, 2221, 2217, 2210, 4349, 2231, 2226, 2227, 2213, 2229,
+     2231, 2227, 2222, 2223, 2220, 2228, 2226, 2235, 2231, 2225,
+
+     2225, 2229, 2242, 2235, 2244, 2249, 2233, 2234, 2246, 4349,
+     2262, 2243, 2250, 2239, 2255, 2249, 2268, 2244, 2250, 2272,
+     2267, 2264, 2257, 2262, 2280, 2274, 2271, 2269, 2285, 2275,
+     2276, 2281, 2263, 2285, 2285, 2269, 2273, 2283, 2274, 2300,
+     2275, 2291, 2283, 2280, 2305, 2306, 2293, 2297, 2299, 2295,
+     2304, 2309, 2301, 4349, 2304, 2295, 2298, 2308, 2324, 2304,
+     2315, 2306, 2308, 2315, 2306, 2308, 2320, 2315, 2325, 2317,
+     2323, 2315, 2314, 2330, 2342, 2343, 2323, 2341, 2339, 4349,
+     2340, 2339, 2327, 2338, 2349, 2329, 2351, 2350, 2347, 2332,
+     2333, 2356, 2351, 2337, 2355, 2340, 2356, 2353, 2361, 2346,
+
+     4349, 2362, 2351, 2362, 2363, 2353, 2376, 2363, 2368, 2369,
+     2374, 2371, 2359, 2372, 2374, 2378, 4349, 2389, 2390, 2370,
+     2381, 2393, 2379, 2370, 2381, 2394, 2374, 2390, 4349, 2376,
+     2374, 2404, 2406, 2395, 4349, 2409, 2390, 2385, 2394, 2398,
+     2390, 2408, 2391, 2419, 2396, 2410, 2417, 2394, 2413, 4349,
+     2400, 2426, 2403, 2413, 2415, 2410, 2411, 2412, 2423, 2427,
+     2418, 2439, 2430, 2424, 2417, 2432, 2420, 2434, 2422, 2436,
+     2422, 4349, 2429, 2427, 2428, 2446, 2444, 2431, 2432, 2458,
+     2441, 2435, 2441, 2441, 2442, 2440, 2455, 2454, 2457, 2445,
+     2459, 2460, 2457, 2466, 2453, 2464, 2451, 2468, 2480, 2481,
+
+     2475, 2476, 4349, 2479, 2475, 2471, 2463, 2468, 2468, 2477,
+     2484, 2466, 2479, 2483, 2475, 2471, 2497, 2498, 2473, 2493,
+     2476, 2479, 2490, 2495, 2482, 2482, 2485, 2510, 2500, 2480,
+     2513, 2489, 2515, 2491, 2505, 2518, 2494, 2495, 2521, 2497,
+     2498, 2504, 2498, 2505, 2520, 2519, 2511, 2525, 2520, 2522,
+     2514, 2519, 2516, 2530, 4349, 2529, 2520, 2532, 2518, 2523,
+     2541, 2536, 2537, 2539, 2540, 2525, 2528, 2527, 2556, 2552,
+     2533, 4349, 2535, 4349, 2533, 2550, 2555, 2563, 2538, 4349,
+     2560, 4349, 2557, 2562, 2546, 2547, 4349, 2561, 2562, 2546,
+     2558, 2567, 2554, 2549, 2552, 2567, 2559, 2573, 2557, 2564,
+
+     2583, 2563, 2585, 2579, 2567, 2564, 2578, 2569, 2586, 2582,
+     2567, 2587, 2595, 2575, 2590, 2588, 2574, 2589, 4349, 2596,
+     2587, 2580, 2585, 2583, 2586, 2579, 2604, 2601, 2587, 2588,
+     2600, 2606, 2592, 2611, 2609, 2622, 2597, 2624, 4349, 2605,
+     2621, 2602, 2616, 4349, 2618, 2619, 2624, 2625, 2613, 2610,
+     2614, 2627, 2630, 2620, 2613, 2632, 2642, 2632, 2630, 2635,
+     2616, 2639, 2650, 2640, 2645, 2646, 2654, 2644, 2638, 2634,
+     2635, 2635, 2653, 2663, 2664, 2654, 2666, 2641, 2657, 2664,
+     2660, 2648, 2647, 2648, 2655, 2650, 2657, 2658, 2661, 2661,
+     2681, 2656, 2657, 2664, 2659, 4349, 2682, 2662, 2678, 2683,
+
+     2670, 2672, 2663, 2670, 2680, 2675, 2692, 2683, 2687, 4349,
+     2681, 4349, 2669, 2694, 2699, 2701, 2690, 2686, 2702, 2707,
+     2694, 2689, 2704, 2705, 2699, 2704, 2695, 2699, 2707, 2698,
+     2709, 2710, 2717, 2729, 2725, 2705, 2713, 2709, 2714, 2713,
+     2718, 4349, 2706, 2714, 2732, 2718, 2727, 2732, 2737, 2730,
+     2722, 2720, 2722, 2726, 2751, 4349, 2732, 2753, 2730, 2750,
+     2757, 2748, 2760, 2749, 4349, 2747, 2737, 2744, 2766, 2748,
+     2759, 2769, 4349, 2756, 4349, 2746, 2747, 2746, 2761, 2762,
+     2759, 2760, 2760, 2761, 2777, 2783, 2784, 2766, 2760, 2776,
+     2762, 2765, 2765, 2772, 2792, 2768, 2772, 2771, 4349, 2792,
+
+     2772, 2790, 2773, 2790, 2791, 2792, 2791, 2783, 4349, 2788,
+     2788, 2806, 2788, 2796, 2790, 2811, 2797, 2808, 2800, 2804,
+     2798, 2798, 2825, 2808, 2803, 2816, 2824, 2821, 2826, 4349,
+     2821, 2818, 2834, 2830, 2818, 2829, 2829, 2813, 2812, 2817,
+     2818, 2832, 2829, 2828, 2826, 2837, 2834, 2824, 2830, 2847,
+     2853, 2849, 2831, 2835, 2832, 2851, 2841, 2853, 2859, 2860,
+     2840, 2862, 2861, 2842, 2843, 2866, 2862, 2873, 2865, 4349,
+     2875, 2853, 2878, 2875, 2855, 2862, 2874, 2879, 2878, 2886,
+     2870, 2861, 2865, 2892, 2870, 4349, 2897, 2878, 2891, 2900,
+     2880, 2904, 2890, 2880, 2880, 2903, 2898, 2903, 2885, 2884,
+
+     2906, 2909, 2889, 4349, 4349, 2911, 2887, 2904, 4349, 2905,
+     2894, 2922, 2918, 2909, 2914, 2919, 2900, 2907, 2924, 2916,
+     2900, 2926, 2902, 2928, 2929, 2918, 4349, 2928, 2941, 2916,
+     2930, 2944, 2945, 2941, 2936, 2933, 2923, 2950, 2942, 2943,
+     2929, 2922, 2948, 2956, 2931, 2940, 2938, 2951, 4349, 2936,
+     2938, 2943, 4349, 2940, 2966, 2955, 2953, 2937, 2963, 2966,
+     2962, 2956, 2969, 2952, 2960, 2957, 2972, 2958, 2959, 2962,
+     2988, 2968, 2979, 2986, 2985, 2983, 4349, 2979, 2978, 2970,
+     2992, 2993, 2999, 2994, 3002, 3003, 3004, 2973, 2995, 2991,
+     3010, 4349, 2993, 3002, 2999, 2996, 3015, 3016, 3004, 3018,
+
+     3020, 3001, 4349, 3003, 2997, 3012, 4349, 3015, 3018, 3021,
+     3022, 3002, 3029, 3018, 3020, 3022, 3020, 4349, 3025, 4349,
+     3028, 3020, 3032, 4349, 3022, 3023, 3031, 3038, 3029, 3034,
+     3036, 3043, 3023, 3035, 3027, 3027, 3043, 3043, 3055, 3036,
+     4349, 3050, 3034, 3044, 3053, 3046, 3045, 3054, 3054, 3047,
+     4349, 4349, 3062, 4349, 3060, 3065, 3049, 4349, 3058, 3054,
+     3075, 3076, 3070, 3072, 4349, 3063, 3077, 3070, 4349, 3072,
+     3060, 3081, 3074, 3063, 3065, 3074, 3075, 3076, 3077, 3075,
+     3085, 4349, 3072, 3082, 3096, 3078, 3077, 3095, 3094, 3080,
+     4349, 3096, 3100, 3087, 3101, 3100, 4349, 3099, 4349, 3091,
+
+     3101, 3099, 3110, 3094, 4349, 3101, 3106, 3098, 3115, 3104,
+     3120, 3094, 3116, 3120, 3118, 3121, 3105, 3121, 3109, 3108,
+     3135, 3125, 3118, 3124, 4349, 3114, 3120, 3136, 3135, 3122,
+     3118, 3145, 3135, 3139, 3134, 3144, 3143, 3133, 3145, 3146,
+     3139, 3140, 3149, 3132, 3160, 3146, 3144, 3152, 3156, 4349,
+     3148, 3156, 3157, 4349, 3150, 3144, 3156, 3167, 3149, 3150,
+     3164, 3165, 3157, 3157, 4349, 3161, 3162, 3155, 3171, 3172,
+     3169, 4349, 4349, 3161, 3162, 3176, 4349, 3177, 3166, 3170,
+     3169, 3189, 3181, 3192, 3183, 3175, 3195, 3177, 3193, 3194,
+     3187, 3202, 3208, 3209, 3210, 3202, 3198, 3188, 4349, 4349,
+
+     3210, 3209, 3202, 3214, 3214, 3204, 3199, 3224, 3214, 3219,
+     3223, 3218, 3231, 4349, 3222, 3207, 3224, 4349, 3204, 3225,
+     3208, 3217, 3228, 3216, 3220, 3238, 3234, 3224, 3235, 3242,
+     3230, 3224, 3239, 3232, 3228, 3248, 4349, 3240, 3230, 3231,
+     3228, 3247, 3234, 3236, 3243, 3235, 3246, 4349, 3244, 3261,
+     3258, 3249, 3255, 3250, 3245, 3265, 3268, 3271, 3257, 3260,
+     3273, 3266, 3277, 3272, 4349, 3274, 3260, 3261, 3270, 3284,
+     3285, 3266, 3287, 3269, 3289, 3274, 3285, 3292, 3293, 3279,
+     3289, 3286, 3292, 3292, 3286, 3282, 4349, 3297, 3304, 3285,
+     3306, 3298, 3302, 3290, 3305, 3307, 3311, 3314, 3295, 3300,
+
+     3297, 3318, 4349, 3298, 3296, 3305, 3317, 3323, 3304, 3309,
+     3310, 4349, 3308, 3329, 3309, 3323, 3317, 3333, 3332, 3325,
+     3333, 3334, 4349, 3326, 3334, 3341, 3322, 3337, 3330, 3343,
+     3346, 3341, 3322, 4349, 3344, 3345, 3357, 3351, 3359, 3336,
+     3364, 3355, 3356, 3337, 3350, 3361, 3364, 3363, 3360, 3361,
+     3362, 3363, 3359, 3380, 3381, 3372, 4349, 3358, 3374, 4349,
+     3371, 3380, 3388, 3382, 4349, 3364, 4349, 3382, 3371, 3389,
+     3374, 3381, 4349, 3380, 3377, 3379, 3383, 4349, 3393, 3392,
+     3379, 3388, 3402, 3401, 4349, 3404, 3401, 3400, 3412, 3413,
+     3409, 3395, 3409, 3399, 3398, 3394, 3413, 4349, 3411, 3413,
+
+     3418, 3413, 3410, 3400, 3417, 3423, 3410, 4349, 3419, 3405,
+     3406, 3413, 3424, 3409, 3425, 3437, 3426, 3428, 3431, 4349,
+     3419, 3431, 3443, 3430, 3446, 3439, 4349, 4349, 3428, 3442,
+     3441, 3441, 3445, 4349, 3443, 3456, 3440, 3454, 3445, 4349,
+     4349, 3456, 4349, 3438, 4349, 3443, 3442, 4349, 4349, 3454,
+     3434, 3441, 3454, 3469, 3459, 3460, 3467, 4349, 3470, 4349,
+     3465, 3459, 3478, 3472, 3458, 3470, 3471, 4349, 3458, 3466,
+     3480, 4349, 3471, 3487, 3464, 3468, 4349, 3485, 3466, 3468,
+     3494, 4349, 3488, 3491, 3486, 3489, 3493, 3482, 3483, 3486,
+     3479, 3495, 3502, 4349, 3503, 3504, 3505, 3506, 3494, 3489,
+
+     3503, 3508, 3509, 3507, 3494, 3501, 3502, 3495, 3500, 3518,
+     3499, 3520, 3521, 3510, 3503, 3505, 3513, 3519, 3515, 3508,
+     3524, 3510, 3511, 3533, 3524, 3533, 3530, 3516, 3539, 3534,
+     3526, 3540, 3533, 3528, 3529, 4349, 3527, 3527, 3536, 3548,
+     3536, 3548, 3549, 3556, 3558, 3559, 4349, 3560, 4349, 3561,
+     3545, 3553, 3546, 4349, 3546, 3549, 3546, 3549, 3561, 3551,
+     3554, 3572, 4349, 3575, 3553, 3567, 3578, 4349, 3569, 3580,
+     3562, 3563, 3575, 3568, 3566, 3567, 3570, 3568, 3589, 3590,
+     3591, 3597, 3574, 3578, 3578, 3576, 3592, 3578, 3579, 3595,
+     3599, 3603, 3601, 3606, 4349, 3587, 4349, 3598, 3589, 3597,
+
+     3590, 3606, 3613, 3593, 3598, 4349, 3595, 3597, 4349, 4349,
+     3624, 3610, 3600, 3618, 3623, 3608, 3606, 3626, 3627, 4349,
+     3612, 3624, 3630, 3617, 4349, 3612, 3613, 3618, 4349, 3635,
+     4349, 3626, 3640, 3621, 3642, 3637, 3634, 3632, 3646, 4349,
+     4349, 4349, 4349, 4349, 3645, 3648, 3649, 3636, 3637, 3637,
+     3651, 3644, 3647, 3658, 3643, 4349, 3660, 4349, 4349, 3655,
+     3656, 3663, 3658, 3650, 3660, 3658, 3648, 3659, 3661, 4349,
+     3657, 3669, 3669, 3670, 3661, 3678, 3679, 3672, 3675, 3664,
+     3665, 3690, 3680, 3685, 3672, 3683, 3690, 3691, 4349, 4349,
+     3678, 3693, 3690, 3700, 3690, 3691, 3703, 3694, 3695, 3692,
+
+     3687, 3695, 3699, 3693, 4349, 3701, 3704, 4349, 3696, 4349,
+     3704, 3705, 3693, 3699, 3704, 3705, 3714, 3707, 4349, 4349,
+     4349, 3698, 3719, 3700, 3715, 3722, 3703, 3714, 3709, 3726,
+     3707, 4349, 3712, 4349, 3708, 3725, 3731, 3726, 3738, 3739,
+     4349, 3735, 3717, 3742, 3738, 3719, 3727, 3733, 3737, 4349,
+     3734, 3731, 4349, 3741, 3739, 3732, 4349, 3747, 3750, 3751,
+     3751, 3745, 4349, 3756, 4349, 3757, 4349, 3737, 3753, 3765,
+     4349, 3740, 3760, 4349, 3763, 3764, 3764, 3754, 3764, 3755,
+     4349, 3751, 4349, 3750, 3772, 3757, 3774, 3773, 3776, 3761,
+     3778, 3765, 3761, 3766, 3762, 3788, 3784, 3780, 4349, 4349,
+
+     3791, 3766, 3767, 3768, 3792, 3798, 3768, 3790, 3796, 4349,
+     4349, 3791, 4349, 3789, 3796, 4349, 3775, 3798, 3785, 3799,
+     3787, 3786, 3793, 3809, 3790, 3802, 3817, 3793, 3814, 3813,
+     3814, 3816, 3817, 3804, 3816, 3802, 3824, 3815, 3805, 3806,
+     3809, 4349, 3829, 3826, 3812, 4349, 3832, 3831, 3834, 3829,
+     4349, 3836, 3827, 3828, 4349, 3834, 3831, 4349, 3832, 3833,
+     3825, 3846, 3842, 3838, 3833, 3855, 3838, 3843, 4349, 4349,
+     3833, 3829, 4349, 4349, 3857, 3843, 3840, 4349, 3850, 3848,
+     4349, 4349, 3848, 3850, 3838, 3855, 3845, 3872, 4349, 3855,
+     4349, 3856, 4349, 3861, 4349, 3865, 3867, 3872, 3875, 3866,
+
+     4349, 3872, 3877, 4349, 3880, 3881, 3884, 3875, 3865, 3867,
+     3882, 4349, 3894, 3884, 3885, 3892, 3874, 3872, 3889, 3877,
+     3902, 3872, 3899, 4349, 3880, 3885, 3881, 4349, 3903, 4349,
+     3890, 3891, 3901, 3897, 3908, 3889, 3901, 3906, 3886, 3914,
+     3895, 3912, 4349, 3917, 3918, 4349, 3897, 4349, 3920, 4349,
+     3904, 3905, 3916, 3907, 3900, 3926, 3908, 3924, 4349, 3932,
+     3912, 3920, 3915, 4349, 3934, 3927, 3932, 3933, 4349, 3919,
+     3935, 3923, 3943, 3941, 3942, 3949, 3929, 3951, 3952, 3948,
+     3944, 3934, 3961, 3937, 3945, 4349, 3938, 3960, 3957, 3960,
+     4349, 4349, 4349, 3950, 3945, 3972, 3968, 3965, 3975, 3953,
+
+     4349, 3967, 3968, 3955, 3981, 3959, 3980, 4349, 3981, 3962,
+     3973, 4349, 3984, 3985, 3980, 3972, 3982, 3989, 3990, 3991,
+     3986, 4349, 3993, 3988, 4349, 4349, 3975, 4349, 3973, 3974,
+     3988, 3976, 3994, 3999, 4003, 4002, 4349, 4005, 3991, 3986,
+     3998, 4009, 4010, 4011, 4017, 3993, 4008, 4349, 4015, 4003,
+     4349, 4017, 4349, 4018, 4013, 4020, 4006, 4027, 4010, 4015,
+     4026, 4021, 4349, 4007, 4008, 4024, 4018, 4028, 4349, 4024,
+     4014, 4015, 4016, 4019, 4035, 4022, 4023, 4037, 4349, 4349,
+     4023, 4033, 4349, 4349, 4046, 4048, 4049, 4349, 4349, 4349,
+     4050, 4349, 4036, 4055, 4058, 4061, 4055, 4064, 4064, 4045,
+
+     4349, 4061, 4349, 4067, 4049, 4054, 4349, 4349, 4349, 4049,
+     4065, 4072, 4349, 4073, 4349, 4349, 4064, 4349, 4068, 4070,
+     4067, 4078, 4349, 4060, 4071, 4080, 4083, 4084, 4069, 4080,
+     4079, 4093, 4092, 4070, 4081, 4076, 4093, 4094, 4081, 4102,
+     4097, 4349, 4349, 4104, 4349, 4084, 4349, 4106, 4107, 4108,
+     4109, 4115, 4111, 4112, 4349, 4113, 4114, 4349, 4105, 4116,
+     4107, 4097, 4349, 4349, 4099, 4120, 4105, 4108, 4110, 4122,
+     4109, 4126, 4349, 4349, 4108, 4128, 4114, 4128, 4114, 4349,
+     4130, 4140, 4121, 4131, 4118, 4120, 4140, 4349, 4126, 4349,
+     4133, 4349, 4349, 4349, 4349, 4123, 4349, 4349, 4349, 4349,
+
+     4141, 4349, 4133, 4148, 4149, 4349, 4142, 4141, 4148, 4131,
+     4139, 4349, 4131, 4157, 4150, 4160, 4145, 4160, 4150, 4145,
+     4148, 4151, 4154, 4155, 4166, 4160, 4176, 4155, 4171, 4349,
+     4349, 4163, 4158, 4181, 4172, 4183, 4182, 4185, 4186, 4167,
+     4168, 4186, 4185, 4186, 4167, 4178, 4200, 4182, 4177, 4193,
+     4200, 4201, 4202, 4187, 4184, 4205, 4349, 4190, 4349, 4188,
+     4349, 4349, 4208, 4207, 4215, 4191, 4217, 4218, 4199, 4201,
+     4196, 4217, 4218, 4349, 4349, 4349, 4197, 4199, 4349, 4206,
+     4217, 4349, 4202, 4219, 4206, 4213, 4214, 4209, 4224, 4225,
+     4349, 4349, 4211, 4214, 4214, 4235, 4230, 4242, 4236, 4233,
+
+     4234, 4235, 4222, 4248, 4244, 4239, 4246, 4349, 4242, 4228,
+     4241, 4230, 4232, 4258, 4234, 4241, 4349, 4254, 4349, 4257,
+     4252, 4253, 4240, 4241, 4249, 4262, 4260, 4253, 4349, 4268,
+     4267, 4250, 4269, 4270, 4267, 4266, 4255, 4276, 4271, 4275,
+     4279, 4272, 4273, 4262, 4277, 4265, 4349, 4286, 4267, 4349,
+     4282, 4283, 4270, 4271, 4290, 4349, 4293, 4274, 4276, 4295,
+     4298, 4291, 4349, 4300, 4301, 4294, 4349, 4297, 4349, 4349,
+     4298, 4285, 4286, 4307, 4308, 4349, 4349, 4349
     } ;
 
-static yyconst flex_int16_t yy_def[2919] =
+static yyconst flex_int16_t yy_def[3179] =
     {   0,
-     2904,    1, 2905, 2905, 2906, 2906, 2907, 2907, 2908, 2908,
-     2909, 2909, 2904, 2910, 2904, 2904, 2904, 2904, 2911, 2910,
-     2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910,
-     2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910,
-     2910, 2910, 2912, 2904, 2904, 2904, 2912, 2913, 2904, 2904,
-     2904, 2913, 2914, 2904, 2904, 2904, 2904, 2914, 2915, 2904,
-     2904, 2904, 2915, 2916, 2904, 2917, 2904, 2916, 2916, 2910,
-     2910, 2904, 2918, 2911, 2918, 2911, 2910, 2910, 2910, 2910,
-     2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910,
-     2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910,
-
-     2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910,
-     2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910,
-     2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910,
-     2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2912,
-     2912, 2913, 2913, 2914, 2914, 2904, 2915, 2915, 2916, 2916,
-     2917, 2917, 2916, 2910, 2910, 2910, 2910, 2910, 2910, 2910,
-     2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910,
-     2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910,
-     2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910,
-     2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910,
-
-     2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910,
-     2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910,
-     2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910,
-     2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910,
-     2916, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910,
-     2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910,
-     2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910,
-     2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910,
-     2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910,
-     2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910,
-
-     2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910,
-     2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910,
-     2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910,
-     2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2904,
-     2910, 2910, 2910, 2910, 2910, 2910, 2910, 2916, 2910, 2910,
-     2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910,
-     2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910,
-     2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910,
-     2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910,
-     2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910,
-
-     2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910,
-     2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910,
-     2904, 2910, 2910, 2910, 2910, 2910, 2910, 2904, 2910, 2910,
-     2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910,
-     2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910,
-     2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910,
-     2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910,
-     2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910,
-     2910, 2910, 2904, 2910, 2916, 2910, 2910, 2910, 2910, 2910,
-     2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910,
-
-     2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910,
-     2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910,
-     2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910,
-     2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910,
-     2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910,
-     2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910,
-     2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910,
-     2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910,
-     2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910,
-     2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910,
-
-     2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910,
-     2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910,
-     2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910,
-     2910, 2910, 2910, 2910, 2910, 2910, 2910, 2916, 2910, 2910,
-     2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2904,
-     2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910,
-     2910, 2910, 2910, 2910, 2904, 2910, 2904, 2904, 2910, 2904,
-     2904, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910,
-     2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910,
-     2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910,
-
-     2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910,
-     2910, 2910, 2910, 2910, 2904, 2910, 2910, 2910, 2910, 2910,
-     2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910,
-     2910, 2910, 2910, 2904, 2910, 2910, 2910, 2910, 2910, 2910,
-     2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2904, 2910,
-     2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910,
-     2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910,
-     2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910,
-     2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910,
-     2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910,
-
-     2910, 2916, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2904,
-     2910, 2910, 2904, 2910, 2910, 2910, 2910, 2910, 2910, 2910,
-     2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910,
-     2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910,
-     2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910,
-     2910, 2910, 2910, 2910, 2910, 2910, 2910, 2904, 2910, 2910,
-     2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910,
-     2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910,
-     2910, 2904, 2910, 2904, 2910, 2910, 2910, 2910, 2910, 2910,
-     2910, 2910, 2910, 2910, 2910, 2910, 2910, 2904, 2910, 2910,
-
-     2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910,
-     2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2904, 2910,
-     2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910,
-     2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2904,
-     2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910,
-     2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910,
-     2910, 2910, 2910, 2910, 2910, 2910, 2910, 2904, 2910, 2910,
-     2916, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910,
-     2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910,
-     2910, 2904, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2904,
-
-     2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910,
-     2910, 2910, 2904, 2910, 2910, 2910, 2910, 2910, 2910, 2910,
-     2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910,
-     2910, 2910, 2910, 2910, 2910, 2904, 2910, 2910, 2910, 2910,
-     2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910,
-     2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910,
-     2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910,
-     2910, 2910, 2910, 2910, 2910, 2910, 2904, 2910, 2910, 2910,
-     2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910,
-     2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910,
-
-     2904, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910,
-     2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910,
-     2904, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910,
-     2910, 2910, 2910, 2910, 2904, 2910, 2910, 2910, 2910, 2910,
-     2910, 2910, 2910, 2910, 2904, 2910, 2910, 2910, 2910, 2910,
-     2904, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910,
-     2910, 2910, 2910, 2910, 2910, 2904, 2910, 2910, 2910, 2910,
-     2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910,
-     2910, 2910, 2910, 2910, 2910, 2910, 2910, 2904, 2910, 2910,
-     2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910,
-
-     2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910,
-     2910, 2910, 2910, 2910, 2910, 2910, 2904, 2910, 2910, 2910,
-     2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910,
-     2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910,
-     2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910,
-     2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910,
-     2910, 2910, 2910, 2910, 2910, 2904, 2910, 2910, 2910, 2910,
-     2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910,
-     2904, 2910, 2904, 2910, 2910, 2910, 2910, 2910, 2904, 2910,
-     2904, 2910, 2910, 2910, 2910, 2904, 2910, 2910, 2910, 2910,
-
-     2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910,
-     2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910,
-     2910, 2910, 2910, 2904, 2910, 2910, 2910, 2910, 2910, 2910,
-     2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910,
-     2910, 2910, 2904, 2910, 2910, 2910, 2910, 2904, 2910, 2910,
-     2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910,
-     2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910,
-     2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910,
-     2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910,
-     2910, 2910, 2910, 2910, 2910, 2910, 2910, 2904, 2910, 2910,
-
-     2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910,
-     2910, 2904, 2910, 2904, 2910, 2910, 2910, 2910, 2910, 2910,
-     2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910,
-     2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910,
-     2904, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910,
-     2910, 2910, 2910, 2904, 2910, 2910, 2910, 2910, 2910, 2910,
-     2910, 2910, 2904, 2910, 2910, 2910, 2910, 2910, 2910, 2904,
-     2910, 2904, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910,
-     2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910,
-     2910, 2910, 2904, 2910, 2910, 2910, 2910, 2910, 2910, 2910,
-
-     2910, 2904, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910,
-     2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910,
-     2910, 2904, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910,
-     2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910,
-     2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910,
-     2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910,
-     2910, 2904, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910,
-     2910, 2910, 2910, 2910, 2910, 2904, 2910, 2910, 2910, 2910,
-     2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910,
-     2910, 2910, 2910, 2904, 2904, 2910, 2910, 2910, 2904, 2910,
-
-     2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910,
-     2910, 2904, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910,
-     2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910,
-     2910, 2910, 2904, 2910, 2910, 2910, 2904, 2910, 2910, 2910,
-     2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910,
-     2910, 2910, 2910, 2910, 2910, 2910, 2910, 2904, 2910, 2910,
-     2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910,
-     2904, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2904,
-     2910, 2910, 2910, 2904, 2910, 2910, 2910, 2910, 2910, 2910,
-     2910, 2910, 2910, 2910, 2904, 2910, 2904, 2910, 2910, 2910,
-
-     2904, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910,
-     2910, 2910, 2910, 2910, 2910, 2910, 2910, 2904, 2910, 2910,
-     2910, 2910, 2910, 2910, 2910, 2910, 2910, 2904, 2904, 2910,
-     2904, 2910, 2910, 2910, 2904, 2910, 2910, 2910, 2910, 2910,
-     2910, 2910, 2910, 2904, 2910, 2910, 2910, 2910, 2910, 2910,
-     2910, 2910, 2910, 2910, 2910, 2904, 2910, 2910, 2910, 2910,
-     2910, 2910, 2910, 2910, 2904, 2910, 2910, 2910, 2910, 2910,
-     2904, 2910, 2904, 2910, 2910, 2910, 2910, 2910, 2904, 2910,
-     2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910,
-     2910, 2910, 2910, 2904, 2910, 2910, 2910, 2910, 2910, 2910,
-
-     2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910,
-     2910, 2910, 2910, 2910, 2910, 2904, 2910, 2910, 2910, 2904,
-     2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2904,
-     2910, 2910, 2910, 2910, 2910, 2910, 2904, 2904, 2910, 2904,
-     2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910,
-     2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2904,
-     2904, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910,
-     2910, 2910, 2910, 2910, 2904, 2910, 2910, 2910, 2904, 2910,
-     2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910,
-     2910, 2910, 2910, 2910, 2910, 2910, 2910, 2904, 2910, 2910,
-
-     2910, 2910, 2910, 2910, 2910, 2910, 2910, 2904, 2910, 2910,
-     2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910,
-     2910, 2910, 2910, 2904, 2910, 2910, 2910, 2910, 2910, 2910,
-     2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910,
-     2910, 2910, 2904, 2910, 2910, 2910, 2910, 2910, 2910, 2910,
-     2910, 2910, 2910, 2910, 2910, 2910, 2904, 2910, 2910, 2910,
-     2910, 2910, 2910, 2910, 2910, 2904, 2910, 2910, 2910, 2910,
-     2910, 2910, 2910, 2910, 2910, 2904, 2910, 2910, 2910, 2910,
-     2910, 2910, 2910, 2910, 2904, 2910, 2910, 2910, 2910, 2910,
-     2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910,
-
-     2910, 2910, 2910, 2910, 2904, 2910, 2904, 2910, 2910, 2910,
-     2910, 2910, 2904, 2910, 2910, 2910, 2910, 2910, 2904, 2910,
-     2910, 2910, 2910, 2904, 2910, 2910, 2910, 2910, 2910, 2910,
-     2904, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910,
-     2910, 2910, 2910, 2904, 2910, 2910, 2910, 2910, 2910, 2910,
-     2910, 2910, 2910, 2904, 2910, 2910, 2910, 2910, 2910, 2910,
-     2910, 2910, 2910, 2910, 2904, 2910, 2910, 2910, 2910, 2910,
-     2904, 2904, 2910, 2910, 2910, 2910, 2910, 2904, 2910, 2910,
-     2910, 2910, 2910, 2904, 2904, 2910, 2904, 2910, 2904, 2910,
-     2910, 2904, 2904, 2910, 2910, 2910, 2910, 2910, 2904, 2910,
-
-     2904, 2910, 2910, 2910, 2910, 2910, 2904, 2910, 2910, 2910,
-     2904, 2910, 2910, 2910, 2910, 2904, 2910, 2910, 2910, 2904,
-     2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910,
-     2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910,
-     2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910,
-     2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910,
-     2910, 2910, 2910, 2910, 2910, 2904, 2910, 2910, 2910, 2910,
-     2910, 2910, 2910, 2910, 2910, 2910, 2904, 2910, 2904, 2910,
-     2910, 2910, 2910, 2904, 2910, 2910, 2910, 2910, 2910, 2910,
-     2910, 2910, 2904, 2910, 2910, 2910, 2910, 2904, 2910, 2910,
-
-     2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910,
-     2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910,
-     2910, 2910, 2904, 2910, 2904, 2910, 2910, 2910, 2910, 2910,
-     2910, 2910, 2904, 2904, 2910, 2910, 2910, 2910, 2910, 2910,
-     2910, 2904, 2910, 2910, 2910, 2910, 2904, 2910, 2910, 2910,
-     2904, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2904, 2904,
-     2904, 2904, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910,
-     2910, 2904, 2910, 2904, 2904, 2910, 2910, 2910, 2910, 2910,
-     2910, 2910, 2910, 2904, 2910, 2910, 2910, 2910, 2910, 2910,
-     2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910,
-
-     2910, 2904, 2904, 2910, 2910, 2910, 2910, 2910, 2910, 2910,
-     2910, 2910, 2910, 2910, 2910, 2910, 2910, 2904, 2910, 2910,
-     2904, 2910, 2904, 2910, 2910, 2910, 2910, 2910, 2910, 2910,
-     2910, 2904, 2904, 2910, 2910, 2910, 2910, 2910, 2910, 2910,
-     2910, 2910, 2904, 2910, 2904, 2910, 2910, 2910, 2910, 2910,
-     2910, 2910, 2910, 2910, 2910, 2904, 2910, 2910, 2904, 2910,
-     2910, 2910, 2904, 2910, 2910, 2910, 2904, 2910, 2904, 2910,
-     2904, 2910, 2910, 2904, 2910, 2910, 2904, 2910, 2910, 2910,
-     2910, 2904, 2910, 2904, 2910, 2910, 2910, 2910, 2910, 2910,
-     2910, 2910, 2910, 2910, 2910, 2910, 2904, 2904, 2910, 2910,
-
-     2910, 2910, 2910, 2910, 2910, 2910, 2910, 2904, 2904, 2910,
-     2904, 2910, 2910, 2904, 2910, 2910, 2910, 2910, 2910, 2910,
-     2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910,
-     2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2904, 2910,
-     2910, 2910, 2904, 2910, 2910, 2910, 2910, 2904, 2910, 2910,
-     2910, 2910, 2904, 2910, 2910, 2910, 2910, 2910, 2910, 2910,
-     2910, 2904, 2904, 2904, 2904, 2910, 2910, 2904, 2910, 2910,
-     2904, 2904, 2910, 2910, 2910, 2910, 2904, 2910, 2904, 2910,
-     2904, 2910, 2910, 2910, 2910, 2904, 2910, 2910, 2904, 2910,
-     2910, 2910, 2910, 2910, 2910, 2910, 2904, 2910, 2910, 2910,
-
-     2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2904, 2910,
-     2910, 2910, 2904, 2910, 2904, 2910, 2910, 2910, 2910, 2910,
-     2910, 2910, 2910, 2910, 2910, 2910, 2904, 2910, 2910, 2904,
-     2910, 2904, 2910, 2904, 2910, 2910, 2910, 2910, 2904, 2910,
-     2910, 2910, 2910, 2904, 2910, 2910, 2904, 2910, 2910, 2910,
-     2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910,
-     2910, 2910, 2910, 2904, 2904, 2904, 2910, 2910, 2910, 2910,
-     2910, 2910, 2910, 2904, 2910, 2910, 2910, 2910, 2910, 2910,
-     2904, 2910, 2910, 2910, 2904, 2910, 2910, 2910, 2910, 2910,
-     2910, 2910, 2910, 2910, 2904, 2910, 2904, 2904, 2910, 2904,
-
-     2910, 2910, 2910, 2910, 2904, 2910, 2910, 2910, 2910, 2910,
-     2910, 2910, 2904, 2904, 2910, 2904, 2910, 2910, 2910, 2910,
-     2910, 2910, 2910, 2910, 2904, 2910, 2910, 2910, 2910, 2910,
-     2904, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910,
-     2904, 2904, 2910, 2910, 2904, 2904, 2910, 2910, 2910, 2904,
-     2904, 2904, 2910, 2904, 2910, 2910, 2910, 2910, 2910, 2904,
-     2910, 2910, 2910, 2904, 2910, 2910, 2904, 2904, 2910, 2910,
-     2910, 2910, 2910, 2904, 2910, 2910, 2910, 2910, 2910, 2910,
-     2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910,
-     2910, 2910, 2904, 2904, 2910, 2904, 2904, 2910, 2910, 2910,
-
-     2910, 2910, 2910, 2910, 2904, 2910, 2910, 2910, 2904, 2910,
-     2910, 2910, 2910, 2910, 2910, 2910, 2910, 2904, 2904, 2910,
-     2910, 2910, 2910, 2910, 2904, 2910, 2910, 2910, 2910, 2910,
-     2910, 2910, 2904, 2910, 2904, 2904, 2904, 2904, 2904, 2904,
-     2904, 2904, 2910, 2904, 2910, 2910, 2904, 2910, 2910, 2910,
-     2910, 2910, 2904, 2910, 2910, 2910, 2910, 2910, 2910, 2910,
-     2910, 2910, 2910, 2910, 2910, 2910, 2910, 2904, 2904, 2910,
-     2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910,
-     2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910,
-     2904, 2910, 2904, 2910, 2904, 2904, 2910, 2910, 2910, 2910,
-
-     2910, 2910, 2910, 2910, 2910, 2910, 2904, 2910, 2904, 2910,
-     2910, 2904, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910,
-     2904, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910,
-     2910, 2910, 2910, 2910, 2904, 2910, 2910, 2910, 2910, 2910,
-     2910, 2910, 2910, 2910, 2904, 2910, 2910, 2910, 2910, 2910,
-     2910, 2910, 2910, 2910, 2904, 2910, 2910, 2910, 2910, 2910,
-     2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910,
-     2910, 2910, 2904, 2910, 2910, 2904, 2910, 2910, 2910, 2910,
-     2910, 2904, 2910, 2910, 2910, 2910, 2910, 2910, 2904, 2910,
-     2910, 2910, 2904, 2910, 2904, 2904, 2910, 2910, 2910, 2910,
-
-     2910, 2904, 2904,    0, 2904, 2904, 2904, 2904, 2904, 2904,
-     2904, 2904, 2904, 2904, 2904, 2904, 2904, 2904
+     3178,    1, 3178,    3, 3178,    5, 3178,    7, 3178,    9,
+     3178,   11, 3178, 3178,   13, 3178, 3178, 3178, 3178, 3178,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14, 3178, 3178, 3178, 3178, 3178, 3178, 3178,
+     3178, 3178, 3178, 3178,   13, 3178, 3178, 3178, 3178, 3178,
+     3178, 3178, 3178, 3178, 3178, 3178, 3178, 3178, 3178,   65,
+       14,   20,   15, 3178,   19,   74, 3178,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   71,   71,   71,
+       30,   71,   71,   71,   71,   29,   71,   36,   71,   71,
+       71,   71,   71,   71,   71,   71,   71,   71,   71,   71,
+       71,   78,   82,   86,  101,   86,   88,   44,   48,   44,
+       49,   53,   49,   54,   59,   55,   54,   60,   64,   60,
+       65,   69,   67, 3178,   65,   65,   19,  101,   87,   86,
+      126,  126,   91,   91,   92,  126,  101,   95,   95,  123,
+       97,  101,  123,  131,  117,  102,  123,  105,  115,  115,
+      132,  117,  131,  111,  112,  115,  134,  126,  126,  118,
+
+      142,  142,  120,  142,  122,  136,  131,  183,  131,  131,
+      178,  131,  174,  131,  131,  184,  142,  184,  135,  184,
+      195,  139,  139,  178,  223,  142,  174,  222,  145,  179,
+      170,  171,  206,  178,  177,  200,  194,  226,  184,  184,
+      188,  184,  192,  182,  181,  192,  195,  184,  207,  219,
+      188,  207,  191,  197,  208,  192,  200,  207,  245,  196,
+      197,  201,   67,   65,  251,  213,  205,  202,  260,  207,
+      207,  217,  217,  210,  232,  254,  231,  254,  213,  215,
+      216,  219,  245,  255,  219,  231,  255,  255,  233,  232,
+      250,  237,  230,  239,  254,  239,  245,  239,  237,  255,
+
+      235,  244,  239,  243,  277,  240,  242,  255,  250,  277,
+      292,  277,  255,  277,  250,  253,  252,  282,  253,  265,
+      293,  277,  262,  262,  270,  282,  307,  316,  282,  266,
+      282,  268,  304,  275,  293,  293,  330,  301,  284,  290,
+      301,  316,  279,  301,  304,  290,  294,  304,  301,  294,
+      301,  301,  291,  291,  295,  306,  293,  300,  296,  296,
+      301,  306,  300,  301,  304,  306,  334,  334,  355, 3178,
+      309,  355,  309,  334,  321,  317,  317,  313,   65,  343,
+      334,  321,  343,  325,  319,  345,  355,  325,  323,  345,
+      345,  334,  338,  334,  347,  339,  345,  342,  355,  347,
+
+      335,  336,  338,  338,  345,  402,  402,  355,  345,  344,
+      380,  358,  380,  367,  402,  350,  355,  359,  357,  357,
+      361,  410,  357,  359,  366,  378,  410,  364,  365,  396,
+      365,  393,  431,  396,  377,  410,  374,  425,  393,  393,
+      382,  398,  386,  416,  398,  382,  410,  426,  398,  396,
+      393,  425,  396, 3178,  396,  395,  425,  393,  420,  397,
+      398, 3178,  397,  405,  399,  400,  420,  418,  413,  421,
+      408,  458,  418,  429,  446,  416,  417,  421,  430,  414,
+      425,  422,  421,  437,  421,  420,  469,  431,  426,  424,
+      429,  437,  427,  469,  486,  436,  432,  437,  439,  486,
+
+      459,  456,  439,  486,  446,  440,  443,  450,  443,  450,
+      484,  449,  484,  469,  480,  451,  459,  469,  484,  455,
+     3178,  469,  459,   65,  466,  461,  484,  469,  465,  484,
+      465,  482,  488,  468,  469,  470,  473,  526,  473,  526,
+      475,  477,  484,  478,  505,  486,  486,  490,  488,  536,
+      536,  490,  536,  536,  490,  490,  505,  499,  494,  535,
+      505,  499,  506,  514,  532,  502,  504,  532,  531,  516,
+      507,  525,  516,  529,  526,  531,  511,  531,  516,  516,
+      529,  519,  525,  523,  541,  532,  544,  541,  544,  547,
+      531,  528,  533,  544,  571,  536,  584,  559,  547,  538,
+
+      577,  584,  540,  552,  541,  545,  545,  560,  558,  569,
+      574,  552,  558,  552,  557,  558,  553,  593,  593,  559,
+      560,  566,  559,  584,  562,  569,  566,  600,  570,  566,
+      577,  568,  585,  570,  598,  634,  576,  576,  576,  598,
+      595,  583,  579,  584,  582,  582,  591,  598,  600,  645,
+      597,  604,  611,  600,  598,  598,  643,  610,  599,  610,
+      598,  598,  611,  623,  601,  643,  623,  604,  611,  609,
+      659,  623,  618,  610,  613,  632,  674,  616,  616,  637,
+      674,  624,  653,  624,  641,  628,   65,  633,  643,  653,
+      644,  645,  653,  629,  630,  631,  695,  644, 3178,  635,
+
+      642,  641,  643,  649,  676,  647,  642,  642,  674,  647,
+      676,  685,  648, 3178,  650, 3178, 3178,  649, 3178, 3178,
+      651,  651,  659,  657,  665,  665,  668,  658,  663,  685,
+      701,  661,  694,  670,  670,  694,  680,  676,  688,  695,
+      674,  725,  692,  725,  675,  688,  678,  677,  686,  700,
+      689,  685,  700,  708,  725,  692,  690,  725,  706,  704,
+      691,  701,  734,  695,  695, 3178,  734,  701,  701,  725,
+      721,  734,  707,  739,  722,  708,  708,  725,  710,  734,
+      741,  750,  740,  721,  754,  731,  750, 3178,  771,  771,
+      734,  771,  731,  739,  734,  757,  738,  742,  743,  750,
+
+      771,  736,  739, 3178,  748,  740,  754,  741,  745,  808,
+      752,  752,  761,  752,  771,  749,  751,  759,  753,  762,
+      771,  760,  782,  757,  796,  775,  796,  763,  764,  811,
+      771,  811,  776,  811,  813,  782,  811,  773,  778,  796,
+      786,  811,  786,  786,  817,  782,  811,  791,  808,  798,
+      785,  786,  794,  818,  790,  793,  811,  806,  818,  795,
+      809,   65,  799,  817,  850,  813,  811,  809,  819, 3178,
+      805,  824, 3178,  811,  808,  809,  850,  817,  863,  829,
+      814,  817,  863,  824,  828,  824,  820,  824,  845,  863,
+      828,  828,  827,  849,  840,  829,  838,  838,  858,  833,
+
+      838,  835,  836,  854,  840,  839,  848,  872,  906,  850,
+      848,  845,  864,  854,  872,  869,  869,  858,  864, 3178,
+      856,  854,  869,  856,  897,  860,  869,  860,  928,  863,
+      897,  928,  869,  868,  874,  872,  874,  906,  928,  928,
+      896,  877,  897, 3178,  930, 3178,  884,  935,  903,  903,
+      904,  886,  904,  890,  892,  892,  892,  903,  928,  910,
+      897,  924, 3178,  930,  897,  910,  922,  908,  935,  904,
+      924,  930,  954,  921,  935,  921,  922,  910,  911,  926,
+      930,  926,  926,  938, 3178,  926,  941,  930,  941,  925,
+      923,  928,  951,  967,  960,  951,  933,  935,  967,  962,
+
+      943,  943,  955,  949,  955,  955,  943, 3178,  951,  948,
+      943,  955,  991,  959,  959,  951,  967,  962,  954,  967,
+      954,  970,  984,  958,  961,  961,  973,  979,  991,  997,
+      968,  969,  984,  968,  970,  992,  997,  972, 3178,  997,
+      995,  991,   65, 1031, 1019,  984,  979,  992,  991,  998,
+      990,  990,  986,  987, 1003, 1031, 1031, 1003, 1019,  997,
+      994, 1019,  997, 3178, 1013, 1031, 1009, 1019, 1001, 1010,
+     1003, 3178, 1041, 1005, 1061, 1031, 1017, 1016, 1014, 1012,
+     1024, 1028, 1021, 1024, 3178, 1029, 1028, 1028, 1032, 1028,
+     1022, 1036, 1027, 1027, 1030, 1033, 1045, 1061, 1033, 1037,
+
+     1032, 1035, 1069, 1045, 1061, 1077, 1050, 1050, 1048, 3178,
+     1051, 1044, 1045, 1050, 1047, 1096, 1049, 1060, 1056, 1052,
+     1073, 1055, 1120, 1079, 1111, 1073, 1074, 1079, 1111, 1074,
+     1074, 1073, 1101, 1073, 1074, 1070, 1078, 1079, 1081, 1111,
+     1089, 1080, 1112, 1078, 1111, 1111, 1113, 1082, 1091, 1089,
+     1121, 1087, 1088, 3178, 1091, 1093, 1102, 1092, 1111, 1094,
+     1115, 1097, 1112, 1109, 1100, 1100, 1113, 1112, 1115, 1112,
+     1109, 1137, 1107, 1115, 1111, 1111, 1156, 1176, 1114, 3178,
+     1115, 1127, 1118, 1124, 1176, 1136, 1176, 1126, 1127, 1133,
+     1133, 1176, 1127, 1136, 1181, 1136, 1131, 1138, 1179, 1137,
+
+     3178, 1181, 1156, 1142, 1142, 1139, 1140, 1147, 1142, 1148,
+     1151, 1148, 1157, 1147, 1148, 1149, 3178, 1175, 1175, 1156,
+     1161, 1175, 1158, 1165, 1158, 1176, 1186, 1161, 3178, 1186,
+     1207, 1175, 1175, 1214, 3178, 1175, 1168, 1186, 1228, 1171,
+     1172, 1188, 1186, 1175, 1200, 1182, 1178, 1207, 1182, 3178,
+     1183, 1185, 1200, 1198, 1208, 1240, 1203, 1200, 1193, 1199,
+     1240, 1218, 1194, 1225, 1224, 1197, 1200, 1204, 1200, 1204,
+     1227, 3178, 1240, 1213, 1213, 1211, 1263, 1213, 1224, 1218,
+     1228, 1224, 1240, 1220, 1220, 1224, 1221, 1220, 1221, 1241,
+     1246, 1246, 1254, 1242, 1257, 1234, 1230, 1246, 1232, 1233,
+
+     1242, 1242, 3178, 1247, 1263, 1254, 1241, 1256, 1257, 1288,
+     1276, 1271, 1255, 1249, 1256, 1251, 1252, 1252, 1271, 1276,
+     1265, 1265, 1293, 1268, 1265, 1271, 1267, 1262, 1268, 1266,
+     1280, 1279, 1280, 1279, 1296, 1280, 1279, 1279, 1280, 1279,
+     1279, 1283, 1297, 1284, 1294, 1281, 1282, 1304, 1287, 1305,
+     1286, 1293, 1351, 1296, 3178, 1291, 1295, 1292, 1312, 1358,
+     1304, 1298, 1298, 1305, 1305, 1312, 1307, 1312, 1328, 1348,
+     1316, 3178, 1307, 3178, 1343, 1314, 1311, 1328, 1312, 3178,
+     1348, 3178, 1346, 1348, 1358, 1358, 3178, 1346, 1346, 1326,
+     1323, 1345, 1344, 1343, 1325, 1329, 1342, 1345, 1367, 1347,
+
+     1331, 1344, 1333, 1345, 1342, 1367, 1349, 1344, 1348, 1350,
+     1359, 1345, 1369, 1344, 1345, 1350, 1371, 1349, 3178, 1361,
+     1352, 1367, 1397, 1359, 1397, 1403, 1377, 1362, 1359, 1366,
+     1391, 1362, 1366, 1364, 1376, 1369, 1368, 1369, 3178, 1397,
+     1370, 1371, 1373, 3178, 1376, 1376, 1377, 1392, 1397, 1399,
+     1393, 1388, 1392, 1400, 1390, 1389, 1401, 1396, 1421, 1396,
+     1403, 1452, 1401, 1407, 1398, 1404, 1401, 1407, 1402, 1406,
+     1417, 1411, 1452, 1413, 1413, 1418, 1413, 1411, 1418, 1420,
+     1418, 1422, 1429, 1429, 1423, 1429, 1423, 1423, 1454, 1469,
+     1436, 1429, 1429, 1440, 1429, 3178, 1441, 1433, 1432, 1447,
+
+     1451, 1440, 1446, 1450, 1459, 1451, 1441, 1454, 1443, 3178,
+     1451, 3178, 1461, 1452, 1480, 1480, 1454, 1470, 1452, 1480,
+     1469, 1471, 1458, 1458, 1478, 1459, 1471, 1509, 1505, 1471,
+     1489, 1505, 1470, 1467, 1480, 1472, 1490, 1482, 1485, 1509,
+     1489, 3178, 1513, 1482, 1500, 1509, 1505, 1481, 1500, 1489,
+     1504, 1495, 1495, 1504, 1491, 3178, 1488, 1491, 1504, 1497,
+     1534, 1499, 1534, 1495, 3178, 1505, 1498, 1502, 1534, 1521,
+     1505, 1534, 3178, 1526, 3178, 1522, 1522, 1552, 1526, 1529,
+     1521, 1521, 1539, 1539, 1516, 1534, 1534, 1521, 1536, 1523,
+     1536, 1538, 1527, 1537, 1534, 1527, 1528, 1538, 3178, 1535,
+
+     1536, 1532, 1536, 1548, 1548, 1548, 1547, 1538, 3178, 1539,
+     1540, 1560, 1576, 1544, 1576, 1560, 1557, 1548, 1614, 1614,
+     1576, 1567, 1558, 1614, 1559, 1564, 1560, 1559, 1560, 3178,
+     1562, 1580, 1563, 1600, 1614, 1567, 1628, 1589, 1596, 1592,
+     1592, 1590, 1580, 1614, 1611, 1590, 1580, 1589, 1611, 1600,
+     1586, 1585, 1593, 1597, 1589, 1636, 1597, 1591, 1600, 1600,
+     1601, 1600, 1658, 1652, 1652, 1600, 1602, 1623, 1628, 3178,
+     1623, 1625, 1623, 1612, 1622, 1610, 1628, 1612, 1658, 1623,
+     1615, 1622, 1622, 1623, 1622, 3178, 1623, 1621, 1636, 1623,
+     1645, 1633, 1632, 1638, 1652, 1629, 1631, 1658, 1638, 1639,
+
+     1658, 1650, 1638, 3178, 3178, 1650, 1676, 1643, 3178, 1643,
+     1652, 1651, 1650, 1693, 1646, 1658, 1652, 1649, 1650, 1693,
+     1697, 1658, 1697, 1658, 1658, 1657, 3178, 1715, 1668, 1661,
+     1719, 1668, 1668, 1666, 1715, 1693, 1675, 1668, 1669, 1677,
+     1672, 1697, 1679, 1680, 1682, 1739, 1691, 1682, 3178, 1682,
+     1738, 1691, 3178, 1738, 1684, 1685, 1693, 1697, 1698, 1696,
+     1755, 1726, 1696, 1695, 1695, 1738, 1715, 1699, 1699, 1741,
+     1712, 1718, 1715, 1706, 1716, 1755, 3178, 1710, 1726, 1730,
+     1713, 1734, 1729, 1716, 1729, 1729, 1729, 1721, 1728, 1739,
+     1729, 3178, 1739, 1755, 1784, 1739, 1729, 1732, 1731, 1732,
+
+     1733, 1739, 3178, 1739, 1738, 1767, 3178, 1740, 1743, 1760,
+     1760, 1745, 1744, 1756, 1767, 1756, 1757, 3178, 1767, 3178,
+     1808, 1790, 1759, 3178, 1790, 1790, 1767, 1760, 1778, 1767,
+     1767, 1763, 1768, 1778, 1770, 1766, 1776, 1767, 1771, 1769,
+     3178, 1775, 1835, 1778, 1775, 1778, 1790, 1776, 1789, 1780,
+     3178, 3178, 1781, 3178, 1808, 1782, 1856, 3178, 1784, 1840,
+     1786, 1787, 1809, 1789, 3178, 1817, 1810, 1795, 3178, 1801,
+     1812, 1809, 1817, 1848, 1812, 1802, 1802, 1802, 1804, 1859,
+     1814, 3178, 1812, 1822, 1810, 1835, 1812, 1821, 1815, 1833,
+     3178, 1819, 1864, 1835, 1827, 1870, 3178, 1829, 3178, 1835,
+
+     1829, 1847, 1864, 1836, 3178, 1850, 1834, 1835, 1864, 1840,
+     1853, 1879, 1838, 1864, 1849, 1855, 1871, 1849, 1886, 1871,
+     1861, 1849, 1850, 1868, 3178, 1904, 1860, 1867, 1863, 1859,
+     1871, 1861, 1889, 1864, 1868, 1867, 1872, 1876, 1872, 1872,
+     1873, 1873, 1893, 1874, 1885, 1898, 1877, 1889, 1893, 3178,
+     1884, 1889, 1889, 3178, 1906, 1887, 1898, 1911, 1894, 1894,
+     1892, 1892, 1910, 1930, 3178, 1902, 1902, 1917, 1913, 1913,
+     1907, 3178, 3178, 1908, 1908, 1926, 3178, 1907, 1908, 1930,
+     1919, 1911, 1941, 1928, 1941, 1919, 1928, 1926, 1918, 1922,
+     1923, 1928, 1928, 1932, 1932, 1926, 1927, 1931, 3178, 3178,
+
+     1936, 1930, 1941, 1936, 1937, 1938, 1959, 1994, 1948, 1939,
+     1958, 1948, 1994, 3178, 1989, 1956, 1989, 3178, 1982, 1948,
+     1979, 1964, 1952, 1959, 1962, 1958, 1989, 1964, 1961, 1958,
+     1966, 1988, 1961, 1991, 1974, 1984, 3178, 1997, 1988, 1988,
+     1979, 1970, 1988, 1974, 2006, 2044, 2006, 3178, 1980, 1984,
+     1996, 1991, 1983, 1991, 1998, 2005, 1987, 1992, 2022, 1991,
+     2005, 2003, 2001, 2009, 3178, 2009, 1998, 1998, 2006, 2001,
+     2004, 2032, 2004, 2007, 2011, 2022, 2009, 2011, 2011, 2053,
+     2012, 2081, 2015, 2020, 2053, 2032, 3178, 2020, 2026, 2032,
+     2026, 2038, 2029, 2035, 2027, 2051, 2056, 2036, 2032, 2049,
+
+     2039, 2036, 3178, 2055, 2041, 2049, 2039, 2050, 2043, 2049,
+     2049, 3178, 2074, 2050, 2055, 2083, 2053, 2050, 2056, 2081,
+     2053, 2055, 3178, 2069, 2064, 2057, 2072, 2064, 2060, 2061,
+     2063, 2064, 2118, 3178, 2066, 2077, 2068, 2076, 2137, 2131,
+     2137, 2077, 2077, 2129, 2130, 2096, 2119, 2084, 2081, 2081,
+     2082, 2120, 2085, 2137, 2137, 2107, 3178, 2104, 2093, 3178,
+     2120, 2119, 2137, 2119, 3178, 2104, 3178, 2096, 2168, 2098,
+     2100, 2120, 3178, 2124, 2168, 2106, 2124, 3178, 2146, 2125,
+     2115, 2124, 2114, 2119, 3178, 2114, 2146, 2125, 2137, 2137,
+     2126, 2153, 2147, 2124, 2153, 2127, 2147, 3178, 2156, 2146,
+
+     2170, 2132, 2149, 2158, 2156, 2170, 2145, 3178, 2136, 2158,
+     2158, 2153, 2156, 2158, 2142, 2154, 2144, 2148, 2146, 3178,
+     2168, 2148, 2154, 2150, 2154, 2152, 3178, 3178, 2153, 2162,
+     2179, 2156, 2162, 3178, 2199, 2163, 2174, 2170, 2172, 3178,
+     3178, 2170, 3178, 2219, 3178, 2192, 2175, 3178, 3178, 2180,
+     2232, 2181, 2224, 2183, 2180, 2180, 2183, 3178, 2183, 3178,
+     2188, 2194, 2189, 2193, 2221, 2188, 2202, 3178, 2196, 2194,
+     2201, 3178, 2203, 2216, 2219, 2196, 3178, 2201, 2269, 2219,
+     2201, 3178, 2230, 2206, 2209, 2209, 2226, 2212, 2212, 2237,
+     2211, 2215, 2238, 3178, 2238, 2238, 2238, 2238, 2237, 2219,
+
+     2222, 2230, 2230, 2235, 2244, 2237, 2237, 2252, 2247, 2238,
+     2269, 2238, 2238, 2237, 2252, 2269, 2262, 2244, 2262, 2252,
+     2250, 2252, 2252, 2257, 2273, 2264, 2256, 2291, 2259, 2261,
+     2288, 2264, 2273, 2276, 2276, 3178, 2275, 2269, 2270, 2271,
+     2288, 2285, 2285, 2278, 2278, 2283, 3178, 2283, 3178, 2283,
+     2300, 2314, 2311, 3178, 2291, 2300, 2338, 2291, 2325, 2291,
+     2300, 2302, 3178, 2295, 2338, 2325, 2298, 3178, 2325, 2310,
+     2305, 2305, 2318, 2334, 2305, 2337, 2309, 2311, 2310, 2310,
+     2312, 2312, 2337, 2334, 2377, 2316, 2321, 2320, 2320, 2321,
+     2321, 2324, 2391, 2324, 3178, 2353, 3178, 2333, 2353, 2328,
+
+     2355, 2342, 2344, 2355, 2377, 3178, 2355, 2353, 3178, 3178,
+     2382, 2359, 2355, 2340, 2344, 2374, 2351, 2344, 2345, 3178,
+     2374, 2419, 2364, 2351, 3178, 2355, 2355, 2356, 3178, 2364,
+     3178, 2400, 2364, 2378, 2364, 2387, 2366, 2400, 2367, 3178,
+     3178, 3178, 3178, 3178, 2366, 2367, 2370, 2424, 2424, 2372,
+     2445, 2398, 2398, 2379, 2384, 3178, 2379, 3178, 3178, 2387,
+     2387, 2381, 2387, 2450, 2387, 2462, 2386, 2398, 2462, 3178,
+     2416, 2419, 2402, 2402, 2416, 2394, 2403, 2398, 2402, 2417,
+     2417, 2411, 2436, 2445, 2416, 2436, 2415, 2415, 3178, 3178,
+     2424, 2415, 2414, 2415, 2436, 2436, 2482, 2419, 2436, 2437,
+
+     2455, 2462, 2436, 2432, 3178, 2436, 2493, 3178, 2432, 3178,
+     2436, 2436, 2480, 2448, 2437, 2452, 2445, 2452, 3178, 3178,
+     3178, 2467, 2447, 2467, 2460, 2454, 2467, 2452, 2455, 2454,
+     2467, 3178, 2471, 3178, 2523, 2472, 2476, 2463, 2482, 2482,
+     3178, 2476, 2480, 2482, 2476, 2522, 2491, 2502, 2474, 3178,
+     2500, 2491, 3178, 2498, 2478, 2485, 3178, 2484, 2487, 2487,
+     2484, 2500, 3178, 2487, 3178, 2487, 3178, 2523, 2495, 2492,
+     3178, 2523, 2517, 3178, 2526, 2526, 2517, 2504, 2507, 2514,
+     3178, 2513, 3178, 2523, 2526, 2529, 2526, 2517, 2526, 2529,
+     2526, 2514, 2513, 2555, 2522, 2539, 2526, 2536, 3178, 3178,
+
+     2526, 2523, 2535, 2535, 2526, 2539, 2538, 2536, 2530, 3178,
+     3178, 2549, 3178, 2548, 2579, 3178, 2538, 2579, 2543, 2549,
+     2543, 2568, 2555, 2545, 2546, 2548, 2559, 2595, 2559, 2558,
+     2558, 2558, 2558, 2556, 2569, 2568, 2560, 2562, 2568, 2568,
+     2582, 3178, 2575, 2579, 2582, 3178, 2575, 2573, 2575, 2612,
+     3178, 2585, 2638, 2638, 3178, 2612, 2638, 3178, 2638, 2638,
+     2593, 2587, 2598, 2638, 2590, 2591, 2592, 2638, 3178, 3178,
+     2603, 2637, 3178, 3178, 2597, 2623, 2621, 3178, 2638, 2602,
+     3178, 3178, 2667, 2680, 2607, 2638, 2622, 2608, 3178, 2680,
+     3178, 2680, 3178, 2614, 3178, 2620, 2620, 2630, 2624, 2638,
+
+     3178, 2635, 2630, 3178, 2624, 2624, 2629, 2638, 2636, 2628,
+     2635, 3178, 2688, 2635, 2635, 2643, 2641, 2694, 2650, 2641,
+     2688, 2685, 2643, 3178, 2710, 2665, 2671, 3178, 2647, 3178,
+     2667, 2667, 2663, 2653, 2652, 2710, 2654, 2656, 2672, 2662,
+     2710, 2661, 3178, 2662, 2675, 3178, 2694, 3178, 2675, 3178,
+     2735, 2735, 2668, 2735, 2672, 2698, 2687, 2696, 3178, 2699,
+     2687, 2683, 2710, 3178, 2698, 2686, 2696, 2696, 3178, 2709,
+     2696, 2694, 2699, 2697, 2702, 2699, 2709, 2705, 2705, 2733,
+     2708, 2709, 2713, 2710, 2710, 3178, 2727, 2716, 2742, 2756,
+     3178, 3178, 3178, 2785, 2727, 2721, 2723, 2742, 2721, 2722,
+
+     3178, 2738, 2738, 2736, 2783, 2800, 2740, 3178, 2740, 2736,
+     2734, 3178, 2740, 2740, 2738, 2766, 2758, 2740, 2744, 2744,
+     2758, 3178, 2745, 2758, 3178, 3178, 2763, 3178, 2772, 2772,
+     2781, 2772, 2758, 2756, 2760, 2765, 3178, 2760, 2766, 2770,
+     2781, 2773, 2773, 2773, 2783, 2784, 2771, 3178, 2773, 2785,
+     3178, 2776, 3178, 2776, 2802, 2788, 2816, 2783, 2785, 2781,
+     2788, 2802, 3178, 2787, 2787, 2802, 2794, 2789, 3178, 2860,
+     2804, 2795, 2840, 2800, 2798, 2800, 2800, 2802, 3178, 3178,
+     2840, 2804, 3178, 3178, 2807, 2807, 2807, 3178, 3178, 3178,
+     2809, 3178, 2816, 2813, 2813, 2895, 2815, 2895, 2818, 2827,
+
+     3178, 2887, 3178, 2820, 2874, 2839, 3178, 3178, 3178, 2840,
+     2833, 2835, 3178, 2835, 3178, 3178, 2831, 3178, 2832, 2887,
+     2841, 2835, 3178, 2874, 2841, 2839, 2842, 2842, 2922, 2847,
+     2850, 2845, 2858, 2917, 2922, 2877, 2855, 2855, 2871, 2856,
+     2862, 3178, 3178, 2861, 3178, 2864, 3178, 2861, 2861, 2885,
+     2885, 2933, 2885, 2885, 3178, 2885, 2885, 3178, 2921, 2885,
+     2921, 2881, 3178, 3178, 2900, 2885, 2922, 2882, 2881, 2926,
+     2922, 2886, 3178, 3178, 2905, 2891, 2893, 2926, 2905, 3178,
+     2976, 2933, 2906, 2911, 2900, 2905, 2904, 3178, 2922, 3178,
+     2921, 3178, 3178, 3178, 3178, 2910, 3178, 3178, 3178, 3178,
+
+     2976, 3178, 2968, 2914, 2927, 3178, 2919, 2921, 2921, 2946,
+     2983, 3178, 3007, 2926, 2930, 2928, 2929, 2970, 2968, 2939,
+     2975, 2987, 2935, 2967, 2937, 2969, 2939, 2946, 2941, 3178,
+     3178, 2983, 2946, 2948, 2959, 2950, 2970, 2953, 2953, 2965,
+     2962, 2976, 2984, 2984, 3023, 2967, 2982, 2983, 3010, 2984,
+     2972, 2972, 2972, 2989, 2985, 3004, 3178, 2989, 3178, 2979,
+     3178, 3178, 3004, 3018, 2982, 2985, 3047, 3047, 3011, 3003,
+     3020, 3004, 3004, 3178, 3178, 3178, 3025, 3010, 3178, 3011,
+     3009, 3178, 3010, 3015, 3020, 3019, 3019, 3020, 3015, 3015,
+     3178, 3178, 3028, 3021, 3020, 3034, 3029, 3047, 3037, 3029,
+
+     3029, 3029, 3040, 3047, 3034, 3029, 3034, 3178, 3081, 3040,
+     3035, 3040, 3040, 3047, 3040, 3070, 3178, 3064, 3178, 3051,
+     3043, 3044, 3055, 3055, 3070, 3064, 3050, 3070, 3178, 3051,
+     3064, 3055, 3064, 3064, 3084, 3111, 3066, 3063, 3084, 3065,
+     3072, 3111, 3111, 3071, 3084, 3071, 3178, 3072, 3085, 3178,
+     3084, 3084, 3085, 3085, 3099, 3178, 3096, 3085, 3088, 3099,
+     3096, 3111, 3178, 3096, 3096, 3111, 3178, 3097, 3178, 3178,
+     3097, 3103, 3103, 3105, 3105, 3178, 3178,    0
     } ;
 
-static yyconst flex_uint16_t yy_nxt[5715] =
+static yyconst flex_int16_t yy_nxt[4390] =
     {   0,
-       14,   15,   16,   17,   18,   19,   18,   14,   14,   14,
-       14,   14,   18,   20,   21,   22,   23,   24,   25,   26,
-       14,   27,   28,   29,   30,   31,   32,   33,   34,   35,
-       36,   37,   38,   39,   40,   41,   14,   14,   14,   42,
-       44,   45,   46,   44,   45,   46,   49,   50,   49,   50,
-       51,   47,   51,   70,   47,   70,   70,   52,   70,   52,
-       54,   55,   56,   57,   70,   18,   54,   55,   56,   57,
-       71,   18,   58,   60,   61,   62,   71,   82,   58,   60,
-       61,   62,   72,   71,   63,  102,   73,   92,   70,   71,
-       63,   15,   16,   17,   65,   66,   67,   75,   71,   75,
-
-       75,   71,   75,   68,  104,  156,  103,   93,   75,   76,
-      140,  140,   69,   15,   16,   17,   65,   66,   67,   71,
-       71,   83,   77,   78,   71,   68,   79,   71,   84,   87,
-       71,   80,   85,   88,   69,   86,   89,  150,   90,   91,
-       81,   71,   94,   71,   96,   71,   71,  158,   71,  105,
-       98,  112,   97,   99,   71,  109,   95,  106,   71,  110,
-      100,   71,  101,  107,  171,   71,  113,  108,  142,   71,
-      114,  142,  118,   71,  119,  111,  115,   71,  120,  116,
-      139,  150,  123,  147,  147,  124,  117,  162,  121,   71,
-       72,  122,  125,  132,   73,  153,  126,  127,   71,  128,
-
-       71,  129,   71,  133,   71,  136,  155,  134,  135,  137,
-      130,  150,  144,  138,  144,  144,  131,  144,   75,  190,
-       75,   75,  149,   75,  149,  149,   70,  149,   70,   70,
-      152,   70,   71,   75,   71,   75,   75,   70,   75,   71,
-       71,  163,  154,  159,   75,   76,  157,   71,   71,   71,
-      160,   71,   71,  172,   71,   71,   71,   71,  165,   71,
-       71,  182,  164,  161,  166,   71,  167,  168,  169,  174,
-       71,   71,  173,  170,  175,  179,  176,  177,  180,   71,
-       71,  249,  188,  181,  178,  183,   71,   71,   71,  184,
-       71,   71,  185,   71,  193,  191,   71,  199,  194,  196,
-
-       71,  198,   71,  200,  197,  186,  187,  189,   71,  202,
-       71,   71,   71,  201,  195,  192,  206,   71,   71,   71,
-       71,  203,   71,  208,   71,  211,   71,  209,   71,  205,
-      204,   71,  213,   71,  224,  207,  222,  216,   71,  210,
-      212,  214,   71,   71,  221,  217,  218,  215,   71,   71,
-      223,  225,   71,   71,  226,   71,   71,  219,   71,   71,
-      232,  220,   71,   71,  236,  228,  227,  235,   71,  233,
-       71,  229,  231,  239,  230,  237,  140,  140,  148,  142,
-      238,  234,  142,  144,  240,  144,  144,   71,  144,  147,
-      147,  149,  242,  149,  149,   75,  149,   75,   75,  150,
-
-       75,   71,  241,  243,   71,   71,   71,  152,   71,   71,
-       71,   71,  250,   71,  247,   71,  253,   71,  244,  245,
-      246,  248,  256,   71,  255,  252,   71,  251,   71,  257,
-      261,  259,   71,  254,   71,  260,   71,   71,  262,  293,
-       71,  265,  258,  263,   71,  270,  266,   71,   71,   71,
-       71,  267,  275,  272,  273,  276,   71,  268,  269,   71,
-      264,   71,  274,  278,   71,   71,  271,   71,   71,  279,
-      280,   71,   71,   71,   71,  294,  285,  286,  291,  282,
-      281,   71,  283,   71,  277,  296,  284,   71,  287,   71,
-      295,   71,  298,  288,  292,  300,  301,  297,   71,   71,
-
-      304,   71,   71,  299,   71,  289,   71,  290,  306,  305,
-      307,  302,   71,   71,   71,   71,   71,   71,   71,  308,
-      303,  310,   71,   71,  312,   71,  309,   71,   71,   71,
-       71,  314,  316,   71,   71,   71,   71,  311,  315,  317,
-      321,  325,   71,  318,  313,  319,  323,   71,   71,  328,
-       71,   71,  322,  320,   71,   71,  330,   71,  324,  331,
-       71,  332,  333,  334,   71,  336,  326,  327,   71,   71,
-      329,   71,   71,   71,  339,  341,  337,  340,   71,  335,
-       71,   71,  343,   71,   71,  344,  338,   71,   71,  347,
-       71,   71,  150,   71,   71,   71,  367,   71,  350,  342,
-
-      352,  354,  345,  346,  348,   71,  349,   71,  355,  358,
-      356,  351,   71,   71,   71,   71,  353,  357,   71,   71,
-       71,   71,  364,   71,  365,   71,  366,   71,  359,  363,
-       71,   71,  360,  146,  362,   71,  368,  361,  369,   71,
-      371,   71,  374,  370,   71,  372,   71,  373,   71,  375,
-       71,  378,  376,   71,  380,  382,   71,   71,  381,  377,
-       71,   71,   71,   71,  385,   71,  383,  379,  387,   71,
-      386,   71,   71,   71,   71,   71,  392,   71,   71,   71,
-      393,   71,   71,  384,  145,  395,  391,   71,  397,  388,
-      389,   71,  390,   71,  399,  401,  394,  396,   71,   71,
-
-      398,   71,  402,   71,   71,  400,   71,   71,   71,  416,
-      403,   71,  410,  412,   71,   71,  426,  413,   71,  414,
-      404,   71,  411,  405,  421,   71,   71,  418,  406,  407,
-      408,  409,   71,  425,  417,  415,   71,   71,  419,  420,
-      422,  427,   71,  423,  428,   71,  424,  429,   71,  430,
-       71,   71,   71,   71,   71,   71,  432,  437,   71,   71,
-       71,   71,  440,   71,  433,  431,  439,  143,   71,  451,
-      436,   71,  434,  446,  435,   71,  441,  453,  438,   71,
-      442,   71,  444,   71,  445,   71,  443,   71,  447,   71,
-      452,   71,  454,   71,   71,   71,   71,  455,   71,   71,
-
-       71,  448,  466,  456,  449,   71,  450,  457,  467,  481,
-      468,  465,  469,  472,   71,  458,   71,  459,  589,  460,
-      480,   71,  482,   71,  470,  150,   71,  483,   71,  484,
-       71,   71,  461,  486,   71,  462,  490,  463,   71,  464,
-      471,   71,   71,  473,  474,  487,  485,  488,   71,   71,
-      489,   71,  491,  475,  492,  476,  477,  478,  494,   71,
-      479,   71,  493,   71,   71,   71,   71,  502,  495,   71,
-      500,  497,  496,   71,   71,  503,  499,   71,  501,  498,
-       71,  505,  507,   71,   71,   71,  504,   71,   71,  510,
-       71,  506,  511,  512,   71,   71,   71,   71,  517,  509,
-
-       71,  514,   71,  522,  519,  508,  515,  513,  516,   71,
-       71,   71,  524,  520,   71,   71,  518,   71,   71,   71,
-      141,   71,   71,  532,  528,   71,  533,  525,  521,  523,
-      531,  527,  526,  535,  534,  529,   71,  530,   71,   71,
-      536,   71,  537,  539,   71,  538,   71,  541,   71,   71,
-       71,   71,  545,  546,  543,   71,   71,   71,   71,   71,
-      547,  542,   71,  544,  540,   71,   71,  550,   71,  552,
-      548,  551,   71,   71,   71,   71,  556,  553,  549,   71,
-       71,   71,  558,   71,  554,  555,  557,  559,   71,  561,
-       71,   71,  560,   71,  563,  562,   71,  564,   71,  565,
-
-      568,  567,  566,   71,   71,   71,   71,   71,  575,   71,
-       71,  577,   71,   71,   71,  578,  570,   71,  576,   71,
-       71,  574,  584,  569,  571,  573,  572,  579,  580,  582,
-      585,  581,  583,   71,   71,   71,   71,   71,   71,  588,
-       71,   71,  591,   71,   71,  592,   71,  587,  594,   71,
-       71,   71,   71,   71,  586,  608,  593,   71,  590,   71,
-      595,   71,  597,  611,   71,  596,   71,  598,  607,  615,
-      606,  609,  599,  610,  600,   71,  614,   71,   71,   71,
-      601,   71,  602,  612,  618,  603,  604,  613,  617,   71,
-       71,  616,  605,  620,   71,  619,   71,  621,   71,  624,
-
-       71,  626,   71,   71,  622,   71,   71,   71,   71,  623,
-       71,   71,   71,  632,   71,  628,   71,  627,   71,  633,
-      629,  625,  636,  637,  150,  630,  639,  635,  638,  631,
-      634,   71,   71,  641,   71,   71,   71,   71,   71,   71,
-       71,  651,  646,  640,   71,   71,  648,   71,  649,  643,
-       71,  644,  647,  642,  653,  645,  650,   71,   71,  656,
-       71,   71,  652,   71,  655,   71,   71,   71,  659,   71,
-      654,  658,  667,   71,  664,   71,  660,   71,  657,  665,
-       71,  668,   71,  661,  669,  663,  662,   71,  666,  672,
-       71,  670,   71,  671,   71,   71,   71,   71,  673,  674,
-
-       71,   71,  675,   71,  678,   71,  676,   71,  677,   71,
-      679,  682,  683,   71,   71,   71,   71,  684,   71,  688,
-      686,   71,   71,   71,  150,   71,  680,  689,  681,   71,
-       71,   71,  685,  691,  148,  690,  687,   71,  692,   71,
-      695,  694,  693,   71,   71,  699,   71,  696,  697,  698,
-      701,   71,  700,   71,  703,  702,   71,  704,   71,   71,
-       71,   71,  707,  706,   71,  708,   71,   71,   71,   71,
-      715,   71,   71,  711,  713,   71,   71,  709,   71,  705,
-      712,  716,  710,   71,  721,   71,   71,  719,  714,  723,
-       71,  722,  718,   71,  717,  720,  724,   71,   71,   71,
-
-      728,  730,  725,   71,   71,   71,   71,   71,  729,   71,
-      732,   71,  731,  727,  733,   71,  726,  735,   71,  734,
-       71,  739,   71,   71,  736,   71,   71,   71,  742,  743,
-      745,  741,  146,   71,  737,  738,   71,  740,   71,   71,
-      750,  748,   71,  747,  744,  746,  749,   71,   71,   71,
-      751,  752,   71,   71,  754,   71,   71,   71,  760,   71,
-       71,  753,   71,  761,   71,   71,  755,   71,   71,  762,
-       71,  756,   71,  757,   71,  758,   71,  759,   71,   71,
-      763,  766,  764,  769,  767,  768,  765,   71,  770,   71,
-      771,  774,   71,   71,   71,  772,   71,   71,  773,   71,
-
-       71,  782,   71,   71,   71,   71,  783,   71,   71,  776,
-      775,   71,  777,  781,  778,  779,  780,   71,  785,  786,
-       71,   71,  784,  789,  788,  787,   71,   71,  791,  796,
-      790,  792,   71,   71,  793,   71,   71,  794,  795,   71,
-       71,  150,  797,   71,   71,  798,  802,  803,   71,  800,
-       71,   71,  804,  799,   71,  801,   71,   71,  810,   71,
-      806,   71,   71,  811,  805,  813,   71,   71,  816,  807,
-      808,  812,   71,   71,   71,   71,  814,  818,  809,   71,
-      815,   71,  822,   71,   71,   71,   71,  819,   71,   71,
-       71,  823,  817,  824,   71,   71,   71,   71,   71,  821,
-
-       71,  828,  825,  835,  820,  829,  836,  834,  830,  827,
-      826,  837,  833,   71,   71,  831,  842,  838,  832,   71,
-      839,   71,  840,   71,   71,  841,  845,   71,   71,   71,
-       71,   71,   71,  853,  857,   71,   71,  843,  858,   71,
-       71,  860,  867,  859,  844,   71,  846,  847,  854,  848,
-       71,   71,  849,  855,  856,   71,  862,  850,   71,   71,
-      866,   71,  864,  851,  852,  861,  863,   71,   71,   71,
-      868,   71,  865,  869,   71,   71,  873,   71,   71,   71,
-       71,  876,  872,   71,   71,  880,  882,   71,  870,   71,
-      871,   71,  874,  875,  881,  878,  877,  883,   71,   71,
-
-      918,  886,  884,   71,  885,  887,  879,   71,   71,  889,
-       71,   71,   71,  888,   71,   71,  891,  890,   71,   71,
-      892,   71,   71,   71,  898,   71,  893,  895,  896,   71,
-      901,   71,   71,   71,   71,   71,   71,  894,  899,  900,
-       71,   71,  897,  903,  904,  905,   71,   71,   71,  907,
-      906,  902,  908,   71,  911,   71,   71,   71,  910,   71,
-       71,   71,  909,  916,  919,   71,  914,   71,   71,   71,
-      912,  917,  921,   71,   71,  913,   71,   71,   71,   71,
-       71,   71,  920,  915,  929,   71,  927,  145,   71,  922,
-       71,  925,  932,  923,  924,   71,  926,  930,   71,  933,
-
-      931,  928,  936,   71,  935,   71,   71,  934,   71,  937,
-       71,  939,  940,   71,   71,   71,   71,   71,   71,  938,
-       71,  949,   71,  942,  944,  951,   71,   71,  941,   71,
-      943,   71,  953,  955,   71,  945,  950,  947,   71,  946,
-      948,  954,   71,   71,   71,  962,  952,   71,  959,   71,
-      961,   71,   71,  956,  957,  963,   71,   71,  966,   71,
-      968,   71,  958,   71,   71,  960,   71,  971,  150,   71,
-      965,  970,   71,   71,  964,   71,  973,   71,  974,  967,
-       71,  969,   71,   71,  972,   71,   71,  977,   71,   71,
-      989,   71,   71,   71,  978,  975,  990,  992,   71,  980,
-
-      976,   71,   71,  143,   71,  994,  981,  979,  991,  982,
-       71, 1013,   71,  983,   71,  984,  993,  995,  996,  985,
-       71,  986,   71,   71,  999,  997,  987, 1002,  998, 1000,
-       71,  988,   71,   71,   71,   71, 1001,   71, 1004, 1006,
-       71,   71,   71,  141,   71, 1011, 1012, 1003, 1005, 1007,
-     1010,   71,   71, 1015, 1009, 1014,   71,   71, 1008,   71,
-       71, 1017,   71, 1016,   71,   71,   71, 1027,   71, 1026,
-       71, 1030,   71, 1031, 1018,   71, 1019, 1029, 1028,   71,
-     1032, 1020,   71, 1021,   71, 1034, 1036,   71,   71, 1022,
-     1038,   71, 1037, 1033, 1023, 1024,   71,   71,   71, 1042,
-
-     1039, 1025,   71, 1035,   71,   71,   71, 1043,   71,   71,
-     1040, 1041, 1048,   71,   71, 1045,   71, 1046,   71,   71,
-       71, 1051, 1049, 1044,   71, 1047,   71,   71,   71,   71,
-       71,   71,   71, 1050, 1053, 1058, 1056, 1057, 1055, 1052,
-     1060,   71,   71,   71, 1054, 1062,   71, 1059, 1061,   71,
-       71,   71,   71,   71,   71,   71, 1065, 1068, 1069, 1070,
-     1071, 1063, 1064,   71, 1072, 1067, 1073, 1066, 1074,   71,
-     1076,   71,   71,   71, 1078, 1077,   71, 1079,   71,   71,
-       71, 1080,   71, 1086,   71, 1075,   71,   71, 1088,   71,
-     1089, 1082,   71, 1081,   71, 1084,   71,   71, 1083, 1085,
-
-       71, 1091, 1092,   71,   71,   71, 1087,   71, 1094, 1095,
-     1101,   71,   71, 1090,   71, 1100, 1093, 1096, 1097,   71,
-     1099,   71,   71, 1098,   71,   71, 1105, 1104, 1102,   71,
-       71,   71,   71,   71,   71, 1109, 1111, 1112, 1116, 1113,
-     1103,   71,   71,   71,   71,   71, 1110, 1106,   71, 1107,
-     1114, 1108,   71, 1115, 1119,   71,   71, 1121,   71, 1117,
-       71, 1120,   71,   71, 1122,   71,   71,   71, 1125, 1126,
-       71, 1123, 1118,   71,   71,   71, 1131, 1132, 1127,   71,
-       71, 1124,   71,   71, 1134, 1129, 1135,   71, 1128,   71,
-     1133, 1139,   71, 1130,   71,   71,   71,   71,   71, 1136,
-
-       71, 1145,   71, 1137, 1138, 1141,   71,   71,   71,   71,
-     1151,   71, 1140, 1149,   71,   71, 1142, 1166,   71, 1144,
-     1146, 1148, 1147, 1143, 1150, 1153, 1154,   71,   71, 1156,
-       71,   71,   71, 1155, 1152, 1157,   71,   71,   71,   71,
-       71,   71,   71, 1160,   71, 2904,   71,   71, 1163,   71,
-     1158, 1159,   71,   71, 1161,   71,   71, 1164, 1170, 1162,
-     1167, 1172, 1178, 1165, 1169, 1168,   71, 1176,   71,   71,
-     1173,   71, 1174, 1171, 1177, 1175,   71,   71,   71, 1180,
-       71,   71, 1179, 1183,   71,   71, 1182, 1188,   71, 1181,
-     1185,   71, 1186,   71,   71,   71, 1189,   71, 1190, 1184,
-
-     1192, 1193,   71, 1187,   71,   71,   71,   71,   71,   71,
-       71, 1194,   71,   71, 1191, 1200,   71,   71,   71, 1195,
-     1196, 1198, 1199,   71, 1201, 1197,   71,   71,   71, 1202,
-       71, 1206, 1205, 1210, 1203, 1204, 1209,   71, 1207,   71,
-       71,   71, 1211, 1208,   71, 1212, 1214,   71, 1216,   71,
-     1213,   71, 1215, 1217,   71,   71, 1221,   71, 2904, 1230,
-     1229, 1219, 1220, 1218,   71,   71,   71, 1231, 1234, 1222,
-     1228,   71, 1223, 1224,   71,   71, 1232, 1225,   71, 1237,
-       71,   71,   71, 1226, 1233, 1235, 1236, 1227,   71, 1239,
-       71,   71,   71, 1240,   71, 1241,   71,   71,   71,   71,
-
-     1249, 1250, 1246, 1238,   71, 1244,   71,   71,   71, 1251,
-     1243, 1242, 1247,   71, 1245,   71, 1259, 1248,   71, 1252,
-       71, 1258, 1253,   71,   71,   71, 1263, 1254, 1261, 1255,
-       71, 1256, 1265, 1257, 1260,   71,   71, 1266,   71, 1264,
-     1262, 1268,   71,   71,   71,   71,   71,   71,   71,   71,
-       71,   71, 1270, 1275, 1273,   71, 1269, 1267, 1277, 1281,
-       71, 1274,   71, 1271, 1272, 1276,   71, 1280, 1278, 1283,
-       71,   71,   71, 1284,   71, 1285,   71,   71,   71, 1286,
-     1279, 1282, 1289,   71, 1291,   71, 1288,   71, 1292,   71,
-       71,   71, 1296,   71, 1293, 1287,   71,   71, 1290,   71,
-
-     1298,   71,   71,   71,   71, 1302, 1300,   71,   71,   71,
-     1304, 1294, 1295, 1301, 1306,   71, 1297,   71,   71, 1299,
-     1303, 2904, 1307, 1305,   71,   71, 1308,   71, 1311, 1309,
-     1310,   71,   71, 1313,   71,   71, 1312, 1317, 1314, 1318,
-     1320, 1315,   71,   71,   71,   71,   71, 1319, 1316,   71,
-       71, 1324,   71, 1321,   71,   71,   71, 1328, 1329,   71,
-     1331, 1323,   71,   71,   71, 1330,   71,   71, 1322,   71,
-       71,   71,   71, 1338, 1325, 1326, 1332,   71,   71, 1327,
-       71, 1335, 1333,   71, 1336, 1343,   71, 1334, 1342, 1337,
-       71,   71,   71,   71, 1347,   71, 1345, 1339, 1341, 1348,
-
-       71,   71, 1350, 1340,   71,   71,   71,   71,   71, 1352,
-       71, 1346, 1351, 1344,   71, 1356, 1358, 1360, 1357, 1349,
-     1353, 1354, 1359,   71, 1355,   71,   71,   71,   71, 1361,
-       71,   71,   71, 1364,   71,   71, 1366, 1362,   71, 1368,
-       71,   71, 1370,   71, 1373, 1374, 1363,   71, 1365,   71,
-     1367, 1377,   71,   71,   71, 1369, 1371,   71, 1372,   71,
-       71,   71,   71,   71, 1378, 1375,   71, 1384, 1376, 1381,
-     1385, 1386, 1379, 1380,   71, 1382,   71,   71, 1389,   71,
-     1383,   71,   71,   71, 1394, 1388, 2904, 1391, 1393, 1395,
-       71,   71, 1387,   71, 1390,   71,   71, 1396,   71, 1397,
-
-     1398,   71,   71, 1392,   71,   71, 1399, 1402,   71, 1401,
-       71, 1405,   71, 1400,   71, 1404,   71,   71,   71, 1411,
-     1403, 1408, 1407, 1413, 1412,   71,   71,   71, 1414,   71,
-       71, 1409, 1406,   71, 1416,   71, 1419, 1410,   71,   71,
-       71,   71, 1424, 1420,   71,   71, 1415, 1427,   71, 1417,
-     1425,   71,   71,   71, 1418, 1430,   71, 1429, 1421, 1423,
-     1422,   71,   71,   71,   71,   71,   71,   71, 1438,   71,
-     1426, 1428, 2904,   71,   71, 1431, 1439, 1441,   71, 1435,
-       71, 1432, 1433, 1434, 1437, 1442, 1440, 1436,   71,   71,
-       71,   71, 1443,   71,   71,   71, 1447,   71, 1450, 1445,
-
-     1448,   71, 1444,   71, 1446, 1454,   71,   71,   71,   71,
-     1451,   71, 1455, 1449, 1456, 1457,   71, 1452,   71, 1453,
-     1458, 1459, 1462, 1463,   71,   71, 1460,   71,   71,   71,
-       71, 1467,   71, 1468, 1466, 1470,   71,   71, 1461,   71,
-     1471, 1472,   71, 1464,   71,   71,   71,   71, 1465, 1475,
-       71,   71, 1469,   71, 1478,   71,   71,   71,   71, 1477,
-     1473, 1474, 1482,   71, 1484,   71, 1479, 1476,   71,   71,
-       71, 1488, 1483,   71,   71, 1481, 1480,   71,   71,   71,
-     1493,   71, 1491, 1485, 1486,   71,   71, 1489,   71, 1494,
-       71, 1496, 1490, 1487, 1492,   71,   71,   71, 1495, 1498,
-
-     1499,   71, 1501, 1502,   71,   71,   71,   71, 1497,   71,
-       71, 1509,   71,   71, 1500,   71,   71, 1510,   71, 1503,
-     1504, 1507,   71,   71, 1505, 1506,   71, 1513, 1514,   71,
-       71, 1516,   71, 1511, 1508, 1512, 1515, 1517, 1518, 1520,
-     1521,   71, 1519,   71,   71,   71, 1522,   71,   71, 1523,
-       71,   71, 1527,   71, 1524, 1525,   71, 1528,   71,   71,
-       71, 1530, 1532,   71, 1533, 1526,   71, 1529,   71, 1539,
-       71,   71, 1534, 1531, 1536,   71,   71, 1537,   71, 1541,
-       71, 1540,   71, 1542, 1545, 1544, 1535,   71,   71, 1538,
-       71,   71, 1546, 1543,   71, 1547,   71, 1548, 1549, 1553,
-
-       71, 1551,   71,   71,   71, 1550, 1555, 1556, 1557, 1552,
-       71, 1559,   71,   71,   71, 1558,   71,   71, 1562,   71,
-       71, 1561, 1554,   71,   71, 1563,   71,   71,   71,   71,
-     1571,   71,   71,   71,   71, 1560,   71,   71,   71, 1569,
-       71, 1564, 1567, 1568, 1565, 1570, 1566,   71, 1574, 1576,
-       71, 1572, 1578, 1573,   71, 1579,   71,   71, 1575,   71,
-     1577,   71, 1582,   71,   71,   71,   71,   71,   71, 2904,
-     1584, 1580, 1586, 1581,   71, 1583, 1587, 1593, 1585, 1588,
-     1589, 1590, 1594,   71, 1595,   71, 1591,   71,   71,   71,
-     1599,   71, 1598, 1592,   71,   71,   71,   71,   71, 1596,
-
-       71, 1602, 1603,   71,   71, 1611, 1597, 1600,   71,   71,
-       71,   71, 1606,   71, 1601,   71, 1605, 1604, 1608, 1610,
-       71, 1609,   71, 1607, 1612,   71, 1614,   71, 1613,   71,
-       71,   71, 1621, 1615, 1616,   71,   71,   71, 1617, 1618,
-       71, 1625, 1624,   71,   71, 1623,   71,   71, 1620,   71,
-       71, 1622, 1632, 1627, 1619, 1626, 1628, 1633,   71,   71,
-     1635, 1629,   71, 1634, 1639, 1631,   71, 1630, 1636, 1637,
-       71, 1638, 1640,   71,   71, 1644,   71,   71,   71, 1641,
-       71,   71, 1642,   71, 1648,   71, 1646,   71, 1643, 1645,
-       71,   71, 1647, 1649,   71,   71,   71,   71,   71, 1650,
-
-     1653, 1660, 1652, 1658,   71,   71, 1651,   71, 1654, 1655,
-     1661, 1656, 1657,   71,   71,   71,   71,   71, 1662,   71,
-     1667,   71,   71, 1671,   71, 1659,   71,   71, 2904,   71,
-     1666,   71, 1664, 1663, 1665, 1673,   71, 1669,   71,   71,
-     1670, 1668,   71, 1674, 1675,   71,   71, 1672, 1680,   71,
-     1676, 1677, 1678,   71,   71, 1681, 1684,   71,   71,   71,
-       71, 1679,   71,   71,   71, 1682, 1686,   71,   71,   71,
-     1691,   71, 1685, 1683, 1687, 1688,   71, 1694, 1699, 1689,
-     1692, 1695,   71,   71, 1690, 1693, 1696, 1697,   71,   71,
-     1700, 1701,   71,   71, 1698,   71,   71, 1703,   71,   71,
-
-       71, 1704,   71,   71,   71, 1702,   71,   71,   71, 1709,
-       71,   71, 1713,   71,   71, 1710,   71, 1714, 1719, 1705,
-     1707, 1708, 1706, 1711,   71, 1712, 1718,   71,   71, 1717,
-     1715,   71,   71, 1716,   71,   71, 1724, 1720,   71,   71,
-     1727, 1728,   71, 1729,   71, 1731,   71, 1721, 1722,   71,
-     1732, 1723, 1725,   71, 1726, 1730,   71, 1735,   71,   71,
-     1737,   71, 1739, 1736, 1738,   71,   71, 1741,   71,   71,
-     1744,   71,   71,   71, 1733, 1743, 1746, 1734,   71, 1745,
-       71,   71,   71, 1740,   71, 1753,   71, 1755,   71,   71,
-       71,   71, 1756,   71, 1742,   71, 1747, 1748, 1749,   71,
-
-     1751, 1752, 1757, 1750, 1760,   71, 1754, 1758, 1761,   71,
-     1759, 1764, 1765,   71,   71, 1763,   71,   71, 1762,   71,
-     1767,   71,   71, 1770, 1771,   71,   71, 1773,   71,   71,
-       71,   71,   71, 1779,   71, 1778,   71, 1768,   71, 1775,
-     1776,   71, 1766, 1769,   71, 1782, 1772,   71,   71,   71,
-     1785,   71,   71, 1777, 1774,   71, 1783, 1780, 1789, 1781,
-     1788,   71,   71,   71,   71, 1792, 1793,   71, 1787, 1791,
-       71,   71,   71,   71, 1784, 1794,   71, 1786, 1795, 1796,
-       71, 1790,   71, 1797,   71, 1800, 1798,   71,   71, 1803,
-     1804,   71, 1799,   71,   71,   71,   71,   71, 1807, 2904,
-
-       71,   71, 1801,   71,   71, 1813, 1816,   71, 1806,   71,
-     1814, 1805,   71, 1802, 1808, 1809, 1810,   71, 1811, 1812,
-       71, 1815, 1820,   71, 1817,   71,   71,   71, 1818,   71,
-     1821,   71, 1824, 1819, 1827,   71,   71, 1830,   71, 1822,
-       71, 1829,   71, 1831,   71, 1823,   71,   71, 1832, 1825,
-     1828, 1826,   71, 1837,   71, 1833, 1838,   71, 1834, 1839,
-     1841, 1842,   71, 1835, 1840,   71,   71,   71,   71,   71,
-     1846,   71, 1836, 1844,   71,   71,   71,   71, 1848, 1851,
-     1853, 1845,   71, 1847,   71,   71,   71, 1849, 1843,   71,
-       71,   71,   71,   71, 1858,   71, 1854, 1857,   71, 1859,
-
-     1865, 1855, 1850, 2904, 1852, 1860,   71, 1861,   71, 1856,
-     1863,   71,   71, 1862,   71,   71,   71, 1864, 1866,   71,
-     1868,   71, 1869, 1867,   71, 1871,   71,   71,   71,   71,
-     1875,   71,   71, 1870, 1874,   71,   71, 1876, 1872, 1873,
-     1877, 1878, 1879,   71,   71,   71,   71,   71,   71,   71,
-     1886, 1884, 1880, 1881, 1885,   71,   71,   71, 1888,   71,
-       71, 1892, 1887, 1882,   71, 1883,   71,   71, 1891, 1889,
-       71,   71,   71, 1890, 1899, 1893, 1894, 1896, 1898,   71,
-       71,   71, 2904, 1897,   71, 1904,   71,   71, 1895,   71,
-     1906,   71,   71,   71, 1907,   71, 1900, 1901,   71, 1902,
-
-     1903, 1908,   71, 1909, 1905, 1910,   71, 1912,   71,   71,
-       71,   71,   71, 1911,   71,   71,   71, 1913,   71,   71,
-       71, 1920, 1915, 1916, 1917, 1924,   71,   71,   71, 2904,
-     1914, 1919, 1923,   71, 1921,   71, 1927, 1925, 1922,   71,
-     1918,   71,   71,   71, 1928, 1931, 1930, 1926, 1929,   71,
-       71, 1935,   71, 1932, 1933,   71,   71, 1934,   71,   71,
-     1939,   71,   71, 1941, 1937, 1943,   71,   71, 1938,   71,
-     1936,   71,   71, 1946, 1945,   71, 1942, 1947, 1940,   71,
-     1948,   71, 1951,   71,   71,   71,   71,   71,   71, 1952,
-       71,   71,   71, 1944, 1954, 2017, 1953, 1949, 1957,   71,
-
-     1961, 1950,   71, 1958, 1955, 1956,   71, 1959,   71,   71,
-     1960, 1963,   71, 1962, 1966,   71,   71,   71,   71, 1968,
-     1964,   71, 1969,   71,   71, 1970, 1973,   71, 1965, 1967,
-       71, 1975, 1971,   71,   71, 1972, 1976,   71,   71, 1977,
-       71,   71,   71, 1980,   71, 1978, 1979, 1981, 1974,   71,
-     1985,   71,   71, 1982,   71,   71,   71,   71, 1984,   71,
-       71, 1983, 1986,   71,   71, 1994,   71,   71, 1989,   71,
-     1987, 1988, 1990,   71, 1995, 1991, 1992,   71,   71, 1993,
-       71, 2003, 1996, 1997, 1999, 2002, 2005,   71,   71, 2000,
-       71, 2007,   71,   71,   71, 2001, 1998, 2004, 2009, 2006,
-
-       71,   71, 2012, 2014, 2015, 2010,   71, 2013,   71,   71,
-       71,   71, 2008,   71, 2011,   71, 2016, 2019,   71,   71,
-     2020, 2024,   71, 2026, 2023,   71, 2018,   71, 2025, 2028,
-       71,   71,   71, 2030, 2021,   71, 2029, 2031,   71,   71,
-     2033,   71,   71, 2027, 2032, 2022,   71,   71,   71,   71,
-     2035, 2034, 2036,   71, 2038,   71,   71,   71, 2044,   71,
-     2041,   71,   71,   71,   71, 2039, 2037, 2045, 2040, 2047,
-       71,   71,   71, 2043, 2042,   71, 2046, 2051,   71, 2054,
-       71,   71, 2049,   71,   71,   71,   71,   71, 2048, 2055,
-     2050, 2052,   71, 2053,   71,   71,   71, 2065,   71,   71,
-
-       71,   71, 2056, 2057, 2066,   71, 2060, 2062, 2058,   71,
-     2059, 2064, 2067, 2061, 2068, 2063,   71, 2070, 2069, 2071,
-       71, 2072,   71,   71, 2073,   71, 2075,   71,   71, 2078,
-       71,   71, 2079,   71,   71,   71, 2074, 2076, 2080,   71,
-     2077, 2084,   71, 2085,   71, 2087,   71, 2083,   71, 2089,
-       71, 2081,   71, 2904, 2082,   71, 2092,   71, 2086,   71,
-     2091, 2093,   71,   71,   71,   71, 2088, 2090,   71,   71,
-     2099,   71, 2095, 2094, 2098, 2101,   71,   71, 2096,   71,
-       71,   71, 2105, 2104, 2097, 2103,   71, 2100, 2107,   71,
-       71,   71, 2111,   71,   71, 2102,   71, 2106,   71,   71,
-
-     2116,   71,   71, 2115,   71, 2108, 2109,   71,   71, 2110,
-     2120,   71,   71, 2114, 2112,   71,   71, 2125,   71, 2113,
-       71, 2117, 2118, 2119, 2121, 2122, 2123,   71,   71, 2126,
-     2127,   71,   71,   71,   71,   71,   71, 2130, 2131,   71,
-       71, 2124,   71, 2129, 2135,   71,   71, 2128, 2133,   71,
-     2137, 2138, 2140,   71, 2142,   71,   71, 2134,   71, 2132,
-       71, 2143,   71, 2141, 2139,   71, 2136, 2144, 2146,   71,
-       71,   71, 2147,   71, 2148,   71,   71, 2153, 2145, 2149,
-     2150, 2154, 2151,   71,   71,   71, 2159,   71, 2155, 2152,
-       71, 2158,   71,   71, 2157,   71, 2156,   71, 2160,   71,
-
-       71, 2166,   71,   71,   71,   71, 2161,   71,   71,   71,
-       71, 2164, 2168, 2162, 2167, 2163, 2165, 2169,   71,   71,
-     2170, 2172, 2171,   71, 2174,   71, 2173, 2214, 2175, 2189,
-     2176, 2177,   71,   71, 2178, 2179,   71,   71,   71, 2182,
-     2180, 2183,   71, 2181, 2904,   71,   71,   71, 2184,   71,
-       71, 2186,   71,   71, 2190,   71, 2185,   71, 2187, 2191,
-     2192, 2193,   71,   71,   71,   71, 2188,   71, 2194, 2198,
-       71, 2197,   71, 2195,   71,   71,   71, 2200,   71,   71,
-       71,   71, 2207, 2204,   71, 2196, 2206, 2199,   71,   71,
-     2208, 2212, 2203,   71,   71, 2201, 2202,   71,   71, 2211,
-
-     2205,   71,   71, 2216,   71,   71, 2213, 2209, 2217, 2210,
-       71, 2219,   71, 2221,   71, 2215, 2220, 2223,   71,   71,
-       71, 2225,   71,   71,   71,   71, 2222,   71,   71, 2224,
-     2218,   71,   71, 2229, 2233,   71, 2231, 2232, 2227, 2234,
-       71, 2226, 2235, 2228,   71, 2236,   71,   71,   71,   71,
-       71, 2230,   71,   71, 2239, 2242,   71, 2244,   71, 2243,
-       71,   71, 2237,   71,   71, 2241, 2247,   71,   71, 2238,
-     2254, 2240,   71, 2250,   71, 2246, 2245, 2251,   71, 2252,
-     2248,   71, 2249,   71,   71,   71, 2253,   71, 2259,   71,
-     2260,   71, 2258, 2261,   71, 2262,   71, 2255, 2256,   71,
-
-       71,   71,   71, 2266,   71, 2257, 2265,   71, 2267,   71,
-       71, 2263,   71, 2272,   71,   71, 2268,   71, 2264, 2274,
-       71, 2269, 2275,   71,   71,   71,   71,   71, 2271, 2277,
-     2270,   71, 2278,   71, 2273, 2276, 2281,   71, 2279, 2284,
-       71,   71,   71,   71,   71,   71,   71, 2280,   71,   71,
-     2285,   71, 2291, 2282,   71,   71,   71, 2283, 2288, 2293,
-       71,   71, 2290, 2287, 2292, 2302,   71, 2295, 2286, 2294,
-     2289,   71,   71,   71, 2298, 2299,   71, 2300, 2296, 2303,
-       71, 2301,   71, 2297,   71, 2304,   71, 2305,   71, 2306,
-       71, 2307,   71, 2308,   71,   71,   71,   71,   71,   71,
-
-     2317,   71, 2318,   71,   71, 2314,   71, 2321,   71, 2309,
-       71,   71, 2310, 2311,   71, 2320, 2312, 2313, 2315, 2316,
-     2322, 2323,   71,   71,   71,   71, 2319,   71, 2324,   71,
-     2326,   71, 2325, 2332,   71, 2333,   71,   71, 2334, 2327,
-       71,   71,   71, 2328,   71, 2329,   71, 2330, 2331,   71,
-     2904, 2338,   71, 2343,   71, 2335, 2336, 2341,   71, 2337,
-     2342,   71, 2339, 2344, 2345,   71,   71,   71,   71, 2340,
-       71,   71,   71,   71,   71,   71, 2347, 2351,   71,   71,
-       71,   71, 2349, 2355, 2372, 2346,   71, 2348, 2356,   71,
-     2360, 2350, 2358, 2352, 2353,   71, 2357,   71, 2354, 2359,
-
-       71, 2362, 2363,   71,   71,   71,   71, 2367,   71,   71,
-     2361, 2369,   71,   71, 2371,   71,   71, 2364, 2374,   71,
-       71, 2368,   71, 2375,   71, 2365, 2366,   71, 2373, 2377,
-       71,   71, 2370, 2904,   71,   71,   71, 2378, 2382,   71,
-     2379, 2385, 2376, 2380, 2381,   71, 2383, 2384,   71,   71,
-     2386,   71,   71,   71,   71,   71, 2388, 2904,   71,   71,
-     2389,   71, 2392, 2387, 2391,   71, 2394, 2397,   71,   71,
-     2395,   71, 2390, 2393, 2396, 2398,   71,   71, 2399,   71,
-     2403,   71, 2400,   71,   71, 2405,   71, 2401, 2404,   71,
-     2408,   71, 2409,   71, 2407,   71, 2406, 2402, 2411,   71,
-
-       71, 2413, 2904, 2412,   71,   71, 2414,   71, 2410, 2415,
-     2416, 2417,   71,   71,   71,   71, 2418,   71, 2419,   71,
-       71,   71,   71, 2420,   71, 2423,   71, 2422,   71, 2425,
-     2421, 2426,   71, 2424, 2427,   71,   71, 2428,   71,   71,
-     2429,   71, 2434,   71, 2430,   71,   71, 2432, 2433, 2431,
-       71,   71, 2435, 2439,   71,   71,   71,   71, 2443,   71,
-       71,   71,   71,   71, 2436, 2441, 2437, 2447,   71, 2438,
-     2440, 2473, 2442, 2450, 2444, 2445, 2448,   71, 2451,   71,
-     2452, 2446, 2453,   71,   71,   71,   71, 2449,   71,   71,
-       71,   71,   71, 2454, 2455, 2458,   71, 2456,   71, 2461,
-
-     2462,   71,   71, 2457, 2463,   71, 2459, 2464,   71, 2465,
-       71, 2460, 2467,   71,   71, 2470,   71, 2468,   71, 2471,
-       71,   71, 2466, 2472,   71,   71, 2477,   71,   71, 2474,
-       71, 2478,   71, 2469, 2479,   71, 2481,   71,   71, 2475,
-       71, 2485,   71, 2480,   71, 2476, 2487,   71, 2486,   71,
-     2483, 2482, 2488,   71, 2484,   71,   71, 2489,   71, 2494,
-       71,   71, 2493,   71,   71,   71, 2498, 2490, 2496, 2497,
-       71, 2499,   71, 2491,   71, 2492,   71, 2500,   71, 2502,
-       71,   71,   71, 2509,   71, 2495, 2505,   71,   71,   71,
-     2904,   71, 2515,   71,   71, 2503, 2504, 2501, 2506, 2511,
-
-     2512, 2508, 2507,   71, 2516, 2513,   71, 2510, 2514,   71,
-     2517,   71, 2518,   71, 2519,   71,   71,   71,   71,   71,
-     2523, 2521,   71, 2527,   71,   71,   71, 2524, 2528, 2530,
-       71, 2520,   71,   71, 2532,   71,   71, 2522,   71, 2525,
-     2531, 2533, 2526,   71, 2529, 2534,   71, 2535,   71,   71,
-     2538,   71, 2536, 2539,   71, 2540,   71, 2537, 2541, 2543,
-       71,   71, 2547,   71, 2544,   71,   71,   71,   71,   71,
-     2546, 2542,   71, 2545,   71,   71, 2549, 2554,   71,   71,
-     2550, 2552,   71,   71, 2548,   71, 2555, 2557,   71, 2559,
-     2558,   71,   71,   71, 2551, 2553,   71, 2561, 2569, 2556,
-
-     2560,   71, 2562, 2564,   71, 2563, 2565,   71, 2566,   71,
-       71,   71, 2571, 2568, 2575,   71, 2570,   71,   71, 2567,
-     2572,   71, 2573, 2574,   71,   71,   71, 2579,   71,   71,
-     2577, 2581,   71,   71,   71,   71, 2585,   71,   71,   71,
-       71,   71, 2576,   71, 2578, 2588,   71,   71, 2582, 2583,
-       71, 2586, 2587, 2580,   71, 2584, 2589,   71, 2592, 2590,
-     2595,   71, 2593, 2597,   71, 2591, 2594, 2598,   71,   71,
-     2600,   71,   71, 2596,   71,   71,   71, 2605,   71, 2604,
-       71,   71,   71,   71, 2609,   71,   71,   71, 2601,   71,
-     2599, 2602, 2603,   71, 2611, 2613,   71, 2614,   71, 2610,
-
-     2606, 2608, 2616,   71, 2607,   71,   71, 2615, 2612,   71,
-       71, 2621,   71, 2620,   71, 2619, 2618,   71, 2625,   71,
-       71,   71, 2617, 2626, 2623,   71, 2627,   71, 2622, 2630,
-     2624, 2631,   71, 2628, 2629,   71,   71, 2633,   71, 2632,
-       71,   71,   71,   71, 2638, 2634, 2635, 2636,   71,   71,
-       71, 2641,   71, 2642,   71, 2645,   71, 2637, 2644, 2643,
-     2646,   71,   71,   71,   71, 2639, 2640, 2647,   71, 2649,
-     2650,   71, 2651,   71, 2652,   71,   71, 2648, 2654,   71,
-       71, 2653,   71,   71,   71, 2659,   71, 2655, 2660,   71,
-       71,   71,   71, 2664,   71,   71, 2666, 2667,   71,   71,
-
-     2661, 2663, 2656,   71, 2657, 2658, 2668,   71, 2669, 2671,
-     2662,   71,   71, 2670, 2665,   71, 2674,   71,   71,   71,
-     2673,   71,   71, 2672, 2675,   71,   71, 2678,   71,   71,
-       71,   71, 2680,   71,   71,   71, 2681, 2679, 2676,   71,
-       71, 2677,   71, 2693,   71,   71, 2904, 2690, 2682, 2686,
-     2683, 2684, 2685, 2694,   71, 2691, 2687, 2688, 2692,   71,
-       71, 2689,   71, 2695, 2696,   71, 2697,   71, 2698, 2699,
-       71,   71, 2700, 2701, 2704,   71, 2702, 2703, 2706,   71,
-     2705,   71,   71,   71, 2709,   71,   71, 2710, 2708,   71,
-       71,   71,   71, 2711, 2712,   71, 2707,   71, 2713,   71,
-
-     2717, 2718,   71,   71, 2716,   71, 2714, 2719,   71,   71,
-     2715,   71, 2720, 2724, 2721, 2726,   71,   71, 2725,   71,
-     2722,   71, 2730, 2723,   71,   71, 2729,   71, 2727, 2731,
-       71, 2728, 2733,   71, 2848, 2734, 2735,   71, 2736,   71,
-     2737,   71, 2738,   71, 2732, 2739,   71, 2740,   71, 2741,
-       71, 2742,   71,   71, 2744,   71,   71,   71,   71, 2747,
-       71,   71, 2743,   71,   71, 2751,   71, 2753,   71,   71,
-       71,   71, 2748, 2755, 2749, 2750, 2745, 2746,   71, 2757,
-       71, 2752,   71, 2760,   71, 2759,   71, 2754,   71,   71,
-       71,   71,   71, 2762,   71, 2767,   71, 2756, 2758,   71,
-
-     2761, 2768,   71, 2763, 2769,   71,   71, 2765, 2764, 2766,
-       71,   71,   71, 2774, 2772, 2771,   71,   71,   71, 2770,
-     2778,   71, 2777,   71, 2780,   71,   71, 2776,   71,   71,
-       71, 2773,   71,   71,   71, 2775, 2779,   71, 2781, 2791,
-       71,   71,   71,   71, 2875, 2782, 2783,   71, 2784, 2786,
-       71, 2787, 2792, 2788, 2785, 2789,   71, 2790, 2793,   71,
-       71, 2794, 2795,   71, 2796,   71, 2797,   71,   71,   71,
-     2798, 2799, 2800,   71, 2801,   71, 2804,   71, 2807,   71,
-       71, 2802,   71, 2809,   71,   71,   71,   71, 2803, 2805,
-     2812,   71,   71, 2813,   71, 2814, 2816, 2806,   71, 2808,
-
-     2810, 2817,   71,   71, 2811,   71,   71,   71, 2821,   71,
-       71,   71, 2818, 2815, 2824,   71, 2819,   71,   71,   71,
-       71,   71, 2826,   71, 2820, 2823, 2822,   71, 2831,   71,
-       71,   71, 2828, 2829, 2832, 2825, 2836, 2827, 2835,   71,
-     2830, 2837,   71, 2838,   71, 2833,   71,   71,   71, 2834,
-       71, 2839, 2843, 2840,   71, 2841, 2845,   71,   71, 2844,
-       71,   71,   71, 2842, 2846,   71, 2851,   71,   71,   71,
-       71, 2854,   71, 2855,   71,   71,   71,   71,   71,   71,
-     2847, 2849, 2853, 2858, 2850, 2856, 2852, 2859, 2857,   71,
-     2861,   71, 2862,   71, 2860,   71, 2866,   71, 2863,   71,
-
-     2868,   71, 2864,   71, 2869, 2865, 2870,   71,   71, 2873,
-       71,   71,   71,   71, 2871,   71, 2867, 2874, 2876,   71,
-     2877,   71, 2878,   71, 2882,   71, 2880, 2872,   71,   71,
-     2879,   71,   71,   71, 2884,   71, 2885,   71, 2888, 2889,
-       71,   71, 2881,   71, 2892, 2893,   71, 2883,   71, 2895,
-       71, 2886, 2887,   71, 2890, 2894, 2896,   71,   71,   71,
-     2891,   71,   71, 2904, 2898, 2897, 2899, 2902,   71, 2903,
-       71, 2904, 2900, 2904, 2904, 2904, 2904, 2904, 2904, 2904,
-     2904, 2901,   43,   43,   43,   43,   43,   43,   43,   48,
-       48,   48,   48,   48,   48,   48,   53,   53,   53,   53,
-
-       53,   53,   53,   59,   59,   59,   59,   59,   59,   59,
-       64,   64,   64,   64,   64,   64,   64,   74,   74, 2904,
-       74,   74,   74,   74,  140,  140, 2904, 2904, 2904,  140,
-      140,  142,  142, 2904, 2904,  142, 2904,  142,  144, 2904,
-     2904, 2904, 2904, 2904,  144,  147,  147, 2904, 2904, 2904,
-      147,  147,  149, 2904, 2904, 2904, 2904, 2904,  149,  151,
-      151, 2904,  151,  151,  151,  151,   75,   75, 2904,   75,
-       75,   75,   75,   13, 2904, 2904, 2904, 2904, 2904, 2904,
-     2904, 2904, 2904, 2904, 2904, 2904, 2904, 2904, 2904, 2904,
-     2904, 2904, 2904, 2904, 2904, 2904, 2904, 2904, 2904, 2904,
-
-     2904, 2904, 2904, 2904, 2904, 2904, 2904, 2904, 2904, 2904,
-     2904, 2904, 2904, 2904
+       13,   14,   15,   16,   17,   18,   19,   18,   14,   14,
+       14,   14,   14,   18,   20,   21,   22,   23,   24,   25,
+       26,   14,   27,   28,   29,   30,   31,   32,   33,   34,
+       35,   36,   37,   38,   39,   40,   41,   42,   14,   14,
+       43,   13,   44,   44,   45,   46,   47,   44,   44,   44,
+       44,   44,   44,   44,   44,   48,   44,   44,   44,   44,
+       44,   44,   44,   44,   44,   44,   44,   44,   44,   44,
+       44,   44,   44,   44,   44,   44,   44,   44,   44,   44,
+       44,   44,   13,   49,   49,   50,   51,   49,   49,   52,
+       49,   49,   49,   49,   49,   49,   53,   49,   49,   49,
+
+       49,   49,   49,   49,   49,   49,   49,   49,   49,   49,
+       49,   49,   49,   49,   49,   49,   49,   49,   49,   49,
+       49,   49,   49,   13,   54,   55,   56,   57,   58,   54,
+       18,   54,   54,   54,   54,   54,   54,   59,   54,   54,
+       54,   54,   54,   54,   54,   54,   54,   54,   54,   54,
+       54,   54,   54,   54,   54,   54,   54,   54,   54,   54,
+       54,   54,   54,   54,   13,   60,   60,   61,   62,   63,
+       60,   60,   60,   60,   60,   60,   60,   60,   64,   60,
+       60,   60,   60,   60,   60,   60,   60,   60,   60,   60,
+       60,   60,   60,   60,   60,   60,   60,   60,   60,   60,
+
+       60,   60,   60,   60,   60,   13,   65,   15,   16,   17,
+       66,   67,   68,   65,   65,   65,   65,   65,   65,   69,
+       65,   65,   65,   65,   65,   65,   65,   65,   70,   65,
+       65,   65,   65,   65,   65,   65,   65,   65,   65,   65,
+       65,   65,   65,   65,   65,   65, 3178, 3178, 3178, 3178,
+     3178, 3178, 3178, 3178, 3178, 3178, 3178, 3178, 3178, 3178,
+     3178, 3178, 3178, 3178, 3178, 3178, 3178, 3178, 3178, 3178,
+     3178, 3178, 3178, 3178, 3178, 3178, 3178, 3178, 3178, 3178,
+     3178, 3178, 3178, 3178, 3178, 3178, 3178,   13,   71, 3178,
+     3178, 3178, 3178,   71, 3178,   71,   71,   71,   71,   71,
+
+     3178,   72,   71,   71,   71,   71,   71,   71,   71,   71,
+       71,   71,   71,   71,   71,   71,   71,   71,   71,   71,
+       71,   71,   71,   71,   71,   71,   71,   71,   13,   84,
+       73,  105,  106,  107,   74,   13,   75,   76, 3178,   76,
+       76,   75,   76,   75,   75,   75,   75,   75,   76,   77,
+       75,   75,   75,   75,   75,   75,   75,   75,   75,   75,
+       75,   75,   75,   75,   75,   75,   75,   75,   75,   75,
+       75,   75,   75,   75,   75,   75,   13,   78,   78, 3178,
+       78,   78,   78,   78,   78,   78,   78,   78,   78,   78,
+       78,   78,   78,   78,   78,   78,   78,   78,   78,   78,
+
+       78,   78,   78,   78,   78,   78,   78,   78,   78,   78,
+       78,   78,   78,   78,   78,   78,   78,   79,   80,  117,
+       85,   81,   94,   96,   98,  123,   82,   86,   99,   89,
+      146,   87,  100,   90,   88,   83,   91,   97,   92,   93,
+      101,  108,   95,  102,  113,  109,  147,  118,  114,  110,
+      103,  119,  104,  166,  124,  111,  168,  120,  125,  112,
+      121,  135,  115,  136,  116,  169,  128,  122,  126,  129,
+      130,  127,  137,  139,  170,   13,  131,  156,  138,  171,
+      132,  133,  172,  140,  173,  143,  134,  141,  142,  144,
+      176,  177,  178,  145,   13,  148,  148, 3178, 3178, 3178,
+
+      148,  148,  148,  148,  148,  148,  148,  148,  149,  148,
+      148,  148,  148,  148,  148,  148,  148,  148,  148,  148,
+      148,  148,  148,  148,  148,  148,  148,  148,  148,  148,
+      148,  148,  148,  148,  148,   13,  150,  150, 3178,  150,
+      150,  150,  150,  150,  150,  150,  150,  150,  150,  150,
+      150,  150,  150,  150,  150,  150,  150,  150,  150,  150,
+      150,  150,  150,  150,  150,  150,  150,  150,  150,  150,
+      150,  150,  150,  150,  150,  150,   13,  151,  151, 3178,
+     3178,  151,  151, 3178,  151,  151,  151,  151,  151,  151,
+      152,  151,  151,  151,  151,  151,  151,  151,  151,  151,
+
+      151,  151,  151,  151,  151,  151,  151,  151,  151,  151,
+      151,  151,  151,  151,  151,  151,  151,   13,  153,  153,
+     3178,  153,  153,  153,  153,  153,  153,  153,  153,  153,
+      153,  153,  153,  153,  153,  153,  153,  153,  153,  153,
+      153,  153,  153,  153,  153,  153,  153,  153,  153,  153,
+      153,  153,  153,  153,  153,  153,  153,  153,   13,  154,
+     3178, 3178, 3178, 3178,  154, 3178,  154,  154,  154,  154,
+      154,  154,  155,  154,  154,  154,  154,  154,  154,  154,
+      154,  154,  154,  154,  154,  154,  154,  154,  154,  154,
+      154,  154,  154,  154,  154,  154,  154,  154,  154,   13,
+
+      157,  157, 3178,  157,  157,  157,  157,  157,  157,  157,
+      157,  157,  157,  157,  157,  157,  157,  157,  157,  157,
+      157,  157,  157,  157,  157,  157,  157,  157,  157,  157,
+      157,  157,  157,  157,  157,  157,  157,  157,  157,  157,
+       13,  158,  158, 3178, 3178, 3178,  158,  158,  158,  158,
+      158,  158,  158,  158,  159,  158,  158,  158,  158,  158,
+      158,  158,  158,  158,  158,  158,  158,  158,  158,  158,
+      158,  158,  158,  158,  158,  158,  158,  158,  158,  158,
+      158,   13,  160,  160, 3178,  160,  160,  160,  160,  160,
+      160,  160,  160,  160,  160,  160,  160,  160,  160,  160,
+
+      160,  160,  160,  160,  160,  160,  160,  160,  160,  160,
+      160,  160,  160,  160,  160,  160,  160,  160,  160,  160,
+      160,  160,   13,  161, 3178, 3178, 3178, 3178,  161, 3178,
+      161,  161,  161,  161,  161,  161,  162,  161,  161,  161,
+      161,  161,  161,  161,  161,  161,  161,  161,  161,  161,
+      161,  161,  161,  161,  161,  161,  161,  161,  161,  161,
+      161,  161,  161,   13,  163,   76, 3178,   76,   76,  163,
+       76,  163,  163,  163,  163,  163,  163,  164,  163,  163,
+      163,  163,  163,  163,  163,  163,  163,  163,  163,  163,
+      163,  163,  163,  163,  163,  163,  163,  163,  163,  163,
+
+      163,  163,  163,  163,   13,  165,  165, 3178,  165,  165,
+      165,  165,  165,  165,  165,  165,  165,  165,  165,  165,
+      165,  165,  165,  165,  165,  165,  165,  165,  165,  165,
+      165,  165,  165,  165,  165,  165,  165,  165,  165,  165,
+      165,  165,  165,  165,  165,   13,   76,   76, 3178,   76,
+       76,   76,   76,   76,   76,   76,   76,   76,   76,   76,
+       76,   76,   76,   76,   76,   76,   76,   76,   76,   76,
+       76,   76,   76,   76,   76,   76,   76,   76,   76,   76,
+       76,   76,   76,   76,   76,   76,   13,  167,  167, 3178,
+      167,  167,  167,  167,  167,  167,  167,  167,  167,  167,
+
+      167,  167,  167,  167,  167,  167,  167,  167,  167,  167,
+      167,  167,  167,  167,  167,  167,  167,  167,  167,  167,
+      167,  167,  167,  167,  167,  167,  167,  174,  179,  182,
+      183,  184,  185,  186,  180,  188,  181,  189,  190,  191,
+      175,  193,  194,  195,  196,  197,  192,  198,  199,  203,
+      205,  200,  187,  206,  213,  208,  211,  214,  215,  209,
+      216,  212,  217,  218,  201,  202,  219,  220,  221,  222,
+      223,  224,  225,  207,  204,  210,  226,  227,  228,  229,
+      230,  234,  231,  235,  239,  236,  240,  241,  242,  232,
+      243,  246,  247,  248,  249,  233,  237,  250,  252,  253,
+
+      238,  256,  257,  258,  259,  260,  261,  244,  254,  262,
+      245,  264,  265,  268,  269,  274,  275,  251,  276,  277,
+      255,   13,  263,  263, 3178,  263,  263,  263,  263,  263,
+      263,  263,  263,  263,  263,  263,  263,  263,  263,  263,
+      263,  263,  263,  263,  263,  263,  263,  263,  263,  263,
+      263,  263,  263,  263,  263,  263,  263,  263,  263,  263,
+      263,  263,  266,  270,  272,  273,  279,  278,  282,   71,
+      271,  283,  284,  280,  293,   71,  281,  267,   71,   71,
+      285,  288,  294,  295,  296,  286,  289,  297,  298,  299,
+      301,  290,  302,  303,  304,  305,  306,  291,  292,  307,
+
+      308,  309,  287,  310,  311,  315,  316,  317,  318,  312,
+      319,  322,  320,  323,  324,  325,  326,   71,  300,  329,
+      330,  313,  331,  314,  321,  332,  333,  334,  336,  335,
+      337,  327,   71,  338,   71,  340,  341,  342,   71,  343,
+       71,  344,  345,  346,  328,  347,  348,  349,  350,  351,
+      352,  339,  353,  354,  355,  356,  357,  358,  359,  360,
+      361,  362,  363,  364,  365,  366,  367,  368,  369,  370,
+      371,  373,  374,   71,  377,  378,  379,   71,  380,  381,
+      382,   71,  383,  384,  385,  386,  387,  388,  389,  375,
+       71,  376,  390,  391,  372,  392,  393,  394,   71,  396,
+
+      397,  398,  395,  399,  400,  401,  402,  403,  404,  405,
+       71,  406,  407,  408,  409,  410,  411,  412,  413,  414,
+      416,  417,  418,  419,  420,  421,   71,   71,  424,  425,
+      426,  427,  428,  429,  430,  431,  415,  432,  433,  434,
+      435,  436,  442,  443,  437,  444,  423,  448,  449,  438,
+      439,  440,  441,  422,  445,  450,  446,  451,  452,  453,
+      454,  455,  456,  457,  459,  460,  458,  461,  462,   71,
+      463,   71,  447,  464,  465,  466,  467,   71,  469,  470,
+      471,  472,  473,  474,  475,  476,  477,  479,  468,  480,
+      482,  481,  478,  483,  487,  488,  489,  491,   71,  502,
+
+      503,  496,  504,  497,  492,  505,  484,  506,  507,  485,
+      493,  486,  490,  508,  494,  510,  498,  518,  519,  499,
+      522,  500,  495,  501,  511,  512,  520,   71,  524,  509,
+      525,  521,  523,  526,  513,  527,  514,  515,  516,  528,
+      529,  517,   71,  531,  532,  533,   71,  536,  537,  538,
+      539,  540,  541,  542,  543,  534,  530,  544,  545,  546,
+       71,   71,  549,  552,  535,  550,  551,  553,  548,  554,
+      555,  556,  559,   71,  558,   71,  547,  561,  562,  563,
+      564,   71,  566,  567,  568,  571,  572,  560,  573,  557,
+      574,  575,  576,  577,  578,  569,  579,  570,  580,  581,
+
+      582,  583,  584,  585,  586,  565,  587,   71,  588,  589,
+      590,  591,  592,  594,  595,  596,  597,  598,  599,  600,
+      593,  602,  601,   71,  603,  604,  605,  606,  607,  608,
+      609,   71,  611,  612,  610,  613,  614,  616,  615,  617,
+      618,  619,  620,  621,  622,  623,  624,  626,  627,  625,
+      628,  629,  631,  632,  633,   71,  635,  636,  637,  638,
+      639,   71,  634,  641,  642,  643,  651,  652,  640,  653,
+      644,  654,  645,  655,  656,  630,  657,  658,  646,  660,
+      647,  659,  661,  648,  649,  662,  663,  664,  665,  667,
+      650,  668,   71,  670,  671,   71,  673,  674,  675,  666,
+
+      672,  677,  678,  679,  676,  680,  681,  682,  683,   71,
+      669,  685,  686,  687,  684,  688,  689,  690,  691,  692,
+      693,   71,  695,  696,   71,  694,  698,  699,  700,  701,
+      702,  703,  697,   71,  704,  705,  706,   71,  707,  708,
+      709,  712,  715,  713,  716,  717,  718,  710,  714,  719,
+      711,  720,  721,   71,  723,  724,  725,  726,  727,  728,
+      729,  730,  731,  732,  733,  735,  736,  737,  738,  739,
+      740,  741,  742,  745,  746,  747,  748,  743,  734,  749,
+      722,  744,  750,  751,  752,  753,  754,  755,   71,  757,
+      758,  759,  760,  761,  762,  763,  764,  765,  766,  767,
+
+      768,  769,  770,  771,  772,  773,   71,  774,   71,  756,
+      776,  775,  777,  778,  779,  780,  781,  782,  783,  784,
+      785,  786,  787,  789,  790,  791,  792,  788,  793,  794,
+      795,  796,  797,  798,  800,  801,  802,  803,  805,   71,
+      807,  808,  804,  809,   71,  810,  811,  812,  799,  813,
+      814,  815,  816,  817,   71,  818,  819,  820,  821,  822,
+      806,  823,  824,  825,  826,  827,  828,  829,  830,  831,
+      832,  833,  834,  835,  836,  837,  838,  839,  840,  841,
+      842,   71,  844,  845,  846,  847,  848,  850,  849,  851,
+      852,  853,  854,  855,  856,  857,  858,  859,  843,   71,
+
+      860,  861,  862,  863,  864,  865,  866,  867,  868,   71,
+       71,  871,  873,  874,  875,  870,  876,  877,  878,  872,
+      879,  880,  881,  882,   71,  869,  884,  885,  886,  887,
+      888,  893,  895,  896,  889,   71,   71,  890,  883,  897,
+      894,  898,  899,  900,  891,  901,  902,  892,  903,  904,
+      905,  906,  907,  913,  908,  914,  915,  909,  916,  917,
+      918,  919,  910,  920,  921,  922,  923,  924,  911,  912,
+      925,  926,  927,  928,  929,  930,  931,  932,   71,  933,
+      934,  935,  936,  937,  938,  939,  940,   71,  942,  943,
+      944,  945,  947,  948,  949,  950,  946,  951,  952,  953,
+
+      941,  954,  955,  956,  957,  958,  959,  960,  961,  962,
+      963,  964,  965,  966,  967,  968,  969,  970,  971,  972,
+      973,  974,  975,  976,  977,  978,  979,  980,   71,  982,
+      984,  981,  985,  986,   71,  988,  989,  983,  990,  991,
+      992,  993,  994,   71,  996,  997,  998,  999,  987, 1000,
+     1001, 1002, 1003, 1004,  995, 1005, 1006, 1007, 1008, 1009,
+     1010, 1011, 1012, 1013, 1014, 1015, 1016, 1017, 1018, 1020,
+     1021, 1022, 1023, 1024, 1025, 1026, 1027, 1029, 1030, 1019,
+     1031,   71, 1033, 1034, 1028, 1035,   71, 1037, 1038, 1032,
+     1036, 1039, 1040, 1041, 1042, 1043, 1044, 1045, 1046, 1047,
+
+     1048, 1049, 1050,   71, 1052, 1053, 1054, 1061, 1055, 1062,
+     1056, 1063, 1064,   71, 1057, 1066, 1058, 1067, 1065, 1068,
+     1069, 1059, 1070, 1071, 1073, 1051, 1060, 1074, 1072, 1075,
+     1076, 1078, 1079, 1080, 1081, 3178, 1083, 1084, 1085, 1086,
+     1077, 1087, 1082, 1088, 1089, 1090, 1091,   71, 1099, 1100,
+     1101, 1092,   71, 1093, 1102, 1103,   71, 1105, 1098, 1094,
+     1104, 1106, 1107, 1108, 1095, 1096, 1109, 1110, 1111, 1112,
+     1113, 1097, 1114,   71, 1116, 1117, 1118,   71, 1120,   71,
+     1121, 1119, 1122, 1123, 1124,   71, 1125, 1126, 1127, 1128,
+     1129, 1130, 1115, 1131, 1132,   71, 1134, 1135, 1136, 1137,
+
+     1138, 1139, 1140, 1141, 1142, 1143, 1144, 1145, 1146, 1147,
+     1148, 1133, 1149, 1150, 1151, 1152, 1153, 1155, 1157, 1158,
+     1156, 1154, 1159, 1160, 1161, 1162, 1163, 1164, 1165, 1166,
+     1167,   71, 1169, 1170, 1171, 1172, 1173, 1174, 1175, 1176,
+     1177, 1178, 1179, 1180, 1181, 1182, 1183, 1184, 1185, 1186,
+     1187, 1168, 1188, 1189, 1190, 1191, 1192, 1193, 1194, 1195,
+     1196, 1197, 1198,   71, 1199, 1200, 1201, 1202, 1203, 1204,
+     1205, 1206, 1207, 1208, 1209, 1210, 1211, 1212,   71, 1213,
+     1214, 1215, 1216, 1217, 1218, 1219, 1220, 1221, 1222, 1223,
+     1224, 1225,   71, 1227, 1228, 1229, 1230, 1231, 1232, 1233,
+
+     1234, 1226, 1235, 1236, 1237, 1238,   71, 1239, 1240, 1241,
+     1242, 1243,   71, 1244, 1245, 1246,   71, 1248, 1249, 1250,
+     1247, 1251, 1252, 1253,   71, 1255, 1256, 1260, 1261, 1262,
+     1263, 1264, 1265, 1266, 1267, 1257, 1254, 1258, 1268, 1269,
+     1259, 1270, 1271, 1272, 1273, 1274, 1275, 1276, 1277, 1278,
+     1279, 1280, 1281, 1282, 1283, 1284, 1285, 1286,   71, 1287,
+     1288, 1289,   71, 1290, 1291, 1292, 1293, 1294, 1295, 1296,
+     1297, 1298, 1299, 1300, 1301, 1302, 1304, 1305,   71,   71,
+     1303, 1307, 1308, 1314, 1315, 1309, 1310, 1316, 1317, 1318,
+     1311, 1319, 1320, 1321, 1322, 1323, 1312, 1324, 1306, 1325,
+
+     1313, 1326, 1328, 1327, 1329, 1330, 1331, 1332, 1333, 1334,
+     1335, 1336, 1337, 1338, 1339, 1340, 1341, 1342, 1347,   71,
+     1348, 1350, 1343, 1351, 1344, 1349, 1345,   71, 1346, 1352,
+     1353, 1354,   71, 1357, 1358, 1359, 1355, 1360, 1361, 1356,
+     1362, 1363, 1364, 1365, 1366, 1367, 1368,   71, 1370, 1371,
+       71, 1373, 1369, 1374, 1375, 1372, 1376, 1377,   71, 1378,
+     1379, 1380, 1381, 1382, 1383, 1384, 1385, 1386, 1387, 1388,
+     1389, 1390,   71, 1391, 1392, 1393, 1394, 1395, 1396, 1397,
+     1398, 1399, 1400,   71, 1402,   71, 1403, 1404, 1405, 1406,
+     1407, 1408,   71,   71, 1409,   71, 1411, 1412, 1413, 1414,
+
+     1415, 1416, 1417,   71, 1410, 1418, 1419, 1420,   71, 1422,
+     1423, 1424, 1401, 1425, 1426, 1421, 1427, 1428, 1430, 1431,
+       71, 1433, 1434, 1429, 1435, 1432,   71, 1437, 1438, 1439,
+     1440, 1441, 1442, 1443, 1445, 1446, 1447, 1448, 1444, 1449,
+     1450, 1452, 1454, 1451, 1453, 1455, 1456, 1457, 1458, 1459,
+       71, 1461, 1462, 1463, 1464, 1465, 1466, 1436, 1467, 1468,
+     1469, 1470, 1471,   71, 1472, 1473, 1474, 1475, 1476, 1477,
+     1478, 1460, 1479, 1480, 1481, 1482, 1483, 1484, 1485, 1486,
+     1487, 1488,   71, 1489,   71, 1490, 1491, 1492, 1493, 1494,
+     1495, 1496, 1497, 1498, 1499, 1500, 1501, 1502, 1503, 1504,
+
+     1505, 1506, 1507, 1508, 1509, 1511, 1513, 1514, 1515, 1510,
+     1512, 1516, 1517, 1518, 1519, 1520, 1521, 1522, 1523, 1524,
+     1525, 1526, 1527, 1528, 1529, 1530, 1531, 1532, 1533, 1534,
+     1535, 1536, 1537, 1538, 1539, 1540, 1541, 1542, 1543, 1544,
+     1545, 1546, 1547,   71,   71, 1548,   71, 1551, 1552, 1549,
+       71, 1554, 1555, 1556, 1557, 1558, 1559, 1560, 1561, 1562,
+     1563, 1553, 1550, 1564, 1565, 1566, 1567, 1568, 1569, 1570,
+     1571, 1572, 1573, 1574, 1575, 1576, 1577, 1578, 1579, 1580,
+     1581, 1582, 1583, 1584, 1585, 1586, 1587, 1588, 1589, 1590,
+     1591, 1592,   71, 1594, 1595, 1596, 1597, 1598, 1599, 1600,
+
+     1601, 1602, 1603,   71,   71, 1606, 1607, 1608, 1609, 1610,
+     1604, 1611, 1612, 1615, 1605, 1613, 1614, 1616, 1617, 1618,
+     1619, 1620, 1621, 1593, 1622, 1623, 1624, 1625,   71, 1626,
+     1627, 1628, 1629, 1630, 1631, 1632, 1633,   71, 1635, 1636,
+     1637, 1638, 1639, 1640, 1641, 1642, 1643,   71, 1644, 1647,
+     1648, 1645, 1649, 1650, 1651, 1652, 1634, 1653, 1654, 1655,
+     1656, 1657, 1658, 1646, 1659, 1660,   71, 1661, 1662, 1663,
+     1664, 1665, 1666, 1667,   71, 1669, 1670, 1668, 1671, 1672,
+     1673, 1674, 1675, 1676, 1677, 1678, 1679, 1680, 1681, 1682,
+     1683, 1684,   71, 1685, 1686, 1687, 1688, 1689, 1690, 1691,
+
+     1692, 1693, 1694, 1695, 3178, 1697,   71, 1702, 1698, 1700,
+     1703, 1704, 1696, 1705, 1701, 1706, 1699, 1707, 1708, 1709,
+     1710, 1711, 1712, 1713, 1714, 1716,   71, 1717, 1718, 1719,
+     1720, 1721, 1723, 1724, 1722, 1715, 1726, 1727, 1728, 1729,
+     1730, 1731, 1732, 1733, 1734, 1735, 1736, 1737, 1725, 1738,
+     1739, 1740, 1742, 1744, 1745, 1743, 1746, 1747, 1748, 1750,
+     1751, 1752, 1753, 1749, 1754, 1741, 1755, 1756, 1757, 1758,
+     1760, 1761, 1759, 1762, 1763, 1764, 1766, 1767, 1768, 1769,
+     1770, 1765, 1771,   71, 1772, 1773, 1774, 1775, 1776, 1777,
+     1779, 1780, 1781, 1782, 1783, 1784, 1785, 1786, 1787, 1788,
+
+       71, 1790, 1791, 1789, 1792, 1793, 1795, 1794, 1796, 1797,
+     1798, 1778,   71, 1799,   71, 1801, 1802,   71, 1803, 1800,
+     1804, 1805, 1806, 1807, 1808, 1810,   71,   71, 1809, 1811,
+     1812, 1813, 1814, 1815, 1816, 1817, 1818, 1819, 1820, 1821,
+     1822, 1823, 1824, 1825, 1826, 1827, 1828, 1829, 1830, 1831,
+     1832, 1833,   71, 1834, 1835, 1836, 1837, 1839, 1840, 1841,
+     1842, 3178,   71, 1844, 1845, 1846, 1847, 1850, 1848, 1838,
+     1849, 1851, 1852, 1853, 1854, 1855, 1856, 1857, 1858, 1859,
+     1860, 1861, 1862, 1843, 1863, 1864,   71, 1865, 1866,   71,
+     1868, 1869, 1870, 1871, 1877, 1872, 1873, 1874, 1878, 1879,
+
+     1867, 1875, 1876, 1880, 1881, 1883, 1884,   71, 1886, 1882,
+       71, 1887, 1888, 1889, 1890, 1891,   71, 1893, 1894, 1895,
+     1896, 1897, 1898, 1899, 1885, 1900, 1901, 1902, 1903, 1904,
+     1905, 1906, 1907, 1908, 1909, 1910, 3178, 1892, 1912, 1913,
+     1914, 1915, 1916, 1917, 1911,   71, 1919, 1918, 1920, 1921,
+     1922, 1923, 1924, 1925, 1926, 1927, 1928,   71,   71, 1931,
+     1932, 1933, 1934, 1935, 1936, 1937, 1938, 1930, 1939, 1941,
+     1942, 1943, 1944,   71, 1946, 1947, 1948, 1949, 1950, 1951,
+     1952, 1954, 1929, 1945, 1940, 1953, 1955, 1956,   71, 1957,
+     1958, 1959, 1960, 1961,   71, 1962, 1963, 1964, 1965, 1966,
+
+     1967, 1968, 1969, 1971, 1972, 1973, 1974, 1970,   71, 1976,
+     1978, 1979, 1980, 1981, 1977, 1975, 1982, 1983, 1984, 1985,
+     1986, 1987,   71, 1989,   71, 1991, 1993,   71, 1994, 1995,
+     1996, 1997, 1998, 1999, 2000, 2001, 2002, 2003, 2004, 1990,
+     1992, 2005, 2006, 2007, 2008, 2009, 2010, 2011, 2012, 2013,
+     2014, 2015, 2016, 1988, 2017, 2018, 2019, 2020, 2021, 2022,
+     2023, 2024, 2025, 2026, 2027, 2029, 2030, 2031, 2032,   71,
+     2033,   71, 2035, 2036, 2037, 2028, 2038, 3178, 2040,   71,
+       71, 2042, 2043,   71, 2045, 2047, 2041, 2046, 2034, 2048,
+       71, 2049, 2050, 2051, 2039, 2052, 2053, 2054, 2055, 2056,
+
+     2057, 2058,   71, 2060, 2061, 2063, 2044, 2064, 2065, 2066,
+     2067, 2068, 2069, 2070, 2071, 2072, 2059, 2062, 2073, 2074,
+     2075, 2076, 2077, 2078, 2079, 2080, 2081, 2082, 2083, 2084,
+     2085, 2086, 2087, 2088, 2089, 2090, 2091, 2092, 2093, 2094,
+     2095, 2096, 2097, 2098, 2099, 2100, 2101, 2102, 2103, 2104,
+     2105, 2106, 2107, 2108, 2109, 2110, 2112, 2113, 2114, 2115,
+     2116, 2117, 2118, 2111, 2120, 2119, 2121, 2122, 2124, 2125,
+     2126, 2127, 2123, 2128, 2129, 2130, 2131, 2132, 2133, 2134,
+     2135, 2136, 2137,   71, 2139, 2140, 2141, 2142, 2143, 2144,
+     2145, 2146, 2147, 2148, 2138, 2149, 2151,   71, 2153,   71,
+
+     2154, 3178, 2152, 2156, 2157, 2158, 2159, 2160, 2150, 2161,
+     2162,   71, 2163, 2164, 2165, 2166, 2168, 2169, 2170, 2171,
+     2167, 2172, 2173, 2174, 2177,   71, 2178, 2155, 2179, 2180,
+     2181, 2182, 2183, 2184,   71, 2185, 2186, 2175, 2187, 2188,
+     2189, 2190, 2191, 2192, 2193, 2194, 2195, 2196, 2176, 2197,
+     2198, 2199, 2200, 2201, 3178, 2203, 2204, 2205, 2206, 2207,
+     2208, 2209, 2210, 2211, 2212,   71, 2214,   71, 2216, 2217,
+     2215, 2218, 2219, 2220, 2221, 2222, 2224,   71, 2225, 2226,
+     2227, 2202, 2223, 2228, 2213, 2229, 2230, 2231, 2232, 2234,
+     2235, 2233, 2236, 2237, 2238, 2239, 2240, 2241, 2242, 2243,
+
+     2244, 2245, 2246, 2247, 2248, 2249, 2250,   71, 2252,   71,
+     2254, 2251, 2253, 2255, 2256, 2257, 2258, 2259, 2260, 2261,
+     2262, 2263,   71, 2265, 2264, 2266, 2268, 2269, 2270, 2271,
+     2272, 2273, 2274, 2275, 2276, 2277, 2278, 2279, 2280, 2281,
+     2267, 2282, 2283, 2284, 2285, 3178, 2287, 2288, 2289,   71,
+     2290, 2292, 2293, 2294, 2295, 2296,   71,   71, 3178, 2300,
+       71, 2301, 2302, 2303, 2304, 2305, 2307, 2291, 2297, 2298,
+     2308, 2309, 2286, 2310, 2311, 2312, 2313, 2314, 2315, 2306,
+     2299, 2316, 2317, 2318, 2319, 2320, 2321, 2322, 2323, 2324,
+       71, 2325, 2326, 2327, 2328, 2329, 2330, 2332,   71, 2333,
+
+     2335, 2336, 2337, 2338, 2331, 2339, 2340, 2341, 2342, 2343,
+     2344, 2334, 2345, 2346, 2347, 2348, 2349, 2350, 2351, 2352,
+     2353, 2354, 2355, 2356, 2357, 2358, 2359, 2360, 2361, 2362,
+     2363, 2364, 2365, 2366, 2367, 2368, 2369, 2370, 2371, 2372,
+     2373, 2374, 2375, 2376, 2377, 2378, 2379,   71, 2381, 2382,
+     2383, 2384,   71, 2385, 2386, 2387, 2388, 2389,   71, 2391,
+     2392,   71, 2380, 2393,   71, 2394, 2395, 2396, 2397, 2398,
+     2399, 2400, 2401, 2402, 2403, 2404, 2405, 2407, 2408, 2409,
+     2390, 2406, 2410, 2411, 2412, 2413, 2414, 2415,   71, 2417,
+     2418, 2419, 2420, 2421, 2422, 2423, 2424, 2425, 2426, 2427,
+
+       71, 2428, 2430, 2431, 2432, 2416, 2429, 2433, 2434, 2435,
+     2436, 2437, 2438, 2439, 2440, 2441, 2442, 2443, 2444, 2445,
+     2446, 2447, 2448, 2449, 2450, 2451, 2452, 2453, 2454, 2455,
+     2456, 2457, 2458, 2459, 2460,   71, 2461, 2462, 2463, 2464,
+     2465, 2466, 2467, 2468, 2469, 2470, 2471, 2472,   71, 2474,
+       71, 3178,   71, 2477, 2478, 2479, 2480, 2481, 2482,   71,
+     3178,   71, 2483, 2486, 2485, 2475, 2487, 2488, 2489, 2473,
+     2490, 2476, 2484, 2491, 2492, 2493, 2494, 2495, 2496, 2497,
+     2498, 2499, 2500, 2501, 2502, 2503, 2504, 2505, 2506, 2507,
+     2508, 2509, 2510, 2511, 2512, 2513, 2514, 2515, 2516, 2517,
+
+     2518, 2519, 2520, 2521, 2522, 2523, 2524, 2525, 2526, 3178,
+     2527, 2528, 2529, 2530, 2531, 2532, 2533,   71, 2534, 2535,
+     2536, 2537, 2538, 2539, 2540, 2541, 2542, 2543, 2544, 2545,
+       71, 2546, 2547, 2548, 2549, 2550, 2551, 2552, 2553, 3178,
+     2555, 2556, 2557, 2558, 2554, 2559, 2560, 2563,   71, 2561,
+     2562, 2564, 2565, 2566, 2567, 2568, 2569, 2570, 2571, 2572,
+     3178, 2574, 2575, 2576, 2577, 2578, 2579,   71,   71, 2580,
+     2581, 2582, 2583, 2584, 2585, 3178, 2587, 2588, 2589, 2590,
+     2591, 2592, 2593, 2573, 2586, 2594, 2595, 2596, 2597, 2598,
+     2599, 2600, 2601, 2602,   71, 2603, 2604, 2605, 2606, 2607,
+
+     2608, 2609, 2610, 2611, 2612, 2613, 2614, 2615, 2617, 2618,
+     2619, 2620, 2616, 2621, 2622, 2623, 2624, 2625, 2626, 2627,
+     2628, 2629, 2630, 2631, 2632, 2633, 2634, 2635, 2636, 2637,
+     2638, 3178, 2640, 2641, 2642, 2643, 2644, 2645, 2646, 2647,
+     2648, 2649, 2650, 2651,   71, 2653, 2654, 2655, 2656, 2657,
+     2658, 2659, 2639, 2660, 2661, 2662, 2663, 2664, 2665,   71,
+     2667, 2668, 2669, 2670, 2652, 2671, 2666, 2672, 2673, 2674,
+     2675, 2676, 2677, 2679, 2680, 2681, 2682, 2678, 2683, 2684,
+     2685, 2686, 2687, 2688, 2689, 2690, 2691, 2692, 2693, 2694,
+     2695, 2696, 2697, 2698, 2699, 2700, 2701, 2702, 2703,   71,
+
+     2706, 2707, 2705, 2704, 3178, 2709, 2710, 2711, 2712, 2713,
+     2714, 2708, 2715, 2716, 2717, 2718, 2719, 2720, 2721, 2722,
+     2723, 2724, 2725, 2726, 2727, 2729, 2730, 2731, 2732, 2728,
+     2733, 2734,   71, 2735, 2736, 2737, 3178, 2739, 2740, 2741,
+     2742, 2743, 2744, 2745, 2746,   71, 2748, 2749, 2750, 2751,
+     2752, 2747, 2753, 2754, 2755, 2757, 2758, 2756, 2759, 2760,
+     2761, 2762, 2763, 2738, 2765, 2766, 2767, 2764, 2768, 2769,
+     2770, 2771, 2772, 2773, 2774, 2775, 2776, 2777, 2778, 2779,
+     2780, 2781,   71, 2783,   71, 2784, 2785, 2786, 2787,   71,
+     2788, 2789, 2791, 2792, 2790, 2782, 2793, 2794, 2795, 2796,
+
+     2797, 2798, 2799, 2800, 2801, 2802, 2803, 2804, 2805, 2806,
+     2807, 2808, 2809, 2810, 2811, 2812, 2813, 2814, 2815, 2816,
+     3178, 2818, 2819,   71, 2820, 2821, 2822, 2823, 2824, 2825,
+     2826, 2827, 2828, 2829, 2830, 2831, 2832, 2817,   71, 2833,
+     2834, 2835, 2836,   71, 2837, 2838,   71, 2840, 2841,   71,
+     2843, 2844, 2845, 2846, 2842, 2848, 2839,   71, 2847, 2849,
+     2850, 2851, 2852, 2853, 3178, 2856, 2857, 2858, 2859, 2860,
+     2861, 2862, 2863, 2864, 2865, 2866, 2855,   71, 2867, 2868,
+     2869, 2870, 2871, 2854, 2872, 2873, 2874, 2875, 2876, 2877,
+     2878,   71, 2879, 2880, 2881, 2882, 2883, 2884, 2885, 2886,
+
+     2887, 2888, 2889, 2890, 2891, 2892, 2893, 2894, 2895, 2896,
+     2897, 2898, 2899,   71, 2900, 2901, 2902, 2903, 2904, 2905,
+     2906, 2907, 2908, 2909, 2910, 2911, 2912, 2913, 2914, 2915,
+     2916, 2917, 2918, 2919, 2920, 2921, 2922,   71, 2923, 2924,
+     2925, 2926, 2927, 2928,   71, 2930, 2931, 2929, 2932, 2933,
+     2934,   71, 2936, 2937,   71, 2939, 2940, 2938, 2942, 2941,
+     2943, 3178, 2945, 2946, 2935,   71, 2944, 2947, 2948, 2949,
+     3178, 2950, 2951,   71, 2953, 2954, 2955, 2956, 2957, 2958,
+     2959, 2960, 2961, 2962, 2963, 2964,   71, 2967, 2966, 2968,
+     3178, 2970, 2952, 2971, 2972, 2973, 2974, 2975, 2976, 2981,
+
+     2979, 2977, 2965,   71, 2978, 2980, 2969,   71, 2982, 2983,
+     2984, 2985, 2986, 2987, 2988, 2989, 2990, 2991, 2992, 2993,
+     2994, 2995, 2996, 2997, 2998, 2999, 3000, 3001, 3002, 3003,
+     3004, 3005, 3006, 3007, 3008, 3009, 3010, 3011, 3012, 3013,
+     3178,   71, 3016,   71, 3014, 3017, 3018, 3019, 3020, 3021,
+     3022, 3023, 3178, 3015, 3025, 3026,   71, 3028, 3027, 3029,
+     3030, 3031,   71, 3033, 3035, 3034, 3036, 3037, 3039, 3024,
+       71,   71, 3178, 3041, 3042, 3040, 3043, 3044, 3032, 3045,
+     3046, 3038,   71, 3048,   71, 3050, 3051, 3052, 3053, 3054,
+     3055, 3056, 3047, 3057, 3058, 3059, 3060, 3061, 3062, 3063,
+
+     3049, 3064, 3065, 3066, 3067, 3068, 3069, 3070,   71, 3071,
+     3072, 3073, 3074, 3075, 3076, 3077, 3078, 3079, 3080, 3081,
+     3082, 3083,   71, 3085, 3086, 3087, 3088, 3089, 3090, 3091,
+     3092, 3093, 3094, 3095, 3096, 3097, 3084, 3098, 3099, 3100,
+     3101, 3102, 3103, 3104, 3105, 3106, 3107, 3108, 3109, 3110,
+     3111, 3112, 3113, 3114, 3115, 3116, 3117, 3118, 3119, 3120,
+     3121, 3122, 3123,   71, 3124, 3125, 3126, 3127, 3128, 3129,
+       71, 3132, 3133, 3134, 3130, 3135, 3136, 3131, 3137, 3138,
+     3178, 3140, 3141, 3142, 3143, 3144, 3145, 3146, 3147, 3148,
+     3149, 3150, 3151, 3152, 3153, 3154,   71, 3155, 3156, 3157,
+
+     3158, 3159, 3160, 3161, 3162, 3163, 3164, 3139, 3165, 3166,
+     3167, 3168, 3169, 3170, 3171, 3172, 3173, 3174, 3175, 3176,
+     3177,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0, 3178, 3178,
+     3178, 3178, 3178, 3178, 3178, 3178, 3178, 3178, 3178, 3178,
+     3178, 3178, 3178, 3178, 3178, 3178, 3178, 3178, 3178, 3178,
+     3178, 3178, 3178, 3178, 3178, 3178, 3178, 3178, 3178, 3178,
+     3178, 3178, 3178, 3178, 3178, 3178, 3178, 3178, 3178
     } ;
 
-static yyconst flex_int16_t yy_chk[5715] =
+static yyconst flex_int16_t yy_chk[4390] =
     {   0,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        3,    3,    3,    4,    4,    4,    5,    5,    6,    6,
-        5,    3,    6,   20,    4,   20,   20,    5,   20,    6,
-        7,    7,    7,    7,   20,    7,    8,    8,    8,    8,
-       29,    8,    7,    9,    9,    9,   22,   22,    8,   10,
-       10,   10,   15,   25,    9,   29,   15,   25, 2910,   31,
-       10,   11,   11,   11,   11,   11,   11,   19,   79,   19,
-
-       19,   30,   19,   11,   31,   79,   30,   25,   19,   19,
-       47,   47,   11,   12,   12,   12,   12,   12,   12,   21,
-       23,   23,   21,   21,   24,   12,   21,   81,   23,   24,
-       34,   21,   23,   24,   12,   23,   24,  971,   24,   24,
-       21,   26,   26,   27,   27,   90,   28,   81,   32,   32,
-       28,   34,   27,   28,   33,   33,   26,   32,   36,   33,
-       28,   35,   28,   32,   90,   42,   35,   32,   52,   84,
-       35,   52,   36,   37,   37,   33,   35,   38,   37,   35,
-       42,   69,   38,   63,   63,   38,   35,   84,   37,   40,
-       72,   37,   38,   40,   72,   69,   38,   38,   39,   39,
-
-      102,   39,   78,   40,   41,   41,   78,   40,   40,   41,
-       39,  149,   58,   41,   58,   58,   39,   58,   66,  102,
-       66,   66,   68,   66,   68,   68,   71,   68,   71,   71,
-       66,   71,   85,   74,   80,   74,   74,   71,   74,   77,
-       82,   85,   77,   82,   74,   74,   80,   83,   86,   88,
-       83,   89,   87,   91,   93,   92,   98,   95,   87,   91,
-       96,   98,   86,   83,   87,   94,   87,   88,   88,   92,
-      159,   99,   91,   89,   93,   95,   94,   94,   96,   97,
-      105,  159,  101,   97,   94,   99,  100,  106,  101,  100,
-      103,  104,  100,  107,  104,  103,  108,  107,  104,  105,
-
-      109,  106,  110,  108,  105,  100,  100,  101,  111,  110,
-      112,  113,  114,  109,  104,  103,  114,  115,  116,  117,
-      119,  111,  121,  116,  118,  118,  122,  116,  120,  113,
-      112,  124,  120,  127,  127,  115,  125,  121,  126,  117,
-      119,  120,  125,  123,  124,  122,  123,  120,  128,  129,
-      126,  127,  130,  131,  127,  134,  132,  123,  133,  135,
-      133,  123,  137,  136,  135,  129,  128,  134,  138,  133,
-      139,  130,  132,  138,  131,  136,  141,  141,  147,  143,
-      137,  133,  143,  145,  139,  145,  145,  154,  145,  148,
-      148,  150,  154,  150,  150,  151,  150,  151,  151,  153,
-
-      151,  156,  153,  155,  160,  157,  158,  151,  161,  155,
-      162,  163,  160,  164,  158,  165,  163,  167,  155,  156,
-      157,  158,  166,  191,  165,  162,  168,  161,  166,  166,
-      170,  168,  178,  164,  169,  169,  170,  172,  171,  191,
-      171,  172,  167,  171,  173,  173,  172,  174,  175,  176,
-      177,  172,  178,  175,  176,  179,  182,  172,  172,  180,
-      171,  179,  177,  180,  181,  183,  174,  184,  185,  181,
-      182,  186,  187,  189,  190,  192,  186,  187,  189,  184,
-      183,  192,  184,  196,  179,  194,  185,  188,  188,  193,
-      193,  194,  195,  188,  190,  197,  198,  194,  195,  199,
-
-      200,  197,  198,  196,  201,  188,  200,  188,  202,  201,
-      203,  198,  204,  205,  202,  206,  203,  207,  208,  204,
-      199,  206,  209,  210,  208,  211,  205,  212,  214,  215,
-      213,  210,  212,  216,  218,  217,  220,  207,  211,  213,
-      217,  221,  219,  214,  209,  215,  219,  221,  222,  223,
-      224,  225,  218,  216,  227,  223,  225,  226,  220,  226,
-      230,  227,  228,  229,  232,  231,  222,  222,  228,  229,
-      224,  231,  233,  234,  234,  236,  232,  235,  235,  230,
-      239,  236,  237,  238,  240,  238,  233,  242,  237,  240,
-      243,  244,  241,  246,  260,  245,  260,  257,  243,  236,
-
-      245,  247,  238,  239,  241,  249,  242,  247,  248,  251,
-      249,  244,  250,  252,  248,  251,  246,  250,  253,  254,
-      255,  256,  257,  259,  258,  263,  259,  267,  252,  256,
-      258,  266,  253,  146,  255,  261,  261,  254,  262,  264,
-      264,  262,  267,  263,  265,  265,  268,  266,  269,  268,
-      270,  271,  269,  272,  273,  275,  274,  271,  274,  270,
-      273,  275,  276,  277,  277,  278,  276,  272,  279,  280,
-      278,  282,  281,  283,  279,  284,  284,  285,  286,  288,
-      285,  287,  290,  276,  144,  287,  283,  289,  289,  280,
-      281,  291,  282,  292,  291,  293,  286,  288,  295,  294,
-
-      290,  293,  294,  297,  298,  292,  301,  309,  299,  301,
-      295,  296,  297,  299,  300,  303,  309,  300,  308,  300,
-      296,  302,  298,  296,  305,  305,  307,  303,  296,  296,
-      296,  296,  310,  308,  302,  300,  304,  306,  304,  304,
-      306,  310,  312,  307,  311,  311,  307,  312,  313,  313,
-      314,  315,  316,  317,  318,  319,  315,  320,  321,  327,
-      329,  322,  323,  320,  316,  314,  322,  142,  323,  329,
-      319,  324,  317,  327,  318,  325,  324,  331,  321,  326,
-      325,  336,  326,  331,  326,  328,  325,  332,  328,  330,
-      330,  335,  332,  337,  333,  338,  444,  333,  339,  342,
-
-      345,  328,  336,  333,  328,  344,  328,  333,  337,  345,
-      338,  335,  339,  342,  349,  333,  334,  334,  444,  334,
-      344,  341,  346,  347,  341,  348,  354,  346,  346,  347,
-      350,  352,  334,  349,  355,  334,  353,  334,  351,  334,
-      341,  343,  353,  343,  343,  350,  348,  351,  356,  358,
-      352,  359,  354,  343,  355,  343,  343,  343,  357,  360,
-      343,  361,  356,  363,  357,  362,  366,  364,  357,  367,
-      362,  359,  358,  364,  365,  365,  361,  368,  363,  360,
-      370,  367,  369,  371,  372,  375,  366,  374,  369,  372,
-      376,  368,  373,  373,  377,  373,  378,  383,  378,  371,
-
-      379,  375,  381,  381,  379,  370,  376,  374,  377,  380,
-      382,  384,  383,  380,  385,  387,  378,  386,  389,  393,
-      140,  388,  390,  389,  387,  391,  390,  384,  380,  382,
-      388,  386,  385,  392,  391,  387,  394,  387,  396,  392,
-      393,  395,  394,  396,  397,  395,  398,  398,  399,  400,
-      401,  402,  402,  403,  400,  405,  404,  406,  412,  403,
-      404,  399,  407,  401,  397,  411,  408,  407,  409,  409,
-      405,  408,  410,  419,  413,   70,  412,  409,  406,  414,
-      416,  423,  414,  415,  410,  411,  413,  415,  417,  417,
-      418,  425,  416,  424,  419,  418,  420,  420,  422,  422,
-
-      425,  424,  423,  426,  427,  430,  429,  431,  432,  433,
-      435,  434,  439,  436,  432,  435,  427,  434,  433,  440,
-      437,  431,  440,  426,  429,  430,  429,  436,  437,  438,
-      441,  437,  439,  442,  443,  438,  441,  445,  446,  443,
-      447,  448,  446,  449,  450,  447,  451,  442,  449,  452,
-      454,  456,  457,  455,  441,  456,  448,  458,  445,  459,
-      450,  461,  452,  459,  462,  451,  453,  453,  455,  462,
-      454,  457,  453,  458,  453,  463,  461,  466,  460,  464,
-      453,  468,  453,  460,  465,  453,  453,  460,  464,  469,
-      465,  463,  453,  466,  467,  465,  471,  467,  470,  470,
-
-      472,  472,  473,  474,  468,  475,  476,  477,  478,  469,
-      479,  480,  481,  478,  484,  474,  482,  473,  488,  479,
-      475,  471,  482,  484,  485,  476,  486,  481,  485,  477,
-      480,  487,  486,  488,  489,  490,  491,  492,  493,  494,
-      496,  498,  493,  487,  495,  503,  495,  498,  496,  490,
-      499,  491,  494,  489,  500,  492,  497,  497,  501,  503,
-      500,  502,  499,  504,  502,  506,  505,  507,  506,  508,
-      501,  505,  511,  511,  509,  510,  507,  517,  504,  509,
-      509,  512,  512,  507,  513,  508,  507,  520,  510,  516,
-      513,  514,  514,  515,  515,  516,  518,  519,  517,  518,
-
-      521,  522,  519,  524,  522,  523,  520,  526,  521,  525,
-      523,  526,  527,  528,  529,  530,  531,  528,  527,  532,
-      530,  534,  533,  536,   64,  532,  524,  533,  525,  538,
-      535,  541,  529,  535,   59,  534,  531,  542,  535,  537,
-      537,  536,  535,  539,  540,  541,  544,  538,  539,  540,
-      543,  545,  542,  546,  545,  544,  543,  546,  547,  548,
-      549,  550,  548,  547,  551,  549,  552,  553,  555,  554,
-      556,  556,  557,  552,  554,  558,  559,  550,  560,  546,
-      553,  557,  551,  561,  562,  563,  564,  560,  555,  564,
-      562,  563,  559,  565,  558,  561,  565,  566,  567,  568,
-
-      569,  571,  566,  570,  575,  573,  569,  571,  570,  572,
-      573,  576,  572,  568,  574,  577,  567,  575,  579,  574,
-      574,  578,  580,  581,  576,  588,  582,  578,  581,  582,
-      583,  580,   54,  584,  577,  577,  583,  579,  585,  587,
-      587,  586,  590,  585,  582,  584,  586,  586,  592,  589,
-      588,  589,  591,  593,  591,  594,  595,  596,  597,  598,
-      599,  590,  603,  598,  597,  600,  592,  601,  602,  599,
-      605,  593,  604,  594,  607,  595,  609,  596,  608,  610,
-      600,  603,  601,  606,  604,  605,  602,  611,  607,  606,
-      608,  611,  612,  613,  614,  609,  615,  616,  610,  617,
-
-      618,  618,  619,  620,  625,  622,  619,  621,  624,  613,
-      612,  632,  614,  617,  615,  615,  616,  626,  621,  622,
-      623,  627,  620,  625,  624,  623,  628,  629,  627,  632,
-      626,  628,  630,  631,  629,  633,  634,  630,  631,  635,
-      636,  638,  633,  637,  639,  634,  638,  639,  640,  636,
-      641,  642,  640,  635,  643,  637,  644,  645,  646,  646,
-      642,  651,  647,  647,  641,  648,  648,  649,  652,  643,
-      644,  647,  653,  654,  652,  655,  649,  654,  645,  656,
-      651,  657,  658,  659,  661,  662,  660,  655,  658,  663,
-      669,  659,  653,  660,  672,  674,  664,  666,  679,  657,
-
-      673,  664,  661,  672,  656,  664,  673,  669,  664,  663,
-      662,  674,  666,  675,  678,  664,  679,  675,  664,  676,
-      676,  677,  677,  680,  681,  678,  682,  685,  684,  687,
-      698,  688,  682,  684,  688,  686,  690,  680,  689,  689,
-      691,  691,  698,  690,  681,  683,  683,  683,  685,  683,
-      692,  699,  683,  686,  687,  693,  693,  683,  697,  695,
-      697,  694,  695,  683,  683,  692,  694,  696,  701,  700,
-      699,  702,  696,  700,  703,  704,  704,  705,  708,  706,
-      707,  707,  703,  709,  710,  711,  713,  713,  701,  712,
-      702,  711,  705,  706,  712,  709,  708,  714,  750,  716,
-
-      750,  717,  714,  714,  716,  718,  710,  717,  719,  720,
-      722,  718,  723,  719,  721,  720,  722,  721,  724,  725,
-      723,  727,  726,  728,  729,  729,  724,  726,  727,  730,
-      732,  731,  733,  742,  735,  736,  732,  725,  730,  731,
-      737,  738,  728,  735,  736,  737,  739,  740,  741,  739,
-      738,  733,  740,  743,  743,  744,  745,  746,  742,  747,
-      748,  752,  741,  748,  751,  751,  746,  753,  754,  757,
-      744,  748,  753,  755,  756,  745,  758,  759,  760,  762,
-      761,  763,  752,  747,  761,  767,  759,   53,  768,  754,
-      765,  757,  764,  755,  756,  766,  758,  762,  764,  765,
-
-      763,  760,  768,  769,  767,  770,  771,  766,  773,  769,
-      775,  771,  772,  772,  774,  777,  776,  778,  779,  770,
-      780,  781,  782,  774,  776,  783,  784,  781,  773,  787,
-      775,  783,  785,  787,  788,  777,  782,  779,  785,  778,
-      780,  786,  789,  790,  791,  793,  784,  786,  790,  792,
-      792,  793,  794,  788,  789,  794,  795,  796,  797,  798,
-      799,  799,  789,  800,  797,  791,  801,  802,  802,  803,
-      796,  801,  804,  806,  795,  809,  804,  805,  805,  798,
-      807,  800,  808,  811,  803,  812,  814,  808,  815,  817,
-      817,  821,  818,  819,  809,  806,  818,  820,  820,  812,
-
-      807,  822,  823,   48,  824,  822,  814,  811,  819,  815,
-      816,  839,  839,  816,  826,  816,  821,  823,  824,  816,
-      825,  816,  828,  829,  827,  825,  816,  829,  826,  827,
-      827,  816,  830,  831,  832,  833,  828,  834,  831,  832,
-      835,  842,  843,   43,  836,  837,  838,  830,  831,  833,
-      836,  837,  838,  841,  835,  840,  844,  846,  834,  841,
-      840,  843,  847,  842,  848,  849,  854,  847,  851,  846,
-      850,  850,  852,  851,  844,  845,  845,  849,  848,  853,
-      852,  845,   14,  845,  855,  854,  856,  856,  857,  845,
-      859,  861,  857,  853,  845,  845,  859,  860,  862,  863,
-
-      860,  845,  864,  855,  865,  863,  866,  864,  867,  868,
-      861,  862,  869,  870,  871,  866,  872,  867,  869,  873,
-      874,  872,  870,  865,  875,  868,  876,  877,  878,  879,
-      880,  885,  883,  871,  874,  879,  877,  878,  876,  873,
-      881,  886,  888,  887,  875,  885,  881,  880,  883,  889,
-      890,  894,  891,  892,  893,  897,  888,  891,  892,  893,
-      894,  886,  887,  895,  895,  890,  896,  889,  897,  899,
-      900,  904,  896,  901,  901,  900,  900,  901,  902,  903,
-      905,  902,  906,  908,  907,  899,  909,  911,  910,  908,
-      911,  904,  912,  903,  910,  906,  913,  914,  905,  907,
-
-      915,  913,  914,  916,  917,  918,  909,  921,  916,  917,
-      924,  924,  920,  912,  922,  923,  915,  918,  920,  925,
-      922,  923,  926,  921,  927,  928,  928,  927,  925,  929,
-      930,  931,  932,  933,  936,  932,  934,  935,  939,  936,
-      926,  941,  934,  935,  939,  937,  933,  929,  938,  930,
-      937,  931,  942,  938,  943,  946,  944,  945,  945,  941,
-      943,  944,  947,  948,  946,  949,  950,  951,  949,  950,
-      952,  947,  942,  953,  954,  957,  955,  956,  951,  958,
-      960,  948,  955,  956,  958,  953,  959,  959,  952,  961,
-      957,  963,  962,  954,  964,  963,  965,  966,  967,  960,
-
-      969,  970,  970,  961,  962,  965,  972,  973,  975,  974,
-      977,  977,  964,  975,  978,  976,  966,  993,  993,  969,
-      972,  974,  973,  967,  976,  979,  980,  982,  981,  982,
-      983,  979,  980,  981,  978,  983,  984,  985,  986,  987,
-      988,  989,  990,  986,  991,   13,  994,  995,  989,  996,
-      984,  985,  997,  998,  987, 1003,  999,  990,  997,  988,
-      994,  999, 1003,  991,  996,  995, 1001, 1001, 1004, 1002,
-      999, 1006,  999,  998, 1002,  999, 1005, 1007, 1008, 1005,
-     1009, 1011, 1004, 1008, 1012, 1010, 1007, 1014, 1014, 1006,
-     1010, 1015, 1011, 1016, 1017, 1018, 1015, 1019, 1016, 1009,
-
-     1018, 1019, 1020, 1012, 1021, 1022, 1023, 1025, 1026, 1024,
-     1028, 1020, 1027, 1029, 1017, 1026, 1032, 1030, 1033, 1021,
-     1022, 1024, 1025, 1034, 1027, 1023, 1031, 1035, 1038, 1028,
-     1040, 1032, 1031, 1037, 1029, 1030, 1035, 1039, 1033, 1037,
-     1042, 1041, 1038, 1034, 1044, 1039, 1041, 1045, 1043, 1046,
-     1040, 1050, 1042, 1043, 1043, 1047, 1047, 1049,    0, 1051,
-     1050, 1045, 1046, 1044, 1048, 1051, 1052, 1052, 1055, 1048,
-     1049, 1053, 1048, 1048, 1055, 1054, 1053, 1048, 1058, 1058,
-     1056, 1057, 1059, 1048, 1054, 1056, 1057, 1048, 1060, 1060,
-     1061, 1062, 1063, 1061, 1065, 1061, 1064, 1066, 1067, 1068,
-
-     1069, 1070, 1066, 1059, 1071, 1064, 1069, 1070, 1080, 1071,
-     1063, 1062, 1067, 1073, 1065, 1072, 1075, 1068, 1075, 1072,
-     1074, 1074, 1073, 1076, 1078, 1079, 1080, 1073, 1078, 1073,
-     1081, 1073, 1082, 1073, 1076, 1083, 1084, 1082, 1082, 1081,
-     1079, 1084, 1085, 1086, 1087, 1088, 1089, 1090, 1091, 1093,
-     1094, 1092, 1086, 1091, 1089, 1095, 1085, 1083, 1093, 1097,
-     1097, 1090, 1096, 1087, 1088, 1092, 1098, 1096, 1094, 1099,
-     1099, 1100, 1102, 1100, 1103, 1102, 1104, 1105, 1107, 1103,
-     1095, 1098, 1106, 1106, 1108, 1108, 1105, 1109, 1109, 1110,
-     1111, 1112, 1113, 1113, 1110, 1104, 1114, 1115, 1107, 1116,
-
-     1115, 1117, 1120, 1119, 1118, 1119, 1117, 1122, 1123, 1124,
-     1122, 1111, 1112, 1118, 1124, 1131, 1114, 1125, 1126, 1116,
-     1120,    0, 1125, 1123, 1127, 1128, 1126, 1129, 1129, 1127,
-     1128, 1130, 1132, 1131, 1133, 1134, 1130, 1136, 1132, 1137,
-     1139, 1133, 1138, 1136, 1140, 1137, 1139, 1138, 1134, 1141,
-     1142, 1143, 1143, 1140, 1144, 1146, 1147, 1148, 1149, 1150,
-     1152, 1142, 1153, 1148, 1149, 1150, 1152, 1154, 1141, 1155,
-     1156, 1157, 1158, 1158, 1144, 1146, 1153, 1159, 1160, 1147,
-     1161, 1155, 1153, 1162, 1156, 1163, 1163, 1154, 1162, 1157,
-     1164, 1165, 1167, 1170, 1168, 1172, 1165, 1159, 1161, 1168,
-
-     1168, 1169, 1170, 1160, 1171, 1173, 1174, 1182, 1177, 1172,
-     1175, 1167, 1171, 1164, 1176, 1175, 1176, 1178, 1175, 1169,
-     1173, 1174, 1177, 1178, 1174, 1179, 1180, 1181, 1189, 1179,
-     1183, 1184, 1185, 1182, 1186, 1187, 1184, 1180, 1190, 1186,
-     1191, 1193, 1189, 1192, 1192, 1193, 1181, 1194, 1183, 1195,
-     1185, 1196, 1197, 1198, 1200, 1187, 1190, 1196, 1191, 1199,
-     1201, 1202, 1203, 1204, 1197, 1194, 1205, 1203, 1195, 1200,
-     1204, 1205, 1198, 1199, 1206, 1201, 1207, 1208, 1208, 1209,
-     1202, 1210, 1211, 1212, 1213, 1207,    0, 1210, 1212, 1214,
-     1213, 1221, 1206, 1222, 1209, 1214, 1215, 1215, 1216, 1216,
-
-     1218, 1218, 1219, 1211, 1220, 1223, 1219, 1222, 1224, 1221,
-     1225, 1225, 1226, 1220, 1227, 1224, 1228, 1229, 1230, 1231,
-     1223, 1228, 1227, 1232, 1231, 1231, 1233, 1237, 1232, 1232,
-     1235, 1229, 1226, 1234, 1234, 1236, 1237, 1230, 1238, 1239,
-     1240, 1241, 1242, 1238, 1244, 1243, 1233, 1245, 1242, 1235,
-     1243, 1247, 1246, 1245, 1236, 1248, 1249, 1247, 1239, 1241,
-     1240, 1248, 1250, 1251, 1252, 1253, 1254, 1256, 1256, 1255,
-     1244, 1246,    0, 1257, 1258, 1249, 1257, 1259, 1259, 1253,
-     1260, 1250, 1251, 1252, 1255, 1260, 1258, 1254, 1261, 1262,
-     1263, 1264, 1261, 1267, 1265, 1268, 1265, 1269, 1267, 1263,
-
-     1265, 1276, 1262, 1270, 1264, 1271, 1271, 1272, 1277, 1273,
-     1268, 1274, 1272, 1265, 1273, 1274, 1275, 1269, 1278, 1270,
-     1275, 1276, 1279, 1280, 1280, 1282, 1277, 1284, 1279, 1285,
-     1286, 1286, 1288, 1287, 1285, 1290, 1290, 1292, 1278, 1287,
-     1292, 1293, 1293, 1282, 1294, 1295, 1297, 1298, 1284, 1297,
-     1299, 1301, 1288, 1300, 1300, 1302, 1303, 1304, 1305, 1299,
-     1294, 1295, 1304, 1306, 1306, 1307, 1301, 1298, 1309, 1308,
-     1310, 1310, 1305, 1311, 1312, 1303, 1302, 1313, 1317, 1314,
-     1315, 1315, 1313, 1307, 1308, 1316, 1319, 1311, 1320, 1316,
-     1318, 1318, 1312, 1309, 1314, 1322, 1321, 1323, 1317, 1320,
-
-     1321, 1326, 1323, 1325, 1325, 1328, 1327, 1329, 1319, 1330,
-     1331, 1331, 1332, 1333, 1322, 1334, 1337, 1332, 1335, 1326,
-     1327, 1329, 1341, 1336, 1328, 1328, 1344, 1335, 1336, 1338,
-     1346, 1338, 1339, 1333, 1330, 1334, 1337, 1339, 1340, 1342,
-     1344, 1350, 1341, 1354, 1340, 1342, 1345, 1345, 1347, 1346,
-     1349, 1351, 1351, 1353, 1347, 1349, 1352, 1352, 1355, 1356,
-     1358, 1354, 1356, 1357, 1357, 1350, 1359, 1353, 1365, 1361,
-     1363, 1360, 1358, 1355, 1360, 1361, 1362, 1360, 1364, 1363,
-     1375, 1362, 1366, 1364, 1367, 1366, 1359, 1368, 1373, 1360,
-     1367, 1374, 1368, 1365, 1369, 1369, 1370, 1370, 1371, 1375,
-
-     1372, 1373, 1376, 1377, 1371, 1372, 1377, 1378, 1379, 1374,
-     1380, 1381, 1382, 1378, 1379, 1380, 1383, 1381, 1384, 1384,
-     1385, 1383, 1376, 1386, 1387, 1385, 1388, 1391, 1389, 1390,
-     1393, 1394, 1392, 1395, 1396, 1382, 1393, 1397, 1405, 1391,
-     1400, 1386, 1389, 1390, 1387, 1392, 1388, 1401, 1396, 1399,
-     1399, 1394, 1401, 1395, 1402, 1402, 1403, 1406, 1397, 1404,
-     1400, 1407, 1405, 1408, 1411, 1409, 1413, 1410, 1415,    0,
-     1407, 1403, 1409, 1404, 1416, 1406, 1410, 1416, 1408, 1410,
-     1411, 1413, 1417, 1417, 1418, 1418, 1413, 1419, 1420, 1421,
-     1422, 1422, 1421, 1415, 1423, 1424, 1425, 1426, 1427, 1419,
-
-     1428, 1425, 1426, 1429, 1430, 1433, 1420, 1423, 1435, 1431,
-     1432, 1433, 1429, 1436, 1424, 1437, 1428, 1427, 1431, 1432,
-     1438, 1431, 1439, 1430, 1434, 1434, 1436, 1440, 1435, 1442,
-     1443, 1444, 1444, 1437, 1438, 1445, 1446, 1447, 1439, 1440,
-     1448, 1448, 1447, 1450, 1449, 1446, 1451, 1452, 1443, 1455,
-     1457, 1445, 1453, 1449, 1442, 1448, 1449, 1453, 1453, 1460,
-     1456, 1450, 1464, 1455, 1460, 1452, 1456, 1451, 1457, 1458,
-     1458, 1459, 1461, 1462, 1465, 1466, 1467, 1459, 1461, 1462,
-     1473, 1466, 1464, 1468, 1469, 1471, 1468, 1474, 1465, 1467,
-     1469, 1476, 1468, 1471, 1475, 1477, 1478, 1479, 1480, 1473,
-
-     1476, 1482, 1475, 1481, 1481, 1484, 1474, 1482, 1477, 1478,
-     1483, 1479, 1480, 1485, 1486, 1487, 1483, 1488, 1484, 1490,
-     1489, 1491, 1492, 1494, 1494, 1481, 1489, 1495,    0, 1501,
-     1488, 1496, 1486, 1485, 1487, 1496, 1505, 1491, 1497, 1498,
-     1492, 1490, 1500, 1497, 1498, 1499, 1503, 1495, 1504, 1504,
-     1499, 1500, 1501, 1506, 1507, 1505, 1508, 1508, 1509, 1510,
-     1513, 1503, 1511, 1512, 1514, 1506, 1510, 1517, 1516, 1524,
-     1515, 1518, 1509, 1507, 1511, 1512, 1515, 1518, 1524, 1513,
-     1516, 1519, 1519, 1520, 1514, 1517, 1520, 1521, 1521, 1523,
-     1525, 1526, 1526, 1527, 1523, 1528, 1525, 1528, 1529, 1530,
-
-     1531, 1529, 1532, 1533, 1534, 1527, 1535, 1538, 1539, 1534,
-     1537, 1536, 1538, 1540, 1541, 1535, 1544, 1539, 1543, 1530,
-     1532, 1533, 1531, 1536, 1543, 1537, 1542, 1542, 1545, 1541,
-     1539, 1547, 1546, 1540, 1548, 1553, 1548, 1544, 1549, 1550,
-     1550, 1551, 1551, 1552, 1552, 1554, 1554, 1545, 1546, 1555,
-     1555, 1547, 1549, 1556, 1549, 1553, 1557, 1558, 1558, 1559,
-     1560, 1561, 1563, 1559, 1561, 1564, 1560, 1565, 1563, 1566,
-     1568, 1568, 1567, 1565, 1556, 1567, 1570, 1557, 1569, 1569,
-     1572, 1573, 1570, 1564, 1571, 1574, 1575, 1577, 1578, 1581,
-     1585, 1574, 1577, 1577, 1566, 1584, 1571, 1571, 1571, 1580,
-
-     1572, 1573, 1578, 1571, 1581, 1579, 1575, 1579, 1582, 1583,
-     1580, 1585, 1586, 1586, 1582, 1584, 1587, 1589, 1583, 1588,
-     1588, 1590, 1591, 1591, 1592, 1592, 1593, 1596, 1596, 1597,
-     1598, 1600, 1601, 1603, 1603, 1602, 1604, 1589, 1606, 1598,
-     1600, 1602, 1587, 1590, 1605, 1606, 1593, 1607, 1608, 1609,
-     1609, 1610, 1611, 1601, 1597, 1613, 1607, 1604, 1614, 1605,
-     1613, 1615, 1616, 1622, 1614, 1617, 1618, 1623, 1611, 1616,
-     1621, 1617, 1618, 1620, 1608, 1619, 1619, 1610, 1620, 1621,
-     1624, 1615, 1625, 1622, 1626, 1625, 1623, 1627, 1628, 1628,
-     1629, 1630, 1624, 1631, 1632, 1634, 1629, 1635, 1632,    0,
-
-     1638, 1639, 1626, 1636, 1640, 1639, 1642, 1642, 1631, 1646,
-     1640, 1630, 1641, 1627, 1632, 1634, 1635, 1644, 1636, 1638,
-     1643, 1641, 1645, 1645, 1643, 1647, 1648, 1649, 1644, 1650,
-     1646, 1651, 1649, 1644, 1652, 1653, 1654, 1655, 1655, 1647,
-     1652, 1654, 1656, 1656, 1657, 1648, 1659, 1660, 1657, 1650,
-     1653, 1651, 1661, 1662, 1662, 1659, 1663, 1663, 1660, 1664,
-     1665, 1666, 1667, 1660, 1664, 1664, 1665, 1666, 1668, 1669,
-     1670, 1672, 1661, 1668, 1673, 1674, 1670, 1675, 1673, 1676,
-     1678, 1669, 1677, 1672, 1679, 1676, 1678, 1674, 1667, 1681,
-     1682, 1685, 1683, 1689, 1685, 1692, 1679, 1683, 1686, 1686,
-
-     1692, 1681, 1675,    0, 1677, 1687, 1687, 1688, 1688, 1682,
-     1690, 1691, 1693, 1689, 1694, 1696, 1690, 1691, 1693, 1698,
-     1696, 1699, 1698, 1694, 1700, 1700, 1702, 1703, 1706, 1704,
-     1705, 1705, 1710, 1699, 1704, 1707, 1708, 1706, 1702, 1703,
-     1707, 1708, 1709, 1709, 1711, 1712, 1713, 1714, 1717, 1715,
-     1716, 1714, 1710, 1711, 1715, 1720, 1716, 1719, 1719, 1721,
-     1722, 1722, 1717, 1712, 1724, 1713, 1723, 1725, 1721, 1719,
-     1727, 1732, 1726, 1720, 1732, 1723, 1724, 1726, 1730, 1730,
-     1733, 1734,    0, 1727, 1736, 1738, 1737, 1739, 1725, 1740,
-     1740, 1738, 1741, 1746, 1741, 1743, 1733, 1734, 1745, 1736,
-
-     1737, 1742, 1742, 1743, 1739, 1745, 1747, 1747, 1748, 1749,
-     1750, 1751, 1752, 1746, 1753, 1755, 1754, 1748, 1757, 1760,
-     1758, 1755, 1750, 1751, 1752, 1759, 1759, 1761, 1764,    0,
-     1749, 1754, 1758, 1762, 1755, 1768, 1762, 1760, 1757, 1763,
-     1753, 1766, 1772, 1767, 1763, 1767, 1766, 1761, 1764, 1769,
-     1770, 1772, 1774, 1768, 1769, 1775, 1776, 1770, 1777, 1778,
-     1777, 1780, 1781, 1780, 1775, 1782, 1782, 1783, 1776, 1784,
-     1774, 1785, 1786, 1785, 1784, 1787, 1781, 1786, 1778, 1788,
-     1787, 1789, 1790, 1792, 1791, 1795, 1793, 1858, 1790, 1791,
-     1800, 1796, 1799, 1783, 1793, 1858, 1792, 1788, 1797, 1797,
-
-     1801, 1789, 1798, 1798, 1795, 1796, 1801, 1799, 1802, 1803,
-     1800, 1803, 1804, 1802, 1805, 1805, 1809, 1806, 1807, 1807,
-     1804, 1808, 1808, 1810, 1811, 1809, 1811, 1812, 1804, 1806,
-     1814, 1813, 1810, 1815, 1817, 1810, 1813, 1813, 1818, 1814,
-     1821, 1822, 1819, 1818, 1825, 1815, 1817, 1819, 1812, 1823,
-     1824, 1824, 1826, 1821, 1828, 1827, 1845, 1829, 1823, 1833,
-     1834, 1822, 1825, 1831, 1832, 1834, 1842, 1844, 1828, 1835,
-     1826, 1827, 1829, 1836, 1835, 1831, 1832, 1839, 1841, 1833,
-     1843, 1845, 1836, 1839, 1841, 1844, 1847, 1847, 1846, 1842,
-     1848, 1849, 1849, 1850, 1851, 1843, 1839, 1846, 1851, 1848,
-
-     1852, 1853, 1854, 1855, 1856, 1852, 1859, 1854, 1854, 1855,
-     1856, 1867, 1850, 1857, 1853, 1864, 1857, 1862, 1862, 1863,
-     1863, 1865, 1865, 1867, 1864, 1868, 1859, 1866, 1866, 1869,
-     1877, 1870, 1871, 1871, 1863, 1869, 1870, 1872, 1872, 1873,
-     1874, 1880, 1882, 1868, 1873, 1863, 1874, 1876, 1878, 1881,
-     1877, 1876, 1878, 1883, 1881, 1884, 1885, 1886, 1887, 1887,
-     1884, 1889, 1891, 1888, 1890, 1882, 1880, 1888, 1883, 1890,
-     1892, 1893, 1894, 1886, 1885, 1896, 1889, 1894, 1895, 1897,
-     1897, 1899, 1892, 1900, 1901, 1902, 1903, 1904, 1891, 1899,
-     1893, 1895, 1905, 1896, 1907, 1906, 1909, 1910, 1910, 1912,
-
-     1913, 1911, 1900, 1901, 1911, 1914, 1904, 1906, 1902, 1918,
-     1903, 1909, 1912, 1905, 1913, 1907, 1915, 1915, 1914, 1916,
-     1916, 1917, 1917, 1919, 1918, 1920, 1920, 1923, 1921, 1922,
-     1922, 1926, 1923, 1925, 1927, 1928, 1919, 1921, 1925, 1931,
-     1921, 1929, 1929, 1930, 1930, 1932, 1932, 1928, 1933, 1934,
-     1934, 1926, 1935,    0, 1927, 1936, 1937, 1937, 1931, 1939,
-     1936, 1938, 1938, 1940, 1941, 1942, 1933, 1935, 1946, 1944,
-     1945, 1945, 1940, 1939, 1944, 1947, 1947, 1948, 1941, 1949,
-     1950, 1951, 1951, 1950, 1942, 1949, 1953, 1946, 1952, 1952,
-     1955, 1954, 1956, 1956, 1958, 1948, 1959, 1951, 1960, 1961,
-
-     1962, 1962, 1963, 1961, 1968, 1953, 1954, 1964, 1965, 1955,
-     1967, 1967, 1970, 1960, 1958, 1971, 1972, 1972, 1969, 1959,
-     1973, 1963, 1964, 1965, 1968, 1969, 1970, 1975, 1974, 1973,
-     1974, 1977, 1978, 1979, 1980, 1981, 1982, 1978, 1979, 1983,
-     1984, 1971, 1990, 1977, 1983, 1986, 1987, 1975, 1981, 1988,
-     1986, 1987, 1989, 1994, 1991, 1995, 1992, 1982, 1989, 1980,
-     1991, 1992, 1993, 1990, 1988, 1997, 1984, 1993, 1995, 1996,
-     1998, 1999, 1996, 2000, 1997, 2001, 2006, 2002, 1994, 1998,
-     1999, 2003, 2000, 2002, 2004, 2008, 2010, 2003, 2004, 2001,
-     2009, 2009, 2010, 2012, 2008, 2014, 2006, 2011, 2011, 2017,
-
-     2015, 2016, 2016, 2018, 2021, 2020, 2011, 2022, 2027, 2023,
-     2042, 2014, 2018, 2012, 2017, 2012, 2015, 2020, 2028, 2026,
-     2021, 2023, 2022, 2025, 2026, 2070, 2025, 2070, 2027, 2042,
-     2028, 2029, 2029, 2030, 2030, 2032, 2032, 2033, 2034, 2035,
-     2033, 2036, 2038, 2034,    0, 2035, 2040, 2036, 2037, 2037,
-     2039, 2039, 2041, 2043, 2043, 2045, 2038, 2046, 2040, 2045,
-     2046, 2047, 2047, 2048, 2049, 2050, 2041, 2051, 2048, 2052,
-     2052, 2051, 2055, 2049, 2053, 2056, 2057, 2055, 2058, 2059,
-     2060, 2061, 2062, 2059, 2063, 2050, 2061, 2053, 2062, 2064,
-     2063, 2068, 2058, 2066, 2067, 2056, 2057, 2068, 2069, 2067,
-
-     2060, 2073, 2074, 2074, 2076, 2075, 2069, 2064, 2075, 2066,
-     2077, 2077, 2079, 2080, 2081, 2073, 2079, 2082, 2082, 2080,
-     2083, 2086, 2086, 2088, 2090, 2095, 2081, 2091, 2094, 2083,
-     2076, 2096, 2097, 2094, 2098, 2098, 2096, 2097, 2090, 2100,
-     2100, 2088, 2102, 2091, 2103, 2103, 2104, 2105, 2102, 2106,
-     2112, 2095, 2108, 2109, 2106, 2110, 2110, 2113, 2114, 2112,
-     2115, 2118, 2104, 2113, 2119, 2109, 2117, 2117, 2125, 2105,
-     2125, 2108, 2121, 2121, 2123, 2115, 2114, 2122, 2122, 2123,
-     2118, 2124, 2119, 2126, 2127, 2128, 2124, 2129, 2130, 2130,
-     2131, 2131, 2129, 2132, 2132, 2133, 2133, 2126, 2127, 2134,
-
-     2135, 2136, 2137, 2137, 2139, 2128, 2136, 2138, 2138, 2140,
-     2141, 2134, 2142, 2143, 2143, 2144, 2139, 2148, 2135, 2145,
-     2145, 2140, 2146, 2146, 2147, 2149, 2150, 2151, 2142, 2148,
-     2141, 2152, 2149, 2153, 2144, 2147, 2152, 2154, 2150, 2155,
-     2155, 2156, 2157, 2158, 2164, 2159, 2160, 2151, 2161, 2167,
-     2156, 2162, 2162, 2153, 2165, 2163, 2168, 2154, 2159, 2164,
-     2169, 2171, 2161, 2158, 2163, 2174, 2174, 2167, 2157, 2165,
-     2160, 2170, 2172, 2181, 2170, 2171, 2173, 2172, 2168, 2175,
-     2175, 2173, 2182, 2169, 2176, 2176, 2178, 2178, 2180, 2180,
-     2183, 2181, 2185, 2182, 2187, 2186, 2189, 2188, 2190, 2192,
-
-     2192, 2191, 2194, 2194, 2195, 2189, 2196, 2197, 2197, 2183,
-     2201, 2199, 2185, 2186, 2202, 2196, 2187, 2188, 2190, 2191,
-     2199, 2200, 2200, 2203, 2204, 2205, 2195, 2206, 2201, 2208,
-     2203, 2207, 2202, 2209, 2209, 2210, 2210, 2212, 2211, 2204,
-     2214, 2213, 2216, 2205, 2211, 2206, 2215, 2207, 2208, 2217,
-        0, 2215, 2218, 2220, 2220, 2212, 2213, 2218, 2219, 2214,
-     2219, 2221, 2216, 2221, 2222, 2222, 2224, 2226, 2227, 2217,
-     2228, 2229, 2230, 2231, 2239, 2232, 2226, 2230, 2235, 2256,
-     2236, 2238, 2228, 2236, 2256, 2224, 2241, 2227, 2237, 2237,
-     2241, 2229, 2239, 2231, 2232, 2243, 2238, 2244, 2235, 2240,
-
-     2240, 2244, 2245, 2245, 2246, 2248, 2249, 2250, 2250, 2252,
-     2243, 2253, 2253, 2254, 2255, 2255, 2257, 2246, 2258, 2258,
-     2264, 2252, 2263, 2263, 2266, 2248, 2249, 2267, 2257, 2265,
-     2265, 2271, 2254,    0, 2268, 2269, 2276, 2266, 2270, 2270,
-     2267, 2276, 2264, 2268, 2269, 2277, 2271, 2273, 2273, 2278,
-     2277, 2279, 2280, 2281, 2283, 2282, 2279,    0, 2285, 2288,
-     2280, 2286, 2283, 2278, 2282, 2287, 2286, 2289, 2289, 2293,
-     2287, 2291, 2281, 2285, 2288, 2290, 2290, 2292, 2291, 2294,
-     2295, 2298, 2292, 2296, 2297, 2297, 2295, 2293, 2296, 2299,
-     2300, 2300, 2301, 2301, 2299, 2304, 2298, 2294, 2305, 2305,
-
-     2306, 2307,    0, 2306, 2308, 2309, 2307, 2307, 2304, 2308,
-     2309, 2310, 2311, 2312, 2313, 2314, 2311, 2310, 2312, 2315,
-     2316, 2317, 2322, 2313, 2319, 2316, 2326, 2315, 2320, 2319,
-     2314, 2320, 2324, 2317, 2322, 2325, 2327, 2324, 2328, 2329,
-     2325, 2330, 2330, 2331, 2326, 2334, 2335, 2328, 2329, 2327,
-     2336, 2338, 2331, 2337, 2337, 2342, 2339, 2340, 2341, 2341,
-     2344, 2346, 2349, 2347, 2334, 2339, 2335, 2347, 2380, 2336,
-     2338, 2380, 2340, 2350, 2342, 2344, 2348, 2348, 2351, 2350,
-     2352, 2346, 2353, 2353, 2351, 2354, 2352, 2349, 2357, 2355,
-     2358, 2360, 2361, 2354, 2355, 2360, 2362, 2357, 2364, 2364,
-
-     2365, 2365, 2372, 2358, 2366, 2366, 2361, 2368, 2368, 2370,
-     2370, 2362, 2373, 2375, 2376, 2376, 2381, 2373, 2373, 2378,
-     2378, 2383, 2372, 2379, 2379, 2385, 2386, 2386, 2389, 2381,
-     2387, 2387, 2392, 2375, 2388, 2388, 2390, 2390, 2391, 2383,
-     2393, 2394, 2396, 2389, 2400, 2385, 2396, 2394, 2395, 2395,
-     2392, 2391, 2399, 2401, 2393, 2402, 2403, 2399, 2399, 2404,
-     2405, 2410, 2403, 2412, 2406, 2404, 2410, 2400, 2406, 2407,
-     2407, 2412, 2415, 2401, 2413, 2402, 2416, 2413, 2417, 2416,
-     2419, 2418, 2420, 2422, 2422, 2405, 2418, 2421, 2423, 2426,
-        0, 2424, 2427, 2427, 2435, 2417, 2417, 2415, 2419, 2424,
-
-     2425, 2421, 2420, 2428, 2428, 2425, 2425, 2423, 2426, 2429,
-     2429, 2430, 2430, 2431, 2431, 2432, 2433, 2434, 2436, 2437,
-     2435, 2433, 2438, 2440, 2440, 2441, 2442, 2436, 2441, 2444,
-     2444, 2432, 2454, 2445, 2446, 2446, 2447, 2434, 2450, 2437,
-     2445, 2447, 2438, 2451, 2442, 2449, 2449, 2450, 2452, 2457,
-     2454, 2456, 2451, 2455, 2455, 2456, 2458, 2452, 2457, 2459,
-     2460, 2461, 2466, 2466, 2459, 2459, 2467, 2469, 2470, 2473,
-     2461, 2458, 2474, 2460, 2478, 2475, 2469, 2476, 2480, 2495,
-     2470, 2474, 2482, 2476, 2467, 2483, 2478, 2482, 2484, 2484,
-     2483, 2485, 2487, 2494, 2473, 2475, 2502, 2487, 2495, 2480,
-
-     2485, 2488, 2488, 2490, 2490, 2488, 2491, 2491, 2492, 2492,
-     2493, 2496, 2498, 2494, 2502, 2499, 2496, 2500, 2498, 2493,
-     2499, 2503, 2500, 2501, 2501, 2504, 2505, 2506, 2507, 2510,
-     2504, 2508, 2508, 2506, 2511, 2512, 2514, 2514, 2516, 2517,
-     2524, 2518, 2503, 2520, 2505, 2518, 2521, 2519, 2510, 2511,
-     2522, 2516, 2517, 2507, 2526, 2512, 2519, 2523, 2522, 2520,
-     2525, 2525, 2523, 2528, 2528, 2521, 2524, 2529, 2529, 2531,
-     2533, 2533, 2535, 2526, 2538, 2536, 2537, 2540, 2540, 2538,
-     2541, 2542, 2543, 2545, 2545, 2546, 2549, 2552, 2535, 2548,
-     2531, 2536, 2537, 2556, 2548, 2550, 2550, 2551, 2551, 2546,
-
-     2541, 2543, 2553, 2553, 2542, 2554, 2555, 2552, 2549, 2558,
-     2560, 2557, 2559, 2556, 2568, 2555, 2554, 2557, 2561, 2561,
-     2562, 2567, 2553, 2562, 2559, 2563, 2563, 2573, 2558, 2569,
-     2560, 2570, 2570, 2567, 2568, 2569, 2571, 2572, 2577, 2571,
-     2583, 2575, 2576, 2572, 2578, 2573, 2575, 2576, 2579, 2584,
-     2578, 2580, 2580, 2582, 2582, 2586, 2586, 2577, 2584, 2583,
-     2587, 2587, 2588, 2589, 2590, 2579, 2579, 2588, 2599, 2590,
-     2591, 2591, 2592, 2592, 2593, 2593, 2594, 2589, 2596, 2596,
-     2601, 2594, 2602, 2603, 2604, 2604, 2607, 2599, 2606, 2606,
-     2608, 2612, 2609, 2610, 2610, 2611, 2612, 2615, 2615, 2619,
-
-     2607, 2609, 2601, 2618, 2602, 2603, 2617, 2617, 2618, 2620,
-     2608, 2621, 2622, 2619, 2611, 2620, 2623, 2623, 2626, 2624,
-     2622, 2627, 2628, 2621, 2624, 2629, 2630, 2628, 2632, 2633,
-     2634, 2635, 2630, 2637, 2636, 2643, 2632, 2629, 2626, 2638,
-     2639, 2627, 2640, 2647, 2647, 2644,    0, 2640, 2633, 2637,
-     2634, 2635, 2636, 2648, 2648, 2643, 2638, 2638, 2644, 2649,
-     2662, 2639, 2669, 2649, 2653, 2653, 2655, 2655, 2656, 2656,
-     2659, 2656, 2657, 2657, 2659, 2657, 2658, 2658, 2662, 2658,
-     2661, 2661, 2663, 2665, 2666, 2666, 2670, 2669, 2665, 2672,
-     2671, 2673, 2675, 2670, 2671, 2676, 2663, 2680, 2672, 2677,
-
-     2677, 2678, 2678, 2685, 2676, 2687, 2673, 2679, 2679, 2681,
-     2675, 2682, 2680, 2683, 2681, 2684, 2686, 2688, 2683, 2683,
-     2682, 2684, 2688, 2682, 2689, 2690, 2687, 2838, 2685, 2689,
-     2692, 2686, 2691, 2691, 2838, 2692, 2695, 2695, 2698, 2698,
-     2699, 2699, 2700, 2700, 2690, 2701, 2701, 2702, 2702, 2703,
-     2703, 2704, 2704, 2706, 2707, 2707, 2708, 2712, 2710, 2711,
-     2711, 2713, 2706, 2714, 2715, 2715, 2716, 2717, 2717, 2720,
-     2721, 2722, 2712, 2721, 2713, 2714, 2708, 2710, 2723, 2723,
-     2724, 2716, 2726, 2727, 2730, 2726, 2728, 2720, 2729, 2727,
-     2731, 2732, 2743, 2729, 2734, 2743, 2748, 2722, 2724, 2752,
-
-     2728, 2745, 2745, 2730, 2746, 2746, 2749, 2732, 2731, 2734,
-     2750, 2751, 2754, 2752, 2750, 2749, 2755, 2756, 2757, 2748,
-     2757, 2758, 2756, 2759, 2759, 2760, 2761, 2755, 2762, 2764,
-     2766, 2751, 2763, 2767, 2765, 2754, 2758, 2771, 2760, 2772,
-     2772, 2770, 2866, 2773, 2866, 2761, 2762, 2778, 2763, 2765,
-     2779, 2766, 2773, 2767, 2764, 2770, 2783, 2771, 2774, 2774,
-     2775, 2775, 2776, 2776, 2777, 2777, 2778, 2781, 2780, 2782,
-     2779, 2780, 2781, 2784, 2782, 2786, 2785, 2787, 2788, 2788,
-     2789, 2783, 2785, 2790, 2790, 2792, 2794, 2799, 2784, 2786,
-     2797, 2797, 2798, 2798, 2800, 2799, 2801, 2787, 2803, 2789,
-
-     2792, 2802, 2801, 2804, 2794, 2805, 2808, 2802, 2806, 2806,
-     2811, 2810, 2803, 2800, 2811, 2813, 2804, 2814, 2815, 2816,
-     2817, 2818, 2814, 2819, 2805, 2810, 2808, 2822, 2819, 2820,
-     2823, 2825, 2816, 2817, 2820, 2813, 2825, 2815, 2824, 2824,
-     2818, 2826, 2827, 2827, 2831, 2822, 2828, 2826, 2829, 2823,
-     2830, 2828, 2832, 2829, 2833, 2830, 2834, 2834, 2832, 2833,
-     2836, 2837, 2839, 2831, 2836, 2840, 2841, 2842, 2849, 2843,
-     2844, 2844, 2841, 2846, 2846, 2850, 2847, 2851, 2848, 2856,
-     2837, 2839, 2843, 2848, 2840, 2847, 2842, 2849, 2847, 2854,
-     2851, 2852, 2852, 2853, 2850, 2857, 2857, 2858, 2853, 2859,
-
-     2859, 2861, 2854, 2860, 2860, 2856, 2861, 2862, 2863, 2864,
-     2864, 2870, 2865, 2868, 2862, 2869, 2858, 2865, 2867, 2867,
-     2868, 2871, 2869, 2872, 2874, 2874, 2871, 2863, 2875, 2877,
-     2870, 2878, 2879, 2880, 2877, 2884, 2878, 2881, 2881, 2883,
-     2883, 2885, 2872, 2886, 2886, 2887, 2887, 2875, 2888, 2890,
-     2890, 2879, 2880, 2898, 2884, 2888, 2891, 2891, 2892, 2894,
-     2885, 2897, 2899,    0, 2894, 2892, 2897, 2900, 2900, 2901,
-     2901,    0, 2898,    0,    0,    0,    0,    0,    0,    0,
-        0, 2899, 2905, 2905, 2905, 2905, 2905, 2905, 2905, 2906,
-     2906, 2906, 2906, 2906, 2906, 2906, 2907, 2907, 2907, 2907,
-
-     2907, 2907, 2907, 2908, 2908, 2908, 2908, 2908, 2908, 2908,
-     2909, 2909, 2909, 2909, 2909, 2909, 2909, 2911, 2911,    0,
-     2911, 2911, 2911, 2911, 2912, 2912,    0,    0,    0, 2912,
-     2912, 2913, 2913,    0,    0, 2913,    0, 2913, 2914,    0,
-        0,    0,    0,    0, 2914, 2915, 2915,    0,    0,    0,
-     2915, 2915, 2916,    0,    0,    0,    0,    0, 2916, 2917,
-     2917,    0, 2917, 2917, 2917, 2917, 2918, 2918,    0, 2918,
-     2918, 2918, 2918, 2904, 2904, 2904, 2904, 2904, 2904, 2904,
-     2904, 2904, 2904, 2904, 2904, 2904, 2904, 2904, 2904, 2904,
-     2904, 2904, 2904, 2904, 2904, 2904, 2904, 2904, 2904, 2904,
-
-     2904, 2904, 2904, 2904, 2904, 2904, 2904, 2904, 2904, 2904,
-     2904, 2904, 2904, 2904
+        1,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+        3,    3,    5,    5,    5,    5,    5,    5,    5,    5,
+        5,    5,    5,    5,    5,    5,    5,    5,    5,    5,
+
+        5,    5,    5,    5,    5,    5,    5,    5,    5,    5,
+        5,    5,    5,    5,    5,    5,    5,    5,    5,    5,
+        5,    5,    5,    7,    7,    7,    7,    7,    7,    7,
+        7,    7,    7,    7,    7,    7,    7,    7,    7,    7,
+        7,    7,    7,    7,    7,    7,    7,    7,    7,    7,
+        7,    7,    7,    7,    7,    7,    7,    7,    7,    7,
+        7,    7,    7,    7,    9,    9,    9,    9,    9,    9,
+        9,    9,    9,    9,    9,    9,    9,    9,    9,    9,
+        9,    9,    9,    9,    9,    9,    9,    9,    9,    9,
+        9,    9,    9,    9,    9,    9,    9,    9,    9,    9,
+
+        9,    9,    9,    9,    9,   11,   11,   11,   11,   11,
+       11,   11,   11,   11,   11,   11,   11,   11,   11,   11,
+       11,   11,   11,   11,   11,   11,   11,   11,   11,   11,
+       11,   11,   11,   11,   11,   11,   11,   11,   11,   11,
+       11,   11,   11,   11,   11,   11,   13,   13,   13,   13,
+       13,   13,   13,   13,   13,   13,   13,   13,   13,   13,
+       13,   13,   13,   13,   13,   13,   13,   13,   13,   13,
+       13,   13,   13,   13,   13,   13,   13,   13,   13,   13,
+       13,   13,   13,   13,   13,   13,   13,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   15,   22,
+       15,   29,   30,   31,   15,   19,   19,   19,   19,   19,
+       19,   19,   19,   19,   19,   19,   19,   19,   19,   19,
+       19,   19,   19,   19,   19,   19,   19,   19,   19,   19,
+       19,   19,   19,   19,   19,   19,   19,   19,   19,   19,
+       19,   19,   19,   19,   19,   19,   20,   20,   20,   20,
+       20,   20,   20,   20,   20,   20,   20,   20,   20,   20,
+       20,   20,   20,   20,   20,   20,   20,   20,   20,   20,
+
+       20,   20,   20,   20,   20,   20,   20,   20,   20,   20,
+       20,   20,   20,   20,   20,   20,   20,   21,   21,   34,
+       23,   21,   25,   26,   27,   36,   21,   23,   27,   24,
+       42,   23,   27,   24,   23,   21,   24,   26,   24,   24,
+       28,   32,   25,   28,   33,   32,   43,   35,   33,   32,
+       28,   35,   28,   70,   37,   32,   79,   35,   37,   32,
+       35,   39,   33,   39,   33,   80,   38,   35,   37,   38,
+       38,   37,   39,   40,   81,   55,   38,   55,   39,   82,
+       38,   38,   83,   40,   84,   41,   38,   40,   40,   41,
+       86,   87,   88,   41,   44,   44,   44,   44,   44,   44,
+
+       44,   44,   44,   44,   44,   44,   44,   44,   44,   44,
+       44,   44,   44,   44,   44,   44,   44,   44,   44,   44,
+       44,   44,   44,   44,   44,   44,   44,   44,   44,   44,
+       44,   44,   44,   44,   44,   48,   48,   48,   48,   48,
+       48,   48,   48,   48,   48,   48,   48,   48,   48,   48,
+       48,   48,   48,   48,   48,   48,   48,   48,   48,   48,
+       48,   48,   48,   48,   48,   48,   48,   48,   48,   48,
+       48,   48,   48,   48,   48,   48,   49,   49,   49,   49,
+       49,   49,   49,   49,   49,   49,   49,   49,   49,   49,
+       49,   49,   49,   49,   49,   49,   49,   49,   49,   49,
+
+       49,   49,   49,   49,   49,   49,   49,   49,   49,   49,
+       49,   49,   49,   49,   49,   49,   49,   53,   53,   53,
+       53,   53,   53,   53,   53,   53,   53,   53,   53,   53,
+       53,   53,   53,   53,   53,   53,   53,   53,   53,   53,
+       53,   53,   53,   53,   53,   53,   53,   53,   53,   53,
+       53,   53,   53,   53,   53,   53,   53,   53,   54,   54,
+       54,   54,   54,   54,   54,   54,   54,   54,   54,   54,
+       54,   54,   54,   54,   54,   54,   54,   54,   54,   54,
+       54,   54,   54,   54,   54,   54,   54,   54,   54,   54,
+       54,   54,   54,   54,   54,   54,   54,   54,   54,   59,
+
+       59,   59,   59,   59,   59,   59,   59,   59,   59,   59,
+       59,   59,   59,   59,   59,   59,   59,   59,   59,   59,
+       59,   59,   59,   59,   59,   59,   59,   59,   59,   59,
+       59,   59,   59,   59,   59,   59,   59,   59,   59,   59,
+       60,   60,   60,   60,   60,   60,   60,   60,   60,   60,
+       60,   60,   60,   60,   60,   60,   60,   60,   60,   60,
+       60,   60,   60,   60,   60,   60,   60,   60,   60,   60,
+       60,   60,   60,   60,   60,   60,   60,   60,   60,   60,
+       60,   64,   64,   64,   64,   64,   64,   64,   64,   64,
+       64,   64,   64,   64,   64,   64,   64,   64,   64,   64,
+
+       64,   64,   64,   64,   64,   64,   64,   64,   64,   64,
+       64,   64,   64,   64,   64,   64,   64,   64,   64,   64,
+       64,   64,   65,   65,   65,   65,   65,   65,   65,   65,
+       65,   65,   65,   65,   65,   65,   65,   65,   65,   65,
+       65,   65,   65,   65,   65,   65,   65,   65,   65,   65,
+       65,   65,   65,   65,   65,   65,   65,   65,   65,   65,
+       65,   65,   65,   67,   67,   67,   67,   67,   67,   67,
+       67,   67,   67,   67,   67,   67,   67,   67,   67,   67,
+       67,   67,   67,   67,   67,   67,   67,   67,   67,   67,
+       67,   67,   67,   67,   67,   67,   67,   67,   67,   67,
+
+       67,   67,   67,   67,   69,   69,   69,   69,   69,   69,
+       69,   69,   69,   69,   69,   69,   69,   69,   69,   69,
+       69,   69,   69,   69,   69,   69,   69,   69,   69,   69,
+       69,   69,   69,   69,   69,   69,   69,   69,   69,   69,
+       69,   69,   69,   69,   69,   74,   74,   74,   74,   74,
+       74,   74,   74,   74,   74,   74,   74,   74,   74,   74,
+       74,   74,   74,   74,   74,   74,   74,   74,   74,   74,
+       74,   74,   74,   74,   74,   74,   74,   74,   74,   74,
+       74,   74,   74,   74,   74,   74,   77,   77,   77,   77,
+       77,   77,   77,   77,   77,   77,   77,   77,   77,   77,
+
+       77,   77,   77,   77,   77,   77,   77,   77,   77,   77,
+       77,   77,   77,   77,   77,   77,   77,   77,   77,   77,
+       77,   77,   77,   77,   77,   77,   77,   85,   89,   90,
+       90,   91,   92,   93,   89,   94,   89,   95,   96,   96,
+       85,   97,   98,   99,  100,  101,   96,  102,  103,  104,
+      105,  103,   93,  106,  109,  107,  108,  110,  111,  107,
+      112,  108,  113,  114,  103,  103,  115,  116,  117,  118,
+      119,  120,  121,  106,  104,  107,  121,  122,  123,  124,
+      125,  126,  125,  127,  129,  128,  130,  131,  132,  125,
+      133,  134,  135,  136,  137,  125,  128,  138,  139,  140,
+
+      128,  141,  142,  143,  144,  145,  146,  133,  140,  147,
+      133,  166,  168,  170,  171,  175,  176,  138,  177,  178,
+      140,  164,  164,  164,  164,  164,  164,  164,  164,  164,
+      164,  164,  164,  164,  164,  164,  164,  164,  164,  164,
+      164,  164,  164,  164,  164,  164,  164,  164,  164,  164,
+      164,  164,  164,  164,  164,  164,  164,  164,  164,  164,
+      164,  164,  169,  172,  173,  174,  180,  179,  182,  181,
+      172,  183,  184,  180,  187,  173,  181,  169,  179,  174,
+      185,  186,  188,  189,  190,  185,  186,  191,  192,  193,
+      194,  186,  195,  196,  197,  198,  199,  186,  186,  199,
+
+      200,  201,  185,  202,  203,  204,  205,  206,  207,  203,
+      208,  210,  209,  211,  212,  213,  214,  215,  193,  216,
+      217,  203,  218,  203,  209,  219,  220,  221,  223,  222,
+      224,  214,  222,  225,  226,  227,  228,  229,  223,  230,
+      219,  231,  232,  233,  215,  234,  235,  236,  237,  238,
+      239,  226,  240,  241,  241,  242,  243,  244,  245,  246,
+      247,  248,  249,  250,  251,  252,  253,  254,  255,  256,
+      257,  258,  259,  260,  261,  262,  264,  261,  265,  266,
+      267,  245,  268,  269,  270,  271,  272,  273,  274,  259,
+      256,  260,  275,  276,  257,  277,  278,  279,  280,  281,
+
+      282,  283,  280,  284,  285,  286,  287,  288,  289,  290,
+      285,  291,  292,  293,  294,  295,  296,  297,  298,  299,
+      300,  301,  302,  303,  304,  305,  306,  307,  308,  309,
+      310,  311,  312,  313,  314,  315,  299,  316,  317,  318,
+      319,  320,  321,  322,  320,  323,  307,  325,  326,  320,
+      320,  320,  320,  306,  324,  327,  324,  328,  329,  329,
+      330,  331,  332,  333,  334,  335,  333,  336,  337,  330,
+      338,  332,  324,  339,  340,  341,  342,  343,  344,  345,
+      346,  347,  348,  349,  350,  351,  352,  353,  343,  354,
+      355,  354,  352,  356,  357,  358,  359,  361,  360,  364,
+
+      365,  363,  366,  363,  362,  367,  356,  368,  369,  356,
+      362,  356,  360,  371,  362,  372,  363,  374,  375,  363,
+      377,  363,  362,  363,  373,  373,  376,  378,  379,  371,
+      380,  376,  378,  381,  373,  382,  373,  373,  373,  383,
+      384,  373,  385,  386,  387,  388,  389,  390,  391,  392,
+      393,  394,  395,  396,  397,  388,  385,  398,  399,  400,
+      401,  402,  403,  405,  389,  404,  404,  406,  402,  407,
+      408,  409,  411,  404,  410,  410,  401,  412,  413,  414,
+      415,  416,  417,  418,  419,  420,  421,  411,  422,  409,
+      423,  424,  425,  426,  427,  419,  428,  419,  429,  430,
+
+      431,  432,  433,  434,  435,  416,  436,  431,  437,  438,
+      439,  440,  441,  442,  443,  444,  445,  446,  447,  448,
+      441,  449,  448,  446,  450,  451,  452,  453,  455,  456,
+      457,  458,  459,  460,  458,  461,  463,  464,  463,  465,
+      466,  467,  468,  469,  470,  471,  472,  473,  474,  472,
+      475,  476,  477,  478,  479,  480,  481,  482,  483,  484,
+      485,  486,  480,  487,  488,  489,  490,  491,  486,  492,
+      489,  493,  489,  494,  495,  476,  496,  497,  489,  498,
+      489,  497,  499,  489,  489,  500,  501,  502,  503,  504,
+      489,  505,  506,  507,  508,  509,  510,  511,  512,  503,
+
+      509,  513,  514,  515,  512,  516,  517,  518,  519,  520,
+      506,  522,  523,  524,  520,  525,  526,  527,  528,  529,
+      530,  531,  532,  533,  534,  531,  535,  536,  537,  538,
+      539,  540,  534,  536,  541,  542,  543,  535,  544,  545,
+      546,  547,  549,  548,  550,  551,  552,  546,  548,  553,
+      546,  554,  555,  556,  557,  558,  559,  560,  561,  562,
+      563,  564,  565,  566,  567,  568,  569,  570,  571,  572,
+      573,  574,  575,  576,  577,  578,  579,  575,  567,  580,
+      556,  575,  581,  582,  583,  584,  585,  586,  577,  587,
+      588,  589,  590,  591,  592,  593,  594,  595,  596,  597,
+
+      598,  599,  600,  601,  602,  603,  592,  604,  605,  586,
+      606,  605,  607,  608,  609,  610,  611,  612,  613,  614,
+      615,  616,  617,  618,  619,  620,  620,  617,  621,  622,
+      623,  624,  625,  626,  627,  628,  629,  630,  631,  632,
+      633,  634,  630,  635,  634,  636,  637,  638,  626,  639,
+      640,  641,  642,  643,  643,  644,  645,  646,  647,  648,
+      632,  649,  650,  651,  652,  653,  654,  655,  656,  657,
+      658,  659,  660,  661,  661,  662,  663,  664,  665,  666,
+      667,  668,  669,  670,  671,  672,  673,  675,  674,  676,
+      677,  678,  679,  680,  681,  682,  683,  684,  668,  674,
+
+      685,  686,  687,  688,  689,  690,  691,  692,  693,  694,
+      695,  696,  697,  698,  700,  695,  701,  702,  703,  696,
+      704,  705,  706,  707,  708,  694,  709,  710,  711,  712,
+      713,  715,  721,  722,  713,  718,  722,  713,  708,  723,
+      718,  724,  725,  726,  713,  727,  728,  713,  729,  730,
+      731,  732,  732,  733,  732,  734,  735,  732,  736,  737,
+      738,  739,  732,  740,  741,  742,  743,  744,  732,  732,
+      745,  746,  747,  748,  749,  750,  751,  752,  748,  753,
+      754,  755,  756,  757,  758,  759,  760,  761,  762,  763,
+      764,  765,  767,  768,  769,  770,  765,  771,  772,  773,
+
+      761,  774,  775,  776,  777,  778,  779,  780,  781,  782,
+      783,  784,  785,  786,  787,  789,  790,  791,  792,  793,
+      794,  795,  796,  797,  798,  799,  800,  801,  802,  803,
+      805,  802,  806,  807,  808,  809,  810,  803,  811,  812,
+      813,  814,  815,  816,  817,  818,  819,  820,  808,  821,
+      822,  823,  824,  825,  816,  826,  827,  828,  829,  830,
+      831,  832,  833,  834,  835,  836,  837,  838,  839,  840,
+      841,  842,  843,  844,  845,  846,  847,  848,  849,  839,
+      850,  851,  852,  853,  847,  854,  855,  856,  857,  851,
+      855,  858,  859,  860,  861,  862,  863,  864,  865,  866,
+
+      867,  868,  869,  871,  872,  874,  875,  877,  876,  878,
+      876,  879,  880,  881,  876,  882,  876,  883,  881,  884,
+      885,  876,  886,  887,  888,  871,  876,  889,  887,  890,
+      891,  892,  893,  894,  895,  896,  897,  898,  899,  900,
+      891,  901,  896,  902,  903,  904,  905,  906,  907,  908,
+      909,  905,  900,  905,  910,  911,  912,  913,  906,  905,
+      912,  914,  915,  916,  905,  905,  917,  918,  919,  921,
+      922,  905,  923,  924,  925,  926,  927,  928,  929,  930,
+      930,  928,  931,  932,  933,  922,  934,  935,  936,  937,
+      938,  939,  924,  940,  941,  942,  943,  945,  947,  948,
+
+      949,  950,  951,  952,  953,  954,  955,  956,  957,  958,
+      959,  942,  960,  961,  962,  964,  965,  966,  967,  968,
+      966,  965,  969,  970,  971,  972,  973,  974,  975,  976,
+      977,  978,  979,  980,  981,  982,  983,  984,  986,  987,
+      988,  989,  990,  991,  992,  993,  994,  995,  996,  997,
+      998,  978,  999, 1000, 1001, 1002, 1003, 1004, 1005, 1006,
+     1007, 1009, 1010,  991, 1011, 1012, 1013, 1014, 1015, 1016,
+     1017, 1018, 1019, 1020, 1021, 1022, 1023, 1024, 1021, 1025,
+     1026, 1027, 1028, 1029, 1030, 1031, 1032, 1033, 1034, 1035,
+     1036, 1037, 1038, 1040, 1041, 1042, 1044, 1045, 1046, 1047,
+
+     1048, 1038, 1049, 1050, 1051, 1052, 1034, 1053, 1054, 1055,
+     1056, 1057, 1054, 1058, 1059, 1060, 1061, 1062, 1063, 1065,
+     1061, 1066, 1067, 1068, 1069, 1070, 1071, 1073, 1074, 1075,
+     1076, 1077, 1078, 1079, 1080, 1071, 1069, 1071, 1081, 1082,
+     1071, 1083, 1084, 1086, 1087, 1088, 1089, 1090, 1091, 1092,
+     1093, 1094, 1095, 1096, 1097, 1098, 1099, 1100, 1101, 1101,
+     1102, 1103, 1091, 1104, 1105, 1106, 1107, 1108, 1109, 1111,
+     1112, 1113, 1114, 1115, 1116, 1117, 1118, 1119, 1113, 1120,
+     1117, 1121, 1122, 1123, 1124, 1122, 1122, 1125, 1126, 1127,
+     1122, 1128, 1129, 1130, 1131, 1132, 1122, 1133, 1120, 1134,
+
+     1122, 1135, 1136, 1135, 1137, 1138, 1139, 1140, 1141, 1142,
+     1143, 1144, 1145, 1146, 1147, 1148, 1149, 1150, 1151, 1153,
+     1152, 1155, 1150, 1156, 1150, 1153, 1150, 1152, 1150, 1157,
+     1158, 1159, 1160, 1161, 1162, 1163, 1159, 1164, 1165, 1160,
+     1166, 1167, 1168, 1169, 1170, 1171, 1172, 1173, 1174, 1175,
+     1176, 1177, 1173, 1178, 1179, 1176, 1181, 1182, 1181, 1183,
+     1184, 1185, 1186, 1187, 1188, 1189, 1190, 1191, 1192, 1193,
+     1194, 1195, 1179, 1196, 1197, 1198, 1199, 1200, 1202, 1203,
+     1204, 1205, 1206, 1207, 1208, 1206, 1209, 1210, 1211, 1212,
+     1213, 1214, 1215, 1214, 1215, 1216, 1218, 1219, 1220, 1221,
+
+     1222, 1223, 1224, 1225, 1216, 1225, 1226, 1227, 1228, 1230,
+     1231, 1232, 1207, 1233, 1234, 1228, 1236, 1237, 1238, 1239,
+     1240, 1241, 1242, 1237, 1243, 1240, 1244, 1245, 1246, 1247,
+     1248, 1249, 1251, 1252, 1253, 1254, 1255, 1256, 1252, 1257,
+     1258, 1259, 1260, 1258, 1259, 1261, 1262, 1263, 1264, 1265,
+     1266, 1267, 1268, 1269, 1270, 1271, 1273, 1244, 1274, 1275,
+     1276, 1277, 1278, 1263, 1279, 1280, 1281, 1282, 1283, 1284,
+     1285, 1266, 1286, 1287, 1288, 1289, 1290, 1291, 1292, 1293,
+     1294, 1295, 1288, 1296, 1297, 1297, 1298, 1299, 1300, 1301,
+     1302, 1304, 1305, 1306, 1307, 1308, 1309, 1310, 1311, 1312,
+
+     1313, 1314, 1315, 1316, 1317, 1318, 1319, 1320, 1321, 1317,
+     1318, 1322, 1323, 1324, 1325, 1326, 1327, 1328, 1329, 1330,
+     1331, 1332, 1333, 1334, 1335, 1336, 1337, 1338, 1339, 1340,
+     1341, 1342, 1343, 1344, 1345, 1346, 1347, 1348, 1349, 1350,
+     1351, 1352, 1353, 1347, 1346, 1354, 1351, 1356, 1357, 1354,
+     1358, 1359, 1360, 1361, 1362, 1363, 1364, 1365, 1366, 1367,
+     1368, 1358, 1354, 1369, 1370, 1371, 1373, 1375, 1376, 1377,
+     1378, 1379, 1381, 1383, 1384, 1385, 1386, 1388, 1389, 1390,
+     1391, 1392, 1393, 1394, 1395, 1396, 1397, 1398, 1399, 1400,
+     1401, 1402, 1403, 1404, 1405, 1406, 1407, 1408, 1409, 1410,
+
+     1411, 1412, 1413, 1414, 1415, 1416, 1417, 1418, 1420, 1421,
+     1414, 1422, 1423, 1425, 1415, 1424, 1424, 1426, 1427, 1428,
+     1429, 1430, 1431, 1403, 1432, 1433, 1434, 1435, 1434, 1436,
+     1437, 1438, 1440, 1441, 1442, 1443, 1445, 1446, 1447, 1448,
+     1449, 1450, 1451, 1452, 1453, 1454, 1455, 1443, 1456, 1457,
+     1458, 1456, 1459, 1460, 1461, 1462, 1446, 1463, 1464, 1465,
+     1466, 1467, 1468, 1456, 1469, 1470, 1469, 1471, 1472, 1473,
+     1474, 1475, 1476, 1477, 1478, 1479, 1480, 1478, 1481, 1482,
+     1483, 1484, 1485, 1486, 1487, 1488, 1489, 1490, 1491, 1492,
+     1493, 1494, 1495, 1495, 1497, 1498, 1499, 1500, 1501, 1502,
+
+     1503, 1504, 1505, 1506, 1507, 1508, 1509, 1513, 1508, 1511,
+     1514, 1515, 1507, 1516, 1511, 1517, 1509, 1518, 1519, 1520,
+     1521, 1522, 1523, 1524, 1525, 1526, 1526, 1527, 1528, 1529,
+     1530, 1531, 1532, 1533, 1531, 1525, 1534, 1535, 1536, 1537,
+     1538, 1539, 1540, 1541, 1543, 1544, 1545, 1546, 1533, 1547,
+     1548, 1549, 1550, 1551, 1552, 1550, 1553, 1554, 1555, 1557,
+     1558, 1559, 1560, 1555, 1561, 1549, 1562, 1563, 1564, 1566,
+     1567, 1568, 1566, 1569, 1570, 1571, 1572, 1574, 1576, 1577,
+     1578, 1571, 1579, 1564, 1580, 1581, 1582, 1583, 1584, 1585,
+     1586, 1587, 1588, 1589, 1590, 1591, 1592, 1593, 1594, 1595,
+
+     1596, 1597, 1598, 1596, 1600, 1601, 1603, 1602, 1604, 1605,
+     1606, 1585, 1602, 1607, 1608, 1610, 1611, 1611, 1612, 1608,
+     1613, 1614, 1615, 1616, 1617, 1619, 1618, 1614, 1618, 1620,
+     1621, 1622, 1623, 1624, 1625, 1626, 1627, 1628, 1629, 1631,
+     1632, 1633, 1634, 1635, 1636, 1637, 1638, 1639, 1640, 1641,
+     1642, 1643, 1628, 1644, 1645, 1646, 1647, 1648, 1649, 1650,
+     1651, 1652, 1636, 1653, 1654, 1655, 1656, 1658, 1657, 1647,
+     1657, 1659, 1660, 1661, 1662, 1663, 1664, 1665, 1666, 1667,
+     1668, 1669, 1671, 1652, 1672, 1673, 1658, 1674, 1675, 1676,
+     1677, 1678, 1679, 1680, 1682, 1681, 1681, 1681, 1683, 1684,
+
+     1676, 1681, 1681, 1685, 1687, 1688, 1689, 1690, 1691, 1687,
+     1688, 1692, 1693, 1694, 1695, 1696, 1697, 1698, 1699, 1700,
+     1701, 1702, 1703, 1706, 1690, 1707, 1708, 1710, 1711, 1712,
+     1713, 1714, 1715, 1716, 1717, 1718, 1719, 1697, 1720, 1721,
+     1722, 1723, 1724, 1725, 1719, 1726, 1728, 1726, 1729, 1730,
+     1731, 1732, 1733, 1734, 1735, 1736, 1737, 1738, 1739, 1740,
+     1741, 1742, 1743, 1744, 1745, 1746, 1747, 1739, 1748, 1750,
+     1751, 1752, 1754, 1755, 1756, 1757, 1758, 1759, 1760, 1761,
+     1762, 1763, 1738, 1755, 1748, 1762, 1764, 1765, 1756, 1766,
+     1767, 1768, 1769, 1770, 1765, 1771, 1772, 1773, 1774, 1775,
+
+     1776, 1778, 1779, 1780, 1781, 1782, 1783, 1779, 1784, 1785,
+     1786, 1787, 1788, 1789, 1785, 1784, 1790, 1791, 1793, 1794,
+     1795, 1796, 1797, 1798, 1799, 1800, 1802, 1801, 1804, 1805,
+     1806, 1808, 1809, 1810, 1811, 1812, 1813, 1814, 1815, 1799,
+     1801, 1816, 1817, 1819, 1821, 1822, 1823, 1825, 1826, 1827,
+     1828, 1829, 1830, 1797, 1831, 1832, 1833, 1834, 1835, 1836,
+     1837, 1838, 1839, 1840, 1842, 1843, 1844, 1845, 1846, 1840,
+     1847, 1848, 1849, 1850, 1853, 1842, 1855, 1856, 1857, 1859,
+     1850, 1860, 1861, 1862, 1863, 1866, 1859, 1864, 1848, 1867,
+     1864, 1868, 1870, 1871, 1856, 1872, 1873, 1874, 1875, 1876,
+
+     1877, 1878, 1879, 1880, 1881, 1883, 1862, 1884, 1885, 1886,
+     1887, 1888, 1889, 1890, 1892, 1893, 1879, 1881, 1894, 1895,
+     1896, 1898, 1900, 1901, 1902, 1903, 1904, 1906, 1907, 1908,
+     1909, 1910, 1911, 1912, 1913, 1914, 1915, 1916, 1917, 1918,
+     1919, 1920, 1921, 1922, 1923, 1924, 1926, 1927, 1928, 1929,
+     1930, 1931, 1932, 1933, 1934, 1935, 1936, 1937, 1938, 1939,
+     1940, 1941, 1942, 1935, 1943, 1942, 1944, 1945, 1946, 1947,
+     1948, 1949, 1945, 1951, 1952, 1953, 1955, 1956, 1957, 1958,
+     1959, 1960, 1961, 1962, 1963, 1964, 1966, 1967, 1968, 1969,
+     1970, 1971, 1974, 1975, 1962, 1976, 1978, 1979, 1980, 1978,
+
+     1981, 1982, 1979, 1983, 1984, 1985, 1986, 1987, 1976, 1988,
+     1989, 1989, 1990, 1991, 1992, 1993, 1994, 1995, 1996, 1997,
+     1993, 1998, 2001, 2002, 2003, 1997, 2004, 1982, 2005, 2006,
+     2007, 2008, 2009, 2010, 1996, 2011, 2012, 2002, 2013, 2015,
+     2016, 2017, 2019, 2020, 2021, 2022, 2023, 2024, 2002, 2025,
+     2026, 2027, 2028, 2029, 2030, 2031, 2032, 2033, 2034, 2035,
+     2036, 2038, 2039, 2040, 2041, 2042, 2043, 2044, 2045, 2046,
+     2044, 2047, 2049, 2050, 2051, 2052, 2054, 2053, 2055, 2056,
+     2057, 2030, 2053, 2058, 2042, 2059, 2060, 2061, 2062, 2063,
+     2064, 2062, 2066, 2067, 2068, 2069, 2070, 2071, 2072, 2073,
+
+     2074, 2075, 2076, 2077, 2078, 2079, 2080, 2081, 2082, 2083,
+     2084, 2081, 2083, 2085, 2086, 2088, 2089, 2090, 2091, 2092,
+     2093, 2094, 2095, 2096, 2095, 2097, 2098, 2099, 2100, 2101,
+     2102, 2104, 2105, 2106, 2107, 2108, 2109, 2110, 2111, 2113,
+     2097, 2114, 2115, 2116, 2117, 2118, 2119, 2120, 2121, 2107,
+     2122, 2124, 2125, 2126, 2127, 2128, 2129, 2130, 2131, 2132,
+     2121, 2133, 2135, 2136, 2137, 2138, 2139, 2122, 2129, 2130,
+     2140, 2141, 2118, 2142, 2143, 2144, 2145, 2146, 2147, 2138,
+     2131, 2148, 2149, 2150, 2151, 2152, 2153, 2154, 2155, 2156,
+     2137, 2158, 2159, 2161, 2162, 2163, 2164, 2166, 2168, 2166,
+
+     2169, 2170, 2171, 2172, 2164, 2174, 2175, 2176, 2177, 2179,
+     2180, 2168, 2181, 2182, 2183, 2184, 2186, 2187, 2188, 2189,
+     2190, 2191, 2192, 2193, 2194, 2195, 2196, 2197, 2199, 2200,
+     2201, 2202, 2203, 2204, 2205, 2206, 2207, 2209, 2210, 2211,
+     2212, 2213, 2214, 2215, 2216, 2217, 2218, 2219, 2221, 2222,
+     2223, 2224, 2224, 2225, 2226, 2229, 2230, 2231, 2232, 2233,
+     2235, 2226, 2219, 2236, 2217, 2237, 2238, 2239, 2242, 2244,
+     2246, 2247, 2250, 2251, 2252, 2253, 2254, 2255, 2256, 2257,
+     2232, 2254, 2259, 2261, 2262, 2263, 2264, 2265, 2266, 2267,
+     2269, 2270, 2271, 2273, 2274, 2275, 2276, 2278, 2279, 2280,
+
+     2276, 2281, 2283, 2284, 2285, 2266, 2281, 2286, 2287, 2288,
+     2289, 2290, 2291, 2292, 2293, 2295, 2296, 2297, 2298, 2299,
+     2300, 2301, 2302, 2303, 2304, 2305, 2306, 2307, 2308, 2309,
+     2310, 2311, 2312, 2313, 2314, 2314, 2315, 2316, 2317, 2318,
+     2319, 2320, 2321, 2322, 2323, 2324, 2325, 2326, 2327, 2328,
+     2318, 2329, 2330, 2331, 2332, 2333, 2334, 2335, 2337, 2338,
+     2340, 2339, 2338, 2341, 2340, 2329, 2342, 2343, 2344, 2327,
+     2345, 2330, 2339, 2346, 2348, 2350, 2351, 2352, 2353, 2355,
+     2356, 2357, 2358, 2359, 2360, 2361, 2362, 2364, 2365, 2366,
+     2367, 2369, 2370, 2371, 2372, 2373, 2374, 2375, 2376, 2377,
+
+     2378, 2379, 2380, 2381, 2382, 2383, 2384, 2385, 2386, 2382,
+     2387, 2388, 2389, 2390, 2391, 2392, 2393, 2391, 2394, 2396,
+     2398, 2399, 2400, 2401, 2402, 2403, 2404, 2405, 2407, 2408,
+     2400, 2411, 2412, 2413, 2414, 2415, 2416, 2417, 2418, 2419,
+     2421, 2422, 2423, 2424, 2419, 2426, 2427, 2430, 2424, 2428,
+     2428, 2432, 2433, 2434, 2435, 2436, 2437, 2438, 2439, 2445,
+     2446, 2447, 2448, 2449, 2450, 2451, 2452, 2445, 2450, 2453,
+     2454, 2455, 2457, 2460, 2461, 2462, 2463, 2464, 2465, 2466,
+     2467, 2468, 2469, 2446, 2462, 2471, 2472, 2473, 2474, 2475,
+     2476, 2477, 2478, 2479, 2478, 2480, 2481, 2482, 2483, 2484,
+
+     2485, 2486, 2487, 2488, 2491, 2492, 2493, 2494, 2495, 2496,
+     2497, 2498, 2494, 2499, 2500, 2501, 2502, 2503, 2504, 2506,
+     2507, 2509, 2511, 2512, 2513, 2514, 2515, 2516, 2517, 2518,
+     2522, 2523, 2524, 2525, 2526, 2527, 2528, 2529, 2530, 2531,
+     2533, 2535, 2536, 2537, 2538, 2539, 2540, 2542, 2543, 2544,
+     2545, 2546, 2523, 2547, 2548, 2549, 2551, 2552, 2554, 2555,
+     2556, 2558, 2559, 2560, 2538, 2561, 2555, 2562, 2564, 2566,
+     2568, 2569, 2570, 2572, 2573, 2575, 2576, 2570, 2577, 2578,
+     2579, 2580, 2582, 2584, 2585, 2586, 2587, 2588, 2589, 2590,
+     2591, 2592, 2593, 2594, 2595, 2596, 2597, 2598, 2601, 2602,
+
+     2603, 2604, 2602, 2601, 2605, 2606, 2607, 2608, 2609, 2612,
+     2614, 2605, 2615, 2617, 2618, 2619, 2619, 2620, 2621, 2622,
+     2623, 2624, 2625, 2626, 2627, 2628, 2629, 2630, 2631, 2627,
+     2632, 2633, 2634, 2634, 2635, 2636, 2637, 2638, 2639, 2640,
+     2641, 2643, 2644, 2645, 2647, 2648, 2649, 2650, 2652, 2653,
+     2654, 2648, 2656, 2657, 2659, 2660, 2661, 2659, 2662, 2663,
+     2664, 2665, 2666, 2637, 2667, 2668, 2671, 2666, 2672, 2675,
+     2676, 2677, 2679, 2680, 2683, 2684, 2685, 2686, 2687, 2688,
+     2690, 2692, 2694, 2696, 2680, 2697, 2698, 2699, 2700, 2688,
+     2702, 2703, 2705, 2706, 2703, 2694, 2707, 2708, 2709, 2710,
+
+     2711, 2713, 2714, 2715, 2716, 2717, 2718, 2719, 2720, 2721,
+     2722, 2723, 2725, 2726, 2727, 2729, 2731, 2732, 2733, 2734,
+     2735, 2736, 2737, 2737, 2738, 2739, 2740, 2741, 2742, 2744,
+     2745, 2747, 2749, 2751, 2752, 2753, 2754, 2735, 2753, 2755,
+     2756, 2757, 2758, 2742, 2760, 2761, 2762, 2763, 2765, 2766,
+     2767, 2768, 2770, 2771, 2766, 2773, 2762, 2772, 2772, 2774,
+     2775, 2776, 2777, 2778, 2779, 2780, 2781, 2782, 2783, 2784,
+     2785, 2787, 2788, 2789, 2790, 2794, 2779, 2785, 2795, 2796,
+     2797, 2798, 2799, 2778, 2800, 2802, 2803, 2804, 2805, 2806,
+     2806, 2800, 2807, 2809, 2810, 2811, 2813, 2814, 2815, 2816,
+
+     2817, 2818, 2819, 2820, 2821, 2823, 2824, 2827, 2829, 2830,
+     2831, 2832, 2833, 2834, 2834, 2835, 2836, 2838, 2839, 2840,
+     2841, 2842, 2843, 2844, 2845, 2846, 2847, 2849, 2850, 2852,
+     2854, 2855, 2856, 2857, 2858, 2859, 2860, 2860, 2861, 2862,
+     2864, 2865, 2866, 2867, 2868, 2870, 2871, 2868, 2872, 2873,
+     2874, 2875, 2876, 2876, 2877, 2878, 2881, 2877, 2885, 2882,
+     2886, 2887, 2891, 2893, 2875, 2882, 2887, 2894, 2895, 2895,
+     2895, 2896, 2896, 2897, 2898, 2898, 2899, 2900, 2902, 2904,
+     2905, 2906, 2910, 2911, 2912, 2914, 2917, 2920, 2919, 2921,
+     2922, 2924, 2897, 2925, 2926, 2927, 2928, 2929, 2930, 2933,
+
+     2932, 2931, 2917, 2919, 2931, 2932, 2922, 2926, 2934, 2935,
+     2936, 2937, 2938, 2939, 2940, 2941, 2944, 2946, 2948, 2949,
+     2950, 2951, 2952, 2953, 2954, 2956, 2957, 2959, 2960, 2961,
+     2962, 2965, 2966, 2967, 2968, 2969, 2970, 2971, 2972, 2975,
+     2976, 2977, 2978, 2969, 2976, 2979, 2981, 2982, 2983, 2984,
+     2985, 2986, 2987, 2977, 2989, 2991, 2996, 3001, 2996, 3003,
+     3004, 3005, 3007, 3008, 3010, 3009, 3011, 3013, 3015, 2987,
+     3009, 3014, 3016, 3017, 3018, 3016, 3019, 3020, 3007, 3021,
+     3022, 3014, 3023, 3024, 3025, 3026, 3027, 3027, 3028, 3029,
+     3032, 3033, 3023, 3034, 3035, 3036, 3037, 3038, 3039, 3040,
+
+     3025, 3041, 3042, 3043, 3044, 3045, 3046, 3047, 3027, 3048,
+     3049, 3050, 3051, 3052, 3053, 3054, 3055, 3056, 3058, 3060,
+     3063, 3064, 3065, 3066, 3067, 3068, 3069, 3070, 3071, 3072,
+     3073, 3077, 3078, 3080, 3081, 3083, 3065, 3084, 3085, 3086,
+     3087, 3088, 3089, 3090, 3093, 3094, 3095, 3096, 3097, 3098,
+     3099, 3100, 3101, 3102, 3103, 3104, 3105, 3106, 3107, 3109,
+     3110, 3111, 3112, 3111, 3113, 3114, 3115, 3116, 3118, 3120,
+     3121, 3122, 3123, 3124, 3121, 3125, 3126, 3121, 3127, 3128,
+     3130, 3131, 3132, 3133, 3134, 3135, 3136, 3137, 3138, 3139,
+     3140, 3141, 3142, 3143, 3144, 3145, 3140, 3146, 3148, 3149,
+
+     3151, 3152, 3153, 3154, 3155, 3157, 3158, 3130, 3159, 3160,
+     3161, 3162, 3164, 3165, 3166, 3168, 3171, 3172, 3173, 3174,
+     3175,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0, 3178, 3178,
+     3178, 3178, 3178, 3178, 3178, 3178, 3178, 3178, 3178, 3178,
+     3178, 3178, 3178, 3178, 3178, 3178, 3178, 3178, 3178, 3178,
+     3178, 3178, 3178, 3178, 3178, 3178, 3178, 3178, 3178, 3178,
+     3178, 3178, 3178, 3178, 3178, 3178, 3178, 3178, 3178
     } ;
 
 static yy_state_type yy_last_accepting_state;
@@ -2858,7 +2649,7 @@ static void config_end_include(void)
 #define YY_NO_INPUT 1
 #endif
 
-#line 2860 "<stdout>"
+#line 2651 "<stdout>"
 
 #define INITIAL 0
 #define quotedstring 1
@@ -3081,7 +2872,7 @@ YY_DECL
 	{
 #line 205 "./util/configlexer.lex"
 
-#line 3083 "<stdout>"
+#line 2874 "<stdout>"
 
 	while ( /*CONSTCOND*/1 )		/* loops until end-of-file is reached */
 		{
@@ -3114,13 +2905,13 @@ yy_match:
 			while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
 				{
 				yy_current_state = (int) yy_def[yy_current_state];
-				if ( yy_current_state >= 2905 )
+				if ( yy_current_state >= 3179 )
 					yy_c = yy_meta[(unsigned int) yy_c];
 				}
 			yy_current_state = yy_nxt[yy_base[yy_current_state] + (flex_int16_t) yy_c];
 			++yy_cp;
 			}
-		while ( yy_base[yy_current_state] != 5674 );
+		while ( yy_base[yy_current_state] != 4349 );
 
 yy_find_action:
 		yy_act = yy_accept[yy_current_state];
@@ -3525,1022 +3316,1137 @@ YY_RULE_SETUP
 case 76:
 YY_RULE_SETUP
 #line 284 "./util/configlexer.lex"
-{ YDVAR(1, VAR_NUM_QUERIES_PER_THREAD) }
+{ YDVAR(1, VAR_INFRA_CACHE_RTT_PERCENTILE) }
 	YY_BREAK
 case 77:
 YY_RULE_SETUP
 #line 285 "./util/configlexer.lex"
-{ YDVAR(1, VAR_JOSTLE_TIMEOUT) }
+{ YDVAR(1, VAR_NUM_QUERIES_PER_THREAD) }
 	YY_BREAK
 case 78:
 YY_RULE_SETUP
 #line 286 "./util/configlexer.lex"
-{ YDVAR(1, VAR_DELAY_CLOSE) }
+{ YDVAR(1, VAR_JOSTLE_TIMEOUT) }
 	YY_BREAK
 case 79:
 YY_RULE_SETUP
 #line 287 "./util/configlexer.lex"
-{ YDVAR(1, VAR_TARGET_FETCH_POLICY) }
+{ YDVAR(1, VAR_MESH_CLASS_WEIGHT) }
 	YY_BREAK
 case 80:
 YY_RULE_SETUP
 #line 288 "./util/configlexer.lex"
-{ YDVAR(1, VAR_HARDEN_SHORT_BUFSIZE) }
+{ YDVAR(1, VAR_MESH_CLASS_LIMIT) }
 	YY_BREAK
 case 81:
 YY_RULE_SETUP
 #line 289 "./util/configlexer.lex"
-{ YDVAR(1, VAR_HARDEN_LARGE_QUERIES) }
+{ YDVAR(1, VAR_TRACE_SAMPLE_RATE) }
 	YY_BREAK
 case 82:
 YY_RULE_SETUP
 #line 290 "./util/configlexer.lex"
-{ YDVAR(1, VAR_HARDEN_GLUE) }
+{ YDVAR(1, VAR_TRACE_SLOW_THRESHOLD) }
 	YY_BREAK
 case 83:
 YY_RULE_SETUP
 #line 291 "./util/configlexer.lex"
-{ YDVAR(1, VAR_HARDEN_DNSSEC_STRIPPED) }
+{ YDVAR(1, VAR_WORK_STEALING) }
 	YY_BREAK
 case 84:
 YY_RULE_SETUP
 #line 292 "./util/configlexer.lex"
-{ YDVAR(1, VAR_HARDEN_BELOW_NXDOMAIN) }
+{ YDVAR(1, VAR_MESH_FAIR_SHARE) }
 	YY_BREAK
 case 85:
 YY_RULE_SETUP
 #line 293 "./util/configlexer.lex"
-{ YDVAR(1, VAR_HARDEN_REFERRAL_PATH) }
+{ YDVAR(1, VAR_MESH_FAIR_SHARE_PREFIX4) }
 	YY_BREAK
 case 86:
 YY_RULE_SETUP
 #line 294 "./util/configlexer.lex"
-{ YDVAR(1, VAR_HARDEN_ALGO_DOWNGRADE) }
+{ YDVAR(1, VAR_MESH_FAIR_SHARE_PREFIX6) }
 	YY_BREAK
 case 87:
 YY_RULE_SETUP
 #line 295 "./util/configlexer.lex"
-{ YDVAR(1, VAR_USE_CAPS_FOR_ID) }
+{ YDVAR(1, VAR_DELAY_CLOSE) }
 	YY_BREAK
 case 88:
 YY_RULE_SETUP
 #line 296 "./util/configlexer.lex"
-{ YDVAR(1, VAR_CAPS_WHITELIST) }
+{ YDVAR(1, VAR_TARGET_FETCH_POLICY) }
 	YY_BREAK
 case 89:
 YY_RULE_SETUP
 #line 297 "./util/configlexer.lex"
-{ YDVAR(1, VAR_UNWANTED_REPLY_THRESHOLD) }
+{ YDVAR(1, VAR_TARGET_FETCH_PARALLEL) }
 	YY_BREAK
 case 90:
 YY_RULE_SETUP
 #line 298 "./util/configlexer.lex"
-{ YDVAR(1, VAR_PRIVATE_ADDRESS) }
+{ YDVAR(1, VAR_HARDEN_SHORT_BUFSIZE) }
 	YY_BREAK
 case 91:
 YY_RULE_SETUP
 #line 299 "./util/configlexer.lex"
-{ YDVAR(1, VAR_PRIVATE_DOMAIN) }
+{ YDVAR(1, VAR_HARDEN_LARGE_QUERIES) }
 	YY_BREAK
 case 92:
 YY_RULE_SETUP
 #line 300 "./util/configlexer.lex"
-{ YDVAR(1, VAR_PREFETCH_KEY) }
+{ YDVAR(1, VAR_HARDEN_GLUE) }
 	YY_BREAK
 case 93:
 YY_RULE_SETUP
 #line 301 "./util/configlexer.lex"
-{ YDVAR(1, VAR_PREFETCH) }
+{ YDVAR(1, VAR_HARDEN_DNSSEC_STRIPPED) }
 	YY_BREAK
 case 94:
 YY_RULE_SETUP
 #line 302 "./util/configlexer.lex"
-{ YDVAR(1, VAR_DENY_ANY) }
+{ YDVAR(1, VAR_HARDEN_BELOW_NXDOMAIN) }
 	YY_BREAK
 case 95:
 YY_RULE_SETUP
 #line 303 "./util/configlexer.lex"
-{ YDVAR(0, VAR_STUB_ZONE) }
+{ YDVAR(1, VAR_HARDEN_REFERRAL_PATH) }
 	YY_BREAK
 case 96:
 YY_RULE_SETUP
 #line 304 "./util/configlexer.lex"
-{ YDVAR(1, VAR_NAME) }
+{ YDVAR(1, VAR_HARDEN_ALGO_DOWNGRADE) }
 	YY_BREAK
 case 97:
 YY_RULE_SETUP
 #line 305 "./util/configlexer.lex"
-{ YDVAR(1, VAR_STUB_ADDR) }
+{ YDVAR(1, VAR_USE_CAPS_FOR_ID) }
 	YY_BREAK
 case 98:
 YY_RULE_SETUP
 #line 306 "./util/configlexer.lex"
-{ YDVAR(1, VAR_STUB_HOST) }
+{ YDVAR(1, VAR_CAPS_WHITELIST) }
 	YY_BREAK
 case 99:
 YY_RULE_SETUP
 #line 307 "./util/configlexer.lex"
-{ YDVAR(1, VAR_STUB_PRIME) }
+{ YDVAR(1, VAR_UNWANTED_REPLY_THRESHOLD) }
 	YY_BREAK
 case 100:
 YY_RULE_SETUP
 #line 308 "./util/configlexer.lex"
-{ YDVAR(1, VAR_STUB_FIRST) }
+{ YDVAR(1, VAR_PRIVATE_ADDRESS) }
 	YY_BREAK
 case 101:
 YY_RULE_SETUP
 #line 309 "./util/configlexer.lex"
-{ YDVAR(1, VAR_STUB_NO_CACHE) }
+{ YDVAR(1, VAR_PRIVATE_DOMAIN) }
 	YY_BREAK
 case 102:
 YY_RULE_SETUP
 #line 310 "./util/configlexer.lex"
-{ YDVAR(1, VAR_STUB_SSL_UPSTREAM) }
+{ YDVAR(1, VAR_PREFETCH_KEY) }
 	YY_BREAK
 case 103:
 YY_RULE_SETUP
 #line 311 "./util/configlexer.lex"
-{ YDVAR(1, VAR_STUB_SSL_UPSTREAM) }
+{ YDVAR(1, VAR_PREFETCH) }
 	YY_BREAK
 case 104:
 YY_RULE_SETUP
 #line 312 "./util/configlexer.lex"
-{ YDVAR(0, VAR_FORWARD_ZONE) }
+{ YDVAR(1, VAR_DENY_ANY) }
 	YY_BREAK
 case 105:
 YY_RULE_SETUP
 #line 313 "./util/configlexer.lex"
-{ YDVAR(1, VAR_FORWARD_ADDR) }
+{ YDVAR(0, VAR_STUB_ZONE) }
 	YY_BREAK
 case 106:
 YY_RULE_SETUP
 #line 314 "./util/configlexer.lex"
-{ YDVAR(1, VAR_FORWARD_HOST) }
+{ YDVAR(1, VAR_NAME) }
 	YY_BREAK
 case 107:
 YY_RULE_SETUP
 #line 315 "./util/configlexer.lex"
-{ YDVAR(1, VAR_FORWARD_FIRST) }
+{ YDVAR(1, VAR_STUB_ADDR) }
 	YY_BREAK
 case 108:
 YY_RULE_SETUP
 #line 316 "./util/configlexer.lex"
-{ YDVAR(1, VAR_FORWARD_NO_CACHE) }
+{ YDVAR(1, VAR_STUB_HOST) }
 	YY_BREAK
 case 109:
 YY_RULE_SETUP
 #line 317 "./util/configlexer.lex"
-{ YDVAR(1, VAR_FORWARD_SSL_UPSTREAM) }
+{ YDVAR(1, VAR_STUB_PRIME) }
 	YY_BREAK
 case 110:
 YY_RULE_SETUP
 #line 318 "./util/configlexer.lex"
-{ YDVAR(1, VAR_FORWARD_SSL_UPSTREAM) }
+{ YDVAR(1, VAR_STUB_FIRST) }
 	YY_BREAK
 case 111:
 YY_RULE_SETUP
 #line 319 "./util/configlexer.lex"
-{ YDVAR(0, VAR_AUTH_ZONE) }
+{ YDVAR(1, VAR_STUB_NO_CACHE) }
 	YY_BREAK
 case 112:
 YY_RULE_SETUP
 #line 320 "./util/configlexer.lex"
-{ YDVAR(1, VAR_ZONEFILE) }
+{ YDVAR(1, VAR_STUB_SSL_UPSTREAM) }
 	YY_BREAK
 case 113:
 YY_RULE_SETUP
 #line 321 "./util/configlexer.lex"
-{ YDVAR(1, VAR_MASTER) }
+{ YDVAR(1, VAR_STUB_SSL_UPSTREAM) }
 	YY_BREAK
 case 114:
 YY_RULE_SETUP
 #line 322 "./util/configlexer.lex"
-{ YDVAR(1, VAR_URL) }
+{ YDVAR(0, VAR_FORWARD_ZONE) }
 	YY_BREAK
 case 115:
 YY_RULE_SETUP
 #line 323 "./util/configlexer.lex"
-{ YDVAR(1, VAR_ALLOW_NOTIFY) }
+{ YDVAR(1, VAR_FORWARD_ADDR) }
 	YY_BREAK
 case 116:
 YY_RULE_SETUP
 #line 324 "./util/configlexer.lex"
-{ YDVAR(1, VAR_FOR_DOWNSTREAM) }
+{ YDVAR(1, VAR_FORWARD_HOST) }
 	YY_BREAK
 case 117:
 YY_RULE_SETUP
 #line 325 "./util/configlexer.lex"
-{ YDVAR(1, VAR_FOR_UPSTREAM) }
+{ YDVAR(1, VAR_FORWARD_FIRST) }
 	YY_BREAK
 case 118:
 YY_RULE_SETUP
 #line 326 "./util/configlexer.lex"
-{ YDVAR(1, VAR_FALLBACK_ENABLED) }
+{ YDVAR(1, VAR_FORWARD_NO_CACHE) }
 	YY_BREAK
 case 119:
 YY_RULE_SETUP
 #line 327 "./util/configlexer.lex"
-{ YDVAR(0, VAR_VIEW) }
+{ YDVAR(1, VAR_FORWARD_SSL_UPSTREAM) }
 	YY_BREAK
 case 120:
 YY_RULE_SETUP
 #line 328 "./util/configlexer.lex"
-{ YDVAR(1, VAR_VIEW_FIRST) }
+{ YDVAR(1, VAR_FORWARD_SSL_UPSTREAM) }
 	YY_BREAK
 case 121:
 YY_RULE_SETUP
 #line 329 "./util/configlexer.lex"
-{ YDVAR(1, VAR_DO_NOT_QUERY_ADDRESS) }
+{ YDVAR(0, VAR_AUTH_ZONE) }
 	YY_BREAK
 case 122:
 YY_RULE_SETUP
 #line 330 "./util/configlexer.lex"
-{ YDVAR(1, VAR_DO_NOT_QUERY_LOCALHOST) }
+{ YDVAR(1, VAR_ZONEFILE) }
 	YY_BREAK
 case 123:
 YY_RULE_SETUP
 #line 331 "./util/configlexer.lex"
-{ YDVAR(2, VAR_ACCESS_CONTROL) }
+{ YDVAR(1, VAR_MASTER) }
 	YY_BREAK
 case 124:
 YY_RULE_SETUP
 #line 332 "./util/configlexer.lex"
-{ YDVAR(1, VAR_SEND_CLIENT_SUBNET) }
+{ YDVAR(1, VAR_URL) }
 	YY_BREAK
 case 125:
 YY_RULE_SETUP
 #line 333 "./util/configlexer.lex"
-{ YDVAR(1, VAR_CLIENT_SUBNET_ZONE) }
+{ YDVAR(1, VAR_ALLOW_NOTIFY) }
 	YY_BREAK
 case 126:
 YY_RULE_SETUP
 #line 334 "./util/configlexer.lex"
-{ YDVAR(1, VAR_CLIENT_SUBNET_ALWAYS_FORWARD) }
+{ YDVAR(1, VAR_FOR_DOWNSTREAM) }
 	YY_BREAK
 case 127:
 YY_RULE_SETUP
 #line 335 "./util/configlexer.lex"
-{ YDVAR(1, VAR_CLIENT_SUBNET_OPCODE) }
+{ YDVAR(1, VAR_FOR_UPSTREAM) }
 	YY_BREAK
 case 128:
 YY_RULE_SETUP
 #line 336 "./util/configlexer.lex"
-{ YDVAR(1, VAR_MAX_CLIENT_SUBNET_IPV4) }
+{ YDVAR(1, VAR_FALLBACK_ENABLED) }
 	YY_BREAK
 case 129:
 YY_RULE_SETUP
 #line 337 "./util/configlexer.lex"
-{ YDVAR(1, VAR_MAX_CLIENT_SUBNET_IPV6) }
+{ YDVAR(0, VAR_VIEW) }
 	YY_BREAK
 case 130:
 YY_RULE_SETUP
 #line 338 "./util/configlexer.lex"
-{ YDVAR(1, VAR_MIN_CLIENT_SUBNET_IPV4) }
+{ YDVAR(1, VAR_VIEW_FIRST) }
 	YY_BREAK
 case 131:
 YY_RULE_SETUP
 #line 339 "./util/configlexer.lex"
-{ YDVAR(1, VAR_MIN_CLIENT_SUBNET_IPV6) }
+{ YDVAR(1, VAR_DO_NOT_QUERY_ADDRESS) }
 	YY_BREAK
 case 132:
 YY_RULE_SETUP
 #line 340 "./util/configlexer.lex"
-{ YDVAR(1, VAR_MAX_ECS_TREE_SIZE_IPV4) }
+{ YDVAR(1, VAR_DO_NOT_QUERY_LOCALHOST) }
 	YY_BREAK
 case 133:
 YY_RULE_SETUP
 #line 341 "./util/configlexer.lex"
-{ YDVAR(1, VAR_MAX_ECS_TREE_SIZE_IPV6) }
+{ YDVAR(2, VAR_ACCESS_CONTROL) }
 	YY_BREAK
 case 134:
 YY_RULE_SETUP
 #line 342 "./util/configlexer.lex"
-{ YDVAR(1, VAR_HIDE_IDENTITY) }
+{ YDVAR(1, VAR_SEND_CLIENT_SUBNET) }
 	YY_BREAK
 case 135:
 YY_RULE_SETUP
 #line 343 "./util/configlexer.lex"
-{ YDVAR(1, VAR_HIDE_VERSION) }
+{ YDVAR(1, VAR_CLIENT_SUBNET_ZONE) }
 	YY_BREAK
 case 136:
 YY_RULE_SETUP
 #line 344 "./util/configlexer.lex"
-{ YDVAR(1, VAR_HIDE_TRUSTANCHOR) }
+{ YDVAR(1, VAR_CLIENT_SUBNET_ALWAYS_FORWARD) }
 	YY_BREAK
 case 137:
 YY_RULE_SETUP
 #line 345 "./util/configlexer.lex"
-{ YDVAR(1, VAR_IDENTITY) }
+{ YDVAR(1, VAR_CLIENT_SUBNET_OPCODE) }
 	YY_BREAK
 case 138:
 YY_RULE_SETUP
 #line 346 "./util/configlexer.lex"
-{ YDVAR(1, VAR_VERSION) }
+{ YDVAR(1, VAR_MAX_CLIENT_SUBNET_IPV4) }
 	YY_BREAK
 case 139:
 YY_RULE_SETUP
 #line 347 "./util/configlexer.lex"
-{ YDVAR(1, VAR_MODULE_CONF) }
+{ YDVAR(1, VAR_MAX_CLIENT_SUBNET_IPV6) }
 	YY_BREAK
 case 140:
 YY_RULE_SETUP
 #line 348 "./util/configlexer.lex"
-{ YDVAR(1, VAR_DLV_ANCHOR) }
+{ YDVAR(1, VAR_MIN_CLIENT_SUBNET_IPV4) }
 	YY_BREAK
 case 141:
 YY_RULE_SETUP
 #line 349 "./util/configlexer.lex"
-{ YDVAR(1, VAR_DLV_ANCHOR_FILE) }
+{ YDVAR(1, VAR_MIN_CLIENT_SUBNET_IPV6) }
 	YY_BREAK
 case 142:
 YY_RULE_SETUP
 #line 350 "./util/configlexer.lex"
-{ YDVAR(1, VAR_TRUST_ANCHOR_FILE) }
+{ YDVAR(1, VAR_MAX_ECS_TREE_SIZE_IPV4) }
 	YY_BREAK
 case 143:
 YY_RULE_SETUP
 #line 351 "./util/configlexer.lex"
-{ YDVAR(1, VAR_AUTO_TRUST_ANCHOR_FILE) }
+{ YDVAR(1, VAR_MAX_ECS_TREE_SIZE_IPV6) }
 	YY_BREAK
 case 144:
 YY_RULE_SETUP
 #line 352 "./util/configlexer.lex"
-{ YDVAR(1, VAR_TRUSTED_KEYS_FILE) }
+{ YDVAR(1, VAR_HIDE_IDENTITY) }
 	YY_BREAK
 case 145:
 YY_RULE_SETUP
 #line 353 "./util/configlexer.lex"
-{ YDVAR(1, VAR_TRUST_ANCHOR) }
+{ YDVAR(1, VAR_HIDE_VERSION) }
 	YY_BREAK
 case 146:
 YY_RULE_SETUP
 #line 354 "./util/configlexer.lex"
-{ YDVAR(1, VAR_TRUST_ANCHOR_SIGNALING) }
+{ YDVAR(1, VAR_HIDE_TRUSTANCHOR) }
 	YY_BREAK
 case 147:
 YY_RULE_SETUP
 #line 355 "./util/configlexer.lex"
-{ YDVAR(1, VAR_ROOT_KEY_SENTINEL) }
+{ YDVAR(1, VAR_IDENTITY) }
 	YY_BREAK
 case 148:
 YY_RULE_SETUP
 #line 356 "./util/configlexer.lex"
-{ YDVAR(1, VAR_VAL_OVERRIDE_DATE) }
+{ YDVAR(1, VAR_VERSION) }
 	YY_BREAK
 case 149:
 YY_RULE_SETUP
 #line 357 "./util/configlexer.lex"
-{ YDVAR(1, VAR_VAL_SIG_SKEW_MIN) }
+{ YDVAR(1, VAR_MODULE_CONF) }
 	YY_BREAK
 case 150:
 YY_RULE_SETUP
 #line 358 "./util/configlexer.lex"
-{ YDVAR(1, VAR_VAL_SIG_SKEW_MAX) }
+{ YDVAR(1, VAR_DLV_ANCHOR) }
 	YY_BREAK
 case 151:
 YY_RULE_SETUP
 #line 359 "./util/configlexer.lex"
-{ YDVAR(1, VAR_BOGUS_TTL) }
+{ YDVAR(1, VAR_DLV_ANCHOR_FILE) }
 	YY_BREAK
 case 152:
 YY_RULE_SETUP
 #line 360 "./util/configlexer.lex"
-{ YDVAR(1, VAR_VAL_CLEAN_ADDITIONAL) }
+{ YDVAR(1, VAR_TRUST_ANCHOR_FILE) }
 	YY_BREAK
 case 153:
 YY_RULE_SETUP
 #line 361 "./util/configlexer.lex"
-{ YDVAR(1, VAR_VAL_PERMISSIVE_MODE) }
+{ YDVAR(1, VAR_AUTO_TRUST_ANCHOR_FILE) }
 	YY_BREAK
 case 154:
 YY_RULE_SETUP
 #line 362 "./util/configlexer.lex"
-{ YDVAR(1, VAR_AGGRESSIVE_NSEC) }
+{ YDVAR(1, VAR_TRUSTED_KEYS_FILE) }
 	YY_BREAK
 case 155:
 YY_RULE_SETUP
 #line 363 "./util/configlexer.lex"
-{ YDVAR(1, VAR_IGNORE_CD_FLAG) }
+{ YDVAR(1, VAR_TRUST_ANCHOR) }
 	YY_BREAK
 case 156:
 YY_RULE_SETUP
 #line 364 "./util/configlexer.lex"
-{ YDVAR(1, VAR_SERVE_EXPIRED) }
+{ YDVAR(1, VAR_TRUST_ANCHOR_SIGNALING) }
 	YY_BREAK
 case 157:
 YY_RULE_SETUP
 #line 365 "./util/configlexer.lex"
-{ YDVAR(1, VAR_SERVE_EXPIRED_TTL) }
+{ YDVAR(1, VAR_ROOT_KEY_SENTINEL) }
 	YY_BREAK
 case 158:
 YY_RULE_SETUP
 #line 366 "./util/configlexer.lex"
-{ YDVAR(1, VAR_SERVE_EXPIRED_TTL_RESET) }
+{ YDVAR(1, VAR_VAL_OVERRIDE_DATE) }
 	YY_BREAK
 case 159:
 YY_RULE_SETUP
 #line 367 "./util/configlexer.lex"
-{ YDVAR(1, VAR_FAKE_DSA) }
+{ YDVAR(1, VAR_VAL_SIG_SKEW_MIN) }
 	YY_BREAK
 case 160:
 YY_RULE_SETUP
 #line 368 "./util/configlexer.lex"
-{ YDVAR(1, VAR_FAKE_SHA1) }
+{ YDVAR(1, VAR_VAL_SIG_SKEW_MAX) }
 	YY_BREAK
 case 161:
 YY_RULE_SETUP
 #line 369 "./util/configlexer.lex"
-{ YDVAR(1, VAR_VAL_LOG_LEVEL) }
+{ YDVAR(1, VAR_BOGUS_TTL) }
 	YY_BREAK
 case 162:
 YY_RULE_SETUP
 #line 370 "./util/configlexer.lex"
-{ YDVAR(1, VAR_KEY_CACHE_SIZE) }
+{ YDVAR(1, VAR_VAL_CLEAN_ADDITIONAL) }
 	YY_BREAK
 case 163:
 YY_RULE_SETUP
 #line 371 "./util/configlexer.lex"
-{ YDVAR(1, VAR_KEY_CACHE_SLABS) }
+{ YDVAR(1, VAR_VAL_PERMISSIVE_MODE) }
 	YY_BREAK
 case 164:
 YY_RULE_SETUP
 #line 372 "./util/configlexer.lex"
-{ YDVAR(1, VAR_NEG_CACHE_SIZE) }
+{ YDVAR(1, VAR_AGGRESSIVE_NSEC) }
 	YY_BREAK
 case 165:
 YY_RULE_SETUP
 #line 373 "./util/configlexer.lex"
-{ 
-				  YDVAR(1, VAR_VAL_NSEC3_KEYSIZE_ITERATIONS) }
+{ YDVAR(1, VAR_SYNTH_INSECURE_DNAME) }
 	YY_BREAK
 case 166:
 YY_RULE_SETUP
-#line 375 "./util/configlexer.lex"
-{ YDVAR(1, VAR_ADD_HOLDDOWN) }
+#line 374 "./util/configlexer.lex"
+{ YDVAR(1, VAR_IGNORE_CD_FLAG) }
 	YY_BREAK
 case 167:
 YY_RULE_SETUP
-#line 376 "./util/configlexer.lex"
-{ YDVAR(1, VAR_DEL_HOLDDOWN) }
+#line 375 "./util/configlexer.lex"
+{ YDVAR(1, VAR_SERVE_EXPIRED) }
 	YY_BREAK
 case 168:
 YY_RULE_SETUP
-#line 377 "./util/configlexer.lex"
-{ YDVAR(1, VAR_KEEP_MISSING) }
+#line 376 "./util/configlexer.lex"
+{ YDVAR(1, VAR_SERVE_EXPIRED_TTL) }
 	YY_BREAK
 case 169:
 YY_RULE_SETUP
-#line 378 "./util/configlexer.lex"
-{ YDVAR(1, VAR_PERMIT_SMALL_HOLDDOWN) }
+#line 377 "./util/configlexer.lex"
+{ YDVAR(1, VAR_SERVE_EXPIRED_TTL_RESET) }
 	YY_BREAK
 case 170:
 YY_RULE_SETUP
-#line 379 "./util/configlexer.lex"
-{ YDVAR(1, VAR_USE_SYSLOG) }
+#line 378 "./util/configlexer.lex"
+{ YDVAR(1, VAR_SERVE_EXPIRED_CLIENT_TIMEOUT) }
 	YY_BREAK
 case 171:
 YY_RULE_SETUP
-#line 380 "./util/configlexer.lex"
-{ YDVAR(1, VAR_LOG_IDENTITY) }
+#line 379 "./util/configlexer.lex"
+{ YDVAR(1, VAR_FAKE_DSA) }
 	YY_BREAK
 case 172:
 YY_RULE_SETUP
-#line 381 "./util/configlexer.lex"
-{ YDVAR(1, VAR_LOG_TIME_ASCII) }
+#line 380 "./util/configlexer.lex"
+{ YDVAR(1, VAR_FAKE_SHA1) }
 	YY_BREAK
 case 173:
 YY_RULE_SETUP
-#line 382 "./util/configlexer.lex"
-{ YDVAR(1, VAR_LOG_QUERIES) }
+#line 381 "./util/configlexer.lex"
+{ YDVAR(1, VAR_VAL_LOG_LEVEL) }
 	YY_BREAK
 case 174:
 YY_RULE_SETUP
-#line 383 "./util/configlexer.lex"
-{ YDVAR(1, VAR_LOG_REPLIES) }
+#line 382 "./util/configlexer.lex"
+{ YDVAR(1, VAR_KEY_CACHE_SIZE) }
 	YY_BREAK
 case 175:
 YY_RULE_SETUP
-#line 384 "./util/configlexer.lex"
-{ YDVAR(1, VAR_LOG_TAG_QUERYREPLY) }
+#line 383 "./util/configlexer.lex"
+{ YDVAR(1, VAR_KEY_CACHE_SLABS) }
 	YY_BREAK
 case 176:
 YY_RULE_SETUP
-#line 385 "./util/configlexer.lex"
-{ YDVAR(1, VAR_LOG_LOCAL_ACTIONS) }
+#line 384 "./util/configlexer.lex"
+{ YDVAR(1, VAR_SIG_CACHE_SIZE) }
 	YY_BREAK
 case 177:
 YY_RULE_SETUP
-#line 386 "./util/configlexer.lex"
-{ YDVAR(1, VAR_LOG_SERVFAIL) }
+#line 385 "./util/configlexer.lex"
+{ YDVAR(1, VAR_SIG_CACHE_SLABS) }
 	YY_BREAK
 case 178:
 YY_RULE_SETUP
-#line 387 "./util/configlexer.lex"
-{ YDVAR(2, VAR_LOCAL_ZONE) }
+#line 386 "./util/configlexer.lex"
+{ YDVAR(1, VAR_VAL_CRYPTO_THREADS) }
 	YY_BREAK
 case 179:
 YY_RULE_SETUP
-#line 388 "./util/configlexer.lex"
-{ YDVAR(1, VAR_LOCAL_DATA) }
+#line 387 "./util/configlexer.lex"
+{ YDVAR(1, VAR_NSEC3_HASH_CACHE_SIZE) }
 	YY_BREAK
 case 180:
 YY_RULE_SETUP
-#line 389 "./util/configlexer.lex"
-{ YDVAR(1, VAR_LOCAL_DATA_PTR) }
+#line 388 "./util/configlexer.lex"
+{ YDVAR(1, VAR_NSEC3_HASH_CACHE_SLABS) }
 	YY_BREAK
 case 181:
 YY_RULE_SETUP
-#line 390 "./util/configlexer.lex"
-{ YDVAR(1, VAR_UNBLOCK_LAN_ZONES) }
+#line 389 "./util/configlexer.lex"
+{ YDVAR(1, VAR_NSEC3_HASH_RATELIMIT) }
 	YY_BREAK
 case 182:
 YY_RULE_SETUP
-#line 391 "./util/configlexer.lex"
-{ YDVAR(1, VAR_INSECURE_LAN_ZONES) }
+#line 390 "./util/configlexer.lex"
+{ YDVAR(1, VAR_NEG_CACHE_SIZE) }
 	YY_BREAK
 case 183:
 YY_RULE_SETUP
-#line 392 "./util/configlexer.lex"
-{ YDVAR(1, VAR_STATISTICS_INTERVAL) }
+#line 391 "./util/configlexer.lex"
+{ 
+				  YDVAR(1, VAR_VAL_NSEC3_KEYSIZE_ITERATIONS) }
 	YY_BREAK
 case 184:
 YY_RULE_SETUP
 #line 393 "./util/configlexer.lex"
-{ YDVAR(1, VAR_STATISTICS_CUMULATIVE) }
+{ YDVAR(1, VAR_ADD_HOLDDOWN) }
 	YY_BREAK
 case 185:
 YY_RULE_SETUP
 #line 394 "./util/configlexer.lex"
-{ YDVAR(1, VAR_EXTENDED_STATISTICS) }
+{ YDVAR(1, VAR_DEL_HOLDDOWN) }
 	YY_BREAK
 case 186:
 YY_RULE_SETUP
 #line 395 "./util/configlexer.lex"
-{ YDVAR(1, VAR_SHM_ENABLE) }
+{ YDVAR(1, VAR_KEEP_MISSING) }
 	YY_BREAK
 case 187:
 YY_RULE_SETUP
 #line 396 "./util/configlexer.lex"
-{ YDVAR(1, VAR_SHM_KEY) }
+{ YDVAR(1, VAR_PERMIT_SMALL_HOLDDOWN) }
 	YY_BREAK
 case 188:
 YY_RULE_SETUP
 #line 397 "./util/configlexer.lex"
-{ YDVAR(0, VAR_REMOTE_CONTROL) }
+{ YDVAR(1, VAR_USE_SYSLOG) }
 	YY_BREAK
 case 189:
 YY_RULE_SETUP
 #line 398 "./util/configlexer.lex"
-{ YDVAR(1, VAR_CONTROL_ENABLE) }
+{ YDVAR(1, VAR_LOG_IDENTITY) }
 	YY_BREAK
 case 190:
 YY_RULE_SETUP
 #line 399 "./util/configlexer.lex"
-{ YDVAR(1, VAR_CONTROL_INTERFACE) }
+{ YDVAR(1, VAR_LOG_TIME_ASCII) }
 	YY_BREAK
 case 191:
 YY_RULE_SETUP
 #line 400 "./util/configlexer.lex"
-{ YDVAR(1, VAR_CONTROL_PORT) }
+{ YDVAR(1, VAR_LOG_QUERIES) }
 	YY_BREAK
 case 192:
 YY_RULE_SETUP
 #line 401 "./util/configlexer.lex"
-{ YDVAR(1, VAR_CONTROL_USE_CERT) }
+{ YDVAR(1, VAR_LOG_REPLIES) }
 	YY_BREAK
 case 193:
 YY_RULE_SETUP
 #line 402 "./util/configlexer.lex"
-{ YDVAR(1, VAR_SERVER_KEY_FILE) }
+{ YDVAR(1, VAR_LOG_TAG_QUERYREPLY) }
 	YY_BREAK
 case 194:
 YY_RULE_SETUP
 #line 403 "./util/configlexer.lex"
-{ YDVAR(1, VAR_SERVER_CERT_FILE) }
+{ YDVAR(1, VAR_LOG_LOCAL_ACTIONS) }
 	YY_BREAK
 case 195:
 YY_RULE_SETUP
 #line 404 "./util/configlexer.lex"
-{ YDVAR(1, VAR_CONTROL_KEY_FILE) }
+{ YDVAR(1, VAR_LOG_SERVFAIL) }
 	YY_BREAK
 case 196:
 YY_RULE_SETUP
 #line 405 "./util/configlexer.lex"
-{ YDVAR(1, VAR_CONTROL_CERT_FILE) }
+{ YDVAR(2, VAR_LOCAL_ZONE) }
 	YY_BREAK
 case 197:
 YY_RULE_SETUP
 #line 406 "./util/configlexer.lex"
-{ YDVAR(1, VAR_PYTHON_SCRIPT) }
+{ YDVAR(1, VAR_LOCAL_DATA) }
 	YY_BREAK
 case 198:
 YY_RULE_SETUP
 #line 407 "./util/configlexer.lex"
-{ YDVAR(0, VAR_PYTHON) }
+{ YDVAR(1, VAR_LOCAL_DATA_PTR) }
 	YY_BREAK
 case 199:
 YY_RULE_SETUP
 #line 408 "./util/configlexer.lex"
-{ YDVAR(1, VAR_DOMAIN_INSECURE) }
+{ YDVAR(1, VAR_UNBLOCK_LAN_ZONES) }
 	YY_BREAK
 case 200:
 YY_RULE_SETUP
 #line 409 "./util/configlexer.lex"
-{ YDVAR(1, VAR_MINIMAL_RESPONSES) }
+{ YDVAR(1, VAR_INSECURE_LAN_ZONES) }
 	YY_BREAK
 case 201:
 YY_RULE_SETUP
 #line 410 "./util/configlexer.lex"
-{ YDVAR(1, VAR_RRSET_ROUNDROBIN) }
+{ YDVAR(1, VAR_STATISTICS_INTERVAL) }
 	YY_BREAK
 case 202:
 YY_RULE_SETUP
 #line 411 "./util/configlexer.lex"
-{ YDVAR(1, VAR_UNKNOWN_SERVER_TIME_LIMIT) }
+{ YDVAR(1, VAR_STATISTICS_CUMULATIVE) }
 	YY_BREAK
 case 203:
 YY_RULE_SETUP
 #line 412 "./util/configlexer.lex"
-{ YDVAR(1, VAR_MAX_UDP_SIZE) }
+{ YDVAR(1, VAR_EXTENDED_STATISTICS) }
 	YY_BREAK
 case 204:
 YY_RULE_SETUP
 #line 413 "./util/configlexer.lex"
-{ YDVAR(1, VAR_DNS64_PREFIX) }
+{ YDVAR(1, VAR_SHM_ENABLE) }
 	YY_BREAK
 case 205:
 YY_RULE_SETUP
 #line 414 "./util/configlexer.lex"
-{ YDVAR(1, VAR_DNS64_SYNTHALL) }
+{ YDVAR(1, VAR_SHM_KEY) }
 	YY_BREAK
 case 206:
 YY_RULE_SETUP
 #line 415 "./util/configlexer.lex"
-{ YDVAR(1, VAR_DNS64_IGNORE_AAAA) }
+{ YDVAR(0, VAR_REMOTE_CONTROL) }
 	YY_BREAK
 case 207:
 YY_RULE_SETUP
 #line 416 "./util/configlexer.lex"
-{ YDVAR(1, VAR_DEFINE_TAG) }
+{ YDVAR(1, VAR_CONTROL_ENABLE) }
 	YY_BREAK
 case 208:
 YY_RULE_SETUP
 #line 417 "./util/configlexer.lex"
-{ YDVAR(2, VAR_LOCAL_ZONE_TAG) }
+{ YDVAR(1, VAR_CONTROL_INTERFACE) }
 	YY_BREAK
 case 209:
 YY_RULE_SETUP
 #line 418 "./util/configlexer.lex"
-{ YDVAR(2, VAR_ACCESS_CONTROL_TAG) }
+{ YDVAR(1, VAR_CONTROL_PORT) }
 	YY_BREAK
 case 210:
 YY_RULE_SETUP
 #line 419 "./util/configlexer.lex"
-{ YDVAR(3, VAR_ACCESS_CONTROL_TAG_ACTION) }
+{ YDVAR(1, VAR_CONTROL_USE_CERT) }
 	YY_BREAK
 case 211:
 YY_RULE_SETUP
 #line 420 "./util/configlexer.lex"
-{ YDVAR(3, VAR_ACCESS_CONTROL_TAG_DATA) }
+{ YDVAR(1, VAR_SERVER_KEY_FILE) }
 	YY_BREAK
 case 212:
 YY_RULE_SETUP
 #line 421 "./util/configlexer.lex"
-{ YDVAR(2, VAR_ACCESS_CONTROL_VIEW) }
+{ YDVAR(1, VAR_SERVER_CERT_FILE) }
 	YY_BREAK
 case 213:
 YY_RULE_SETUP
 #line 422 "./util/configlexer.lex"
-{ YDVAR(3, VAR_LOCAL_ZONE_OVERRIDE) }
+{ YDVAR(1, VAR_CONTROL_KEY_FILE) }
 	YY_BREAK
 case 214:
 YY_RULE_SETUP
 #line 423 "./util/configlexer.lex"
-{ YDVAR(0, VAR_DNSTAP) }
+{ YDVAR(1, VAR_CONTROL_CERT_FILE) }
 	YY_BREAK
 case 215:
 YY_RULE_SETUP
 #line 424 "./util/configlexer.lex"
-{ YDVAR(1, VAR_DNSTAP_ENABLE) }
+{ YDVAR(1, VAR_PYTHON_SCRIPT) }
 	YY_BREAK
 case 216:
 YY_RULE_SETUP
 #line 425 "./util/configlexer.lex"
-{ YDVAR(1, VAR_DNSTAP_SOCKET_PATH) }
+{ YDVAR(0, VAR_PYTHON) }
 	YY_BREAK
 case 217:
 YY_RULE_SETUP
 #line 426 "./util/configlexer.lex"
-{ YDVAR(1, VAR_DNSTAP_SEND_IDENTITY) }
+{ YDVAR(1, VAR_DOMAIN_INSECURE) }
 	YY_BREAK
 case 218:
 YY_RULE_SETUP
 #line 427 "./util/configlexer.lex"
-{ YDVAR(1, VAR_DNSTAP_SEND_VERSION) }
+{ YDVAR(1, VAR_MINIMAL_RESPONSES) }
 	YY_BREAK
 case 219:
 YY_RULE_SETUP
 #line 428 "./util/configlexer.lex"
-{ YDVAR(1, VAR_DNSTAP_IDENTITY) }
+{ YDVAR(1, VAR_RRSET_ROUNDROBIN) }
 	YY_BREAK
 case 220:
 YY_RULE_SETUP
 #line 429 "./util/configlexer.lex"
-{ YDVAR(1, VAR_DNSTAP_VERSION) }
+{ YDVAR(1, VAR_UNKNOWN_SERVER_TIME_LIMIT) }
 	YY_BREAK
 case 221:
 YY_RULE_SETUP
 #line 430 "./util/configlexer.lex"
-{
-		YDVAR(1, VAR_DNSTAP_LOG_RESOLVER_QUERY_MESSAGES) }
+{ YDVAR(1, VAR_MAX_UDP_SIZE) }
 	YY_BREAK
 case 222:
 YY_RULE_SETUP
-#line 432 "./util/configlexer.lex"
-{
-		YDVAR(1, VAR_DNSTAP_LOG_RESOLVER_RESPONSE_MESSAGES) }
+#line 431 "./util/configlexer.lex"
+{ YDVAR(1, VAR_DNS64_PREFIX) }
 	YY_BREAK
 case 223:
 YY_RULE_SETUP
-#line 434 "./util/configlexer.lex"
-{
-		YDVAR(1, VAR_DNSTAP_LOG_CLIENT_QUERY_MESSAGES) }
+#line 432 "./util/configlexer.lex"
+{ YDVAR(1, VAR_DNS64_SYNTHALL) }
 	YY_BREAK
 case 224:
 YY_RULE_SETUP
-#line 436 "./util/configlexer.lex"
-{
-		YDVAR(1, VAR_DNSTAP_LOG_CLIENT_RESPONSE_MESSAGES) }
+#line 433 "./util/configlexer.lex"
+{ YDVAR(1, VAR_DNS64_IGNORE_AAAA) }
 	YY_BREAK
 case 225:
 YY_RULE_SETUP
-#line 438 "./util/configlexer.lex"
-{
-		YDVAR(1, VAR_DNSTAP_LOG_FORWARDER_QUERY_MESSAGES) }
+#line 434 "./util/configlexer.lex"
+{ YDVAR(1, VAR_DEFINE_TAG) }
 	YY_BREAK
 case 226:
 YY_RULE_SETUP
-#line 440 "./util/configlexer.lex"
-{
-		YDVAR(1, VAR_DNSTAP_LOG_FORWARDER_RESPONSE_MESSAGES) }
+#line 435 "./util/configlexer.lex"
+{ YDVAR(2, VAR_LOCAL_ZONE_TAG) }
 	YY_BREAK
 case 227:
 YY_RULE_SETUP
-#line 442 "./util/configlexer.lex"
-{ YDVAR(1, VAR_DISABLE_DNSSEC_LAME_CHECK) }
+#line 436 "./util/configlexer.lex"
+{ YDVAR(2, VAR_ACCESS_CONTROL_TAG) }
 	YY_BREAK
 case 228:
 YY_RULE_SETUP
-#line 443 "./util/configlexer.lex"
-{ YDVAR(1, VAR_IP_RATELIMIT) }
+#line 437 "./util/configlexer.lex"
+{ YDVAR(3, VAR_ACCESS_CONTROL_TAG_ACTION) }
 	YY_BREAK
 case 229:
 YY_RULE_SETUP
-#line 444 "./util/configlexer.lex"
-{ YDVAR(1, VAR_RATELIMIT) }
+#line 438 "./util/configlexer.lex"
+{ YDVAR(3, VAR_ACCESS_CONTROL_TAG_DATA) }
 	YY_BREAK
 case 230:
 YY_RULE_SETUP
-#line 445 "./util/configlexer.lex"
-{ YDVAR(1, VAR_IP_RATELIMIT_SLABS) }
+#line 439 "./util/configlexer.lex"
+{ YDVAR(2, VAR_ACCESS_CONTROL_VIEW) }
 	YY_BREAK
 case 231:
 YY_RULE_SETUP
-#line 446 "./util/configlexer.lex"
-{ YDVAR(1, VAR_RATELIMIT_SLABS) }
+#line 440 "./util/configlexer.lex"
+{ YDVAR(3, VAR_LOCAL_ZONE_OVERRIDE) }
 	YY_BREAK
 case 232:
 YY_RULE_SETUP
-#line 447 "./util/configlexer.lex"
-{ YDVAR(1, VAR_IP_RATELIMIT_SIZE) }
+#line 441 "./util/configlexer.lex"
+{ YDVAR(0, VAR_DNSTAP) }
 	YY_BREAK
 case 233:
 YY_RULE_SETUP
-#line 448 "./util/configlexer.lex"
-{ YDVAR(1, VAR_RATELIMIT_SIZE) }
+#line 442 "./util/configlexer.lex"
+{ YDVAR(1, VAR_DNSTAP_ENABLE) }
 	YY_BREAK
 case 234:
 YY_RULE_SETUP
-#line 449 "./util/configlexer.lex"
-{ YDVAR(2, VAR_RATELIMIT_FOR_DOMAIN) }
+#line 443 "./util/configlexer.lex"
+{ YDVAR(1, VAR_DNSTAP_SOCKET_PATH) }
 	YY_BREAK
 case 235:
 YY_RULE_SETUP
-#line 450 "./util/configlexer.lex"
-{ YDVAR(2, VAR_RATELIMIT_BELOW_DOMAIN) }
+#line 444 "./util/configlexer.lex"
+{ YDVAR(1, VAR_DNSTAP_SEND_IDENTITY) }
 	YY_BREAK
 case 236:
 YY_RULE_SETUP
-#line 451 "./util/configlexer.lex"
-{ YDVAR(1, VAR_IP_RATELIMIT_FACTOR) }
+#line 445 "./util/configlexer.lex"
+{ YDVAR(1, VAR_DNSTAP_SEND_VERSION) }
 	YY_BREAK
 case 237:
 YY_RULE_SETUP
-#line 452 "./util/configlexer.lex"
-{ YDVAR(1, VAR_RATELIMIT_FACTOR) }
+#line 446 "./util/configlexer.lex"
+{ YDVAR(1, VAR_DNSTAP_IDENTITY) }
 	YY_BREAK
 case 238:
 YY_RULE_SETUP
-#line 453 "./util/configlexer.lex"
-{ YDVAR(1, VAR_LOW_RTT) }
+#line 447 "./util/configlexer.lex"
+{ YDVAR(1, VAR_DNSTAP_VERSION) }
 	YY_BREAK
 case 239:
 YY_RULE_SETUP
-#line 454 "./util/configlexer.lex"
-{ YDVAR(1, VAR_FAST_SERVER_NUM) }
+#line 448 "./util/configlexer.lex"
+{
+		YDVAR(1, VAR_DNSTAP_LOG_RESOLVER_QUERY_MESSAGES) }
 	YY_BREAK
 case 240:
 YY_RULE_SETUP
-#line 455 "./util/configlexer.lex"
-{ YDVAR(1, VAR_FAST_SERVER_PERMIL) }
+#line 450 "./util/configlexer.lex"
+{
+		YDVAR(1, VAR_DNSTAP_LOG_RESOLVER_RESPONSE_MESSAGES) }
 	YY_BREAK
 case 241:
 YY_RULE_SETUP
-#line 456 "./util/configlexer.lex"
-{ YDVAR(1, VAR_FAST_SERVER_PERMIL) }
+#line 452 "./util/configlexer.lex"
+{
+		YDVAR(1, VAR_DNSTAP_LOG_CLIENT_QUERY_MESSAGES) }
 	YY_BREAK
 case 242:
 YY_RULE_SETUP
-#line 457 "./util/configlexer.lex"
-{ YDVAR(1, VAR_FAST_SERVER_PERMIL) }
+#line 454 "./util/configlexer.lex"
+{
+		YDVAR(1, VAR_DNSTAP_LOG_CLIENT_RESPONSE_MESSAGES) }
 	YY_BREAK
 case 243:
 YY_RULE_SETUP
-#line 458 "./util/configlexer.lex"
-{ YDVAR(2, VAR_RESPONSE_IP_TAG) }
+#line 456 "./util/configlexer.lex"
+{
+		YDVAR(1, VAR_DNSTAP_LOG_FORWARDER_QUERY_MESSAGES) }
 	YY_BREAK
 case 244:
 YY_RULE_SETUP
-#line 459 "./util/configlexer.lex"
-{ YDVAR(2, VAR_RESPONSE_IP) }
+#line 458 "./util/configlexer.lex"
+{
+		YDVAR(1, VAR_DNSTAP_LOG_FORWARDER_RESPONSE_MESSAGES) }
 	YY_BREAK
 case 245:
 YY_RULE_SETUP
 #line 460 "./util/configlexer.lex"
-{ YDVAR(2, VAR_RESPONSE_IP_DATA) }
+{ YDVAR(1, VAR_DISABLE_DNSSEC_LAME_CHECK) }
 	YY_BREAK
 case 246:
 YY_RULE_SETUP
 #line 461 "./util/configlexer.lex"
-{ YDVAR(0, VAR_DNSCRYPT) }
+{ YDVAR(1, VAR_IP_RATELIMIT) }
 	YY_BREAK
 case 247:
 YY_RULE_SETUP
 #line 462 "./util/configlexer.lex"
-{ YDVAR(1, VAR_DNSCRYPT_ENABLE) }
+{ YDVAR(1, VAR_RATELIMIT) }
 	YY_BREAK
 case 248:
 YY_RULE_SETUP
 #line 463 "./util/configlexer.lex"
-{ YDVAR(1, VAR_DNSCRYPT_PORT) }
+{ YDVAR(1, VAR_IP_RATELIMIT_SLABS) }
 	YY_BREAK
 case 249:
 YY_RULE_SETUP
 #line 464 "./util/configlexer.lex"
-{ YDVAR(1, VAR_DNSCRYPT_PROVIDER) }
+{ YDVAR(1, VAR_RATELIMIT_SLABS) }
 	YY_BREAK
 case 250:
 YY_RULE_SETUP
 #line 465 "./util/configlexer.lex"
-{ YDVAR(1, VAR_DNSCRYPT_SECRET_KEY) }
+{ YDVAR(1, VAR_IP_RATELIMIT_SIZE) }
 	YY_BREAK
 case 251:
 YY_RULE_SETUP
 #line 466 "./util/configlexer.lex"
-{ YDVAR(1, VAR_DNSCRYPT_PROVIDER_CERT) }
+{ YDVAR(1, VAR_RATELIMIT_SIZE) }
 	YY_BREAK
 case 252:
 YY_RULE_SETUP
 #line 467 "./util/configlexer.lex"
-{ YDVAR(1, VAR_DNSCRYPT_PROVIDER_CERT_ROTATED) }
+{ YDVAR(2, VAR_RATELIMIT_FOR_DOMAIN) }
 	YY_BREAK
 case 253:
 YY_RULE_SETUP
 #line 468 "./util/configlexer.lex"
-{
-		YDVAR(1, VAR_DNSCRYPT_SHARED_SECRET_CACHE_SIZE) }
+{ YDVAR(2, VAR_RATELIMIT_BELOW_DOMAIN) }
 	YY_BREAK
 case 254:
 YY_RULE_SETUP
+#line 469 "./util/configlexer.lex"
+{ YDVAR(1, VAR_IP_RATELIMIT_FACTOR) }
+	YY_BREAK
+case 255:
+YY_RULE_SETUP
 #line 470 "./util/configlexer.lex"
+{ YDVAR(1, VAR_RATELIMIT_FACTOR) }
+	YY_BREAK
+case 256:
+YY_RULE_SETUP
+#line 471 "./util/configlexer.lex"
+{ YDVAR(1, VAR_LOW_RTT) }
+	YY_BREAK
+case 257:
+YY_RULE_SETUP
+#line 472 "./util/configlexer.lex"
+{ YDVAR(1, VAR_FAST_SERVER_NUM) }
+	YY_BREAK
+case 258:
+YY_RULE_SETUP
+#line 473 "./util/configlexer.lex"
+{ YDVAR(1, VAR_FAST_SERVER_PERMIL) }
+	YY_BREAK
+case 259:
+YY_RULE_SETUP
+#line 474 "./util/configlexer.lex"
+{ YDVAR(1, VAR_FAST_SERVER_PERMIL) }
+	YY_BREAK
+case 260:
+YY_RULE_SETUP
+#line 475 "./util/configlexer.lex"
+{ YDVAR(1, VAR_HEDGE_PERCENTILE) }
+	YY_BREAK
+case 261:
+YY_RULE_SETUP
+#line 476 "./util/configlexer.lex"
+{ YDVAR(1, VAR_HEDGE_BUDGET) }
+	YY_BREAK
+case 262:
+YY_RULE_SETUP
+#line 477 "./util/configlexer.lex"
+{ YDVAR(1, VAR_REFRESH_POPULAR) }
+	YY_BREAK
+case 263:
+YY_RULE_SETUP
+#line 478 "./util/configlexer.lex"
+{ YDVAR(1, VAR_REFRESH_POPULAR_RATE) }
+	YY_BREAK
+case 264:
+YY_RULE_SETUP
+#line 479 "./util/configlexer.lex"
+{ YDVAR(1, VAR_REFRESH_POPULAR_SIZE) }
+	YY_BREAK
+case 265:
+YY_RULE_SETUP
+#line 480 "./util/configlexer.lex"
+{ YDVAR(1, VAR_FAST_SERVER_PERMIL) }
+	YY_BREAK
+case 266:
+YY_RULE_SETUP
+#line 481 "./util/configlexer.lex"
+{ YDVAR(2, VAR_RESPONSE_IP_TAG) }
+	YY_BREAK
+case 267:
+YY_RULE_SETUP
+#line 482 "./util/configlexer.lex"
+{ YDVAR(2, VAR_RESPONSE_IP) }
+	YY_BREAK
+case 268:
+YY_RULE_SETUP
+#line 483 "./util/configlexer.lex"
+{ YDVAR(2, VAR_RESPONSE_IP_DATA) }
+	YY_BREAK
+case 269:
+YY_RULE_SETUP
+#line 484 "./util/configlexer.lex"
+{ YDVAR(0, VAR_DNSCRYPT) }
+	YY_BREAK
+case 270:
+YY_RULE_SETUP
+#line 485 "./util/configlexer.lex"
+{ YDVAR(1, VAR_DNSCRYPT_ENABLE) }
+	YY_BREAK
+case 271:
+YY_RULE_SETUP
+#line 486 "./util/configlexer.lex"
+{ YDVAR(1, VAR_DNSCRYPT_PORT) }
+	YY_BREAK
+case 272:
+YY_RULE_SETUP
+#line 487 "./util/configlexer.lex"
+{ YDVAR(1, VAR_DNSCRYPT_PROVIDER) }
+	YY_BREAK
+case 273:
+YY_RULE_SETUP
+#line 488 "./util/configlexer.lex"
+{ YDVAR(1, VAR_DNSCRYPT_SECRET_KEY) }
+	YY_BREAK
+case 274:
+YY_RULE_SETUP
+#line 489 "./util/configlexer.lex"
+{ YDVAR(1, VAR_DNSCRYPT_PROVIDER_CERT) }
+	YY_BREAK
+case 275:
+YY_RULE_SETUP
+#line 490 "./util/configlexer.lex"
+{ YDVAR(1, VAR_DNSCRYPT_PROVIDER_CERT_ROTATED) }
+	YY_BREAK
+case 276:
+YY_RULE_SETUP
+#line 491 "./util/configlexer.lex"
+{
+		YDVAR(1, VAR_DNSCRYPT_SHARED_SECRET_CACHE_SIZE) }
+	YY_BREAK
+case 277:
+YY_RULE_SETUP
+#line 493 "./util/configlexer.lex"
 {
 		YDVAR(1, VAR_DNSCRYPT_SHARED_SECRET_CACHE_SLABS) }
 	YY_BREAK
-case 255:
+case 278:
 YY_RULE_SETUP
-#line 472 "./util/configlexer.lex"
+#line 495 "./util/configlexer.lex"
 { YDVAR(1, VAR_DNSCRYPT_NONCE_CACHE_SIZE) }
 	YY_BREAK
-case 256:
+case 279:
 YY_RULE_SETUP
-#line 473 "./util/configlexer.lex"
+#line 496 "./util/configlexer.lex"
 { YDVAR(1, VAR_DNSCRYPT_NONCE_CACHE_SLABS) }
 	YY_BREAK
-case 257:
+case 280:
 YY_RULE_SETUP
-#line 474 "./util/configlexer.lex"
+#line 497 "./util/configlexer.lex"
 { YDVAR(1, VAR_IPSECMOD_ENABLED) }
 	YY_BREAK
-case 258:
+case 281:
 YY_RULE_SETUP
-#line 475 "./util/configlexer.lex"
+#line 498 "./util/configlexer.lex"
 { YDVAR(1, VAR_IPSECMOD_IGNORE_BOGUS) }
 	YY_BREAK
-case 259:
+case 282:
 YY_RULE_SETUP
-#line 476 "./util/configlexer.lex"
+#line 499 "./util/configlexer.lex"
 { YDVAR(1, VAR_IPSECMOD_HOOK) }
 	YY_BREAK
-case 260:
+case 283:
 YY_RULE_SETUP
-#line 477 "./util/configlexer.lex"
+#line 500 "./util/configlexer.lex"
 { YDVAR(1, VAR_IPSECMOD_MAX_TTL) }
 	YY_BREAK
-case 261:
+case 284:
 YY_RULE_SETUP
-#line 478 "./util/configlexer.lex"
+#line 501 "./util/configlexer.lex"
 { YDVAR(1, VAR_IPSECMOD_WHITELIST) }
 	YY_BREAK
-case 262:
+case 285:
 YY_RULE_SETUP
-#line 479 "./util/configlexer.lex"
+#line 502 "./util/configlexer.lex"
 { YDVAR(1, VAR_IPSECMOD_STRICT) }
 	YY_BREAK
-case 263:
+case 286:
 YY_RULE_SETUP
-#line 480 "./util/configlexer.lex"
+#line 503 "./util/configlexer.lex"
 { YDVAR(0, VAR_CACHEDB) }
 	YY_BREAK
-case 264:
+case 287:
 YY_RULE_SETUP
-#line 481 "./util/configlexer.lex"
+#line 504 "./util/configlexer.lex"
 { YDVAR(1, VAR_CACHEDB_BACKEND) }
 	YY_BREAK
-case 265:
+case 288:
 YY_RULE_SETUP
-#line 482 "./util/configlexer.lex"
+#line 505 "./util/configlexer.lex"
 { YDVAR(1, VAR_CACHEDB_SECRETSEED) }
 	YY_BREAK
-case 266:
+case 289:
 YY_RULE_SETUP
-#line 483 "./util/configlexer.lex"
+#line 506 "./util/configlexer.lex"
 { YDVAR(1, VAR_CACHEDB_REDISHOST) }
 	YY_BREAK
-case 267:
+case 290:
 YY_RULE_SETUP
-#line 484 "./util/configlexer.lex"
+#line 507 "./util/configlexer.lex"
 { YDVAR(1, VAR_CACHEDB_REDISPORT) }
 	YY_BREAK
-case 268:
+case 291:
 YY_RULE_SETUP
-#line 485 "./util/configlexer.lex"
+#line 508 "./util/configlexer.lex"
 { YDVAR(1, VAR_CACHEDB_REDISTIMEOUT) }
 	YY_BREAK
-case 269:
+case 292:
 YY_RULE_SETUP
-#line 486 "./util/configlexer.lex"
+#line 509 "./util/configlexer.lex"
 { YDVAR(1, VAR_UDP_UPSTREAM_WITHOUT_DOWNSTREAM) }
 	YY_BREAK
-case 270:
+case 293:
 YY_RULE_SETUP
-#line 487 "./util/configlexer.lex"
+#line 510 "./util/configlexer.lex"
 { YDVAR(2, VAR_TCP_CONNECTION_LIMIT) }
 	YY_BREAK
-case 271:
-/* rule 271 can match eol */
+case 294:
+/* rule 294 can match eol */
 YY_RULE_SETUP
-#line 488 "./util/configlexer.lex"
+#line 511 "./util/configlexer.lex"
 { LEXOUT(("NL\n")); cfg_parser->line++; }
 	YY_BREAK
 /* Quoted strings. Strip leading and ending quotes */
-case 272:
+case 295:
 YY_RULE_SETUP
-#line 491 "./util/configlexer.lex"
+#line 514 "./util/configlexer.lex"
 { BEGIN(quotedstring); LEXOUT(("QS ")); }
 	YY_BREAK
 case YY_STATE_EOF(quotedstring):
-#line 492 "./util/configlexer.lex"
+#line 515 "./util/configlexer.lex"
 {
         yyerror("EOF inside quoted string");
 	if(--num_args == 0) { BEGIN(INITIAL); }
 	else		    { BEGIN(val); }
 }
 	YY_BREAK
-case 273:
+case 296:
 YY_RULE_SETUP
-#line 497 "./util/configlexer.lex"
+#line 520 "./util/configlexer.lex"
 { LEXOUT(("STR(%s) ", yytext)); yymore(); }
 	YY_BREAK
-case 274:
-/* rule 274 can match eol */
+case 297:
+/* rule 297 can match eol */
 YY_RULE_SETUP
-#line 498 "./util/configlexer.lex"
+#line 521 "./util/configlexer.lex"
 { yyerror("newline inside quoted string, no end \""); 
 			  cfg_parser->line++; BEGIN(INITIAL); }
 	YY_BREAK
-case 275:
+case 298:
 YY_RULE_SETUP
-#line 500 "./util/configlexer.lex"
+#line 523 "./util/configlexer.lex"
 {
         LEXOUT(("QE "));
 	if(--num_args == 0) { BEGIN(INITIAL); }
@@ -4553,34 +4459,34 @@ YY_RULE_SETUP
 }
 	YY_BREAK
 /* Single Quoted strings. Strip leading and ending quotes */
-case 276:
+case 299:
 YY_RULE_SETUP
-#line 512 "./util/configlexer.lex"
+#line 535 "./util/configlexer.lex"
 { BEGIN(singlequotedstr); LEXOUT(("SQS ")); }
 	YY_BREAK
 case YY_STATE_EOF(singlequotedstr):
-#line 513 "./util/configlexer.lex"
+#line 536 "./util/configlexer.lex"
 {
         yyerror("EOF inside quoted string");
 	if(--num_args == 0) { BEGIN(INITIAL); }
 	else		    { BEGIN(val); }
 }
 	YY_BREAK
-case 277:
+case 300:
 YY_RULE_SETUP
-#line 518 "./util/configlexer.lex"
+#line 541 "./util/configlexer.lex"
 { LEXOUT(("STR(%s) ", yytext)); yymore(); }
 	YY_BREAK
-case 278:
-/* rule 278 can match eol */
+case 301:
+/* rule 301 can match eol */
 YY_RULE_SETUP
-#line 519 "./util/configlexer.lex"
+#line 542 "./util/configlexer.lex"
 { yyerror("newline inside quoted string, no end '"); 
 			     cfg_parser->line++; BEGIN(INITIAL); }
 	YY_BREAK
-case 279:
+case 302:
 YY_RULE_SETUP
-#line 521 "./util/configlexer.lex"
+#line 544 "./util/configlexer.lex"
 {
         LEXOUT(("SQE "));
 	if(--num_args == 0) { BEGIN(INITIAL); }
@@ -4593,38 +4499,38 @@ YY_RULE_SETUP
 }
 	YY_BREAK
 /* include: directive */
-case 280:
+case 303:
 YY_RULE_SETUP
-#line 533 "./util/configlexer.lex"
+#line 556 "./util/configlexer.lex"
 { 
 	LEXOUT(("v(%s) ", yytext)); inc_prev = YYSTATE; BEGIN(include); }
 	YY_BREAK
 case YY_STATE_EOF(include):
-#line 535 "./util/configlexer.lex"
+#line 558 "./util/configlexer.lex"
 {
         yyerror("EOF inside include directive");
         BEGIN(inc_prev);
 }
 	YY_BREAK
-case 281:
+case 304:
 YY_RULE_SETUP
-#line 539 "./util/configlexer.lex"
+#line 562 "./util/configlexer.lex"
 { LEXOUT(("ISP ")); /* ignore */ }
 	YY_BREAK
-case 282:
-/* rule 282 can match eol */
+case 305:
+/* rule 305 can match eol */
 YY_RULE_SETUP
-#line 540 "./util/configlexer.lex"
+#line 563 "./util/configlexer.lex"
 { LEXOUT(("NL\n")); cfg_parser->line++;}
 	YY_BREAK
-case 283:
+case 306:
 YY_RULE_SETUP
-#line 541 "./util/configlexer.lex"
+#line 564 "./util/configlexer.lex"
 { LEXOUT(("IQS ")); BEGIN(include_quoted); }
 	YY_BREAK
-case 284:
+case 307:
 YY_RULE_SETUP
-#line 542 "./util/configlexer.lex"
+#line 565 "./util/configlexer.lex"
 {
 	LEXOUT(("Iunquotedstr(%s) ", yytext));
 	config_start_include_glob(yytext);
@@ -4632,27 +4538,27 @@ YY_RULE_SETUP
 }
 	YY_BREAK
 case YY_STATE_EOF(include_quoted):
-#line 547 "./util/configlexer.lex"
+#line 570 "./util/configlexer.lex"
 {
         yyerror("EOF inside quoted string");
         BEGIN(inc_prev);
 }
 	YY_BREAK
-case 285:
+case 308:
 YY_RULE_SETUP
-#line 551 "./util/configlexer.lex"
+#line 574 "./util/configlexer.lex"
 { LEXOUT(("ISTR(%s) ", yytext)); yymore(); }
 	YY_BREAK
-case 286:
-/* rule 286 can match eol */
+case 309:
+/* rule 309 can match eol */
 YY_RULE_SETUP
-#line 552 "./util/configlexer.lex"
+#line 575 "./util/configlexer.lex"
 { yyerror("newline before \" in include name"); 
 				  cfg_parser->line++; BEGIN(inc_prev); }
 	YY_BREAK
-case 287:
+case 310:
 YY_RULE_SETUP
-#line 554 "./util/configlexer.lex"
+#line 577 "./util/configlexer.lex"
 {
 	LEXOUT(("IQE "));
 	yytext[yyleng - 1] = '\0';
@@ -4662,7 +4568,7 @@ YY_RULE_SETUP
 	YY_BREAK
 case YY_STATE_EOF(INITIAL):
 case YY_STATE_EOF(val):
-#line 560 "./util/configlexer.lex"
+#line 583 "./util/configlexer.lex"
 {
 	LEXOUT(("LEXEOF "));
 	yy_set_bol(1); /* Set beginning of line, so "^" rules match.  */
@@ -4674,33 +4580,33 @@ case YY_STATE_EOF(val):
 	}
 }
 	YY_BREAK
-case 288:
+case 311:
 YY_RULE_SETUP
-#line 571 "./util/configlexer.lex"
+#line 594 "./util/configlexer.lex"
 { LEXOUT(("unquotedstr(%s) ", yytext)); 
 			if(--num_args == 0) { BEGIN(INITIAL); }
 			yylval.str = strdup(yytext); return STRING_ARG; }
 	YY_BREAK
-case 289:
+case 312:
 YY_RULE_SETUP
-#line 575 "./util/configlexer.lex"
+#line 598 "./util/configlexer.lex"
 {
 	ub_c_error_msg("unknown keyword '%s'", yytext);
 	}
 	YY_BREAK
-case 290:
+case 313:
 YY_RULE_SETUP
-#line 579 "./util/configlexer.lex"
+#line 602 "./util/configlexer.lex"
 {
 	ub_c_error_msg("stray '%s'", yytext);
 	}
 	YY_BREAK
-case 291:
+case 314:
 YY_RULE_SETUP
-#line 583 "./util/configlexer.lex"
+#line 606 "./util/configlexer.lex"
 ECHO;
 	YY_BREAK
-#line 4702 "<stdout>"
+#line 4608 "<stdout>"
 
 	case YY_END_OF_BUFFER:
 		{
@@ -4991,7 +4897,7 @@ static int yy_get_next_buffer (void)
 		while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
 			{
 			yy_current_state = (int) yy_def[yy_current_state];
-			if ( yy_current_state >= 2905 )
+			if ( yy_current_state >= 3179 )
 				yy_c = yy_meta[(unsigned int) yy_c];
 			}
 		yy_current_state = yy_nxt[yy_base[yy_current_state] + (flex_int16_t) yy_c];
@@ -5019,11 +4925,11 @@ static int yy_get_next_buffer (void)
 	while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
 		{
 		yy_current_state = (int) yy_def[yy_current_state];
-		if ( yy_current_state >= 2905 )
+		if ( yy_current_state >= 3179 )
 			yy_c = yy_meta[(unsigned int) yy_c];
 		}
 	yy_current_state = yy_nxt[yy_base[yy_current_state] + (flex_int16_t) yy_c];
-	yy_is_jam = (yy_current_state == 2904);
+	yy_is_jam = (yy_current_state == 3178);
 
 		return yy_is_jam ? 0 : yy_current_state;
 }
@@ -1,8 +1,9 @@
-/* A Bison parser, made by GNU Bison 3.0.5.  */
+/* A Bison parser, made by GNU Bison 3.8.2.  */
 
 /* Bison implementation for Yacc-like parsers in C
 
-   Copyright (C) 1984, 1989-1990, 2000-2015, 2018 Free Software Foundation, Inc.
+   Copyright (C) 1984, 1989-1990, 2000-2015, 2018-2021 Free Software Foundation,
+   Inc.
 
    This program is free software: you can redistribute it and/or modify
    it under the terms of the GNU General Public License as published by
@@ -15,7 +16,7 @@
    GNU General Public License for more details.
 
    You should have received a copy of the GNU General Public License
-   along with this program.  If not, see <http://www.gnu.org/licenses/>.  */
+   along with this program.  If not, see <https://www.gnu.org/licenses/>.  */
 
 /* As a special exception, you may create a larger work that contains
    part or all of the Bison parser skeleton and distribute that work
@@ -33,6 +34,10 @@
 /* C LALR(1) parser skeleton written by Richard Stallman, by
    simplifying the original so-called "semantic" parser.  */
 
+/* DO NOT RELY ON FEATURES THAT ARE NOT DOCUMENTED in the manual,
+   especially those whose name start with YY_ or yy_.  They are
+   private implementation details that can be changed or removed.  */
+
 /* All symbols defined below should begin with yy or YY, to avoid
    infringing on user name space.  This should be done even for local
    variables, as they might otherwise be expanded by user macros.
@@ -40,11 +45,11 @@
    define necessary library symbols; they are noted "INFRINGES ON
    USER NAME SPACE" below.  */
 
-/* Identify Bison output.  */
-#define YYBISON 1
+/* Identify Bison output, and Bison version.  */
+#define YYBISON 30802
 
-/* Bison version.  */
-#define YYBISON_VERSION "3.0.5"
+/* Bison version string.  */
+#define YYBISON_VERSION "3.8.2"
 
 /* Skeleton name.  */
 #define YYSKELETON_NAME "yacc.c"
@@ -61,8 +66,8 @@
 
 
 
-/* Copy the first part of user declarations.  */
-#line 38 "./util/configparser.y" /* yacc.c:339  */
+/* First part of user prologue.  */
+#line 38 "util/configparser.y"
 
 #include "config.h"
 
@@ -91,627 +96,724 @@ extern struct config_parser_state* cfg_parser;
 #endif
 
 
-#line 95 "util/configparser.c" /* yacc.c:339  */
+#line 100 "util/configparser.c"
 
+# ifndef YY_CAST
+#  ifdef __cplusplus
+#   define YY_CAST(Type, Val) static_cast<Type> (Val)
+#   define YY_REINTERPRET_CAST(Type, Val) reinterpret_cast<Type> (Val)
+#  else
+#   define YY_CAST(Type, Val) ((Type) (Val))
+#   define YY_REINTERPRET_CAST(Type, Val) ((Type) (Val))
+#  endif
+# endif
 # ifndef YY_NULLPTR
-#  if defined __cplusplus && 201103L <= __cplusplus
-#   define YY_NULLPTR nullptr
+#  if defined __cplusplus
+#   if 201103L <= __cplusplus
+#    define YY_NULLPTR nullptr
+#   else
+#    define YY_NULLPTR 0
+#   endif
 #  else
-#   define YY_NULLPTR 0
+#   define YY_NULLPTR ((void*)0)
 #  endif
 # endif
 
-/* Enabling verbose error messages.  */
-#ifdef YYERROR_VERBOSE
-# undef YYERROR_VERBOSE
-# define YYERROR_VERBOSE 1
-#else
-# define YYERROR_VERBOSE 0
-#endif
-
-/* In a future release of Bison, this section will be replaced
-   by #include "configparser.h".  */
-#ifndef YY_YY_UTIL_CONFIGPARSER_H_INCLUDED
-# define YY_YY_UTIL_CONFIGPARSER_H_INCLUDED
-/* Debug traces.  */
-#ifndef YYDEBUG
-# define YYDEBUG 0
-#endif
-#if YYDEBUG
-extern int yydebug;
-#endif
-
-/* Token type.  */
-#ifndef YYTOKENTYPE
-# define YYTOKENTYPE
-  enum yytokentype
-  {
-    SPACE = 258,
-    LETTER = 259,
-    NEWLINE = 260,
-    COMMENT = 261,
-    COLON = 262,
-    ANY = 263,
-    ZONESTR = 264,
-    STRING_ARG = 265,
-    VAR_SERVER = 266,
-    VAR_VERBOSITY = 267,
-    VAR_NUM_THREADS = 268,
-    VAR_PORT = 269,
-    VAR_OUTGOING_RANGE = 270,
-    VAR_INTERFACE = 271,
-    VAR_DO_IP4 = 272,
-    VAR_DO_IP6 = 273,
-    VAR_PREFER_IP6 = 274,
-    VAR_DO_UDP = 275,
-    VAR_DO_TCP = 276,
-    VAR_TCP_MSS = 277,
-    VAR_OUTGOING_TCP_MSS = 278,
-    VAR_TCP_IDLE_TIMEOUT = 279,
-    VAR_EDNS_TCP_KEEPALIVE = 280,
-    VAR_EDNS_TCP_KEEPALIVE_TIMEOUT = 281,
-    VAR_CHROOT = 282,
-    VAR_USERNAME = 283,
-    VAR_DIRECTORY = 284,
-    VAR_LOGFILE = 285,
-    VAR_PIDFILE = 286,
-    VAR_MSG_CACHE_SIZE = 287,
-    VAR_MSG_CACHE_SLABS = 288,
-    VAR_NUM_QUERIES_PER_THREAD = 289,
-    VAR_RRSET_CACHE_SIZE = 290,
-    VAR_RRSET_CACHE_SLABS = 291,
-    VAR_OUTGOING_NUM_TCP = 292,
-    VAR_INFRA_HOST_TTL = 293,
-    VAR_INFRA_LAME_TTL = 294,
-    VAR_INFRA_CACHE_SLABS = 295,
-    VAR_INFRA_CACHE_NUMHOSTS = 296,
-    VAR_INFRA_CACHE_LAME_SIZE = 297,
-    VAR_NAME = 298,
-    VAR_STUB_ZONE = 299,
-    VAR_STUB_HOST = 300,
-    VAR_STUB_ADDR = 301,
-    VAR_TARGET_FETCH_POLICY = 302,
-    VAR_HARDEN_SHORT_BUFSIZE = 303,
-    VAR_HARDEN_LARGE_QUERIES = 304,
-    VAR_FORWARD_ZONE = 305,
-    VAR_FORWARD_HOST = 306,
-    VAR_FORWARD_ADDR = 307,
-    VAR_DO_NOT_QUERY_ADDRESS = 308,
-    VAR_HIDE_IDENTITY = 309,
-    VAR_HIDE_VERSION = 310,
-    VAR_IDENTITY = 311,
-    VAR_VERSION = 312,
-    VAR_HARDEN_GLUE = 313,
-    VAR_MODULE_CONF = 314,
-    VAR_TRUST_ANCHOR_FILE = 315,
-    VAR_TRUST_ANCHOR = 316,
-    VAR_VAL_OVERRIDE_DATE = 317,
-    VAR_BOGUS_TTL = 318,
-    VAR_VAL_CLEAN_ADDITIONAL = 319,
-    VAR_VAL_PERMISSIVE_MODE = 320,
-    VAR_INCOMING_NUM_TCP = 321,
-    VAR_MSG_BUFFER_SIZE = 322,
-    VAR_KEY_CACHE_SIZE = 323,
-    VAR_KEY_CACHE_SLABS = 324,
-    VAR_TRUSTED_KEYS_FILE = 325,
-    VAR_VAL_NSEC3_KEYSIZE_ITERATIONS = 326,
-    VAR_USE_SYSLOG = 327,
-    VAR_OUTGOING_INTERFACE = 328,
-    VAR_ROOT_HINTS = 329,
-    VAR_DO_NOT_QUERY_LOCALHOST = 330,
-    VAR_CACHE_MAX_TTL = 331,
-    VAR_HARDEN_DNSSEC_STRIPPED = 332,
-    VAR_ACCESS_CONTROL = 333,
-    VAR_LOCAL_ZONE = 334,
-    VAR_LOCAL_DATA = 335,
-    VAR_INTERFACE_AUTOMATIC = 336,
-    VAR_STATISTICS_INTERVAL = 337,
-    VAR_DO_DAEMONIZE = 338,
-    VAR_USE_CAPS_FOR_ID = 339,
-    VAR_STATISTICS_CUMULATIVE = 340,
-    VAR_OUTGOING_PORT_PERMIT = 341,
-    VAR_OUTGOING_PORT_AVOID = 342,
-    VAR_DLV_ANCHOR_FILE = 343,
-    VAR_DLV_ANCHOR = 344,
-    VAR_NEG_CACHE_SIZE = 345,
-    VAR_HARDEN_REFERRAL_PATH = 346,
-    VAR_PRIVATE_ADDRESS = 347,
-    VAR_PRIVATE_DOMAIN = 348,
-    VAR_REMOTE_CONTROL = 349,
-    VAR_CONTROL_ENABLE = 350,
-    VAR_CONTROL_INTERFACE = 351,
-    VAR_CONTROL_PORT = 352,
-    VAR_SERVER_KEY_FILE = 353,
-    VAR_SERVER_CERT_FILE = 354,
-    VAR_CONTROL_KEY_FILE = 355,
-    VAR_CONTROL_CERT_FILE = 356,
-    VAR_CONTROL_USE_CERT = 357,
-    VAR_EXTENDED_STATISTICS = 358,
-    VAR_LOCAL_DATA_PTR = 359,
-    VAR_JOSTLE_TIMEOUT = 360,
-    VAR_STUB_PRIME = 361,
-    VAR_UNWANTED_REPLY_THRESHOLD = 362,
-    VAR_LOG_TIME_ASCII = 363,
-    VAR_DOMAIN_INSECURE = 364,
-    VAR_PYTHON = 365,
-    VAR_PYTHON_SCRIPT = 366,
-    VAR_VAL_SIG_SKEW_MIN = 367,
-    VAR_VAL_SIG_SKEW_MAX = 368,
-    VAR_CACHE_MIN_TTL = 369,
-    VAR_VAL_LOG_LEVEL = 370,
-    VAR_AUTO_TRUST_ANCHOR_FILE = 371,
-    VAR_KEEP_MISSING = 372,
-    VAR_ADD_HOLDDOWN = 373,
-    VAR_DEL_HOLDDOWN = 374,
-    VAR_SO_RCVBUF = 375,
-    VAR_EDNS_BUFFER_SIZE = 376,
-    VAR_PREFETCH = 377,
-    VAR_PREFETCH_KEY = 378,
-    VAR_SO_SNDBUF = 379,
-    VAR_SO_REUSEPORT = 380,
-    VAR_HARDEN_BELOW_NXDOMAIN = 381,
-    VAR_IGNORE_CD_FLAG = 382,
-    VAR_LOG_QUERIES = 383,
-    VAR_LOG_REPLIES = 384,
-    VAR_LOG_LOCAL_ACTIONS = 385,
-    VAR_TCP_UPSTREAM = 386,
-    VAR_SSL_UPSTREAM = 387,
-    VAR_SSL_SERVICE_KEY = 388,
-    VAR_SSL_SERVICE_PEM = 389,
-    VAR_SSL_PORT = 390,
-    VAR_FORWARD_FIRST = 391,
-    VAR_STUB_SSL_UPSTREAM = 392,
-    VAR_FORWARD_SSL_UPSTREAM = 393,
-    VAR_TLS_CERT_BUNDLE = 394,
-    VAR_STUB_FIRST = 395,
-    VAR_MINIMAL_RESPONSES = 396,
-    VAR_RRSET_ROUNDROBIN = 397,
-    VAR_MAX_UDP_SIZE = 398,
-    VAR_DELAY_CLOSE = 399,
-    VAR_UNBLOCK_LAN_ZONES = 400,
-    VAR_INSECURE_LAN_ZONES = 401,
-    VAR_INFRA_CACHE_MIN_RTT = 402,
-    VAR_DNS64_PREFIX = 403,
-    VAR_DNS64_SYNTHALL = 404,
-    VAR_DNS64_IGNORE_AAAA = 405,
-    VAR_DNSTAP = 406,
-    VAR_DNSTAP_ENABLE = 407,
-    VAR_DNSTAP_SOCKET_PATH = 408,
-    VAR_DNSTAP_SEND_IDENTITY = 409,
-    VAR_DNSTAP_SEND_VERSION = 410,
-    VAR_DNSTAP_IDENTITY = 411,
-    VAR_DNSTAP_VERSION = 412,
-    VAR_DNSTAP_LOG_RESOLVER_QUERY_MESSAGES = 413,
-    VAR_DNSTAP_LOG_RESOLVER_RESPONSE_MESSAGES = 414,
-    VAR_DNSTAP_LOG_CLIENT_QUERY_MESSAGES = 415,
-    VAR_DNSTAP_LOG_CLIENT_RESPONSE_MESSAGES = 416,
-    VAR_DNSTAP_LOG_FORWARDER_QUERY_MESSAGES = 417,
-    VAR_DNSTAP_LOG_FORWARDER_RESPONSE_MESSAGES = 418,
-    VAR_RESPONSE_IP_TAG = 419,
-    VAR_RESPONSE_IP = 420,
-    VAR_RESPONSE_IP_DATA = 421,
-    VAR_HARDEN_ALGO_DOWNGRADE = 422,
-    VAR_IP_TRANSPARENT = 423,
-    VAR_DISABLE_DNSSEC_LAME_CHECK = 424,
-    VAR_IP_RATELIMIT = 425,
-    VAR_IP_RATELIMIT_SLABS = 426,
-    VAR_IP_RATELIMIT_SIZE = 427,
-    VAR_RATELIMIT = 428,
-    VAR_RATELIMIT_SLABS = 429,
-    VAR_RATELIMIT_SIZE = 430,
-    VAR_RATELIMIT_FOR_DOMAIN = 431,
-    VAR_RATELIMIT_BELOW_DOMAIN = 432,
-    VAR_IP_RATELIMIT_FACTOR = 433,
-    VAR_RATELIMIT_FACTOR = 434,
-    VAR_SEND_CLIENT_SUBNET = 435,
-    VAR_CLIENT_SUBNET_ZONE = 436,
-    VAR_CLIENT_SUBNET_ALWAYS_FORWARD = 437,
-    VAR_CLIENT_SUBNET_OPCODE = 438,
-    VAR_MAX_CLIENT_SUBNET_IPV4 = 439,
-    VAR_MAX_CLIENT_SUBNET_IPV6 = 440,
-    VAR_MIN_CLIENT_SUBNET_IPV4 = 441,
-    VAR_MIN_CLIENT_SUBNET_IPV6 = 442,
-    VAR_MAX_ECS_TREE_SIZE_IPV4 = 443,
-    VAR_MAX_ECS_TREE_SIZE_IPV6 = 444,
-    VAR_CAPS_WHITELIST = 445,
-    VAR_CACHE_MAX_NEGATIVE_TTL = 446,
-    VAR_PERMIT_SMALL_HOLDDOWN = 447,
-    VAR_QNAME_MINIMISATION = 448,
-    VAR_QNAME_MINIMISATION_STRICT = 449,
-    VAR_IP_FREEBIND = 450,
-    VAR_DEFINE_TAG = 451,
-    VAR_LOCAL_ZONE_TAG = 452,
-    VAR_ACCESS_CONTROL_TAG = 453,
-    VAR_LOCAL_ZONE_OVERRIDE = 454,
-    VAR_ACCESS_CONTROL_TAG_ACTION = 455,
-    VAR_ACCESS_CONTROL_TAG_DATA = 456,
-    VAR_VIEW = 457,
-    VAR_ACCESS_CONTROL_VIEW = 458,
-    VAR_VIEW_FIRST = 459,
-    VAR_SERVE_EXPIRED = 460,
-    VAR_SERVE_EXPIRED_TTL = 461,
-    VAR_SERVE_EXPIRED_TTL_RESET = 462,
-    VAR_FAKE_DSA = 463,
-    VAR_FAKE_SHA1 = 464,
-    VAR_LOG_IDENTITY = 465,
-    VAR_HIDE_TRUSTANCHOR = 466,
-    VAR_TRUST_ANCHOR_SIGNALING = 467,
-    VAR_AGGRESSIVE_NSEC = 468,
-    VAR_USE_SYSTEMD = 469,
-    VAR_SHM_ENABLE = 470,
-    VAR_SHM_KEY = 471,
-    VAR_ROOT_KEY_SENTINEL = 472,
-    VAR_DNSCRYPT = 473,
-    VAR_DNSCRYPT_ENABLE = 474,
-    VAR_DNSCRYPT_PORT = 475,
-    VAR_DNSCRYPT_PROVIDER = 476,
-    VAR_DNSCRYPT_SECRET_KEY = 477,
-    VAR_DNSCRYPT_PROVIDER_CERT = 478,
-    VAR_DNSCRYPT_PROVIDER_CERT_ROTATED = 479,
-    VAR_DNSCRYPT_SHARED_SECRET_CACHE_SIZE = 480,
-    VAR_DNSCRYPT_SHARED_SECRET_CACHE_SLABS = 481,
-    VAR_DNSCRYPT_NONCE_CACHE_SIZE = 482,
-    VAR_DNSCRYPT_NONCE_CACHE_SLABS = 483,
-    VAR_IPSECMOD_ENABLED = 484,
-    VAR_IPSECMOD_HOOK = 485,
-    VAR_IPSECMOD_IGNORE_BOGUS = 486,
-    VAR_IPSECMOD_MAX_TTL = 487,
-    VAR_IPSECMOD_WHITELIST = 488,
-    VAR_IPSECMOD_STRICT = 489,
-    VAR_CACHEDB = 490,
-    VAR_CACHEDB_BACKEND = 491,
-    VAR_CACHEDB_SECRETSEED = 492,
-    VAR_CACHEDB_REDISHOST = 493,
-    VAR_CACHEDB_REDISPORT = 494,
-    VAR_CACHEDB_REDISTIMEOUT = 495,
-    VAR_UDP_UPSTREAM_WITHOUT_DOWNSTREAM = 496,
-    VAR_FOR_UPSTREAM = 497,
-    VAR_AUTH_ZONE = 498,
-    VAR_ZONEFILE = 499,
-    VAR_MASTER = 500,
-    VAR_URL = 501,
-    VAR_FOR_DOWNSTREAM = 502,
-    VAR_FALLBACK_ENABLED = 503,
-    VAR_TLS_ADDITIONAL_PORT = 504,
-    VAR_LOW_RTT = 505,
-    VAR_LOW_RTT_PERMIL = 506,
-    VAR_FAST_SERVER_PERMIL = 507,
-    VAR_FAST_SERVER_NUM = 508,
-    VAR_ALLOW_NOTIFY = 509,
-    VAR_TLS_WIN_CERT = 510,
-    VAR_TCP_CONNECTION_LIMIT = 511,
-    VAR_FORWARD_NO_CACHE = 512,
-    VAR_STUB_NO_CACHE = 513,
-    VAR_LOG_SERVFAIL = 514,
-    VAR_DENY_ANY = 515,
-    VAR_UNKNOWN_SERVER_TIME_LIMIT = 516,
-    VAR_LOG_TAG_QUERYREPLY = 517,
-    VAR_STREAM_WAIT_SIZE = 518,
-    VAR_TLS_CIPHERS = 519,
-    VAR_TLS_CIPHERSUITES = 520,
-    VAR_TLS_SESSION_TICKET_KEYS = 521
-  };
-#endif
-/* Tokens.  */
-#define SPACE 258
-#define LETTER 259
-#define NEWLINE 260
-#define COMMENT 261
-#define COLON 262
-#define ANY 263
-#define ZONESTR 264
-#define STRING_ARG 265
-#define VAR_SERVER 266
-#define VAR_VERBOSITY 267
-#define VAR_NUM_THREADS 268
-#define VAR_PORT 269
-#define VAR_OUTGOING_RANGE 270
-#define VAR_INTERFACE 271
-#define VAR_DO_IP4 272
-#define VAR_DO_IP6 273
-#define VAR_PREFER_IP6 274
-#define VAR_DO_UDP 275
-#define VAR_DO_TCP 276
-#define VAR_TCP_MSS 277
-#define VAR_OUTGOING_TCP_MSS 278
-#define VAR_TCP_IDLE_TIMEOUT 279
-#define VAR_EDNS_TCP_KEEPALIVE 280
-#define VAR_EDNS_TCP_KEEPALIVE_TIMEOUT 281
-#define VAR_CHROOT 282
-#define VAR_USERNAME 283
-#define VAR_DIRECTORY 284
-#define VAR_LOGFILE 285
-#define VAR_PIDFILE 286
-#define VAR_MSG_CACHE_SIZE 287
-#define VAR_MSG_CACHE_SLABS 288
-#define VAR_NUM_QUERIES_PER_THREAD 289
-#define VAR_RRSET_CACHE_SIZE 290
-#define VAR_RRSET_CACHE_SLABS 291
-#define VAR_OUTGOING_NUM_TCP 292
-#define VAR_INFRA_HOST_TTL 293
-#define VAR_INFRA_LAME_TTL 294
-#define VAR_INFRA_CACHE_SLABS 295
-#define VAR_INFRA_CACHE_NUMHOSTS 296
-#define VAR_INFRA_CACHE_LAME_SIZE 297
-#define VAR_NAME 298
-#define VAR_STUB_ZONE 299
-#define VAR_STUB_HOST 300
-#define VAR_STUB_ADDR 301
-#define VAR_TARGET_FETCH_POLICY 302
-#define VAR_HARDEN_SHORT_BUFSIZE 303
-#define VAR_HARDEN_LARGE_QUERIES 304
-#define VAR_FORWARD_ZONE 305
-#define VAR_FORWARD_HOST 306
-#define VAR_FORWARD_ADDR 307
-#define VAR_DO_NOT_QUERY_ADDRESS 308
-#define VAR_HIDE_IDENTITY 309
-#define VAR_HIDE_VERSION 310
-#define VAR_IDENTITY 311
-#define VAR_VERSION 312
-#define VAR_HARDEN_GLUE 313
-#define VAR_MODULE_CONF 314
-#define VAR_TRUST_ANCHOR_FILE 315
-#define VAR_TRUST_ANCHOR 316
-#define VAR_VAL_OVERRIDE_DATE 317
-#define VAR_BOGUS_TTL 318
-#define VAR_VAL_CLEAN_ADDITIONAL 319
-#define VAR_VAL_PERMISSIVE_MODE 320
-#define VAR_INCOMING_NUM_TCP 321
-#define VAR_MSG_BUFFER_SIZE 322
-#define VAR_KEY_CACHE_SIZE 323
-#define VAR_KEY_CACHE_SLABS 324
-#define VAR_TRUSTED_KEYS_FILE 325
-#define VAR_VAL_NSEC3_KEYSIZE_ITERATIONS 326
-#define VAR_USE_SYSLOG 327
-#define VAR_OUTGOING_INTERFACE 328
-#define VAR_ROOT_HINTS 329
-#define VAR_DO_NOT_QUERY_LOCALHOST 330
-#define VAR_CACHE_MAX_TTL 331
-#define VAR_HARDEN_DNSSEC_STRIPPED 332
-#define VAR_ACCESS_CONTROL 333
-#define VAR_LOCAL_ZONE 334
-#define VAR_LOCAL_DATA 335
-#define VAR_INTERFACE_AUTOMATIC 336
-#define VAR_STATISTICS_INTERVAL 337
-#define VAR_DO_DAEMONIZE 338
-#define VAR_USE_CAPS_FOR_ID 339
-#define VAR_STATISTICS_CUMULATIVE 340
-#define VAR_OUTGOING_PORT_PERMIT 341
-#define VAR_OUTGOING_PORT_AVOID 342
-#define VAR_DLV_ANCHOR_FILE 343
-#define VAR_DLV_ANCHOR 344
-#define VAR_NEG_CACHE_SIZE 345
-#define VAR_HARDEN_REFERRAL_PATH 346
-#define VAR_PRIVATE_ADDRESS 347
-#define VAR_PRIVATE_DOMAIN 348
-#define VAR_REMOTE_CONTROL 349
-#define VAR_CONTROL_ENABLE 350
-#define VAR_CONTROL_INTERFACE 351
-#define VAR_CONTROL_PORT 352
-#define VAR_SERVER_KEY_FILE 353
-#define VAR_SERVER_CERT_FILE 354
-#define VAR_CONTROL_KEY_FILE 355
-#define VAR_CONTROL_CERT_FILE 356
-#define VAR_CONTROL_USE_CERT 357
-#define VAR_EXTENDED_STATISTICS 358
-#define VAR_LOCAL_DATA_PTR 359
-#define VAR_JOSTLE_TIMEOUT 360
-#define VAR_STUB_PRIME 361
-#define VAR_UNWANTED_REPLY_THRESHOLD 362
-#define VAR_LOG_TIME_ASCII 363
-#define VAR_DOMAIN_INSECURE 364
-#define VAR_PYTHON 365
-#define VAR_PYTHON_SCRIPT 366
-#define VAR_VAL_SIG_SKEW_MIN 367
-#define VAR_VAL_SIG_SKEW_MAX 368
-#define VAR_CACHE_MIN_TTL 369
-#define VAR_VAL_LOG_LEVEL 370
-#define VAR_AUTO_TRUST_ANCHOR_FILE 371
-#define VAR_KEEP_MISSING 372
-#define VAR_ADD_HOLDDOWN 373
-#define VAR_DEL_HOLDDOWN 374
-#define VAR_SO_RCVBUF 375
-#define VAR_EDNS_BUFFER_SIZE 376
-#define VAR_PREFETCH 377
-#define VAR_PREFETCH_KEY 378
-#define VAR_SO_SNDBUF 379
-#define VAR_SO_REUSEPORT 380
-#define VAR_HARDEN_BELOW_NXDOMAIN 381
-#define VAR_IGNORE_CD_FLAG 382
-#define VAR_LOG_QUERIES 383
-#define VAR_LOG_REPLIES 384
-#define VAR_LOG_LOCAL_ACTIONS 385
-#define VAR_TCP_UPSTREAM 386
-#define VAR_SSL_UPSTREAM 387
-#define VAR_SSL_SERVICE_KEY 388
-#define VAR_SSL_SERVICE_PEM 389
-#define VAR_SSL_PORT 390
-#define VAR_FORWARD_FIRST 391
-#define VAR_STUB_SSL_UPSTREAM 392
-#define VAR_FORWARD_SSL_UPSTREAM 393
-#define VAR_TLS_CERT_BUNDLE 394
-#define VAR_STUB_FIRST 395
-#define VAR_MINIMAL_RESPONSES 396
-#define VAR_RRSET_ROUNDROBIN 397
-#define VAR_MAX_UDP_SIZE 398
-#define VAR_DELAY_CLOSE 399
-#define VAR_UNBLOCK_LAN_ZONES 400
-#define VAR_INSECURE_LAN_ZONES 401
-#define VAR_INFRA_CACHE_MIN_RTT 402
-#define VAR_DNS64_PREFIX 403
-#define VAR_DNS64_SYNTHALL 404
-#define VAR_DNS64_IGNORE_AAAA 405
-#define VAR_DNSTAP 406
-#define VAR_DNSTAP_ENABLE 407
-#define VAR_DNSTAP_SOCKET_PATH 408
-#define VAR_DNSTAP_SEND_IDENTITY 409
-#define VAR_DNSTAP_SEND_VERSION 410
-#define VAR_DNSTAP_IDENTITY 411
-#define VAR_DNSTAP_VERSION 412
-#define VAR_DNSTAP_LOG_RESOLVER_QUERY_MESSAGES 413
-#define VAR_DNSTAP_LOG_RESOLVER_RESPONSE_MESSAGES 414
-#define VAR_DNSTAP_LOG_CLIENT_QUERY_MESSAGES 415
-#define VAR_DNSTAP_LOG_CLIENT_RESPONSE_MESSAGES 416
-#define VAR_DNSTAP_LOG_FORWARDER_QUERY_MESSAGES 417
-#define VAR_DNSTAP_LOG_FORWARDER_RESPONSE_MESSAGES 418
-#define VAR_RESPONSE_IP_TAG 419
-#define VAR_RESPONSE_IP 420
-#define VAR_RESPONSE_IP_DATA 421
-#define VAR_HARDEN_ALGO_DOWNGRADE 422
-#define VAR_IP_TRANSPARENT 423
-#define VAR_DISABLE_DNSSEC_LAME_CHECK 424
-#define VAR_IP_RATELIMIT 425
-#define VAR_IP_RATELIMIT_SLABS 426
-#define VAR_IP_RATELIMIT_SIZE 427
-#define VAR_RATELIMIT 428
-#define VAR_RATELIMIT_SLABS 429
-#define VAR_RATELIMIT_SIZE 430
-#define VAR_RATELIMIT_FOR_DOMAIN 431
-#define VAR_RATELIMIT_BELOW_DOMAIN 432
-#define VAR_IP_RATELIMIT_FACTOR 433
-#define VAR_RATELIMIT_FACTOR 434
-#define VAR_SEND_CLIENT_SUBNET 435
-#define VAR_CLIENT_SUBNET_ZONE 436
-#define VAR_CLIENT_SUBNET_ALWAYS_FORWARD 437
-#define VAR_CLIENT_SUBNET_OPCODE 438
-#define VAR_MAX_CLIENT_SUBNET_IPV4 439
-#define VAR_MAX_CLIENT_SUBNET_IPV6 440
-#define VAR_MIN_CLIENT_SUBNET_IPV4 441
-#define VAR_MIN_CLIENT_SUBNET_IPV6 442
-#define VAR_MAX_ECS_TREE_SIZE_IPV4 443
-#define VAR_MAX_ECS_TREE_SIZE_IPV6 444
-#define VAR_CAPS_WHITELIST 445
-#define VAR_CACHE_MAX_NEGATIVE_TTL 446
-#define VAR_PERMIT_SMALL_HOLDDOWN 447
-#define VAR_QNAME_MINIMISATION 448
-#define VAR_QNAME_MINIMISATION_STRICT 449
-#define VAR_IP_FREEBIND 450
-#define VAR_DEFINE_TAG 451
-#define VAR_LOCAL_ZONE_TAG 452
-#define VAR_ACCESS_CONTROL_TAG 453
-#define VAR_LOCAL_ZONE_OVERRIDE 454
-#define VAR_ACCESS_CONTROL_TAG_ACTION 455
-#define VAR_ACCESS_CONTROL_TAG_DATA 456
-#define VAR_VIEW 457
-#define VAR_ACCESS_CONTROL_VIEW 458
-#define VAR_VIEW_FIRST 459
-#define VAR_SERVE_EXPIRED 460
-#define VAR_SERVE_EXPIRED_TTL 461
-#define VAR_SERVE_EXPIRED_TTL_RESET 462
-#define VAR_FAKE_DSA 463
-#define VAR_FAKE_SHA1 464
-#define VAR_LOG_IDENTITY 465
-#define VAR_HIDE_TRUSTANCHOR 466
-#define VAR_TRUST_ANCHOR_SIGNALING 467
-#define VAR_AGGRESSIVE_NSEC 468
-#define VAR_USE_SYSTEMD 469
-#define VAR_SHM_ENABLE 470
-#define VAR_SHM_KEY 471
-#define VAR_ROOT_KEY_SENTINEL 472
-#define VAR_DNSCRYPT 473
-#define VAR_DNSCRYPT_ENABLE 474
-#define VAR_DNSCRYPT_PORT 475
-#define VAR_DNSCRYPT_PROVIDER 476
-#define VAR_DNSCRYPT_SECRET_KEY 477
-#define VAR_DNSCRYPT_PROVIDER_CERT 478
-#define VAR_DNSCRYPT_PROVIDER_CERT_ROTATED 479
-#define VAR_DNSCRYPT_SHARED_SECRET_CACHE_SIZE 480
-#define VAR_DNSCRYPT_SHARED_SECRET_CACHE_SLABS 481
-#define VAR_DNSCRYPT_NONCE_CACHE_SIZE 482
-#define VAR_DNSCRYPT_NONCE_CACHE_SLABS 483
-#define VAR_IPSECMOD_ENABLED 484
-#define VAR_IPSECMOD_HOOK 485
-#define VAR_IPSECMOD_IGNORE_BOGUS 486
-#define VAR_IPSECMOD_MAX_TTL 487
-#define VAR_IPSECMOD_WHITELIST 488
-#define VAR_IPSECMOD_STRICT 489
-#define VAR_CACHEDB 490
-#define VAR_CACHEDB_BACKEND 491
-#define VAR_CACHEDB_SECRETSEED 492
-#define VAR_CACHEDB_REDISHOST 493
-#define VAR_CACHEDB_REDISPORT 494
-#define VAR_CACHEDB_REDISTIMEOUT 495
-#define VAR_UDP_UPSTREAM_WITHOUT_DOWNSTREAM 496
-#define VAR_FOR_UPSTREAM 497
-#define VAR_AUTH_ZONE 498
-#define VAR_ZONEFILE 499
-#define VAR_MASTER 500
-#define VAR_URL 501
-#define VAR_FOR_DOWNSTREAM 502
-#define VAR_FALLBACK_ENABLED 503
-#define VAR_TLS_ADDITIONAL_PORT 504
-#define VAR_LOW_RTT 505
-#define VAR_LOW_RTT_PERMIL 506
-#define VAR_FAST_SERVER_PERMIL 507
-#define VAR_FAST_SERVER_NUM 508
-#define VAR_ALLOW_NOTIFY 509
-#define VAR_TLS_WIN_CERT 510
-#define VAR_TCP_CONNECTION_LIMIT 511
-#define VAR_FORWARD_NO_CACHE 512
-#define VAR_STUB_NO_CACHE 513
-#define VAR_LOG_SERVFAIL 514
-#define VAR_DENY_ANY 515
-#define VAR_UNKNOWN_SERVER_TIME_LIMIT 516
-#define VAR_LOG_TAG_QUERYREPLY 517
-#define VAR_STREAM_WAIT_SIZE 518
-#define VAR_TLS_CIPHERS 519
-#define VAR_TLS_CIPHERSUITES 520
-#define VAR_TLS_SESSION_TICKET_KEYS 521
-
-/* Value type.  */
-#if ! defined YYSTYPE && ! defined YYSTYPE_IS_DECLARED
-
-union YYSTYPE
+#include "configparser.h"
+/* Symbol kind.  */
+enum yysymbol_kind_t
 {
-#line 66 "./util/configparser.y" /* yacc.c:355  */
-
-	char*	str;
-
-#line 671 "util/configparser.c" /* yacc.c:355  */
+  YYSYMBOL_YYEMPTY = -2,
+  YYSYMBOL_YYEOF = 0,                      /* "end of file"  */
+  YYSYMBOL_YYerror = 1,                    /* error  */
+  YYSYMBOL_YYUNDEF = 2,                    /* "invalid token"  */
+  YYSYMBOL_SPACE = 3,                      /* SPACE  */
+  YYSYMBOL_LETTER = 4,                     /* LETTER  */
+  YYSYMBOL_NEWLINE = 5,                    /* NEWLINE  */
+  YYSYMBOL_COMMENT = 6,                    /* COMMENT  */
+  YYSYMBOL_COLON = 7,                      /* COLON  */
+  YYSYMBOL_ANY = 8,                        /* ANY  */
+  YYSYMBOL_ZONESTR = 9,                    /* ZONESTR  */
+  YYSYMBOL_STRING_ARG = 10,                /* STRING_ARG  */
+  YYSYMBOL_VAR_SERVER = 11,                /* VAR_SERVER  */
+  YYSYMBOL_VAR_VERBOSITY = 12,             /* VAR_VERBOSITY  */
+  YYSYMBOL_VAR_NUM_THREADS = 13,           /* VAR_NUM_THREADS  */
+  YYSYMBOL_VAR_PORT = 14,                  /* VAR_PORT  */
+  YYSYMBOL_VAR_OUTGOING_RANGE = 15,        /* VAR_OUTGOING_RANGE  */
+  YYSYMBOL_VAR_INTERFACE = 16,             /* VAR_INTERFACE  */
+  YYSYMBOL_VAR_DO_IP4 = 17,                /* VAR_DO_IP4  */
+  YYSYMBOL_VAR_DO_IP6 = 18,                /* VAR_DO_IP6  */
+  YYSYMBOL_VAR_PREFER_IP6 = 19,            /* VAR_PREFER_IP6  */
+  YYSYMBOL_VAR_DO_UDP = 20,                /* VAR_DO_UDP  */
+  YYSYMBOL_VAR_DO_TCP = 21,                /* VAR_DO_TCP  */
+  YYSYMBOL_VAR_TCP_MSS = 22,               /* VAR_TCP_MSS  */
+  YYSYMBOL_VAR_OUTGOING_TCP_MSS = 23,      /* VAR_OUTGOING_TCP_MSS  */
+  YYSYMBOL_VAR_TCP_IDLE_TIMEOUT = 24,      /* VAR_TCP_IDLE_TIMEOUT  */
+  YYSYMBOL_VAR_EDNS_TCP_KEEPALIVE = 25,    /* VAR_EDNS_TCP_KEEPALIVE  */
+  YYSYMBOL_VAR_EDNS_TCP_KEEPALIVE_TIMEOUT = 26, /* VAR_EDNS_TCP_KEEPALIVE_TIMEOUT  */
+  YYSYMBOL_VAR_CHROOT = 27,                /* VAR_CHROOT  */
+  YYSYMBOL_VAR_USERNAME = 28,              /* VAR_USERNAME  */
+  YYSYMBOL_VAR_DIRECTORY = 29,             /* VAR_DIRECTORY  */
+  YYSYMBOL_VAR_LOGFILE = 30,               /* VAR_LOGFILE  */
+  YYSYMBOL_VAR_PIDFILE = 31,               /* VAR_PIDFILE  */
+  YYSYMBOL_VAR_MSG_CACHE_SIZE = 32,        /* VAR_MSG_CACHE_SIZE  */
+  YYSYMBOL_VAR_MSG_CACHE_SLABS = 33,       /* VAR_MSG_CACHE_SLABS  */
+  YYSYMBOL_VAR_NUM_QUERIES_PER_THREAD = 34, /* VAR_NUM_QUERIES_PER_THREAD  */
+  YYSYMBOL_VAR_RRSET_CACHE_SIZE = 35,      /* VAR_RRSET_CACHE_SIZE  */
+  YYSYMBOL_VAR_RRSET_CACHE_SLABS = 36,     /* VAR_RRSET_CACHE_SLABS  */
+  YYSYMBOL_VAR_OUTGOING_NUM_TCP = 37,      /* VAR_OUTGOING_NUM_TCP  */
+  YYSYMBOL_VAR_INFRA_HOST_TTL = 38,        /* VAR_INFRA_HOST_TTL  */
+  YYSYMBOL_VAR_INFRA_LAME_TTL = 39,        /* VAR_INFRA_LAME_TTL  */
+  YYSYMBOL_VAR_INFRA_CACHE_SLABS = 40,     /* VAR_INFRA_CACHE_SLABS  */
+  YYSYMBOL_VAR_INFRA_CACHE_NUMHOSTS = 41,  /* VAR_INFRA_CACHE_NUMHOSTS  */
+  YYSYMBOL_VAR_INFRA_CACHE_LAME_SIZE = 42, /* VAR_INFRA_CACHE_LAME_SIZE  */
+  YYSYMBOL_VAR_NAME = 43,                  /* VAR_NAME  */
+  YYSYMBOL_VAR_STUB_ZONE = 44,             /* VAR_STUB_ZONE  */
+  YYSYMBOL_VAR_STUB_HOST = 45,             /* VAR_STUB_HOST  */
+  YYSYMBOL_VAR_STUB_ADDR = 46,             /* VAR_STUB_ADDR  */
+  YYSYMBOL_VAR_TARGET_FETCH_POLICY = 47,   /* VAR_TARGET_FETCH_POLICY  */
+  YYSYMBOL_VAR_HARDEN_SHORT_BUFSIZE = 48,  /* VAR_HARDEN_SHORT_BUFSIZE  */
+  YYSYMBOL_VAR_HARDEN_LARGE_QUERIES = 49,  /* VAR_HARDEN_LARGE_QUERIES  */
+  YYSYMBOL_VAR_FORWARD_ZONE = 50,          /* VAR_FORWARD_ZONE  */
+  YYSYMBOL_VAR_FORWARD_HOST = 51,          /* VAR_FORWARD_HOST  */
+  YYSYMBOL_VAR_FORWARD_ADDR = 52,          /* VAR_FORWARD_ADDR  */
+  YYSYMBOL_VAR_DO_NOT_QUERY_ADDRESS = 53,  /* VAR_DO_NOT_QUERY_ADDRESS  */
+  YYSYMBOL_VAR_HIDE_IDENTITY = 54,         /* VAR_HIDE_IDENTITY  */
+  YYSYMBOL_VAR_HIDE_VERSION = 55,          /* VAR_HIDE_VERSION  */
+  YYSYMBOL_VAR_IDENTITY = 56,              /* VAR_IDENTITY  */
+  YYSYMBOL_VAR_VERSION = 57,               /* VAR_VERSION  */
+  YYSYMBOL_VAR_HARDEN_GLUE = 58,           /* VAR_HARDEN_GLUE  */
+  YYSYMBOL_VAR_MODULE_CONF = 59,           /* VAR_MODULE_CONF  */
+  YYSYMBOL_VAR_TRUST_ANCHOR_FILE = 60,     /* VAR_TRUST_ANCHOR_FILE  */
+  YYSYMBOL_VAR_TRUST_ANCHOR = 61,          /* VAR_TRUST_ANCHOR  */
+  YYSYMBOL_VAR_VAL_OVERRIDE_DATE = 62,     /* VAR_VAL_OVERRIDE_DATE  */
+  YYSYMBOL_VAR_BOGUS_TTL = 63,             /* VAR_BOGUS_TTL  */
+  YYSYMBOL_VAR_VAL_CLEAN_ADDITIONAL = 64,  /* VAR_VAL_CLEAN_ADDITIONAL  */
+  YYSYMBOL_VAR_VAL_PERMISSIVE_MODE = 65,   /* VAR_VAL_PERMISSIVE_MODE  */
+  YYSYMBOL_VAR_INCOMING_NUM_TCP = 66,      /* VAR_INCOMING_NUM_TCP  */
+  YYSYMBOL_VAR_MSG_BUFFER_SIZE = 67,       /* VAR_MSG_BUFFER_SIZE  */
+  YYSYMBOL_VAR_KEY_CACHE_SIZE = 68,        /* VAR_KEY_CACHE_SIZE  */
+  YYSYMBOL_VAR_KEY_CACHE_SLABS = 69,       /* VAR_KEY_CACHE_SLABS  */
+  YYSYMBOL_VAR_TRUSTED_KEYS_FILE = 70,     /* VAR_TRUSTED_KEYS_FILE  */
+  YYSYMBOL_VAR_VAL_NSEC3_KEYSIZE_ITERATIONS = 71, /* VAR_VAL_NSEC3_KEYSIZE_ITERATIONS  */
+  YYSYMBOL_VAR_USE_SYSLOG = 72,            /* VAR_USE_SYSLOG  */
+  YYSYMBOL_VAR_OUTGOING_INTERFACE = 73,    /* VAR_OUTGOING_INTERFACE  */
+  YYSYMBOL_VAR_ROOT_HINTS = 74,            /* VAR_ROOT_HINTS  */
+  YYSYMBOL_VAR_DO_NOT_QUERY_LOCALHOST = 75, /* VAR_DO_NOT_QUERY_LOCALHOST  */
+  YYSYMBOL_VAR_CACHE_MAX_TTL = 76,         /* VAR_CACHE_MAX_TTL  */
+  YYSYMBOL_VAR_HARDEN_DNSSEC_STRIPPED = 77, /* VAR_HARDEN_DNSSEC_STRIPPED  */
+  YYSYMBOL_VAR_ACCESS_CONTROL = 78,        /* VAR_ACCESS_CONTROL  */
+  YYSYMBOL_VAR_LOCAL_ZONE = 79,            /* VAR_LOCAL_ZONE  */
+  YYSYMBOL_VAR_LOCAL_DATA = 80,            /* VAR_LOCAL_DATA  */
+  YYSYMBOL_VAR_INTERFACE_AUTOMATIC = 81,   /* VAR_INTERFACE_AUTOMATIC  */
+  YYSYMBOL_VAR_STATISTICS_INTERVAL = 82,   /* VAR_STATISTICS_INTERVAL  */
+  YYSYMBOL_VAR_DO_DAEMONIZE = 83,          /* VAR_DO_DAEMONIZE  */
+  YYSYMBOL_VAR_USE_CAPS_FOR_ID = 84,       /* VAR_USE_CAPS_FOR_ID  */
+  YYSYMBOL_VAR_STATISTICS_CUMULATIVE = 85, /* VAR_STATISTICS_CUMULATIVE  */
+  YYSYMBOL_VAR_OUTGOING_PORT_PERMIT = 86,  /* VAR_OUTGOING_PORT_PERMIT  */
+  YYSYMBOL_VAR_OUTGOING_PORT_AVOID = 87,   /* VAR_OUTGOING_PORT_AVOID  */
+  YYSYMBOL_VAR_DLV_ANCHOR_FILE = 88,       /* VAR_DLV_ANCHOR_FILE  */
+  YYSYMBOL_VAR_DLV_ANCHOR = 89,            /* VAR_DLV_ANCHOR  */
+  YYSYMBOL_VAR_NEG_CACHE_SIZE = 90,        /* VAR_NEG_CACHE_SIZE  */
+  YYSYMBOL_VAR_HARDEN_REFERRAL_PATH = 91,  /* VAR_HARDEN_REFERRAL_PATH  */
+  YYSYMBOL_VAR_PRIVATE_ADDRESS = 92,       /* VAR_PRIVATE_ADDRESS  */
+  YYSYMBOL_VAR_PRIVATE_DOMAIN = 93,        /* VAR_PRIVATE_DOMAIN  */
+  YYSYMBOL_VAR_REMOTE_CONTROL = 94,        /* VAR_REMOTE_CONTROL  */
+  YYSYMBOL_VAR_CONTROL_ENABLE = 95,        /* VAR_CONTROL_ENABLE  */
+  YYSYMBOL_VAR_CONTROL_INTERFACE = 96,     /* VAR_CONTROL_INTERFACE  */
+  YYSYMBOL_VAR_CONTROL_PORT = 97,          /* VAR_CONTROL_PORT  */
+  YYSYMBOL_VAR_SERVER_KEY_FILE = 98,       /* VAR_SERVER_KEY_FILE  */
+  YYSYMBOL_VAR_SERVER_CERT_FILE = 99,      /* VAR_SERVER_CERT_FILE  */
+  YYSYMBOL_VAR_CONTROL_KEY_FILE = 100,     /* VAR_CONTROL_KEY_FILE  */
+  YYSYMBOL_VAR_CONTROL_CERT_FILE = 101,    /* VAR_CONTROL_CERT_FILE  */
+  YYSYMBOL_VAR_CONTROL_USE_CERT = 102,     /* VAR_CONTROL_USE_CERT  */
+  YYSYMBOL_VAR_EXTENDED_STATISTICS = 103,  /* VAR_EXTENDED_STATISTICS  */
+  YYSYMBOL_VAR_LOCAL_DATA_PTR = 104,       /* VAR_LOCAL_DATA_PTR  */
+  YYSYMBOL_VAR_JOSTLE_TIMEOUT = 105,       /* VAR_JOSTLE_TIMEOUT  */
+  YYSYMBOL_VAR_STUB_PRIME = 106,           /* VAR_STUB_PRIME  */
+  YYSYMBOL_VAR_UNWANTED_REPLY_THRESHOLD = 107, /* VAR_UNWANTED_REPLY_THRESHOLD  */
+  YYSYMBOL_VAR_LOG_TIME_ASCII = 108,       /* VAR_LOG_TIME_ASCII  */
+  YYSYMBOL_VAR_DOMAIN_INSECURE = 109,      /* VAR_DOMAIN_INSECURE  */
+  YYSYMBOL_VAR_PYTHON = 110,               /* VAR_PYTHON  */
+  YYSYMBOL_VAR_PYTHON_SCRIPT = 111,        /* VAR_PYTHON_SCRIPT  */
+  YYSYMBOL_VAR_VAL_SIG_SKEW_MIN = 112,     /* VAR_VAL_SIG_SKEW_MIN  */
+  YYSYMBOL_VAR_VAL_SIG_SKEW_MAX = 113,     /* VAR_VAL_SIG_SKEW_MAX  */
+  YYSYMBOL_VAR_CACHE_MIN_TTL = 114,        /* VAR_CACHE_MIN_TTL  */
+  YYSYMBOL_VAR_VAL_LOG_LEVEL = 115,        /* VAR_VAL_LOG_LEVEL  */
+  YYSYMBOL_VAR_AUTO_TRUST_ANCHOR_FILE = 116, /* VAR_AUTO_TRUST_ANCHOR_FILE  */
+  YYSYMBOL_VAR_KEEP_MISSING = 117,         /* VAR_KEEP_MISSING  */
+  YYSYMBOL_VAR_ADD_HOLDDOWN = 118,         /* VAR_ADD_HOLDDOWN  */
+  YYSYMBOL_VAR_DEL_HOLDDOWN = 119,         /* VAR_DEL_HOLDDOWN  */
+  YYSYMBOL_VAR_SO_RCVBUF = 120,            /* VAR_SO_RCVBUF  */
+  YYSYMBOL_VAR_EDNS_BUFFER_SIZE = 121,     /* VAR_EDNS_BUFFER_SIZE  */
+  YYSYMBOL_VAR_PREFETCH = 122,             /* VAR_PREFETCH  */
+  YYSYMBOL_VAR_PREFETCH_KEY = 123,         /* VAR_PREFETCH_KEY  */
+  YYSYMBOL_VAR_SO_SNDBUF = 124,            /* VAR_SO_SNDBUF  */
+  YYSYMBOL_VAR_SO_REUSEPORT = 125,         /* VAR_SO_REUSEPORT  */
+  YYSYMBOL_VAR_HARDEN_BELOW_NXDOMAIN = 126, /* VAR_HARDEN_BELOW_NXDOMAIN  */
+  YYSYMBOL_VAR_IGNORE_CD_FLAG = 127,       /* VAR_IGNORE_CD_FLAG  */
+  YYSYMBOL_VAR_LOG_QUERIES = 128,          /* VAR_LOG_QUERIES  */
+  YYSYMBOL_VAR_LOG_REPLIES = 129,          /* VAR_LOG_REPLIES  */
+  YYSYMBOL_VAR_LOG_LOCAL_ACTIONS = 130,    /* VAR_LOG_LOCAL_ACTIONS  */
+  YYSYMBOL_VAR_TCP_UPSTREAM = 131,         /* VAR_TCP_UPSTREAM  */
+  YYSYMBOL_VAR_SSL_UPSTREAM = 132,         /* VAR_SSL_UPSTREAM  */
+  YYSYMBOL_VAR_SSL_SERVICE_KEY = 133,      /* VAR_SSL_SERVICE_KEY  */
+  YYSYMBOL_VAR_SSL_SERVICE_PEM = 134,      /* VAR_SSL_SERVICE_PEM  */
+  YYSYMBOL_VAR_SSL_PORT = 135,             /* VAR_SSL_PORT  */
+  YYSYMBOL_VAR_FORWARD_FIRST = 136,        /* VAR_FORWARD_FIRST  */
+  YYSYMBOL_VAR_STUB_SSL_UPSTREAM = 137,    /* VAR_STUB_SSL_UPSTREAM  */
+  YYSYMBOL_VAR_FORWARD_SSL_UPSTREAM = 138, /* VAR_FORWARD_SSL_UPSTREAM  */
+  YYSYMBOL_VAR_TLS_CERT_BUNDLE = 139,      /* VAR_TLS_CERT_BUNDLE  */
+  YYSYMBOL_VAR_STUB_FIRST = 140,           /* VAR_STUB_FIRST  */
+  YYSYMBOL_VAR_MINIMAL_RESPONSES = 141,    /* VAR_MINIMAL_RESPONSES  */
+  YYSYMBOL_VAR_RRSET_ROUNDROBIN = 142,     /* VAR_RRSET_ROUNDROBIN  */
+  YYSYMBOL_VAR_MAX_UDP_SIZE = 143,         /* VAR_MAX_UDP_SIZE  */
+  YYSYMBOL_VAR_DELAY_CLOSE = 144,          /* VAR_DELAY_CLOSE  */
+  YYSYMBOL_VAR_UNBLOCK_LAN_ZONES = 145,    /* VAR_UNBLOCK_LAN_ZONES  */
+  YYSYMBOL_VAR_INSECURE_LAN_ZONES = 146,   /* VAR_INSECURE_LAN_ZONES  */
+  YYSYMBOL_VAR_INFRA_CACHE_MIN_RTT = 147,  /* VAR_INFRA_CACHE_MIN_RTT  */
+  YYSYMBOL_VAR_DNS64_PREFIX = 148,         /* VAR_DNS64_PREFIX  */
+  YYSYMBOL_VAR_DNS64_SYNTHALL = 149,       /* VAR_DNS64_SYNTHALL  */
+  YYSYMBOL_VAR_DNS64_IGNORE_AAAA = 150,    /* VAR_DNS64_IGNORE_AAAA  */
+  YYSYMBOL_VAR_DNSTAP = 151,               /* VAR_DNSTAP  */
+  YYSYMBOL_VAR_DNSTAP_ENABLE = 152,        /* VAR_DNSTAP_ENABLE  */
+  YYSYMBOL_VAR_DNSTAP_SOCKET_PATH = 153,   /* VAR_DNSTAP_SOCKET_PATH  */
+  YYSYMBOL_VAR_DNSTAP_SEND_IDENTITY = 154, /* VAR_DNSTAP_SEND_IDENTITY  */
+  YYSYMBOL_VAR_DNSTAP_SEND_VERSION = 155,  /* VAR_DNSTAP_SEND_VERSION  */
+  YYSYMBOL_VAR_DNSTAP_IDENTITY = 156,      /* VAR_DNSTAP_IDENTITY  */
+  YYSYMBOL_VAR_DNSTAP_VERSION = 157,       /* VAR_DNSTAP_VERSION  */
+  YYSYMBOL_VAR_DNSTAP_LOG_RESOLVER_QUERY_MESSAGES = 158, /* VAR_DNSTAP_LOG_RESOLVER_QUERY_MESSAGES  */
+  YYSYMBOL_VAR_DNSTAP_LOG_RESOLVER_RESPONSE_MESSAGES = 159, /* VAR_DNSTAP_LOG_RESOLVER_RESPONSE_MESSAGES  */
+  YYSYMBOL_VAR_DNSTAP_LOG_CLIENT_QUERY_MESSAGES = 160, /* VAR_DNSTAP_LOG_CLIENT_QUERY_MESSAGES  */
+  YYSYMBOL_VAR_DNSTAP_LOG_CLIENT_RESPONSE_MESSAGES = 161, /* VAR_DNSTAP_LOG_CLIENT_RESPONSE_MESSAGES  */
+  YYSYMBOL_VAR_DNSTAP_LOG_FORWARDER_QUERY_MESSAGES = 162, /* VAR_DNSTAP_LOG_FORWARDER_QUERY_MESSAGES  */
+  YYSYMBOL_VAR_DNSTAP_LOG_FORWARDER_RESPONSE_MESSAGES = 163, /* VAR_DNSTAP_LOG_FORWARDER_RESPONSE_MESSAGES  */
+  YYSYMBOL_VAR_RESPONSE_IP_TAG = 164,      /* VAR_RESPONSE_IP_TAG  */
+  YYSYMBOL_VAR_RESPONSE_IP = 165,          /* VAR_RESPONSE_IP  */
+  YYSYMBOL_VAR_RESPONSE_IP_DATA = 166,     /* VAR_RESPONSE_IP_DATA  */
+  YYSYMBOL_VAR_HARDEN_ALGO_DOWNGRADE = 167, /* VAR_HARDEN_ALGO_DOWNGRADE  */
+  YYSYMBOL_VAR_IP_TRANSPARENT = 168,       /* VAR_IP_TRANSPARENT  */
+  YYSYMBOL_VAR_DISABLE_DNSSEC_LAME_CHECK = 169, /* VAR_DISABLE_DNSSEC_LAME_CHECK  */
+  YYSYMBOL_VAR_IP_RATELIMIT = 170,         /* VAR_IP_RATELIMIT  */
+  YYSYMBOL_VAR_IP_RATELIMIT_SLABS = 171,   /* VAR_IP_RATELIMIT_SLABS  */
+  YYSYMBOL_VAR_IP_RATELIMIT_SIZE = 172,    /* VAR_IP_RATELIMIT_SIZE  */
+  YYSYMBOL_VAR_RATELIMIT = 173,            /* VAR_RATELIMIT  */
+  YYSYMBOL_VAR_RATELIMIT_SLABS = 174,      /* VAR_RATELIMIT_SLABS  */
+  YYSYMBOL_VAR_RATELIMIT_SIZE = 175,       /* VAR_RATELIMIT_SIZE  */
+  YYSYMBOL_VAR_RATELIMIT_FOR_DOMAIN = 176, /* VAR_RATELIMIT_FOR_DOMAIN  */
+  YYSYMBOL_VAR_RATELIMIT_BELOW_DOMAIN = 177, /* VAR_RATELIMIT_BELOW_DOMAIN  */
+  YYSYMBOL_VAR_IP_RATELIMIT_FACTOR = 178,  /* VAR_IP_RATELIMIT_FACTOR  */
+  YYSYMBOL_VAR_RATELIMIT_FACTOR = 179,     /* VAR_RATELIMIT_FACTOR  */
+  YYSYMBOL_VAR_SEND_CLIENT_SUBNET = 180,   /* VAR_SEND_CLIENT_SUBNET  */
+  YYSYMBOL_VAR_CLIENT_SUBNET_ZONE = 181,   /* VAR_CLIENT_SUBNET_ZONE  */
+  YYSYMBOL_VAR_CLIENT_SUBNET_ALWAYS_FORWARD = 182, /* VAR_CLIENT_SUBNET_ALWAYS_FORWARD  */
+  YYSYMBOL_VAR_CLIENT_SUBNET_OPCODE = 183, /* VAR_CLIENT_SUBNET_OPCODE  */
+  YYSYMBOL_VAR_MAX_CLIENT_SUBNET_IPV4 = 184, /* VAR_MAX_CLIENT_SUBNET_IPV4  */
+  YYSYMBOL_VAR_MAX_CLIENT_SUBNET_IPV6 = 185, /* VAR_MAX_CLIENT_SUBNET_IPV6  */
+  YYSYMBOL_VAR_MIN_CLIENT_SUBNET_IPV4 = 186, /* VAR_MIN_CLIENT_SUBNET_IPV4  */
+  YYSYMBOL_VAR_MIN_CLIENT_SUBNET_IPV6 = 187, /* VAR_MIN_CLIENT_SUBNET_IPV6  */
+  YYSYMBOL_VAR_MAX_ECS_TREE_SIZE_IPV4 = 188, /* VAR_MAX_ECS_TREE_SIZE_IPV4  */
+  YYSYMBOL_VAR_MAX_ECS_TREE_SIZE_IPV6 = 189, /* VAR_MAX_ECS_TREE_SIZE_IPV6  */
+  YYSYMBOL_VAR_CAPS_WHITELIST = 190,       /* VAR_CAPS_WHITELIST  */
+  YYSYMBOL_VAR_CACHE_MAX_NEGATIVE_TTL = 191, /* VAR_CACHE_MAX_NEGATIVE_TTL  */
+  YYSYMBOL_VAR_PERMIT_SMALL_HOLDDOWN = 192, /* VAR_PERMIT_SMALL_HOLDDOWN  */
+  YYSYMBOL_VAR_QNAME_MINIMISATION = 193,   /* VAR_QNAME_MINIMISATION  */
+  YYSYMBOL_VAR_QNAME_MINIMISATION_STRICT = 194, /* VAR_QNAME_MINIMISATION_STRICT  */
+  YYSYMBOL_VAR_IP_FREEBIND = 195,          /* VAR_IP_FREEBIND  */
+  YYSYMBOL_VAR_DEFINE_TAG = 196,           /* VAR_DEFINE_TAG  */
+  YYSYMBOL_VAR_LOCAL_ZONE_TAG = 197,       /* VAR_LOCAL_ZONE_TAG  */
+  YYSYMBOL_VAR_ACCESS_CONTROL_TAG = 198,   /* VAR_ACCESS_CONTROL_TAG  */
+  YYSYMBOL_VAR_LOCAL_ZONE_OVERRIDE = 199,  /* VAR_LOCAL_ZONE_OVERRIDE  */
+  YYSYMBOL_VAR_ACCESS_CONTROL_TAG_ACTION = 200, /* VAR_ACCESS_CONTROL_TAG_ACTION  */
+  YYSYMBOL_VAR_ACCESS_CONTROL_TAG_DATA = 201, /* VAR_ACCESS_CONTROL_TAG_DATA  */
+  YYSYMBOL_VAR_VIEW = 202,                 /* VAR_VIEW  */
+  YYSYMBOL_VAR_ACCESS_CONTROL_VIEW = 203,  /* VAR_ACCESS_CONTROL_VIEW  */
+  YYSYMBOL_VAR_VIEW_FIRST = 204,           /* VAR_VIEW_FIRST  */
+  YYSYMBOL_VAR_SERVE_EXPIRED = 205,        /* VAR_SERVE_EXPIRED  */
+  YYSYMBOL_VAR_SERVE_EXPIRED_TTL = 206,    /* VAR_SERVE_EXPIRED_TTL  */
+  YYSYMBOL_VAR_SERVE_EXPIRED_TTL_RESET = 207, /* VAR_SERVE_EXPIRED_TTL_RESET  */
+  YYSYMBOL_VAR_FAKE_DSA = 208,             /* VAR_FAKE_DSA  */
+  YYSYMBOL_VAR_FAKE_SHA1 = 209,            /* VAR_FAKE_SHA1  */
+  YYSYMBOL_VAR_LOG_IDENTITY = 210,         /* VAR_LOG_IDENTITY  */
+  YYSYMBOL_VAR_HIDE_TRUSTANCHOR = 211,     /* VAR_HIDE_TRUSTANCHOR  */
+  YYSYMBOL_VAR_TRUST_ANCHOR_SIGNALING = 212, /* VAR_TRUST_ANCHOR_SIGNALING  */
+  YYSYMBOL_VAR_AGGRESSIVE_NSEC = 213,      /* VAR_AGGRESSIVE_NSEC  */
+  YYSYMBOL_VAR_USE_SYSTEMD = 214,          /* VAR_USE_SYSTEMD  */
+  YYSYMBOL_VAR_SHM_ENABLE = 215,           /* VAR_SHM_ENABLE  */
+  YYSYMBOL_VAR_SHM_KEY = 216,              /* VAR_SHM_KEY  */
+  YYSYMBOL_VAR_ROOT_KEY_SENTINEL = 217,    /* VAR_ROOT_KEY_SENTINEL  */
+  YYSYMBOL_VAR_DNSCRYPT = 218,             /* VAR_DNSCRYPT  */
+  YYSYMBOL_VAR_DNSCRYPT_ENABLE = 219,      /* VAR_DNSCRYPT_ENABLE  */
+  YYSYMBOL_VAR_DNSCRYPT_PORT = 220,        /* VAR_DNSCRYPT_PORT  */
+  YYSYMBOL_VAR_DNSCRYPT_PROVIDER = 221,    /* VAR_DNSCRYPT_PROVIDER  */
+  YYSYMBOL_VAR_DNSCRYPT_SECRET_KEY = 222,  /* VAR_DNSCRYPT_SECRET_KEY  */
+  YYSYMBOL_VAR_DNSCRYPT_PROVIDER_CERT = 223, /* VAR_DNSCRYPT_PROVIDER_CERT  */
+  YYSYMBOL_VAR_DNSCRYPT_PROVIDER_CERT_ROTATED = 224, /* VAR_DNSCRYPT_PROVIDER_CERT_ROTATED  */
+  YYSYMBOL_VAR_DNSCRYPT_SHARED_SECRET_CACHE_SIZE = 225, /* VAR_DNSCRYPT_SHARED_SECRET_CACHE_SIZE  */
+  YYSYMBOL_VAR_DNSCRYPT_SHARED_SECRET_CACHE_SLABS = 226, /* VAR_DNSCRYPT_SHARED_SECRET_CACHE_SLABS  */
+  YYSYMBOL_VAR_DNSCRYPT_NONCE_CACHE_SIZE = 227, /* VAR_DNSCRYPT_NONCE_CACHE_SIZE  */
+  YYSYMBOL_VAR_DNSCRYPT_NONCE_CACHE_SLABS = 228, /* VAR_DNSCRYPT_NONCE_CACHE_SLABS  */
+  YYSYMBOL_VAR_IPSECMOD_ENABLED = 229,     /* VAR_IPSECMOD_ENABLED  */
+  YYSYMBOL_VAR_IPSECMOD_HOOK = 230,        /* VAR_IPSECMOD_HOOK  */
+  YYSYMBOL_VAR_IPSECMOD_IGNORE_BOGUS = 231, /* VAR_IPSECMOD_IGNORE_BOGUS  */
+  YYSYMBOL_VAR_IPSECMOD_MAX_TTL = 232,     /* VAR_IPSECMOD_MAX_TTL  */
+  YYSYMBOL_VAR_IPSECMOD_WHITELIST = 233,   /* VAR_IPSECMOD_WHITELIST  */
+  YYSYMBOL_VAR_IPSECMOD_STRICT = 234,      /* VAR_IPSECMOD_STRICT  */
+  YYSYMBOL_VAR_CACHEDB = 235,              /* VAR_CACHEDB  */
+  YYSYMBOL_VAR_CACHEDB_BACKEND = 236,      /* VAR_CACHEDB_BACKEND  */
+  YYSYMBOL_VAR_CACHEDB_SECRETSEED = 237,   /* VAR_CACHEDB_SECRETSEED  */
+  YYSYMBOL_VAR_CACHEDB_REDISHOST = 238,    /* VAR_CACHEDB_REDISHOST  */
+  YYSYMBOL_VAR_CACHEDB_REDISPORT = 239,    /* VAR_CACHEDB_REDISPORT  */
+  YYSYMBOL_VAR_CACHEDB_REDISTIMEOUT = 240, /* VAR_CACHEDB_REDISTIMEOUT  */
+  YYSYMBOL_VAR_UDP_UPSTREAM_WITHOUT_DOWNSTREAM = 241, /* VAR_UDP_UPSTREAM_WITHOUT_DOWNSTREAM  */
+  YYSYMBOL_VAR_FOR_UPSTREAM = 242,         /* VAR_FOR_UPSTREAM  */
+  YYSYMBOL_VAR_AUTH_ZONE = 243,            /* VAR_AUTH_ZONE  */
+  YYSYMBOL_VAR_ZONEFILE = 244,             /* VAR_ZONEFILE  */
+  YYSYMBOL_VAR_MASTER = 245,               /* VAR_MASTER  */
+  YYSYMBOL_VAR_URL = 246,                  /* VAR_URL  */
+  YYSYMBOL_VAR_FOR_DOWNSTREAM = 247,       /* VAR_FOR_DOWNSTREAM  */
+  YYSYMBOL_VAR_FALLBACK_ENABLED = 248,     /* VAR_FALLBACK_ENABLED  */
+  YYSYMBOL_VAR_TLS_ADDITIONAL_PORT = 249,  /* VAR_TLS_ADDITIONAL_PORT  */
+  YYSYMBOL_VAR_LOW_RTT = 250,              /* VAR_LOW_RTT  */
+  YYSYMBOL_VAR_LOW_RTT_PERMIL = 251,       /* VAR_LOW_RTT_PERMIL  */
+  YYSYMBOL_VAR_FAST_SERVER_PERMIL = 252,   /* VAR_FAST_SERVER_PERMIL  */
+  YYSYMBOL_VAR_FAST_SERVER_NUM = 253,      /* VAR_FAST_SERVER_NUM  */
+  YYSYMBOL_VAR_ALLOW_NOTIFY = 254,         /* VAR_ALLOW_NOTIFY  */
+  YYSYMBOL_VAR_TLS_WIN_CERT = 255,         /* VAR_TLS_WIN_CERT  */
+  YYSYMBOL_VAR_TCP_CONNECTION_LIMIT = 256, /* VAR_TCP_CONNECTION_LIMIT  */
+  YYSYMBOL_VAR_FORWARD_NO_CACHE = 257,     /* VAR_FORWARD_NO_CACHE  */
+  YYSYMBOL_VAR_STUB_NO_CACHE = 258,        /* VAR_STUB_NO_CACHE  */
+  YYSYMBOL_VAR_LOG_SERVFAIL = 259,         /* VAR_LOG_SERVFAIL  */
+  YYSYMBOL_VAR_DENY_ANY = 260,             /* VAR_DENY_ANY  */
+  YYSYMBOL_VAR_UNKNOWN_SERVER_TIME_LIMIT = 261, /* VAR_UNKNOWN_SERVER_TIME_LIMIT  */
+  YYSYMBOL_VAR_LOG_TAG_QUERYREPLY = 262,   /* VAR_LOG_TAG_QUERYREPLY  */
+  YYSYMBOL_VAR_STREAM_WAIT_SIZE = 263,     /* VAR_STREAM_WAIT_SIZE  */
+  YYSYMBOL_VAR_TLS_CIPHERS = 264,          /* VAR_TLS_CIPHERS  */
+  YYSYMBOL_VAR_TLS_CIPHERSUITES = 265,     /* VAR_TLS_CIPHERSUITES  */
+  YYSYMBOL_VAR_TLS_SESSION_TICKET_KEYS = 266, /* VAR_TLS_SESSION_TICKET_KEYS  */
+  YYSYMBOL_VAR_MESH_CLASS_WEIGHT = 267,    /* VAR_MESH_CLASS_WEIGHT  */
+  YYSYMBOL_VAR_MESH_CLASS_LIMIT = 268,     /* VAR_MESH_CLASS_LIMIT  */
+  YYSYMBOL_VAR_TRACE_SAMPLE_RATE = 269,    /* VAR_TRACE_SAMPLE_RATE  */
+  YYSYMBOL_VAR_TRACE_SLOW_THRESHOLD = 270, /* VAR_TRACE_SLOW_THRESHOLD  */
+  YYSYMBOL_VAR_WORK_STEALING = 271,        /* VAR_WORK_STEALING  */
+  YYSYMBOL_VAR_MESH_FAIR_SHARE = 272,      /* VAR_MESH_FAIR_SHARE  */
+  YYSYMBOL_VAR_MESH_FAIR_SHARE_PREFIX4 = 273, /* VAR_MESH_FAIR_SHARE_PREFIX4  */
+  YYSYMBOL_VAR_MESH_FAIR_SHARE_PREFIX6 = 274, /* VAR_MESH_FAIR_SHARE_PREFIX6  */
+  YYSYMBOL_VAR_SIG_CACHE_SIZE = 275,       /* VAR_SIG_CACHE_SIZE  */
+  YYSYMBOL_VAR_SIG_CACHE_SLABS = 276,      /* VAR_SIG_CACHE_SLABS  */
+  YYSYMBOL_VAR_VAL_CRYPTO_THREADS = 277,   /* VAR_VAL_CRYPTO_THREADS  */
+  YYSYMBOL_VAR_NSEC3_HASH_CACHE_SIZE = 278, /* VAR_NSEC3_HASH_CACHE_SIZE  */
+  YYSYMBOL_VAR_NSEC3_HASH_CACHE_SLABS = 279, /* VAR_NSEC3_HASH_CACHE_SLABS  */
+  YYSYMBOL_VAR_NSEC3_HASH_RATELIMIT = 280, /* VAR_NSEC3_HASH_RATELIMIT  */
+  YYSYMBOL_VAR_HEDGE_PERCENTILE = 281,     /* VAR_HEDGE_PERCENTILE  */
+  YYSYMBOL_VAR_HEDGE_BUDGET = 282,         /* VAR_HEDGE_BUDGET  */
+  YYSYMBOL_VAR_TARGET_FETCH_PARALLEL = 283, /* VAR_TARGET_FETCH_PARALLEL  */
+  YYSYMBOL_VAR_REFRESH_POPULAR = 284,      /* VAR_REFRESH_POPULAR  */
+  YYSYMBOL_VAR_REFRESH_POPULAR_RATE = 285, /* VAR_REFRESH_POPULAR_RATE  */
+  YYSYMBOL_VAR_REFRESH_POPULAR_SIZE = 286, /* VAR_REFRESH_POPULAR_SIZE  */
+  YYSYMBOL_VAR_SERVE_EXPIRED_CLIENT_TIMEOUT = 287, /* VAR_SERVE_EXPIRED_CLIENT_TIMEOUT  */
+  YYSYMBOL_VAR_SYNTH_INSECURE_DNAME = 288, /* VAR_SYNTH_INSECURE_DNAME  */
+  YYSYMBOL_VAR_INFRA_CACHE_RTT_PERCENTILE = 289, /* VAR_INFRA_CACHE_RTT_PERCENTILE  */
+  YYSYMBOL_YYACCEPT = 290,                 /* $accept  */
+  YYSYMBOL_toplevelvars = 291,             /* toplevelvars  */
+  YYSYMBOL_toplevelvar = 292,              /* toplevelvar  */
+  YYSYMBOL_serverstart = 293,              /* serverstart  */
+  YYSYMBOL_contents_server = 294,          /* contents_server  */
+  YYSYMBOL_content_server = 295,           /* content_server  */
+  YYSYMBOL_stubstart = 296,                /* stubstart  */
+  YYSYMBOL_contents_stub = 297,            /* contents_stub  */
+  YYSYMBOL_content_stub = 298,             /* content_stub  */
+  YYSYMBOL_forwardstart = 299,             /* forwardstart  */
+  YYSYMBOL_contents_forward = 300,         /* contents_forward  */
+  YYSYMBOL_content_forward = 301,          /* content_forward  */
+  YYSYMBOL_viewstart = 302,                /* viewstart  */
+  YYSYMBOL_contents_view = 303,            /* contents_view  */
+  YYSYMBOL_content_view = 304,             /* content_view  */
+  YYSYMBOL_authstart = 305,                /* authstart  */
+  YYSYMBOL_contents_auth = 306,            /* contents_auth  */
+  YYSYMBOL_content_auth = 307,             /* content_auth  */
+  YYSYMBOL_server_num_threads = 308,       /* server_num_threads  */
+  YYSYMBOL_server_verbosity = 309,         /* server_verbosity  */
+  YYSYMBOL_server_statistics_interval = 310, /* server_statistics_interval  */
+  YYSYMBOL_server_statistics_cumulative = 311, /* server_statistics_cumulative  */
+  YYSYMBOL_server_extended_statistics = 312, /* server_extended_statistics  */
+  YYSYMBOL_server_shm_enable = 313,        /* server_shm_enable  */
+  YYSYMBOL_server_shm_key = 314,           /* server_shm_key  */
+  YYSYMBOL_server_port = 315,              /* server_port  */
+  YYSYMBOL_server_send_client_subnet = 316, /* server_send_client_subnet  */
+  YYSYMBOL_server_client_subnet_zone = 317, /* server_client_subnet_zone  */
+  YYSYMBOL_server_client_subnet_always_forward = 318, /* server_client_subnet_always_forward  */
+  YYSYMBOL_server_client_subnet_opcode = 319, /* server_client_subnet_opcode  */
+  YYSYMBOL_server_max_client_subnet_ipv4 = 320, /* server_max_client_subnet_ipv4  */
+  YYSYMBOL_server_max_client_subnet_ipv6 = 321, /* server_max_client_subnet_ipv6  */
+  YYSYMBOL_server_min_client_subnet_ipv4 = 322, /* server_min_client_subnet_ipv4  */
+  YYSYMBOL_server_min_client_subnet_ipv6 = 323, /* server_min_client_subnet_ipv6  */
+  YYSYMBOL_server_max_ecs_tree_size_ipv4 = 324, /* server_max_ecs_tree_size_ipv4  */
+  YYSYMBOL_server_max_ecs_tree_size_ipv6 = 325, /* server_max_ecs_tree_size_ipv6  */
+  YYSYMBOL_server_interface = 326,         /* server_interface  */
+  YYSYMBOL_server_outgoing_interface = 327, /* server_outgoing_interface  */
+  YYSYMBOL_server_outgoing_range = 328,    /* server_outgoing_range  */
+  YYSYMBOL_server_outgoing_port_permit = 329, /* server_outgoing_port_permit  */
+  YYSYMBOL_server_outgoing_port_avoid = 330, /* server_outgoing_port_avoid  */
+  YYSYMBOL_server_outgoing_num_tcp = 331,  /* server_outgoing_num_tcp  */
+  YYSYMBOL_server_incoming_num_tcp = 332,  /* server_incoming_num_tcp  */
+  YYSYMBOL_server_interface_automatic = 333, /* server_interface_automatic  */
+  YYSYMBOL_server_do_ip4 = 334,            /* server_do_ip4  */
+  YYSYMBOL_server_do_ip6 = 335,            /* server_do_ip6  */
+  YYSYMBOL_server_do_udp = 336,            /* server_do_udp  */
+  YYSYMBOL_server_do_tcp = 337,            /* server_do_tcp  */
+  YYSYMBOL_server_prefer_ip6 = 338,        /* server_prefer_ip6  */
+  YYSYMBOL_server_tcp_mss = 339,           /* server_tcp_mss  */
+  YYSYMBOL_server_outgoing_tcp_mss = 340,  /* server_outgoing_tcp_mss  */
+  YYSYMBOL_server_tcp_idle_timeout = 341,  /* server_tcp_idle_timeout  */
+  YYSYMBOL_server_tcp_keepalive = 342,     /* server_tcp_keepalive  */
+  YYSYMBOL_server_tcp_keepalive_timeout = 343, /* server_tcp_keepalive_timeout  */
+  YYSYMBOL_server_tcp_upstream = 344,      /* server_tcp_upstream  */
+  YYSYMBOL_server_udp_upstream_without_downstream = 345, /* server_udp_upstream_without_downstream  */
+  YYSYMBOL_server_ssl_upstream = 346,      /* server_ssl_upstream  */
+  YYSYMBOL_server_ssl_service_key = 347,   /* server_ssl_service_key  */
+  YYSYMBOL_server_ssl_service_pem = 348,   /* server_ssl_service_pem  */
+  YYSYMBOL_server_ssl_port = 349,          /* server_ssl_port  */
+  YYSYMBOL_server_tls_cert_bundle = 350,   /* server_tls_cert_bundle  */
+  YYSYMBOL_server_tls_win_cert = 351,      /* server_tls_win_cert  */
+  YYSYMBOL_server_tls_additional_port = 352, /* server_tls_additional_port  */
+  YYSYMBOL_server_tls_ciphers = 353,       /* server_tls_ciphers  */
+  YYSYMBOL_server_tls_ciphersuites = 354,  /* server_tls_ciphersuites  */
+  YYSYMBOL_server_tls_session_ticket_keys = 355, /* server_tls_session_ticket_keys  */
+  YYSYMBOL_server_use_systemd = 356,       /* server_use_systemd  */
+  YYSYMBOL_server_do_daemonize = 357,      /* server_do_daemonize  */
+  YYSYMBOL_server_use_syslog = 358,        /* server_use_syslog  */
+  YYSYMBOL_server_log_time_ascii = 359,    /* server_log_time_ascii  */
+  YYSYMBOL_server_log_queries = 360,       /* server_log_queries  */
+  YYSYMBOL_server_log_replies = 361,       /* server_log_replies  */
+  YYSYMBOL_server_log_tag_queryreply = 362, /* server_log_tag_queryreply  */
+  YYSYMBOL_server_log_servfail = 363,      /* server_log_servfail  */
+  YYSYMBOL_server_log_local_actions = 364, /* server_log_local_actions  */
+  YYSYMBOL_server_chroot = 365,            /* server_chroot  */
+  YYSYMBOL_server_username = 366,          /* server_username  */
+  YYSYMBOL_server_directory = 367,         /* server_directory  */
+  YYSYMBOL_server_logfile = 368,           /* server_logfile  */
+  YYSYMBOL_server_pidfile = 369,           /* server_pidfile  */
+  YYSYMBOL_server_root_hints = 370,        /* server_root_hints  */
+  YYSYMBOL_server_dlv_anchor_file = 371,   /* server_dlv_anchor_file  */
+  YYSYMBOL_server_dlv_anchor = 372,        /* server_dlv_anchor  */
+  YYSYMBOL_server_auto_trust_anchor_file = 373, /* server_auto_trust_anchor_file  */
+  YYSYMBOL_server_trust_anchor_file = 374, /* server_trust_anchor_file  */
+  YYSYMBOL_server_trusted_keys_file = 375, /* server_trusted_keys_file  */
+  YYSYMBOL_server_trust_anchor = 376,      /* server_trust_anchor  */
+  YYSYMBOL_server_trust_anchor_signaling = 377, /* server_trust_anchor_signaling  */
+  YYSYMBOL_server_root_key_sentinel = 378, /* server_root_key_sentinel  */
+  YYSYMBOL_server_domain_insecure = 379,   /* server_domain_insecure  */
+  YYSYMBOL_server_hide_identity = 380,     /* server_hide_identity  */
+  YYSYMBOL_server_hide_version = 381,      /* server_hide_version  */
+  YYSYMBOL_server_hide_trustanchor = 382,  /* server_hide_trustanchor  */
+  YYSYMBOL_server_identity = 383,          /* server_identity  */
+  YYSYMBOL_server_version = 384,           /* server_version  */
+  YYSYMBOL_server_so_rcvbuf = 385,         /* server_so_rcvbuf  */
+  YYSYMBOL_server_so_sndbuf = 386,         /* server_so_sndbuf  */
+  YYSYMBOL_server_so_reuseport = 387,      /* server_so_reuseport  */
+  YYSYMBOL_server_ip_transparent = 388,    /* server_ip_transparent  */
+  YYSYMBOL_server_ip_freebind = 389,       /* server_ip_freebind  */
+  YYSYMBOL_server_stream_wait_size = 390,  /* server_stream_wait_size  */
+  YYSYMBOL_server_edns_buffer_size = 391,  /* server_edns_buffer_size  */
+  YYSYMBOL_server_msg_buffer_size = 392,   /* server_msg_buffer_size  */
+  YYSYMBOL_server_msg_cache_size = 393,    /* server_msg_cache_size  */
+  YYSYMBOL_server_msg_cache_slabs = 394,   /* server_msg_cache_slabs  */
+  YYSYMBOL_server_num_queries_per_thread = 395, /* server_num_queries_per_thread  */
+  YYSYMBOL_server_jostle_timeout = 396,    /* server_jostle_timeout  */
+  YYSYMBOL_server_mesh_class_weight = 397, /* server_mesh_class_weight  */
+  YYSYMBOL_server_mesh_class_limit = 398,  /* server_mesh_class_limit  */
+  YYSYMBOL_server_trace_sample_rate = 399, /* server_trace_sample_rate  */
+  YYSYMBOL_server_trace_slow_threshold = 400, /* server_trace_slow_threshold  */
+  YYSYMBOL_server_work_stealing = 401,     /* server_work_stealing  */
+  YYSYMBOL_server_mesh_fair_share = 402,   /* server_mesh_fair_share  */
+  YYSYMBOL_server_mesh_fair_share_prefix4 = 403, /* server_mesh_fair_share_prefix4  */
+  YYSYMBOL_server_mesh_fair_share_prefix6 = 404, /* server_mesh_fair_share_prefix6  */
+  YYSYMBOL_server_delay_close = 405,       /* server_delay_close  */
+  YYSYMBOL_server_unblock_lan_zones = 406, /* server_unblock_lan_zones  */
+  YYSYMBOL_server_insecure_lan_zones = 407, /* server_insecure_lan_zones  */
+  YYSYMBOL_server_rrset_cache_size = 408,  /* server_rrset_cache_size  */
+  YYSYMBOL_server_rrset_cache_slabs = 409, /* server_rrset_cache_slabs  */
+  YYSYMBOL_server_infra_host_ttl = 410,    /* server_infra_host_ttl  */
+  YYSYMBOL_server_infra_lame_ttl = 411,    /* server_infra_lame_ttl  */
+  YYSYMBOL_server_infra_cache_numhosts = 412, /* server_infra_cache_numhosts  */
+  YYSYMBOL_server_infra_cache_lame_size = 413, /* server_infra_cache_lame_size  */
+  YYSYMBOL_server_infra_cache_slabs = 414, /* server_infra_cache_slabs  */
+  YYSYMBOL_server_infra_cache_min_rtt = 415, /* server_infra_cache_min_rtt  */
+  YYSYMBOL_server_infra_cache_rtt_percentile = 416, /* server_infra_cache_rtt_percentile  */
+  YYSYMBOL_server_target_fetch_policy = 417, /* server_target_fetch_policy  */
+  YYSYMBOL_server_target_fetch_parallel = 418, /* server_target_fetch_parallel  */
+  YYSYMBOL_server_harden_short_bufsize = 419, /* server_harden_short_bufsize  */
+  YYSYMBOL_server_harden_large_queries = 420, /* server_harden_large_queries  */
+  YYSYMBOL_server_harden_glue = 421,       /* server_harden_glue  */
+  YYSYMBOL_server_harden_dnssec_stripped = 422, /* server_harden_dnssec_stripped  */
+  YYSYMBOL_server_harden_below_nxdomain = 423, /* server_harden_below_nxdomain  */
+  YYSYMBOL_server_harden_referral_path = 424, /* server_harden_referral_path  */
+  YYSYMBOL_server_harden_algo_downgrade = 425, /* server_harden_algo_downgrade  */
+  YYSYMBOL_server_use_caps_for_id = 426,   /* server_use_caps_for_id  */
+  YYSYMBOL_server_caps_whitelist = 427,    /* server_caps_whitelist  */
+  YYSYMBOL_server_private_address = 428,   /* server_private_address  */
+  YYSYMBOL_server_private_domain = 429,    /* server_private_domain  */
+  YYSYMBOL_server_prefetch = 430,          /* server_prefetch  */
+  YYSYMBOL_server_prefetch_key = 431,      /* server_prefetch_key  */
+  YYSYMBOL_server_refresh_popular = 432,   /* server_refresh_popular  */
+  YYSYMBOL_server_refresh_popular_rate = 433, /* server_refresh_popular_rate  */
+  YYSYMBOL_server_refresh_popular_size = 434, /* server_refresh_popular_size  */
+  YYSYMBOL_server_deny_any = 435,          /* server_deny_any  */
+  YYSYMBOL_server_unwanted_reply_threshold = 436, /* server_unwanted_reply_threshold  */
+  YYSYMBOL_server_do_not_query_address = 437, /* server_do_not_query_address  */
+  YYSYMBOL_server_do_not_query_localhost = 438, /* server_do_not_query_localhost  */
+  YYSYMBOL_server_access_control = 439,    /* server_access_control  */
+  YYSYMBOL_server_module_conf = 440,       /* server_module_conf  */
+  YYSYMBOL_server_val_override_date = 441, /* server_val_override_date  */
+  YYSYMBOL_server_val_sig_skew_min = 442,  /* server_val_sig_skew_min  */
+  YYSYMBOL_server_val_sig_skew_max = 443,  /* server_val_sig_skew_max  */
+  YYSYMBOL_server_cache_max_ttl = 444,     /* server_cache_max_ttl  */
+  YYSYMBOL_server_cache_max_negative_ttl = 445, /* server_cache_max_negative_ttl  */
+  YYSYMBOL_server_cache_min_ttl = 446,     /* server_cache_min_ttl  */
+  YYSYMBOL_server_bogus_ttl = 447,         /* server_bogus_ttl  */
+  YYSYMBOL_server_val_clean_additional = 448, /* server_val_clean_additional  */
+  YYSYMBOL_server_val_permissive_mode = 449, /* server_val_permissive_mode  */
+  YYSYMBOL_server_aggressive_nsec = 450,   /* server_aggressive_nsec  */
+  YYSYMBOL_server_synth_insecure_dname = 451, /* server_synth_insecure_dname  */
+  YYSYMBOL_server_ignore_cd_flag = 452,    /* server_ignore_cd_flag  */
+  YYSYMBOL_server_serve_expired = 453,     /* server_serve_expired  */
+  YYSYMBOL_server_serve_expired_ttl = 454, /* server_serve_expired_ttl  */
+  YYSYMBOL_server_serve_expired_ttl_reset = 455, /* server_serve_expired_ttl_reset  */
+  YYSYMBOL_server_serve_expired_client_timeout = 456, /* server_serve_expired_client_timeout  */
+  YYSYMBOL_server_fake_dsa = 457,          /* server_fake_dsa  */
+  YYSYMBOL_server_fake_sha1 = 458,         /* server_fake_sha1  */
+  YYSYMBOL_server_val_log_level = 459,     /* server_val_log_level  */
+  YYSYMBOL_server_val_nsec3_keysize_iterations = 460, /* server_val_nsec3_keysize_iterations  */
+  YYSYMBOL_server_add_holddown = 461,      /* server_add_holddown  */
+  YYSYMBOL_server_del_holddown = 462,      /* server_del_holddown  */
+  YYSYMBOL_server_keep_missing = 463,      /* server_keep_missing  */
+  YYSYMBOL_server_permit_small_holddown = 464, /* server_permit_small_holddown  */
+  YYSYMBOL_server_key_cache_size = 465,    /* server_key_cache_size  */
+  YYSYMBOL_server_key_cache_slabs = 466,   /* server_key_cache_slabs  */
+  YYSYMBOL_server_sig_cache_size = 467,    /* server_sig_cache_size  */
+  YYSYMBOL_server_sig_cache_slabs = 468,   /* server_sig_cache_slabs  */
+  YYSYMBOL_server_val_crypto_threads = 469, /* server_val_crypto_threads  */
+  YYSYMBOL_server_nsec3_hash_cache_size = 470, /* server_nsec3_hash_cache_size  */
+  YYSYMBOL_server_nsec3_hash_cache_slabs = 471, /* server_nsec3_hash_cache_slabs  */
+  YYSYMBOL_server_nsec3_hash_ratelimit = 472, /* server_nsec3_hash_ratelimit  */
+  YYSYMBOL_server_neg_cache_size = 473,    /* server_neg_cache_size  */
+  YYSYMBOL_server_local_zone = 474,        /* server_local_zone  */
+  YYSYMBOL_server_local_data = 475,        /* server_local_data  */
+  YYSYMBOL_server_local_data_ptr = 476,    /* server_local_data_ptr  */
+  YYSYMBOL_server_minimal_responses = 477, /* server_minimal_responses  */
+  YYSYMBOL_server_rrset_roundrobin = 478,  /* server_rrset_roundrobin  */
+  YYSYMBOL_server_unknown_server_time_limit = 479, /* server_unknown_server_time_limit  */
+  YYSYMBOL_server_max_udp_size = 480,      /* server_max_udp_size  */
+  YYSYMBOL_server_dns64_prefix = 481,      /* server_dns64_prefix  */
+  YYSYMBOL_server_dns64_synthall = 482,    /* server_dns64_synthall  */
+  YYSYMBOL_server_dns64_ignore_aaaa = 483, /* server_dns64_ignore_aaaa  */
+  YYSYMBOL_server_define_tag = 484,        /* server_define_tag  */
+  YYSYMBOL_server_local_zone_tag = 485,    /* server_local_zone_tag  */
+  YYSYMBOL_server_access_control_tag = 486, /* server_access_control_tag  */
+  YYSYMBOL_server_access_control_tag_action = 487, /* server_access_control_tag_action  */
+  YYSYMBOL_server_access_control_tag_data = 488, /* server_access_control_tag_data  */
+  YYSYMBOL_server_local_zone_override = 489, /* server_local_zone_override  */
+  YYSYMBOL_server_access_control_view = 490, /* server_access_control_view  */
+  YYSYMBOL_server_response_ip_tag = 491,   /* server_response_ip_tag  */
+  YYSYMBOL_server_ip_ratelimit = 492,      /* server_ip_ratelimit  */
+  YYSYMBOL_server_ratelimit = 493,         /* server_ratelimit  */
+  YYSYMBOL_server_ip_ratelimit_size = 494, /* server_ip_ratelimit_size  */
+  YYSYMBOL_server_ratelimit_size = 495,    /* server_ratelimit_size  */
+  YYSYMBOL_server_ip_ratelimit_slabs = 496, /* server_ip_ratelimit_slabs  */
+  YYSYMBOL_server_ratelimit_slabs = 497,   /* server_ratelimit_slabs  */
+  YYSYMBOL_server_ratelimit_for_domain = 498, /* server_ratelimit_for_domain  */
+  YYSYMBOL_server_ratelimit_below_domain = 499, /* server_ratelimit_below_domain  */
+  YYSYMBOL_server_ip_ratelimit_factor = 500, /* server_ip_ratelimit_factor  */
+  YYSYMBOL_server_ratelimit_factor = 501,  /* server_ratelimit_factor  */
+  YYSYMBOL_server_low_rtt = 502,           /* server_low_rtt  */
+  YYSYMBOL_server_fast_server_num = 503,   /* server_fast_server_num  */
+  YYSYMBOL_server_fast_server_permil = 504, /* server_fast_server_permil  */
+  YYSYMBOL_server_hedge_percentile = 505,  /* server_hedge_percentile  */
+  YYSYMBOL_server_hedge_budget = 506,      /* server_hedge_budget  */
+  YYSYMBOL_server_qname_minimisation = 507, /* server_qname_minimisation  */
+  YYSYMBOL_server_qname_minimisation_strict = 508, /* server_qname_minimisation_strict  */
+  YYSYMBOL_server_ipsecmod_enabled = 509,  /* server_ipsecmod_enabled  */
+  YYSYMBOL_server_ipsecmod_ignore_bogus = 510, /* server_ipsecmod_ignore_bogus  */
+  YYSYMBOL_server_ipsecmod_hook = 511,     /* server_ipsecmod_hook  */
+  YYSYMBOL_server_ipsecmod_max_ttl = 512,  /* server_ipsecmod_max_ttl  */
+  YYSYMBOL_server_ipsecmod_whitelist = 513, /* server_ipsecmod_whitelist  */
+  YYSYMBOL_server_ipsecmod_strict = 514,   /* server_ipsecmod_strict  */
+  YYSYMBOL_stub_name = 515,                /* stub_name  */
+  YYSYMBOL_stub_host = 516,                /* stub_host  */
+  YYSYMBOL_stub_addr = 517,                /* stub_addr  */
+  YYSYMBOL_stub_first = 518,               /* stub_first  */
+  YYSYMBOL_stub_no_cache = 519,            /* stub_no_cache  */
+  YYSYMBOL_stub_ssl_upstream = 520,        /* stub_ssl_upstream  */
+  YYSYMBOL_stub_prime = 521,               /* stub_prime  */
+  YYSYMBOL_forward_name = 522,             /* forward_name  */
+  YYSYMBOL_forward_host = 523,             /* forward_host  */
+  YYSYMBOL_forward_addr = 524,             /* forward_addr  */
+  YYSYMBOL_forward_first = 525,            /* forward_first  */
+  YYSYMBOL_forward_no_cache = 526,         /* forward_no_cache  */
+  YYSYMBOL_forward_ssl_upstream = 527,     /* forward_ssl_upstream  */
+  YYSYMBOL_auth_name = 528,                /* auth_name  */
+  YYSYMBOL_auth_zonefile = 529,            /* auth_zonefile  */
+  YYSYMBOL_auth_master = 530,              /* auth_master  */
+  YYSYMBOL_auth_url = 531,                 /* auth_url  */
+  YYSYMBOL_auth_allow_notify = 532,        /* auth_allow_notify  */
+  YYSYMBOL_auth_for_downstream = 533,      /* auth_for_downstream  */
+  YYSYMBOL_auth_for_upstream = 534,        /* auth_for_upstream  */
+  YYSYMBOL_auth_fallback_enabled = 535,    /* auth_fallback_enabled  */
+  YYSYMBOL_view_name = 536,                /* view_name  */
+  YYSYMBOL_view_local_zone = 537,          /* view_local_zone  */
+  YYSYMBOL_view_response_ip = 538,         /* view_response_ip  */
+  YYSYMBOL_view_response_ip_data = 539,    /* view_response_ip_data  */
+  YYSYMBOL_view_local_data = 540,          /* view_local_data  */
+  YYSYMBOL_view_local_data_ptr = 541,      /* view_local_data_ptr  */
+  YYSYMBOL_view_first = 542,               /* view_first  */
+  YYSYMBOL_rcstart = 543,                  /* rcstart  */
+  YYSYMBOL_contents_rc = 544,              /* contents_rc  */
+  YYSYMBOL_content_rc = 545,               /* content_rc  */
+  YYSYMBOL_rc_control_enable = 546,        /* rc_control_enable  */
+  YYSYMBOL_rc_control_port = 547,          /* rc_control_port  */
+  YYSYMBOL_rc_control_interface = 548,     /* rc_control_interface  */
+  YYSYMBOL_rc_control_use_cert = 549,      /* rc_control_use_cert  */
+  YYSYMBOL_rc_server_key_file = 550,       /* rc_server_key_file  */
+  YYSYMBOL_rc_server_cert_file = 551,      /* rc_server_cert_file  */
+  YYSYMBOL_rc_control_key_file = 552,      /* rc_control_key_file  */
+  YYSYMBOL_rc_control_cert_file = 553,     /* rc_control_cert_file  */
+  YYSYMBOL_dtstart = 554,                  /* dtstart  */
+  YYSYMBOL_contents_dt = 555,              /* contents_dt  */
+  YYSYMBOL_content_dt = 556,               /* content_dt  */
+  YYSYMBOL_dt_dnstap_enable = 557,         /* dt_dnstap_enable  */
+  YYSYMBOL_dt_dnstap_socket_path = 558,    /* dt_dnstap_socket_path  */
+  YYSYMBOL_dt_dnstap_send_identity = 559,  /* dt_dnstap_send_identity  */
+  YYSYMBOL_dt_dnstap_send_version = 560,   /* dt_dnstap_send_version  */
+  YYSYMBOL_dt_dnstap_identity = 561,       /* dt_dnstap_identity  */
+  YYSYMBOL_dt_dnstap_version = 562,        /* dt_dnstap_version  */
+  YYSYMBOL_dt_dnstap_log_resolver_query_messages = 563, /* dt_dnstap_log_resolver_query_messages  */
+  YYSYMBOL_dt_dnstap_log_resolver_response_messages = 564, /* dt_dnstap_log_resolver_response_messages  */
+  YYSYMBOL_dt_dnstap_log_client_query_messages = 565, /* dt_dnstap_log_client_query_messages  */
+  YYSYMBOL_dt_dnstap_log_client_response_messages = 566, /* dt_dnstap_log_client_response_messages  */
+  YYSYMBOL_dt_dnstap_log_forwarder_query_messages = 567, /* dt_dnstap_log_forwarder_query_messages  */
+  YYSYMBOL_dt_dnstap_log_forwarder_response_messages = 568, /* dt_dnstap_log_forwarder_response_messages  */
+  YYSYMBOL_pythonstart = 569,              /* pythonstart  */
+  YYSYMBOL_contents_py = 570,              /* contents_py  */
+  YYSYMBOL_content_py = 571,               /* content_py  */
+  YYSYMBOL_py_script = 572,                /* py_script  */
+  YYSYMBOL_server_disable_dnssec_lame_check = 573, /* server_disable_dnssec_lame_check  */
+  YYSYMBOL_server_log_identity = 574,      /* server_log_identity  */
+  YYSYMBOL_server_response_ip = 575,       /* server_response_ip  */
+  YYSYMBOL_server_response_ip_data = 576,  /* server_response_ip_data  */
+  YYSYMBOL_dnscstart = 577,                /* dnscstart  */
+  YYSYMBOL_contents_dnsc = 578,            /* contents_dnsc  */
+  YYSYMBOL_content_dnsc = 579,             /* content_dnsc  */
+  YYSYMBOL_dnsc_dnscrypt_enable = 580,     /* dnsc_dnscrypt_enable  */
+  YYSYMBOL_dnsc_dnscrypt_port = 581,       /* dnsc_dnscrypt_port  */
+  YYSYMBOL_dnsc_dnscrypt_provider = 582,   /* dnsc_dnscrypt_provider  */
+  YYSYMBOL_dnsc_dnscrypt_provider_cert = 583, /* dnsc_dnscrypt_provider_cert  */
+  YYSYMBOL_dnsc_dnscrypt_provider_cert_rotated = 584, /* dnsc_dnscrypt_provider_cert_rotated  */
+  YYSYMBOL_dnsc_dnscrypt_secret_key = 585, /* dnsc_dnscrypt_secret_key  */
+  YYSYMBOL_dnsc_dnscrypt_shared_secret_cache_size = 586, /* dnsc_dnscrypt_shared_secret_cache_size  */
+  YYSYMBOL_dnsc_dnscrypt_shared_secret_cache_slabs = 587, /* dnsc_dnscrypt_shared_secret_cache_slabs  */
+  YYSYMBOL_dnsc_dnscrypt_nonce_cache_size = 588, /* dnsc_dnscrypt_nonce_cache_size  */
+  YYSYMBOL_dnsc_dnscrypt_nonce_cache_slabs = 589, /* dnsc_dnscrypt_nonce_cache_slabs  */
+  YYSYMBOL_cachedbstart = 590,             /* cachedbstart  */
+  YYSYMBOL_contents_cachedb = 591,         /* contents_cachedb  */
+  YYSYMBOL_content_cachedb = 592,          /* content_cachedb  */
+  YYSYMBOL_cachedb_backend_name = 593,     /* cachedb_backend_name  */
+  YYSYMBOL_cachedb_secret_seed = 594,      /* cachedb_secret_seed  */
+  YYSYMBOL_redis_server_host = 595,        /* redis_server_host  */
+  YYSYMBOL_redis_server_port = 596,        /* redis_server_port  */
+  YYSYMBOL_redis_timeout = 597,            /* redis_timeout  */
+  YYSYMBOL_server_tcp_connection_limit = 598 /* server_tcp_connection_limit  */
 };
+typedef enum yysymbol_kind_t yysymbol_kind_t;
 
-typedef union YYSTYPE YYSTYPE;
-# define YYSTYPE_IS_TRIVIAL 1
-# define YYSTYPE_IS_DECLARED 1
-#endif
 
 
-extern YYSTYPE yylval;
 
-int yyparse (void);
+#ifdef short
+# undef short
+#endif
 
-#endif /* !YY_YY_UTIL_CONFIGPARSER_H_INCLUDED  */
+/* On compilers that do not define __PTRDIFF_MAX__ etc., make sure
+   <limits.h> and (if available) <stdint.h> are included
+   so that the code can choose integer types of a good width.  */
 
-/* Copy the second part of user declarations.  */
+#ifndef __PTRDIFF_MAX__
+# include <limits.h> /* INFRINGES ON USER NAME SPACE */
+# if defined __STDC_VERSION__ && 199901 <= __STDC_VERSION__
+#  include <stdint.h> /* INFRINGES ON USER NAME SPACE */
+#  define YY_STDINT_H
+# endif
+#endif
 
-#line 688 "util/configparser.c" /* yacc.c:358  */
+/* Narrow types that promote to a signed type and that can represent a
+   signed or unsigned integer of at least N bits.  In tables they can
+   save space and decrease cache pressure.  Promoting to a signed type
+   helps avoid bugs in integer arithmetic.  */
 
-#ifdef short
-# undef short
+#ifdef __INT_LEAST8_MAX__
+typedef __INT_LEAST8_TYPE__ yytype_int8;
+#elif defined YY_STDINT_H
+typedef int_least8_t yytype_int8;
+#else
+typedef signed char yytype_int8;
 #endif
 
-#ifdef YYTYPE_UINT8
-typedef YYTYPE_UINT8 yytype_uint8;
+#ifdef __INT_LEAST16_MAX__
+typedef __INT_LEAST16_TYPE__ yytype_int16;
+#elif defined YY_STDINT_H
+typedef int_least16_t yytype_int16;
 #else
-typedef unsigned char yytype_uint8;
+typedef short yytype_int16;
 #endif
 
-#ifdef YYTYPE_INT8
-typedef YYTYPE_INT8 yytype_int8;
-#else
-typedef signed char yytype_int8;
+/* Work around bug in HP-UX 11.23, which defines these macros
+   incorrectly for preprocessor constants.  This workaround can likely
+   be removed in 2023, as HPE has promised support for HP-UX 11.23
+   (aka HP-UX 11i v2) only through the end of 2022; see Table 2 of
+   <https://h20195.www2.hpe.com/V2/getpdf.aspx/4AA4-7673ENW.pdf>.  */
+#ifdef __hpux
+# undef UINT_LEAST8_MAX
+# undef UINT_LEAST16_MAX
+# define UINT_LEAST8_MAX 255
+# define UINT_LEAST16_MAX 65535
 #endif
 
-#ifdef YYTYPE_UINT16
-typedef YYTYPE_UINT16 yytype_uint16;
+#if defined __UINT_LEAST8_MAX__ && __UINT_LEAST8_MAX__ <= __INT_MAX__
+typedef __UINT_LEAST8_TYPE__ yytype_uint8;
+#elif (!defined __UINT_LEAST8_MAX__ && defined YY_STDINT_H \
+       && UINT_LEAST8_MAX <= INT_MAX)
+typedef uint_least8_t yytype_uint8;
+#elif !defined __UINT_LEAST8_MAX__ && UCHAR_MAX <= INT_MAX
+typedef unsigned char yytype_uint8;
 #else
-typedef unsigned short int yytype_uint16;
+typedef short yytype_uint8;
 #endif
 
-#ifdef YYTYPE_INT16
-typedef YYTYPE_INT16 yytype_int16;
+#if defined __UINT_LEAST16_MAX__ && __UINT_LEAST16_MAX__ <= __INT_MAX__
+typedef __UINT_LEAST16_TYPE__ yytype_uint16;
+#elif (!defined __UINT_LEAST16_MAX__ && defined YY_STDINT_H \
+       && UINT_LEAST16_MAX <= INT_MAX)
+typedef uint_least16_t yytype_uint16;
+#elif !defined __UINT_LEAST16_MAX__ && USHRT_MAX <= INT_MAX
+typedef unsigned short yytype_uint16;
 #else
-typedef short int yytype_int16;
+typedef int yytype_uint16;
+#endif
+
+#ifndef YYPTRDIFF_T
+# if defined __PTRDIFF_TYPE__ && defined __PTRDIFF_MAX__
+#  define YYPTRDIFF_T __PTRDIFF_TYPE__
+#  define YYPTRDIFF_MAXIMUM __PTRDIFF_MAX__
+# elif defined PTRDIFF_MAX
+#  ifndef ptrdiff_t
+#   include <stddef.h> /* INFRINGES ON USER NAME SPACE */
+#  endif
+#  define YYPTRDIFF_T ptrdiff_t
+#  define YYPTRDIFF_MAXIMUM PTRDIFF_MAX
+# else
+#  define YYPTRDIFF_T long
+#  define YYPTRDIFF_MAXIMUM LONG_MAX
+# endif
 #endif
 
 #ifndef YYSIZE_T
@@ -719,15 +821,28 @@ typedef short int yytype_int16;
 #  define YYSIZE_T __SIZE_TYPE__
 # elif defined size_t
 #  define YYSIZE_T size_t
-# elif ! defined YYSIZE_T
+# elif defined __STDC_VERSION__ && 199901 <= __STDC_VERSION__
 #  include <stddef.h> /* INFRINGES ON USER NAME SPACE */
 #  define YYSIZE_T size_t
 # else
-#  define YYSIZE_T unsigned int
+#  define YYSIZE_T unsigned
 # endif
 #endif
 
-#define YYSIZE_MAXIMUM ((YYSIZE_T) -1)
+#define YYSIZE_MAXIMUM                                  \
+  YY_CAST (YYPTRDIFF_T,                                 \
+           (YYPTRDIFF_MAXIMUM < YY_CAST (YYSIZE_T, -1)  \
+            ? YYPTRDIFF_MAXIMUM                         \
+            : YY_CAST (YYSIZE_T, -1)))
+
+#define YYSIZEOF(X) YY_CAST (YYPTRDIFF_T, sizeof (X))
+
+
+/* Stored state numbers (used for stacks). */
+typedef yytype_int16 yy_state_t;
+
+/* State numbers in computations.  */
+typedef int yy_state_fast_t;
 
 #ifndef YY_
 # if defined YYENABLE_NLS && YYENABLE_NLS
@@ -741,47 +856,43 @@ typedef short int yytype_int16;
 # endif
 #endif
 
-#ifndef YY_ATTRIBUTE
-# if (defined __GNUC__                                               \
-      && (2 < __GNUC__ || (__GNUC__ == 2 && 96 <= __GNUC_MINOR__)))  \
-     || defined __SUNPRO_C && 0x5110 <= __SUNPRO_C
-#  define YY_ATTRIBUTE(Spec) __attribute__(Spec)
-# else
-#  define YY_ATTRIBUTE(Spec) /* empty */
-# endif
-#endif
 
 #ifndef YY_ATTRIBUTE_PURE
-# define YY_ATTRIBUTE_PURE   YY_ATTRIBUTE ((__pure__))
+# if defined __GNUC__ && 2 < __GNUC__ + (96 <= __GNUC_MINOR__)
+#  define YY_ATTRIBUTE_PURE __attribute__ ((__pure__))
+# else
+#  define YY_ATTRIBUTE_PURE
+# endif
 #endif
 
 #ifndef YY_ATTRIBUTE_UNUSED
-# define YY_ATTRIBUTE_UNUSED YY_ATTRIBUTE ((__unused__))
-#endif
-
-#if !defined _Noreturn \
-     && (!defined __STDC_VERSION__ || __STDC_VERSION__ < 201112)
-# if defined _MSC_VER && 1200 <= _MSC_VER
-#  define _Noreturn __declspec (noreturn)
+# if defined __GNUC__ && 2 < __GNUC__ + (7 <= __GNUC_MINOR__)
+#  define YY_ATTRIBUTE_UNUSED __attribute__ ((__unused__))
 # else
-#  define _Noreturn YY_ATTRIBUTE ((__noreturn__))
+#  define YY_ATTRIBUTE_UNUSED
 # endif
 #endif
 
 /* Suppress unused-variable warnings by "using" E.  */
 #if ! defined lint || defined __GNUC__
-# define YYUSE(E) ((void) (E))
+# define YY_USE(E) ((void) (E))
 #else
-# define YYUSE(E) /* empty */
+# define YY_USE(E) /* empty */
 #endif
 
-#if defined __GNUC__ && 407 <= __GNUC__ * 100 + __GNUC_MINOR__
 /* Suppress an incorrect diagnostic about yylval being uninitialized.  */
-# define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN \
-    _Pragma ("GCC diagnostic push") \
-    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")\
+#if defined __GNUC__ && ! defined __ICC && 406 <= __GNUC__ * 100 + __GNUC_MINOR__
+# if __GNUC__ * 100 + __GNUC_MINOR__ < 407
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
+    _Pragma ("GCC diagnostic push")                                     \
+    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")
+# else
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
+    _Pragma ("GCC diagnostic push")                                     \
+    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")              \
     _Pragma ("GCC diagnostic ignored \"-Wmaybe-uninitialized\"")
-# define YY_IGNORE_MAYBE_UNINITIALIZED_END \
+# endif
+# define YY_IGNORE_MAYBE_UNINITIALIZED_END      \
     _Pragma ("GCC diagnostic pop")
 #else
 # define YY_INITIAL_VALUE(Value) Value
@@ -794,8 +905,22 @@ typedef short int yytype_int16;
 # define YY_INITIAL_VALUE(Value) /* Nothing. */
 #endif
 
+#if defined __cplusplus && defined __GNUC__ && ! defined __ICC && 6 <= __GNUC__
+# define YY_IGNORE_USELESS_CAST_BEGIN                          \
+    _Pragma ("GCC diagnostic push")                            \
+    _Pragma ("GCC diagnostic ignored \"-Wuseless-cast\"")
+# define YY_IGNORE_USELESS_CAST_END            \
+    _Pragma ("GCC diagnostic pop")
+#endif
+#ifndef YY_IGNORE_USELESS_CAST_BEGIN
+# define YY_IGNORE_USELESS_CAST_BEGIN
+# define YY_IGNORE_USELESS_CAST_END
+#endif
+
+
+#define YY_ASSERT(E) ((void) (0 && (E)))
 
-#if ! defined yyoverflow || YYERROR_VERBOSE
+#if !defined yyoverflow
 
 /* The parser invokes alloca or malloc; define the necessary symbols.  */
 
@@ -860,8 +985,7 @@ void free (void *); /* INFRINGES ON USER NAME SPACE */
 #   endif
 #  endif
 # endif
-#endif /* ! defined yyoverflow || YYERROR_VERBOSE */
-
+#endif /* !defined yyoverflow */
 
 #if (! defined yyoverflow \
      && (! defined __cplusplus \
@@ -870,17 +994,17 @@ void free (void *); /* INFRINGES ON USER NAME SPACE */
 /* A type that is properly aligned for any stack member.  */
 union yyalloc
 {
-  yytype_int16 yyss_alloc;
+  yy_state_t yyss_alloc;
   YYSTYPE yyvs_alloc;
 };
 
 /* The size of the maximum gap between one aligned stack and the next.  */
-# define YYSTACK_GAP_MAXIMUM (sizeof (union yyalloc) - 1)
+# define YYSTACK_GAP_MAXIMUM (YYSIZEOF (union yyalloc) - 1)
 
 /* The size of an array large to enough to hold all stacks, each with
    N elements.  */
 # define YYSTACK_BYTES(N) \
-     ((N) * (sizeof (yytype_int16) + sizeof (YYSTYPE)) \
+     ((N) * (YYSIZEOF (yy_state_t) + YYSIZEOF (YYSTYPE)) \
       + YYSTACK_GAP_MAXIMUM)
 
 # define YYCOPY_NEEDED 1
@@ -893,11 +1017,11 @@ union yyalloc
 # define YYSTACK_RELOCATE(Stack_alloc, Stack)                           \
     do                                                                  \
       {                                                                 \
-        YYSIZE_T yynewbytes;                                            \
+        YYPTRDIFF_T yynewbytes;                                         \
         YYCOPY (&yyptr->Stack_alloc, Stack, yysize);                    \
         Stack = &yyptr->Stack_alloc;                                    \
-        yynewbytes = yystacksize * sizeof (*Stack) + YYSTACK_GAP_MAXIMUM; \
-        yyptr += yynewbytes / sizeof (*yyptr);                          \
+        yynewbytes = yystacksize * YYSIZEOF (*Stack) + YYSTACK_GAP_MAXIMUM; \
+        yyptr += yynewbytes / YYSIZEOF (*yyptr);                        \
       }                                                                 \
     while (0)
 
@@ -909,12 +1033,12 @@ union yyalloc
 # ifndef YYCOPY
 #  if defined __GNUC__ && 1 < __GNUC__
 #   define YYCOPY(Dst, Src, Count) \
-      __builtin_memcpy (Dst, Src, (Count) * sizeof (*(Src)))
+      __builtin_memcpy (Dst, Src, YY_CAST (YYSIZE_T, (Count)) * sizeof (*(Src)))
 #  else
 #   define YYCOPY(Dst, Src, Count)              \
       do                                        \
         {                                       \
-          YYSIZE_T yyi;                         \
+          YYPTRDIFF_T yyi;                      \
           for (yyi = 0; yyi < (Count); yyi++)   \
             (Dst)[yyi] = (Src)[yyi];            \
         }                                       \
@@ -926,28 +1050,31 @@ union yyalloc
 /* YYFINAL -- State number of the termination state.  */
 #define YYFINAL  2
 /* YYLAST -- Last index in YYTABLE.  */
-#define YYLAST   536
+#define YYLAST   583
 
 /* YYNTOKENS -- Number of terminals.  */
-#define YYNTOKENS  267
+#define YYNTOKENS  290
 /* YYNNTS -- Number of nonterminals.  */
-#define YYNNTS  286
+#define YYNNTS  309
 /* YYNRULES -- Number of rules.  */
-#define YYNRULES  549
+#define YYNRULES  595
 /* YYNSTATES -- Number of states.  */
-#define YYNSTATES  823
+#define YYNSTATES  892
+
+/* YYMAXUTOK -- Last valid token kind.  */
+#define YYMAXUTOK   544
 
-/* YYTRANSLATE[YYX] -- Symbol number corresponding to YYX as returned
-   by yylex, with out-of-bounds checking.  */
-#define YYUNDEFTOK  2
-#define YYMAXUTOK   521
 
-#define YYTRANSLATE(YYX)                                                \
-  ((unsigned int) (YYX) <= YYMAXUTOK ? yytranslate[YYX] : YYUNDEFTOK)
+/* YYTRANSLATE(TOKEN-NUM) -- Symbol number corresponding to TOKEN-NUM
+   as returned by yylex, with out-of-bounds checking.  */
+#define YYTRANSLATE(YYX)                                \
+  (0 <= (YYX) && (YYX) <= YYMAXUTOK                     \
+   ? YY_CAST (yysymbol_kind_t, yytranslate[YYX])        \
+   : YYSYMBOL_YYUNDEF)
 
 /* YYTRANSLATE[TOKEN-NUM] -- Symbol number corresponding to TOKEN-NUM
-   as returned by yylex, without out-of-bounds checking.  */
-static const yytype_uint16 yytranslate[] =
+   as returned by yylex.  */
+static const yytype_int16 yytranslate[] =
 {
        0,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
@@ -1001,87 +1128,101 @@ static const yytype_uint16 yytranslate[] =
      235,   236,   237,   238,   239,   240,   241,   242,   243,   244,
      245,   246,   247,   248,   249,   250,   251,   252,   253,   254,
      255,   256,   257,   258,   259,   260,   261,   262,   263,   264,
-     265,   266
+     265,   266,   267,   268,   269,   270,   271,   272,   273,   274,
+     275,   276,   277,   278,   279,   280,   281,   282,   283,   284,
+     285,   286,   287,   288,   289
 };
 
 #if YYDEBUG
-  /* YYRLINE[YYN] -- Source line where rule number YYN was defined.  */
-static const yytype_uint16 yyrline[] =
+/* YYRLINE[YYN] -- Source line where rule number YYN was defined.  */
+static const yytype_int16 yyrline[] =
 {
-       0,   172,   172,   172,   173,   173,   174,   174,   175,   175,
-     175,   176,   176,   177,   181,   186,   187,   188,   188,   188,
-     189,   189,   190,   190,   191,   191,   192,   192,   192,   193,
-     193,   194,   194,   194,   195,   195,   195,   196,   196,   197,
-     197,   198,   198,   199,   199,   200,   200,   201,   201,   202,
-     202,   203,   203,   204,   204,   204,   205,   205,   205,   206,
-     206,   206,   207,   207,   208,   208,   209,   209,   210,   210,
-     211,   211,   211,   212,   212,   213,   213,   214,   214,   214,
-     215,   215,   216,   216,   217,   217,   218,   218,   218,   219,
-     219,   220,   220,   221,   221,   222,   222,   223,   223,   224,
-     224,   224,   225,   225,   226,   226,   226,   227,   227,   227,
-     228,   228,   228,   229,   229,   229,   229,   230,   231,   231,
-     231,   232,   232,   232,   233,   233,   234,   234,   235,   235,
-     235,   236,   236,   237,   237,   237,   238,   238,   239,   239,
-     240,   241,   241,   242,   242,   243,   243,   244,   245,   245,
-     246,   246,   247,   247,   248,   248,   249,   249,   250,   250,
-     250,   251,   251,   252,   252,   253,   253,   254,   254,   255,
-     255,   256,   256,   256,   257,   257,   257,   258,   258,   258,
-     259,   259,   260,   261,   261,   262,   262,   263,   263,   264,
+       0,   181,   181,   181,   182,   182,   183,   183,   184,   184,
+     184,   185,   185,   186,   190,   195,   196,   197,   197,   197,
+     198,   198,   199,   199,   200,   200,   201,   201,   201,   202,
+     202,   203,   203,   203,   204,   204,   204,   205,   205,   206,
+     206,   207,   207,   208,   208,   209,   209,   210,   210,   211,
+     211,   212,   212,   213,   213,   213,   214,   214,   214,   215,
+     215,   215,   216,   216,   217,   217,   218,   218,   219,   219,
+     220,   220,   220,   221,   221,   222,   222,   223,   223,   223,
+     224,   224,   225,   225,   226,   226,   227,   227,   227,   228,
+     228,   229,   229,   230,   230,   231,   231,   232,   232,   233,
+     233,   233,   234,   234,   235,   235,   235,   236,   236,   236,
+     237,   237,   237,   238,   238,   238,   238,   239,   240,   240,
+     240,   241,   241,   241,   242,   242,   243,   243,   244,   244,
+     244,   245,   245,   246,   246,   246,   247,   247,   248,   248,
+     249,   250,   250,   251,   251,   252,   252,   253,   254,   254,
+     255,   255,   256,   256,   257,   257,   258,   258,   259,   259,
+     259,   260,   260,   261,   261,   262,   262,   263,   263,   264,
      264,   265,   265,   265,   266,   266,   266,   267,   267,   267,
-     268,   268,   269,   269,   270,   270,   272,   284,   285,   286,
-     286,   286,   286,   286,   287,   287,   289,   301,   302,   303,
-     303,   303,   303,   304,   304,   306,   320,   321,   322,   322,
-     322,   322,   323,   323,   323,   325,   341,   342,   343,   343,
-     343,   343,   344,   344,   344,   345,   347,   356,   365,   376,
-     385,   394,   403,   414,   423,   434,   447,   462,   473,   490,
-     507,   524,   541,   556,   571,   584,   599,   608,   617,   626,
-     635,   644,   653,   662,   671,   680,   689,   698,   707,   716,
-     729,   738,   751,   760,   769,   778,   785,   792,   801,   808,
-     817,   825,   832,   839,   847,   856,   865,   879,   888,   897,
-     906,   915,   924,   933,   940,   947,   973,   981,   988,   995,
-    1002,  1009,  1017,  1025,  1033,  1040,  1051,  1062,  1069,  1078,
-    1087,  1096,  1103,  1110,  1118,  1126,  1136,  1146,  1156,  1164,
-    1177,  1188,  1196,  1209,  1218,  1227,  1236,  1246,  1256,  1264,
-    1277,  1286,  1294,  1303,  1311,  1324,  1333,  1340,  1350,  1360,
-    1370,  1380,  1390,  1400,  1410,  1420,  1427,  1434,  1441,  1450,
-    1459,  1468,  1477,  1484,  1494,  1514,  1521,  1539,  1552,  1565,
-    1574,  1583,  1592,  1601,  1611,  1621,  1632,  1641,  1650,  1659,
-    1668,  1681,  1694,  1703,  1710,  1719,  1728,  1737,  1746,  1754,
-    1767,  1775,  1806,  1813,  1828,  1838,  1848,  1855,  1862,  1869,
-    1878,  1886,  1900,  1921,  1942,  1954,  1966,  1978,  1987,  2008,
-    2018,  2027,  2035,  2043,  2056,  2069,  2084,  2099,  2108,  2117,
-    2123,  2132,  2141,  2151,  2161,  2174,  2187,  2199,  2213,  2225,
-    2239,  2249,  2256,  2263,  2272,  2281,  2291,  2301,  2311,  2318,
-    2325,  2334,  2343,  2353,  2363,  2370,  2377,  2384,  2392,  2402,
-    2412,  2422,  2432,  2464,  2474,  2482,  2490,  2505,  2514,  2519,
-    2520,  2521,  2521,  2521,  2522,  2522,  2522,  2523,  2523,  2525,
-    2535,  2544,  2551,  2558,  2565,  2572,  2579,  2586,  2591,  2592,
-    2593,  2593,  2594,  2594,  2595,  2595,  2596,  2597,  2598,  2599,
-    2600,  2601,  2603,  2612,  2619,  2628,  2637,  2644,  2651,  2661,
-    2671,  2681,  2691,  2701,  2711,  2716,  2717,  2718,  2720,  2726,
-    2736,  2743,  2752,  2760,  2765,  2766,  2768,  2768,  2768,  2769,
-    2769,  2770,  2771,  2772,  2773,  2774,  2776,  2786,  2795,  2802,
-    2811,  2818,  2827,  2835,  2848,  2856,  2869,  2874,  2875,  2876,
-    2876,  2877,  2877,  2877,  2879,  2894,  2909,  2921,  2936,  2949
+     268,   268,   269,   270,   270,   271,   271,   272,   272,   273,
+     273,   274,   274,   274,   275,   275,   275,   276,   276,   276,
+     277,   277,   278,   278,   279,   279,   280,   280,   281,   281,
+     282,   282,   283,   283,   284,   284,   285,   285,   286,   286,
+     287,   287,   288,   288,   289,   289,   290,   290,   291,   293,
+     305,   306,   307,   307,   307,   307,   307,   308,   308,   310,
+     322,   323,   324,   324,   324,   324,   325,   325,   327,   341,
+     342,   343,   343,   343,   343,   344,   344,   344,   346,   362,
+     363,   364,   364,   364,   364,   365,   365,   365,   366,   368,
+     377,   386,   397,   406,   415,   424,   435,   444,   455,   468,
+     483,   494,   511,   528,   545,   562,   577,   592,   605,   620,
+     629,   638,   647,   656,   665,   674,   683,   692,   701,   710,
+     719,   728,   737,   750,   759,   772,   781,   790,   799,   806,
+     813,   822,   829,   838,   846,   853,   860,   868,   877,   886,
+     900,   909,   918,   927,   936,   945,   954,   961,   968,   994,
+    1002,  1009,  1016,  1023,  1030,  1038,  1046,  1054,  1061,  1072,
+    1083,  1090,  1099,  1108,  1117,  1124,  1131,  1139,  1147,  1157,
+    1167,  1177,  1185,  1198,  1209,  1217,  1230,  1239,  1248,  1255,
+    1262,  1273,  1284,  1293,  1302,  1315,  1328,  1337,  1347,  1357,
+    1365,  1378,  1387,  1395,  1404,  1412,  1425,  1434,  1444,  1451,
+    1460,  1470,  1480,  1490,  1500,  1510,  1520,  1530,  1540,  1547,
+    1554,  1561,  1570,  1579,  1588,  1597,  1606,  1615,  1624,  1631,
+    1641,  1661,  1668,  1686,  1699,  1712,  1721,  1730,  1739,  1748,
+    1758,  1768,  1779,  1790,  1799,  1808,  1817,  1826,  1835,  1848,
+    1861,  1870,  1877,  1886,  1895,  1904,  1913,  1921,  1934,  1942,
+    1955,  1964,  1973,  1986,  1995,  2003,  2034,  2041,  2056,  2066,
+    2076,  2083,  2090,  2097,  2106,  2114,  2128,  2149,  2170,  2182,
+    2194,  2206,  2215,  2236,  2246,  2255,  2263,  2271,  2284,  2297,
+    2312,  2327,  2336,  2345,  2351,  2360,  2369,  2380,  2389,  2399,
+    2409,  2422,  2435,  2447,  2461,  2473,  2487,  2497,  2504,  2511,
+    2520,  2529,  2539,  2549,  2559,  2566,  2573,  2582,  2591,  2601,
+    2611,  2618,  2625,  2632,  2640,  2650,  2660,  2670,  2680,  2712,
+    2722,  2730,  2738,  2753,  2762,  2767,  2768,  2769,  2769,  2769,
+    2770,  2770,  2770,  2771,  2771,  2773,  2783,  2792,  2799,  2806,
+    2813,  2820,  2827,  2834,  2839,  2840,  2841,  2841,  2842,  2842,
+    2843,  2843,  2844,  2845,  2846,  2847,  2848,  2849,  2851,  2860,
+    2867,  2876,  2885,  2892,  2899,  2909,  2919,  2929,  2939,  2949,
+    2959,  2964,  2965,  2966,  2968,  2974,  2984,  2991,  3000,  3008,
+    3013,  3014,  3016,  3016,  3016,  3017,  3017,  3018,  3019,  3020,
+    3021,  3022,  3024,  3034,  3043,  3050,  3059,  3066,  3075,  3083,
+    3096,  3104,  3117,  3122,  3123,  3124,  3124,  3125,  3125,  3125,
+    3127,  3142,  3157,  3169,  3184,  3197
 };
 #endif
 
-#if YYDEBUG || YYERROR_VERBOSE || 0
+/** Accessing symbol of state STATE.  */
+#define YY_ACCESSING_SYMBOL(State) YY_CAST (yysymbol_kind_t, yystos[State])
+
+#if YYDEBUG || 0
+/* The user-facing name of the symbol whose (internal) number is
+   YYSYMBOL.  No bounds checking.  */
+static const char *yysymbol_name (yysymbol_kind_t yysymbol) YY_ATTRIBUTE_UNUSED;
+
 /* YYTNAME[SYMBOL-NUM] -- String name of the symbol SYMBOL-NUM.
    First, the terminals, then, starting at YYNTOKENS, nonterminals.  */
 static const char *const yytname[] =
 {
-  "$end", "error", "$undefined", "SPACE", "LETTER", "NEWLINE", "COMMENT",
-  "COLON", "ANY", "ZONESTR", "STRING_ARG", "VAR_SERVER", "VAR_VERBOSITY",
-  "VAR_NUM_THREADS", "VAR_PORT", "VAR_OUTGOING_RANGE", "VAR_INTERFACE",
-  "VAR_DO_IP4", "VAR_DO_IP6", "VAR_PREFER_IP6", "VAR_DO_UDP", "VAR_DO_TCP",
-  "VAR_TCP_MSS", "VAR_OUTGOING_TCP_MSS", "VAR_TCP_IDLE_TIMEOUT",
-  "VAR_EDNS_TCP_KEEPALIVE", "VAR_EDNS_TCP_KEEPALIVE_TIMEOUT", "VAR_CHROOT",
-  "VAR_USERNAME", "VAR_DIRECTORY", "VAR_LOGFILE", "VAR_PIDFILE",
-  "VAR_MSG_CACHE_SIZE", "VAR_MSG_CACHE_SLABS",
-  "VAR_NUM_QUERIES_PER_THREAD", "VAR_RRSET_CACHE_SIZE",
-  "VAR_RRSET_CACHE_SLABS", "VAR_OUTGOING_NUM_TCP", "VAR_INFRA_HOST_TTL",
-  "VAR_INFRA_LAME_TTL", "VAR_INFRA_CACHE_SLABS",
+  "\"end of file\"", "error", "\"invalid token\"", "SPACE", "LETTER",
+  "NEWLINE", "COMMENT", "COLON", "ANY", "ZONESTR", "STRING_ARG",
+  "VAR_SERVER", "VAR_VERBOSITY", "VAR_NUM_THREADS", "VAR_PORT",
+  "VAR_OUTGOING_RANGE", "VAR_INTERFACE", "VAR_DO_IP4", "VAR_DO_IP6",
+  "VAR_PREFER_IP6", "VAR_DO_UDP", "VAR_DO_TCP", "VAR_TCP_MSS",
+  "VAR_OUTGOING_TCP_MSS", "VAR_TCP_IDLE_TIMEOUT", "VAR_EDNS_TCP_KEEPALIVE",
+  "VAR_EDNS_TCP_KEEPALIVE_TIMEOUT", "VAR_CHROOT", "VAR_USERNAME",
+  "VAR_DIRECTORY", "VAR_LOGFILE", "VAR_PIDFILE", "VAR_MSG_CACHE_SIZE",
+  "VAR_MSG_CACHE_SLABS", "VAR_NUM_QUERIES_PER_THREAD",
+  "VAR_RRSET_CACHE_SIZE", "VAR_RRSET_CACHE_SLABS", "VAR_OUTGOING_NUM_TCP",
+  "VAR_INFRA_HOST_TTL", "VAR_INFRA_LAME_TTL", "VAR_INFRA_CACHE_SLABS",
   "VAR_INFRA_CACHE_NUMHOSTS", "VAR_INFRA_CACHE_LAME_SIZE", "VAR_NAME",
   "VAR_STUB_ZONE", "VAR_STUB_HOST", "VAR_STUB_ADDR",
   "VAR_TARGET_FETCH_POLICY", "VAR_HARDEN_SHORT_BUFSIZE",
@@ -1169,12 +1310,22 @@ static const char *const yytname[] =
   "VAR_STUB_NO_CACHE", "VAR_LOG_SERVFAIL", "VAR_DENY_ANY",
   "VAR_UNKNOWN_SERVER_TIME_LIMIT", "VAR_LOG_TAG_QUERYREPLY",
   "VAR_STREAM_WAIT_SIZE", "VAR_TLS_CIPHERS", "VAR_TLS_CIPHERSUITES",
-  "VAR_TLS_SESSION_TICKET_KEYS", "$accept", "toplevelvars", "toplevelvar",
-  "serverstart", "contents_server", "content_server", "stubstart",
-  "contents_stub", "content_stub", "forwardstart", "contents_forward",
-  "content_forward", "viewstart", "contents_view", "content_view",
-  "authstart", "contents_auth", "content_auth", "server_num_threads",
-  "server_verbosity", "server_statistics_interval",
+  "VAR_TLS_SESSION_TICKET_KEYS", "VAR_MESH_CLASS_WEIGHT",
+  "VAR_MESH_CLASS_LIMIT", "VAR_TRACE_SAMPLE_RATE",
+  "VAR_TRACE_SLOW_THRESHOLD", "VAR_WORK_STEALING", "VAR_MESH_FAIR_SHARE",
+  "VAR_MESH_FAIR_SHARE_PREFIX4", "VAR_MESH_FAIR_SHARE_PREFIX6",
+  "VAR_SIG_CACHE_SIZE", "VAR_SIG_CACHE_SLABS", "VAR_VAL_CRYPTO_THREADS",
+  "VAR_NSEC3_HASH_CACHE_SIZE", "VAR_NSEC3_HASH_CACHE_SLABS",
+  "VAR_NSEC3_HASH_RATELIMIT", "VAR_HEDGE_PERCENTILE", "VAR_HEDGE_BUDGET",
+  "VAR_TARGET_FETCH_PARALLEL", "VAR_REFRESH_POPULAR",
+  "VAR_REFRESH_POPULAR_RATE", "VAR_REFRESH_POPULAR_SIZE",
+  "VAR_SERVE_EXPIRED_CLIENT_TIMEOUT", "VAR_SYNTH_INSECURE_DNAME",
+  "VAR_INFRA_CACHE_RTT_PERCENTILE", "$accept", "toplevelvars",
+  "toplevelvar", "serverstart", "contents_server", "content_server",
+  "stubstart", "contents_stub", "content_stub", "forwardstart",
+  "contents_forward", "content_forward", "viewstart", "contents_view",
+  "content_view", "authstart", "contents_auth", "content_auth",
+  "server_num_threads", "server_verbosity", "server_statistics_interval",
   "server_statistics_cumulative", "server_extended_statistics",
   "server_shm_enable", "server_shm_key", "server_port",
   "server_send_client_subnet", "server_client_subnet_zone",
@@ -1211,36 +1362,48 @@ static const char *const yytname[] =
   "server_edns_buffer_size", "server_msg_buffer_size",
   "server_msg_cache_size", "server_msg_cache_slabs",
   "server_num_queries_per_thread", "server_jostle_timeout",
+  "server_mesh_class_weight", "server_mesh_class_limit",
+  "server_trace_sample_rate", "server_trace_slow_threshold",
+  "server_work_stealing", "server_mesh_fair_share",
+  "server_mesh_fair_share_prefix4", "server_mesh_fair_share_prefix6",
   "server_delay_close", "server_unblock_lan_zones",
   "server_insecure_lan_zones", "server_rrset_cache_size",
   "server_rrset_cache_slabs", "server_infra_host_ttl",
   "server_infra_lame_ttl", "server_infra_cache_numhosts",
   "server_infra_cache_lame_size", "server_infra_cache_slabs",
-  "server_infra_cache_min_rtt", "server_target_fetch_policy",
+  "server_infra_cache_min_rtt", "server_infra_cache_rtt_percentile",
+  "server_target_fetch_policy", "server_target_fetch_parallel",
   "server_harden_short_bufsize", "server_harden_large_queries",
   "server_harden_glue", "server_harden_dnssec_stripped",
   "server_harden_below_nxdomain", "server_harden_referral_path",
   "server_harden_algo_downgrade", "server_use_caps_for_id",
   "server_caps_whitelist", "server_private_address",
   "server_private_domain", "server_prefetch", "server_prefetch_key",
-  "server_deny_any", "server_unwanted_reply_threshold",
-  "server_do_not_query_address", "server_do_not_query_localhost",
-  "server_access_control", "server_module_conf",
-  "server_val_override_date", "server_val_sig_skew_min",
-  "server_val_sig_skew_max", "server_cache_max_ttl",
-  "server_cache_max_negative_ttl", "server_cache_min_ttl",
-  "server_bogus_ttl", "server_val_clean_additional",
-  "server_val_permissive_mode", "server_aggressive_nsec",
+  "server_refresh_popular", "server_refresh_popular_rate",
+  "server_refresh_popular_size", "server_deny_any",
+  "server_unwanted_reply_threshold", "server_do_not_query_address",
+  "server_do_not_query_localhost", "server_access_control",
+  "server_module_conf", "server_val_override_date",
+  "server_val_sig_skew_min", "server_val_sig_skew_max",
+  "server_cache_max_ttl", "server_cache_max_negative_ttl",
+  "server_cache_min_ttl", "server_bogus_ttl",
+  "server_val_clean_additional", "server_val_permissive_mode",
+  "server_aggressive_nsec", "server_synth_insecure_dname",
   "server_ignore_cd_flag", "server_serve_expired",
   "server_serve_expired_ttl", "server_serve_expired_ttl_reset",
-  "server_fake_dsa", "server_fake_sha1", "server_val_log_level",
+  "server_serve_expired_client_timeout", "server_fake_dsa",
+  "server_fake_sha1", "server_val_log_level",
   "server_val_nsec3_keysize_iterations", "server_add_holddown",
   "server_del_holddown", "server_keep_missing",
   "server_permit_small_holddown", "server_key_cache_size",
-  "server_key_cache_slabs", "server_neg_cache_size", "server_local_zone",
-  "server_local_data", "server_local_data_ptr", "server_minimal_responses",
-  "server_rrset_roundrobin", "server_unknown_server_time_limit",
-  "server_max_udp_size", "server_dns64_prefix", "server_dns64_synthall",
+  "server_key_cache_slabs", "server_sig_cache_size",
+  "server_sig_cache_slabs", "server_val_crypto_threads",
+  "server_nsec3_hash_cache_size", "server_nsec3_hash_cache_slabs",
+  "server_nsec3_hash_ratelimit", "server_neg_cache_size",
+  "server_local_zone", "server_local_data", "server_local_data_ptr",
+  "server_minimal_responses", "server_rrset_roundrobin",
+  "server_unknown_server_time_limit", "server_max_udp_size",
+  "server_dns64_prefix", "server_dns64_synthall",
   "server_dns64_ignore_aaaa", "server_define_tag", "server_local_zone_tag",
   "server_access_control_tag", "server_access_control_tag_action",
   "server_access_control_tag_data", "server_local_zone_override",
@@ -1250,7 +1413,8 @@ static const char *const yytname[] =
   "server_ratelimit_slabs", "server_ratelimit_for_domain",
   "server_ratelimit_below_domain", "server_ip_ratelimit_factor",
   "server_ratelimit_factor", "server_low_rtt", "server_fast_server_num",
-  "server_fast_server_permil", "server_qname_minimisation",
+  "server_fast_server_permil", "server_hedge_percentile",
+  "server_hedge_budget", "server_qname_minimisation",
   "server_qname_minimisation_strict", "server_ipsecmod_enabled",
   "server_ipsecmod_ignore_bogus", "server_ipsecmod_hook",
   "server_ipsecmod_max_ttl", "server_ipsecmod_whitelist",
@@ -1287,150 +1451,128 @@ static const char *const yytname[] =
   "cachedb_backend_name", "cachedb_secret_seed", "redis_server_host",
   "redis_server_port", "redis_timeout", "server_tcp_connection_limit", YY_NULLPTR
 };
-#endif
 
-# ifdef YYPRINT
-/* YYTOKNUM[NUM] -- (External) token number corresponding to the
-   (internal) symbol number NUM (which must be that of a token).  */
-static const yytype_uint16 yytoknum[] =
+static const char *
+yysymbol_name (yysymbol_kind_t yysymbol)
 {
-       0,   256,   257,   258,   259,   260,   261,   262,   263,   264,
-     265,   266,   267,   268,   269,   270,   271,   272,   273,   274,
-     275,   276,   277,   278,   279,   280,   281,   282,   283,   284,
-     285,   286,   287,   288,   289,   290,   291,   292,   293,   294,
-     295,   296,   297,   298,   299,   300,   301,   302,   303,   304,
-     305,   306,   307,   308,   309,   310,   311,   312,   313,   314,
-     315,   316,   317,   318,   319,   320,   321,   322,   323,   324,
-     325,   326,   327,   328,   329,   330,   331,   332,   333,   334,
-     335,   336,   337,   338,   339,   340,   341,   342,   343,   344,
-     345,   346,   347,   348,   349,   350,   351,   352,   353,   354,
-     355,   356,   357,   358,   359,   360,   361,   362,   363,   364,
-     365,   366,   367,   368,   369,   370,   371,   372,   373,   374,
-     375,   376,   377,   378,   379,   380,   381,   382,   383,   384,
-     385,   386,   387,   388,   389,   390,   391,   392,   393,   394,
-     395,   396,   397,   398,   399,   400,   401,   402,   403,   404,
-     405,   406,   407,   408,   409,   410,   411,   412,   413,   414,
-     415,   416,   417,   418,   419,   420,   421,   422,   423,   424,
-     425,   426,   427,   428,   429,   430,   431,   432,   433,   434,
-     435,   436,   437,   438,   439,   440,   441,   442,   443,   444,
-     445,   446,   447,   448,   449,   450,   451,   452,   453,   454,
-     455,   456,   457,   458,   459,   460,   461,   462,   463,   464,
-     465,   466,   467,   468,   469,   470,   471,   472,   473,   474,
-     475,   476,   477,   478,   479,   480,   481,   482,   483,   484,
-     485,   486,   487,   488,   489,   490,   491,   492,   493,   494,
-     495,   496,   497,   498,   499,   500,   501,   502,   503,   504,
-     505,   506,   507,   508,   509,   510,   511,   512,   513,   514,
-     515,   516,   517,   518,   519,   520,   521
-};
-# endif
+  return yytname[yysymbol];
+}
+#endif
 
-#define YYPACT_NINF -154
+#define YYPACT_NINF (-152)
 
-#define yypact_value_is_default(Yystate) \
-  (!!((Yystate) == (-154)))
+#define yypact_value_is_default(Yyn) \
+  ((Yyn) == YYPACT_NINF)
 
-#define YYTABLE_NINF -1
+#define YYTABLE_NINF (-1)
 
-#define yytable_value_is_error(Yytable_value) \
+#define yytable_value_is_error(Yyn) \
   0
 
-  /* YYPACT[STATE-NUM] -- Index in YYTABLE of the portion describing
-     STATE-NUM.  */
+/* YYPACT[STATE-NUM] -- Index in YYTABLE of the portion describing
+   STATE-NUM.  */
 static const yytype_int16 yypact[] =
 {
-    -154,   212,  -154,  -154,  -154,  -154,  -154,  -154,  -154,  -154,
-    -154,  -154,  -154,  -154,  -154,  -154,  -154,  -154,  -154,  -154,
-    -154,  -154,  -154,  -154,   -12,   102,    98,   166,    39,   213,
-     142,   -80,    52,  -153,    22,    23,    24,    28,    29,    30,
-      78,    79,    80,    84,    88,    89,   114,   115,   116,   118,
-     129,   130,   132,   133,   134,   136,   141,   180,   182,   196,
-     197,   200,   201,   203,   204,   205,   206,   214,   215,   216,
-     217,   218,   220,   221,   222,   223,   225,   245,   247,   248,
-     249,   250,   251,   253,   254,   255,   256,   257,   258,   259,
-     272,   278,   279,   280,   281,   282,   297,   306,   307,   308,
-     309,   310,   311,   313,   314,   315,   316,   317,   318,   319,
-     320,   323,   324,   325,   326,   327,   328,   329,   330,   331,
-     332,   333,   334,   335,   336,   337,   338,   339,   340,   341,
-     342,   343,   344,   346,   347,   348,   349,   351,   352,   354,
-     355,   356,   357,   358,   359,   361,   362,   363,   364,   365,
-     366,   367,   368,   369,   370,   371,   372,   373,   374,   375,
+    -152,   234,  -152,  -152,  -152,  -152,  -152,  -152,  -152,  -152,
+    -152,  -152,  -152,  -152,  -152,  -152,  -152,  -152,  -152,  -152,
+    -152,  -152,  -152,  -152,   -12,   102,   163,   236,    41,   235,
+     150,   -80,    98,  -151,    22,    23,    24,    28,    29,    30,
+      72,    73,    80,    84,    88,    89,   114,   115,   116,   118,
+     129,   130,   131,   132,   133,   134,   136,   139,   140,   141,
+     180,   182,   197,   199,   200,   201,   202,   203,   206,   213,
+     214,   215,   216,   217,   218,   220,   221,   222,   223,   225,
+     226,   270,   271,   272,   280,   281,   282,   283,   284,   286,
+     287,   288,   290,   304,   317,   319,   328,   329,   331,   332,
+     333,   335,   336,   337,   338,   339,   340,   341,   342,   343,
+     344,   345,   346,   347,   348,   349,   351,   352,   353,   354,
+     355,   356,   357,   358,   359,   360,   361,   362,   363,   364,
+     365,   366,   367,   368,   369,   370,   371,   372,   373,   374,
      376,   377,   378,   379,   380,   381,   382,   383,   384,   385,
-     386,   387,   388,   389,   390,   391,   392,   393,   394,   395,
-     396,   397,   398,   399,   400,   401,   402,   403,   405,   406,
-     407,   408,   409,   410,   411,   412,   413,   414,   415,   416,
-     417,   418,   419,   421,   422,   423,   424,   425,   426,   427,
-     428,   429,   430,   431,   432,   433,   434,   435,   436,   438,
-     439,   440,   441,  -154,  -154,  -154,  -154,  -154,  -154,  -154,
-    -154,  -154,  -154,  -154,  -154,  -154,  -154,  -154,  -154,  -154,
-    -154,  -154,  -154,  -154,  -154,  -154,  -154,  -154,  -154,  -154,
-    -154,  -154,  -154,  -154,  -154,  -154,  -154,  -154,  -154,  -154,
-    -154,  -154,  -154,  -154,  -154,  -154,  -154,  -154,  -154,  -154,
-    -154,  -154,  -154,  -154,  -154,  -154,  -154,  -154,  -154,  -154,
-    -154,  -154,  -154,  -154,  -154,  -154,  -154,  -154,  -154,  -154,
-    -154,  -154,  -154,  -154,  -154,  -154,  -154,  -154,  -154,  -154,
-    -154,  -154,  -154,  -154,  -154,  -154,  -154,  -154,  -154,  -154,
-    -154,  -154,  -154,  -154,  -154,  -154,  -154,  -154,  -154,  -154,
-    -154,  -154,  -154,  -154,  -154,  -154,  -154,  -154,  -154,  -154,
-    -154,  -154,  -154,  -154,  -154,  -154,  -154,  -154,  -154,  -154,
-    -154,  -154,  -154,  -154,  -154,  -154,  -154,  -154,  -154,  -154,
-    -154,  -154,  -154,  -154,  -154,  -154,  -154,  -154,  -154,  -154,
-    -154,  -154,  -154,  -154,  -154,  -154,  -154,  -154,  -154,  -154,
-    -154,  -154,  -154,  -154,  -154,  -154,  -154,  -154,  -154,  -154,
-    -154,  -154,  -154,  -154,  -154,  -154,  -154,  -154,  -154,  -154,
-    -154,  -154,  -154,  -154,  -154,  -154,  -154,  -154,  -154,  -154,
-    -154,  -154,  -154,  -154,  -154,  -154,  -154,  -154,  -154,  -154,
-    -154,  -154,  -154,   442,   443,   444,   446,   447,   448,   449,
-    -154,  -154,  -154,  -154,  -154,  -154,  -154,  -154,   450,   451,
-     452,   453,   454,   455,  -154,  -154,  -154,  -154,  -154,  -154,
-    -154,   456,   457,   458,   459,   460,   461,   462,  -154,  -154,
-    -154,  -154,  -154,  -154,  -154,  -154,   463,   464,   465,   466,
-     467,   468,   469,   470,  -154,  -154,  -154,  -154,  -154,  -154,
-    -154,  -154,  -154,   471,   472,   473,   474,   475,   476,   477,
-     478,  -154,  -154,  -154,  -154,  -154,  -154,  -154,  -154,  -154,
-     479,   480,   481,   482,   483,   484,   485,   486,   487,   488,
-     489,   490,  -154,  -154,  -154,  -154,  -154,  -154,  -154,  -154,
-    -154,  -154,  -154,  -154,  -154,   491,  -154,  -154,   492,   493,
-     494,   495,   496,   497,   498,   499,   500,   501,  -154,  -154,
-    -154,  -154,  -154,  -154,  -154,  -154,  -154,  -154,  -154,   502,
-     503,   504,   505,   506,  -154,  -154,  -154,  -154,  -154,  -154,
-    -154,  -154,  -154,  -154,  -154,  -154,  -154,  -154,  -154,  -154,
-    -154,  -154,  -154,  -154,  -154,  -154,  -154,  -154,  -154,  -154,
-    -154,  -154,  -154,  -154,  -154,  -154,  -154,  -154,  -154,  -154,
-    -154,  -154,  -154,  -154,  -154,  -154,  -154,  -154,  -154,  -154,
-    -154,  -154,  -154,  -154,  -154,  -154,  -154,  -154,  -154,  -154,
-    -154,  -154,  -154,  -154,  -154,  -154,  -154,  -154,  -154,   507,
-     508,  -154,  -154,  -154,  -154,  -154,  -154,  -154,  -154,  -154,
-    -154,  -154,  -154,  -154,  -154,  -154,  -154,  -154,  -154,  -154,
-    -154,  -154,  -154,  -154,  -154,  -154,  -154,  -154,  -154,  -154,
-    -154,  -154,  -154,  -154,  -154,  -154,  -154,  -154,  -154,  -154,
-    -154,  -154,  -154,  -154,  -154,  -154,  -154,  -154,  -154,  -154,
-    -154,  -154,  -154,  -154,  -154,  -154,   509,   510,   511,  -154,
-    -154,  -154,  -154,  -154,  -154,  -154,  -154,  -154,   512,   513,
-    -154,  -154,  -154,  -154,  -154,  -154,  -154,  -154,  -154,  -154,
-    -154,  -154,  -154,  -154,  -154,  -154,  -154,  -154,  -154,   514,
-     515,   516,   517,   518,   519,  -154,  -154,  -154,  -154,  -154,
-    -154,  -154,  -154,  -154,  -154,  -154,  -154,  -154,  -154,  -154,
-    -154,  -154,  -154,  -154,  -154,  -154,  -154,  -154,  -154,  -154,
-     520,  -154,  -154,  -154,  -154,  -154,  -154,  -154,  -154,  -154,
-    -154,  -154,  -154,  -154,  -154,  -154,  -154,  -154,  -154,  -154,
-    -154,  -154,  -154,   521,  -154,  -154,   522,   523,  -154,  -154,
-    -154,  -154,  -154,  -154,  -154,  -154,  -154,  -154,  -154,  -154,
-    -154,  -154,  -154,  -154,  -154,  -154,  -154,  -154,  -154,  -154,
-    -154,  -154,  -154,  -154,  -154,  -154,  -154,  -154,  -154,  -154,
-    -154,  -154,  -154,  -154,  -154,  -154,  -154,  -154,  -154,  -154,
-    -154,  -154,  -154,  -154,  -154,  -154,  -154,  -154,  -154,  -154,
-    -154,  -154,   524,   525,   526,  -154,  -154,  -154,  -154,  -154,
-    -154,  -154,  -154
+     386,   387,   388,   389,   390,   393,   394,   395,   396,   397,
+     398,   399,   400,   401,   402,   403,   404,   405,   406,   407,
+     408,   409,   411,   412,   413,   414,   415,   416,   417,   418,
+     419,   420,   421,   422,   423,   424,   425,   427,   428,   429,
+     431,   432,   433,   434,   435,   436,   437,   438,   439,   440,
+     441,   443,   444,   445,   446,   447,   448,   449,   450,   451,
+     452,   453,   454,   455,   456,   457,   458,   460,   461,   462,
+     463,   464,   465,   466,   468,   469,   470,   471,   472,   473,
+     474,   475,   476,   477,   478,   479,   480,   481,   482,   483,
+     484,   485,   486,   487,   488,   489,  -152,  -152,  -152,  -152,
+    -152,  -152,  -152,  -152,  -152,  -152,  -152,  -152,  -152,  -152,
+    -152,  -152,  -152,  -152,  -152,  -152,  -152,  -152,  -152,  -152,
+    -152,  -152,  -152,  -152,  -152,  -152,  -152,  -152,  -152,  -152,
+    -152,  -152,  -152,  -152,  -152,  -152,  -152,  -152,  -152,  -152,
+    -152,  -152,  -152,  -152,  -152,  -152,  -152,  -152,  -152,  -152,
+    -152,  -152,  -152,  -152,  -152,  -152,  -152,  -152,  -152,  -152,
+    -152,  -152,  -152,  -152,  -152,  -152,  -152,  -152,  -152,  -152,
+    -152,  -152,  -152,  -152,  -152,  -152,  -152,  -152,  -152,  -152,
+    -152,  -152,  -152,  -152,  -152,  -152,  -152,  -152,  -152,  -152,
+    -152,  -152,  -152,  -152,  -152,  -152,  -152,  -152,  -152,  -152,
+    -152,  -152,  -152,  -152,  -152,  -152,  -152,  -152,  -152,  -152,
+    -152,  -152,  -152,  -152,  -152,  -152,  -152,  -152,  -152,  -152,
+    -152,  -152,  -152,  -152,  -152,  -152,  -152,  -152,  -152,  -152,
+    -152,  -152,  -152,  -152,  -152,  -152,  -152,  -152,  -152,  -152,
+    -152,  -152,  -152,  -152,  -152,  -152,  -152,  -152,  -152,  -152,
+    -152,  -152,  -152,  -152,  -152,  -152,  -152,  -152,  -152,  -152,
+    -152,  -152,  -152,  -152,  -152,  -152,  -152,  -152,  -152,  -152,
+    -152,  -152,  -152,  -152,  -152,  -152,  -152,  -152,  -152,  -152,
+    -152,  -152,  -152,  -152,  -152,  -152,  -152,  -152,  -152,  -152,
+    -152,  -152,  -152,  -152,  -152,  -152,  -152,  -152,  -152,  -152,
+    -152,  -152,  -152,  -152,  -152,  -152,  -152,  -152,  -152,   490,
+     491,   492,   493,   494,   495,   496,  -152,  -152,  -152,  -152,
+    -152,  -152,  -152,  -152,   497,   498,   499,   500,   501,   502,
+    -152,  -152,  -152,  -152,  -152,  -152,  -152,   503,   504,   505,
+     506,   507,   508,   509,  -152,  -152,  -152,  -152,  -152,  -152,
+    -152,  -152,   510,   511,   512,   513,   514,   515,   516,   517,
+    -152,  -152,  -152,  -152,  -152,  -152,  -152,  -152,  -152,   518,
+     519,   520,   521,   522,   523,   524,   525,  -152,  -152,  -152,
+    -152,  -152,  -152,  -152,  -152,  -152,   526,   527,   528,   529,
+     530,   531,   532,   533,   534,   535,   536,   537,  -152,  -152,
+    -152,  -152,  -152,  -152,  -152,  -152,  -152,  -152,  -152,  -152,
+    -152,   538,  -152,  -152,   539,   540,   541,   542,   543,   544,
+     545,   546,   547,   548,  -152,  -152,  -152,  -152,  -152,  -152,
+    -152,  -152,  -152,  -152,  -152,   549,   550,   551,   552,   553,
+    -152,  -152,  -152,  -152,  -152,  -152,  -152,  -152,  -152,  -152,
+    -152,  -152,  -152,  -152,  -152,  -152,  -152,  -152,  -152,  -152,
+    -152,  -152,  -152,  -152,  -152,  -152,  -152,  -152,  -152,  -152,
+    -152,  -152,  -152,  -152,  -152,  -152,  -152,  -152,  -152,  -152,
+    -152,  -152,  -152,  -152,  -152,  -152,  -152,  -152,  -152,  -152,
+    -152,  -152,  -152,  -152,  -152,  -152,  -152,  -152,  -152,  -152,
+    -152,  -152,  -152,  -152,  -152,   554,   555,  -152,  -152,  -152,
+    -152,  -152,  -152,  -152,  -152,  -152,  -152,  -152,  -152,  -152,
+    -152,  -152,  -152,  -152,  -152,  -152,  -152,  -152,  -152,  -152,
+    -152,  -152,  -152,  -152,  -152,  -152,  -152,  -152,  -152,  -152,
+    -152,  -152,  -152,  -152,  -152,  -152,  -152,  -152,  -152,  -152,
+    -152,  -152,  -152,  -152,  -152,  -152,  -152,  -152,  -152,  -152,
+    -152,  -152,   556,   557,   558,  -152,  -152,  -152,  -152,  -152,
+    -152,  -152,  -152,  -152,   559,   560,  -152,  -152,  -152,  -152,
+    -152,  -152,  -152,  -152,  -152,  -152,  -152,  -152,  -152,  -152,
+    -152,  -152,  -152,  -152,  -152,   561,   562,   563,   564,   565,
+     566,  -152,  -152,  -152,  -152,  -152,  -152,  -152,  -152,  -152,
+    -152,  -152,  -152,  -152,  -152,  -152,  -152,  -152,  -152,  -152,
+    -152,  -152,  -152,  -152,  -152,  -152,   567,  -152,  -152,  -152,
+    -152,  -152,  -152,  -152,  -152,  -152,  -152,  -152,  -152,  -152,
+    -152,  -152,  -152,  -152,  -152,  -152,  -152,  -152,  -152,  -152,
+    -152,  -152,  -152,  -152,  -152,  -152,  -152,  -152,  -152,  -152,
+    -152,  -152,  -152,  -152,  -152,  -152,  -152,  -152,  -152,  -152,
+    -152,  -152,   568,  -152,  -152,   569,   570,  -152,  -152,  -152,
+    -152,  -152,  -152,  -152,  -152,  -152,  -152,  -152,  -152,  -152,
+    -152,  -152,  -152,  -152,  -152,  -152,  -152,  -152,  -152,  -152,
+    -152,  -152,  -152,  -152,  -152,  -152,  -152,  -152,  -152,  -152,
+    -152,  -152,  -152,  -152,  -152,  -152,  -152,  -152,  -152,  -152,
+    -152,  -152,  -152,  -152,  -152,  -152,  -152,  -152,  -152,  -152,
+    -152,   571,   572,   573,  -152,  -152,  -152,  -152,  -152,  -152,
+    -152,  -152
 };
 
-  /* YYDEFACT[STATE-NUM] -- Default reduction number in state STATE-NUM.
-     Performed when YYTABLE does not specify something else to do.  Zero
-     means the default is an error.  */
-static const yytype_uint16 yydefact[] =
+/* YYDEFACT[STATE-NUM] -- Default reduction number in state STATE-NUM.
+   Performed when YYTABLE does not specify something else to do.  Zero
+   means the default is an error.  */
+static const yytype_int16 yydefact[] =
 {
-       2,     0,     1,    14,   206,   216,   458,   504,   477,   225,
-     513,   536,   235,     3,    16,   208,   218,   227,   237,   460,
-     479,   506,   515,   538,     4,     5,     6,    10,    13,     8,
+       2,     0,     1,    14,   229,   239,   504,   550,   523,   248,
+     559,   582,   258,     3,    16,   231,   241,   250,   260,   506,
+     525,   552,   561,   584,     4,     5,     6,    10,    13,     8,
        9,     7,    11,    12,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
@@ -1450,199 +1592,215 @@ static const yytype_uint16 yydefact[] =
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,    15,    17,    18,    80,    83,    92,   177,
-     178,    19,   144,   145,   146,   147,   148,   149,   150,   151,
-     152,   153,    31,    71,    20,    84,    85,    42,    64,    79,
-      21,    22,    24,    25,    23,    26,    27,    28,    29,    30,
-     115,   189,   116,   118,   119,   120,   191,   196,   192,   203,
-     204,   205,   173,    81,    70,    96,   113,   114,   201,   198,
-     117,    32,    33,    34,    35,    36,    72,    86,    87,   102,
-      58,    68,    59,   181,   182,    97,    52,    53,   180,    54,
-      55,   106,   110,   124,   133,   158,   202,   107,    65,    37,
-      38,    39,    94,   125,   126,   127,    40,    41,    43,    44,
-      46,    47,    45,   131,    48,    49,    50,    56,    75,   111,
-      89,   132,    82,   154,    90,    91,   108,   109,   199,    95,
-      51,    73,    76,    57,    60,    98,    99,    74,   155,   100,
-      61,    62,    63,   190,   112,   168,   169,   170,   171,   179,
-     101,    69,   103,   104,   105,   156,    66,    67,    88,    77,
-      78,    93,   121,   122,   200,   123,   128,   129,   130,   159,
-     160,   162,   164,   165,   163,   166,   174,   134,   135,   138,
-     139,   136,   137,   140,   141,   143,   142,   193,   195,   194,
-     157,   167,   183,   185,   184,   186,   187,   188,   161,   172,
-     175,   176,   197,     0,     0,     0,     0,     0,     0,     0,
-     207,   209,   210,   211,   213,   214,   215,   212,     0,     0,
-       0,     0,     0,     0,   217,   219,   220,   221,   222,   223,
-     224,     0,     0,     0,     0,     0,     0,     0,   226,   228,
-     229,   232,   233,   230,   234,   231,     0,     0,     0,     0,
-       0,     0,     0,     0,   236,   238,   239,   240,   241,   245,
-     242,   243,   244,     0,     0,     0,     0,     0,     0,     0,
-       0,   459,   461,   463,   462,   468,   464,   465,   466,   467,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,   478,   480,   481,   482,   483,   484,   485,   486,
-     487,   488,   489,   490,   491,     0,   505,   507,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,   514,   516,
-     517,   518,   520,   521,   519,   522,   523,   524,   525,     0,
-       0,     0,     0,     0,   537,   539,   540,   541,   542,   543,
-     247,   246,   253,   266,   264,   272,   273,   276,   274,   275,
-     277,   278,   279,   280,   281,   303,   304,   305,   306,   307,
-     331,   332,   333,   338,   339,   269,   340,   341,   344,   342,
-     343,   346,   347,   348,   362,   318,   319,   321,   322,   349,
-     365,   312,   314,   366,   372,   373,   374,   270,   330,   388,
-     389,   313,   383,   296,   265,   308,   363,   369,   350,     0,
-       0,   392,   271,   248,   295,   354,   249,   267,   268,   309,
-     310,   390,   352,   356,   357,   250,   393,   334,   361,   297,
-     317,   367,   368,   371,   382,   311,   386,   384,   385,   323,
-     329,   358,   359,   324,   325,   351,   376,   298,   299,   302,
-     282,   284,   285,   286,   287,   288,   394,   395,   397,   335,
-     336,   337,   345,   398,   399,   400,     0,     0,     0,   353,
-     326,   509,   409,   413,   411,   410,   414,   412,     0,     0,
-     417,   418,   254,   255,   256,   257,   258,   259,   260,   261,
-     262,   263,   355,   370,   387,   422,   423,   327,   401,     0,
-       0,     0,     0,     0,     0,   377,   378,   379,   380,   381,
-     510,   320,   315,   375,   294,   251,   252,   316,   424,   426,
-     425,   427,   428,   429,   283,   290,   419,   421,   420,   289,
-       0,   301,   360,   396,   300,   328,   291,   292,   293,   430,
-     431,   432,   436,   435,   433,   434,   437,   438,   439,   440,
-     442,   441,   451,     0,   455,   456,     0,     0,   457,   443,
-     449,   444,   445,   446,   448,   450,   447,   469,   471,   470,
-     473,   474,   475,   476,   472,   492,   493,   494,   495,   496,
-     497,   498,   499,   500,   501,   502,   503,   508,   526,   527,
-     528,   531,   529,   530,   532,   533,   534,   535,   544,   545,
-     546,   547,   548,   364,   391,   408,   511,   512,   415,   416,
-     402,   403,     0,     0,     0,   407,   549,   452,   453,   454,
-     406,   404,   405
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,    15,    17,    18,    80,
+      83,    92,   177,   178,    19,   144,   145,   146,   147,   148,
+     149,   150,   151,   152,   153,    31,    71,    20,    84,    85,
+      42,    64,    79,    21,    22,    24,    25,    23,    26,    27,
+      28,    29,    30,   115,   189,   116,   118,   119,   120,   191,
+     196,   192,   203,   204,   205,   173,    81,    70,    96,   113,
+     114,   201,   198,   117,    32,    33,    34,    35,    36,    72,
+      86,    87,   102,    58,    68,    59,   181,   182,    97,    52,
+      53,   180,    54,    55,   106,   110,   124,   133,   158,   202,
+     107,    65,    37,    38,    39,    94,   206,   207,   208,   209,
+     210,   211,   212,   213,   125,   126,   127,    40,    41,    43,
+      44,    46,    47,    45,   131,   228,    48,   222,    49,    50,
+      56,    75,   111,    89,   132,    82,   154,    90,    91,   108,
+     109,   223,   224,   225,   199,    95,    51,    73,    76,    57,
+      60,    98,    99,    74,   155,   100,    61,    62,    63,   190,
+     227,   112,   168,   169,   170,   226,   171,   179,   101,    69,
+     103,   104,   105,   156,    66,    67,   214,   215,   216,   217,
+     218,   219,    88,    77,    78,    93,   121,   122,   200,   123,
+     128,   129,   130,   159,   160,   162,   164,   165,   163,   166,
+     174,   134,   135,   138,   139,   136,   137,   140,   141,   143,
+     142,   193,   195,   194,   220,   221,   157,   167,   183,   185,
+     184,   186,   187,   188,   161,   172,   175,   176,   197,     0,
+       0,     0,     0,     0,     0,     0,   230,   232,   233,   234,
+     236,   237,   238,   235,     0,     0,     0,     0,     0,     0,
+     240,   242,   243,   244,   245,   246,   247,     0,     0,     0,
+       0,     0,     0,     0,   249,   251,   252,   255,   256,   253,
+     257,   254,     0,     0,     0,     0,     0,     0,     0,     0,
+     259,   261,   262,   263,   264,   268,   265,   266,   267,     0,
+       0,     0,     0,     0,     0,     0,     0,   505,   507,   509,
+     508,   514,   510,   511,   512,   513,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,   524,   526,
+     527,   528,   529,   530,   531,   532,   533,   534,   535,   536,
+     537,     0,   551,   553,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,   560,   562,   563,   564,   566,   567,
+     565,   568,   569,   570,   571,     0,     0,     0,     0,     0,
+     583,   585,   586,   587,   588,   589,   270,   269,   276,   289,
+     287,   295,   296,   299,   297,   298,   300,   301,   302,   303,
+     304,   326,   327,   328,   329,   330,   354,   355,   356,   369,
+     370,   292,   371,   372,   375,   373,   374,   378,   380,   381,
+     398,   341,   342,   344,   345,   382,   401,   335,   337,   402,
+     408,   409,   410,   293,   353,   426,   427,   336,   421,   319,
+     288,   331,   399,   405,   383,     0,     0,   436,   294,   271,
+     318,   387,   272,   290,   291,   332,   333,   434,   385,   389,
+     390,   273,   437,   357,   397,   320,   340,   403,   404,   407,
+     420,   334,   424,   422,   423,   346,   352,   391,   392,   347,
+     348,   384,   413,   321,   322,   325,   305,   307,   308,   309,
+     310,   311,   438,   439,   441,   366,   367,   368,   376,   442,
+     443,   444,     0,     0,     0,   386,   349,   555,   453,   457,
+     455,   454,   458,   456,     0,     0,   461,   462,   277,   278,
+     279,   280,   281,   282,   283,   284,   285,   286,   388,   406,
+     425,   468,   469,   350,   445,     0,     0,     0,     0,     0,
+       0,   414,   415,   416,   418,   419,   556,   343,   338,   411,
+     317,   274,   275,   339,   470,   472,   471,   473,   474,   475,
+     306,   313,   463,   465,   464,   312,     0,   324,   396,   440,
+     323,   351,   314,   315,   316,   358,   359,   360,   361,   362,
+     363,   364,   365,   428,   429,   430,   431,   432,   433,   466,
+     467,   379,   393,   394,   395,   417,   412,   377,   476,   477,
+     478,   482,   481,   479,   480,   483,   484,   485,   486,   488,
+     487,   497,     0,   501,   502,     0,     0,   503,   489,   495,
+     490,   491,   492,   494,   496,   493,   515,   517,   516,   519,
+     520,   521,   522,   518,   538,   539,   540,   541,   542,   543,
+     544,   545,   546,   547,   548,   549,   554,   572,   573,   574,
+     577,   575,   576,   578,   579,   580,   581,   590,   591,   592,
+     593,   594,   400,   435,   452,   557,   558,   459,   460,   446,
+     447,     0,     0,     0,   451,   595,   498,   499,   500,   450,
+     448,   449
 };
 
-  /* YYPGOTO[NTERM-NUM].  */
+/* YYPGOTO[NTERM-NUM].  */
 static const yytype_int16 yypgoto[] =
 {
-    -154,  -154,  -154,  -154,  -154,  -154,  -154,  -154,  -154,  -154,
-    -154,  -154,  -154,  -154,  -154,  -154,  -154,  -154,  -154,  -154,
-    -154,  -154,  -154,  -154,  -154,  -154,  -154,  -154,  -154,  -154,
-    -154,  -154,  -154,  -154,  -154,  -154,  -154,  -154,  -154,  -154,
-    -154,  -154,  -154,  -154,  -154,  -154,  -154,  -154,  -154,  -154,
-    -154,  -154,  -154,  -154,  -154,  -154,  -154,  -154,  -154,  -154,
-    -154,  -154,  -154,  -154,  -154,  -154,  -154,  -154,  -154,  -154,
-    -154,  -154,  -154,  -154,  -154,  -154,  -154,  -154,  -154,  -154,
-    -154,  -154,  -154,  -154,  -154,  -154,  -154,  -154,  -154,  -154,
-    -154,  -154,  -154,  -154,  -154,  -154,  -154,  -154,  -154,  -154,
-    -154,  -154,  -154,  -154,  -154,  -154,  -154,  -154,  -154,  -154,
-    -154,  -154,  -154,  -154,  -154,  -154,  -154,  -154,  -154,  -154,
-    -154,  -154,  -154,  -154,  -154,  -154,  -154,  -154,  -154,  -154,
-    -154,  -154,  -154,  -154,  -154,  -154,  -154,  -154,  -154,  -154,
-    -154,  -154,  -154,  -154,  -154,  -154,  -154,  -154,  -154,  -154,
-    -154,  -154,  -154,  -154,  -154,  -154,  -154,  -154,  -154,  -154,
-    -154,  -154,  -154,  -154,  -154,  -154,  -154,  -154,  -154,  -154,
-    -154,  -154,  -154,  -154,  -154,  -154,  -154,  -154,  -154,  -154,
-    -154,  -154,  -154,  -154,  -154,  -154,  -154,  -154,  -154,  -154,
-    -154,  -154,  -154,  -154,  -154,  -154,  -154,  -154,  -154,  -154,
-    -154,  -154,  -154,  -154,  -154,  -154,  -154,  -154,  -154,  -154,
-    -154,  -154,  -154,  -154,  -154,  -154,  -154,  -154,  -154,  -154,
-    -154,  -154,  -154,  -154,  -154,  -154,  -154,  -154,  -154,  -154,
-    -154,  -154,  -154,  -154,  -154,  -154,  -154,  -154,  -154,  -154,
-    -154,  -154,  -154,  -154,  -154,  -154,  -154,  -154,  -154,  -154,
-    -154,  -154,  -154,  -154,  -154,  -154,  -154,  -154,  -154,  -154,
-    -154,  -154,  -154,  -154,  -154,  -154,  -154,  -154,  -154,  -154,
-    -154,  -154,  -154,  -154,  -154,  -154,  -154,  -154,  -154,  -154,
-    -154,  -154,  -154,  -154,  -154,  -154
+    -152,  -152,  -152,  -152,  -152,  -152,  -152,  -152,  -152,  -152,
+    -152,  -152,  -152,  -152,  -152,  -152,  -152,  -152,  -152,  -152,
+    -152,  -152,  -152,  -152,  -152,  -152,  -152,  -152,  -152,  -152,
+    -152,  -152,  -152,  -152,  -152,  -152,  -152,  -152,  -152,  -152,
+    -152,  -152,  -152,  -152,  -152,  -152,  -152,  -152,  -152,  -152,
+    -152,  -152,  -152,  -152,  -152,  -152,  -152,  -152,  -152,  -152,
+    -152,  -152,  -152,  -152,  -152,  -152,  -152,  -152,  -152,  -152,
+    -152,  -152,  -152,  -152,  -152,  -152,  -152,  -152,  -152,  -152,
+    -152,  -152,  -152,  -152,  -152,  -152,  -152,  -152,  -152,  -152,
+    -152,  -152,  -152,  -152,  -152,  -152,  -152,  -152,  -152,  -152,
+    -152,  -152,  -152,  -152,  -152,  -152,  -152,  -152,  -152,  -152,
+    -152,  -152,  -152,  -152,  -152,  -152,  -152,  -152,  -152,  -152,
+    -152,  -152,  -152,  -152,  -152,  -152,  -152,  -152,  -152,  -152,
+    -152,  -152,  -152,  -152,  -152,  -152,  -152,  -152,  -152,  -152,
+    -152,  -152,  -152,  -152,  -152,  -152,  -152,  -152,  -152,  -152,
+    -152,  -152,  -152,  -152,  -152,  -152,  -152,  -152,  -152,  -152,
+    -152,  -152,  -152,  -152,  -152,  -152,  -152,  -152,  -152,  -152,
+    -152,  -152,  -152,  -152,  -152,  -152,  -152,  -152,  -152,  -152,
+    -152,  -152,  -152,  -152,  -152,  -152,  -152,  -152,  -152,  -152,
+    -152,  -152,  -152,  -152,  -152,  -152,  -152,  -152,  -152,  -152,
+    -152,  -152,  -152,  -152,  -152,  -152,  -152,  -152,  -152,  -152,
+    -152,  -152,  -152,  -152,  -152,  -152,  -152,  -152,  -152,  -152,
+    -152,  -152,  -152,  -152,  -152,  -152,  -152,  -152,  -152,  -152,
+    -152,  -152,  -152,  -152,  -152,  -152,  -152,  -152,  -152,  -152,
+    -152,  -152,  -152,  -152,  -152,  -152,  -152,  -152,  -152,  -152,
+    -152,  -152,  -152,  -152,  -152,  -152,  -152,  -152,  -152,  -152,
+    -152,  -152,  -152,  -152,  -152,  -152,  -152,  -152,  -152,  -152,
+    -152,  -152,  -152,  -152,  -152,  -152,  -152,  -152,  -152,  -152,
+    -152,  -152,  -152,  -152,  -152,  -152,  -152,  -152,  -152,  -152,
+    -152,  -152,  -152,  -152,  -152,  -152,  -152,  -152,  -152,  -152,
+    -152,  -152,  -152,  -152,  -152,  -152,  -152,  -152,  -152
 };
 
-  /* YYDEFGOTO[NTERM-NUM].  */
+/* YYDEFGOTO[NTERM-NUM].  */
 static const yytype_int16 yydefgoto[] =
 {
-      -1,     1,    13,    14,    24,   223,    15,    25,   420,    16,
-      26,   434,    17,    27,   448,    18,    28,   464,   224,   225,
-     226,   227,   228,   229,   230,   231,   232,   233,   234,   235,
-     236,   237,   238,   239,   240,   241,   242,   243,   244,   245,
-     246,   247,   248,   249,   250,   251,   252,   253,   254,   255,
-     256,   257,   258,   259,   260,   261,   262,   263,   264,   265,
-     266,   267,   268,   269,   270,   271,   272,   273,   274,   275,
-     276,   277,   278,   279,   280,   281,   282,   283,   284,   285,
-     286,   287,   288,   289,   290,   291,   292,   293,   294,   295,
-     296,   297,   298,   299,   300,   301,   302,   303,   304,   305,
-     306,   307,   308,   309,   310,   311,   312,   313,   314,   315,
-     316,   317,   318,   319,   320,   321,   322,   323,   324,   325,
-     326,   327,   328,   329,   330,   331,   332,   333,   334,   335,
-     336,   337,   338,   339,   340,   341,   342,   343,   344,   345,
-     346,   347,   348,   349,   350,   351,   352,   353,   354,   355,
-     356,   357,   358,   359,   360,   361,   362,   363,   364,   365,
-     366,   367,   368,   369,   370,   371,   372,   373,   374,   375,
-     376,   377,   378,   379,   380,   381,   382,   383,   384,   385,
-     386,   387,   388,   389,   390,   391,   392,   393,   394,   395,
-     396,   397,   398,   399,   400,   401,   402,   403,   404,   405,
-     406,   407,   421,   422,   423,   424,   425,   426,   427,   435,
-     436,   437,   438,   439,   440,   465,   466,   467,   468,   469,
-     470,   471,   472,   449,   450,   451,   452,   453,   454,   455,
-      19,    29,   481,   482,   483,   484,   485,   486,   487,   488,
-     489,    20,    30,   502,   503,   504,   505,   506,   507,   508,
-     509,   510,   511,   512,   513,   514,    21,    31,   516,   517,
-     408,   409,   410,   411,    22,    32,   528,   529,   530,   531,
-     532,   533,   534,   535,   536,   537,   538,    23,    33,   544,
-     545,   546,   547,   548,   549,   412
+       0,     1,    13,    14,    24,   246,    15,    25,   466,    16,
+      26,   480,    17,    27,   494,    18,    28,   510,   247,   248,
+     249,   250,   251,   252,   253,   254,   255,   256,   257,   258,
+     259,   260,   261,   262,   263,   264,   265,   266,   267,   268,
+     269,   270,   271,   272,   273,   274,   275,   276,   277,   278,
+     279,   280,   281,   282,   283,   284,   285,   286,   287,   288,
+     289,   290,   291,   292,   293,   294,   295,   296,   297,   298,
+     299,   300,   301,   302,   303,   304,   305,   306,   307,   308,
+     309,   310,   311,   312,   313,   314,   315,   316,   317,   318,
+     319,   320,   321,   322,   323,   324,   325,   326,   327,   328,
+     329,   330,   331,   332,   333,   334,   335,   336,   337,   338,
+     339,   340,   341,   342,   343,   344,   345,   346,   347,   348,
+     349,   350,   351,   352,   353,   354,   355,   356,   357,   358,
+     359,   360,   361,   362,   363,   364,   365,   366,   367,   368,
+     369,   370,   371,   372,   373,   374,   375,   376,   377,   378,
+     379,   380,   381,   382,   383,   384,   385,   386,   387,   388,
+     389,   390,   391,   392,   393,   394,   395,   396,   397,   398,
+     399,   400,   401,   402,   403,   404,   405,   406,   407,   408,
+     409,   410,   411,   412,   413,   414,   415,   416,   417,   418,
+     419,   420,   421,   422,   423,   424,   425,   426,   427,   428,
+     429,   430,   431,   432,   433,   434,   435,   436,   437,   438,
+     439,   440,   441,   442,   443,   444,   445,   446,   447,   448,
+     449,   450,   451,   452,   453,   467,   468,   469,   470,   471,
+     472,   473,   481,   482,   483,   484,   485,   486,   511,   512,
+     513,   514,   515,   516,   517,   518,   495,   496,   497,   498,
+     499,   500,   501,    19,    29,   527,   528,   529,   530,   531,
+     532,   533,   534,   535,    20,    30,   548,   549,   550,   551,
+     552,   553,   554,   555,   556,   557,   558,   559,   560,    21,
+      31,   562,   563,   454,   455,   456,   457,    22,    32,   574,
+     575,   576,   577,   578,   579,   580,   581,   582,   583,   584,
+      23,    33,   590,   591,   592,   593,   594,   595,   458
 };
 
-  /* YYTABLE[YYPACT[STATE-NUM]] -- What to do in state STATE-NUM.  If
-     positive, shift that token.  If negative, reduce the rule whose
-     number is the opposite.  If YYTABLE_NINF, syntax error.  */
-static const yytype_uint16 yytable[] =
+/* YYTABLE[YYPACT[STATE-NUM]] -- What to do in state STATE-NUM.  If
+   positive, shift that token.  If negative, reduce the rule whose
+   number is the opposite.  If YYTABLE_NINF, syntax error.  */
+static const yytype_int16 yytable[] =
 {
       34,    35,    36,    37,    38,    39,    40,    41,    42,    43,
       44,    45,    46,    47,    48,    49,    50,    51,    52,    53,
       54,    55,    56,    57,    58,    59,    60,    61,    62,    63,
-      64,   515,   550,   551,   552,    65,    66,    67,   553,   554,
-     555,    68,    69,    70,    71,    72,    73,    74,    75,    76,
+      64,   561,   596,   597,   598,    65,    66,    67,   599,   600,
+     601,    68,    69,    70,    71,    72,    73,    74,    75,    76,
       77,    78,    79,    80,    81,    82,    83,    84,    85,    86,
       87,    88,    89,    90,    91,    92,    93,    94,    95,    96,
       97,    98,    99,   100,   101,   102,   103,   104,   105,   106,
-     107,   108,   456,   539,   540,   541,   542,   543,   556,   557,
-     558,   109,   110,   111,   559,   112,   113,   114,   560,   561,
+     107,   108,   602,   603,   502,   585,   586,   587,   588,   589,
+     604,   109,   110,   111,   605,   112,   113,   114,   606,   607,
      115,   116,   117,   118,   119,   120,   121,   122,   123,   124,
      125,   126,   127,   128,   129,   130,   131,   132,   133,   134,
-     135,   136,   137,   138,   562,   563,   564,   139,   565,   140,
-     141,   142,   143,   144,   145,   146,   147,   148,   149,   566,
-     567,   428,   568,   569,   570,   413,   571,   414,   415,   429,
-     430,   572,   150,   151,   152,   153,   154,   155,   156,   157,
+     135,   136,   137,   138,   608,   609,   610,   139,   611,   140,
+     141,   142,   143,   144,   145,   146,   147,   148,   149,   612,
+     613,   614,   615,   616,   617,   459,   618,   460,   461,   619,
+     620,   621,   150,   151,   152,   153,   154,   155,   156,   157,
      158,   159,   160,   161,   162,   163,   164,   165,   166,   167,
      168,   169,   170,   171,   172,   173,   174,   175,   176,   177,
      178,   179,   180,   181,   182,   183,   184,   185,   186,   187,
-     573,   188,   574,   189,   190,   191,   192,   193,   194,   195,
-     196,   197,   198,   199,   200,   201,   575,   576,   416,   441,
-     577,   578,     2,   579,   580,   581,   582,   202,   203,   204,
-     205,   206,   207,     3,   583,   584,   585,   586,   587,   208,
-     588,   589,   590,   591,   431,   592,   432,   209,   210,   417,
-     211,   212,   418,   213,   214,   442,   443,   215,   216,   217,
-     218,   219,   220,   221,   222,   593,     4,   594,   595,   596,
-     597,   598,     5,   599,   600,   601,   602,   603,   604,   605,
-     444,   518,   519,   520,   521,   522,   523,   524,   525,   526,
-     527,   457,   606,   458,   459,   460,   461,   462,   607,   608,
-     609,   610,   611,   463,   490,   491,   492,   493,   494,   495,
-     496,   497,   498,   499,   500,   501,     6,   612,   473,   474,
-     475,   476,   477,   478,   479,   480,   613,   614,   615,   616,
-     617,   618,     7,   619,   620,   621,   622,   623,   624,   625,
-     626,   445,   446,   627,   628,   629,   630,   631,   632,   633,
-     634,   635,   636,   637,   638,   639,   640,   641,   642,   643,
-     644,   645,   646,   647,   648,   433,   649,   650,   651,   652,
-     419,   653,   654,     8,   655,   656,   657,   658,   659,   660,
-     447,   661,   662,   663,   664,   665,   666,   667,   668,   669,
-     670,   671,   672,   673,   674,   675,   676,   677,   678,   679,
-     680,   681,   682,   683,   684,   685,   686,   687,   688,   689,
-     690,   691,   692,   693,   694,   695,   696,   697,   698,   699,
-     700,   701,   702,   703,     9,   704,   705,   706,   707,   708,
-     709,   710,   711,   712,   713,   714,   715,   716,   717,   718,
-      10,   719,   720,   721,   722,   723,   724,   725,   726,   727,
-     728,   729,   730,   731,   732,   733,   734,    11,   735,   736,
-     737,   738,   739,   740,   741,    12,   742,   743,   744,   745,
-     746,   747,   748,   749,   750,   751,   752,   753,   754,   755,
-     756,   757,   758,   759,   760,   761,   762,   763,   764,   765,
-     766,   767,   768,   769,   770,   771,   772,   773,   774,   775,
-     776,   777,   778,   779,   780,   781,   782,   783,   784,   785,
-     786,   787,   788,   789,   790,   791,   792,   793,   794,   795,
-     796,   797,   798,   799,   800,   801,   802,   803,   804,   805,
-     806,   807,   808,   809,   810,   811,   812,   813,   814,   815,
-     816,   817,   818,   819,   820,   821,   822
+     622,   188,   623,   189,   190,   191,   192,   193,   194,   195,
+     196,   197,   198,   199,   200,   201,   474,   624,   462,   625,
+     626,   627,   628,   629,   475,   476,   630,   202,   203,   204,
+     205,   206,   207,   631,   632,   633,   634,   635,   636,   208,
+     637,   638,   639,   640,     2,   641,   642,   209,   210,   463,
+     211,   212,   464,   213,   214,     3,     0,   215,   216,   217,
+     218,   219,   220,   221,   222,   223,   224,   225,   226,   227,
+     228,   229,   230,   231,   232,   233,   234,   235,   236,   237,
+     238,   239,   240,   241,   242,   243,   244,   245,     4,   487,
+     643,   644,   645,   503,     5,   504,   505,   506,   507,   508,
+     646,   647,   648,   649,   650,   509,   651,   652,   653,   477,
+     654,   478,   536,   537,   538,   539,   540,   541,   542,   543,
+     544,   545,   546,   547,   655,   488,   489,   564,   565,   566,
+     567,   568,   569,   570,   571,   572,   573,   656,     6,   657,
+     519,   520,   521,   522,   523,   524,   525,   526,   658,   659,
+     490,   660,   661,   662,     7,   663,   664,   665,   666,   667,
+     668,   669,   670,   671,   672,   673,   674,   675,   676,   677,
+     465,   678,   679,   680,   681,   682,   683,   684,   685,   686,
+     687,   688,   689,   690,   691,   692,   693,   694,   695,   696,
+     697,   698,   699,   700,   701,     8,   702,   703,   704,   705,
+     706,   707,   708,   709,   710,   711,   712,   713,   714,   715,
+     716,   491,   492,   717,   718,   719,   720,   721,   722,   723,
+     724,   725,   726,   727,   728,   729,   730,   731,   732,   733,
+     479,   734,   735,   736,   737,   738,   739,   740,   741,   742,
+     743,   744,   745,   746,   747,   748,     9,   749,   750,   751,
+     493,   752,   753,   754,   755,   756,   757,   758,   759,   760,
+     761,   762,    10,   763,   764,   765,   766,   767,   768,   769,
+     770,   771,   772,   773,   774,   775,   776,   777,   778,    11,
+     779,   780,   781,   782,   783,   784,   785,    12,   786,   787,
+     788,   789,   790,   791,   792,   793,   794,   795,   796,   797,
+     798,   799,   800,   801,   802,   803,   804,   805,   806,   807,
+     808,   809,   810,   811,   812,   813,   814,   815,   816,   817,
+     818,   819,   820,   821,   822,   823,   824,   825,   826,   827,
+     828,   829,   830,   831,   832,   833,   834,   835,   836,   837,
+     838,   839,   840,   841,   842,   843,   844,   845,   846,   847,
+     848,   849,   850,   851,   852,   853,   854,   855,   856,   857,
+     858,   859,   860,   861,   862,   863,   864,   865,   866,   867,
+     868,   869,   870,   871,   872,   873,   874,   875,   876,   877,
+     878,   879,   880,   881,   882,   883,   884,   885,   886,   887,
+     888,   889,   890,   891
 };
 
-static const yytype_uint16 yycheck[] =
+static const yytype_int16 yycheck[] =
 {
       12,    13,    14,    15,    16,    17,    18,    19,    20,    21,
       22,    23,    24,    25,    26,    27,    28,    29,    30,    31,
@@ -1652,62 +1810,67 @@ static const yytype_uint16 yycheck[] =
       62,    63,    64,    65,    66,    67,    68,    69,    70,    71,
       72,    73,    74,    75,    76,    77,    78,    79,    80,    81,
       82,    83,    84,    85,    86,    87,    88,    89,    90,    91,
-      92,    93,    43,   236,   237,   238,   239,   240,    10,    10,
+      92,    93,    10,    10,    43,   236,   237,   238,   239,   240,
       10,   103,   104,   105,    10,   107,   108,   109,    10,    10,
      112,   113,   114,   115,   116,   117,   118,   119,   120,   121,
      122,   123,   124,   125,   126,   127,   128,   129,   130,   131,
      132,   133,   134,   135,    10,    10,    10,   139,    10,   141,
      142,   143,   144,   145,   146,   147,   148,   149,   150,    10,
-      10,    43,    10,    10,    10,    43,    10,    45,    46,    51,
-      52,    10,   164,   165,   166,   167,   168,   169,   170,   171,
+      10,    10,    10,    10,    10,    43,    10,    45,    46,    10,
+      10,    10,   164,   165,   166,   167,   168,   169,   170,   171,
      172,   173,   174,   175,   176,   177,   178,   179,   180,   181,
      182,   183,   184,   185,   186,   187,   188,   189,   190,   191,
      192,   193,   194,   195,   196,   197,   198,   199,   200,   201,
       10,   203,    10,   205,   206,   207,   208,   209,   210,   211,
-     212,   213,   214,   215,   216,   217,    10,    10,   106,    43,
-      10,    10,     0,    10,    10,    10,    10,   229,   230,   231,
-     232,   233,   234,    11,    10,    10,    10,    10,    10,   241,
-      10,    10,    10,    10,   136,    10,   138,   249,   250,   137,
-     252,   253,   140,   255,   256,    79,    80,   259,   260,   261,
-     262,   263,   264,   265,   266,    10,    44,    10,    10,    10,
-      10,    10,    50,    10,    10,    10,    10,    10,    10,    10,
-     104,   219,   220,   221,   222,   223,   224,   225,   226,   227,
-     228,   242,    10,   244,   245,   246,   247,   248,    10,    10,
-      10,    10,    10,   254,   152,   153,   154,   155,   156,   157,
-     158,   159,   160,   161,   162,   163,    94,    10,    95,    96,
-      97,    98,    99,   100,   101,   102,    10,    10,    10,    10,
-      10,    10,   110,    10,    10,    10,    10,    10,    10,    10,
+     212,   213,   214,   215,   216,   217,    43,    10,   106,    10,
+      10,    10,    10,    10,    51,    52,    10,   229,   230,   231,
+     232,   233,   234,    10,    10,    10,    10,    10,    10,   241,
+      10,    10,    10,    10,     0,    10,    10,   249,   250,   137,
+     252,   253,   140,   255,   256,    11,    -1,   259,   260,   261,
+     262,   263,   264,   265,   266,   267,   268,   269,   270,   271,
+     272,   273,   274,   275,   276,   277,   278,   279,   280,   281,
+     282,   283,   284,   285,   286,   287,   288,   289,    44,    43,
+      10,    10,    10,   242,    50,   244,   245,   246,   247,   248,
+      10,    10,    10,    10,    10,   254,    10,    10,    10,   136,
+      10,   138,   152,   153,   154,   155,   156,   157,   158,   159,
+     160,   161,   162,   163,    10,    79,    80,   219,   220,   221,
+     222,   223,   224,   225,   226,   227,   228,    10,    94,    10,
+      95,    96,    97,    98,    99,   100,   101,   102,    10,    10,
+     104,    10,    10,    10,   110,    10,    10,    10,    10,    10,
+      10,    10,    10,    10,    10,    10,    10,    10,    10,    10,
+     258,    10,    10,    10,    10,    10,    10,    10,    10,    10,
+      10,    10,    10,    10,    10,    10,    10,    10,    10,    10,
+      10,    10,    10,    10,    10,   151,    10,    10,    10,    10,
+      10,    10,    10,    10,    10,    10,    10,    10,    10,    10,
       10,   165,   166,    10,    10,    10,    10,    10,    10,    10,
       10,    10,    10,    10,    10,    10,    10,    10,    10,    10,
-      10,    10,    10,    10,    10,   257,    10,    10,    10,    10,
-     258,    10,    10,   151,    10,    10,    10,    10,    10,    10,
+     257,    10,    10,    10,    10,    10,    10,    10,    10,    10,
+      10,    10,    10,    10,    10,    10,   202,    10,    10,    10,
      204,    10,    10,    10,    10,    10,    10,    10,    10,    10,
+      10,    10,   218,    10,    10,    10,    10,    10,    10,    10,
+      10,    10,    10,    10,    10,    10,    10,    10,    10,   235,
+      10,    10,    10,    10,    10,    10,    10,   243,    10,    10,
       10,    10,    10,    10,    10,    10,    10,    10,    10,    10,
       10,    10,    10,    10,    10,    10,    10,    10,    10,    10,
       10,    10,    10,    10,    10,    10,    10,    10,    10,    10,
-      10,    10,    10,    10,   202,    10,    10,    10,    10,    10,
       10,    10,    10,    10,    10,    10,    10,    10,    10,    10,
-     218,    10,    10,    10,    10,    10,    10,    10,    10,    10,
-      10,    10,    10,    10,    10,    10,    10,   235,    10,    10,
-      10,    10,    10,    10,    10,   243,    10,    10,    10,    10,
       10,    10,    10,    10,    10,    10,    10,    10,    10,    10,
       10,    10,    10,    10,    10,    10,    10,    10,    10,    10,
       10,    10,    10,    10,    10,    10,    10,    10,    10,    10,
       10,    10,    10,    10,    10,    10,    10,    10,    10,    10,
       10,    10,    10,    10,    10,    10,    10,    10,    10,    10,
       10,    10,    10,    10,    10,    10,    10,    10,    10,    10,
-      10,    10,    10,    10,    10,    10,    10,    10,    10,    10,
-      10,    10,    10,    10,    10,    10,    10
+      10,    10,    10,    10
 };
 
-  /* YYSTOS[STATE-NUM] -- The (internal number of the) accessing
-     symbol of state STATE-NUM.  */
-static const yytype_uint16 yystos[] =
+/* YYSTOS[STATE-NUM] -- The symbol kind of the accessing symbol of
+   state STATE-NUM.  */
+static const yytype_int16 yystos[] =
 {
-       0,   268,     0,    11,    44,    50,    94,   110,   151,   202,
-     218,   235,   243,   269,   270,   273,   276,   279,   282,   497,
-     508,   523,   531,   544,   271,   274,   277,   280,   283,   498,
-     509,   524,   532,   545,    12,    13,    14,    15,    16,    17,
+       0,   291,     0,    11,    44,    50,    94,   110,   151,   202,
+     218,   235,   243,   292,   293,   296,   299,   302,   305,   543,
+     554,   569,   577,   590,   294,   297,   300,   303,   306,   544,
+     555,   570,   578,   591,    12,    13,    14,    15,    16,    17,
       18,    19,    20,    21,    22,    23,    24,    25,    26,    27,
       28,    29,    30,    31,    32,    33,    34,    35,    36,    37,
       38,    39,    40,    41,    42,    47,    48,    49,    53,    54,
@@ -1726,9 +1889,9 @@ static const yytype_uint16 yystos[] =
      206,   207,   208,   209,   210,   211,   212,   213,   214,   215,
      216,   217,   229,   230,   231,   232,   233,   234,   241,   249,
      250,   252,   253,   255,   256,   259,   260,   261,   262,   263,
-     264,   265,   266,   272,   285,   286,   287,   288,   289,   290,
-     291,   292,   293,   294,   295,   296,   297,   298,   299,   300,
-     301,   302,   303,   304,   305,   306,   307,   308,   309,   310,
+     264,   265,   266,   267,   268,   269,   270,   271,   272,   273,
+     274,   275,   276,   277,   278,   279,   280,   281,   282,   283,
+     284,   285,   286,   287,   288,   289,   295,   308,   309,   310,
      311,   312,   313,   314,   315,   316,   317,   318,   319,   320,
      321,   322,   323,   324,   325,   326,   327,   328,   329,   330,
      331,   332,   333,   334,   335,   336,   337,   338,   339,   340,
@@ -1744,21 +1907,27 @@ static const yytype_uint16 yystos[] =
      431,   432,   433,   434,   435,   436,   437,   438,   439,   440,
      441,   442,   443,   444,   445,   446,   447,   448,   449,   450,
      451,   452,   453,   454,   455,   456,   457,   458,   459,   460,
-     461,   462,   463,   464,   465,   466,   467,   468,   527,   528,
-     529,   530,   552,    43,    45,    46,   106,   137,   140,   258,
-     275,   469,   470,   471,   472,   473,   474,   475,    43,    51,
-      52,   136,   138,   257,   278,   476,   477,   478,   479,   480,
-     481,    43,    79,    80,   104,   165,   166,   204,   281,   490,
-     491,   492,   493,   494,   495,   496,    43,   242,   244,   245,
-     246,   247,   248,   254,   284,   482,   483,   484,   485,   486,
-     487,   488,   489,    95,    96,    97,    98,    99,   100,   101,
-     102,   499,   500,   501,   502,   503,   504,   505,   506,   507,
-     152,   153,   154,   155,   156,   157,   158,   159,   160,   161,
-     162,   163,   510,   511,   512,   513,   514,   515,   516,   517,
-     518,   519,   520,   521,   522,   111,   525,   526,   219,   220,
-     221,   222,   223,   224,   225,   226,   227,   228,   533,   534,
-     535,   536,   537,   538,   539,   540,   541,   542,   543,   236,
-     237,   238,   239,   240,   546,   547,   548,   549,   550,   551,
+     461,   462,   463,   464,   465,   466,   467,   468,   469,   470,
+     471,   472,   473,   474,   475,   476,   477,   478,   479,   480,
+     481,   482,   483,   484,   485,   486,   487,   488,   489,   490,
+     491,   492,   493,   494,   495,   496,   497,   498,   499,   500,
+     501,   502,   503,   504,   505,   506,   507,   508,   509,   510,
+     511,   512,   513,   514,   573,   574,   575,   576,   598,    43,
+      45,    46,   106,   137,   140,   258,   298,   515,   516,   517,
+     518,   519,   520,   521,    43,    51,    52,   136,   138,   257,
+     301,   522,   523,   524,   525,   526,   527,    43,    79,    80,
+     104,   165,   166,   204,   304,   536,   537,   538,   539,   540,
+     541,   542,    43,   242,   244,   245,   246,   247,   248,   254,
+     307,   528,   529,   530,   531,   532,   533,   534,   535,    95,
+      96,    97,    98,    99,   100,   101,   102,   545,   546,   547,
+     548,   549,   550,   551,   552,   553,   152,   153,   154,   155,
+     156,   157,   158,   159,   160,   161,   162,   163,   556,   557,
+     558,   559,   560,   561,   562,   563,   564,   565,   566,   567,
+     568,   111,   571,   572,   219,   220,   221,   222,   223,   224,
+     225,   226,   227,   228,   579,   580,   581,   582,   583,   584,
+     585,   586,   587,   588,   589,   236,   237,   238,   239,   240,
+     592,   593,   594,   595,   596,   597,    10,    10,    10,    10,
+      10,    10,    10,    10,    10,    10,    10,    10,    10,    10,
       10,    10,    10,    10,    10,    10,    10,    10,    10,    10,
       10,    10,    10,    10,    10,    10,    10,    10,    10,    10,
       10,    10,    10,    10,    10,    10,    10,    10,    10,    10,
@@ -1786,39 +1955,40 @@ static const yytype_uint16 yystos[] =
       10,    10,    10,    10,    10,    10,    10,    10,    10,    10,
       10,    10,    10,    10,    10,    10,    10,    10,    10,    10,
       10,    10,    10,    10,    10,    10,    10,    10,    10,    10,
-      10,    10,    10
+      10,    10,    10,    10,    10,    10,    10,    10,    10,    10,
+      10,    10
 };
 
-  /* YYR1[YYN] -- Symbol number of symbol that rule YYN derives.  */
-static const yytype_uint16 yyr1[] =
+/* YYR1[RULE-NUM] -- Symbol kind of the left-hand side of rule RULE-NUM.  */
+static const yytype_int16 yyr1[] =
 {
-       0,   267,   268,   268,   269,   269,   269,   269,   269,   269,
-     269,   269,   269,   269,   270,   271,   271,   272,   272,   272,
-     272,   272,   272,   272,   272,   272,   272,   272,   272,   272,
-     272,   272,   272,   272,   272,   272,   272,   272,   272,   272,
-     272,   272,   272,   272,   272,   272,   272,   272,   272,   272,
-     272,   272,   272,   272,   272,   272,   272,   272,   272,   272,
-     272,   272,   272,   272,   272,   272,   272,   272,   272,   272,
-     272,   272,   272,   272,   272,   272,   272,   272,   272,   272,
-     272,   272,   272,   272,   272,   272,   272,   272,   272,   272,
-     272,   272,   272,   272,   272,   272,   272,   272,   272,   272,
-     272,   272,   272,   272,   272,   272,   272,   272,   272,   272,
-     272,   272,   272,   272,   272,   272,   272,   272,   272,   272,
-     272,   272,   272,   272,   272,   272,   272,   272,   272,   272,
-     272,   272,   272,   272,   272,   272,   272,   272,   272,   272,
-     272,   272,   272,   272,   272,   272,   272,   272,   272,   272,
-     272,   272,   272,   272,   272,   272,   272,   272,   272,   272,
-     272,   272,   272,   272,   272,   272,   272,   272,   272,   272,
-     272,   272,   272,   272,   272,   272,   272,   272,   272,   272,
-     272,   272,   272,   272,   272,   272,   272,   272,   272,   272,
-     272,   272,   272,   272,   272,   272,   272,   272,   272,   272,
-     272,   272,   272,   272,   272,   272,   273,   274,   274,   275,
-     275,   275,   275,   275,   275,   275,   276,   277,   277,   278,
-     278,   278,   278,   278,   278,   279,   280,   280,   281,   281,
-     281,   281,   281,   281,   281,   282,   283,   283,   284,   284,
-     284,   284,   284,   284,   284,   284,   285,   286,   287,   288,
-     289,   290,   291,   292,   293,   294,   295,   296,   297,   298,
-     299,   300,   301,   302,   303,   304,   305,   306,   307,   308,
+       0,   290,   291,   291,   292,   292,   292,   292,   292,   292,
+     292,   292,   292,   292,   293,   294,   294,   295,   295,   295,
+     295,   295,   295,   295,   295,   295,   295,   295,   295,   295,
+     295,   295,   295,   295,   295,   295,   295,   295,   295,   295,
+     295,   295,   295,   295,   295,   295,   295,   295,   295,   295,
+     295,   295,   295,   295,   295,   295,   295,   295,   295,   295,
+     295,   295,   295,   295,   295,   295,   295,   295,   295,   295,
+     295,   295,   295,   295,   295,   295,   295,   295,   295,   295,
+     295,   295,   295,   295,   295,   295,   295,   295,   295,   295,
+     295,   295,   295,   295,   295,   295,   295,   295,   295,   295,
+     295,   295,   295,   295,   295,   295,   295,   295,   295,   295,
+     295,   295,   295,   295,   295,   295,   295,   295,   295,   295,
+     295,   295,   295,   295,   295,   295,   295,   295,   295,   295,
+     295,   295,   295,   295,   295,   295,   295,   295,   295,   295,
+     295,   295,   295,   295,   295,   295,   295,   295,   295,   295,
+     295,   295,   295,   295,   295,   295,   295,   295,   295,   295,
+     295,   295,   295,   295,   295,   295,   295,   295,   295,   295,
+     295,   295,   295,   295,   295,   295,   295,   295,   295,   295,
+     295,   295,   295,   295,   295,   295,   295,   295,   295,   295,
+     295,   295,   295,   295,   295,   295,   295,   295,   295,   295,
+     295,   295,   295,   295,   295,   295,   295,   295,   295,   295,
+     295,   295,   295,   295,   295,   295,   295,   295,   295,   295,
+     295,   295,   295,   295,   295,   295,   295,   295,   295,   296,
+     297,   297,   298,   298,   298,   298,   298,   298,   298,   299,
+     300,   300,   301,   301,   301,   301,   301,   301,   302,   303,
+     303,   304,   304,   304,   304,   304,   304,   304,   305,   306,
+     306,   307,   307,   307,   307,   307,   307,   307,   307,   308,
      309,   310,   311,   312,   313,   314,   315,   316,   317,   318,
      319,   320,   321,   322,   323,   324,   325,   326,   327,   328,
      329,   330,   331,   332,   333,   334,   335,   336,   337,   338,
@@ -1838,19 +2008,24 @@ static const yytype_uint16 yyr1[] =
      469,   470,   471,   472,   473,   474,   475,   476,   477,   478,
      479,   480,   481,   482,   483,   484,   485,   486,   487,   488,
      489,   490,   491,   492,   493,   494,   495,   496,   497,   498,
-     498,   499,   499,   499,   499,   499,   499,   499,   499,   500,
-     501,   502,   503,   504,   505,   506,   507,   508,   509,   509,
-     510,   510,   510,   510,   510,   510,   510,   510,   510,   510,
-     510,   510,   511,   512,   513,   514,   515,   516,   517,   518,
-     519,   520,   521,   522,   523,   524,   524,   525,   526,   527,
-     528,   529,   530,   531,   532,   532,   533,   533,   533,   533,
-     533,   533,   533,   533,   533,   533,   534,   535,   536,   537,
-     538,   539,   540,   541,   542,   543,   544,   545,   545,   546,
-     546,   546,   546,   546,   547,   548,   549,   550,   551,   552
+     499,   500,   501,   502,   503,   504,   505,   506,   507,   508,
+     509,   510,   511,   512,   513,   514,   515,   516,   517,   518,
+     519,   520,   521,   522,   523,   524,   525,   526,   527,   528,
+     529,   530,   531,   532,   533,   534,   535,   536,   537,   538,
+     539,   540,   541,   542,   543,   544,   544,   545,   545,   545,
+     545,   545,   545,   545,   545,   546,   547,   548,   549,   550,
+     551,   552,   553,   554,   555,   555,   556,   556,   556,   556,
+     556,   556,   556,   556,   556,   556,   556,   556,   557,   558,
+     559,   560,   561,   562,   563,   564,   565,   566,   567,   568,
+     569,   570,   570,   571,   572,   573,   574,   575,   576,   577,
+     578,   578,   579,   579,   579,   579,   579,   579,   579,   579,
+     579,   579,   580,   581,   582,   583,   584,   585,   586,   587,
+     588,   589,   590,   591,   591,   592,   592,   592,   592,   592,
+     593,   594,   595,   596,   597,   598
 };
 
-  /* YYR2[YYN] -- Number of symbols on the right hand side of rule YYN.  */
-static const yytype_uint8 yyr2[] =
+/* YYR2[RULE-NUM] -- Number of symbols on the right-hand side of rule RULE-NUM.  */
+static const yytype_int8 yyr2[] =
 {
        0,     2,     0,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     1,     2,     0,     1,     1,     1,
@@ -1872,11 +2047,13 @@ static const yytype_uint8 yyr2[] =
        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
-       1,     1,     1,     1,     1,     1,     1,     2,     0,     1,
-       1,     1,     1,     1,     1,     1,     1,     2,     0,     1,
-       1,     1,     1,     1,     1,     1,     2,     0,     1,     1,
-       1,     1,     1,     1,     1,     1,     2,     0,     1,     1,
-       1,     1,     1,     1,     1,     1,     2,     2,     2,     2,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       2,     0,     1,     1,     1,     1,     1,     1,     1,     1,
+       2,     0,     1,     1,     1,     1,     1,     1,     1,     2,
+       0,     1,     1,     1,     1,     1,     1,     1,     1,     2,
+       0,     1,     1,     1,     1,     1,     1,     1,     1,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
@@ -1888,61 +2065,64 @@ static const yytype_uint8 yyr2[] =
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,     3,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     3,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     3,     3,     4,     4,     4,     3,     3,     2,
-       2,     2,     2,     2,     2,     3,     3,     2,     2,     2,
+       3,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     3,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     3,     3,     4,     4,
+       4,     3,     3,     2,     2,     2,     2,     2,     2,     3,
+       3,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     3,     3,     3,     2,     2,     2,     1,     2,
-       0,     1,     1,     1,     1,     1,     1,     1,     1,     2,
-       2,     2,     2,     2,     2,     2,     2,     1,     2,     0,
-       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     3,     3,
+       3,     2,     2,     2,     1,     2,     0,     1,     1,     1,
+       1,     1,     1,     1,     1,     2,     2,     2,     2,     2,
+       2,     2,     2,     1,     2,     0,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       1,     2,     0,     1,     2,     2,     2,     3,     3,     1,
+       2,     0,     1,     1,     1,     1,     1,     1,     1,     1,
        1,     1,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,     1,     2,     0,     1,     2,     2,
-       2,     3,     3,     1,     2,     0,     1,     1,     1,     1,
-       1,     1,     1,     1,     1,     1,     2,     2,     2,     2,
-       2,     2,     2,     2,     2,     2,     1,     2,     0,     1,
-       1,     1,     1,     1,     2,     2,     2,     2,     2,     3
+       2,     2,     1,     2,     0,     1,     1,     1,     1,     1,
+       2,     2,     2,     2,     2,     3
 };
 
 
+enum { YYENOMEM = -2 };
+
 #define yyerrok         (yyerrstatus = 0)
 #define yyclearin       (yychar = YYEMPTY)
-#define YYEMPTY         (-2)
-#define YYEOF           0
 
 #define YYACCEPT        goto yyacceptlab
 #define YYABORT         goto yyabortlab
 #define YYERROR         goto yyerrorlab
+#define YYNOMEM         goto yyexhaustedlab
 
 
 #define YYRECOVERING()  (!!yyerrstatus)
 
-#define YYBACKUP(Token, Value)                                  \
-do                                                              \
-  if (yychar == YYEMPTY)                                        \
-    {                                                           \
-      yychar = (Token);                                         \
-      yylval = (Value);                                         \
-      YYPOPSTACK (yylen);                                       \
-      yystate = *yyssp;                                         \
-      goto yybackup;                                            \
-    }                                                           \
-  else                                                          \
-    {                                                           \
-      yyerror (YY_("syntax error: cannot back up")); \
-      YYERROR;                                                  \
-    }                                                           \
-while (0)
-
-/* Error token number */
-#define YYTERROR        1
-#define YYERRCODE       256
-
+#define YYBACKUP(Token, Value)                                    \
+  do                                                              \
+    if (yychar == YYEMPTY)                                        \
+      {                                                           \
+        yychar = (Token);                                         \
+        yylval = (Value);                                         \
+        YYPOPSTACK (yylen);                                       \
+        yystate = *yyssp;                                         \
+        goto yybackup;                                            \
+      }                                                           \
+    else                                                          \
+      {                                                           \
+        yyerror (YY_("syntax error: cannot back up")); \
+        YYERROR;                                                  \
+      }                                                           \
+  while (0)
+
+/* Backward compatibility with an undocumented macro.
+   Use YYerror or YYUNDEF. */
+#define YYERRCODE YYUNDEF
 
 
 /* Enable debugging if requested.  */
@@ -1959,55 +2139,52 @@ do {                                            \
     YYFPRINTF Args;                             \
 } while (0)
 
-/* This macro is provided for backward compatibility. */
-#ifndef YY_LOCATION_PRINT
-# define YY_LOCATION_PRINT(File, Loc) ((void) 0)
-#endif
 
 
-# define YY_SYMBOL_PRINT(Title, Type, Value, Location)                    \
+
+# define YY_SYMBOL_PRINT(Title, Kind, Value, Location)                    \
 do {                                                                      \
   if (yydebug)                                                            \
     {                                                                     \
       YYFPRINTF (stderr, "%s ", Title);                                   \
       yy_symbol_print (stderr,                                            \
-                  Type, Value); \
+                  Kind, Value); \
       YYFPRINTF (stderr, "\n");                                           \
     }                                                                     \
 } while (0)
 
 
-/*----------------------------------------.
-| Print this symbol's value on YYOUTPUT.  |
-`----------------------------------------*/
+/*-----------------------------------.
+| Print this symbol's value on YYO.  |
+`-----------------------------------*/
 
 static void
-yy_symbol_value_print (FILE *yyoutput, int yytype, YYSTYPE const * const yyvaluep)
+yy_symbol_value_print (FILE *yyo,
+                       yysymbol_kind_t yykind, YYSTYPE const * const yyvaluep)
 {
-  FILE *yyo = yyoutput;
-  YYUSE (yyo);
+  FILE *yyoutput = yyo;
+  YY_USE (yyoutput);
   if (!yyvaluep)
     return;
-# ifdef YYPRINT
-  if (yytype < YYNTOKENS)
-    YYPRINT (yyoutput, yytoknum[yytype], *yyvaluep);
-# endif
-  YYUSE (yytype);
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  YY_USE (yykind);
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
 }
 
 
-/*--------------------------------.
-| Print this symbol on YYOUTPUT.  |
-`--------------------------------*/
+/*---------------------------.
+| Print this symbol on YYO.  |
+`---------------------------*/
 
 static void
-yy_symbol_print (FILE *yyoutput, int yytype, YYSTYPE const * const yyvaluep)
+yy_symbol_print (FILE *yyo,
+                 yysymbol_kind_t yykind, YYSTYPE const * const yyvaluep)
 {
-  YYFPRINTF (yyoutput, "%s %s (",
-             yytype < YYNTOKENS ? "token" : "nterm", yytname[yytype]);
+  YYFPRINTF (yyo, "%s %s (",
+             yykind < YYNTOKENS ? "token" : "nterm", yysymbol_name (yykind));
 
-  yy_symbol_value_print (yyoutput, yytype, yyvaluep);
-  YYFPRINTF (yyoutput, ")");
+  yy_symbol_value_print (yyo, yykind, yyvaluep);
+  YYFPRINTF (yyo, ")");
 }
 
 /*------------------------------------------------------------------.
@@ -2016,7 +2193,7 @@ yy_symbol_print (FILE *yyoutput, int yytype, YYSTYPE const * const yyvaluep)
 `------------------------------------------------------------------*/
 
 static void
-yy_stack_print (yytype_int16 *yybottom, yytype_int16 *yytop)
+yy_stack_print (yy_state_t *yybottom, yy_state_t *yytop)
 {
   YYFPRINTF (stderr, "Stack now");
   for (; yybottom <= yytop; yybottom++)
@@ -2039,21 +2216,21 @@ do {                                                            \
 `------------------------------------------------*/
 
 static void
-yy_reduce_print (yytype_int16 *yyssp, YYSTYPE *yyvsp, int yyrule)
+yy_reduce_print (yy_state_t *yyssp, YYSTYPE *yyvsp,
+                 int yyrule)
 {
-  unsigned long int yylno = yyrline[yyrule];
+  int yylno = yyrline[yyrule];
   int yynrhs = yyr2[yyrule];
   int yyi;
-  YYFPRINTF (stderr, "Reducing stack by rule %d (line %lu):\n",
+  YYFPRINTF (stderr, "Reducing stack by rule %d (line %d):\n",
              yyrule - 1, yylno);
   /* The symbols being reduced.  */
   for (yyi = 0; yyi < yynrhs; yyi++)
     {
       YYFPRINTF (stderr, "   $%d = ", yyi + 1);
       yy_symbol_print (stderr,
-                       yystos[yyssp[yyi + 1 - yynrhs]],
-                       &(yyvsp[(yyi + 1) - (yynrhs)])
-                                              );
+                       YY_ACCESSING_SYMBOL (+yyssp[yyi + 1 - yynrhs]),
+                       &yyvsp[(yyi + 1) - (yynrhs)]);
       YYFPRINTF (stderr, "\n");
     }
 }
@@ -2068,8 +2245,8 @@ do {                                    \
    multiple parsers can coexist.  */
 int yydebug;
 #else /* !YYDEBUG */
-# define YYDPRINTF(Args)
-# define YY_SYMBOL_PRINT(Title, Type, Value, Location)
+# define YYDPRINTF(Args) ((void) 0)
+# define YY_SYMBOL_PRINT(Title, Kind, Value, Location)
 # define YY_STACK_PRINT(Bottom, Top)
 # define YY_REDUCE_PRINT(Rule)
 #endif /* !YYDEBUG */
@@ -2092,250 +2269,30 @@ int yydebug;
 #endif
 
 
-#if YYERROR_VERBOSE
-
-# ifndef yystrlen
-#  if defined __GLIBC__ && defined _STRING_H
-#   define yystrlen strlen
-#  else
-/* Return the length of YYSTR.  */
-static YYSIZE_T
-yystrlen (const char *yystr)
-{
-  YYSIZE_T yylen;
-  for (yylen = 0; yystr[yylen]; yylen++)
-    continue;
-  return yylen;
-}
-#  endif
-# endif
-
-# ifndef yystpcpy
-#  if defined __GLIBC__ && defined _STRING_H && defined _GNU_SOURCE
-#   define yystpcpy stpcpy
-#  else
-/* Copy YYSRC to YYDEST, returning the address of the terminating '\0' in
-   YYDEST.  */
-static char *
-yystpcpy (char *yydest, const char *yysrc)
-{
-  char *yyd = yydest;
-  const char *yys = yysrc;
-
-  while ((*yyd++ = *yys++) != '\0')
-    continue;
-
-  return yyd - 1;
-}
-#  endif
-# endif
-
-# ifndef yytnamerr
-/* Copy to YYRES the contents of YYSTR after stripping away unnecessary
-   quotes and backslashes, so that it's suitable for yyerror.  The
-   heuristic is that double-quoting is unnecessary unless the string
-   contains an apostrophe, a comma, or backslash (other than
-   backslash-backslash).  YYSTR is taken from yytname.  If YYRES is
-   null, do not copy; instead, return the length of what the result
-   would have been.  */
-static YYSIZE_T
-yytnamerr (char *yyres, const char *yystr)
-{
-  if (*yystr == '"')
-    {
-      YYSIZE_T yyn = 0;
-      char const *yyp = yystr;
-
-      for (;;)
-        switch (*++yyp)
-          {
-          case '\'':
-          case ',':
-            goto do_not_strip_quotes;
-
-          case '\\':
-            if (*++yyp != '\\')
-              goto do_not_strip_quotes;
-            /* Fall through.  */
-          default:
-            if (yyres)
-              yyres[yyn] = *yyp;
-            yyn++;
-            break;
-
-          case '"':
-            if (yyres)
-              yyres[yyn] = '\0';
-            return yyn;
-          }
-    do_not_strip_quotes: ;
-    }
-
-  if (! yyres)
-    return yystrlen (yystr);
-
-  return yystpcpy (yyres, yystr) - yyres;
-}
-# endif
-
-/* Copy into *YYMSG, which is of size *YYMSG_ALLOC, an error message
-   about the unexpected token YYTOKEN for the state stack whose top is
-   YYSSP.
-
-   Return 0 if *YYMSG was successfully written.  Return 1 if *YYMSG is
-   not large enough to hold the message.  In that case, also set
-   *YYMSG_ALLOC to the required number of bytes.  Return 2 if the
-   required number of bytes is too large to store.  */
-static int
-yysyntax_error (YYSIZE_T *yymsg_alloc, char **yymsg,
-                yytype_int16 *yyssp, int yytoken)
-{
-  YYSIZE_T yysize0 = yytnamerr (YY_NULLPTR, yytname[yytoken]);
-  YYSIZE_T yysize = yysize0;
-  enum { YYERROR_VERBOSE_ARGS_MAXIMUM = 5 };
-  /* Internationalized format string. */
-  const char *yyformat = YY_NULLPTR;
-  /* Arguments of yyformat. */
-  char const *yyarg[YYERROR_VERBOSE_ARGS_MAXIMUM];
-  /* Number of reported tokens (one for the "unexpected", one per
-     "expected"). */
-  int yycount = 0;
-
-  /* There are many possibilities here to consider:
-     - If this state is a consistent state with a default action, then
-       the only way this function was invoked is if the default action
-       is an error action.  In that case, don't check for expected
-       tokens because there are none.
-     - The only way there can be no lookahead present (in yychar) is if
-       this state is a consistent state with a default action.  Thus,
-       detecting the absence of a lookahead is sufficient to determine
-       that there is no unexpected or expected token to report.  In that
-       case, just report a simple "syntax error".
-     - Don't assume there isn't a lookahead just because this state is a
-       consistent state with a default action.  There might have been a
-       previous inconsistent state, consistent state with a non-default
-       action, or user semantic action that manipulated yychar.
-     - Of course, the expected token list depends on states to have
-       correct lookahead information, and it depends on the parser not
-       to perform extra reductions after fetching a lookahead from the
-       scanner and before detecting a syntax error.  Thus, state merging
-       (from LALR or IELR) and default reductions corrupt the expected
-       token list.  However, the list is correct for canonical LR with
-       one exception: it will still contain any token that will not be
-       accepted due to an error action in a later state.
-  */
-  if (yytoken != YYEMPTY)
-    {
-      int yyn = yypact[*yyssp];
-      yyarg[yycount++] = yytname[yytoken];
-      if (!yypact_value_is_default (yyn))
-        {
-          /* Start YYX at -YYN if negative to avoid negative indexes in
-             YYCHECK.  In other words, skip the first -YYN actions for
-             this state because they are default actions.  */
-          int yyxbegin = yyn < 0 ? -yyn : 0;
-          /* Stay within bounds of both yycheck and yytname.  */
-          int yychecklim = YYLAST - yyn + 1;
-          int yyxend = yychecklim < YYNTOKENS ? yychecklim : YYNTOKENS;
-          int yyx;
-
-          for (yyx = yyxbegin; yyx < yyxend; ++yyx)
-            if (yycheck[yyx + yyn] == yyx && yyx != YYTERROR
-                && !yytable_value_is_error (yytable[yyx + yyn]))
-              {
-                if (yycount == YYERROR_VERBOSE_ARGS_MAXIMUM)
-                  {
-                    yycount = 1;
-                    yysize = yysize0;
-                    break;
-                  }
-                yyarg[yycount++] = yytname[yyx];
-                {
-                  YYSIZE_T yysize1 = yysize + yytnamerr (YY_NULLPTR, yytname[yyx]);
-                  if (! (yysize <= yysize1
-                         && yysize1 <= YYSTACK_ALLOC_MAXIMUM))
-                    return 2;
-                  yysize = yysize1;
-                }
-              }
-        }
-    }
-
-  switch (yycount)
-    {
-# define YYCASE_(N, S)                      \
-      case N:                               \
-        yyformat = S;                       \
-      break
-    default: /* Avoid compiler warnings. */
-      YYCASE_(0, YY_("syntax error"));
-      YYCASE_(1, YY_("syntax error, unexpected %s"));
-      YYCASE_(2, YY_("syntax error, unexpected %s, expecting %s"));
-      YYCASE_(3, YY_("syntax error, unexpected %s, expecting %s or %s"));
-      YYCASE_(4, YY_("syntax error, unexpected %s, expecting %s or %s or %s"));
-      YYCASE_(5, YY_("syntax error, unexpected %s, expecting %s or %s or %s or %s"));
-# undef YYCASE_
-    }
 
-  {
-    YYSIZE_T yysize1 = yysize + yystrlen (yyformat);
-    if (! (yysize <= yysize1 && yysize1 <= YYSTACK_ALLOC_MAXIMUM))
-      return 2;
-    yysize = yysize1;
-  }
 
-  if (*yymsg_alloc < yysize)
-    {
-      *yymsg_alloc = 2 * yysize;
-      if (! (yysize <= *yymsg_alloc
-             && *yymsg_alloc <= YYSTACK_ALLOC_MAXIMUM))
-        *yymsg_alloc = YYSTACK_ALLOC_MAXIMUM;
-      return 1;
-    }
 
-  /* Avoid sprintf, as that infringes on the user's name space.
-     Don't have undefined behavior even if the translation
-     produced a string with the wrong number of "%s"s.  */
-  {
-    char *yyp = *yymsg;
-    int yyi = 0;
-    while ((*yyp = *yyformat) != '\0')
-      if (*yyp == '%' && yyformat[1] == 's' && yyi < yycount)
-        {
-          yyp += yytnamerr (yyp, yyarg[yyi++]);
-          yyformat += 2;
-        }
-      else
-        {
-          yyp++;
-          yyformat++;
-        }
-  }
-  return 0;
-}
-#endif /* YYERROR_VERBOSE */
 
 /*-----------------------------------------------.
 | Release the memory associated to this symbol.  |
 `-----------------------------------------------*/
 
 static void
-yydestruct (const char *yymsg, int yytype, YYSTYPE *yyvaluep)
+yydestruct (const char *yymsg,
+            yysymbol_kind_t yykind, YYSTYPE *yyvaluep)
 {
-  YYUSE (yyvaluep);
+  YY_USE (yyvaluep);
   if (!yymsg)
     yymsg = "Deleting";
-  YY_SYMBOL_PRINT (yymsg, yytype, yyvaluep, yylocationp);
+  YY_SYMBOL_PRINT (yymsg, yykind, yyvaluep, yylocationp);
 
   YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
-  YYUSE (yytype);
+  YY_USE (yykind);
   YY_IGNORE_MAYBE_UNINITIALIZED_END
 }
 
 
-
-
-/* The lookahead symbol.  */
+/* Lookahead token kind.  */
 int yychar;
 
 /* The semantic value of the lookahead symbol.  */
@@ -2344,6 +2301,8 @@ YYSTYPE yylval;
 int yynerrs;
 
 
+
+
 /*----------.
 | yyparse.  |
 `----------*/
@@ -2351,43 +2310,36 @@ int yynerrs;
 int
 yyparse (void)
 {
-    int yystate;
+    yy_state_fast_t yystate = 0;
     /* Number of tokens to shift before error messages enabled.  */
-    int yyerrstatus;
-
-    /* The stacks and their tools:
-       'yyss': related to states.
-       'yyvs': related to semantic values.
+    int yyerrstatus = 0;
 
-       Refer to the stacks through separate pointers, to allow yyoverflow
+    /* Refer to the stacks through separate pointers, to allow yyoverflow
        to reallocate them elsewhere.  */
 
-    /* The state stack.  */
-    yytype_int16 yyssa[YYINITDEPTH];
-    yytype_int16 *yyss;
-    yytype_int16 *yyssp;
+    /* Their size.  */
+    YYPTRDIFF_T yystacksize = YYINITDEPTH;
 
-    /* The semantic value stack.  */
-    YYSTYPE yyvsa[YYINITDEPTH];
-    YYSTYPE *yyvs;
-    YYSTYPE *yyvsp;
+    /* The state stack: array, bottom, top.  */
+    yy_state_t yyssa[YYINITDEPTH];
+    yy_state_t *yyss = yyssa;
+    yy_state_t *yyssp = yyss;
 
-    YYSIZE_T yystacksize;
+    /* The semantic value stack: array, bottom, top.  */
+    YYSTYPE yyvsa[YYINITDEPTH];
+    YYSTYPE *yyvs = yyvsa;
+    YYSTYPE *yyvsp = yyvs;
 
   int yyn;
+  /* The return value of yyparse.  */
   int yyresult;
-  /* Lookahead token as an internal (translated) token number.  */
-  int yytoken = 0;
+  /* Lookahead symbol kind.  */
+  yysymbol_kind_t yytoken = YYSYMBOL_YYEMPTY;
   /* The variables used to return semantic value and location from the
      action routines.  */
   YYSTYPE yyval;
 
-#if YYERROR_VERBOSE
-  /* Buffer for error messages, and its allocated size.  */
-  char yymsgbuf[128];
-  char *yymsg = yymsgbuf;
-  YYSIZE_T yymsg_alloc = sizeof yymsgbuf;
-#endif
+
 
 #define YYPOPSTACK(N)   (yyvsp -= (N), yyssp -= (N))
 
@@ -2395,71 +2347,75 @@ yyparse (void)
      Keep to zero when no symbol should be popped.  */
   int yylen = 0;
 
-  yyssp = yyss = yyssa;
-  yyvsp = yyvs = yyvsa;
-  yystacksize = YYINITDEPTH;
-
   YYDPRINTF ((stderr, "Starting parse\n"));
 
-  yystate = 0;
-  yyerrstatus = 0;
-  yynerrs = 0;
   yychar = YYEMPTY; /* Cause a token to be read.  */
+
   goto yysetstate;
 
+
 /*------------------------------------------------------------.
-| yynewstate -- Push a new state, which is found in yystate.  |
+| yynewstate -- push a new state, which is found in yystate.  |
 `------------------------------------------------------------*/
- yynewstate:
+yynewstate:
   /* In all cases, when you get here, the value and location stacks
      have just been pushed.  So pushing a state here evens the stacks.  */
   yyssp++;
 
- yysetstate:
-  *yyssp = yystate;
+
+/*--------------------------------------------------------------------.
+| yysetstate -- set current state (the top of the stack) to yystate.  |
+`--------------------------------------------------------------------*/
+yysetstate:
+  YYDPRINTF ((stderr, "Entering state %d\n", yystate));
+  YY_ASSERT (0 <= yystate && yystate < YYNSTATES);
+  YY_IGNORE_USELESS_CAST_BEGIN
+  *yyssp = YY_CAST (yy_state_t, yystate);
+  YY_IGNORE_USELESS_CAST_END
+  YY_STACK_PRINT (yyss, yyssp);
 
   if (yyss + yystacksize - 1 <= yyssp)
+#if !defined yyoverflow && !defined YYSTACK_RELOCATE
+    YYNOMEM;
+#else
     {
       /* Get the current used size of the three stacks, in elements.  */
-      YYSIZE_T yysize = yyssp - yyss + 1;
+      YYPTRDIFF_T yysize = yyssp - yyss + 1;
 
-#ifdef yyoverflow
+# if defined yyoverflow
       {
         /* Give user a chance to reallocate the stack.  Use copies of
            these so that the &'s don't force the real ones into
            memory.  */
+        yy_state_t *yyss1 = yyss;
         YYSTYPE *yyvs1 = yyvs;
-        yytype_int16 *yyss1 = yyss;
 
         /* Each stack pointer address is followed by the size of the
            data in use in that stack, in bytes.  This used to be a
            conditional around just the two extra args, but that might
            be undefined if yyoverflow is a macro.  */
         yyoverflow (YY_("memory exhausted"),
-                    &yyss1, yysize * sizeof (*yyssp),
-                    &yyvs1, yysize * sizeof (*yyvsp),
+                    &yyss1, yysize * YYSIZEOF (*yyssp),
+                    &yyvs1, yysize * YYSIZEOF (*yyvsp),
                     &yystacksize);
-
         yyss = yyss1;
         yyvs = yyvs1;
       }
-#else /* no yyoverflow */
-# ifndef YYSTACK_RELOCATE
-      goto yyexhaustedlab;
-# else
+# else /* defined YYSTACK_RELOCATE */
       /* Extend the stack our own way.  */
       if (YYMAXDEPTH <= yystacksize)
-        goto yyexhaustedlab;
+        YYNOMEM;
       yystacksize *= 2;
       if (YYMAXDEPTH < yystacksize)
         yystacksize = YYMAXDEPTH;
 
       {
-        yytype_int16 *yyss1 = yyss;
+        yy_state_t *yyss1 = yyss;
         union yyalloc *yyptr =
-          (union yyalloc *) YYSTACK_ALLOC (YYSTACK_BYTES (yystacksize));
+          YY_CAST (union yyalloc *,
+                   YYSTACK_ALLOC (YY_CAST (YYSIZE_T, YYSTACK_BYTES (yystacksize))));
         if (! yyptr)
-          goto yyexhaustedlab;
+          YYNOMEM;
         YYSTACK_RELOCATE (yyss_alloc, yyss);
         YYSTACK_RELOCATE (yyvs_alloc, yyvs);
 #  undef YYSTACK_RELOCATE
@@ -2467,30 +2423,31 @@ yyparse (void)
           YYSTACK_FREE (yyss1);
       }
 # endif
-#endif /* no yyoverflow */
 
       yyssp = yyss + yysize - 1;
       yyvsp = yyvs + yysize - 1;
 
-      YYDPRINTF ((stderr, "Stack size increased to %lu\n",
-                  (unsigned long int) yystacksize));
+      YY_IGNORE_USELESS_CAST_BEGIN
+      YYDPRINTF ((stderr, "Stack size increased to %ld\n",
+                  YY_CAST (long, yystacksize)));
+      YY_IGNORE_USELESS_CAST_END
 
       if (yyss + yystacksize - 1 <= yyssp)
         YYABORT;
     }
+#endif /* !defined yyoverflow && !defined YYSTACK_RELOCATE */
 
-  YYDPRINTF ((stderr, "Entering state %d\n", yystate));
 
   if (yystate == YYFINAL)
     YYACCEPT;
 
   goto yybackup;
 
+
 /*-----------.
 | yybackup.  |
 `-----------*/
 yybackup:
-
   /* Do appropriate processing given the current state.  Read a
      lookahead token if we need one and don't already have one.  */
 
@@ -2501,18 +2458,29 @@ yybackup:
 
   /* Not known => get a lookahead token if don't already have one.  */
 
-  /* YYCHAR is either YYEMPTY or YYEOF or a valid lookahead symbol.  */
+  /* YYCHAR is either empty, or end-of-input, or a valid lookahead.  */
   if (yychar == YYEMPTY)
     {
-      YYDPRINTF ((stderr, "Reading a token: "));
+      YYDPRINTF ((stderr, "Reading a token\n"));
       yychar = yylex ();
     }
 
   if (yychar <= YYEOF)
     {
-      yychar = yytoken = YYEOF;
+      yychar = YYEOF;
+      yytoken = YYSYMBOL_YYEOF;
       YYDPRINTF ((stderr, "Now at end of input.\n"));
     }
+  else if (yychar == YYerror)
+    {
+      /* The scanner already issued an error message, process directly
+         to error recovery.  But do not keep the error token as
+         lookahead, it is too special and may lead us to an endless
+         loop in error recovery. */
+      yychar = YYUNDEF;
+      yytoken = YYSYMBOL_YYerror;
+      goto yyerrlab1;
+    }
   else
     {
       yytoken = YYTRANSLATE (yychar);
@@ -2540,15 +2508,13 @@ yybackup:
 
   /* Shift the lookahead token.  */
   YY_SYMBOL_PRINT ("Shifting", yytoken, &yylval, &yylloc);
-
-  /* Discard the shifted token.  */
-  yychar = YYEMPTY;
-
   yystate = yyn;
   YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
   *++yyvsp = yylval;
   YY_IGNORE_MAYBE_UNINITIALIZED_END
 
+  /* Discard the shifted token.  */
+  yychar = YYEMPTY;
   goto yynewstate;
 
 
@@ -2563,7 +2529,7 @@ yydefault:
 
 
 /*-----------------------------.
-| yyreduce -- Do a reduction.  |
+| yyreduce -- do a reduction.  |
 `-----------------------------*/
 yyreduce:
   /* yyn is the number of a rule to reduce with.  */
@@ -2583,17 +2549,17 @@ yyreduce:
   YY_REDUCE_PRINT (yyn);
   switch (yyn)
     {
-        case 14:
-#line 182 "./util/configparser.y" /* yacc.c:1648  */
-    { 
+  case 14: /* serverstart: VAR_SERVER  */
+#line 191 "util/configparser.y"
+        { 
 		OUTYY(("\nP(server:)\n")); 
 	}
-#line 2592 "util/configparser.c" /* yacc.c:1648  */
+#line 2558 "util/configparser.c"
     break;
 
-  case 206:
-#line 273 "./util/configparser.y" /* yacc.c:1648  */
-    {
+  case 229: /* stubstart: VAR_STUB_ZONE  */
+#line 294 "util/configparser.y"
+        {
 		struct config_stub* s;
 		OUTYY(("\nP(stub_zone:)\n")); 
 		s = (struct config_stub*)calloc(1, sizeof(struct config_stub));
@@ -2603,12 +2569,12 @@ yyreduce:
 		} else 
 			yyerror("out of memory");
 	}
-#line 2607 "util/configparser.c" /* yacc.c:1648  */
+#line 2573 "util/configparser.c"
     break;
 
-  case 216:
-#line 290 "./util/configparser.y" /* yacc.c:1648  */
-    {
+  case 239: /* forwardstart: VAR_FORWARD_ZONE  */
+#line 311 "util/configparser.y"
+        {
 		struct config_stub* s;
 		OUTYY(("\nP(forward_zone:)\n")); 
 		s = (struct config_stub*)calloc(1, sizeof(struct config_stub));
@@ -2618,12 +2584,12 @@ yyreduce:
 		} else 
 			yyerror("out of memory");
 	}
-#line 2622 "util/configparser.c" /* yacc.c:1648  */
+#line 2588 "util/configparser.c"
     break;
 
-  case 225:
-#line 307 "./util/configparser.y" /* yacc.c:1648  */
-    {
+  case 248: /* viewstart: VAR_VIEW  */
+#line 328 "util/configparser.y"
+        {
 		struct config_view* s;
 		OUTYY(("\nP(view:)\n")); 
 		s = (struct config_view*)calloc(1, sizeof(struct config_view));
@@ -2635,12 +2601,12 @@ yyreduce:
 		} else 
 			yyerror("out of memory");
 	}
-#line 2639 "util/configparser.c" /* yacc.c:1648  */
+#line 2605 "util/configparser.c"
     break;
 
-  case 235:
-#line 326 "./util/configparser.y" /* yacc.c:1648  */
-    {
+  case 258: /* authstart: VAR_AUTH_ZONE  */
+#line 347 "util/configparser.y"
+        {
 		struct config_auth* s;
 		OUTYY(("\nP(auth_zone:)\n")); 
 		s = (struct config_auth*)calloc(1, sizeof(struct config_auth));
@@ -2654,36 +2620,36 @@ yyreduce:
 		} else 
 			yyerror("out of memory");
 	}
-#line 2658 "util/configparser.c" /* yacc.c:1648  */
+#line 2624 "util/configparser.c"
     break;
 
-  case 246:
-#line 348 "./util/configparser.y" /* yacc.c:1648  */
-    { 
+  case 269: /* server_num_threads: VAR_NUM_THREADS STRING_ARG  */
+#line 369 "util/configparser.y"
+        { 
 		OUTYY(("P(server_num_threads:%s)\n", (yyvsp[0].str))); 
 		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
 			yyerror("number expected");
 		else cfg_parser->cfg->num_threads = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 2670 "util/configparser.c" /* yacc.c:1648  */
+#line 2636 "util/configparser.c"
     break;
 
-  case 247:
-#line 357 "./util/configparser.y" /* yacc.c:1648  */
-    { 
+  case 270: /* server_verbosity: VAR_VERBOSITY STRING_ARG  */
+#line 378 "util/configparser.y"
+        { 
 		OUTYY(("P(server_verbosity:%s)\n", (yyvsp[0].str))); 
 		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
 			yyerror("number expected");
 		else cfg_parser->cfg->verbosity = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 2682 "util/configparser.c" /* yacc.c:1648  */
+#line 2648 "util/configparser.c"
     break;
 
-  case 248:
-#line 366 "./util/configparser.y" /* yacc.c:1648  */
-    { 
+  case 271: /* server_statistics_interval: VAR_STATISTICS_INTERVAL STRING_ARG  */
+#line 387 "util/configparser.y"
+        { 
 		OUTYY(("P(server_statistics_interval:%s)\n", (yyvsp[0].str))); 
 		if(strcmp((yyvsp[0].str), "") == 0 || strcmp((yyvsp[0].str), "0") == 0)
 			cfg_parser->cfg->stat_interval = 0;
@@ -2692,48 +2658,48 @@ yyreduce:
 		else cfg_parser->cfg->stat_interval = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 2696 "util/configparser.c" /* yacc.c:1648  */
+#line 2662 "util/configparser.c"
     break;
 
-  case 249:
-#line 377 "./util/configparser.y" /* yacc.c:1648  */
-    {
+  case 272: /* server_statistics_cumulative: VAR_STATISTICS_CUMULATIVE STRING_ARG  */
+#line 398 "util/configparser.y"
+        {
 		OUTYY(("P(server_statistics_cumulative:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
 		else cfg_parser->cfg->stat_cumulative = (strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 2708 "util/configparser.c" /* yacc.c:1648  */
+#line 2674 "util/configparser.c"
     break;
 
-  case 250:
-#line 386 "./util/configparser.y" /* yacc.c:1648  */
-    {
+  case 273: /* server_extended_statistics: VAR_EXTENDED_STATISTICS STRING_ARG  */
+#line 407 "util/configparser.y"
+        {
 		OUTYY(("P(server_extended_statistics:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
 		else cfg_parser->cfg->stat_extended = (strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 2720 "util/configparser.c" /* yacc.c:1648  */
+#line 2686 "util/configparser.c"
     break;
 
-  case 251:
-#line 395 "./util/configparser.y" /* yacc.c:1648  */
-    {
+  case 274: /* server_shm_enable: VAR_SHM_ENABLE STRING_ARG  */
+#line 416 "util/configparser.y"
+        {
 		OUTYY(("P(server_shm_enable:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
 		else cfg_parser->cfg->shm_enable = (strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 2732 "util/configparser.c" /* yacc.c:1648  */
+#line 2698 "util/configparser.c"
     break;
 
-  case 252:
-#line 404 "./util/configparser.y" /* yacc.c:1648  */
-    { 
+  case 275: /* server_shm_key: VAR_SHM_KEY STRING_ARG  */
+#line 425 "util/configparser.y"
+        { 
 		OUTYY(("P(server_shm_key:%s)\n", (yyvsp[0].str))); 
 		if(strcmp((yyvsp[0].str), "") == 0 || strcmp((yyvsp[0].str), "0") == 0)
 			cfg_parser->cfg->shm_key = 0;
@@ -2742,24 +2708,24 @@ yyreduce:
 		else cfg_parser->cfg->shm_key = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 2746 "util/configparser.c" /* yacc.c:1648  */
+#line 2712 "util/configparser.c"
     break;
 
-  case 253:
-#line 415 "./util/configparser.y" /* yacc.c:1648  */
-    {
+  case 276: /* server_port: VAR_PORT STRING_ARG  */
+#line 436 "util/configparser.y"
+        {
 		OUTYY(("P(server_port:%s)\n", (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0)
 			yyerror("port number expected");
 		else cfg_parser->cfg->port = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 2758 "util/configparser.c" /* yacc.c:1648  */
+#line 2724 "util/configparser.c"
     break;
 
-  case 254:
-#line 424 "./util/configparser.y" /* yacc.c:1648  */
-    {
+  case 277: /* server_send_client_subnet: VAR_SEND_CLIENT_SUBNET STRING_ARG  */
+#line 445 "util/configparser.y"
+        {
 	#ifdef CLIENT_SUBNET
 		OUTYY(("P(server_send_client_subnet:%s)\n", (yyvsp[0].str)));
 		if(!cfg_strlist_insert(&cfg_parser->cfg->client_subnet, (yyvsp[0].str)))
@@ -2768,12 +2734,12 @@ yyreduce:
 		OUTYY(("P(Compiled without edns subnet option, ignoring)\n"));
 	#endif
 	}
-#line 2772 "util/configparser.c" /* yacc.c:1648  */
+#line 2738 "util/configparser.c"
     break;
 
-  case 255:
-#line 435 "./util/configparser.y" /* yacc.c:1648  */
-    {
+  case 278: /* server_client_subnet_zone: VAR_CLIENT_SUBNET_ZONE STRING_ARG  */
+#line 456 "util/configparser.y"
+        {
 	#ifdef CLIENT_SUBNET
 		OUTYY(("P(server_client_subnet_zone:%s)\n", (yyvsp[0].str)));
 		if(!cfg_strlist_insert(&cfg_parser->cfg->client_subnet_zone,
@@ -2783,12 +2749,12 @@ yyreduce:
 		OUTYY(("P(Compiled without edns subnet option, ignoring)\n"));
 	#endif
 	}
-#line 2787 "util/configparser.c" /* yacc.c:1648  */
+#line 2753 "util/configparser.c"
     break;
 
-  case 256:
-#line 448 "./util/configparser.y" /* yacc.c:1648  */
-    {
+  case 279: /* server_client_subnet_always_forward: VAR_CLIENT_SUBNET_ALWAYS_FORWARD STRING_ARG  */
+#line 469 "util/configparser.y"
+        {
 	#ifdef CLIENT_SUBNET
 		OUTYY(("P(server_client_subnet_always_forward:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
@@ -2801,12 +2767,12 @@ yyreduce:
 	#endif
 		free((yyvsp[0].str));
 	}
-#line 2805 "util/configparser.c" /* yacc.c:1648  */
+#line 2771 "util/configparser.c"
     break;
 
-  case 257:
-#line 463 "./util/configparser.y" /* yacc.c:1648  */
-    {
+  case 280: /* server_client_subnet_opcode: VAR_CLIENT_SUBNET_OPCODE STRING_ARG  */
+#line 484 "util/configparser.y"
+        {
 	#ifdef CLIENT_SUBNET
 		OUTYY(("P(client_subnet_opcode:%s)\n", (yyvsp[0].str)));
 		OUTYY(("P(Deprecated option, ignoring)\n"));
@@ -2815,12 +2781,12 @@ yyreduce:
 	#endif
 		free((yyvsp[0].str));
 	}
-#line 2819 "util/configparser.c" /* yacc.c:1648  */
+#line 2785 "util/configparser.c"
     break;
 
-  case 258:
-#line 474 "./util/configparser.y" /* yacc.c:1648  */
-    {
+  case 281: /* server_max_client_subnet_ipv4: VAR_MAX_CLIENT_SUBNET_IPV4 STRING_ARG  */
+#line 495 "util/configparser.y"
+        {
 	#ifdef CLIENT_SUBNET
 		OUTYY(("P(max_client_subnet_ipv4:%s)\n", (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
@@ -2835,12 +2801,12 @@ yyreduce:
 	#endif
 		free((yyvsp[0].str));
 	}
-#line 2839 "util/configparser.c" /* yacc.c:1648  */
+#line 2805 "util/configparser.c"
     break;
 
-  case 259:
-#line 491 "./util/configparser.y" /* yacc.c:1648  */
-    {
+  case 282: /* server_max_client_subnet_ipv6: VAR_MAX_CLIENT_SUBNET_IPV6 STRING_ARG  */
+#line 512 "util/configparser.y"
+        {
 	#ifdef CLIENT_SUBNET
 		OUTYY(("P(max_client_subnet_ipv6:%s)\n", (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
@@ -2855,12 +2821,12 @@ yyreduce:
 	#endif
 		free((yyvsp[0].str));
 	}
-#line 2859 "util/configparser.c" /* yacc.c:1648  */
+#line 2825 "util/configparser.c"
     break;
 
-  case 260:
-#line 508 "./util/configparser.y" /* yacc.c:1648  */
-    {
+  case 283: /* server_min_client_subnet_ipv4: VAR_MIN_CLIENT_SUBNET_IPV4 STRING_ARG  */
+#line 529 "util/configparser.y"
+        {
 	#ifdef CLIENT_SUBNET
 		OUTYY(("P(min_client_subnet_ipv4:%s)\n", (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
@@ -2875,12 +2841,12 @@ yyreduce:
 	#endif
 		free((yyvsp[0].str));
 	}
-#line 2879 "util/configparser.c" /* yacc.c:1648  */
+#line 2845 "util/configparser.c"
     break;
 
-  case 261:
-#line 525 "./util/configparser.y" /* yacc.c:1648  */
-    {
+  case 284: /* server_min_client_subnet_ipv6: VAR_MIN_CLIENT_SUBNET_IPV6 STRING_ARG  */
+#line 546 "util/configparser.y"
+        {
 	#ifdef CLIENT_SUBNET
 		OUTYY(("P(min_client_subnet_ipv6:%s)\n", (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
@@ -2895,12 +2861,12 @@ yyreduce:
 	#endif
 		free((yyvsp[0].str));
 	}
-#line 2899 "util/configparser.c" /* yacc.c:1648  */
+#line 2865 "util/configparser.c"
     break;
 
-  case 262:
-#line 542 "./util/configparser.y" /* yacc.c:1648  */
-    {
+  case 285: /* server_max_ecs_tree_size_ipv4: VAR_MAX_ECS_TREE_SIZE_IPV4 STRING_ARG  */
+#line 563 "util/configparser.y"
+        {
 	#ifdef CLIENT_SUBNET
 		OUTYY(("P(max_ecs_tree_size_ipv4:%s)\n", (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
@@ -2913,12 +2879,12 @@ yyreduce:
 	#endif
 		free((yyvsp[0].str));
 	}
-#line 2917 "util/configparser.c" /* yacc.c:1648  */
+#line 2883 "util/configparser.c"
     break;
 
-  case 263:
-#line 557 "./util/configparser.y" /* yacc.c:1648  */
-    {
+  case 286: /* server_max_ecs_tree_size_ipv6: VAR_MAX_ECS_TREE_SIZE_IPV6 STRING_ARG  */
+#line 578 "util/configparser.y"
+        {
 	#ifdef CLIENT_SUBNET
 		OUTYY(("P(max_ecs_tree_size_ipv6:%s)\n", (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
@@ -2931,12 +2897,12 @@ yyreduce:
 	#endif
 		free((yyvsp[0].str));
 	}
-#line 2935 "util/configparser.c" /* yacc.c:1648  */
+#line 2901 "util/configparser.c"
     break;
 
-  case 264:
-#line 572 "./util/configparser.y" /* yacc.c:1648  */
-    {
+  case 287: /* server_interface: VAR_INTERFACE STRING_ARG  */
+#line 593 "util/configparser.y"
+        {
 		OUTYY(("P(server_interface:%s)\n", (yyvsp[0].str)));
 		if(cfg_parser->cfg->num_ifs == 0)
 			cfg_parser->cfg->ifs = calloc(1, sizeof(char*));
@@ -2947,12 +2913,12 @@ yyreduce:
 		else
 			cfg_parser->cfg->ifs[cfg_parser->cfg->num_ifs++] = (yyvsp[0].str);
 	}
-#line 2951 "util/configparser.c" /* yacc.c:1648  */
+#line 2917 "util/configparser.c"
     break;
 
-  case 265:
-#line 585 "./util/configparser.y" /* yacc.c:1648  */
-    {
+  case 288: /* server_outgoing_interface: VAR_OUTGOING_INTERFACE STRING_ARG  */
+#line 606 "util/configparser.y"
+        {
 		OUTYY(("P(server_outgoing_interface:%s)\n", (yyvsp[0].str)));
 		if(cfg_parser->cfg->num_out_ifs == 0)
 			cfg_parser->cfg->out_ifs = calloc(1, sizeof(char*));
@@ -2965,168 +2931,168 @@ yyreduce:
 			cfg_parser->cfg->out_ifs[
 				cfg_parser->cfg->num_out_ifs++] = (yyvsp[0].str);
 	}
-#line 2969 "util/configparser.c" /* yacc.c:1648  */
+#line 2935 "util/configparser.c"
     break;
 
-  case 266:
-#line 600 "./util/configparser.y" /* yacc.c:1648  */
-    {
+  case 289: /* server_outgoing_range: VAR_OUTGOING_RANGE STRING_ARG  */
+#line 621 "util/configparser.y"
+        {
 		OUTYY(("P(server_outgoing_range:%s)\n", (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0)
 			yyerror("number expected");
 		else cfg_parser->cfg->outgoing_num_ports = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 2981 "util/configparser.c" /* yacc.c:1648  */
+#line 2947 "util/configparser.c"
     break;
 
-  case 267:
-#line 609 "./util/configparser.y" /* yacc.c:1648  */
-    {
+  case 290: /* server_outgoing_port_permit: VAR_OUTGOING_PORT_PERMIT STRING_ARG  */
+#line 630 "util/configparser.y"
+        {
 		OUTYY(("P(server_outgoing_port_permit:%s)\n", (yyvsp[0].str)));
 		if(!cfg_mark_ports((yyvsp[0].str), 1, 
 			cfg_parser->cfg->outgoing_avail_ports, 65536))
 			yyerror("port number or range (\"low-high\") expected");
 		free((yyvsp[0].str));
 	}
-#line 2993 "util/configparser.c" /* yacc.c:1648  */
+#line 2959 "util/configparser.c"
     break;
 
-  case 268:
-#line 618 "./util/configparser.y" /* yacc.c:1648  */
-    {
+  case 291: /* server_outgoing_port_avoid: VAR_OUTGOING_PORT_AVOID STRING_ARG  */
+#line 639 "util/configparser.y"
+        {
 		OUTYY(("P(server_outgoing_port_avoid:%s)\n", (yyvsp[0].str)));
 		if(!cfg_mark_ports((yyvsp[0].str), 0, 
 			cfg_parser->cfg->outgoing_avail_ports, 65536))
 			yyerror("port number or range (\"low-high\") expected");
 		free((yyvsp[0].str));
 	}
-#line 3005 "util/configparser.c" /* yacc.c:1648  */
+#line 2971 "util/configparser.c"
     break;
 
-  case 269:
-#line 627 "./util/configparser.y" /* yacc.c:1648  */
-    {
+  case 292: /* server_outgoing_num_tcp: VAR_OUTGOING_NUM_TCP STRING_ARG  */
+#line 648 "util/configparser.y"
+        {
 		OUTYY(("P(server_outgoing_num_tcp:%s)\n", (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
 			yyerror("number expected");
 		else cfg_parser->cfg->outgoing_num_tcp = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 3017 "util/configparser.c" /* yacc.c:1648  */
+#line 2983 "util/configparser.c"
     break;
 
-  case 270:
-#line 636 "./util/configparser.y" /* yacc.c:1648  */
-    {
+  case 293: /* server_incoming_num_tcp: VAR_INCOMING_NUM_TCP STRING_ARG  */
+#line 657 "util/configparser.y"
+        {
 		OUTYY(("P(server_incoming_num_tcp:%s)\n", (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
 			yyerror("number expected");
 		else cfg_parser->cfg->incoming_num_tcp = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 3029 "util/configparser.c" /* yacc.c:1648  */
+#line 2995 "util/configparser.c"
     break;
 
-  case 271:
-#line 645 "./util/configparser.y" /* yacc.c:1648  */
-    {
+  case 294: /* server_interface_automatic: VAR_INTERFACE_AUTOMATIC STRING_ARG  */
+#line 666 "util/configparser.y"
+        {
 		OUTYY(("P(server_interface_automatic:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
 		else cfg_parser->cfg->if_automatic = (strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 3041 "util/configparser.c" /* yacc.c:1648  */
+#line 3007 "util/configparser.c"
     break;
 
-  case 272:
-#line 654 "./util/configparser.y" /* yacc.c:1648  */
-    {
+  case 295: /* server_do_ip4: VAR_DO_IP4 STRING_ARG  */
+#line 675 "util/configparser.y"
+        {
 		OUTYY(("P(server_do_ip4:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
 		else cfg_parser->cfg->do_ip4 = (strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 3053 "util/configparser.c" /* yacc.c:1648  */
+#line 3019 "util/configparser.c"
     break;
 
-  case 273:
-#line 663 "./util/configparser.y" /* yacc.c:1648  */
-    {
+  case 296: /* server_do_ip6: VAR_DO_IP6 STRING_ARG  */
+#line 684 "util/configparser.y"
+        {
 		OUTYY(("P(server_do_ip6:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
 		else cfg_parser->cfg->do_ip6 = (strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 3065 "util/configparser.c" /* yacc.c:1648  */
+#line 3031 "util/configparser.c"
     break;
 
-  case 274:
-#line 672 "./util/configparser.y" /* yacc.c:1648  */
-    {
+  case 297: /* server_do_udp: VAR_DO_UDP STRING_ARG  */
+#line 693 "util/configparser.y"
+        {
 		OUTYY(("P(server_do_udp:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
 		else cfg_parser->cfg->do_udp = (strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 3077 "util/configparser.c" /* yacc.c:1648  */
+#line 3043 "util/configparser.c"
     break;
 
-  case 275:
-#line 681 "./util/configparser.y" /* yacc.c:1648  */
-    {
+  case 298: /* server_do_tcp: VAR_DO_TCP STRING_ARG  */
+#line 702 "util/configparser.y"
+        {
 		OUTYY(("P(server_do_tcp:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
 		else cfg_parser->cfg->do_tcp = (strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 3089 "util/configparser.c" /* yacc.c:1648  */
+#line 3055 "util/configparser.c"
     break;
 
-  case 276:
-#line 690 "./util/configparser.y" /* yacc.c:1648  */
-    {
+  case 299: /* server_prefer_ip6: VAR_PREFER_IP6 STRING_ARG  */
+#line 711 "util/configparser.y"
+        {
 		OUTYY(("P(server_prefer_ip6:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
 		else cfg_parser->cfg->prefer_ip6 = (strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 3101 "util/configparser.c" /* yacc.c:1648  */
+#line 3067 "util/configparser.c"
     break;
 
-  case 277:
-#line 699 "./util/configparser.y" /* yacc.c:1648  */
-    {
+  case 300: /* server_tcp_mss: VAR_TCP_MSS STRING_ARG  */
+#line 720 "util/configparser.y"
+        {
 		OUTYY(("P(server_tcp_mss:%s)\n", (yyvsp[0].str)));
                 if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
                         yyerror("number expected");
                 else cfg_parser->cfg->tcp_mss = atoi((yyvsp[0].str));
                 free((yyvsp[0].str));
 	}
-#line 3113 "util/configparser.c" /* yacc.c:1648  */
+#line 3079 "util/configparser.c"
     break;
 
-  case 278:
-#line 708 "./util/configparser.y" /* yacc.c:1648  */
-    {
+  case 301: /* server_outgoing_tcp_mss: VAR_OUTGOING_TCP_MSS STRING_ARG  */
+#line 729 "util/configparser.y"
+        {
 		OUTYY(("P(server_outgoing_tcp_mss:%s)\n", (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
 			yyerror("number expected");
 		else cfg_parser->cfg->outgoing_tcp_mss = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 3125 "util/configparser.c" /* yacc.c:1648  */
+#line 3091 "util/configparser.c"
     break;
 
-  case 279:
-#line 717 "./util/configparser.y" /* yacc.c:1648  */
-    {
+  case 302: /* server_tcp_idle_timeout: VAR_TCP_IDLE_TIMEOUT STRING_ARG  */
+#line 738 "util/configparser.y"
+        {
 		OUTYY(("P(server_tcp_idle_timeout:%s)\n", (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
 			yyerror("number expected");
@@ -3137,24 +3103,24 @@ yyreduce:
 		else cfg_parser->cfg->tcp_idle_timeout = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 3141 "util/configparser.c" /* yacc.c:1648  */
+#line 3107 "util/configparser.c"
     break;
 
-  case 280:
-#line 730 "./util/configparser.y" /* yacc.c:1648  */
-    {
+  case 303: /* server_tcp_keepalive: VAR_EDNS_TCP_KEEPALIVE STRING_ARG  */
+#line 751 "util/configparser.y"
+        {
 		OUTYY(("P(server_tcp_keepalive:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
 		else cfg_parser->cfg->do_tcp_keepalive = (strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 3153 "util/configparser.c" /* yacc.c:1648  */
+#line 3119 "util/configparser.c"
     break;
 
-  case 281:
-#line 739 "./util/configparser.y" /* yacc.c:1648  */
-    {
+  case 304: /* server_tcp_keepalive_timeout: VAR_EDNS_TCP_KEEPALIVE_TIMEOUT STRING_ARG  */
+#line 760 "util/configparser.y"
+        {
 		OUTYY(("P(server_tcp_keepalive_timeout:%s)\n", (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
 			yyerror("number expected");
@@ -3165,168 +3131,168 @@ yyreduce:
 		else cfg_parser->cfg->tcp_keepalive_timeout = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 3169 "util/configparser.c" /* yacc.c:1648  */
+#line 3135 "util/configparser.c"
     break;
 
-  case 282:
-#line 752 "./util/configparser.y" /* yacc.c:1648  */
-    {
+  case 305: /* server_tcp_upstream: VAR_TCP_UPSTREAM STRING_ARG  */
+#line 773 "util/configparser.y"
+        {
 		OUTYY(("P(server_tcp_upstream:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
 		else cfg_parser->cfg->tcp_upstream = (strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 3181 "util/configparser.c" /* yacc.c:1648  */
+#line 3147 "util/configparser.c"
     break;
 
-  case 283:
-#line 761 "./util/configparser.y" /* yacc.c:1648  */
-    {
+  case 306: /* server_udp_upstream_without_downstream: VAR_UDP_UPSTREAM_WITHOUT_DOWNSTREAM STRING_ARG  */
+#line 782 "util/configparser.y"
+        {
 		OUTYY(("P(server_udp_upstream_without_downstream:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
 		else cfg_parser->cfg->udp_upstream_without_downstream = (strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 3193 "util/configparser.c" /* yacc.c:1648  */
+#line 3159 "util/configparser.c"
     break;
 
-  case 284:
-#line 770 "./util/configparser.y" /* yacc.c:1648  */
-    {
+  case 307: /* server_ssl_upstream: VAR_SSL_UPSTREAM STRING_ARG  */
+#line 791 "util/configparser.y"
+        {
 		OUTYY(("P(server_ssl_upstream:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
 		else cfg_parser->cfg->ssl_upstream = (strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 3205 "util/configparser.c" /* yacc.c:1648  */
+#line 3171 "util/configparser.c"
     break;
 
-  case 285:
-#line 779 "./util/configparser.y" /* yacc.c:1648  */
-    {
+  case 308: /* server_ssl_service_key: VAR_SSL_SERVICE_KEY STRING_ARG  */
+#line 800 "util/configparser.y"
+        {
 		OUTYY(("P(server_ssl_service_key:%s)\n", (yyvsp[0].str)));
 		free(cfg_parser->cfg->ssl_service_key);
 		cfg_parser->cfg->ssl_service_key = (yyvsp[0].str);
 	}
-#line 3215 "util/configparser.c" /* yacc.c:1648  */
+#line 3181 "util/configparser.c"
     break;
 
-  case 286:
-#line 786 "./util/configparser.y" /* yacc.c:1648  */
-    {
+  case 309: /* server_ssl_service_pem: VAR_SSL_SERVICE_PEM STRING_ARG  */
+#line 807 "util/configparser.y"
+        {
 		OUTYY(("P(server_ssl_service_pem:%s)\n", (yyvsp[0].str)));
 		free(cfg_parser->cfg->ssl_service_pem);
 		cfg_parser->cfg->ssl_service_pem = (yyvsp[0].str);
 	}
-#line 3225 "util/configparser.c" /* yacc.c:1648  */
+#line 3191 "util/configparser.c"
     break;
 
-  case 287:
-#line 793 "./util/configparser.y" /* yacc.c:1648  */
-    {
+  case 310: /* server_ssl_port: VAR_SSL_PORT STRING_ARG  */
+#line 814 "util/configparser.y"
+        {
 		OUTYY(("P(server_ssl_port:%s)\n", (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0)
 			yyerror("port number expected");
 		else cfg_parser->cfg->ssl_port = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 3237 "util/configparser.c" /* yacc.c:1648  */
+#line 3203 "util/configparser.c"
     break;
 
-  case 288:
-#line 802 "./util/configparser.y" /* yacc.c:1648  */
-    {
+  case 311: /* server_tls_cert_bundle: VAR_TLS_CERT_BUNDLE STRING_ARG  */
+#line 823 "util/configparser.y"
+        {
 		OUTYY(("P(server_tls_cert_bundle:%s)\n", (yyvsp[0].str)));
 		free(cfg_parser->cfg->tls_cert_bundle);
 		cfg_parser->cfg->tls_cert_bundle = (yyvsp[0].str);
 	}
-#line 3247 "util/configparser.c" /* yacc.c:1648  */
+#line 3213 "util/configparser.c"
     break;
 
-  case 289:
-#line 809 "./util/configparser.y" /* yacc.c:1648  */
-    {
+  case 312: /* server_tls_win_cert: VAR_TLS_WIN_CERT STRING_ARG  */
+#line 830 "util/configparser.y"
+        {
 		OUTYY(("P(server_tls_win_cert:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
 		else cfg_parser->cfg->tls_win_cert = (strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 3259 "util/configparser.c" /* yacc.c:1648  */
+#line 3225 "util/configparser.c"
     break;
 
-  case 290:
-#line 818 "./util/configparser.y" /* yacc.c:1648  */
-    {
+  case 313: /* server_tls_additional_port: VAR_TLS_ADDITIONAL_PORT STRING_ARG  */
+#line 839 "util/configparser.y"
+        {
 		OUTYY(("P(server_tls_additional_port:%s)\n", (yyvsp[0].str)));
 		if(!cfg_strlist_insert(&cfg_parser->cfg->tls_additional_port,
 			(yyvsp[0].str)))
 			yyerror("out of memory");
 	}
-#line 3270 "util/configparser.c" /* yacc.c:1648  */
+#line 3236 "util/configparser.c"
     break;
 
-  case 291:
-#line 826 "./util/configparser.y" /* yacc.c:1648  */
-    {
+  case 314: /* server_tls_ciphers: VAR_TLS_CIPHERS STRING_ARG  */
+#line 847 "util/configparser.y"
+        {
 		OUTYY(("P(server_tls_ciphers:%s)\n", (yyvsp[0].str)));
 		free(cfg_parser->cfg->tls_ciphers);
 		cfg_parser->cfg->tls_ciphers = (yyvsp[0].str);
 	}
-#line 3280 "util/configparser.c" /* yacc.c:1648  */
+#line 3246 "util/configparser.c"
     break;
 
-  case 292:
-#line 833 "./util/configparser.y" /* yacc.c:1648  */
-    {
+  case 315: /* server_tls_ciphersuites: VAR_TLS_CIPHERSUITES STRING_ARG  */
+#line 854 "util/configparser.y"
+        {
 		OUTYY(("P(server_tls_ciphersuites:%s)\n", (yyvsp[0].str)));
 		free(cfg_parser->cfg->tls_ciphersuites);
 		cfg_parser->cfg->tls_ciphersuites = (yyvsp[0].str);
 	}
-#line 3290 "util/configparser.c" /* yacc.c:1648  */
+#line 3256 "util/configparser.c"
     break;
 
-  case 293:
-#line 840 "./util/configparser.y" /* yacc.c:1648  */
-    {
+  case 316: /* server_tls_session_ticket_keys: VAR_TLS_SESSION_TICKET_KEYS STRING_ARG  */
+#line 861 "util/configparser.y"
+        {
 		OUTYY(("P(server_tls_session_ticket_keys:%s)\n", (yyvsp[0].str)));
 		if(!cfg_strlist_append(&cfg_parser->cfg->tls_session_ticket_keys,
 			(yyvsp[0].str)))
 			yyerror("out of memory");
 	}
-#line 3301 "util/configparser.c" /* yacc.c:1648  */
+#line 3267 "util/configparser.c"
     break;
 
-  case 294:
-#line 848 "./util/configparser.y" /* yacc.c:1648  */
-    {
+  case 317: /* server_use_systemd: VAR_USE_SYSTEMD STRING_ARG  */
+#line 869 "util/configparser.y"
+        {
 		OUTYY(("P(server_use_systemd:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
 		else cfg_parser->cfg->use_systemd = (strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 3313 "util/configparser.c" /* yacc.c:1648  */
+#line 3279 "util/configparser.c"
     break;
 
-  case 295:
-#line 857 "./util/configparser.y" /* yacc.c:1648  */
-    {
+  case 318: /* server_do_daemonize: VAR_DO_DAEMONIZE STRING_ARG  */
+#line 878 "util/configparser.y"
+        {
 		OUTYY(("P(server_do_daemonize:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
 		else cfg_parser->cfg->do_daemonize = (strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 3325 "util/configparser.c" /* yacc.c:1648  */
+#line 3291 "util/configparser.c"
     break;
 
-  case 296:
-#line 866 "./util/configparser.y" /* yacc.c:1648  */
-    {
+  case 319: /* server_use_syslog: VAR_USE_SYSLOG STRING_ARG  */
+#line 887 "util/configparser.y"
+        {
 		OUTYY(("P(server_use_syslog:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
@@ -3338,104 +3304,104 @@ yyreduce:
 #endif
 		free((yyvsp[0].str));
 	}
-#line 3342 "util/configparser.c" /* yacc.c:1648  */
+#line 3308 "util/configparser.c"
     break;
 
-  case 297:
-#line 880 "./util/configparser.y" /* yacc.c:1648  */
-    {
+  case 320: /* server_log_time_ascii: VAR_LOG_TIME_ASCII STRING_ARG  */
+#line 901 "util/configparser.y"
+        {
 		OUTYY(("P(server_log_time_ascii:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
 		else cfg_parser->cfg->log_time_ascii = (strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 3354 "util/configparser.c" /* yacc.c:1648  */
+#line 3320 "util/configparser.c"
     break;
 
-  case 298:
-#line 889 "./util/configparser.y" /* yacc.c:1648  */
-    {
+  case 321: /* server_log_queries: VAR_LOG_QUERIES STRING_ARG  */
+#line 910 "util/configparser.y"
+        {
 		OUTYY(("P(server_log_queries:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
 		else cfg_parser->cfg->log_queries = (strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 3366 "util/configparser.c" /* yacc.c:1648  */
+#line 3332 "util/configparser.c"
     break;
 
-  case 299:
-#line 898 "./util/configparser.y" /* yacc.c:1648  */
-    {
+  case 322: /* server_log_replies: VAR_LOG_REPLIES STRING_ARG  */
+#line 919 "util/configparser.y"
+  {
   	OUTYY(("P(server_log_replies:%s)\n", (yyvsp[0].str)));
   	if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
   		yyerror("expected yes or no.");
   	else cfg_parser->cfg->log_replies = (strcmp((yyvsp[0].str), "yes")==0);
   	free((yyvsp[0].str));
   }
-#line 3378 "util/configparser.c" /* yacc.c:1648  */
+#line 3344 "util/configparser.c"
     break;
 
-  case 300:
-#line 907 "./util/configparser.y" /* yacc.c:1648  */
-    {
+  case 323: /* server_log_tag_queryreply: VAR_LOG_TAG_QUERYREPLY STRING_ARG  */
+#line 928 "util/configparser.y"
+  {
   	OUTYY(("P(server_log_tag_queryreply:%s)\n", (yyvsp[0].str)));
   	if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
   		yyerror("expected yes or no.");
   	else cfg_parser->cfg->log_tag_queryreply = (strcmp((yyvsp[0].str), "yes")==0);
   	free((yyvsp[0].str));
   }
-#line 3390 "util/configparser.c" /* yacc.c:1648  */
+#line 3356 "util/configparser.c"
     break;
 
-  case 301:
-#line 916 "./util/configparser.y" /* yacc.c:1648  */
-    {
+  case 324: /* server_log_servfail: VAR_LOG_SERVFAIL STRING_ARG  */
+#line 937 "util/configparser.y"
+        {
 		OUTYY(("P(server_log_servfail:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
 		else cfg_parser->cfg->log_servfail = (strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 3402 "util/configparser.c" /* yacc.c:1648  */
+#line 3368 "util/configparser.c"
     break;
 
-  case 302:
-#line 925 "./util/configparser.y" /* yacc.c:1648  */
-    {
+  case 325: /* server_log_local_actions: VAR_LOG_LOCAL_ACTIONS STRING_ARG  */
+#line 946 "util/configparser.y"
+  {
   	OUTYY(("P(server_log_local_actions:%s)\n", (yyvsp[0].str)));
   	if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
   		yyerror("expected yes or no.");
   	else cfg_parser->cfg->log_local_actions = (strcmp((yyvsp[0].str), "yes")==0);
   	free((yyvsp[0].str));
   }
-#line 3414 "util/configparser.c" /* yacc.c:1648  */
+#line 3380 "util/configparser.c"
     break;
 
-  case 303:
-#line 934 "./util/configparser.y" /* yacc.c:1648  */
-    {
+  case 326: /* server_chroot: VAR_CHROOT STRING_ARG  */
+#line 955 "util/configparser.y"
+        {
 		OUTYY(("P(server_chroot:%s)\n", (yyvsp[0].str)));
 		free(cfg_parser->cfg->chrootdir);
 		cfg_parser->cfg->chrootdir = (yyvsp[0].str);
 	}
-#line 3424 "util/configparser.c" /* yacc.c:1648  */
+#line 3390 "util/configparser.c"
     break;
 
-  case 304:
-#line 941 "./util/configparser.y" /* yacc.c:1648  */
-    {
+  case 327: /* server_username: VAR_USERNAME STRING_ARG  */
+#line 962 "util/configparser.y"
+        {
 		OUTYY(("P(server_username:%s)\n", (yyvsp[0].str)));
 		free(cfg_parser->cfg->username);
 		cfg_parser->cfg->username = (yyvsp[0].str);
 	}
-#line 3434 "util/configparser.c" /* yacc.c:1648  */
+#line 3400 "util/configparser.c"
     break;
 
-  case 305:
-#line 948 "./util/configparser.y" /* yacc.c:1648  */
-    {
+  case 328: /* server_directory: VAR_DIRECTORY STRING_ARG  */
+#line 969 "util/configparser.y"
+        {
 		OUTYY(("P(server_directory:%s)\n", (yyvsp[0].str)));
 		free(cfg_parser->cfg->directory);
 		cfg_parser->cfg->directory = (yyvsp[0].str);
@@ -3459,106 +3425,106 @@ yyreduce:
 			}
 		}
 	}
-#line 3463 "util/configparser.c" /* yacc.c:1648  */
+#line 3429 "util/configparser.c"
     break;
 
-  case 306:
-#line 974 "./util/configparser.y" /* yacc.c:1648  */
-    {
+  case 329: /* server_logfile: VAR_LOGFILE STRING_ARG  */
+#line 995 "util/configparser.y"
+        {
 		OUTYY(("P(server_logfile:%s)\n", (yyvsp[0].str)));
 		free(cfg_parser->cfg->logfile);
 		cfg_parser->cfg->logfile = (yyvsp[0].str);
 		cfg_parser->cfg->use_syslog = 0;
 	}
-#line 3474 "util/configparser.c" /* yacc.c:1648  */
+#line 3440 "util/configparser.c"
     break;
 
-  case 307:
-#line 982 "./util/configparser.y" /* yacc.c:1648  */
-    {
+  case 330: /* server_pidfile: VAR_PIDFILE STRING_ARG  */
+#line 1003 "util/configparser.y"
+        {
 		OUTYY(("P(server_pidfile:%s)\n", (yyvsp[0].str)));
 		free(cfg_parser->cfg->pidfile);
 		cfg_parser->cfg->pidfile = (yyvsp[0].str);
 	}
-#line 3484 "util/configparser.c" /* yacc.c:1648  */
+#line 3450 "util/configparser.c"
     break;
 
-  case 308:
-#line 989 "./util/configparser.y" /* yacc.c:1648  */
-    {
+  case 331: /* server_root_hints: VAR_ROOT_HINTS STRING_ARG  */
+#line 1010 "util/configparser.y"
+        {
 		OUTYY(("P(server_root_hints:%s)\n", (yyvsp[0].str)));
 		if(!cfg_strlist_insert(&cfg_parser->cfg->root_hints, (yyvsp[0].str)))
 			yyerror("out of memory");
 	}
-#line 3494 "util/configparser.c" /* yacc.c:1648  */
+#line 3460 "util/configparser.c"
     break;
 
-  case 309:
-#line 996 "./util/configparser.y" /* yacc.c:1648  */
-    {
+  case 332: /* server_dlv_anchor_file: VAR_DLV_ANCHOR_FILE STRING_ARG  */
+#line 1017 "util/configparser.y"
+        {
 		OUTYY(("P(server_dlv_anchor_file:%s)\n", (yyvsp[0].str)));
 		free(cfg_parser->cfg->dlv_anchor_file);
 		cfg_parser->cfg->dlv_anchor_file = (yyvsp[0].str);
 	}
-#line 3504 "util/configparser.c" /* yacc.c:1648  */
+#line 3470 "util/configparser.c"
     break;
 
-  case 310:
-#line 1003 "./util/configparser.y" /* yacc.c:1648  */
-    {
+  case 333: /* server_dlv_anchor: VAR_DLV_ANCHOR STRING_ARG  */
+#line 1024 "util/configparser.y"
+        {
 		OUTYY(("P(server_dlv_anchor:%s)\n", (yyvsp[0].str)));
 		if(!cfg_strlist_insert(&cfg_parser->cfg->dlv_anchor_list, (yyvsp[0].str)))
 			yyerror("out of memory");
 	}
-#line 3514 "util/configparser.c" /* yacc.c:1648  */
+#line 3480 "util/configparser.c"
     break;
 
-  case 311:
-#line 1010 "./util/configparser.y" /* yacc.c:1648  */
-    {
+  case 334: /* server_auto_trust_anchor_file: VAR_AUTO_TRUST_ANCHOR_FILE STRING_ARG  */
+#line 1031 "util/configparser.y"
+        {
 		OUTYY(("P(server_auto_trust_anchor_file:%s)\n", (yyvsp[0].str)));
 		if(!cfg_strlist_insert(&cfg_parser->cfg->
 			auto_trust_anchor_file_list, (yyvsp[0].str)))
 			yyerror("out of memory");
 	}
-#line 3525 "util/configparser.c" /* yacc.c:1648  */
+#line 3491 "util/configparser.c"
     break;
 
-  case 312:
-#line 1018 "./util/configparser.y" /* yacc.c:1648  */
-    {
+  case 335: /* server_trust_anchor_file: VAR_TRUST_ANCHOR_FILE STRING_ARG  */
+#line 1039 "util/configparser.y"
+        {
 		OUTYY(("P(server_trust_anchor_file:%s)\n", (yyvsp[0].str)));
 		if(!cfg_strlist_insert(&cfg_parser->cfg->
 			trust_anchor_file_list, (yyvsp[0].str)))
 			yyerror("out of memory");
 	}
-#line 3536 "util/configparser.c" /* yacc.c:1648  */
+#line 3502 "util/configparser.c"
     break;
 
-  case 313:
-#line 1026 "./util/configparser.y" /* yacc.c:1648  */
-    {
+  case 336: /* server_trusted_keys_file: VAR_TRUSTED_KEYS_FILE STRING_ARG  */
+#line 1047 "util/configparser.y"
+        {
 		OUTYY(("P(server_trusted_keys_file:%s)\n", (yyvsp[0].str)));
 		if(!cfg_strlist_insert(&cfg_parser->cfg->
 			trusted_keys_file_list, (yyvsp[0].str)))
 			yyerror("out of memory");
 	}
-#line 3547 "util/configparser.c" /* yacc.c:1648  */
+#line 3513 "util/configparser.c"
     break;
 
-  case 314:
-#line 1034 "./util/configparser.y" /* yacc.c:1648  */
-    {
+  case 337: /* server_trust_anchor: VAR_TRUST_ANCHOR STRING_ARG  */
+#line 1055 "util/configparser.y"
+        {
 		OUTYY(("P(server_trust_anchor:%s)\n", (yyvsp[0].str)));
 		if(!cfg_strlist_insert(&cfg_parser->cfg->trust_anchor_list, (yyvsp[0].str)))
 			yyerror("out of memory");
 	}
-#line 3557 "util/configparser.c" /* yacc.c:1648  */
+#line 3523 "util/configparser.c"
     break;
 
-  case 315:
-#line 1041 "./util/configparser.y" /* yacc.c:1648  */
-    {
+  case 338: /* server_trust_anchor_signaling: VAR_TRUST_ANCHOR_SIGNALING STRING_ARG  */
+#line 1062 "util/configparser.y"
+        {
 		OUTYY(("P(server_trust_anchor_signaling:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
@@ -3567,12 +3533,12 @@ yyreduce:
 				(strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 3571 "util/configparser.c" /* yacc.c:1648  */
+#line 3537 "util/configparser.c"
     break;
 
-  case 316:
-#line 1052 "./util/configparser.y" /* yacc.c:1648  */
-    {
+  case 339: /* server_root_key_sentinel: VAR_ROOT_KEY_SENTINEL STRING_ARG  */
+#line 1073 "util/configparser.y"
+        {
 		OUTYY(("P(server_root_key_sentinel:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
@@ -3581,99 +3547,99 @@ yyreduce:
 				(strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 3585 "util/configparser.c" /* yacc.c:1648  */
+#line 3551 "util/configparser.c"
     break;
 
-  case 317:
-#line 1063 "./util/configparser.y" /* yacc.c:1648  */
-    {
+  case 340: /* server_domain_insecure: VAR_DOMAIN_INSECURE STRING_ARG  */
+#line 1084 "util/configparser.y"
+        {
 		OUTYY(("P(server_domain_insecure:%s)\n", (yyvsp[0].str)));
 		if(!cfg_strlist_insert(&cfg_parser->cfg->domain_insecure, (yyvsp[0].str)))
 			yyerror("out of memory");
 	}
-#line 3595 "util/configparser.c" /* yacc.c:1648  */
+#line 3561 "util/configparser.c"
     break;
 
-  case 318:
-#line 1070 "./util/configparser.y" /* yacc.c:1648  */
-    {
+  case 341: /* server_hide_identity: VAR_HIDE_IDENTITY STRING_ARG  */
+#line 1091 "util/configparser.y"
+        {
 		OUTYY(("P(server_hide_identity:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
 		else cfg_parser->cfg->hide_identity = (strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 3607 "util/configparser.c" /* yacc.c:1648  */
+#line 3573 "util/configparser.c"
     break;
 
-  case 319:
-#line 1079 "./util/configparser.y" /* yacc.c:1648  */
-    {
+  case 342: /* server_hide_version: VAR_HIDE_VERSION STRING_ARG  */
+#line 1100 "util/configparser.y"
+        {
 		OUTYY(("P(server_hide_version:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
 		else cfg_parser->cfg->hide_version = (strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 3619 "util/configparser.c" /* yacc.c:1648  */
+#line 3585 "util/configparser.c"
     break;
 
-  case 320:
-#line 1088 "./util/configparser.y" /* yacc.c:1648  */
-    {
+  case 343: /* server_hide_trustanchor: VAR_HIDE_TRUSTANCHOR STRING_ARG  */
+#line 1109 "util/configparser.y"
+        {
 		OUTYY(("P(server_hide_trustanchor:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
 		else cfg_parser->cfg->hide_trustanchor = (strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 3631 "util/configparser.c" /* yacc.c:1648  */
+#line 3597 "util/configparser.c"
     break;
 
-  case 321:
-#line 1097 "./util/configparser.y" /* yacc.c:1648  */
-    {
+  case 344: /* server_identity: VAR_IDENTITY STRING_ARG  */
+#line 1118 "util/configparser.y"
+        {
 		OUTYY(("P(server_identity:%s)\n", (yyvsp[0].str)));
 		free(cfg_parser->cfg->identity);
 		cfg_parser->cfg->identity = (yyvsp[0].str);
 	}
-#line 3641 "util/configparser.c" /* yacc.c:1648  */
+#line 3607 "util/configparser.c"
     break;
 
-  case 322:
-#line 1104 "./util/configparser.y" /* yacc.c:1648  */
-    {
+  case 345: /* server_version: VAR_VERSION STRING_ARG  */
+#line 1125 "util/configparser.y"
+        {
 		OUTYY(("P(server_version:%s)\n", (yyvsp[0].str)));
 		free(cfg_parser->cfg->version);
 		cfg_parser->cfg->version = (yyvsp[0].str);
 	}
-#line 3651 "util/configparser.c" /* yacc.c:1648  */
+#line 3617 "util/configparser.c"
     break;
 
-  case 323:
-#line 1111 "./util/configparser.y" /* yacc.c:1648  */
-    {
+  case 346: /* server_so_rcvbuf: VAR_SO_RCVBUF STRING_ARG  */
+#line 1132 "util/configparser.y"
+        {
 		OUTYY(("P(server_so_rcvbuf:%s)\n", (yyvsp[0].str)));
 		if(!cfg_parse_memsize((yyvsp[0].str), &cfg_parser->cfg->so_rcvbuf))
 			yyerror("buffer size expected");
 		free((yyvsp[0].str));
 	}
-#line 3662 "util/configparser.c" /* yacc.c:1648  */
+#line 3628 "util/configparser.c"
     break;
 
-  case 324:
-#line 1119 "./util/configparser.y" /* yacc.c:1648  */
-    {
+  case 347: /* server_so_sndbuf: VAR_SO_SNDBUF STRING_ARG  */
+#line 1140 "util/configparser.y"
+        {
 		OUTYY(("P(server_so_sndbuf:%s)\n", (yyvsp[0].str)));
 		if(!cfg_parse_memsize((yyvsp[0].str), &cfg_parser->cfg->so_sndbuf))
 			yyerror("buffer size expected");
 		free((yyvsp[0].str));
 	}
-#line 3673 "util/configparser.c" /* yacc.c:1648  */
+#line 3639 "util/configparser.c"
     break;
 
-  case 325:
-#line 1127 "./util/configparser.y" /* yacc.c:1648  */
+  case 348: /* server_so_reuseport: VAR_SO_REUSEPORT STRING_ARG  */
+#line 1148 "util/configparser.y"
     {
         OUTYY(("P(server_so_reuseport:%s)\n", (yyvsp[0].str)));
         if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
@@ -3682,11 +3648,11 @@ yyreduce:
             (strcmp((yyvsp[0].str), "yes")==0);
         free((yyvsp[0].str));
     }
-#line 3686 "util/configparser.c" /* yacc.c:1648  */
+#line 3652 "util/configparser.c"
     break;
 
-  case 326:
-#line 1137 "./util/configparser.y" /* yacc.c:1648  */
+  case 349: /* server_ip_transparent: VAR_IP_TRANSPARENT STRING_ARG  */
+#line 1158 "util/configparser.y"
     {
         OUTYY(("P(server_ip_transparent:%s)\n", (yyvsp[0].str)));
         if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
@@ -3695,11 +3661,11 @@ yyreduce:
             (strcmp((yyvsp[0].str), "yes")==0);
         free((yyvsp[0].str));
     }
-#line 3699 "util/configparser.c" /* yacc.c:1648  */
+#line 3665 "util/configparser.c"
     break;
 
-  case 327:
-#line 1147 "./util/configparser.y" /* yacc.c:1648  */
+  case 350: /* server_ip_freebind: VAR_IP_FREEBIND STRING_ARG  */
+#line 1168 "util/configparser.y"
     {
         OUTYY(("P(server_ip_freebind:%s)\n", (yyvsp[0].str)));
         if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
@@ -3708,23 +3674,23 @@ yyreduce:
             (strcmp((yyvsp[0].str), "yes")==0);
         free((yyvsp[0].str));
     }
-#line 3712 "util/configparser.c" /* yacc.c:1648  */
+#line 3678 "util/configparser.c"
     break;
 
-  case 328:
-#line 1157 "./util/configparser.y" /* yacc.c:1648  */
-    {
+  case 351: /* server_stream_wait_size: VAR_STREAM_WAIT_SIZE STRING_ARG  */
+#line 1178 "util/configparser.y"
+        {
 		OUTYY(("P(server_stream_wait_size:%s)\n", (yyvsp[0].str)));
 		if(!cfg_parse_memsize((yyvsp[0].str), &cfg_parser->cfg->stream_wait_size))
 			yyerror("memory size expected");
 		free((yyvsp[0].str));
 	}
-#line 3723 "util/configparser.c" /* yacc.c:1648  */
+#line 3689 "util/configparser.c"
     break;
 
-  case 329:
-#line 1165 "./util/configparser.y" /* yacc.c:1648  */
-    {
+  case 352: /* server_edns_buffer_size: VAR_EDNS_BUFFER_SIZE STRING_ARG  */
+#line 1186 "util/configparser.y"
+        {
 		OUTYY(("P(server_edns_buffer_size:%s)\n", (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0)
 			yyerror("number expected");
@@ -3735,12 +3701,12 @@ yyreduce:
 		else cfg_parser->cfg->edns_buffer_size = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 3739 "util/configparser.c" /* yacc.c:1648  */
+#line 3705 "util/configparser.c"
     break;
 
-  case 330:
-#line 1178 "./util/configparser.y" /* yacc.c:1648  */
-    {
+  case 353: /* server_msg_buffer_size: VAR_MSG_BUFFER_SIZE STRING_ARG  */
+#line 1199 "util/configparser.y"
+        {
 		OUTYY(("P(server_msg_buffer_size:%s)\n", (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0)
 			yyerror("number expected");
@@ -3749,23 +3715,23 @@ yyreduce:
 		else cfg_parser->cfg->msg_buffer_size = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 3753 "util/configparser.c" /* yacc.c:1648  */
+#line 3719 "util/configparser.c"
     break;
 
-  case 331:
-#line 1189 "./util/configparser.y" /* yacc.c:1648  */
-    {
+  case 354: /* server_msg_cache_size: VAR_MSG_CACHE_SIZE STRING_ARG  */
+#line 1210 "util/configparser.y"
+        {
 		OUTYY(("P(server_msg_cache_size:%s)\n", (yyvsp[0].str)));
 		if(!cfg_parse_memsize((yyvsp[0].str), &cfg_parser->cfg->msg_cache_size))
 			yyerror("memory size expected");
 		free((yyvsp[0].str));
 	}
-#line 3764 "util/configparser.c" /* yacc.c:1648  */
+#line 3730 "util/configparser.c"
     break;
 
-  case 332:
-#line 1197 "./util/configparser.y" /* yacc.c:1648  */
-    {
+  case 355: /* server_msg_cache_slabs: VAR_MSG_CACHE_SLABS STRING_ARG  */
+#line 1218 "util/configparser.y"
+        {
 		OUTYY(("P(server_msg_cache_slabs:%s)\n", (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0)
 			yyerror("number expected");
@@ -3776,48 +3742,152 @@ yyreduce:
 		}
 		free((yyvsp[0].str));
 	}
-#line 3780 "util/configparser.c" /* yacc.c:1648  */
+#line 3746 "util/configparser.c"
     break;
 
-  case 333:
-#line 1210 "./util/configparser.y" /* yacc.c:1648  */
-    {
+  case 356: /* server_num_queries_per_thread: VAR_NUM_QUERIES_PER_THREAD STRING_ARG  */
+#line 1231 "util/configparser.y"
+        {
 		OUTYY(("P(server_num_queries_per_thread:%s)\n", (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0)
 			yyerror("number expected");
 		else cfg_parser->cfg->num_queries_per_thread = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 3792 "util/configparser.c" /* yacc.c:1648  */
+#line 3758 "util/configparser.c"
     break;
 
-  case 334:
-#line 1219 "./util/configparser.y" /* yacc.c:1648  */
-    {
+  case 357: /* server_jostle_timeout: VAR_JOSTLE_TIMEOUT STRING_ARG  */
+#line 1240 "util/configparser.y"
+        {
 		OUTYY(("P(server_jostle_timeout:%s)\n", (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
 			yyerror("number expected");
 		else cfg_parser->cfg->jostle_time = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 3804 "util/configparser.c" /* yacc.c:1648  */
+#line 3770 "util/configparser.c"
     break;
 
-  case 335:
-#line 1228 "./util/configparser.y" /* yacc.c:1648  */
-    {
+  case 358: /* server_mesh_class_weight: VAR_MESH_CLASS_WEIGHT STRING_ARG  */
+#line 1249 "util/configparser.y"
+        {
+		OUTYY(("P(server_mesh_class_weight:%s)\n", (yyvsp[0].str)));
+		free(cfg_parser->cfg->mesh_class_weight);
+		cfg_parser->cfg->mesh_class_weight = (yyvsp[0].str);
+	}
+#line 3780 "util/configparser.c"
+    break;
+
+  case 359: /* server_mesh_class_limit: VAR_MESH_CLASS_LIMIT STRING_ARG  */
+#line 1256 "util/configparser.y"
+        {
+		OUTYY(("P(server_mesh_class_limit:%s)\n", (yyvsp[0].str)));
+		free(cfg_parser->cfg->mesh_class_limit);
+		cfg_parser->cfg->mesh_class_limit = (yyvsp[0].str);
+	}
+#line 3790 "util/configparser.c"
+    break;
+
+  case 360: /* server_trace_sample_rate: VAR_TRACE_SAMPLE_RATE STRING_ARG  */
+#line 1263 "util/configparser.y"
+        {
+		OUTYY(("P(server_trace_sample_rate:%s)\n", (yyvsp[0].str)));
+		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
+			yyerror("number expected");
+		else if(atoi((yyvsp[0].str)) < 0)
+			yyerror("positive number expected");
+		else cfg_parser->cfg->trace_sample_rate = atoi((yyvsp[0].str));
+		free((yyvsp[0].str));
+	}
+#line 3804 "util/configparser.c"
+    break;
+
+  case 361: /* server_trace_slow_threshold: VAR_TRACE_SLOW_THRESHOLD STRING_ARG  */
+#line 1274 "util/configparser.y"
+        {
+		OUTYY(("P(server_trace_slow_threshold:%s)\n", (yyvsp[0].str)));
+		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
+			yyerror("number expected");
+		else if(atoi((yyvsp[0].str)) < 0)
+			yyerror("positive number expected");
+		else cfg_parser->cfg->trace_slow_threshold = atoi((yyvsp[0].str));
+		free((yyvsp[0].str));
+	}
+#line 3818 "util/configparser.c"
+    break;
+
+  case 362: /* server_work_stealing: VAR_WORK_STEALING STRING_ARG  */
+#line 1285 "util/configparser.y"
+        {
+		OUTYY(("P(server_work_stealing:%s)\n", (yyvsp[0].str)));
+		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
+			yyerror("expected yes or no.");
+		else cfg_parser->cfg->work_stealing = (strcmp((yyvsp[0].str), "yes")==0);
+		free((yyvsp[0].str));
+	}
+#line 3830 "util/configparser.c"
+    break;
+
+  case 363: /* server_mesh_fair_share: VAR_MESH_FAIR_SHARE STRING_ARG  */
+#line 1294 "util/configparser.y"
+        {
+		OUTYY(("P(server_mesh_fair_share:%s)\n", (yyvsp[0].str)));
+		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
+			yyerror("expected yes or no.");
+		else cfg_parser->cfg->mesh_fair_share = (strcmp((yyvsp[0].str), "yes")==0);
+		free((yyvsp[0].str));
+	}
+#line 3842 "util/configparser.c"
+    break;
+
+  case 364: /* server_mesh_fair_share_prefix4: VAR_MESH_FAIR_SHARE_PREFIX4 STRING_ARG  */
+#line 1303 "util/configparser.y"
+        {
+		OUTYY(("P(server_mesh_fair_share_prefix4:%s)\n", (yyvsp[0].str)));
+		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
+			yyerror("IPv4 prefix length expected");
+		else if(atoi((yyvsp[0].str)) > 32)
+			cfg_parser->cfg->mesh_fair_share_prefix4 = 32;
+		else if(atoi((yyvsp[0].str)) < 0)
+			cfg_parser->cfg->mesh_fair_share_prefix4 = 0;
+		else cfg_parser->cfg->mesh_fair_share_prefix4 = atoi((yyvsp[0].str));
+		free((yyvsp[0].str));
+	}
+#line 3858 "util/configparser.c"
+    break;
+
+  case 365: /* server_mesh_fair_share_prefix6: VAR_MESH_FAIR_SHARE_PREFIX6 STRING_ARG  */
+#line 1316 "util/configparser.y"
+        {
+		OUTYY(("P(server_mesh_fair_share_prefix6:%s)\n", (yyvsp[0].str)));
+		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
+			yyerror("IPv6 prefix length expected");
+		else if(atoi((yyvsp[0].str)) > 128)
+			cfg_parser->cfg->mesh_fair_share_prefix6 = 128;
+		else if(atoi((yyvsp[0].str)) < 0)
+			cfg_parser->cfg->mesh_fair_share_prefix6 = 0;
+		else cfg_parser->cfg->mesh_fair_share_prefix6 = atoi((yyvsp[0].str));
+		free((yyvsp[0].str));
+	}
+#line 3874 "util/configparser.c"
+    break;
+
+  case 366: /* server_delay_close: VAR_DELAY_CLOSE STRING_ARG  */
+#line 1329 "util/configparser.y"
+        {
 		OUTYY(("P(server_delay_close:%s)\n", (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
 			yyerror("number expected");
 		else cfg_parser->cfg->delay_close = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 3816 "util/configparser.c" /* yacc.c:1648  */
+#line 3886 "util/configparser.c"
     break;
 
-  case 336:
-#line 1237 "./util/configparser.y" /* yacc.c:1648  */
-    {
+  case 367: /* server_unblock_lan_zones: VAR_UNBLOCK_LAN_ZONES STRING_ARG  */
+#line 1338 "util/configparser.y"
+        {
 		OUTYY(("P(server_unblock_lan_zones:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
@@ -3825,12 +3895,12 @@ yyreduce:
 			(strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 3829 "util/configparser.c" /* yacc.c:1648  */
+#line 3899 "util/configparser.c"
     break;
 
-  case 337:
-#line 1247 "./util/configparser.y" /* yacc.c:1648  */
-    {
+  case 368: /* server_insecure_lan_zones: VAR_INSECURE_LAN_ZONES STRING_ARG  */
+#line 1348 "util/configparser.y"
+        {
 		OUTYY(("P(server_insecure_lan_zones:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
@@ -3838,23 +3908,23 @@ yyreduce:
 			(strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 3842 "util/configparser.c" /* yacc.c:1648  */
+#line 3912 "util/configparser.c"
     break;
 
-  case 338:
-#line 1257 "./util/configparser.y" /* yacc.c:1648  */
-    {
+  case 369: /* server_rrset_cache_size: VAR_RRSET_CACHE_SIZE STRING_ARG  */
+#line 1358 "util/configparser.y"
+        {
 		OUTYY(("P(server_rrset_cache_size:%s)\n", (yyvsp[0].str)));
 		if(!cfg_parse_memsize((yyvsp[0].str), &cfg_parser->cfg->rrset_cache_size))
 			yyerror("memory size expected");
 		free((yyvsp[0].str));
 	}
-#line 3853 "util/configparser.c" /* yacc.c:1648  */
+#line 3923 "util/configparser.c"
     break;
 
-  case 339:
-#line 1265 "./util/configparser.y" /* yacc.c:1648  */
-    {
+  case 370: /* server_rrset_cache_slabs: VAR_RRSET_CACHE_SLABS STRING_ARG  */
+#line 1366 "util/configparser.y"
+        {
 		OUTYY(("P(server_rrset_cache_slabs:%s)\n", (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0)
 			yyerror("number expected");
@@ -3865,58 +3935,58 @@ yyreduce:
 		}
 		free((yyvsp[0].str));
 	}
-#line 3869 "util/configparser.c" /* yacc.c:1648  */
+#line 3939 "util/configparser.c"
     break;
 
-  case 340:
-#line 1278 "./util/configparser.y" /* yacc.c:1648  */
-    {
+  case 371: /* server_infra_host_ttl: VAR_INFRA_HOST_TTL STRING_ARG  */
+#line 1379 "util/configparser.y"
+        {
 		OUTYY(("P(server_infra_host_ttl:%s)\n", (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
 			yyerror("number expected");
 		else cfg_parser->cfg->host_ttl = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 3881 "util/configparser.c" /* yacc.c:1648  */
+#line 3951 "util/configparser.c"
     break;
 
-  case 341:
-#line 1287 "./util/configparser.y" /* yacc.c:1648  */
-    {
+  case 372: /* server_infra_lame_ttl: VAR_INFRA_LAME_TTL STRING_ARG  */
+#line 1388 "util/configparser.y"
+        {
 		OUTYY(("P(server_infra_lame_ttl:%s)\n", (yyvsp[0].str)));
 		verbose(VERB_DETAIL, "ignored infra-lame-ttl: %s (option "
 			"removed, use infra-host-ttl)", (yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 3892 "util/configparser.c" /* yacc.c:1648  */
+#line 3962 "util/configparser.c"
     break;
 
-  case 342:
-#line 1295 "./util/configparser.y" /* yacc.c:1648  */
-    {
+  case 373: /* server_infra_cache_numhosts: VAR_INFRA_CACHE_NUMHOSTS STRING_ARG  */
+#line 1396 "util/configparser.y"
+        {
 		OUTYY(("P(server_infra_cache_numhosts:%s)\n", (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0)
 			yyerror("number expected");
 		else cfg_parser->cfg->infra_cache_numhosts = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 3904 "util/configparser.c" /* yacc.c:1648  */
+#line 3974 "util/configparser.c"
     break;
 
-  case 343:
-#line 1304 "./util/configparser.y" /* yacc.c:1648  */
-    {
+  case 374: /* server_infra_cache_lame_size: VAR_INFRA_CACHE_LAME_SIZE STRING_ARG  */
+#line 1405 "util/configparser.y"
+        {
 		OUTYY(("P(server_infra_cache_lame_size:%s)\n", (yyvsp[0].str)));
 		verbose(VERB_DETAIL, "ignored infra-cache-lame-size: %s "
 			"(option removed, use infra-cache-numhosts)", (yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 3915 "util/configparser.c" /* yacc.c:1648  */
+#line 3985 "util/configparser.c"
     break;
 
-  case 344:
-#line 1312 "./util/configparser.y" /* yacc.c:1648  */
-    {
+  case 375: /* server_infra_cache_slabs: VAR_INFRA_CACHE_SLABS STRING_ARG  */
+#line 1413 "util/configparser.y"
+        {
 		OUTYY(("P(server_infra_cache_slabs:%s)\n", (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0)
 			yyerror("number expected");
@@ -3927,34 +3997,59 @@ yyreduce:
 		}
 		free((yyvsp[0].str));
 	}
-#line 3931 "util/configparser.c" /* yacc.c:1648  */
+#line 4001 "util/configparser.c"
     break;
 
-  case 345:
-#line 1325 "./util/configparser.y" /* yacc.c:1648  */
-    {
+  case 376: /* server_infra_cache_min_rtt: VAR_INFRA_CACHE_MIN_RTT STRING_ARG  */
+#line 1426 "util/configparser.y"
+        {
 		OUTYY(("P(server_infra_cache_min_rtt:%s)\n", (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
 			yyerror("number expected");
 		else cfg_parser->cfg->infra_cache_min_rtt = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 3943 "util/configparser.c" /* yacc.c:1648  */
+#line 4013 "util/configparser.c"
     break;
 
-  case 346:
-#line 1334 "./util/configparser.y" /* yacc.c:1648  */
-    {
+  case 377: /* server_infra_cache_rtt_percentile: VAR_INFRA_CACHE_RTT_PERCENTILE STRING_ARG  */
+#line 1435 "util/configparser.y"
+        {
+		OUTYY(("P(server_infra_cache_rtt_percentile:%s)\n", (yyvsp[0].str)));
+		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
+			yyerror("expected yes or no.");
+		else cfg_parser->cfg->infra_cache_rtt_percentile =
+			(strcmp((yyvsp[0].str), "yes")==0);
+		free((yyvsp[0].str));
+	}
+#line 4026 "util/configparser.c"
+    break;
+
+  case 378: /* server_target_fetch_policy: VAR_TARGET_FETCH_POLICY STRING_ARG  */
+#line 1445 "util/configparser.y"
+        {
 		OUTYY(("P(server_target_fetch_policy:%s)\n", (yyvsp[0].str)));
 		free(cfg_parser->cfg->target_fetch_policy);
 		cfg_parser->cfg->target_fetch_policy = (yyvsp[0].str);
 	}
-#line 3953 "util/configparser.c" /* yacc.c:1648  */
+#line 4036 "util/configparser.c"
     break;
 
-  case 347:
-#line 1341 "./util/configparser.y" /* yacc.c:1648  */
-    {
+  case 379: /* server_target_fetch_parallel: VAR_TARGET_FETCH_PARALLEL STRING_ARG  */
+#line 1452 "util/configparser.y"
+        {
+		OUTYY(("P(server_target_fetch_parallel:%s)\n", (yyvsp[0].str)));
+		if(atoi((yyvsp[0].str)) <= 0)
+			yyerror("positive number expected");
+		else cfg_parser->cfg->target_fetch_parallel = atoi((yyvsp[0].str));
+		free((yyvsp[0].str));
+	}
+#line 4048 "util/configparser.c"
+    break;
+
+  case 380: /* server_harden_short_bufsize: VAR_HARDEN_SHORT_BUFSIZE STRING_ARG  */
+#line 1461 "util/configparser.y"
+        {
 		OUTYY(("P(server_harden_short_bufsize:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
@@ -3962,12 +4057,12 @@ yyreduce:
 			(strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 3966 "util/configparser.c" /* yacc.c:1648  */
+#line 4061 "util/configparser.c"
     break;
 
-  case 348:
-#line 1351 "./util/configparser.y" /* yacc.c:1648  */
-    {
+  case 381: /* server_harden_large_queries: VAR_HARDEN_LARGE_QUERIES STRING_ARG  */
+#line 1471 "util/configparser.y"
+        {
 		OUTYY(("P(server_harden_large_queries:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
@@ -3975,12 +4070,12 @@ yyreduce:
 			(strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 3979 "util/configparser.c" /* yacc.c:1648  */
+#line 4074 "util/configparser.c"
     break;
 
-  case 349:
-#line 1361 "./util/configparser.y" /* yacc.c:1648  */
-    {
+  case 382: /* server_harden_glue: VAR_HARDEN_GLUE STRING_ARG  */
+#line 1481 "util/configparser.y"
+        {
 		OUTYY(("P(server_harden_glue:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
@@ -3988,12 +4083,12 @@ yyreduce:
 			(strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 3992 "util/configparser.c" /* yacc.c:1648  */
+#line 4087 "util/configparser.c"
     break;
 
-  case 350:
-#line 1371 "./util/configparser.y" /* yacc.c:1648  */
-    {
+  case 383: /* server_harden_dnssec_stripped: VAR_HARDEN_DNSSEC_STRIPPED STRING_ARG  */
+#line 1491 "util/configparser.y"
+        {
 		OUTYY(("P(server_harden_dnssec_stripped:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
@@ -4001,12 +4096,12 @@ yyreduce:
 			(strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 4005 "util/configparser.c" /* yacc.c:1648  */
+#line 4100 "util/configparser.c"
     break;
 
-  case 351:
-#line 1381 "./util/configparser.y" /* yacc.c:1648  */
-    {
+  case 384: /* server_harden_below_nxdomain: VAR_HARDEN_BELOW_NXDOMAIN STRING_ARG  */
+#line 1501 "util/configparser.y"
+        {
 		OUTYY(("P(server_harden_below_nxdomain:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
@@ -4014,12 +4109,12 @@ yyreduce:
 			(strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 4018 "util/configparser.c" /* yacc.c:1648  */
+#line 4113 "util/configparser.c"
     break;
 
-  case 352:
-#line 1391 "./util/configparser.y" /* yacc.c:1648  */
-    {
+  case 385: /* server_harden_referral_path: VAR_HARDEN_REFERRAL_PATH STRING_ARG  */
+#line 1511 "util/configparser.y"
+        {
 		OUTYY(("P(server_harden_referral_path:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
@@ -4027,12 +4122,12 @@ yyreduce:
 			(strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 4031 "util/configparser.c" /* yacc.c:1648  */
+#line 4126 "util/configparser.c"
     break;
 
-  case 353:
-#line 1401 "./util/configparser.y" /* yacc.c:1648  */
-    {
+  case 386: /* server_harden_algo_downgrade: VAR_HARDEN_ALGO_DOWNGRADE STRING_ARG  */
+#line 1521 "util/configparser.y"
+        {
 		OUTYY(("P(server_harden_algo_downgrade:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
@@ -4040,12 +4135,12 @@ yyreduce:
 			(strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 4044 "util/configparser.c" /* yacc.c:1648  */
+#line 4139 "util/configparser.c"
     break;
 
-  case 354:
-#line 1411 "./util/configparser.y" /* yacc.c:1648  */
-    {
+  case 387: /* server_use_caps_for_id: VAR_USE_CAPS_FOR_ID STRING_ARG  */
+#line 1531 "util/configparser.y"
+        {
 		OUTYY(("P(server_use_caps_for_id:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
@@ -4053,100 +4148,136 @@ yyreduce:
 			(strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 4057 "util/configparser.c" /* yacc.c:1648  */
+#line 4152 "util/configparser.c"
     break;
 
-  case 355:
-#line 1421 "./util/configparser.y" /* yacc.c:1648  */
-    {
+  case 388: /* server_caps_whitelist: VAR_CAPS_WHITELIST STRING_ARG  */
+#line 1541 "util/configparser.y"
+        {
 		OUTYY(("P(server_caps_whitelist:%s)\n", (yyvsp[0].str)));
 		if(!cfg_strlist_insert(&cfg_parser->cfg->caps_whitelist, (yyvsp[0].str)))
 			yyerror("out of memory");
 	}
-#line 4067 "util/configparser.c" /* yacc.c:1648  */
+#line 4162 "util/configparser.c"
     break;
 
-  case 356:
-#line 1428 "./util/configparser.y" /* yacc.c:1648  */
-    {
+  case 389: /* server_private_address: VAR_PRIVATE_ADDRESS STRING_ARG  */
+#line 1548 "util/configparser.y"
+        {
 		OUTYY(("P(server_private_address:%s)\n", (yyvsp[0].str)));
 		if(!cfg_strlist_insert(&cfg_parser->cfg->private_address, (yyvsp[0].str)))
 			yyerror("out of memory");
 	}
-#line 4077 "util/configparser.c" /* yacc.c:1648  */
+#line 4172 "util/configparser.c"
     break;
 
-  case 357:
-#line 1435 "./util/configparser.y" /* yacc.c:1648  */
-    {
+  case 390: /* server_private_domain: VAR_PRIVATE_DOMAIN STRING_ARG  */
+#line 1555 "util/configparser.y"
+        {
 		OUTYY(("P(server_private_domain:%s)\n", (yyvsp[0].str)));
 		if(!cfg_strlist_insert(&cfg_parser->cfg->private_domain, (yyvsp[0].str)))
 			yyerror("out of memory");
 	}
-#line 4087 "util/configparser.c" /* yacc.c:1648  */
+#line 4182 "util/configparser.c"
     break;
 
-  case 358:
-#line 1442 "./util/configparser.y" /* yacc.c:1648  */
-    {
+  case 391: /* server_prefetch: VAR_PREFETCH STRING_ARG  */
+#line 1562 "util/configparser.y"
+        {
 		OUTYY(("P(server_prefetch:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
 		else cfg_parser->cfg->prefetch = (strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 4099 "util/configparser.c" /* yacc.c:1648  */
+#line 4194 "util/configparser.c"
     break;
 
-  case 359:
-#line 1451 "./util/configparser.y" /* yacc.c:1648  */
-    {
+  case 392: /* server_prefetch_key: VAR_PREFETCH_KEY STRING_ARG  */
+#line 1571 "util/configparser.y"
+        {
 		OUTYY(("P(server_prefetch_key:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
 		else cfg_parser->cfg->prefetch_key = (strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 4111 "util/configparser.c" /* yacc.c:1648  */
+#line 4206 "util/configparser.c"
     break;
 
-  case 360:
-#line 1460 "./util/configparser.y" /* yacc.c:1648  */
-    {
+  case 393: /* server_refresh_popular: VAR_REFRESH_POPULAR STRING_ARG  */
+#line 1580 "util/configparser.y"
+        {
+		OUTYY(("P(server_refresh_popular:%s)\n", (yyvsp[0].str)));
+		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
+			yyerror("expected yes or no.");
+		else cfg_parser->cfg->refresh_popular = (strcmp((yyvsp[0].str), "yes")==0);
+		free((yyvsp[0].str));
+	}
+#line 4218 "util/configparser.c"
+    break;
+
+  case 394: /* server_refresh_popular_rate: VAR_REFRESH_POPULAR_RATE STRING_ARG  */
+#line 1589 "util/configparser.y"
+        {
+		OUTYY(("P(server_refresh_popular_rate:%s)\n", (yyvsp[0].str)));
+		if(atoi((yyvsp[0].str)) <= 0)
+			yyerror("positive number expected");
+		else cfg_parser->cfg->refresh_popular_rate = atoi((yyvsp[0].str));
+		free((yyvsp[0].str));
+	}
+#line 4230 "util/configparser.c"
+    break;
+
+  case 395: /* server_refresh_popular_size: VAR_REFRESH_POPULAR_SIZE STRING_ARG  */
+#line 1598 "util/configparser.y"
+        {
+		OUTYY(("P(server_refresh_popular_size:%s)\n", (yyvsp[0].str)));
+		if(atoi((yyvsp[0].str)) <= 0)
+			yyerror("positive number expected");
+		else cfg_parser->cfg->refresh_popular_size = (size_t)atoi((yyvsp[0].str));
+		free((yyvsp[0].str));
+	}
+#line 4242 "util/configparser.c"
+    break;
+
+  case 396: /* server_deny_any: VAR_DENY_ANY STRING_ARG  */
+#line 1607 "util/configparser.y"
+        {
 		OUTYY(("P(server_deny_any:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
 		else cfg_parser->cfg->deny_any = (strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 4123 "util/configparser.c" /* yacc.c:1648  */
+#line 4254 "util/configparser.c"
     break;
 
-  case 361:
-#line 1469 "./util/configparser.y" /* yacc.c:1648  */
-    {
+  case 397: /* server_unwanted_reply_threshold: VAR_UNWANTED_REPLY_THRESHOLD STRING_ARG  */
+#line 1616 "util/configparser.y"
+        {
 		OUTYY(("P(server_unwanted_reply_threshold:%s)\n", (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
 			yyerror("number expected");
 		else cfg_parser->cfg->unwanted_threshold = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 4135 "util/configparser.c" /* yacc.c:1648  */
+#line 4266 "util/configparser.c"
     break;
 
-  case 362:
-#line 1478 "./util/configparser.y" /* yacc.c:1648  */
-    {
+  case 398: /* server_do_not_query_address: VAR_DO_NOT_QUERY_ADDRESS STRING_ARG  */
+#line 1625 "util/configparser.y"
+        {
 		OUTYY(("P(server_do_not_query_address:%s)\n", (yyvsp[0].str)));
 		if(!cfg_strlist_insert(&cfg_parser->cfg->donotqueryaddrs, (yyvsp[0].str)))
 			yyerror("out of memory");
 	}
-#line 4145 "util/configparser.c" /* yacc.c:1648  */
+#line 4276 "util/configparser.c"
     break;
 
-  case 363:
-#line 1485 "./util/configparser.y" /* yacc.c:1648  */
-    {
+  case 399: /* server_do_not_query_localhost: VAR_DO_NOT_QUERY_LOCALHOST STRING_ARG  */
+#line 1632 "util/configparser.y"
+        {
 		OUTYY(("P(server_do_not_query_localhost:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
@@ -4154,12 +4285,12 @@ yyreduce:
 			(strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 4158 "util/configparser.c" /* yacc.c:1648  */
+#line 4289 "util/configparser.c"
     break;
 
-  case 364:
-#line 1495 "./util/configparser.y" /* yacc.c:1648  */
-    {
+  case 400: /* server_access_control: VAR_ACCESS_CONTROL STRING_ARG STRING_ARG  */
+#line 1642 "util/configparser.y"
+        {
 		OUTYY(("P(server_access_control:%s %s)\n", (yyvsp[-1].str), (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "deny")!=0 && strcmp((yyvsp[0].str), "refuse")!=0 &&
 			strcmp((yyvsp[0].str), "deny_non_local")!=0 &&
@@ -4177,22 +4308,22 @@ yyreduce:
 				fatal_exit("out of memory adding acl");
 		}
 	}
-#line 4181 "util/configparser.c" /* yacc.c:1648  */
+#line 4312 "util/configparser.c"
     break;
 
-  case 365:
-#line 1515 "./util/configparser.y" /* yacc.c:1648  */
-    {
+  case 401: /* server_module_conf: VAR_MODULE_CONF STRING_ARG  */
+#line 1662 "util/configparser.y"
+        {
 		OUTYY(("P(server_module_conf:%s)\n", (yyvsp[0].str)));
 		free(cfg_parser->cfg->module_conf);
 		cfg_parser->cfg->module_conf = (yyvsp[0].str);
 	}
-#line 4191 "util/configparser.c" /* yacc.c:1648  */
+#line 4322 "util/configparser.c"
     break;
 
-  case 366:
-#line 1522 "./util/configparser.y" /* yacc.c:1648  */
-    {
+  case 402: /* server_val_override_date: VAR_VAL_OVERRIDE_DATE STRING_ARG  */
+#line 1669 "util/configparser.y"
+        {
 		OUTYY(("P(server_val_override_date:%s)\n", (yyvsp[0].str)));
 		if(*(yyvsp[0].str) == '\0' || strcmp((yyvsp[0].str), "0") == 0) {
 			cfg_parser->cfg->val_date_override = 0;
@@ -4208,12 +4339,12 @@ yyreduce:
 		}
 		free((yyvsp[0].str));
 	}
-#line 4212 "util/configparser.c" /* yacc.c:1648  */
+#line 4343 "util/configparser.c"
     break;
 
-  case 367:
-#line 1540 "./util/configparser.y" /* yacc.c:1648  */
-    {
+  case 403: /* server_val_sig_skew_min: VAR_VAL_SIG_SKEW_MIN STRING_ARG  */
+#line 1687 "util/configparser.y"
+        {
 		OUTYY(("P(server_val_sig_skew_min:%s)\n", (yyvsp[0].str)));
 		if(*(yyvsp[0].str) == '\0' || strcmp((yyvsp[0].str), "0") == 0) {
 			cfg_parser->cfg->val_sig_skew_min = 0;
@@ -4224,12 +4355,12 @@ yyreduce:
 		}
 		free((yyvsp[0].str));
 	}
-#line 4228 "util/configparser.c" /* yacc.c:1648  */
+#line 4359 "util/configparser.c"
     break;
 
-  case 368:
-#line 1553 "./util/configparser.y" /* yacc.c:1648  */
-    {
+  case 404: /* server_val_sig_skew_max: VAR_VAL_SIG_SKEW_MAX STRING_ARG  */
+#line 1700 "util/configparser.y"
+        {
 		OUTYY(("P(server_val_sig_skew_max:%s)\n", (yyvsp[0].str)));
 		if(*(yyvsp[0].str) == '\0' || strcmp((yyvsp[0].str), "0") == 0) {
 			cfg_parser->cfg->val_sig_skew_max = 0;
@@ -4240,60 +4371,60 @@ yyreduce:
 		}
 		free((yyvsp[0].str));
 	}
-#line 4244 "util/configparser.c" /* yacc.c:1648  */
+#line 4375 "util/configparser.c"
     break;
 
-  case 369:
-#line 1566 "./util/configparser.y" /* yacc.c:1648  */
-    {
+  case 405: /* server_cache_max_ttl: VAR_CACHE_MAX_TTL STRING_ARG  */
+#line 1713 "util/configparser.y"
+        {
 		OUTYY(("P(server_cache_max_ttl:%s)\n", (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
 			yyerror("number expected");
 		else cfg_parser->cfg->max_ttl = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 4256 "util/configparser.c" /* yacc.c:1648  */
+#line 4387 "util/configparser.c"
     break;
 
-  case 370:
-#line 1575 "./util/configparser.y" /* yacc.c:1648  */
-    {
+  case 406: /* server_cache_max_negative_ttl: VAR_CACHE_MAX_NEGATIVE_TTL STRING_ARG  */
+#line 1722 "util/configparser.y"
+        {
 		OUTYY(("P(server_cache_max_negative_ttl:%s)\n", (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
 			yyerror("number expected");
 		else cfg_parser->cfg->max_negative_ttl = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 4268 "util/configparser.c" /* yacc.c:1648  */
+#line 4399 "util/configparser.c"
     break;
 
-  case 371:
-#line 1584 "./util/configparser.y" /* yacc.c:1648  */
-    {
+  case 407: /* server_cache_min_ttl: VAR_CACHE_MIN_TTL STRING_ARG  */
+#line 1731 "util/configparser.y"
+        {
 		OUTYY(("P(server_cache_min_ttl:%s)\n", (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
 			yyerror("number expected");
 		else cfg_parser->cfg->min_ttl = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 4280 "util/configparser.c" /* yacc.c:1648  */
+#line 4411 "util/configparser.c"
     break;
 
-  case 372:
-#line 1593 "./util/configparser.y" /* yacc.c:1648  */
-    {
+  case 408: /* server_bogus_ttl: VAR_BOGUS_TTL STRING_ARG  */
+#line 1740 "util/configparser.y"
+        {
 		OUTYY(("P(server_bogus_ttl:%s)\n", (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
 			yyerror("number expected");
 		else cfg_parser->cfg->bogus_ttl = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 4292 "util/configparser.c" /* yacc.c:1648  */
+#line 4423 "util/configparser.c"
     break;
 
-  case 373:
-#line 1602 "./util/configparser.y" /* yacc.c:1648  */
-    {
+  case 409: /* server_val_clean_additional: VAR_VAL_CLEAN_ADDITIONAL STRING_ARG  */
+#line 1749 "util/configparser.y"
+        {
 		OUTYY(("P(server_val_clean_additional:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
@@ -4301,12 +4432,12 @@ yyreduce:
 			(strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 4305 "util/configparser.c" /* yacc.c:1648  */
+#line 4436 "util/configparser.c"
     break;
 
-  case 374:
-#line 1612 "./util/configparser.y" /* yacc.c:1648  */
-    {
+  case 410: /* server_val_permissive_mode: VAR_VAL_PERMISSIVE_MODE STRING_ARG  */
+#line 1759 "util/configparser.y"
+        {
 		OUTYY(("P(server_val_permissive_mode:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
@@ -4314,12 +4445,12 @@ yyreduce:
 			(strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 4318 "util/configparser.c" /* yacc.c:1648  */
+#line 4449 "util/configparser.c"
     break;
 
-  case 375:
-#line 1622 "./util/configparser.y" /* yacc.c:1648  */
-    {
+  case 411: /* server_aggressive_nsec: VAR_AGGRESSIVE_NSEC STRING_ARG  */
+#line 1769 "util/configparser.y"
+        {
 		OUTYY(("P(server_aggressive_nsec:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
@@ -4328,60 +4459,86 @@ yyreduce:
 				(strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 4332 "util/configparser.c" /* yacc.c:1648  */
+#line 4463 "util/configparser.c"
     break;
 
-  case 376:
-#line 1633 "./util/configparser.y" /* yacc.c:1648  */
-    {
+  case 412: /* server_synth_insecure_dname: VAR_SYNTH_INSECURE_DNAME STRING_ARG  */
+#line 1780 "util/configparser.y"
+        {
+		OUTYY(("P(server_synth_insecure_dname:%s)\n", (yyvsp[0].str)));
+		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
+			yyerror("expected yes or no.");
+		else
+			cfg_parser->cfg->synth_insecure_dname =
+				(strcmp((yyvsp[0].str), "yes")==0);
+		free((yyvsp[0].str));
+	}
+#line 4477 "util/configparser.c"
+    break;
+
+  case 413: /* server_ignore_cd_flag: VAR_IGNORE_CD_FLAG STRING_ARG  */
+#line 1791 "util/configparser.y"
+        {
 		OUTYY(("P(server_ignore_cd_flag:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
 		else cfg_parser->cfg->ignore_cd = (strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 4344 "util/configparser.c" /* yacc.c:1648  */
+#line 4489 "util/configparser.c"
     break;
 
-  case 377:
-#line 1642 "./util/configparser.y" /* yacc.c:1648  */
-    {
+  case 414: /* server_serve_expired: VAR_SERVE_EXPIRED STRING_ARG  */
+#line 1800 "util/configparser.y"
+        {
 		OUTYY(("P(server_serve_expired:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
 		else cfg_parser->cfg->serve_expired = (strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 4356 "util/configparser.c" /* yacc.c:1648  */
+#line 4501 "util/configparser.c"
     break;
 
-  case 378:
-#line 1651 "./util/configparser.y" /* yacc.c:1648  */
-    {
+  case 415: /* server_serve_expired_ttl: VAR_SERVE_EXPIRED_TTL STRING_ARG  */
+#line 1809 "util/configparser.y"
+        {
 		OUTYY(("P(server_serve_expired_ttl:%s)\n", (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
 			yyerror("number expected");
 		else cfg_parser->cfg->serve_expired_ttl = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 4368 "util/configparser.c" /* yacc.c:1648  */
+#line 4513 "util/configparser.c"
     break;
 
-  case 379:
-#line 1660 "./util/configparser.y" /* yacc.c:1648  */
-    {
+  case 416: /* server_serve_expired_ttl_reset: VAR_SERVE_EXPIRED_TTL_RESET STRING_ARG  */
+#line 1818 "util/configparser.y"
+        {
 		OUTYY(("P(server_serve_expired_ttl_reset:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
 		else cfg_parser->cfg->serve_expired_ttl_reset = (strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 4380 "util/configparser.c" /* yacc.c:1648  */
+#line 4525 "util/configparser.c"
     break;
 
-  case 380:
-#line 1669 "./util/configparser.y" /* yacc.c:1648  */
-    {
+  case 417: /* server_serve_expired_client_timeout: VAR_SERVE_EXPIRED_CLIENT_TIMEOUT STRING_ARG  */
+#line 1827 "util/configparser.y"
+        {
+		OUTYY(("P(server_serve_expired_client_timeout:%s)\n", (yyvsp[0].str)));
+		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
+			yyerror("number expected");
+		else cfg_parser->cfg->serve_expired_client_timeout = atoi((yyvsp[0].str));
+		free((yyvsp[0].str));
+	}
+#line 4537 "util/configparser.c"
+    break;
+
+  case 418: /* server_fake_dsa: VAR_FAKE_DSA STRING_ARG  */
+#line 1836 "util/configparser.y"
+        {
 		OUTYY(("P(server_fake_dsa:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
@@ -4392,12 +4549,12 @@ yyreduce:
 #endif
 		free((yyvsp[0].str));
 	}
-#line 4396 "util/configparser.c" /* yacc.c:1648  */
+#line 4553 "util/configparser.c"
     break;
 
-  case 381:
-#line 1682 "./util/configparser.y" /* yacc.c:1648  */
-    {
+  case 419: /* server_fake_sha1: VAR_FAKE_SHA1 STRING_ARG  */
+#line 1849 "util/configparser.y"
+        {
 		OUTYY(("P(server_fake_sha1:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
@@ -4408,70 +4565,70 @@ yyreduce:
 #endif
 		free((yyvsp[0].str));
 	}
-#line 4412 "util/configparser.c" /* yacc.c:1648  */
+#line 4569 "util/configparser.c"
     break;
 
-  case 382:
-#line 1695 "./util/configparser.y" /* yacc.c:1648  */
-    {
+  case 420: /* server_val_log_level: VAR_VAL_LOG_LEVEL STRING_ARG  */
+#line 1862 "util/configparser.y"
+        {
 		OUTYY(("P(server_val_log_level:%s)\n", (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
 			yyerror("number expected");
 		else cfg_parser->cfg->val_log_level = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 4424 "util/configparser.c" /* yacc.c:1648  */
+#line 4581 "util/configparser.c"
     break;
 
-  case 383:
-#line 1704 "./util/configparser.y" /* yacc.c:1648  */
-    {
+  case 421: /* server_val_nsec3_keysize_iterations: VAR_VAL_NSEC3_KEYSIZE_ITERATIONS STRING_ARG  */
+#line 1871 "util/configparser.y"
+        {
 		OUTYY(("P(server_val_nsec3_keysize_iterations:%s)\n", (yyvsp[0].str)));
 		free(cfg_parser->cfg->val_nsec3_key_iterations);
 		cfg_parser->cfg->val_nsec3_key_iterations = (yyvsp[0].str);
 	}
-#line 4434 "util/configparser.c" /* yacc.c:1648  */
+#line 4591 "util/configparser.c"
     break;
 
-  case 384:
-#line 1711 "./util/configparser.y" /* yacc.c:1648  */
-    {
+  case 422: /* server_add_holddown: VAR_ADD_HOLDDOWN STRING_ARG  */
+#line 1878 "util/configparser.y"
+        {
 		OUTYY(("P(server_add_holddown:%s)\n", (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
 			yyerror("number expected");
 		else cfg_parser->cfg->add_holddown = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 4446 "util/configparser.c" /* yacc.c:1648  */
+#line 4603 "util/configparser.c"
     break;
 
-  case 385:
-#line 1720 "./util/configparser.y" /* yacc.c:1648  */
-    {
+  case 423: /* server_del_holddown: VAR_DEL_HOLDDOWN STRING_ARG  */
+#line 1887 "util/configparser.y"
+        {
 		OUTYY(("P(server_del_holddown:%s)\n", (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
 			yyerror("number expected");
 		else cfg_parser->cfg->del_holddown = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 4458 "util/configparser.c" /* yacc.c:1648  */
+#line 4615 "util/configparser.c"
     break;
 
-  case 386:
-#line 1729 "./util/configparser.y" /* yacc.c:1648  */
-    {
+  case 424: /* server_keep_missing: VAR_KEEP_MISSING STRING_ARG  */
+#line 1896 "util/configparser.y"
+        {
 		OUTYY(("P(server_keep_missing:%s)\n", (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
 			yyerror("number expected");
 		else cfg_parser->cfg->keep_missing = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 4470 "util/configparser.c" /* yacc.c:1648  */
+#line 4627 "util/configparser.c"
     break;
 
-  case 387:
-#line 1738 "./util/configparser.y" /* yacc.c:1648  */
-    {
+  case 425: /* server_permit_small_holddown: VAR_PERMIT_SMALL_HOLDDOWN STRING_ARG  */
+#line 1905 "util/configparser.y"
+        {
 		OUTYY(("P(server_permit_small_holddown:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
@@ -4479,23 +4636,23 @@ yyreduce:
 			(strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 4483 "util/configparser.c" /* yacc.c:1648  */
+#line 4640 "util/configparser.c"
     break;
 
-  case 388:
-#line 1747 "./util/configparser.y" /* yacc.c:1648  */
-    {
+  case 426: /* server_key_cache_size: VAR_KEY_CACHE_SIZE STRING_ARG  */
+#line 1914 "util/configparser.y"
+        {
 		OUTYY(("P(server_key_cache_size:%s)\n", (yyvsp[0].str)));
 		if(!cfg_parse_memsize((yyvsp[0].str), &cfg_parser->cfg->key_cache_size))
 			yyerror("memory size expected");
 		free((yyvsp[0].str));
 	}
-#line 4494 "util/configparser.c" /* yacc.c:1648  */
+#line 4651 "util/configparser.c"
     break;
 
-  case 389:
-#line 1755 "./util/configparser.y" /* yacc.c:1648  */
-    {
+  case 427: /* server_key_cache_slabs: VAR_KEY_CACHE_SLABS STRING_ARG  */
+#line 1922 "util/configparser.y"
+        {
 		OUTYY(("P(server_key_cache_slabs:%s)\n", (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0)
 			yyerror("number expected");
@@ -4506,23 +4663,102 @@ yyreduce:
 		}
 		free((yyvsp[0].str));
 	}
-#line 4510 "util/configparser.c" /* yacc.c:1648  */
+#line 4667 "util/configparser.c"
+    break;
+
+  case 428: /* server_sig_cache_size: VAR_SIG_CACHE_SIZE STRING_ARG  */
+#line 1935 "util/configparser.y"
+        {
+		OUTYY(("P(server_sig_cache_size:%s)\n", (yyvsp[0].str)));
+		if(!cfg_parse_memsize((yyvsp[0].str), &cfg_parser->cfg->sig_cache_size))
+			yyerror("memory size expected");
+		free((yyvsp[0].str));
+	}
+#line 4678 "util/configparser.c"
+    break;
+
+  case 429: /* server_sig_cache_slabs: VAR_SIG_CACHE_SLABS STRING_ARG  */
+#line 1943 "util/configparser.y"
+        {
+		OUTYY(("P(server_sig_cache_slabs:%s)\n", (yyvsp[0].str)));
+		if(atoi((yyvsp[0].str)) == 0)
+			yyerror("number expected");
+		else {
+			cfg_parser->cfg->sig_cache_slabs = atoi((yyvsp[0].str));
+			if(!is_pow2(cfg_parser->cfg->sig_cache_slabs))
+				yyerror("must be a power of 2");
+		}
+		free((yyvsp[0].str));
+	}
+#line 4694 "util/configparser.c"
+    break;
+
+  case 430: /* server_val_crypto_threads: VAR_VAL_CRYPTO_THREADS STRING_ARG  */
+#line 1956 "util/configparser.y"
+        {
+		OUTYY(("P(server_val_crypto_threads:%s)\n", (yyvsp[0].str)));
+		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
+			yyerror("number expected");
+		else cfg_parser->cfg->val_crypto_threads = atoi((yyvsp[0].str));
+		free((yyvsp[0].str));
+	}
+#line 4706 "util/configparser.c"
+    break;
+
+  case 431: /* server_nsec3_hash_cache_size: VAR_NSEC3_HASH_CACHE_SIZE STRING_ARG  */
+#line 1965 "util/configparser.y"
+        {
+		OUTYY(("P(server_nsec3_hash_cache_size:%s)\n", (yyvsp[0].str)));
+		if(!cfg_parse_memsize((yyvsp[0].str),
+			&cfg_parser->cfg->nsec3_hash_cache_size))
+			yyerror("memory size expected");
+		free((yyvsp[0].str));
+	}
+#line 4718 "util/configparser.c"
+    break;
+
+  case 432: /* server_nsec3_hash_cache_slabs: VAR_NSEC3_HASH_CACHE_SLABS STRING_ARG  */
+#line 1974 "util/configparser.y"
+        {
+		OUTYY(("P(server_nsec3_hash_cache_slabs:%s)\n", (yyvsp[0].str)));
+		if(atoi((yyvsp[0].str)) == 0)
+			yyerror("number expected");
+		else {
+			cfg_parser->cfg->nsec3_hash_cache_slabs = atoi((yyvsp[0].str));
+			if(!is_pow2(cfg_parser->cfg->nsec3_hash_cache_slabs))
+				yyerror("must be a power of 2");
+		}
+		free((yyvsp[0].str));
+	}
+#line 4734 "util/configparser.c"
     break;
 
-  case 390:
-#line 1768 "./util/configparser.y" /* yacc.c:1648  */
-    {
+  case 433: /* server_nsec3_hash_ratelimit: VAR_NSEC3_HASH_RATELIMIT STRING_ARG  */
+#line 1987 "util/configparser.y"
+        {
+		OUTYY(("P(server_nsec3_hash_ratelimit:%s)\n", (yyvsp[0].str)));
+		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
+			yyerror("number expected");
+		else cfg_parser->cfg->nsec3_hash_ratelimit = atoi((yyvsp[0].str));
+		free((yyvsp[0].str));
+	}
+#line 4746 "util/configparser.c"
+    break;
+
+  case 434: /* server_neg_cache_size: VAR_NEG_CACHE_SIZE STRING_ARG  */
+#line 1996 "util/configparser.y"
+        {
 		OUTYY(("P(server_neg_cache_size:%s)\n", (yyvsp[0].str)));
 		if(!cfg_parse_memsize((yyvsp[0].str), &cfg_parser->cfg->neg_cache_size))
 			yyerror("memory size expected");
 		free((yyvsp[0].str));
 	}
-#line 4521 "util/configparser.c" /* yacc.c:1648  */
+#line 4757 "util/configparser.c"
     break;
 
-  case 391:
-#line 1776 "./util/configparser.y" /* yacc.c:1648  */
-    {
+  case 435: /* server_local_zone: VAR_LOCAL_ZONE STRING_ARG STRING_ARG  */
+#line 2004 "util/configparser.y"
+        {
 		OUTYY(("P(server_local_zone:%s %s)\n", (yyvsp[-1].str), (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "static")!=0 && strcmp((yyvsp[0].str), "deny")!=0 &&
 		   strcmp((yyvsp[0].str), "refuse")!=0 && strcmp((yyvsp[0].str), "redirect")!=0 &&
@@ -4551,22 +4787,22 @@ yyreduce:
 				fatal_exit("out of memory adding local-zone");
 		}
 	}
-#line 4555 "util/configparser.c" /* yacc.c:1648  */
+#line 4791 "util/configparser.c"
     break;
 
-  case 392:
-#line 1807 "./util/configparser.y" /* yacc.c:1648  */
-    {
+  case 436: /* server_local_data: VAR_LOCAL_DATA STRING_ARG  */
+#line 2035 "util/configparser.y"
+        {
 		OUTYY(("P(server_local_data:%s)\n", (yyvsp[0].str)));
 		if(!cfg_strlist_insert(&cfg_parser->cfg->local_data, (yyvsp[0].str)))
 			fatal_exit("out of memory adding local-data");
 	}
-#line 4565 "util/configparser.c" /* yacc.c:1648  */
+#line 4801 "util/configparser.c"
     break;
 
-  case 393:
-#line 1814 "./util/configparser.y" /* yacc.c:1648  */
-    {
+  case 437: /* server_local_data_ptr: VAR_LOCAL_DATA_PTR STRING_ARG  */
+#line 2042 "util/configparser.y"
+        {
 		char* ptr;
 		OUTYY(("P(server_local_data_ptr:%s)\n", (yyvsp[0].str)));
 		ptr = cfg_ptr_reverse((yyvsp[0].str));
@@ -4579,12 +4815,12 @@ yyreduce:
 			yyerror("local-data-ptr could not be reversed");
 		}
 	}
-#line 4583 "util/configparser.c" /* yacc.c:1648  */
+#line 4819 "util/configparser.c"
     break;
 
-  case 394:
-#line 1829 "./util/configparser.y" /* yacc.c:1648  */
-    {
+  case 438: /* server_minimal_responses: VAR_MINIMAL_RESPONSES STRING_ARG  */
+#line 2057 "util/configparser.y"
+        {
 		OUTYY(("P(server_minimal_responses:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
@@ -4592,12 +4828,12 @@ yyreduce:
 			(strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 4596 "util/configparser.c" /* yacc.c:1648  */
+#line 4832 "util/configparser.c"
     break;
 
-  case 395:
-#line 1839 "./util/configparser.y" /* yacc.c:1648  */
-    {
+  case 439: /* server_rrset_roundrobin: VAR_RRSET_ROUNDROBIN STRING_ARG  */
+#line 2067 "util/configparser.y"
+        {
 		OUTYY(("P(server_rrset_roundrobin:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
@@ -4605,65 +4841,65 @@ yyreduce:
 			(strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 4609 "util/configparser.c" /* yacc.c:1648  */
+#line 4845 "util/configparser.c"
     break;
 
-  case 396:
-#line 1849 "./util/configparser.y" /* yacc.c:1648  */
-    {
+  case 440: /* server_unknown_server_time_limit: VAR_UNKNOWN_SERVER_TIME_LIMIT STRING_ARG  */
+#line 2077 "util/configparser.y"
+        {
 		OUTYY(("P(server_unknown_server_time_limit:%s)\n", (yyvsp[0].str)));
 		cfg_parser->cfg->unknown_server_time_limit = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 4619 "util/configparser.c" /* yacc.c:1648  */
+#line 4855 "util/configparser.c"
     break;
 
-  case 397:
-#line 1856 "./util/configparser.y" /* yacc.c:1648  */
-    {
+  case 441: /* server_max_udp_size: VAR_MAX_UDP_SIZE STRING_ARG  */
+#line 2084 "util/configparser.y"
+        {
 		OUTYY(("P(server_max_udp_size:%s)\n", (yyvsp[0].str)));
 		cfg_parser->cfg->max_udp_size = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 4629 "util/configparser.c" /* yacc.c:1648  */
+#line 4865 "util/configparser.c"
     break;
 
-  case 398:
-#line 1863 "./util/configparser.y" /* yacc.c:1648  */
-    {
+  case 442: /* server_dns64_prefix: VAR_DNS64_PREFIX STRING_ARG  */
+#line 2091 "util/configparser.y"
+        {
 		OUTYY(("P(dns64_prefix:%s)\n", (yyvsp[0].str)));
 		free(cfg_parser->cfg->dns64_prefix);
 		cfg_parser->cfg->dns64_prefix = (yyvsp[0].str);
 	}
-#line 4639 "util/configparser.c" /* yacc.c:1648  */
+#line 4875 "util/configparser.c"
     break;
 
-  case 399:
-#line 1870 "./util/configparser.y" /* yacc.c:1648  */
-    {
+  case 443: /* server_dns64_synthall: VAR_DNS64_SYNTHALL STRING_ARG  */
+#line 2098 "util/configparser.y"
+        {
 		OUTYY(("P(server_dns64_synthall:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
 		else cfg_parser->cfg->dns64_synthall = (strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 4651 "util/configparser.c" /* yacc.c:1648  */
+#line 4887 "util/configparser.c"
     break;
 
-  case 400:
-#line 1879 "./util/configparser.y" /* yacc.c:1648  */
-    {
+  case 444: /* server_dns64_ignore_aaaa: VAR_DNS64_IGNORE_AAAA STRING_ARG  */
+#line 2107 "util/configparser.y"
+        {
 		OUTYY(("P(dns64_ignore_aaaa:%s)\n", (yyvsp[0].str)));
 		if(!cfg_strlist_insert(&cfg_parser->cfg->dns64_ignore_aaaa,
 			(yyvsp[0].str)))
 			fatal_exit("out of memory adding dns64-ignore-aaaa");
 	}
-#line 4662 "util/configparser.c" /* yacc.c:1648  */
+#line 4898 "util/configparser.c"
     break;
 
-  case 401:
-#line 1887 "./util/configparser.y" /* yacc.c:1648  */
-    {
+  case 445: /* server_define_tag: VAR_DEFINE_TAG STRING_ARG  */
+#line 2115 "util/configparser.y"
+        {
 		char* p, *s = (yyvsp[0].str);
 		OUTYY(("P(server_define_tag:%s)\n", (yyvsp[0].str)));
 		while((p=strsep(&s, " \t\n")) != NULL) {
@@ -4675,12 +4911,12 @@ yyreduce:
 		}
 		free((yyvsp[0].str));
 	}
-#line 4679 "util/configparser.c" /* yacc.c:1648  */
+#line 4915 "util/configparser.c"
     break;
 
-  case 402:
-#line 1901 "./util/configparser.y" /* yacc.c:1648  */
-    {
+  case 446: /* server_local_zone_tag: VAR_LOCAL_ZONE_TAG STRING_ARG STRING_ARG  */
+#line 2129 "util/configparser.y"
+        {
 		size_t len = 0;
 		uint8_t* bitlist = config_parse_taglist(cfg_parser->cfg, (yyvsp[0].str),
 			&len);
@@ -4699,12 +4935,12 @@ yyreduce:
 			}
 		}
 	}
-#line 4703 "util/configparser.c" /* yacc.c:1648  */
+#line 4939 "util/configparser.c"
     break;
 
-  case 403:
-#line 1922 "./util/configparser.y" /* yacc.c:1648  */
-    {
+  case 447: /* server_access_control_tag: VAR_ACCESS_CONTROL_TAG STRING_ARG STRING_ARG  */
+#line 2150 "util/configparser.y"
+        {
 		size_t len = 0;
 		uint8_t* bitlist = config_parse_taglist(cfg_parser->cfg, (yyvsp[0].str),
 			&len);
@@ -4723,12 +4959,12 @@ yyreduce:
 			}
 		}
 	}
-#line 4727 "util/configparser.c" /* yacc.c:1648  */
+#line 4963 "util/configparser.c"
     break;
 
-  case 404:
-#line 1943 "./util/configparser.y" /* yacc.c:1648  */
-    {
+  case 448: /* server_access_control_tag_action: VAR_ACCESS_CONTROL_TAG_ACTION STRING_ARG STRING_ARG STRING_ARG  */
+#line 2171 "util/configparser.y"
+        {
 		OUTYY(("P(server_access_control_tag_action:%s %s %s)\n", (yyvsp[-2].str), (yyvsp[-1].str), (yyvsp[0].str)));
 		if(!cfg_str3list_insert(&cfg_parser->cfg->acl_tag_actions,
 			(yyvsp[-2].str), (yyvsp[-1].str), (yyvsp[0].str))) {
@@ -4738,12 +4974,12 @@ yyreduce:
 			free((yyvsp[0].str));
 		}
 	}
-#line 4742 "util/configparser.c" /* yacc.c:1648  */
+#line 4978 "util/configparser.c"
     break;
 
-  case 405:
-#line 1955 "./util/configparser.y" /* yacc.c:1648  */
-    {
+  case 449: /* server_access_control_tag_data: VAR_ACCESS_CONTROL_TAG_DATA STRING_ARG STRING_ARG STRING_ARG  */
+#line 2183 "util/configparser.y"
+        {
 		OUTYY(("P(server_access_control_tag_data:%s %s %s)\n", (yyvsp[-2].str), (yyvsp[-1].str), (yyvsp[0].str)));
 		if(!cfg_str3list_insert(&cfg_parser->cfg->acl_tag_datas,
 			(yyvsp[-2].str), (yyvsp[-1].str), (yyvsp[0].str))) {
@@ -4753,12 +4989,12 @@ yyreduce:
 			free((yyvsp[0].str));
 		}
 	}
-#line 4757 "util/configparser.c" /* yacc.c:1648  */
+#line 4993 "util/configparser.c"
     break;
 
-  case 406:
-#line 1967 "./util/configparser.y" /* yacc.c:1648  */
-    {
+  case 450: /* server_local_zone_override: VAR_LOCAL_ZONE_OVERRIDE STRING_ARG STRING_ARG STRING_ARG  */
+#line 2195 "util/configparser.y"
+        {
 		OUTYY(("P(server_local_zone_override:%s %s %s)\n", (yyvsp[-2].str), (yyvsp[-1].str), (yyvsp[0].str)));
 		if(!cfg_str3list_insert(&cfg_parser->cfg->local_zone_overrides,
 			(yyvsp[-2].str), (yyvsp[-1].str), (yyvsp[0].str))) {
@@ -4768,24 +5004,24 @@ yyreduce:
 			free((yyvsp[0].str));
 		}
 	}
-#line 4772 "util/configparser.c" /* yacc.c:1648  */
+#line 5008 "util/configparser.c"
     break;
 
-  case 407:
-#line 1979 "./util/configparser.y" /* yacc.c:1648  */
-    {
+  case 451: /* server_access_control_view: VAR_ACCESS_CONTROL_VIEW STRING_ARG STRING_ARG  */
+#line 2207 "util/configparser.y"
+        {
 		OUTYY(("P(server_access_control_view:%s %s)\n", (yyvsp[-1].str), (yyvsp[0].str)));
 		if(!cfg_str2list_insert(&cfg_parser->cfg->acl_view,
 			(yyvsp[-1].str), (yyvsp[0].str))) {
 			yyerror("out of memory");
 		}
 	}
-#line 4784 "util/configparser.c" /* yacc.c:1648  */
+#line 5020 "util/configparser.c"
     break;
 
-  case 408:
-#line 1988 "./util/configparser.y" /* yacc.c:1648  */
-    {
+  case 452: /* server_response_ip_tag: VAR_RESPONSE_IP_TAG STRING_ARG STRING_ARG  */
+#line 2216 "util/configparser.y"
+        {
 		size_t len = 0;
 		uint8_t* bitlist = config_parse_taglist(cfg_parser->cfg, (yyvsp[0].str),
 			&len);
@@ -4804,58 +5040,58 @@ yyreduce:
 			}
 		}
 	}
-#line 4808 "util/configparser.c" /* yacc.c:1648  */
+#line 5044 "util/configparser.c"
     break;
 
-  case 409:
-#line 2009 "./util/configparser.y" /* yacc.c:1648  */
-    { 
+  case 453: /* server_ip_ratelimit: VAR_IP_RATELIMIT STRING_ARG  */
+#line 2237 "util/configparser.y"
+        { 
 		OUTYY(("P(server_ip_ratelimit:%s)\n", (yyvsp[0].str))); 
 		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
 			yyerror("number expected");
 		else cfg_parser->cfg->ip_ratelimit = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 4820 "util/configparser.c" /* yacc.c:1648  */
+#line 5056 "util/configparser.c"
     break;
 
-  case 410:
-#line 2019 "./util/configparser.y" /* yacc.c:1648  */
-    { 
+  case 454: /* server_ratelimit: VAR_RATELIMIT STRING_ARG  */
+#line 2247 "util/configparser.y"
+        { 
 		OUTYY(("P(server_ratelimit:%s)\n", (yyvsp[0].str))); 
 		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
 			yyerror("number expected");
 		else cfg_parser->cfg->ratelimit = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 4832 "util/configparser.c" /* yacc.c:1648  */
+#line 5068 "util/configparser.c"
     break;
 
-  case 411:
-#line 2028 "./util/configparser.y" /* yacc.c:1648  */
-    {
+  case 455: /* server_ip_ratelimit_size: VAR_IP_RATELIMIT_SIZE STRING_ARG  */
+#line 2256 "util/configparser.y"
+  {
   	OUTYY(("P(server_ip_ratelimit_size:%s)\n", (yyvsp[0].str)));
   	if(!cfg_parse_memsize((yyvsp[0].str), &cfg_parser->cfg->ip_ratelimit_size))
   		yyerror("memory size expected");
   	free((yyvsp[0].str));
   }
-#line 4843 "util/configparser.c" /* yacc.c:1648  */
+#line 5079 "util/configparser.c"
     break;
 
-  case 412:
-#line 2036 "./util/configparser.y" /* yacc.c:1648  */
-    {
+  case 456: /* server_ratelimit_size: VAR_RATELIMIT_SIZE STRING_ARG  */
+#line 2264 "util/configparser.y"
+        {
 		OUTYY(("P(server_ratelimit_size:%s)\n", (yyvsp[0].str)));
 		if(!cfg_parse_memsize((yyvsp[0].str), &cfg_parser->cfg->ratelimit_size))
 			yyerror("memory size expected");
 		free((yyvsp[0].str));
 	}
-#line 4854 "util/configparser.c" /* yacc.c:1648  */
+#line 5090 "util/configparser.c"
     break;
 
-  case 413:
-#line 2044 "./util/configparser.y" /* yacc.c:1648  */
-    {
+  case 457: /* server_ip_ratelimit_slabs: VAR_IP_RATELIMIT_SLABS STRING_ARG  */
+#line 2272 "util/configparser.y"
+  {
   	OUTYY(("P(server_ip_ratelimit_slabs:%s)\n", (yyvsp[0].str)));
   	if(atoi((yyvsp[0].str)) == 0)
   		yyerror("number expected");
@@ -4866,12 +5102,12 @@ yyreduce:
   	}
   	free((yyvsp[0].str));
   }
-#line 4870 "util/configparser.c" /* yacc.c:1648  */
+#line 5106 "util/configparser.c"
     break;
 
-  case 414:
-#line 2057 "./util/configparser.y" /* yacc.c:1648  */
-    {
+  case 458: /* server_ratelimit_slabs: VAR_RATELIMIT_SLABS STRING_ARG  */
+#line 2285 "util/configparser.y"
+        {
 		OUTYY(("P(server_ratelimit_slabs:%s)\n", (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0)
 			yyerror("number expected");
@@ -4882,12 +5118,12 @@ yyreduce:
 		}
 		free((yyvsp[0].str));
 	}
-#line 4886 "util/configparser.c" /* yacc.c:1648  */
+#line 5122 "util/configparser.c"
     break;
 
-  case 415:
-#line 2070 "./util/configparser.y" /* yacc.c:1648  */
-    {
+  case 459: /* server_ratelimit_for_domain: VAR_RATELIMIT_FOR_DOMAIN STRING_ARG STRING_ARG  */
+#line 2298 "util/configparser.y"
+        {
 		OUTYY(("P(server_ratelimit_for_domain:%s %s)\n", (yyvsp[-1].str), (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0) {
 			yyerror("number expected");
@@ -4900,12 +5136,12 @@ yyreduce:
 					"ratelimit-for-domain");
 		}
 	}
-#line 4904 "util/configparser.c" /* yacc.c:1648  */
+#line 5140 "util/configparser.c"
     break;
 
-  case 416:
-#line 2085 "./util/configparser.y" /* yacc.c:1648  */
-    {
+  case 460: /* server_ratelimit_below_domain: VAR_RATELIMIT_BELOW_DOMAIN STRING_ARG STRING_ARG  */
+#line 2313 "util/configparser.y"
+        {
 		OUTYY(("P(server_ratelimit_below_domain:%s %s)\n", (yyvsp[-1].str), (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0) {
 			yyerror("number expected");
@@ -4918,69 +5154,95 @@ yyreduce:
 					"ratelimit-below-domain");
 		}
 	}
-#line 4922 "util/configparser.c" /* yacc.c:1648  */
+#line 5158 "util/configparser.c"
     break;
 
-  case 417:
-#line 2100 "./util/configparser.y" /* yacc.c:1648  */
-    { 
+  case 461: /* server_ip_ratelimit_factor: VAR_IP_RATELIMIT_FACTOR STRING_ARG  */
+#line 2328 "util/configparser.y"
+  { 
   	OUTYY(("P(server_ip_ratelimit_factor:%s)\n", (yyvsp[0].str))); 
   	if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
   		yyerror("number expected");
   	else cfg_parser->cfg->ip_ratelimit_factor = atoi((yyvsp[0].str));
   	free((yyvsp[0].str));
 	}
-#line 4934 "util/configparser.c" /* yacc.c:1648  */
+#line 5170 "util/configparser.c"
     break;
 
-  case 418:
-#line 2109 "./util/configparser.y" /* yacc.c:1648  */
-    { 
+  case 462: /* server_ratelimit_factor: VAR_RATELIMIT_FACTOR STRING_ARG  */
+#line 2337 "util/configparser.y"
+        { 
 		OUTYY(("P(server_ratelimit_factor:%s)\n", (yyvsp[0].str))); 
 		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
 			yyerror("number expected");
 		else cfg_parser->cfg->ratelimit_factor = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 4946 "util/configparser.c" /* yacc.c:1648  */
+#line 5182 "util/configparser.c"
     break;
 
-  case 419:
-#line 2118 "./util/configparser.y" /* yacc.c:1648  */
-    { 
+  case 463: /* server_low_rtt: VAR_LOW_RTT STRING_ARG  */
+#line 2346 "util/configparser.y"
+        { 
 		OUTYY(("P(low-rtt option is deprecated, use fast-server-num instead)\n"));
 		free((yyvsp[0].str));
 	}
-#line 4955 "util/configparser.c" /* yacc.c:1648  */
+#line 5191 "util/configparser.c"
     break;
 
-  case 420:
-#line 2124 "./util/configparser.y" /* yacc.c:1648  */
-    { 
+  case 464: /* server_fast_server_num: VAR_FAST_SERVER_NUM STRING_ARG  */
+#line 2352 "util/configparser.y"
+        { 
 		OUTYY(("P(server_fast_server_num:%s)\n", (yyvsp[0].str))); 
 		if(atoi((yyvsp[0].str)) <= 0)
 			yyerror("number expected");
 		else cfg_parser->cfg->fast_server_num = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 4967 "util/configparser.c" /* yacc.c:1648  */
+#line 5203 "util/configparser.c"
     break;
 
-  case 421:
-#line 2133 "./util/configparser.y" /* yacc.c:1648  */
-    { 
+  case 465: /* server_fast_server_permil: VAR_FAST_SERVER_PERMIL STRING_ARG  */
+#line 2361 "util/configparser.y"
+        { 
 		OUTYY(("P(server_fast_server_permil:%s)\n", (yyvsp[0].str))); 
 		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
 			yyerror("number expected");
 		else cfg_parser->cfg->fast_server_permil = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 4979 "util/configparser.c" /* yacc.c:1648  */
+#line 5215 "util/configparser.c"
     break;
 
-  case 422:
-#line 2142 "./util/configparser.y" /* yacc.c:1648  */
-    {
+  case 466: /* server_hedge_percentile: VAR_HEDGE_PERCENTILE STRING_ARG  */
+#line 2370 "util/configparser.y"
+        {
+		OUTYY(("P(server_hedge_percentile:%s)\n", (yyvsp[0].str)));
+		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
+			yyerror("number expected");
+		else if(atoi((yyvsp[0].str)) < 0 || atoi((yyvsp[0].str)) > 99)
+			yyerror("percentile must be between 0 and 99");
+		else cfg_parser->cfg->hedge_percentile = atoi((yyvsp[0].str));
+		free((yyvsp[0].str));
+	}
+#line 5229 "util/configparser.c"
+    break;
+
+  case 467: /* server_hedge_budget: VAR_HEDGE_BUDGET STRING_ARG  */
+#line 2381 "util/configparser.y"
+        {
+		OUTYY(("P(server_hedge_budget:%s)\n", (yyvsp[0].str)));
+		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
+			yyerror("number expected");
+		else cfg_parser->cfg->hedge_budget = atoi((yyvsp[0].str));
+		free((yyvsp[0].str));
+	}
+#line 5241 "util/configparser.c"
+    break;
+
+  case 468: /* server_qname_minimisation: VAR_QNAME_MINIMISATION STRING_ARG  */
+#line 2390 "util/configparser.y"
+        {
 		OUTYY(("P(server_qname_minimisation:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
@@ -4988,12 +5250,12 @@ yyreduce:
 			(strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 4992 "util/configparser.c" /* yacc.c:1648  */
+#line 5254 "util/configparser.c"
     break;
 
-  case 423:
-#line 2152 "./util/configparser.y" /* yacc.c:1648  */
-    {
+  case 469: /* server_qname_minimisation_strict: VAR_QNAME_MINIMISATION_STRICT STRING_ARG  */
+#line 2400 "util/configparser.y"
+        {
 		OUTYY(("P(server_qname_minimisation_strict:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
@@ -5001,12 +5263,12 @@ yyreduce:
 			(strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 5005 "util/configparser.c" /* yacc.c:1648  */
+#line 5267 "util/configparser.c"
     break;
 
-  case 424:
-#line 2162 "./util/configparser.y" /* yacc.c:1648  */
-    {
+  case 470: /* server_ipsecmod_enabled: VAR_IPSECMOD_ENABLED STRING_ARG  */
+#line 2410 "util/configparser.y"
+        {
 	#ifdef USE_IPSECMOD
 		OUTYY(("P(server_ipsecmod_enabled:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
@@ -5017,12 +5279,12 @@ yyreduce:
 	#endif
 		free((yyvsp[0].str));
 	}
-#line 5021 "util/configparser.c" /* yacc.c:1648  */
+#line 5283 "util/configparser.c"
     break;
 
-  case 425:
-#line 2175 "./util/configparser.y" /* yacc.c:1648  */
-    {
+  case 471: /* server_ipsecmod_ignore_bogus: VAR_IPSECMOD_IGNORE_BOGUS STRING_ARG  */
+#line 2423 "util/configparser.y"
+        {
 	#ifdef USE_IPSECMOD
 		OUTYY(("P(server_ipsecmod_ignore_bogus:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
@@ -5033,12 +5295,12 @@ yyreduce:
 	#endif
 		free((yyvsp[0].str));
 	}
-#line 5037 "util/configparser.c" /* yacc.c:1648  */
+#line 5299 "util/configparser.c"
     break;
 
-  case 426:
-#line 2188 "./util/configparser.y" /* yacc.c:1648  */
-    {
+  case 472: /* server_ipsecmod_hook: VAR_IPSECMOD_HOOK STRING_ARG  */
+#line 2436 "util/configparser.y"
+        {
 	#ifdef USE_IPSECMOD
 		OUTYY(("P(server_ipsecmod_hook:%s)\n", (yyvsp[0].str)));
 		free(cfg_parser->cfg->ipsecmod_hook);
@@ -5048,12 +5310,12 @@ yyreduce:
 		free((yyvsp[0].str));
 	#endif
 	}
-#line 5052 "util/configparser.c" /* yacc.c:1648  */
+#line 5314 "util/configparser.c"
     break;
 
-  case 427:
-#line 2200 "./util/configparser.y" /* yacc.c:1648  */
-    {
+  case 473: /* server_ipsecmod_max_ttl: VAR_IPSECMOD_MAX_TTL STRING_ARG  */
+#line 2448 "util/configparser.y"
+        {
 	#ifdef USE_IPSECMOD
 		OUTYY(("P(server_ipsecmod_max_ttl:%s)\n", (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
@@ -5065,12 +5327,12 @@ yyreduce:
 		free((yyvsp[0].str));
 	#endif
 	}
-#line 5069 "util/configparser.c" /* yacc.c:1648  */
+#line 5331 "util/configparser.c"
     break;
 
-  case 428:
-#line 2214 "./util/configparser.y" /* yacc.c:1648  */
-    {
+  case 474: /* server_ipsecmod_whitelist: VAR_IPSECMOD_WHITELIST STRING_ARG  */
+#line 2462 "util/configparser.y"
+        {
 	#ifdef USE_IPSECMOD
 		OUTYY(("P(server_ipsecmod_whitelist:%s)\n", (yyvsp[0].str)));
 		if(!cfg_strlist_insert(&cfg_parser->cfg->ipsecmod_whitelist, (yyvsp[0].str)))
@@ -5080,12 +5342,12 @@ yyreduce:
 		free((yyvsp[0].str));
 	#endif
 	}
-#line 5084 "util/configparser.c" /* yacc.c:1648  */
+#line 5346 "util/configparser.c"
     break;
 
-  case 429:
-#line 2226 "./util/configparser.y" /* yacc.c:1648  */
-    {
+  case 475: /* server_ipsecmod_strict: VAR_IPSECMOD_STRICT STRING_ARG  */
+#line 2474 "util/configparser.y"
+        {
 	#ifdef USE_IPSECMOD
 		OUTYY(("P(server_ipsecmod_strict:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
@@ -5097,12 +5359,12 @@ yyreduce:
 		free((yyvsp[0].str));
 	#endif
 	}
-#line 5101 "util/configparser.c" /* yacc.c:1648  */
+#line 5363 "util/configparser.c"
     break;
 
-  case 430:
-#line 2240 "./util/configparser.y" /* yacc.c:1648  */
-    {
+  case 476: /* stub_name: VAR_NAME STRING_ARG  */
+#line 2488 "util/configparser.y"
+        {
 		OUTYY(("P(name:%s)\n", (yyvsp[0].str)));
 		if(cfg_parser->cfg->stubs->name)
 			yyerror("stub name override, there must be one name "
@@ -5110,56 +5372,56 @@ yyreduce:
 		free(cfg_parser->cfg->stubs->name);
 		cfg_parser->cfg->stubs->name = (yyvsp[0].str);
 	}
-#line 5114 "util/configparser.c" /* yacc.c:1648  */
+#line 5376 "util/configparser.c"
     break;
 
-  case 431:
-#line 2250 "./util/configparser.y" /* yacc.c:1648  */
-    {
+  case 477: /* stub_host: VAR_STUB_HOST STRING_ARG  */
+#line 2498 "util/configparser.y"
+        {
 		OUTYY(("P(stub-host:%s)\n", (yyvsp[0].str)));
 		if(!cfg_strlist_insert(&cfg_parser->cfg->stubs->hosts, (yyvsp[0].str)))
 			yyerror("out of memory");
 	}
-#line 5124 "util/configparser.c" /* yacc.c:1648  */
+#line 5386 "util/configparser.c"
     break;
 
-  case 432:
-#line 2257 "./util/configparser.y" /* yacc.c:1648  */
-    {
+  case 478: /* stub_addr: VAR_STUB_ADDR STRING_ARG  */
+#line 2505 "util/configparser.y"
+        {
 		OUTYY(("P(stub-addr:%s)\n", (yyvsp[0].str)));
 		if(!cfg_strlist_insert(&cfg_parser->cfg->stubs->addrs, (yyvsp[0].str)))
 			yyerror("out of memory");
 	}
-#line 5134 "util/configparser.c" /* yacc.c:1648  */
+#line 5396 "util/configparser.c"
     break;
 
-  case 433:
-#line 2264 "./util/configparser.y" /* yacc.c:1648  */
-    {
+  case 479: /* stub_first: VAR_STUB_FIRST STRING_ARG  */
+#line 2512 "util/configparser.y"
+        {
 		OUTYY(("P(stub-first:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
 		else cfg_parser->cfg->stubs->isfirst=(strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 5146 "util/configparser.c" /* yacc.c:1648  */
+#line 5408 "util/configparser.c"
     break;
 
-  case 434:
-#line 2273 "./util/configparser.y" /* yacc.c:1648  */
-    {
+  case 480: /* stub_no_cache: VAR_STUB_NO_CACHE STRING_ARG  */
+#line 2521 "util/configparser.y"
+        {
 		OUTYY(("P(stub-no-cache:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
 		else cfg_parser->cfg->stubs->no_cache=(strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 5158 "util/configparser.c" /* yacc.c:1648  */
+#line 5420 "util/configparser.c"
     break;
 
-  case 435:
-#line 2282 "./util/configparser.y" /* yacc.c:1648  */
-    {
+  case 481: /* stub_ssl_upstream: VAR_STUB_SSL_UPSTREAM STRING_ARG  */
+#line 2530 "util/configparser.y"
+        {
 		OUTYY(("P(stub-ssl-upstream:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
@@ -5167,12 +5429,12 @@ yyreduce:
 			(strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 5171 "util/configparser.c" /* yacc.c:1648  */
+#line 5433 "util/configparser.c"
     break;
 
-  case 436:
-#line 2292 "./util/configparser.y" /* yacc.c:1648  */
-    {
+  case 482: /* stub_prime: VAR_STUB_PRIME STRING_ARG  */
+#line 2540 "util/configparser.y"
+        {
 		OUTYY(("P(stub-prime:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
@@ -5180,12 +5442,12 @@ yyreduce:
 			(strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 5184 "util/configparser.c" /* yacc.c:1648  */
+#line 5446 "util/configparser.c"
     break;
 
-  case 437:
-#line 2302 "./util/configparser.y" /* yacc.c:1648  */
-    {
+  case 483: /* forward_name: VAR_NAME STRING_ARG  */
+#line 2550 "util/configparser.y"
+        {
 		OUTYY(("P(name:%s)\n", (yyvsp[0].str)));
 		if(cfg_parser->cfg->forwards->name)
 			yyerror("forward name override, there must be one "
@@ -5193,56 +5455,56 @@ yyreduce:
 		free(cfg_parser->cfg->forwards->name);
 		cfg_parser->cfg->forwards->name = (yyvsp[0].str);
 	}
-#line 5197 "util/configparser.c" /* yacc.c:1648  */
+#line 5459 "util/configparser.c"
     break;
 
-  case 438:
-#line 2312 "./util/configparser.y" /* yacc.c:1648  */
-    {
+  case 484: /* forward_host: VAR_FORWARD_HOST STRING_ARG  */
+#line 2560 "util/configparser.y"
+        {
 		OUTYY(("P(forward-host:%s)\n", (yyvsp[0].str)));
 		if(!cfg_strlist_insert(&cfg_parser->cfg->forwards->hosts, (yyvsp[0].str)))
 			yyerror("out of memory");
 	}
-#line 5207 "util/configparser.c" /* yacc.c:1648  */
+#line 5469 "util/configparser.c"
     break;
 
-  case 439:
-#line 2319 "./util/configparser.y" /* yacc.c:1648  */
-    {
+  case 485: /* forward_addr: VAR_FORWARD_ADDR STRING_ARG  */
+#line 2567 "util/configparser.y"
+        {
 		OUTYY(("P(forward-addr:%s)\n", (yyvsp[0].str)));
 		if(!cfg_strlist_insert(&cfg_parser->cfg->forwards->addrs, (yyvsp[0].str)))
 			yyerror("out of memory");
 	}
-#line 5217 "util/configparser.c" /* yacc.c:1648  */
+#line 5479 "util/configparser.c"
     break;
 
-  case 440:
-#line 2326 "./util/configparser.y" /* yacc.c:1648  */
-    {
+  case 486: /* forward_first: VAR_FORWARD_FIRST STRING_ARG  */
+#line 2574 "util/configparser.y"
+        {
 		OUTYY(("P(forward-first:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
 		else cfg_parser->cfg->forwards->isfirst=(strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 5229 "util/configparser.c" /* yacc.c:1648  */
+#line 5491 "util/configparser.c"
     break;
 
-  case 441:
-#line 2335 "./util/configparser.y" /* yacc.c:1648  */
-    {
+  case 487: /* forward_no_cache: VAR_FORWARD_NO_CACHE STRING_ARG  */
+#line 2583 "util/configparser.y"
+        {
 		OUTYY(("P(forward-no-cache:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
 		else cfg_parser->cfg->forwards->no_cache=(strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 5241 "util/configparser.c" /* yacc.c:1648  */
+#line 5503 "util/configparser.c"
     break;
 
-  case 442:
-#line 2344 "./util/configparser.y" /* yacc.c:1648  */
-    {
+  case 488: /* forward_ssl_upstream: VAR_FORWARD_SSL_UPSTREAM STRING_ARG  */
+#line 2592 "util/configparser.y"
+        {
 		OUTYY(("P(forward-ssl-upstream:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
@@ -5250,12 +5512,12 @@ yyreduce:
 			(strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 5254 "util/configparser.c" /* yacc.c:1648  */
+#line 5516 "util/configparser.c"
     break;
 
-  case 443:
-#line 2354 "./util/configparser.y" /* yacc.c:1648  */
-    {
+  case 489: /* auth_name: VAR_NAME STRING_ARG  */
+#line 2602 "util/configparser.y"
+        {
 		OUTYY(("P(name:%s)\n", (yyvsp[0].str)));
 		if(cfg_parser->cfg->auths->name)
 			yyerror("auth name override, there must be one name "
@@ -5263,53 +5525,53 @@ yyreduce:
 		free(cfg_parser->cfg->auths->name);
 		cfg_parser->cfg->auths->name = (yyvsp[0].str);
 	}
-#line 5267 "util/configparser.c" /* yacc.c:1648  */
+#line 5529 "util/configparser.c"
     break;
 
-  case 444:
-#line 2364 "./util/configparser.y" /* yacc.c:1648  */
-    {
+  case 490: /* auth_zonefile: VAR_ZONEFILE STRING_ARG  */
+#line 2612 "util/configparser.y"
+        {
 		OUTYY(("P(zonefile:%s)\n", (yyvsp[0].str)));
 		free(cfg_parser->cfg->auths->zonefile);
 		cfg_parser->cfg->auths->zonefile = (yyvsp[0].str);
 	}
-#line 5277 "util/configparser.c" /* yacc.c:1648  */
+#line 5539 "util/configparser.c"
     break;
 
-  case 445:
-#line 2371 "./util/configparser.y" /* yacc.c:1648  */
-    {
+  case 491: /* auth_master: VAR_MASTER STRING_ARG  */
+#line 2619 "util/configparser.y"
+        {
 		OUTYY(("P(master:%s)\n", (yyvsp[0].str)));
 		if(!cfg_strlist_insert(&cfg_parser->cfg->auths->masters, (yyvsp[0].str)))
 			yyerror("out of memory");
 	}
-#line 5287 "util/configparser.c" /* yacc.c:1648  */
+#line 5549 "util/configparser.c"
     break;
 
-  case 446:
-#line 2378 "./util/configparser.y" /* yacc.c:1648  */
-    {
+  case 492: /* auth_url: VAR_URL STRING_ARG  */
+#line 2626 "util/configparser.y"
+        {
 		OUTYY(("P(url:%s)\n", (yyvsp[0].str)));
 		if(!cfg_strlist_insert(&cfg_parser->cfg->auths->urls, (yyvsp[0].str)))
 			yyerror("out of memory");
 	}
-#line 5297 "util/configparser.c" /* yacc.c:1648  */
+#line 5559 "util/configparser.c"
     break;
 
-  case 447:
-#line 2385 "./util/configparser.y" /* yacc.c:1648  */
-    {
+  case 493: /* auth_allow_notify: VAR_ALLOW_NOTIFY STRING_ARG  */
+#line 2633 "util/configparser.y"
+        {
 		OUTYY(("P(allow-notify:%s)\n", (yyvsp[0].str)));
 		if(!cfg_strlist_insert(&cfg_parser->cfg->auths->allow_notify,
 			(yyvsp[0].str)))
 			yyerror("out of memory");
 	}
-#line 5308 "util/configparser.c" /* yacc.c:1648  */
+#line 5570 "util/configparser.c"
     break;
 
-  case 448:
-#line 2393 "./util/configparser.y" /* yacc.c:1648  */
-    {
+  case 494: /* auth_for_downstream: VAR_FOR_DOWNSTREAM STRING_ARG  */
+#line 2641 "util/configparser.y"
+        {
 		OUTYY(("P(for-downstream:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
@@ -5317,12 +5579,12 @@ yyreduce:
 			(strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 5321 "util/configparser.c" /* yacc.c:1648  */
+#line 5583 "util/configparser.c"
     break;
 
-  case 449:
-#line 2403 "./util/configparser.y" /* yacc.c:1648  */
-    {
+  case 495: /* auth_for_upstream: VAR_FOR_UPSTREAM STRING_ARG  */
+#line 2651 "util/configparser.y"
+        {
 		OUTYY(("P(for-upstream:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
@@ -5330,12 +5592,12 @@ yyreduce:
 			(strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 5334 "util/configparser.c" /* yacc.c:1648  */
+#line 5596 "util/configparser.c"
     break;
 
-  case 450:
-#line 2413 "./util/configparser.y" /* yacc.c:1648  */
-    {
+  case 496: /* auth_fallback_enabled: VAR_FALLBACK_ENABLED STRING_ARG  */
+#line 2661 "util/configparser.y"
+        {
 		OUTYY(("P(fallback-enabled:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
@@ -5343,12 +5605,12 @@ yyreduce:
 			(strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 5347 "util/configparser.c" /* yacc.c:1648  */
+#line 5609 "util/configparser.c"
     break;
 
-  case 451:
-#line 2423 "./util/configparser.y" /* yacc.c:1648  */
-    {
+  case 497: /* view_name: VAR_NAME STRING_ARG  */
+#line 2671 "util/configparser.y"
+        {
 		OUTYY(("P(name:%s)\n", (yyvsp[0].str)));
 		if(cfg_parser->cfg->views->name)
 			yyerror("view name override, there must be one "
@@ -5356,12 +5618,12 @@ yyreduce:
 		free(cfg_parser->cfg->views->name);
 		cfg_parser->cfg->views->name = (yyvsp[0].str);
 	}
-#line 5360 "util/configparser.c" /* yacc.c:1648  */
+#line 5622 "util/configparser.c"
     break;
 
-  case 452:
-#line 2433 "./util/configparser.y" /* yacc.c:1648  */
-    {
+  case 498: /* view_local_zone: VAR_LOCAL_ZONE STRING_ARG STRING_ARG  */
+#line 2681 "util/configparser.y"
+        {
 		OUTYY(("P(view_local_zone:%s %s)\n", (yyvsp[-1].str), (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "static")!=0 && strcmp((yyvsp[0].str), "deny")!=0 &&
 		   strcmp((yyvsp[0].str), "refuse")!=0 && strcmp((yyvsp[0].str), "redirect")!=0 &&
@@ -5391,12 +5653,12 @@ yyreduce:
 				fatal_exit("out of memory adding local-zone");
 		}
 	}
-#line 5395 "util/configparser.c" /* yacc.c:1648  */
+#line 5657 "util/configparser.c"
     break;
 
-  case 453:
-#line 2465 "./util/configparser.y" /* yacc.c:1648  */
-    {
+  case 499: /* view_response_ip: VAR_RESPONSE_IP STRING_ARG STRING_ARG  */
+#line 2713 "util/configparser.y"
+        {
 		OUTYY(("P(view_response_ip:%s %s)\n", (yyvsp[-1].str), (yyvsp[0].str)));
 		validate_respip_action((yyvsp[0].str));
 		if(!cfg_str2list_insert(
@@ -5404,34 +5666,34 @@ yyreduce:
 			fatal_exit("out of memory adding per-view "
 				"response-ip action");
 	}
-#line 5408 "util/configparser.c" /* yacc.c:1648  */
+#line 5670 "util/configparser.c"
     break;
 
-  case 454:
-#line 2475 "./util/configparser.y" /* yacc.c:1648  */
-    {
+  case 500: /* view_response_ip_data: VAR_RESPONSE_IP_DATA STRING_ARG STRING_ARG  */
+#line 2723 "util/configparser.y"
+        {
 		OUTYY(("P(view_response_ip_data:%s)\n", (yyvsp[-1].str)));
 		if(!cfg_str2list_insert(
 			&cfg_parser->cfg->views->respip_data, (yyvsp[-1].str), (yyvsp[0].str)))
 			fatal_exit("out of memory adding response-ip-data");
 	}
-#line 5419 "util/configparser.c" /* yacc.c:1648  */
+#line 5681 "util/configparser.c"
     break;
 
-  case 455:
-#line 2483 "./util/configparser.y" /* yacc.c:1648  */
-    {
+  case 501: /* view_local_data: VAR_LOCAL_DATA STRING_ARG  */
+#line 2731 "util/configparser.y"
+        {
 		OUTYY(("P(view_local_data:%s)\n", (yyvsp[0].str)));
 		if(!cfg_strlist_insert(&cfg_parser->cfg->views->local_data, (yyvsp[0].str))) {
 			fatal_exit("out of memory adding local-data");
 		}
 	}
-#line 5430 "util/configparser.c" /* yacc.c:1648  */
+#line 5692 "util/configparser.c"
     break;
 
-  case 456:
-#line 2491 "./util/configparser.y" /* yacc.c:1648  */
-    {
+  case 502: /* view_local_data_ptr: VAR_LOCAL_DATA_PTR STRING_ARG  */
+#line 2739 "util/configparser.y"
+        {
 		char* ptr;
 		OUTYY(("P(view_local_data_ptr:%s)\n", (yyvsp[0].str)));
 		ptr = cfg_ptr_reverse((yyvsp[0].str));
@@ -5444,32 +5706,32 @@ yyreduce:
 			yyerror("local-data-ptr could not be reversed");
 		}
 	}
-#line 5448 "util/configparser.c" /* yacc.c:1648  */
+#line 5710 "util/configparser.c"
     break;
 
-  case 457:
-#line 2506 "./util/configparser.y" /* yacc.c:1648  */
-    {
+  case 503: /* view_first: VAR_VIEW_FIRST STRING_ARG  */
+#line 2754 "util/configparser.y"
+        {
 		OUTYY(("P(view-first:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
 		else cfg_parser->cfg->views->isfirst=(strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 5460 "util/configparser.c" /* yacc.c:1648  */
+#line 5722 "util/configparser.c"
     break;
 
-  case 458:
-#line 2515 "./util/configparser.y" /* yacc.c:1648  */
-    { 
+  case 504: /* rcstart: VAR_REMOTE_CONTROL  */
+#line 2763 "util/configparser.y"
+        { 
 		OUTYY(("\nP(remote-control:)\n")); 
 	}
-#line 5468 "util/configparser.c" /* yacc.c:1648  */
+#line 5730 "util/configparser.c"
     break;
 
-  case 469:
-#line 2526 "./util/configparser.y" /* yacc.c:1648  */
-    {
+  case 515: /* rc_control_enable: VAR_CONTROL_ENABLE STRING_ARG  */
+#line 2774 "util/configparser.y"
+        {
 		OUTYY(("P(control_enable:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
@@ -5477,158 +5739,158 @@ yyreduce:
 			(strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 5481 "util/configparser.c" /* yacc.c:1648  */
+#line 5743 "util/configparser.c"
     break;
 
-  case 470:
-#line 2536 "./util/configparser.y" /* yacc.c:1648  */
-    {
+  case 516: /* rc_control_port: VAR_CONTROL_PORT STRING_ARG  */
+#line 2784 "util/configparser.y"
+        {
 		OUTYY(("P(control_port:%s)\n", (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0)
 			yyerror("control port number expected");
 		else cfg_parser->cfg->control_port = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 5493 "util/configparser.c" /* yacc.c:1648  */
+#line 5755 "util/configparser.c"
     break;
 
-  case 471:
-#line 2545 "./util/configparser.y" /* yacc.c:1648  */
-    {
+  case 517: /* rc_control_interface: VAR_CONTROL_INTERFACE STRING_ARG  */
+#line 2793 "util/configparser.y"
+        {
 		OUTYY(("P(control_interface:%s)\n", (yyvsp[0].str)));
 		if(!cfg_strlist_append(&cfg_parser->cfg->control_ifs, (yyvsp[0].str)))
 			yyerror("out of memory");
 	}
-#line 5503 "util/configparser.c" /* yacc.c:1648  */
+#line 5765 "util/configparser.c"
     break;
 
-  case 472:
-#line 2552 "./util/configparser.y" /* yacc.c:1648  */
-    {
+  case 518: /* rc_control_use_cert: VAR_CONTROL_USE_CERT STRING_ARG  */
+#line 2800 "util/configparser.y"
+        {
 		OUTYY(("P(control_use_cert:%s)\n", (yyvsp[0].str)));
 		cfg_parser->cfg->control_use_cert = (strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 5513 "util/configparser.c" /* yacc.c:1648  */
+#line 5775 "util/configparser.c"
     break;
 
-  case 473:
-#line 2559 "./util/configparser.y" /* yacc.c:1648  */
-    {
+  case 519: /* rc_server_key_file: VAR_SERVER_KEY_FILE STRING_ARG  */
+#line 2807 "util/configparser.y"
+        {
 		OUTYY(("P(rc_server_key_file:%s)\n", (yyvsp[0].str)));
 		free(cfg_parser->cfg->server_key_file);
 		cfg_parser->cfg->server_key_file = (yyvsp[0].str);
 	}
-#line 5523 "util/configparser.c" /* yacc.c:1648  */
+#line 5785 "util/configparser.c"
     break;
 
-  case 474:
-#line 2566 "./util/configparser.y" /* yacc.c:1648  */
-    {
+  case 520: /* rc_server_cert_file: VAR_SERVER_CERT_FILE STRING_ARG  */
+#line 2814 "util/configparser.y"
+        {
 		OUTYY(("P(rc_server_cert_file:%s)\n", (yyvsp[0].str)));
 		free(cfg_parser->cfg->server_cert_file);
 		cfg_parser->cfg->server_cert_file = (yyvsp[0].str);
 	}
-#line 5533 "util/configparser.c" /* yacc.c:1648  */
+#line 5795 "util/configparser.c"
     break;
 
-  case 475:
-#line 2573 "./util/configparser.y" /* yacc.c:1648  */
-    {
+  case 521: /* rc_control_key_file: VAR_CONTROL_KEY_FILE STRING_ARG  */
+#line 2821 "util/configparser.y"
+        {
 		OUTYY(("P(rc_control_key_file:%s)\n", (yyvsp[0].str)));
 		free(cfg_parser->cfg->control_key_file);
 		cfg_parser->cfg->control_key_file = (yyvsp[0].str);
 	}
-#line 5543 "util/configparser.c" /* yacc.c:1648  */
+#line 5805 "util/configparser.c"
     break;
 
-  case 476:
-#line 2580 "./util/configparser.y" /* yacc.c:1648  */
-    {
+  case 522: /* rc_control_cert_file: VAR_CONTROL_CERT_FILE STRING_ARG  */
+#line 2828 "util/configparser.y"
+        {
 		OUTYY(("P(rc_control_cert_file:%s)\n", (yyvsp[0].str)));
 		free(cfg_parser->cfg->control_cert_file);
 		cfg_parser->cfg->control_cert_file = (yyvsp[0].str);
 	}
-#line 5553 "util/configparser.c" /* yacc.c:1648  */
+#line 5815 "util/configparser.c"
     break;
 
-  case 477:
-#line 2587 "./util/configparser.y" /* yacc.c:1648  */
-    {
+  case 523: /* dtstart: VAR_DNSTAP  */
+#line 2835 "util/configparser.y"
+        {
 		OUTYY(("\nP(dnstap:)\n"));
 	}
-#line 5561 "util/configparser.c" /* yacc.c:1648  */
+#line 5823 "util/configparser.c"
     break;
 
-  case 492:
-#line 2604 "./util/configparser.y" /* yacc.c:1648  */
-    {
+  case 538: /* dt_dnstap_enable: VAR_DNSTAP_ENABLE STRING_ARG  */
+#line 2852 "util/configparser.y"
+        {
 		OUTYY(("P(dt_dnstap_enable:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
 		else cfg_parser->cfg->dnstap = (strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 5573 "util/configparser.c" /* yacc.c:1648  */
+#line 5835 "util/configparser.c"
     break;
 
-  case 493:
-#line 2613 "./util/configparser.y" /* yacc.c:1648  */
-    {
+  case 539: /* dt_dnstap_socket_path: VAR_DNSTAP_SOCKET_PATH STRING_ARG  */
+#line 2861 "util/configparser.y"
+        {
 		OUTYY(("P(dt_dnstap_socket_path:%s)\n", (yyvsp[0].str)));
 		free(cfg_parser->cfg->dnstap_socket_path);
 		cfg_parser->cfg->dnstap_socket_path = (yyvsp[0].str);
 	}
-#line 5583 "util/configparser.c" /* yacc.c:1648  */
+#line 5845 "util/configparser.c"
     break;
 
-  case 494:
-#line 2620 "./util/configparser.y" /* yacc.c:1648  */
-    {
+  case 540: /* dt_dnstap_send_identity: VAR_DNSTAP_SEND_IDENTITY STRING_ARG  */
+#line 2868 "util/configparser.y"
+        {
 		OUTYY(("P(dt_dnstap_send_identity:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
 		else cfg_parser->cfg->dnstap_send_identity = (strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 5595 "util/configparser.c" /* yacc.c:1648  */
+#line 5857 "util/configparser.c"
     break;
 
-  case 495:
-#line 2629 "./util/configparser.y" /* yacc.c:1648  */
-    {
+  case 541: /* dt_dnstap_send_version: VAR_DNSTAP_SEND_VERSION STRING_ARG  */
+#line 2877 "util/configparser.y"
+        {
 		OUTYY(("P(dt_dnstap_send_version:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
 		else cfg_parser->cfg->dnstap_send_version = (strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 5607 "util/configparser.c" /* yacc.c:1648  */
+#line 5869 "util/configparser.c"
     break;
 
-  case 496:
-#line 2638 "./util/configparser.y" /* yacc.c:1648  */
-    {
+  case 542: /* dt_dnstap_identity: VAR_DNSTAP_IDENTITY STRING_ARG  */
+#line 2886 "util/configparser.y"
+        {
 		OUTYY(("P(dt_dnstap_identity:%s)\n", (yyvsp[0].str)));
 		free(cfg_parser->cfg->dnstap_identity);
 		cfg_parser->cfg->dnstap_identity = (yyvsp[0].str);
 	}
-#line 5617 "util/configparser.c" /* yacc.c:1648  */
+#line 5879 "util/configparser.c"
     break;
 
-  case 497:
-#line 2645 "./util/configparser.y" /* yacc.c:1648  */
-    {
+  case 543: /* dt_dnstap_version: VAR_DNSTAP_VERSION STRING_ARG  */
+#line 2893 "util/configparser.y"
+        {
 		OUTYY(("P(dt_dnstap_version:%s)\n", (yyvsp[0].str)));
 		free(cfg_parser->cfg->dnstap_version);
 		cfg_parser->cfg->dnstap_version = (yyvsp[0].str);
 	}
-#line 5627 "util/configparser.c" /* yacc.c:1648  */
+#line 5889 "util/configparser.c"
     break;
 
-  case 498:
-#line 2652 "./util/configparser.y" /* yacc.c:1648  */
-    {
+  case 544: /* dt_dnstap_log_resolver_query_messages: VAR_DNSTAP_LOG_RESOLVER_QUERY_MESSAGES STRING_ARG  */
+#line 2900 "util/configparser.y"
+        {
 		OUTYY(("P(dt_dnstap_log_resolver_query_messages:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
@@ -5636,12 +5898,12 @@ yyreduce:
 			(strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 5640 "util/configparser.c" /* yacc.c:1648  */
+#line 5902 "util/configparser.c"
     break;
 
-  case 499:
-#line 2662 "./util/configparser.y" /* yacc.c:1648  */
-    {
+  case 545: /* dt_dnstap_log_resolver_response_messages: VAR_DNSTAP_LOG_RESOLVER_RESPONSE_MESSAGES STRING_ARG  */
+#line 2910 "util/configparser.y"
+        {
 		OUTYY(("P(dt_dnstap_log_resolver_response_messages:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
@@ -5649,12 +5911,12 @@ yyreduce:
 			(strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 5653 "util/configparser.c" /* yacc.c:1648  */
+#line 5915 "util/configparser.c"
     break;
 
-  case 500:
-#line 2672 "./util/configparser.y" /* yacc.c:1648  */
-    {
+  case 546: /* dt_dnstap_log_client_query_messages: VAR_DNSTAP_LOG_CLIENT_QUERY_MESSAGES STRING_ARG  */
+#line 2920 "util/configparser.y"
+        {
 		OUTYY(("P(dt_dnstap_log_client_query_messages:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
@@ -5662,12 +5924,12 @@ yyreduce:
 			(strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 5666 "util/configparser.c" /* yacc.c:1648  */
+#line 5928 "util/configparser.c"
     break;
 
-  case 501:
-#line 2682 "./util/configparser.y" /* yacc.c:1648  */
-    {
+  case 547: /* dt_dnstap_log_client_response_messages: VAR_DNSTAP_LOG_CLIENT_RESPONSE_MESSAGES STRING_ARG  */
+#line 2930 "util/configparser.y"
+        {
 		OUTYY(("P(dt_dnstap_log_client_response_messages:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
@@ -5675,12 +5937,12 @@ yyreduce:
 			(strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 5679 "util/configparser.c" /* yacc.c:1648  */
+#line 5941 "util/configparser.c"
     break;
 
-  case 502:
-#line 2692 "./util/configparser.y" /* yacc.c:1648  */
-    {
+  case 548: /* dt_dnstap_log_forwarder_query_messages: VAR_DNSTAP_LOG_FORWARDER_QUERY_MESSAGES STRING_ARG  */
+#line 2940 "util/configparser.y"
+        {
 		OUTYY(("P(dt_dnstap_log_forwarder_query_messages:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
@@ -5688,12 +5950,12 @@ yyreduce:
 			(strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 5692 "util/configparser.c" /* yacc.c:1648  */
+#line 5954 "util/configparser.c"
     break;
 
-  case 503:
-#line 2702 "./util/configparser.y" /* yacc.c:1648  */
-    {
+  case 549: /* dt_dnstap_log_forwarder_response_messages: VAR_DNSTAP_LOG_FORWARDER_RESPONSE_MESSAGES STRING_ARG  */
+#line 2950 "util/configparser.y"
+        {
 		OUTYY(("P(dt_dnstap_log_forwarder_response_messages:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
@@ -5701,30 +5963,30 @@ yyreduce:
 			(strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 5705 "util/configparser.c" /* yacc.c:1648  */
+#line 5967 "util/configparser.c"
     break;
 
-  case 504:
-#line 2712 "./util/configparser.y" /* yacc.c:1648  */
-    { 
+  case 550: /* pythonstart: VAR_PYTHON  */
+#line 2960 "util/configparser.y"
+        { 
 		OUTYY(("\nP(python:)\n")); 
 	}
-#line 5713 "util/configparser.c" /* yacc.c:1648  */
+#line 5975 "util/configparser.c"
     break;
 
-  case 508:
-#line 2721 "./util/configparser.y" /* yacc.c:1648  */
-    {
+  case 554: /* py_script: VAR_PYTHON_SCRIPT STRING_ARG  */
+#line 2969 "util/configparser.y"
+        {
 		OUTYY(("P(python-script:%s)\n", (yyvsp[0].str)));
 		if(!cfg_strlist_append_ex(&cfg_parser->cfg->python_script, (yyvsp[0].str)))
 			yyerror("out of memory");
 	}
-#line 5723 "util/configparser.c" /* yacc.c:1648  */
+#line 5985 "util/configparser.c"
     break;
 
-  case 509:
-#line 2727 "./util/configparser.y" /* yacc.c:1648  */
-    {
+  case 555: /* server_disable_dnssec_lame_check: VAR_DISABLE_DNSSEC_LAME_CHECK STRING_ARG  */
+#line 2975 "util/configparser.y"
+        {
 		OUTYY(("P(disable_dnssec_lame_check:%s)\n", (yyvsp[0].str)));
 		if (strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
@@ -5732,132 +5994,132 @@ yyreduce:
 			(strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 5736 "util/configparser.c" /* yacc.c:1648  */
+#line 5998 "util/configparser.c"
     break;
 
-  case 510:
-#line 2737 "./util/configparser.y" /* yacc.c:1648  */
-    {
+  case 556: /* server_log_identity: VAR_LOG_IDENTITY STRING_ARG  */
+#line 2985 "util/configparser.y"
+        {
 		OUTYY(("P(server_log_identity:%s)\n", (yyvsp[0].str)));
 		free(cfg_parser->cfg->log_identity);
 		cfg_parser->cfg->log_identity = (yyvsp[0].str);
 	}
-#line 5746 "util/configparser.c" /* yacc.c:1648  */
+#line 6008 "util/configparser.c"
     break;
 
-  case 511:
-#line 2744 "./util/configparser.y" /* yacc.c:1648  */
-    {
+  case 557: /* server_response_ip: VAR_RESPONSE_IP STRING_ARG STRING_ARG  */
+#line 2992 "util/configparser.y"
+        {
 		OUTYY(("P(server_response_ip:%s %s)\n", (yyvsp[-1].str), (yyvsp[0].str)));
 		validate_respip_action((yyvsp[0].str));
 		if(!cfg_str2list_insert(&cfg_parser->cfg->respip_actions,
 			(yyvsp[-1].str), (yyvsp[0].str)))
 			fatal_exit("out of memory adding response-ip");
 	}
-#line 5758 "util/configparser.c" /* yacc.c:1648  */
+#line 6020 "util/configparser.c"
     break;
 
-  case 512:
-#line 2753 "./util/configparser.y" /* yacc.c:1648  */
-    {
+  case 558: /* server_response_ip_data: VAR_RESPONSE_IP_DATA STRING_ARG STRING_ARG  */
+#line 3001 "util/configparser.y"
+        {
 		OUTYY(("P(server_response_ip_data:%s)\n", (yyvsp[-1].str)));
 		if(!cfg_str2list_insert(&cfg_parser->cfg->respip_data,
 			(yyvsp[-1].str), (yyvsp[0].str)))
 			fatal_exit("out of memory adding response-ip-data");
 	}
-#line 5769 "util/configparser.c" /* yacc.c:1648  */
+#line 6031 "util/configparser.c"
     break;
 
-  case 513:
-#line 2761 "./util/configparser.y" /* yacc.c:1648  */
-    {
+  case 559: /* dnscstart: VAR_DNSCRYPT  */
+#line 3009 "util/configparser.y"
+        {
 		OUTYY(("\nP(dnscrypt:)\n"));
 	}
-#line 5777 "util/configparser.c" /* yacc.c:1648  */
+#line 6039 "util/configparser.c"
     break;
 
-  case 526:
-#line 2777 "./util/configparser.y" /* yacc.c:1648  */
-    {
+  case 572: /* dnsc_dnscrypt_enable: VAR_DNSCRYPT_ENABLE STRING_ARG  */
+#line 3025 "util/configparser.y"
+        {
 		OUTYY(("P(dnsc_dnscrypt_enable:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
 		else cfg_parser->cfg->dnscrypt = (strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 5789 "util/configparser.c" /* yacc.c:1648  */
+#line 6051 "util/configparser.c"
     break;
 
-  case 527:
-#line 2787 "./util/configparser.y" /* yacc.c:1648  */
-    {
+  case 573: /* dnsc_dnscrypt_port: VAR_DNSCRYPT_PORT STRING_ARG  */
+#line 3035 "util/configparser.y"
+        {
 		OUTYY(("P(dnsc_dnscrypt_port:%s)\n", (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0)
 			yyerror("port number expected");
 		else cfg_parser->cfg->dnscrypt_port = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 5801 "util/configparser.c" /* yacc.c:1648  */
+#line 6063 "util/configparser.c"
     break;
 
-  case 528:
-#line 2796 "./util/configparser.y" /* yacc.c:1648  */
-    {
+  case 574: /* dnsc_dnscrypt_provider: VAR_DNSCRYPT_PROVIDER STRING_ARG  */
+#line 3044 "util/configparser.y"
+        {
 		OUTYY(("P(dnsc_dnscrypt_provider:%s)\n", (yyvsp[0].str)));
 		free(cfg_parser->cfg->dnscrypt_provider);
 		cfg_parser->cfg->dnscrypt_provider = (yyvsp[0].str);
 	}
-#line 5811 "util/configparser.c" /* yacc.c:1648  */
+#line 6073 "util/configparser.c"
     break;
 
-  case 529:
-#line 2803 "./util/configparser.y" /* yacc.c:1648  */
-    {
+  case 575: /* dnsc_dnscrypt_provider_cert: VAR_DNSCRYPT_PROVIDER_CERT STRING_ARG  */
+#line 3051 "util/configparser.y"
+        {
 		OUTYY(("P(dnsc_dnscrypt_provider_cert:%s)\n", (yyvsp[0].str)));
 		if(cfg_strlist_find(cfg_parser->cfg->dnscrypt_provider_cert, (yyvsp[0].str)))
 			log_warn("dnscrypt-provider-cert %s is a duplicate", (yyvsp[0].str));
 		if(!cfg_strlist_insert(&cfg_parser->cfg->dnscrypt_provider_cert, (yyvsp[0].str)))
 			fatal_exit("out of memory adding dnscrypt-provider-cert");
 	}
-#line 5823 "util/configparser.c" /* yacc.c:1648  */
+#line 6085 "util/configparser.c"
     break;
 
-  case 530:
-#line 2812 "./util/configparser.y" /* yacc.c:1648  */
-    {
+  case 576: /* dnsc_dnscrypt_provider_cert_rotated: VAR_DNSCRYPT_PROVIDER_CERT_ROTATED STRING_ARG  */
+#line 3060 "util/configparser.y"
+        {
 		OUTYY(("P(dnsc_dnscrypt_provider_cert_rotated:%s)\n", (yyvsp[0].str)));
 		if(!cfg_strlist_insert(&cfg_parser->cfg->dnscrypt_provider_cert_rotated, (yyvsp[0].str)))
 			fatal_exit("out of memory adding dnscrypt-provider-cert-rotated");
 	}
-#line 5833 "util/configparser.c" /* yacc.c:1648  */
+#line 6095 "util/configparser.c"
     break;
 
-  case 531:
-#line 2819 "./util/configparser.y" /* yacc.c:1648  */
-    {
+  case 577: /* dnsc_dnscrypt_secret_key: VAR_DNSCRYPT_SECRET_KEY STRING_ARG  */
+#line 3067 "util/configparser.y"
+        {
 		OUTYY(("P(dnsc_dnscrypt_secret_key:%s)\n", (yyvsp[0].str)));
 		if(cfg_strlist_find(cfg_parser->cfg->dnscrypt_secret_key, (yyvsp[0].str)))
 			log_warn("dnscrypt-secret-key: %s is a duplicate", (yyvsp[0].str));
 		if(!cfg_strlist_insert(&cfg_parser->cfg->dnscrypt_secret_key, (yyvsp[0].str)))
 			fatal_exit("out of memory adding dnscrypt-secret-key");
 	}
-#line 5845 "util/configparser.c" /* yacc.c:1648  */
+#line 6107 "util/configparser.c"
     break;
 
-  case 532:
-#line 2828 "./util/configparser.y" /* yacc.c:1648  */
-    {
+  case 578: /* dnsc_dnscrypt_shared_secret_cache_size: VAR_DNSCRYPT_SHARED_SECRET_CACHE_SIZE STRING_ARG  */
+#line 3076 "util/configparser.y"
+  {
   	OUTYY(("P(dnscrypt_shared_secret_cache_size:%s)\n", (yyvsp[0].str)));
   	if(!cfg_parse_memsize((yyvsp[0].str), &cfg_parser->cfg->dnscrypt_shared_secret_cache_size))
   		yyerror("memory size expected");
   	free((yyvsp[0].str));
   }
-#line 5856 "util/configparser.c" /* yacc.c:1648  */
+#line 6118 "util/configparser.c"
     break;
 
-  case 533:
-#line 2836 "./util/configparser.y" /* yacc.c:1648  */
-    {
+  case 579: /* dnsc_dnscrypt_shared_secret_cache_slabs: VAR_DNSCRYPT_SHARED_SECRET_CACHE_SLABS STRING_ARG  */
+#line 3084 "util/configparser.y"
+  {
   	OUTYY(("P(dnscrypt_shared_secret_cache_slabs:%s)\n", (yyvsp[0].str)));
   	if(atoi((yyvsp[0].str)) == 0)
   		yyerror("number expected");
@@ -5868,23 +6130,23 @@ yyreduce:
   	}
   	free((yyvsp[0].str));
   }
-#line 5872 "util/configparser.c" /* yacc.c:1648  */
+#line 6134 "util/configparser.c"
     break;
 
-  case 534:
-#line 2849 "./util/configparser.y" /* yacc.c:1648  */
-    {
+  case 580: /* dnsc_dnscrypt_nonce_cache_size: VAR_DNSCRYPT_NONCE_CACHE_SIZE STRING_ARG  */
+#line 3097 "util/configparser.y"
+  {
   	OUTYY(("P(dnscrypt_nonce_cache_size:%s)\n", (yyvsp[0].str)));
   	if(!cfg_parse_memsize((yyvsp[0].str), &cfg_parser->cfg->dnscrypt_nonce_cache_size))
   		yyerror("memory size expected");
   	free((yyvsp[0].str));
   }
-#line 5883 "util/configparser.c" /* yacc.c:1648  */
+#line 6145 "util/configparser.c"
     break;
 
-  case 535:
-#line 2857 "./util/configparser.y" /* yacc.c:1648  */
-    {
+  case 581: /* dnsc_dnscrypt_nonce_cache_slabs: VAR_DNSCRYPT_NONCE_CACHE_SLABS STRING_ARG  */
+#line 3105 "util/configparser.y"
+  {
   	OUTYY(("P(dnscrypt_nonce_cache_slabs:%s)\n", (yyvsp[0].str)));
   	if(atoi((yyvsp[0].str)) == 0)
   		yyerror("number expected");
@@ -5895,20 +6157,20 @@ yyreduce:
   	}
   	free((yyvsp[0].str));
   }
-#line 5899 "util/configparser.c" /* yacc.c:1648  */
+#line 6161 "util/configparser.c"
     break;
 
-  case 536:
-#line 2870 "./util/configparser.y" /* yacc.c:1648  */
-    {
+  case 582: /* cachedbstart: VAR_CACHEDB  */
+#line 3118 "util/configparser.y"
+        {
 		OUTYY(("\nP(cachedb:)\n"));
 	}
-#line 5907 "util/configparser.c" /* yacc.c:1648  */
+#line 6169 "util/configparser.c"
     break;
 
-  case 544:
-#line 2880 "./util/configparser.y" /* yacc.c:1648  */
-    {
+  case 590: /* cachedb_backend_name: VAR_CACHEDB_BACKEND STRING_ARG  */
+#line 3128 "util/configparser.y"
+        {
 	#ifdef USE_CACHEDB
 		OUTYY(("P(backend:%s)\n", (yyvsp[0].str)));
 		if(cfg_parser->cfg->cachedb_backend)
@@ -5921,12 +6183,12 @@ yyreduce:
 		free((yyvsp[0].str));
 	#endif
 	}
-#line 5925 "util/configparser.c" /* yacc.c:1648  */
+#line 6187 "util/configparser.c"
     break;
 
-  case 545:
-#line 2895 "./util/configparser.y" /* yacc.c:1648  */
-    {
+  case 591: /* cachedb_secret_seed: VAR_CACHEDB_SECRETSEED STRING_ARG  */
+#line 3143 "util/configparser.y"
+        {
 	#ifdef USE_CACHEDB
 		OUTYY(("P(secret-seed:%s)\n", (yyvsp[0].str)));
 		if(cfg_parser->cfg->cachedb_secret)
@@ -5939,12 +6201,12 @@ yyreduce:
 		free((yyvsp[0].str));
 	#endif
 	}
-#line 5943 "util/configparser.c" /* yacc.c:1648  */
+#line 6205 "util/configparser.c"
     break;
 
-  case 546:
-#line 2910 "./util/configparser.y" /* yacc.c:1648  */
-    {
+  case 592: /* redis_server_host: VAR_CACHEDB_REDISHOST STRING_ARG  */
+#line 3158 "util/configparser.y"
+        {
 	#if defined(USE_CACHEDB) && defined(USE_REDIS)
 		OUTYY(("P(redis_server_host:%s)\n", (yyvsp[0].str)));
 		free(cfg_parser->cfg->redis_server_host);
@@ -5954,12 +6216,12 @@ yyreduce:
 		free((yyvsp[0].str));
 	#endif
 	}
-#line 5958 "util/configparser.c" /* yacc.c:1648  */
+#line 6220 "util/configparser.c"
     break;
 
-  case 547:
-#line 2922 "./util/configparser.y" /* yacc.c:1648  */
-    {
+  case 593: /* redis_server_port: VAR_CACHEDB_REDISPORT STRING_ARG  */
+#line 3170 "util/configparser.y"
+        {
 	#if defined(USE_CACHEDB) && defined(USE_REDIS)
 		int port;
 		OUTYY(("P(redis_server_port:%s)\n", (yyvsp[0].str)));
@@ -5972,12 +6234,12 @@ yyreduce:
 	#endif
 		free((yyvsp[0].str));
 	}
-#line 5976 "util/configparser.c" /* yacc.c:1648  */
+#line 6238 "util/configparser.c"
     break;
 
-  case 548:
-#line 2937 "./util/configparser.y" /* yacc.c:1648  */
-    {
+  case 594: /* redis_timeout: VAR_CACHEDB_REDISTIMEOUT STRING_ARG  */
+#line 3185 "util/configparser.y"
+        {
 	#if defined(USE_CACHEDB) && defined(USE_REDIS)
 		OUTYY(("P(redis_timeout:%s)\n", (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0)
@@ -5988,12 +6250,12 @@ yyreduce:
 	#endif
 		free((yyvsp[0].str));
 	}
-#line 5992 "util/configparser.c" /* yacc.c:1648  */
+#line 6254 "util/configparser.c"
     break;
 
-  case 549:
-#line 2950 "./util/configparser.y" /* yacc.c:1648  */
-    {
+  case 595: /* server_tcp_connection_limit: VAR_TCP_CONNECTION_LIMIT STRING_ARG STRING_ARG  */
+#line 3198 "util/configparser.y"
+        {
 		OUTYY(("P(server_tcp_connection_limit:%s %s)\n", (yyvsp[-1].str), (yyvsp[0].str)));
 		if (atoi((yyvsp[0].str)) < 0)
 			yyerror("positive number expected");
@@ -6002,11 +6264,12 @@ yyreduce:
 				fatal_exit("out of memory adding tcp connection limit");
 		}
 	}
-#line 6006 "util/configparser.c" /* yacc.c:1648  */
+#line 6268 "util/configparser.c"
     break;
 
 
-#line 6010 "util/configparser.c" /* yacc.c:1648  */
+#line 6272 "util/configparser.c"
+
       default: break;
     }
   /* User semantic actions sometimes alter yychar, and that requires
@@ -6020,25 +6283,23 @@ yyreduce:
      case of YYERROR or YYBACKUP, subsequent parser actions might lead
      to an incorrect destructor call or verbose syntax error message
      before the lookahead is translated.  */
-  YY_SYMBOL_PRINT ("-> $$ =", yyr1[yyn], &yyval, &yyloc);
+  YY_SYMBOL_PRINT ("-> $$ =", YY_CAST (yysymbol_kind_t, yyr1[yyn]), &yyval, &yyloc);
 
   YYPOPSTACK (yylen);
   yylen = 0;
-  YY_STACK_PRINT (yyss, yyssp);
 
   *++yyvsp = yyval;
 
   /* Now 'shift' the result of the reduction.  Determine what state
      that goes to, based on the state we popped back to and the rule
      number reduced by.  */
-
-  yyn = yyr1[yyn];
-
-  yystate = yypgoto[yyn - YYNTOKENS] + *yyssp;
-  if (0 <= yystate && yystate <= YYLAST && yycheck[yystate] == *yyssp)
-    yystate = yytable[yystate];
-  else
-    yystate = yydefgoto[yyn - YYNTOKENS];
+  {
+    const int yylhs = yyr1[yyn] - YYNTOKENS;
+    const int yyi = yypgoto[yylhs] + *yyssp;
+    yystate = (0 <= yyi && yyi <= YYLAST && yycheck[yyi] == *yyssp
+               ? yytable[yyi]
+               : yydefgoto[yylhs]);
+  }
 
   goto yynewstate;
 
@@ -6049,50 +6310,14 @@ yyreduce:
 yyerrlab:
   /* Make sure we have latest lookahead translation.  See comments at
      user semantic actions for why this is necessary.  */
-  yytoken = yychar == YYEMPTY ? YYEMPTY : YYTRANSLATE (yychar);
-
+  yytoken = yychar == YYEMPTY ? YYSYMBOL_YYEMPTY : YYTRANSLATE (yychar);
   /* If not already recovering from an error, report this error.  */
   if (!yyerrstatus)
     {
       ++yynerrs;
-#if ! YYERROR_VERBOSE
       yyerror (YY_("syntax error"));
-#else
-# define YYSYNTAX_ERROR yysyntax_error (&yymsg_alloc, &yymsg, \
-                                        yyssp, yytoken)
-      {
-        char const *yymsgp = YY_("syntax error");
-        int yysyntax_error_status;
-        yysyntax_error_status = YYSYNTAX_ERROR;
-        if (yysyntax_error_status == 0)
-          yymsgp = yymsg;
-        else if (yysyntax_error_status == 1)
-          {
-            if (yymsg != yymsgbuf)
-              YYSTACK_FREE (yymsg);
-            yymsg = (char *) YYSTACK_ALLOC (yymsg_alloc);
-            if (!yymsg)
-              {
-                yymsg = yymsgbuf;
-                yymsg_alloc = sizeof yymsgbuf;
-                yysyntax_error_status = 2;
-              }
-            else
-              {
-                yysyntax_error_status = YYSYNTAX_ERROR;
-                yymsgp = yymsg;
-              }
-          }
-        yyerror (yymsgp);
-        if (yysyntax_error_status == 2)
-          goto yyexhaustedlab;
-      }
-# undef YYSYNTAX_ERROR
-#endif
     }
 
-
-
   if (yyerrstatus == 3)
     {
       /* If just tried and failed to reuse lookahead token after an
@@ -6121,12 +6346,11 @@ yyerrlab:
 | yyerrorlab -- error raised explicitly by YYERROR.  |
 `---------------------------------------------------*/
 yyerrorlab:
-
-  /* Pacify compilers like GCC when the user code never invokes
-     YYERROR and the label yyerrorlab therefore never appears in user
-     code.  */
-  if (/*CONSTCOND*/ 0)
-     goto yyerrorlab;
+  /* Pacify compilers when the user code never invokes YYERROR and the
+     label yyerrorlab therefore never appears in user code.  */
+  if (0)
+    YYERROR;
+  ++yynerrs;
 
   /* Do not reclaim the symbols of the rule whose action triggered
      this YYERROR.  */
@@ -6143,13 +6367,14 @@ yyerrorlab:
 yyerrlab1:
   yyerrstatus = 3;      /* Each real token shifted decrements this.  */
 
+  /* Pop stack until we find a state that shifts the error token.  */
   for (;;)
     {
       yyn = yypact[yystate];
       if (!yypact_value_is_default (yyn))
         {
-          yyn += YYTERROR;
-          if (0 <= yyn && yyn <= YYLAST && yycheck[yyn] == YYTERROR)
+          yyn += YYSYMBOL_YYerror;
+          if (0 <= yyn && yyn <= YYLAST && yycheck[yyn] == YYSYMBOL_YYerror)
             {
               yyn = yytable[yyn];
               if (0 < yyn)
@@ -6163,7 +6388,7 @@ yyerrlab1:
 
 
       yydestruct ("Error: popping",
-                  yystos[yystate], yyvsp);
+                  YY_ACCESSING_SYMBOL (yystate), yyvsp);
       YYPOPSTACK (1);
       yystate = *yyssp;
       YY_STACK_PRINT (yyss, yyssp);
@@ -6175,7 +6400,7 @@ yyerrlab1:
 
 
   /* Shift the error token.  */
-  YY_SYMBOL_PRINT ("Shifting", yystos[yyn], yyvsp, yylsp);
+  YY_SYMBOL_PRINT ("Shifting", YY_ACCESSING_SYMBOL (yyn), yyvsp, yylsp);
 
   yystate = yyn;
   goto yynewstate;
@@ -6186,26 +6411,30 @@ yyerrlab1:
 `-------------------------------------*/
 yyacceptlab:
   yyresult = 0;
-  goto yyreturn;
+  goto yyreturnlab;
+
 
 /*-----------------------------------.
 | yyabortlab -- YYABORT comes here.  |
 `-----------------------------------*/
 yyabortlab:
   yyresult = 1;
-  goto yyreturn;
+  goto yyreturnlab;
 
-#if !defined yyoverflow || YYERROR_VERBOSE
-/*-------------------------------------------------.
-| yyexhaustedlab -- memory exhaustion comes here.  |
-`-------------------------------------------------*/
+
+/*-----------------------------------------------------------.
+| yyexhaustedlab -- YYNOMEM (memory exhaustion) comes here.  |
+`-----------------------------------------------------------*/
 yyexhaustedlab:
   yyerror (YY_("memory exhausted"));
   yyresult = 2;
-  /* Fall through.  */
-#endif
+  goto yyreturnlab;
 
-yyreturn:
+
+/*----------------------------------------------------------.
+| yyreturnlab -- parsing is finished, clean up and return.  |
+`----------------------------------------------------------*/
+yyreturnlab:
   if (yychar != YYEMPTY)
     {
       /* Make sure we have latest lookahead translation.  See comments at
@@ -6221,20 +6450,18 @@ yyreturn:
   while (yyssp != yyss)
     {
       yydestruct ("Cleanup: popping",
-                  yystos[*yyssp], yyvsp);
+                  YY_ACCESSING_SYMBOL (+*yyssp), yyvsp);
       YYPOPSTACK (1);
     }
 #ifndef yyoverflow
   if (yyss != yyssa)
     YYSTACK_FREE (yyss);
 #endif
-#if YYERROR_VERBOSE
-  if (yymsg != yymsgbuf)
-    YYSTACK_FREE (yymsg);
-#endif
+
   return yyresult;
 }
-#line 2960 "./util/configparser.y" /* yacc.c:1907  */
+
+#line 3208 "util/configparser.y"
 
 
 /* parse helper routines could be here */
@@ -1,8 +1,9 @@
-/* A Bison parser, made by GNU Bison 3.0.5.  */
+/* A Bison parser, made by GNU Bison 3.8.2.  */
 
 /* Bison interface for Yacc-like parsers in C
 
-   Copyright (C) 1984, 1989-1990, 2000-2015, 2018 Free Software Foundation, Inc.
+   Copyright (C) 1984, 1989-1990, 2000-2015, 2018-2021 Free Software Foundation,
+   Inc.
 
    This program is free software: you can redistribute it and/or modify
    it under the terms of the GNU General Public License as published by
@@ -15,7 +16,7 @@
    GNU General Public License for more details.
 
    You should have received a copy of the GNU General Public License
-   along with this program.  If not, see <http://www.gnu.org/licenses/>.  */
+   along with this program.  If not, see <https://www.gnu.org/licenses/>.  */
 
 /* As a special exception, you may create a larger work that contains
    part or all of the Bison parser skeleton and distribute that work
@@ -30,6 +31,10 @@
    This special exception was added by the Free Software Foundation in
    version 2.2 of Bison.  */
 
+/* DO NOT RELY ON FEATURES THAT ARE NOT DOCUMENTED in the manual,
+   especially those whose name start with YY_ or yy_.  They are
+   private implementation details that can be changed or removed.  */
+
 #ifndef YY_YY_UTIL_CONFIGPARSER_H_INCLUDED
 # define YY_YY_UTIL_CONFIGPARSER_H_INCLUDED
 /* Debug traces.  */
@@ -40,278 +45,310 @@
 extern int yydebug;
 #endif
 
-/* Token type.  */
+/* Token kinds.  */
 #ifndef YYTOKENTYPE
 # define YYTOKENTYPE
   enum yytokentype
   {
-    SPACE = 258,
-    LETTER = 259,
-    NEWLINE = 260,
-    COMMENT = 261,
-    COLON = 262,
-    ANY = 263,
-    ZONESTR = 264,
-    STRING_ARG = 265,
-    VAR_SERVER = 266,
-    VAR_VERBOSITY = 267,
-    VAR_NUM_THREADS = 268,
-    VAR_PORT = 269,
-    VAR_OUTGOING_RANGE = 270,
-    VAR_INTERFACE = 271,
-    VAR_DO_IP4 = 272,
-    VAR_DO_IP6 = 273,
-    VAR_PREFER_IP6 = 274,
-    VAR_DO_UDP = 275,
-    VAR_DO_TCP = 276,
-    VAR_TCP_MSS = 277,
-    VAR_OUTGOING_TCP_MSS = 278,
-    VAR_TCP_IDLE_TIMEOUT = 279,
-    VAR_EDNS_TCP_KEEPALIVE = 280,
-    VAR_EDNS_TCP_KEEPALIVE_TIMEOUT = 281,
-    VAR_CHROOT = 282,
-    VAR_USERNAME = 283,
-    VAR_DIRECTORY = 284,
-    VAR_LOGFILE = 285,
-    VAR_PIDFILE = 286,
-    VAR_MSG_CACHE_SIZE = 287,
-    VAR_MSG_CACHE_SLABS = 288,
-    VAR_NUM_QUERIES_PER_THREAD = 289,
-    VAR_RRSET_CACHE_SIZE = 290,
-    VAR_RRSET_CACHE_SLABS = 291,
-    VAR_OUTGOING_NUM_TCP = 292,
-    VAR_INFRA_HOST_TTL = 293,
-    VAR_INFRA_LAME_TTL = 294,
-    VAR_INFRA_CACHE_SLABS = 295,
-    VAR_INFRA_CACHE_NUMHOSTS = 296,
-    VAR_INFRA_CACHE_LAME_SIZE = 297,
-    VAR_NAME = 298,
-    VAR_STUB_ZONE = 299,
-    VAR_STUB_HOST = 300,
-    VAR_STUB_ADDR = 301,
-    VAR_TARGET_FETCH_POLICY = 302,
-    VAR_HARDEN_SHORT_BUFSIZE = 303,
-    VAR_HARDEN_LARGE_QUERIES = 304,
-    VAR_FORWARD_ZONE = 305,
-    VAR_FORWARD_HOST = 306,
-    VAR_FORWARD_ADDR = 307,
-    VAR_DO_NOT_QUERY_ADDRESS = 308,
-    VAR_HIDE_IDENTITY = 309,
-    VAR_HIDE_VERSION = 310,
-    VAR_IDENTITY = 311,
-    VAR_VERSION = 312,
-    VAR_HARDEN_GLUE = 313,
-    VAR_MODULE_CONF = 314,
-    VAR_TRUST_ANCHOR_FILE = 315,
-    VAR_TRUST_ANCHOR = 316,
-    VAR_VAL_OVERRIDE_DATE = 317,
-    VAR_BOGUS_TTL = 318,
-    VAR_VAL_CLEAN_ADDITIONAL = 319,
-    VAR_VAL_PERMISSIVE_MODE = 320,
-    VAR_INCOMING_NUM_TCP = 321,
-    VAR_MSG_BUFFER_SIZE = 322,
-    VAR_KEY_CACHE_SIZE = 323,
-    VAR_KEY_CACHE_SLABS = 324,
-    VAR_TRUSTED_KEYS_FILE = 325,
-    VAR_VAL_NSEC3_KEYSIZE_ITERATIONS = 326,
-    VAR_USE_SYSLOG = 327,
-    VAR_OUTGOING_INTERFACE = 328,
-    VAR_ROOT_HINTS = 329,
-    VAR_DO_NOT_QUERY_LOCALHOST = 330,
-    VAR_CACHE_MAX_TTL = 331,
-    VAR_HARDEN_DNSSEC_STRIPPED = 332,
-    VAR_ACCESS_CONTROL = 333,
-    VAR_LOCAL_ZONE = 334,
-    VAR_LOCAL_DATA = 335,
-    VAR_INTERFACE_AUTOMATIC = 336,
-    VAR_STATISTICS_INTERVAL = 337,
-    VAR_DO_DAEMONIZE = 338,
-    VAR_USE_CAPS_FOR_ID = 339,
-    VAR_STATISTICS_CUMULATIVE = 340,
-    VAR_OUTGOING_PORT_PERMIT = 341,
-    VAR_OUTGOING_PORT_AVOID = 342,
-    VAR_DLV_ANCHOR_FILE = 343,
-    VAR_DLV_ANCHOR = 344,
-    VAR_NEG_CACHE_SIZE = 345,
-    VAR_HARDEN_REFERRAL_PATH = 346,
-    VAR_PRIVATE_ADDRESS = 347,
-    VAR_PRIVATE_DOMAIN = 348,
-    VAR_REMOTE_CONTROL = 349,
-    VAR_CONTROL_ENABLE = 350,
-    VAR_CONTROL_INTERFACE = 351,
-    VAR_CONTROL_PORT = 352,
-    VAR_SERVER_KEY_FILE = 353,
-    VAR_SERVER_CERT_FILE = 354,
-    VAR_CONTROL_KEY_FILE = 355,
-    VAR_CONTROL_CERT_FILE = 356,
-    VAR_CONTROL_USE_CERT = 357,
-    VAR_EXTENDED_STATISTICS = 358,
-    VAR_LOCAL_DATA_PTR = 359,
-    VAR_JOSTLE_TIMEOUT = 360,
-    VAR_STUB_PRIME = 361,
-    VAR_UNWANTED_REPLY_THRESHOLD = 362,
-    VAR_LOG_TIME_ASCII = 363,
-    VAR_DOMAIN_INSECURE = 364,
-    VAR_PYTHON = 365,
-    VAR_PYTHON_SCRIPT = 366,
-    VAR_VAL_SIG_SKEW_MIN = 367,
-    VAR_VAL_SIG_SKEW_MAX = 368,
-    VAR_CACHE_MIN_TTL = 369,
-    VAR_VAL_LOG_LEVEL = 370,
-    VAR_AUTO_TRUST_ANCHOR_FILE = 371,
-    VAR_KEEP_MISSING = 372,
-    VAR_ADD_HOLDDOWN = 373,
-    VAR_DEL_HOLDDOWN = 374,
-    VAR_SO_RCVBUF = 375,
-    VAR_EDNS_BUFFER_SIZE = 376,
-    VAR_PREFETCH = 377,
-    VAR_PREFETCH_KEY = 378,
-    VAR_SO_SNDBUF = 379,
-    VAR_SO_REUSEPORT = 380,
-    VAR_HARDEN_BELOW_NXDOMAIN = 381,
-    VAR_IGNORE_CD_FLAG = 382,
-    VAR_LOG_QUERIES = 383,
-    VAR_LOG_REPLIES = 384,
-    VAR_LOG_LOCAL_ACTIONS = 385,
-    VAR_TCP_UPSTREAM = 386,
-    VAR_SSL_UPSTREAM = 387,
-    VAR_SSL_SERVICE_KEY = 388,
-    VAR_SSL_SERVICE_PEM = 389,
-    VAR_SSL_PORT = 390,
-    VAR_FORWARD_FIRST = 391,
-    VAR_STUB_SSL_UPSTREAM = 392,
-    VAR_FORWARD_SSL_UPSTREAM = 393,
-    VAR_TLS_CERT_BUNDLE = 394,
-    VAR_STUB_FIRST = 395,
-    VAR_MINIMAL_RESPONSES = 396,
-    VAR_RRSET_ROUNDROBIN = 397,
-    VAR_MAX_UDP_SIZE = 398,
-    VAR_DELAY_CLOSE = 399,
-    VAR_UNBLOCK_LAN_ZONES = 400,
-    VAR_INSECURE_LAN_ZONES = 401,
-    VAR_INFRA_CACHE_MIN_RTT = 402,
-    VAR_DNS64_PREFIX = 403,
-    VAR_DNS64_SYNTHALL = 404,
-    VAR_DNS64_IGNORE_AAAA = 405,
-    VAR_DNSTAP = 406,
-    VAR_DNSTAP_ENABLE = 407,
-    VAR_DNSTAP_SOCKET_PATH = 408,
-    VAR_DNSTAP_SEND_IDENTITY = 409,
-    VAR_DNSTAP_SEND_VERSION = 410,
-    VAR_DNSTAP_IDENTITY = 411,
-    VAR_DNSTAP_VERSION = 412,
-    VAR_DNSTAP_LOG_RESOLVER_QUERY_MESSAGES = 413,
-    VAR_DNSTAP_LOG_RESOLVER_RESPONSE_MESSAGES = 414,
-    VAR_DNSTAP_LOG_CLIENT_QUERY_MESSAGES = 415,
-    VAR_DNSTAP_LOG_CLIENT_RESPONSE_MESSAGES = 416,
-    VAR_DNSTAP_LOG_FORWARDER_QUERY_MESSAGES = 417,
-    VAR_DNSTAP_LOG_FORWARDER_RESPONSE_MESSAGES = 418,
-    VAR_RESPONSE_IP_TAG = 419,
-    VAR_RESPONSE_IP = 420,
-    VAR_RESPONSE_IP_DATA = 421,
-    VAR_HARDEN_ALGO_DOWNGRADE = 422,
-    VAR_IP_TRANSPARENT = 423,
-    VAR_DISABLE_DNSSEC_LAME_CHECK = 424,
-    VAR_IP_RATELIMIT = 425,
-    VAR_IP_RATELIMIT_SLABS = 426,
-    VAR_IP_RATELIMIT_SIZE = 427,
-    VAR_RATELIMIT = 428,
-    VAR_RATELIMIT_SLABS = 429,
-    VAR_RATELIMIT_SIZE = 430,
-    VAR_RATELIMIT_FOR_DOMAIN = 431,
-    VAR_RATELIMIT_BELOW_DOMAIN = 432,
-    VAR_IP_RATELIMIT_FACTOR = 433,
-    VAR_RATELIMIT_FACTOR = 434,
-    VAR_SEND_CLIENT_SUBNET = 435,
-    VAR_CLIENT_SUBNET_ZONE = 436,
-    VAR_CLIENT_SUBNET_ALWAYS_FORWARD = 437,
-    VAR_CLIENT_SUBNET_OPCODE = 438,
-    VAR_MAX_CLIENT_SUBNET_IPV4 = 439,
-    VAR_MAX_CLIENT_SUBNET_IPV6 = 440,
-    VAR_MIN_CLIENT_SUBNET_IPV4 = 441,
-    VAR_MIN_CLIENT_SUBNET_IPV6 = 442,
-    VAR_MAX_ECS_TREE_SIZE_IPV4 = 443,
-    VAR_MAX_ECS_TREE_SIZE_IPV6 = 444,
-    VAR_CAPS_WHITELIST = 445,
-    VAR_CACHE_MAX_NEGATIVE_TTL = 446,
-    VAR_PERMIT_SMALL_HOLDDOWN = 447,
-    VAR_QNAME_MINIMISATION = 448,
-    VAR_QNAME_MINIMISATION_STRICT = 449,
-    VAR_IP_FREEBIND = 450,
-    VAR_DEFINE_TAG = 451,
-    VAR_LOCAL_ZONE_TAG = 452,
-    VAR_ACCESS_CONTROL_TAG = 453,
-    VAR_LOCAL_ZONE_OVERRIDE = 454,
-    VAR_ACCESS_CONTROL_TAG_ACTION = 455,
-    VAR_ACCESS_CONTROL_TAG_DATA = 456,
-    VAR_VIEW = 457,
-    VAR_ACCESS_CONTROL_VIEW = 458,
-    VAR_VIEW_FIRST = 459,
-    VAR_SERVE_EXPIRED = 460,
-    VAR_SERVE_EXPIRED_TTL = 461,
-    VAR_SERVE_EXPIRED_TTL_RESET = 462,
-    VAR_FAKE_DSA = 463,
-    VAR_FAKE_SHA1 = 464,
-    VAR_LOG_IDENTITY = 465,
-    VAR_HIDE_TRUSTANCHOR = 466,
-    VAR_TRUST_ANCHOR_SIGNALING = 467,
-    VAR_AGGRESSIVE_NSEC = 468,
-    VAR_USE_SYSTEMD = 469,
-    VAR_SHM_ENABLE = 470,
-    VAR_SHM_KEY = 471,
-    VAR_ROOT_KEY_SENTINEL = 472,
-    VAR_DNSCRYPT = 473,
-    VAR_DNSCRYPT_ENABLE = 474,
-    VAR_DNSCRYPT_PORT = 475,
-    VAR_DNSCRYPT_PROVIDER = 476,
-    VAR_DNSCRYPT_SECRET_KEY = 477,
-    VAR_DNSCRYPT_PROVIDER_CERT = 478,
-    VAR_DNSCRYPT_PROVIDER_CERT_ROTATED = 479,
-    VAR_DNSCRYPT_SHARED_SECRET_CACHE_SIZE = 480,
-    VAR_DNSCRYPT_SHARED_SECRET_CACHE_SLABS = 481,
-    VAR_DNSCRYPT_NONCE_CACHE_SIZE = 482,
-    VAR_DNSCRYPT_NONCE_CACHE_SLABS = 483,
-    VAR_IPSECMOD_ENABLED = 484,
-    VAR_IPSECMOD_HOOK = 485,
-    VAR_IPSECMOD_IGNORE_BOGUS = 486,
-    VAR_IPSECMOD_MAX_TTL = 487,
-    VAR_IPSECMOD_WHITELIST = 488,
-    VAR_IPSECMOD_STRICT = 489,
-    VAR_CACHEDB = 490,
-    VAR_CACHEDB_BACKEND = 491,
-    VAR_CACHEDB_SECRETSEED = 492,
-    VAR_CACHEDB_REDISHOST = 493,
-    VAR_CACHEDB_REDISPORT = 494,
-    VAR_CACHEDB_REDISTIMEOUT = 495,
-    VAR_UDP_UPSTREAM_WITHOUT_DOWNSTREAM = 496,
-    VAR_FOR_UPSTREAM = 497,
-    VAR_AUTH_ZONE = 498,
-    VAR_ZONEFILE = 499,
-    VAR_MASTER = 500,
-    VAR_URL = 501,
-    VAR_FOR_DOWNSTREAM = 502,
-    VAR_FALLBACK_ENABLED = 503,
-    VAR_TLS_ADDITIONAL_PORT = 504,
-    VAR_LOW_RTT = 505,
-    VAR_LOW_RTT_PERMIL = 506,
-    VAR_FAST_SERVER_PERMIL = 507,
-    VAR_FAST_SERVER_NUM = 508,
-    VAR_ALLOW_NOTIFY = 509,
-    VAR_TLS_WIN_CERT = 510,
-    VAR_TCP_CONNECTION_LIMIT = 511,
-    VAR_FORWARD_NO_CACHE = 512,
-    VAR_STUB_NO_CACHE = 513,
-    VAR_LOG_SERVFAIL = 514,
-    VAR_DENY_ANY = 515,
-    VAR_UNKNOWN_SERVER_TIME_LIMIT = 516,
-    VAR_LOG_TAG_QUERYREPLY = 517,
-    VAR_STREAM_WAIT_SIZE = 518,
-    VAR_TLS_CIPHERS = 519,
-    VAR_TLS_CIPHERSUITES = 520,
-    VAR_TLS_SESSION_TICKET_KEYS = 521
+    YYEMPTY = -2,
+    YYEOF = 0,                     /* "end of file"  */
+    YYerror = 256,                 /* error  */
+    YYUNDEF = 257,                 /* "invalid token"  */
+    SPACE = 258,                   /* SPACE  */
+    LETTER = 259,                  /* LETTER  */
+    NEWLINE = 260,                 /* NEWLINE  */
+    COMMENT = 261,                 /* COMMENT  */
+    COLON = 262,                   /* COLON  */
+    ANY = 263,                     /* ANY  */
+    ZONESTR = 264,                 /* ZONESTR  */
+    STRING_ARG = 265,              /* STRING_ARG  */
+    VAR_SERVER = 266,              /* VAR_SERVER  */
+    VAR_VERBOSITY = 267,           /* VAR_VERBOSITY  */
+    VAR_NUM_THREADS = 268,         /* VAR_NUM_THREADS  */
+    VAR_PORT = 269,                /* VAR_PORT  */
+    VAR_OUTGOING_RANGE = 270,      /* VAR_OUTGOING_RANGE  */
+    VAR_INTERFACE = 271,           /* VAR_INTERFACE  */
+    VAR_DO_IP4 = 272,              /* VAR_DO_IP4  */
+    VAR_DO_IP6 = 273,              /* VAR_DO_IP6  */
+    VAR_PREFER_IP6 = 274,          /* VAR_PREFER_IP6  */
+    VAR_DO_UDP = 275,              /* VAR_DO_UDP  */
+    VAR_DO_TCP = 276,              /* VAR_DO_TCP  */
+    VAR_TCP_MSS = 277,             /* VAR_TCP_MSS  */
+    VAR_OUTGOING_TCP_MSS = 278,    /* VAR_OUTGOING_TCP_MSS  */
+    VAR_TCP_IDLE_TIMEOUT = 279,    /* VAR_TCP_IDLE_TIMEOUT  */
+    VAR_EDNS_TCP_KEEPALIVE = 280,  /* VAR_EDNS_TCP_KEEPALIVE  */
+    VAR_EDNS_TCP_KEEPALIVE_TIMEOUT = 281, /* VAR_EDNS_TCP_KEEPALIVE_TIMEOUT  */
+    VAR_CHROOT = 282,              /* VAR_CHROOT  */
+    VAR_USERNAME = 283,            /* VAR_USERNAME  */
+    VAR_DIRECTORY = 284,           /* VAR_DIRECTORY  */
+    VAR_LOGFILE = 285,             /* VAR_LOGFILE  */
+    VAR_PIDFILE = 286,             /* VAR_PIDFILE  */
+    VAR_MSG_CACHE_SIZE = 287,      /* VAR_MSG_CACHE_SIZE  */
+    VAR_MSG_CACHE_SLABS = 288,     /* VAR_MSG_CACHE_SLABS  */
+    VAR_NUM_QUERIES_PER_THREAD = 289, /* VAR_NUM_QUERIES_PER_THREAD  */
+    VAR_RRSET_CACHE_SIZE = 290,    /* VAR_RRSET_CACHE_SIZE  */
+    VAR_RRSET_CACHE_SLABS = 291,   /* VAR_RRSET_CACHE_SLABS  */
+    VAR_OUTGOING_NUM_TCP = 292,    /* VAR_OUTGOING_NUM_TCP  */
+    VAR_INFRA_HOST_TTL = 293,      /* VAR_INFRA_HOST_TTL  */
+    VAR_INFRA_LAME_TTL = 294,      /* VAR_INFRA_LAME_TTL  */
+    VAR_INFRA_CACHE_SLABS = 295,   /* VAR_INFRA_CACHE_SLABS  */
+    VAR_INFRA_CACHE_NUMHOSTS = 296, /* VAR_INFRA_CACHE_NUMHOSTS  */
+    VAR_INFRA_CACHE_LAME_SIZE = 297, /* VAR_INFRA_CACHE_LAME_SIZE  */
+    VAR_NAME = 298,                /* VAR_NAME  */
+    VAR_STUB_ZONE = 299,           /* VAR_STUB_ZONE  */
+    VAR_STUB_HOST = 300,           /* VAR_STUB_HOST  */
+    VAR_STUB_ADDR = 301,           /* VAR_STUB_ADDR  */
+    VAR_TARGET_FETCH_POLICY = 302, /* VAR_TARGET_FETCH_POLICY  */
+    VAR_HARDEN_SHORT_BUFSIZE = 303, /* VAR_HARDEN_SHORT_BUFSIZE  */
+    VAR_HARDEN_LARGE_QUERIES = 304, /* VAR_HARDEN_LARGE_QUERIES  */
+    VAR_FORWARD_ZONE = 305,        /* VAR_FORWARD_ZONE  */
+    VAR_FORWARD_HOST = 306,        /* VAR_FORWARD_HOST  */
+    VAR_FORWARD_ADDR = 307,        /* VAR_FORWARD_ADDR  */
+    VAR_DO_NOT_QUERY_ADDRESS = 308, /* VAR_DO_NOT_QUERY_ADDRESS  */
+    VAR_HIDE_IDENTITY = 309,       /* VAR_HIDE_IDENTITY  */
+    VAR_HIDE_VERSION = 310,        /* VAR_HIDE_VERSION  */
+    VAR_IDENTITY = 311,            /* VAR_IDENTITY  */
+    VAR_VERSION = 312,             /* VAR_VERSION  */
+    VAR_HARDEN_GLUE = 313,         /* VAR_HARDEN_GLUE  */
+    VAR_MODULE_CONF = 314,         /* VAR_MODULE_CONF  */
+    VAR_TRUST_ANCHOR_FILE = 315,   /* VAR_TRUST_ANCHOR_FILE  */
+    VAR_TRUST_ANCHOR = 316,        /* VAR_TRUST_ANCHOR  */
+    VAR_VAL_OVERRIDE_DATE = 317,   /* VAR_VAL_OVERRIDE_DATE  */
+    VAR_BOGUS_TTL = 318,           /* VAR_BOGUS_TTL  */
+    VAR_VAL_CLEAN_ADDITIONAL = 319, /* VAR_VAL_CLEAN_ADDITIONAL  */
+    VAR_VAL_PERMISSIVE_MODE = 320, /* VAR_VAL_PERMISSIVE_MODE  */
+    VAR_INCOMING_NUM_TCP = 321,    /* VAR_INCOMING_NUM_TCP  */
+    VAR_MSG_BUFFER_SIZE = 322,     /* VAR_MSG_BUFFER_SIZE  */
+    VAR_KEY_CACHE_SIZE = 323,      /* VAR_KEY_CACHE_SIZE  */
+    VAR_KEY_CACHE_SLABS = 324,     /* VAR_KEY_CACHE_SLABS  */
+    VAR_TRUSTED_KEYS_FILE = 325,   /* VAR_TRUSTED_KEYS_FILE  */
+    VAR_VAL_NSEC3_KEYSIZE_ITERATIONS = 326, /* VAR_VAL_NSEC3_KEYSIZE_ITERATIONS  */
+    VAR_USE_SYSLOG = 327,          /* VAR_USE_SYSLOG  */
+    VAR_OUTGOING_INTERFACE = 328,  /* VAR_OUTGOING_INTERFACE  */
+    VAR_ROOT_HINTS = 329,          /* VAR_ROOT_HINTS  */
+    VAR_DO_NOT_QUERY_LOCALHOST = 330, /* VAR_DO_NOT_QUERY_LOCALHOST  */
+    VAR_CACHE_MAX_TTL = 331,       /* VAR_CACHE_MAX_TTL  */
+    VAR_HARDEN_DNSSEC_STRIPPED = 332, /* VAR_HARDEN_DNSSEC_STRIPPED  */
+    VAR_ACCESS_CONTROL = 333,      /* VAR_ACCESS_CONTROL  */
+    VAR_LOCAL_ZONE = 334,          /* VAR_LOCAL_ZONE  */
+    VAR_LOCAL_DATA = 335,          /* VAR_LOCAL_DATA  */
+    VAR_INTERFACE_AUTOMATIC = 336, /* VAR_INTERFACE_AUTOMATIC  */
+    VAR_STATISTICS_INTERVAL = 337, /* VAR_STATISTICS_INTERVAL  */
+    VAR_DO_DAEMONIZE = 338,        /* VAR_DO_DAEMONIZE  */
+    VAR_USE_CAPS_FOR_ID = 339,     /* VAR_USE_CAPS_FOR_ID  */
+    VAR_STATISTICS_CUMULATIVE = 340, /* VAR_STATISTICS_CUMULATIVE  */
+    VAR_OUTGOING_PORT_PERMIT = 341, /* VAR_OUTGOING_PORT_PERMIT  */
+    VAR_OUTGOING_PORT_AVOID = 342, /* VAR_OUTGOING_PORT_AVOID  */
+    VAR_DLV_ANCHOR_FILE = 343,     /* VAR_DLV_ANCHOR_FILE  */
+    VAR_DLV_ANCHOR = 344,          /* VAR_DLV_ANCHOR  */
+    VAR_NEG_CACHE_SIZE = 345,      /* VAR_NEG_CACHE_SIZE  */
+    VAR_HARDEN_REFERRAL_PATH = 346, /* VAR_HARDEN_REFERRAL_PATH  */
+    VAR_PRIVATE_ADDRESS = 347,     /* VAR_PRIVATE_ADDRESS  */
+    VAR_PRIVATE_DOMAIN = 348,      /* VAR_PRIVATE_DOMAIN  */
+    VAR_REMOTE_CONTROL = 349,      /* VAR_REMOTE_CONTROL  */
+    VAR_CONTROL_ENABLE = 350,      /* VAR_CONTROL_ENABLE  */
+    VAR_CONTROL_INTERFACE = 351,   /* VAR_CONTROL_INTERFACE  */
+    VAR_CONTROL_PORT = 352,        /* VAR_CONTROL_PORT  */
+    VAR_SERVER_KEY_FILE = 353,     /* VAR_SERVER_KEY_FILE  */
+    VAR_SERVER_CERT_FILE = 354,    /* VAR_SERVER_CERT_FILE  */
+    VAR_CONTROL_KEY_FILE = 355,    /* VAR_CONTROL_KEY_FILE  */
+    VAR_CONTROL_CERT_FILE = 356,   /* VAR_CONTROL_CERT_FILE  */
+    VAR_CONTROL_USE_CERT = 357,    /* VAR_CONTROL_USE_CERT  */
+    VAR_EXTENDED_STATISTICS = 358, /* VAR_EXTENDED_STATISTICS  */
+    VAR_LOCAL_DATA_PTR = 359,      /* VAR_LOCAL_DATA_PTR  */
+    VAR_JOSTLE_TIMEOUT = 360,      /* VAR_JOSTLE_TIMEOUT  */
+    VAR_STUB_PRIME = 361,          /* VAR_STUB_PRIME  */
+    VAR_UNWANTED_REPLY_THRESHOLD = 362, /* VAR_UNWANTED_REPLY_THRESHOLD  */
+    VAR_LOG_TIME_ASCII = 363,      /* VAR_LOG_TIME_ASCII  */
+    VAR_DOMAIN_INSECURE = 364,     /* VAR_DOMAIN_INSECURE  */
+    VAR_PYTHON = 365,              /* VAR_PYTHON  */
+    VAR_PYTHON_SCRIPT = 366,       /* VAR_PYTHON_SCRIPT  */
+    VAR_VAL_SIG_SKEW_MIN = 367,    /* VAR_VAL_SIG_SKEW_MIN  */
+    VAR_VAL_SIG_SKEW_MAX = 368,    /* VAR_VAL_SIG_SKEW_MAX  */
+    VAR_CACHE_MIN_TTL = 369,       /* VAR_CACHE_MIN_TTL  */
+    VAR_VAL_LOG_LEVEL = 370,       /* VAR_VAL_LOG_LEVEL  */
+    VAR_AUTO_TRUST_ANCHOR_FILE = 371, /* VAR_AUTO_TRUST_ANCHOR_FILE  */
+    VAR_KEEP_MISSING = 372,        /* VAR_KEEP_MISSING  */
+    VAR_ADD_HOLDDOWN = 373,        /* VAR_ADD_HOLDDOWN  */
+    VAR_DEL_HOLDDOWN = 374,        /* VAR_DEL_HOLDDOWN  */
+    VAR_SO_RCVBUF = 375,           /* VAR_SO_RCVBUF  */
+    VAR_EDNS_BUFFER_SIZE = 376,    /* VAR_EDNS_BUFFER_SIZE  */
+    VAR_PREFETCH = 377,            /* VAR_PREFETCH  */
+    VAR_PREFETCH_KEY = 378,        /* VAR_PREFETCH_KEY  */
+    VAR_SO_SNDBUF = 379,           /* VAR_SO_SNDBUF  */
+    VAR_SO_REUSEPORT = 380,        /* VAR_SO_REUSEPORT  */
+    VAR_HARDEN_BELOW_NXDOMAIN = 381, /* VAR_HARDEN_BELOW_NXDOMAIN  */
+    VAR_IGNORE_CD_FLAG = 382,      /* VAR_IGNORE_CD_FLAG  */
+    VAR_LOG_QUERIES = 383,         /* VAR_LOG_QUERIES  */
+    VAR_LOG_REPLIES = 384,         /* VAR_LOG_REPLIES  */
+    VAR_LOG_LOCAL_ACTIONS = 385,   /* VAR_LOG_LOCAL_ACTIONS  */
+    VAR_TCP_UPSTREAM = 386,        /* VAR_TCP_UPSTREAM  */
+    VAR_SSL_UPSTREAM = 387,        /* VAR_SSL_UPSTREAM  */
+    VAR_SSL_SERVICE_KEY = 388,     /* VAR_SSL_SERVICE_KEY  */
+    VAR_SSL_SERVICE_PEM = 389,     /* VAR_SSL_SERVICE_PEM  */
+    VAR_SSL_PORT = 390,            /* VAR_SSL_PORT  */
+    VAR_FORWARD_FIRST = 391,       /* VAR_FORWARD_FIRST  */
+    VAR_STUB_SSL_UPSTREAM = 392,   /* VAR_STUB_SSL_UPSTREAM  */
+    VAR_FORWARD_SSL_UPSTREAM = 393, /* VAR_FORWARD_SSL_UPSTREAM  */
+    VAR_TLS_CERT_BUNDLE = 394,     /* VAR_TLS_CERT_BUNDLE  */
+    VAR_STUB_FIRST = 395,          /* VAR_STUB_FIRST  */
+    VAR_MINIMAL_RESPONSES = 396,   /* VAR_MINIMAL_RESPONSES  */
+    VAR_RRSET_ROUNDROBIN = 397,    /* VAR_RRSET_ROUNDROBIN  */
+    VAR_MAX_UDP_SIZE = 398,        /* VAR_MAX_UDP_SIZE  */
+    VAR_DELAY_CLOSE = 399,         /* VAR_DELAY_CLOSE  */
+    VAR_UNBLOCK_LAN_ZONES = 400,   /* VAR_UNBLOCK_LAN_ZONES  */
+    VAR_INSECURE_LAN_ZONES = 401,  /* VAR_INSECURE_LAN_ZONES  */
+    VAR_INFRA_CACHE_MIN_RTT = 402, /* VAR_INFRA_CACHE_MIN_RTT  */
+    VAR_DNS64_PREFIX = 403,        /* VAR_DNS64_PREFIX  */
+    VAR_DNS64_SYNTHALL = 404,      /* VAR_DNS64_SYNTHALL  */
+    VAR_DNS64_IGNORE_AAAA = 405,   /* VAR_DNS64_IGNORE_AAAA  */
+    VAR_DNSTAP = 406,              /* VAR_DNSTAP  */
+    VAR_DNSTAP_ENABLE = 407,       /* VAR_DNSTAP_ENABLE  */
+    VAR_DNSTAP_SOCKET_PATH = 408,  /* VAR_DNSTAP_SOCKET_PATH  */
+    VAR_DNSTAP_SEND_IDENTITY = 409, /* VAR_DNSTAP_SEND_IDENTITY  */
+    VAR_DNSTAP_SEND_VERSION = 410, /* VAR_DNSTAP_SEND_VERSION  */
+    VAR_DNSTAP_IDENTITY = 411,     /* VAR_DNSTAP_IDENTITY  */
+    VAR_DNSTAP_VERSION = 412,      /* VAR_DNSTAP_VERSION  */
+    VAR_DNSTAP_LOG_RESOLVER_QUERY_MESSAGES = 413, /* VAR_DNSTAP_LOG_RESOLVER_QUERY_MESSAGES  */
+    VAR_DNSTAP_LOG_RESOLVER_RESPONSE_MESSAGES = 414, /* VAR_DNSTAP_LOG_RESOLVER_RESPONSE_MESSAGES  */
+    VAR_DNSTAP_LOG_CLIENT_QUERY_MESSAGES = 415, /* VAR_DNSTAP_LOG_CLIENT_QUERY_MESSAGES  */
+    VAR_DNSTAP_LOG_CLIENT_RESPONSE_MESSAGES = 416, /* VAR_DNSTAP_LOG_CLIENT_RESPONSE_MESSAGES  */
+    VAR_DNSTAP_LOG_FORWARDER_QUERY_MESSAGES = 417, /* VAR_DNSTAP_LOG_FORWARDER_QUERY_MESSAGES  */
+    VAR_DNSTAP_LOG_FORWARDER_RESPONSE_MESSAGES = 418, /* VAR_DNSTAP_LOG_FORWARDER_RESPONSE_MESSAGES  */
+    VAR_RESPONSE_IP_TAG = 419,     /* VAR_RESPONSE_IP_TAG  */
+    VAR_RESPONSE_IP = 420,         /* VAR_RESPONSE_IP  */
+    VAR_RESPONSE_IP_DATA = 421,    /* VAR_RESPONSE_IP_DATA  */
+    VAR_HARDEN_ALGO_DOWNGRADE = 422, /* VAR_HARDEN_ALGO_DOWNGRADE  */
+    VAR_IP_TRANSPARENT = 423,      /* VAR_IP_TRANSPARENT  */
+    VAR_DISABLE_DNSSEC_LAME_CHECK = 424, /* VAR_DISABLE_DNSSEC_LAME_CHECK  */
+    VAR_IP_RATELIMIT = 425,        /* VAR_IP_RATELIMIT  */
+    VAR_IP_RATELIMIT_SLABS = 426,  /* VAR_IP_RATELIMIT_SLABS  */
+    VAR_IP_RATELIMIT_SIZE = 427,   /* VAR_IP_RATELIMIT_SIZE  */
+    VAR_RATELIMIT = 428,           /* VAR_RATELIMIT  */
+    VAR_RATELIMIT_SLABS = 429,     /* VAR_RATELIMIT_SLABS  */
+    VAR_RATELIMIT_SIZE = 430,      /* VAR_RATELIMIT_SIZE  */
+    VAR_RATELIMIT_FOR_DOMAIN = 431, /* VAR_RATELIMIT_FOR_DOMAIN  */
+    VAR_RATELIMIT_BELOW_DOMAIN = 432, /* VAR_RATELIMIT_BELOW_DOMAIN  */
+    VAR_IP_RATELIMIT_FACTOR = 433, /* VAR_IP_RATELIMIT_FACTOR  */
+    VAR_RATELIMIT_FACTOR = 434,    /* VAR_RATELIMIT_FACTOR  */
+    VAR_SEND_CLIENT_SUBNET = 435,  /* VAR_SEND_CLIENT_SUBNET  */
+    VAR_CLIENT_SUBNET_ZONE = 436,  /* VAR_CLIENT_SUBNET_ZONE  */
+    VAR_CLIENT_SUBNET_ALWAYS_FORWARD = 437, /* VAR_CLIENT_SUBNET_ALWAYS_FORWARD  */
+    VAR_CLIENT_SUBNET_OPCODE = 438, /* VAR_CLIENT_SUBNET_OPCODE  */
+    VAR_MAX_CLIENT_SUBNET_IPV4 = 439, /* VAR_MAX_CLIENT_SUBNET_IPV4  */
+    VAR_MAX_CLIENT_SUBNET_IPV6 = 440, /* VAR_MAX_CLIENT_SUBNET_IPV6  */
+    VAR_MIN_CLIENT_SUBNET_IPV4 = 441, /* VAR_MIN_CLIENT_SUBNET_IPV4  */
+    VAR_MIN_CLIENT_SUBNET_IPV6 = 442, /* VAR_MIN_CLIENT_SUBNET_IPV6  */
+    VAR_MAX_ECS_TREE_SIZE_IPV4 = 443, /* VAR_MAX_ECS_TREE_SIZE_IPV4  */
+    VAR_MAX_ECS_TREE_SIZE_IPV6 = 444, /* VAR_MAX_ECS_TREE_SIZE_IPV6  */
+    VAR_CAPS_WHITELIST = 445,      /* VAR_CAPS_WHITELIST  */
+    VAR_CACHE_MAX_NEGATIVE_TTL = 446, /* VAR_CACHE_MAX_NEGATIVE_TTL  */
+    VAR_PERMIT_SMALL_HOLDDOWN = 447, /* VAR_PERMIT_SMALL_HOLDDOWN  */
+    VAR_QNAME_MINIMISATION = 448,  /* VAR_QNAME_MINIMISATION  */
+    VAR_QNAME_MINIMISATION_STRICT = 449, /* VAR_QNAME_MINIMISATION_STRICT  */
+    VAR_IP_FREEBIND = 450,         /* VAR_IP_FREEBIND  */
+    VAR_DEFINE_TAG = 451,          /* VAR_DEFINE_TAG  */
+    VAR_LOCAL_ZONE_TAG = 452,      /* VAR_LOCAL_ZONE_TAG  */
+    VAR_ACCESS_CONTROL_TAG = 453,  /* VAR_ACCESS_CONTROL_TAG  */
+    VAR_LOCAL_ZONE_OVERRIDE = 454, /* VAR_LOCAL_ZONE_OVERRIDE  */
+    VAR_ACCESS_CONTROL_TAG_ACTION = 455, /* VAR_ACCESS_CONTROL_TAG_ACTION  */
+    VAR_ACCESS_CONTROL_TAG_DATA = 456, /* VAR_ACCESS_CONTROL_TAG_DATA  */
+    VAR_VIEW = 457,                /* VAR_VIEW  */
+    VAR_ACCESS_CONTROL_VIEW = 458, /* VAR_ACCESS_CONTROL_VIEW  */
+    VAR_VIEW_FIRST = 459,          /* VAR_VIEW_FIRST  */
+    VAR_SERVE_EXPIRED = 460,       /* VAR_SERVE_EXPIRED  */
+    VAR_SERVE_EXPIRED_TTL = 461,   /* VAR_SERVE_EXPIRED_TTL  */
+    VAR_SERVE_EXPIRED_TTL_RESET = 462, /* VAR_SERVE_EXPIRED_TTL_RESET  */
+    VAR_FAKE_DSA = 463,            /* VAR_FAKE_DSA  */
+    VAR_FAKE_SHA1 = 464,           /* VAR_FAKE_SHA1  */
+    VAR_LOG_IDENTITY = 465,        /* VAR_LOG_IDENTITY  */
+    VAR_HIDE_TRUSTANCHOR = 466,    /* VAR_HIDE_TRUSTANCHOR  */
+    VAR_TRUST_ANCHOR_SIGNALING = 467, /* VAR_TRUST_ANCHOR_SIGNALING  */
+    VAR_AGGRESSIVE_NSEC = 468,     /* VAR_AGGRESSIVE_NSEC  */
+    VAR_USE_SYSTEMD = 469,         /* VAR_USE_SYSTEMD  */
+    VAR_SHM_ENABLE = 470,          /* VAR_SHM_ENABLE  */
+    VAR_SHM_KEY = 471,             /* VAR_SHM_KEY  */
+    VAR_ROOT_KEY_SENTINEL = 472,   /* VAR_ROOT_KEY_SENTINEL  */
+    VAR_DNSCRYPT = 473,            /* VAR_DNSCRYPT  */
+    VAR_DNSCRYPT_ENABLE = 474,     /* VAR_DNSCRYPT_ENABLE  */
+    VAR_DNSCRYPT_PORT = 475,       /* VAR_DNSCRYPT_PORT  */
+    VAR_DNSCRYPT_PROVIDER = 476,   /* VAR_DNSCRYPT_PROVIDER  */
+    VAR_DNSCRYPT_SECRET_KEY = 477, /* VAR_DNSCRYPT_SECRET_KEY  */
+    VAR_DNSCRYPT_PROVIDER_CERT = 478, /* VAR_DNSCRYPT_PROVIDER_CERT  */
+    VAR_DNSCRYPT_PROVIDER_CERT_ROTATED = 479, /* VAR_DNSCRYPT_PROVIDER_CERT_ROTATED  */
+    VAR_DNSCRYPT_SHARED_SECRET_CACHE_SIZE = 480, /* VAR_DNSCRYPT_SHARED_SECRET_CACHE_SIZE  */
+    VAR_DNSCRYPT_SHARED_SECRET_CACHE_SLABS = 481, /* VAR_DNSCRYPT_SHARED_SECRET_CACHE_SLABS  */
+    VAR_DNSCRYPT_NONCE_CACHE_SIZE = 482, /* VAR_DNSCRYPT_NONCE_CACHE_SIZE  */
+    VAR_DNSCRYPT_NONCE_CACHE_SLABS = 483, /* VAR_DNSCRYPT_NONCE_CACHE_SLABS  */
+    VAR_IPSECMOD_ENABLED = 484,    /* VAR_IPSECMOD_ENABLED  */
+    VAR_IPSECMOD_HOOK = 485,       /* VAR_IPSECMOD_HOOK  */
+    VAR_IPSECMOD_IGNORE_BOGUS = 486, /* VAR_IPSECMOD_IGNORE_BOGUS  */
+    VAR_IPSECMOD_MAX_TTL = 487,    /* VAR_IPSECMOD_MAX_TTL  */
+    VAR_IPSECMOD_WHITELIST = 488,  /* VAR_IPSECMOD_WHITELIST  */
+    VAR_IPSECMOD_STRICT = 489,     /* VAR_IPSECMOD_STRICT  */
+    VAR_CACHEDB = 490,             /* VAR_CACHEDB  */
+    VAR_CACHEDB_BACKEND = 491,     /* VAR_CACHEDB_BACKEND  */
+    VAR_CACHEDB_SECRETSEED = 492,  /* VAR_CACHEDB_SECRETSEED  */
+    VAR_CACHEDB_REDISHOST = 493,   /* VAR_CACHEDB_REDISHOST  */
+    VAR_CACHEDB_REDISPORT = 494,   /* VAR_CACHEDB_REDISPORT  */
+    VAR_CACHEDB_REDISTIMEOUT = 495, /* VAR_CACHEDB_REDISTIMEOUT  */
+    VAR_UDP_UPSTREAM_WITHOUT_DOWNSTREAM = 496, /* VAR_UDP_UPSTREAM_WITHOUT_DOWNSTREAM  */
+    VAR_FOR_UPSTREAM = 497,        /* VAR_FOR_UPSTREAM  */
+    VAR_AUTH_ZONE = 498,           /* VAR_AUTH_ZONE  */
+    VAR_ZONEFILE = 499,            /* VAR_ZONEFILE  */
+    VAR_MASTER = 500,              /* VAR_MASTER  */
+    VAR_URL = 501,                 /* VAR_URL  */
+    VAR_FOR_DOWNSTREAM = 502,      /* VAR_FOR_DOWNSTREAM  */
+    VAR_FALLBACK_ENABLED = 503,    /* VAR_FALLBACK_ENABLED  */
+    VAR_TLS_ADDITIONAL_PORT = 504, /* VAR_TLS_ADDITIONAL_PORT  */
+    VAR_LOW_RTT = 505,             /* VAR_LOW_RTT  */
+    VAR_LOW_RTT_PERMIL = 506,      /* VAR_LOW_RTT_PERMIL  */
+    VAR_FAST_SERVER_PERMIL = 507,  /* VAR_FAST_SERVER_PERMIL  */
+    VAR_FAST_SERVER_NUM = 508,     /* VAR_FAST_SERVER_NUM  */
+    VAR_ALLOW_NOTIFY = 509,        /* VAR_ALLOW_NOTIFY  */
+    VAR_TLS_WIN_CERT = 510,        /* VAR_TLS_WIN_CERT  */
+    VAR_TCP_CONNECTION_LIMIT = 511, /* VAR_TCP_CONNECTION_LIMIT  */
+    VAR_FORWARD_NO_CACHE = 512,    /* VAR_FORWARD_NO_CACHE  */
+    VAR_STUB_NO_CACHE = 513,       /* VAR_STUB_NO_CACHE  */
+    VAR_LOG_SERVFAIL = 514,        /* VAR_LOG_SERVFAIL  */
+    VAR_DENY_ANY = 515,            /* VAR_DENY_ANY  */
+    VAR_UNKNOWN_SERVER_TIME_LIMIT = 516, /* VAR_UNKNOWN_SERVER_TIME_LIMIT  */
+    VAR_LOG_TAG_QUERYREPLY = 517,  /* VAR_LOG_TAG_QUERYREPLY  */
+    VAR_STREAM_WAIT_SIZE = 518,    /* VAR_STREAM_WAIT_SIZE  */
+    VAR_TLS_CIPHERS = 519,         /* VAR_TLS_CIPHERS  */
+    VAR_TLS_CIPHERSUITES = 520,    /* VAR_TLS_CIPHERSUITES  */
+    VAR_TLS_SESSION_TICKET_KEYS = 521, /* VAR_TLS_SESSION_TICKET_KEYS  */
+    VAR_MESH_CLASS_WEIGHT = 522,   /* VAR_MESH_CLASS_WEIGHT  */
+    VAR_MESH_CLASS_LIMIT = 523,    /* VAR_MESH_CLASS_LIMIT  */
+    VAR_TRACE_SAMPLE_RATE = 524,   /* VAR_TRACE_SAMPLE_RATE  */
+    VAR_TRACE_SLOW_THRESHOLD = 525, /* VAR_TRACE_SLOW_THRESHOLD  */
+    VAR_WORK_STEALING = 526,       /* VAR_WORK_STEALING  */
+    VAR_MESH_FAIR_SHARE = 527,     /* VAR_MESH_FAIR_SHARE  */
+    VAR_MESH_FAIR_SHARE_PREFIX4 = 528, /* VAR_MESH_FAIR_SHARE_PREFIX4  */
+    VAR_MESH_FAIR_SHARE_PREFIX6 = 529, /* VAR_MESH_FAIR_SHARE_PREFIX6  */
+    VAR_SIG_CACHE_SIZE = 530,      /* VAR_SIG_CACHE_SIZE  */
+    VAR_SIG_CACHE_SLABS = 531,     /* VAR_SIG_CACHE_SLABS  */
+    VAR_VAL_CRYPTO_THREADS = 532,  /* VAR_VAL_CRYPTO_THREADS  */
+    VAR_NSEC3_HASH_CACHE_SIZE = 533, /* VAR_NSEC3_HASH_CACHE_SIZE  */
+    VAR_NSEC3_HASH_CACHE_SLABS = 534, /* VAR_NSEC3_HASH_CACHE_SLABS  */
+    VAR_NSEC3_HASH_RATELIMIT = 535, /* VAR_NSEC3_HASH_RATELIMIT  */
+    VAR_HEDGE_PERCENTILE = 536,    /* VAR_HEDGE_PERCENTILE  */
+    VAR_HEDGE_BUDGET = 537,        /* VAR_HEDGE_BUDGET  */
+    VAR_TARGET_FETCH_PARALLEL = 538, /* VAR_TARGET_FETCH_PARALLEL  */
+    VAR_REFRESH_POPULAR = 539,     /* VAR_REFRESH_POPULAR  */
+    VAR_REFRESH_POPULAR_RATE = 540, /* VAR_REFRESH_POPULAR_RATE  */
+    VAR_REFRESH_POPULAR_SIZE = 541, /* VAR_REFRESH_POPULAR_SIZE  */
+    VAR_SERVE_EXPIRED_CLIENT_TIMEOUT = 542, /* VAR_SERVE_EXPIRED_CLIENT_TIMEOUT  */
+    VAR_SYNTH_INSECURE_DNAME = 543, /* VAR_SYNTH_INSECURE_DNAME  */
+    VAR_INFRA_CACHE_RTT_PERCENTILE = 544 /* VAR_INFRA_CACHE_RTT_PERCENTILE  */
   };
+  typedef enum yytokentype yytoken_kind_t;
 #endif
-/* Tokens.  */
+/* Token kinds.  */
+#define YYEMPTY -2
+#define YYEOF 0
+#define YYerror 256
+#define YYUNDEF 257
 #define SPACE 258
 #define LETTER 259
 #define NEWLINE 260
@@ -576,19 +613,41 @@ extern int yydebug;
 #define VAR_TLS_CIPHERS 519
 #define VAR_TLS_CIPHERSUITES 520
 #define VAR_TLS_SESSION_TICKET_KEYS 521
+#define VAR_MESH_CLASS_WEIGHT 522
+#define VAR_MESH_CLASS_LIMIT 523
+#define VAR_TRACE_SAMPLE_RATE 524
+#define VAR_TRACE_SLOW_THRESHOLD 525
+#define VAR_WORK_STEALING 526
+#define VAR_MESH_FAIR_SHARE 527
+#define VAR_MESH_FAIR_SHARE_PREFIX4 528
+#define VAR_MESH_FAIR_SHARE_PREFIX6 529
+#define VAR_SIG_CACHE_SIZE 530
+#define VAR_SIG_CACHE_SLABS 531
+#define VAR_VAL_CRYPTO_THREADS 532
+#define VAR_NSEC3_HASH_CACHE_SIZE 533
+#define VAR_NSEC3_HASH_CACHE_SLABS 534
+#define VAR_NSEC3_HASH_RATELIMIT 535
+#define VAR_HEDGE_PERCENTILE 536
+#define VAR_HEDGE_BUDGET 537
+#define VAR_TARGET_FETCH_PARALLEL 538
+#define VAR_REFRESH_POPULAR 539
+#define VAR_REFRESH_POPULAR_RATE 540
+#define VAR_REFRESH_POPULAR_SIZE 541
+#define VAR_SERVE_EXPIRED_CLIENT_TIMEOUT 542
+#define VAR_SYNTH_INSECURE_DNAME 543
+#define VAR_INFRA_CACHE_RTT_PERCENTILE 544
 
 /* Value type.  */
 #if ! defined YYSTYPE && ! defined YYSTYPE_IS_DECLARED
-
 union YYSTYPE
 {
-#line 66 "./util/configparser.y" /* yacc.c:1910  */
+#line 66 "util/configparser.y"
 
 	char*	str;
 
-#line 590 "util/configparser.h" /* yacc.c:1910  */
-};
+#line 649 "util/configparser.h"
 
+};
 typedef union YYSTYPE YYSTYPE;
 # define YYSTYPE_IS_TRIVIAL 1
 # define YYSTYPE_IS_DECLARED 1
@@ -597,6 +656,8 @@ typedef union YYSTYPE YYSTYPE;
 
 extern YYSTYPE yylval;
 
+
 int yyparse (void);
 
+
 #endif /* !YY_YY_UTIL_CONFIGPARSER_H_INCLUDED  */
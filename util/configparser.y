@@ -166,7 +166,16 @@ extern struct config_parser_state* cfg_parser;
 %token VAR_FORWARD_NO_CACHE VAR_STUB_NO_CACHE VAR_LOG_SERVFAIL VAR_DENY_ANY
 %token VAR_UNKNOWN_SERVER_TIME_LIMIT VAR_LOG_TAG_QUERYREPLY
 %token VAR_STREAM_WAIT_SIZE VAR_TLS_CIPHERS VAR_TLS_CIPHERSUITES
-%token VAR_TLS_SESSION_TICKET_KEYS
+%token VAR_TLS_SESSION_TICKET_KEYS VAR_MESH_CLASS_WEIGHT VAR_MESH_CLASS_LIMIT
+%token VAR_TRACE_SAMPLE_RATE VAR_TRACE_SLOW_THRESHOLD VAR_WORK_STEALING
+%token VAR_MESH_FAIR_SHARE VAR_MESH_FAIR_SHARE_PREFIX4
+%token VAR_MESH_FAIR_SHARE_PREFIX6 VAR_SIG_CACHE_SIZE VAR_SIG_CACHE_SLABS
+%token VAR_VAL_CRYPTO_THREADS VAR_NSEC3_HASH_CACHE_SIZE
+%token VAR_NSEC3_HASH_CACHE_SLABS VAR_NSEC3_HASH_RATELIMIT
+%token VAR_HEDGE_PERCENTILE VAR_HEDGE_BUDGET VAR_TARGET_FETCH_PARALLEL
+%token VAR_REFRESH_POPULAR VAR_REFRESH_POPULAR_RATE VAR_REFRESH_POPULAR_SIZE
+%token VAR_SERVE_EXPIRED_CLIENT_TIMEOUT VAR_SYNTH_INSECURE_DNAME
+%token VAR_INFRA_CACHE_RTT_PERCENTILE
 
 %%
 toplevelvars: /* empty */ | toplevelvars toplevelvar ;
@@ -267,7 +276,19 @@ content_server: server_num_threads | server_verbosity | server_port |
 	server_tcp_connection_limit | server_log_servfail | server_deny_any |
 	server_unknown_server_time_limit | server_log_tag_queryreply |
 	server_stream_wait_size | server_tls_ciphers |
-	server_tls_ciphersuites | server_tls_session_ticket_keys
+	server_tls_ciphersuites | server_tls_session_ticket_keys |
+	server_mesh_class_weight | server_mesh_class_limit |
+	server_trace_sample_rate | server_trace_slow_threshold |
+	server_work_stealing | server_mesh_fair_share |
+	server_mesh_fair_share_prefix4 | server_mesh_fair_share_prefix6 |
+	server_sig_cache_size | server_sig_cache_slabs |
+	server_val_crypto_threads | server_nsec3_hash_cache_size |
+	server_nsec3_hash_cache_slabs | server_nsec3_hash_ratelimit |
+	server_hedge_percentile | server_hedge_budget |
+	server_target_fetch_parallel | server_refresh_popular |
+	server_refresh_popular_rate | server_refresh_popular_size |
+	server_serve_expired_client_timeout | server_synth_insecure_dname |
+	server_infra_cache_rtt_percentile
 	;
 stubstart: VAR_STUB_ZONE
 	{
@@ -1224,6 +1245,86 @@ server_jostle_timeout: VAR_JOSTLE_TIMEOUT STRING_ARG
 		free($2);
 	}
 	;
+server_mesh_class_weight: VAR_MESH_CLASS_WEIGHT STRING_ARG
+	{
+		OUTYY(("P(server_mesh_class_weight:%s)\n", $2));
+		free(cfg_parser->cfg->mesh_class_weight);
+		cfg_parser->cfg->mesh_class_weight = $2;
+	}
+	;
+server_mesh_class_limit: VAR_MESH_CLASS_LIMIT STRING_ARG
+	{
+		OUTYY(("P(server_mesh_class_limit:%s)\n", $2));
+		free(cfg_parser->cfg->mesh_class_limit);
+		cfg_parser->cfg->mesh_class_limit = $2;
+	}
+	;
+server_trace_sample_rate: VAR_TRACE_SAMPLE_RATE STRING_ARG
+	{
+		OUTYY(("P(server_trace_sample_rate:%s)\n", $2));
+		if(atoi($2) == 0 && strcmp($2, "0") != 0)
+			yyerror("number expected");
+		else if(atoi($2) < 0)
+			yyerror("positive number expected");
+		else cfg_parser->cfg->trace_sample_rate = atoi($2);
+		free($2);
+	}
+	;
+server_trace_slow_threshold: VAR_TRACE_SLOW_THRESHOLD STRING_ARG
+	{
+		OUTYY(("P(server_trace_slow_threshold:%s)\n", $2));
+		if(atoi($2) == 0 && strcmp($2, "0") != 0)
+			yyerror("number expected");
+		else if(atoi($2) < 0)
+			yyerror("positive number expected");
+		else cfg_parser->cfg->trace_slow_threshold = atoi($2);
+		free($2);
+	}
+	;
+server_work_stealing: VAR_WORK_STEALING STRING_ARG
+	{
+		OUTYY(("P(server_work_stealing:%s)\n", $2));
+		if(strcmp($2, "yes") != 0 && strcmp($2, "no") != 0)
+			yyerror("expected yes or no.");
+		else cfg_parser->cfg->work_stealing = (strcmp($2, "yes")==0);
+		free($2);
+	}
+	;
+server_mesh_fair_share: VAR_MESH_FAIR_SHARE STRING_ARG
+	{
+		OUTYY(("P(server_mesh_fair_share:%s)\n", $2));
+		if(strcmp($2, "yes") != 0 && strcmp($2, "no") != 0)
+			yyerror("expected yes or no.");
+		else cfg_parser->cfg->mesh_fair_share = (strcmp($2, "yes")==0);
+		free($2);
+	}
+	;
+server_mesh_fair_share_prefix4: VAR_MESH_FAIR_SHARE_PREFIX4 STRING_ARG
+	{
+		OUTYY(("P(server_mesh_fair_share_prefix4:%s)\n", $2));
+		if(atoi($2) == 0 && strcmp($2, "0") != 0)
+			yyerror("IPv4 prefix length expected");
+		else if(atoi($2) > 32)
+			cfg_parser->cfg->mesh_fair_share_prefix4 = 32;
+		else if(atoi($2) < 0)
+			cfg_parser->cfg->mesh_fair_share_prefix4 = 0;
+		else cfg_parser->cfg->mesh_fair_share_prefix4 = atoi($2);
+		free($2);
+	}
+	;
+server_mesh_fair_share_prefix6: VAR_MESH_FAIR_SHARE_PREFIX6 STRING_ARG
+	{
+		OUTYY(("P(server_mesh_fair_share_prefix6:%s)\n", $2));
+		if(atoi($2) == 0 && strcmp($2, "0") != 0)
+			yyerror("IPv6 prefix length expected");
+		else if(atoi($2) > 128)
+			cfg_parser->cfg->mesh_fair_share_prefix6 = 128;
+		else if(atoi($2) < 0)
+			cfg_parser->cfg->mesh_fair_share_prefix6 = 0;
+		else cfg_parser->cfg->mesh_fair_share_prefix6 = atoi($2);
+		free($2);
+	}
+	;
 server_delay_close: VAR_DELAY_CLOSE STRING_ARG
 	{
 		OUTYY(("P(server_delay_close:%s)\n", $2));
@@ -1330,6 +1431,16 @@ server_infra_cache_min_rtt: VAR_INFRA_CACHE_MIN_RTT STRING_ARG
 		free($2);
 	}
 	;
+server_infra_cache_rtt_percentile: VAR_INFRA_CACHE_RTT_PERCENTILE STRING_ARG
+	{
+		OUTYY(("P(server_infra_cache_rtt_percentile:%s)\n", $2));
+		if(strcmp($2, "yes") != 0 && strcmp($2, "no") != 0)
+			yyerror("expected yes or no.");
+		else cfg_parser->cfg->infra_cache_rtt_percentile =
+			(strcmp($2, "yes")==0);
+		free($2);
+	}
+	;
 server_target_fetch_policy: VAR_TARGET_FETCH_POLICY STRING_ARG
 	{
 		OUTYY(("P(server_target_fetch_policy:%s)\n", $2));
@@ -1337,6 +1448,15 @@ server_target_fetch_policy: VAR_TARGET_FETCH_POLICY STRING_ARG
 		cfg_parser->cfg->target_fetch_policy = $2;
 	}
 	;
+server_target_fetch_parallel: VAR_TARGET_FETCH_PARALLEL STRING_ARG
+	{
+		OUTYY(("P(server_target_fetch_parallel:%s)\n", $2));
+		if(atoi($2) <= 0)
+			yyerror("positive number expected");
+		else cfg_parser->cfg->target_fetch_parallel = atoi($2);
+		free($2);
+	}
+	;
 server_harden_short_bufsize: VAR_HARDEN_SHORT_BUFSIZE STRING_ARG
 	{
 		OUTYY(("P(server_harden_short_bufsize:%s)\n", $2));
@@ -1456,6 +1576,33 @@ server_prefetch_key: VAR_PREFETCH_KEY STRING_ARG
 		free($2);
 	}
 	;
+server_refresh_popular: VAR_REFRESH_POPULAR STRING_ARG
+	{
+		OUTYY(("P(server_refresh_popular:%s)\n", $2));
+		if(strcmp($2, "yes") != 0 && strcmp($2, "no") != 0)
+			yyerror("expected yes or no.");
+		else cfg_parser->cfg->refresh_popular = (strcmp($2, "yes")==0);
+		free($2);
+	}
+	;
+server_refresh_popular_rate: VAR_REFRESH_POPULAR_RATE STRING_ARG
+	{
+		OUTYY(("P(server_refresh_popular_rate:%s)\n", $2));
+		if(atoi($2) <= 0)
+			yyerror("positive number expected");
+		else cfg_parser->cfg->refresh_popular_rate = atoi($2);
+		free($2);
+	}
+	;
+server_refresh_popular_size: VAR_REFRESH_POPULAR_SIZE STRING_ARG
+	{
+		OUTYY(("P(server_refresh_popular_size:%s)\n", $2));
+		if(atoi($2) <= 0)
+			yyerror("positive number expected");
+		else cfg_parser->cfg->refresh_popular_size = (size_t)atoi($2);
+		free($2);
+	}
+	;
 server_deny_any: VAR_DENY_ANY STRING_ARG
 	{
 		OUTYY(("P(server_deny_any:%s)\n", $2));
@@ -1629,6 +1776,17 @@ server_aggressive_nsec: VAR_AGGRESSIVE_NSEC STRING_ARG
 		free($2);
 	}
 	;
+server_synth_insecure_dname: VAR_SYNTH_INSECURE_DNAME STRING_ARG
+	{
+		OUTYY(("P(server_synth_insecure_dname:%s)\n", $2));
+		if(strcmp($2, "yes") != 0 && strcmp($2, "no") != 0)
+			yyerror("expected yes or no.");
+		else
+			cfg_parser->cfg->synth_insecure_dname =
+				(strcmp($2, "yes")==0);
+		free($2);
+	}
+	;
 server_ignore_cd_flag: VAR_IGNORE_CD_FLAG STRING_ARG
 	{
 		OUTYY(("P(server_ignore_cd_flag:%s)\n", $2));
@@ -1665,6 +1823,15 @@ server_serve_expired_ttl_reset: VAR_SERVE_EXPIRED_TTL_RESET STRING_ARG
 		free($2);
 	}
 	;
+server_serve_expired_client_timeout: VAR_SERVE_EXPIRED_CLIENT_TIMEOUT STRING_ARG
+	{
+		OUTYY(("P(server_serve_expired_client_timeout:%s)\n", $2));
+		if(atoi($2) == 0 && strcmp($2, "0") != 0)
+			yyerror("number expected");
+		else cfg_parser->cfg->serve_expired_client_timeout = atoi($2);
+		free($2);
+	}
+	;
 server_fake_dsa: VAR_FAKE_DSA STRING_ARG
 	{
 		OUTYY(("P(server_fake_dsa:%s)\n", $2));
@@ -1764,6 +1931,67 @@ server_key_cache_slabs: VAR_KEY_CACHE_SLABS STRING_ARG
 		free($2);
 	}
 	;
+server_sig_cache_size: VAR_SIG_CACHE_SIZE STRING_ARG
+	{
+		OUTYY(("P(server_sig_cache_size:%s)\n", $2));
+		if(!cfg_parse_memsize($2, &cfg_parser->cfg->sig_cache_size))
+			yyerror("memory size expected");
+		free($2);
+	}
+	;
+server_sig_cache_slabs: VAR_SIG_CACHE_SLABS STRING_ARG
+	{
+		OUTYY(("P(server_sig_cache_slabs:%s)\n", $2));
+		if(atoi($2) == 0)
+			yyerror("number expected");
+		else {
+			cfg_parser->cfg->sig_cache_slabs = atoi($2);
+			if(!is_pow2(cfg_parser->cfg->sig_cache_slabs))
+				yyerror("must be a power of 2");
+		}
+		free($2);
+	}
+	;
+server_val_crypto_threads: VAR_VAL_CRYPTO_THREADS STRING_ARG
+	{
+		OUTYY(("P(server_val_crypto_threads:%s)\n", $2));
+		if(atoi($2) == 0 && strcmp($2, "0") != 0)
+			yyerror("number expected");
+		else cfg_parser->cfg->val_crypto_threads = atoi($2);
+		free($2);
+	}
+	;
+server_nsec3_hash_cache_size: VAR_NSEC3_HASH_CACHE_SIZE STRING_ARG
+	{
+		OUTYY(("P(server_nsec3_hash_cache_size:%s)\n", $2));
+		if(!cfg_parse_memsize($2,
+			&cfg_parser->cfg->nsec3_hash_cache_size))
+			yyerror("memory size expected");
+		free($2);
+	}
+	;
+server_nsec3_hash_cache_slabs: VAR_NSEC3_HASH_CACHE_SLABS STRING_ARG
+	{
+		OUTYY(("P(server_nsec3_hash_cache_slabs:%s)\n", $2));
+		if(atoi($2) == 0)
+			yyerror("number expected");
+		else {
+			cfg_parser->cfg->nsec3_hash_cache_slabs = atoi($2);
+			if(!is_pow2(cfg_parser->cfg->nsec3_hash_cache_slabs))
+				yyerror("must be a power of 2");
+		}
+		free($2);
+	}
+	;
+server_nsec3_hash_ratelimit: VAR_NSEC3_HASH_RATELIMIT STRING_ARG
+	{
+		OUTYY(("P(server_nsec3_hash_ratelimit:%s)\n", $2));
+		if(atoi($2) == 0 && strcmp($2, "0") != 0)
+			yyerror("number expected");
+		else cfg_parser->cfg->nsec3_hash_ratelimit = atoi($2);
+		free($2);
+	}
+	;
 server_neg_cache_size: VAR_NEG_CACHE_SIZE STRING_ARG
 	{
 		OUTYY(("P(server_neg_cache_size:%s)\n", $2));
@@ -2138,6 +2366,26 @@ server_fast_server_permil: VAR_FAST_SERVER_PERMIL STRING_ARG
 		free($2);
 	}
 	;
+server_hedge_percentile: VAR_HEDGE_PERCENTILE STRING_ARG
+	{
+		OUTYY(("P(server_hedge_percentile:%s)\n", $2));
+		if(atoi($2) == 0 && strcmp($2, "0") != 0)
+			yyerror("number expected");
+		else if(atoi($2) < 0 || atoi($2) > 99)
+			yyerror("percentile must be between 0 and 99");
+		else cfg_parser->cfg->hedge_percentile = atoi($2);
+		free($2);
+	}
+	;
+server_hedge_budget: VAR_HEDGE_BUDGET STRING_ARG
+	{
+		OUTYY(("P(server_hedge_budget:%s)\n", $2));
+		if(atoi($2) == 0 && strcmp($2, "0") != 0)
+			yyerror("number expected");
+		else cfg_parser->cfg->hedge_budget = atoi($2);
+		free($2);
+	}
+	;
 server_qname_minimisation: VAR_QNAME_MINIMISATION STRING_ARG
 	{
 		OUTYY(("P(server_qname_minimisation:%s)\n", $2));
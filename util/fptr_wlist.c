@@ -52,15 +52,23 @@
 #include "services/authzone.h"
 #include "services/cache/infra.h"
 #include "services/cache/rrset.h"
+#include "services/cache/refresh.h"
+#include "services/cache/delegcache.h"
 #include "services/view.h"
 #include "dns64/dns64.h"
 #include "iterator/iterator.h"
 #include "iterator/iter_fwd.h"
+#include "iterator/iter_delegpt.h"
 #include "validator/validator.h"
 #include "validator/val_anchor.h"
 #include "validator/val_nsec3.h"
 #include "validator/val_sigcrypt.h"
 #include "validator/val_kentry.h"
+#include "validator/val_secalgo.h"
+#include "validator/val_sigcache.h"
+#include "iterator/iter_nocut.h"
+#include "validator/val_nsec3cache.h"
+#include "validator/val_cryptopool.h"
 #include "validator/val_neg.h"
 #include "validator/autotrust.h"
 #include "util/data/msgreply.h"
@@ -122,11 +130,14 @@ fptr_whitelist_comm_timer(void (*fptr)(void*))
 	else if(fptr == &pending_udp_timer_delay_cb) return 1;
 	else if(fptr == &worker_stat_timer_cb) return 1;
 	else if(fptr == &worker_probe_timer_cb) return 1;
+	else if(fptr == &worker_refresh_timer_cb) return 1;
 #ifdef UB_ON_WINDOWS
 	else if(fptr == &wsvc_cron_cb) return 1;
 #endif
 	else if(fptr == &auth_xfer_timer) return 1;
 	else if(fptr == &auth_xfer_probe_timer_callback) return 1;
+	else if(fptr == &iter_hedge_timer_cb) return 1;
+	else if(fptr == &mesh_serve_expired_callback) return 1;
 	return 0;
 }
 
@@ -200,6 +211,8 @@ fptr_whitelist_rbtree_cmp(int (*fptr) (const void *, const void *))
 {
 	if(fptr == &mesh_state_compare) return 1;
 	else if(fptr == &mesh_state_ref_compare) return 1;
+	else if(fptr == &mesh_client_compare) return 1;
+	else if(fptr == &mesh_client_num_compare) return 1;
 	else if(fptr == &addr_tree_compare) return 1;
 	else if(fptr == &local_zone_cmp) return 1;
 	else if(fptr == &local_data_cmp) return 1;
@@ -207,6 +220,7 @@ fptr_whitelist_rbtree_cmp(int (*fptr) (const void *, const void *))
 	else if(fptr == &pending_cmp) return 1;
 	else if(fptr == &serviced_cmp) return 1;
 	else if(fptr == &name_tree_compare) return 1;
+	else if(fptr == &deleg_cache_cmp) return 1;
 	else if(fptr == &order_lock_cmp) return 1;
 	else if(fptr == &codeline_cmp) return 1;
 	else if(fptr == &nsec3_hash_cmp) return 1;
@@ -222,6 +236,10 @@ fptr_whitelist_rbtree_cmp(int (*fptr) (const void *, const void *))
 	else if(fptr == &auth_zone_cmp) return 1;
 	else if(fptr == &auth_data_cmp) return 1;
 	else if(fptr == &auth_xfer_cmp) return 1;
+	else if(fptr == &delegpt_ns_cmp) return 1;
+	else if(fptr == &delegpt_addr_cmp) return 1;
+	else if(fptr == &refresh_query_cmp) return 1;
+	else if(fptr == &refresh_due_cmp) return 1;
 	return 0;
 }
 
@@ -232,6 +250,11 @@ fptr_whitelist_hash_sizefunc(lruhash_sizefunc_type fptr)
 	else if(fptr == &ub_rrset_sizefunc) return 1;
 	else if(fptr == &infra_sizefunc) return 1;
 	else if(fptr == &key_entry_sizefunc) return 1;
+	else if(fptr == &secalgo_keycache_sizefunc) return 1;
+	else if(fptr == &sigcache_sizefunc) return 1;
+	else if(fptr == &nocut_sizefunc) return 1;
+	else if(fptr == &nsec3cache_sizefunc) return 1;
+	else if(fptr == &nsec3cache_rate_sizefunc) return 1;
 	else if(fptr == &rate_sizefunc) return 1;
 	else if(fptr == &ip_rate_sizefunc) return 1;
 	else if(fptr == &test_slabhash_sizefunc) return 1;
@@ -252,6 +275,11 @@ fptr_whitelist_hash_compfunc(lruhash_compfunc_type fptr)
 	else if(fptr == &ub_rrset_compare) return 1;
 	else if(fptr == &infra_compfunc) return 1;
 	else if(fptr == &key_entry_compfunc) return 1;
+	else if(fptr == &secalgo_keycache_compfunc) return 1;
+	else if(fptr == &sigcache_compfunc) return 1;
+	else if(fptr == &nocut_compfunc) return 1;
+	else if(fptr == &nsec3cache_compfunc) return 1;
+	else if(fptr == &nsec3cache_rate_compfunc) return 1;
 	else if(fptr == &rate_compfunc) return 1;
 	else if(fptr == &ip_rate_compfunc) return 1;
 	else if(fptr == &test_slabhash_compfunc) return 1;
@@ -269,6 +297,11 @@ fptr_whitelist_hash_delkeyfunc(lruhash_delkeyfunc_type fptr)
 	else if(fptr == &ub_rrset_key_delete) return 1;
 	else if(fptr == &infra_delkeyfunc) return 1;
 	else if(fptr == &key_entry_delkeyfunc) return 1;
+	else if(fptr == &secalgo_keycache_delkeyfunc) return 1;
+	else if(fptr == &sigcache_delkeyfunc) return 1;
+	else if(fptr == &nocut_delkeyfunc) return 1;
+	else if(fptr == &nsec3cache_delkeyfunc) return 1;
+	else if(fptr == &nsec3cache_rate_delkeyfunc) return 1;
 	else if(fptr == &rate_delkeyfunc) return 1;
 	else if(fptr == &ip_rate_delkeyfunc) return 1;
 	else if(fptr == &test_slabhash_delkey) return 1;
@@ -286,6 +319,10 @@ fptr_whitelist_hash_deldatafunc(lruhash_deldatafunc_type fptr)
 	else if(fptr == &rrset_data_delete) return 1;
 	else if(fptr == &infra_deldatafunc) return 1;
 	else if(fptr == &key_entry_deldatafunc) return 1;
+	else if(fptr == &secalgo_keycache_deldatafunc) return 1;
+	else if(fptr == &sigcache_deldatafunc) return 1;
+	else if(fptr == &nocut_deldatafunc) return 1;
+	else if(fptr == &nsec3cache_deldatafunc) return 1;
 	else if(fptr == &rate_deldatafunc) return 1;
 	else if(fptr == &test_slabhash_deldata) return 1;
 #ifdef CLIENT_SUBNET
@@ -511,6 +548,8 @@ int fptr_whitelist_tube_listen(tube_callback_type* fptr)
 {
 	if(fptr == &worker_handle_control_cmd) return 1;
 	else if(fptr == &libworker_handle_control_cmd) return 1;
+	else if(fptr == &worker_handle_handoff) return 1;
+	else if(fptr == &mesh_async_handle) return 1;
 	return 0;
 }
 
@@ -525,6 +564,12 @@ int fptr_whitelist_mesh_cb(mesh_cb_func_type fptr)
 	return 0;
 }
 
+int fptr_whitelist_mesh_async(mesh_async_func_type* fptr)
+{
+	if(fptr == &val_cryptopool_batch_done) return 1;
+	return 0;
+}
+
 int fptr_whitelist_print_func(void (*fptr)(char*,void*))
 {
 	if(fptr == &config_print_func) return 1;
@@ -336,6 +336,14 @@ int fptr_whitelist_tube_listen(tube_callback_type* fptr);
  */
 int fptr_whitelist_mesh_cb(mesh_cb_func_type fptr);
 
+/**
+ * Check function pointer whitelist for mesh async item callback values.
+ *
+ * @param fptr: function pointer to check.
+ * @return false if not in whitelist.
+ */
+int fptr_whitelist_mesh_async(mesh_async_func_type* fptr);
+
 /**
  * Check function pointer whitelist for config_get_option func values.
  * @param fptr: function pointer to check.
@@ -52,8 +52,6 @@
 /** what size to align on; make sure a char* fits in it. */
 #define ALIGNMENT          (sizeof(uint64_t))
 
-/** Default reasonable size for chunks */
-#define REGIONAL_CHUNK_SIZE         8192
 #ifdef UNBOUND_ALLOC_NONREGIONAL
 /** All objects allocated outside of chunks, for debug */
 #define REGIONAL_LARGE_OBJECT_SIZE  0
@@ -87,17 +85,71 @@ regional_create_custom(size_t size)
 	log_assert(sizeof(struct regional) <= size);
 	if(!r) return NULL;
 	r->first_size = size;
+	r->chunk_cache = NULL;
 	regional_init(r);
 	return r;
 }
 
+void
+regional_set_chunk_cache(struct regional* r,
+	struct regional_chunk_cache* cache)
+{
+	r->chunk_cache = cache;
+}
+
+void
+regional_chunk_cache_clear(struct regional_chunk_cache* cache)
+{
+	char* p = cache->list, *np;
+	while(p) {
+		np = *(char**)p;
+		free(p);
+		p = np;
+	}
+	cache->list = NULL;
+	cache->num = 0;
+}
+
+/** get a chunk, from the chunk cache if possible */
+static char*
+regional_chunk_get(struct regional* r)
+{
+	struct regional_chunk_cache* cache = r->chunk_cache;
+	char* s;
+	if(cache) {
+		if(cache->list) {
+			s = cache->list;
+			cache->list = *(char**)s;
+			cache->num--;
+			cache->num_reused++;
+			return s;
+		}
+		cache->num_new++;
+	}
+	return (char*)malloc(REGIONAL_CHUNK_SIZE);
+}
+
+/** put a chunk back, in the chunk cache if there is space */
+static void
+regional_chunk_put(struct regional* r, char* p)
+{
+	struct regional_chunk_cache* cache = r->chunk_cache;
+	if(cache && cache->num < cache->max) {
+		*(char**)p = cache->list;
+		cache->list = p;
+		cache->num++;
+		return;
+	}
+	free(p);
+}
+
 void 
 regional_free_all(struct regional *r)
 {
 	char* p = r->next, *np;
 	while(p) {
 		np = *(char**)p;
-		free(p);
+		regional_chunk_put(r, p);
 		p = np;
 	}
 	p = r->large_list;
@@ -124,6 +176,16 @@ regional_alloc(struct regional *r, size_t size)
 	void *s;
 	/* large objects */
 	if(a > REGIONAL_LARGE_OBJECT_SIZE) {
+		if(r->chunk_cache && a <= REGIONAL_CHUNK_SIZE - ALIGNMENT) {
+			/* put it in a chunk of its own, that is recycled
+			 * with the other chunks.  The current chunk stays
+			 * where it is, the list order does not matter */
+			s = regional_chunk_get(r);
+			if(!s) return NULL;
+			*(char**)s = r->next;
+			r->next = (char*)s;
+			return (char*)s+ALIGNMENT;
+		}
 		s = malloc(ALIGNMENT + size);
 		if(!s) return NULL;
 		r->total_large += ALIGNMENT+size;
@@ -133,7 +195,7 @@ regional_alloc(struct regional *r, size_t size)
 	}
 	/* create a new chunk */
 	if(a > r->available) {
-		s = malloc(REGIONAL_CHUNK_SIZE);
+		s = regional_chunk_get(r);
 		if(!s) return NULL;
 		*(char**)s = r->next;
 		r->next = (char*)s;
@@ -51,6 +51,27 @@
 #ifndef UTIL_REGIONAL_H_
 #define UTIL_REGIONAL_H_
 
+/** Default reasonable size for chunks */
+#define REGIONAL_CHUNK_SIZE         8192
+
+/**
+ * Free list of chunks, for the regionals of one thread.  Chunks that
+ * are freed go on the list and are used again by the next regional
+ * that needs a chunk, instead of free and malloc.
+ */
+struct regional_chunk_cache {
+	/** list of free chunks, the next ptr is in the first bytes */
+	char* list;
+	/** number of chunks on the list */
+	size_t num;
+	/** max number of chunks to keep on the list */
+	size_t max;
+	/** number of chunks taken from the list */
+	size_t num_reused;
+	/** number of chunks malloced because the list was empty */
+	size_t num_new;
+};
+
 /** 
  * the regional* is the first block*.
  * every block has a ptr to the next in first bytes.
@@ -74,6 +95,8 @@ struct regional
 	size_t available;
 	/** current chunk data position. */
 	char* data;
+	/** chunk cache to get and put chunks, or NULL to use malloc. */
+	struct regional_chunk_cache* chunk_cache;
 };
 
 /**
@@ -141,6 +164,22 @@ void *regional_alloc_zero(struct regional *r, size_t size);
  */
 char *regional_strdup(struct regional *r, const char *string);
 
+/**
+ * Set the chunk cache for the regional.  Extra chunks, and large objects
+ * that fit in a chunk, are taken from and returned to the cache.
+ * @param r: the region.
+ * @param cache: the chunk cache, it must outlive the region. NULL to
+ *	malloc and free the chunks.
+ */
+void regional_set_chunk_cache(struct regional* r,
+	struct regional_chunk_cache* cache);
+
+/**
+ * Free the chunks in the chunk cache.
+ * @param cache: the chunk cache.  Its stats are kept.
+ */
+void regional_chunk_cache_clear(struct regional_chunk_cache* cache);
+
 /** Debug print regional statistics to log */
 void regional_log_stats(struct regional *r);
 
@@ -120,3 +120,63 @@ int rtt_notimeout(const struct rtt_info* rtt)
 {
 	return calc_rto(rtt);
 }
+
+/** upper bounds (exclusive) of the sketch buckets, in msec */
+static const int rtt_sketch_bound[RTT_SKETCH_BUCKETS] = {
+	2, 3, 4, 6, 8, 12, 16, 24, 32, 48, 64, 96, 128, 192, 256, 384,
+	512, 768, 1024, 1536, 2048, 3072, 4096, 6144, 8192, 12288, 16384,
+	RTT_MAX_TIMEOUT };
+
+void
+rtt_sketch_init(struct rtt_sketch* s)
+{
+	memset(s, 0, sizeof(*s));
+}
+
+void
+rtt_sketch_add(struct rtt_sketch* s, int ms)
+{
+	int i = 0;
+	while(i < RTT_SKETCH_BUCKETS-1 && ms >= rtt_sketch_bound[i])
+		i++;
+	if(s->total >= RTT_SKETCH_DECAY) {
+		/* halve the counts, rounded up so that the last sample in
+		 * a bucket is not lost at once */
+		int j;
+		s->total = 0;
+		for(j=0; j<RTT_SKETCH_BUCKETS; j++) {
+			s->count[j] = (s->count[j]+1)/2;
+			s->total += s->count[j];
+		}
+	}
+	s->count[i]++;
+	s->total++;
+}
+
+int
+rtt_sketch_percentile(const struct rtt_sketch* s, int pct)
+{
+	int i, lo, hi;
+	unsigned int want, sum = 0;
+	if(s->total < RTT_SKETCH_MIN)
+		return 0;
+	/* rank of the sample at the percentile, 1..total */
+	want = ((unsigned int)s->total * (unsigned int)pct + 99) / 100;
+	if(want < 1)
+		want = 1;
+	for(i=0; i<RTT_SKETCH_BUCKETS; i++) {
+		if(sum + s->count[i] >= want)
+			break;
+		sum += s->count[i];
+	}
+	if(i >= RTT_SKETCH_BUCKETS)
+		i = RTT_SKETCH_BUCKETS-1;
+	lo = (i==0)?1:rtt_sketch_bound[i-1];
+	/* the last bucket is open ended, report its lower bound */
+	if(i == RTT_SKETCH_BUCKETS-1)
+		return lo;
+	hi = rtt_sketch_bound[i];
+	/* samples are taken to be spread evenly over the bucket */
+	return lo + (int)((unsigned int)(hi-lo)*(2*(want-sum)-1)/
+		(2*(unsigned int)s->count[i]));
+}
@@ -55,6 +55,25 @@ struct rtt_info {
 	int rto;
 };
 
+/** number of buckets in the rtt sketch */
+#define RTT_SKETCH_BUCKETS 28
+/** when the sketch has this many samples, the counts are halved */
+#define RTT_SKETCH_DECAY 512
+/** number of samples before the sketch percentiles are used */
+#define RTT_SKETCH_MIN 16
+
+/**
+ * RTT distribution sketch.  A histogram of roundtrip times with
+ * exponentially sized buckets.  The counts are halved when they add up
+ * to RTT_SKETCH_DECAY, so that old samples fade out.
+ */
+struct rtt_sketch {
+	/** decayed number of samples in each bucket */
+	uint16_t count[RTT_SKETCH_BUCKETS];
+	/** sum of the counts */
+	uint16_t total;
+};
+
 /** min retransmit timeout value, in milliseconds */
 extern int RTT_MIN_TIMEOUT;
 /** max retransmit timeout value, in milliseconds */
@@ -104,4 +123,27 @@ void rtt_update(struct rtt_info* rtt, int ms);
  */
 void rtt_lost(struct rtt_info* rtt, int orig);
 
+/**
+ * Initialize the rtt sketch, empty.
+ * @param s: the sketch.
+ */
+void rtt_sketch_init(struct rtt_sketch* s);
+
+/**
+ * Add a roundtrip time sample to the sketch.
+ * @param s: the sketch.
+ * @param ms: roundtrip time in milliseconds.
+ */
+void rtt_sketch_add(struct rtt_sketch* s, int ms);
+
+/**
+ * Get a percentile of the roundtrip times in the sketch.  It is
+ * interpolated within the bucket.
+ * @param s: the sketch.
+ * @param pct: the percentile, 1-99.
+ * @return value in msec, or 0 if there are less than RTT_SKETCH_MIN
+ *	samples.
+ */
+int rtt_sketch_percentile(const struct rtt_sketch* s, int pct);
+
 #endif /* UTIL_RTT_H */
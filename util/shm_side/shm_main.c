@@ -288,6 +288,17 @@ void shm_main_run(struct worker *worker)
 	/* print the thread statistics */
 	stat_total->mesh_time_median /= (double)worker->daemon->num;
 
+	/* the imbalance uses the latest values of the other threads */
+	server_stats_imbalance(worker->daemon->shm_info->ptr_arr + 1,
+		worker->daemon->num);
+	stat_total->mesh_imbalance = 0.0;
+	for(offset = 1; offset <= worker->daemon->num; offset++) {
+		if(stat_total[offset].mesh_imbalance >
+			stat_total->mesh_imbalance)
+			stat_total->mesh_imbalance =
+				stat_total[offset].mesh_imbalance;
+	}
+
 #else
 	(void)worker;
 #endif /* HAVE_SHMGET */
@@ -1285,12 +1285,13 @@ rr_is_selfsigned_revoked(struct module_env* env, struct val_env* ve,
 {
 	enum sec_status sec;
 	char* reason = NULL;
+	struct rbtree_type* sortree = NULL;
 	verbose(VERB_ALGO, "seen REVOKE flag, check self-signed, rr %d",
 		(int)i);
 	/* no algorithm downgrade protection necessary, if it is selfsigned
 	 * revoked it can be removed. */
 	sec = dnskey_verify_rrset(env, ve, dnskey_rrset, dnskey_rrset, i, 
-		&reason, LDNS_SECTION_ANSWER, qstate);
+		&sortree, &reason, LDNS_SECTION_ANSWER, qstate);
 	return (sec == sec_status_secure);
 }
 
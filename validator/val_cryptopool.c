@@ -0,0 +1,326 @@
+/*
+ * validator/val_cryptopool.c - threads that verify signatures for the validator
+ *
+ * Copyright (c) 2026, NLnet Labs. All rights reserved.
+ *
+ * This software is open source.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 
+ * Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ * 
+ * Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ * 
+ * Neither the name of the NLNET LABS nor the names of its contributors may
+ * be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ * TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+/**
+ * \file
+ *
+ * This file contains a pool of threads that verify signatures.
+ */
+#include "config.h"
+#include "validator/val_cryptopool.h"
+#include "validator/validator.h"
+#include "validator/val_secalgo.h"
+#include "util/log.h"
+#include "util/tube.h"
+#include "util/module.h"
+#include "sldns/sbuffer.h"
+
+/** a job is done, post the batch if it was the last, or free it if the
+ * query is gone */
+static void
+cryptopool_job_done(struct val_cryptopool* pool, struct val_crypto_batch* b)
+{
+	int del = 0;
+	lock_basic_lock(&pool->lock);
+	if(--b->outstanding == 0) {
+		if(b->cancelled)
+			del = 1;
+		else {
+			b->posted = 1;
+			mesh_async_post(b->mesh, &b->async);
+		}
+	}
+	lock_basic_unlock(&pool->lock);
+	if(del)
+		free(b);
+}
+
+/** perform a signature check and store the result in the cache */
+static void
+cryptopool_do_job(struct val_cryptopool* pool, struct val_crypto_job* j)
+{
+	sldns_buffer buf;
+	enum sec_status sec;
+	char* reason = NULL;
+	int cancelled;
+	lock_basic_lock(&pool->lock);
+	cancelled = j->batch->cancelled;
+	lock_basic_unlock(&pool->lock);
+	if(!cancelled) {
+		sldns_buffer_init_frm_data(&buf, j->data, j->datalen);
+		sec = verify_canonrrset(&buf, j->algo, j->sig, j->siglen,
+			j->key, j->keylen, pool->pkey_cache, &reason);
+		if(sec == sec_status_secure)
+			val_sigcache_insert(pool->sigcache, &j->sck, sec,
+				j->ttl_secure);
+		else if(sec == sec_status_bogus)
+			val_sigcache_insert(pool->sigcache, &j->sck, sec,
+				j->ttl_bogus);
+	}
+	cryptopool_job_done(pool, j->batch);
+	free(j);
+}
+
+/** main routine of a crypto thread */
+static void*
+cryptopool_thread_main(void* arg)
+{
+	struct val_crypto_thread* t = (struct val_crypto_thread*)arg;
+	struct val_crypto_job* j;
+	uint8_t* msg;
+	uint32_t len;
+	log_thread_set(NULL);
+	ub_thread_blocksigs();
+	while(tube_read_msg(t->tube, &msg, &len, 0)) {
+		if(len != sizeof(j)) {
+			log_err("cryptopool: bad message length %d", (int)len);
+			free(msg);
+			continue;
+		}
+		memmove(&j, msg, sizeof(j));
+		free(msg);
+		if(!j)
+			break;
+		cryptopool_do_job(t->pool, j);
+	}
+	return NULL;
+}
+
+struct val_cryptopool*
+val_cryptopool_create(int num, struct slabhash* pkey_cache,
+	struct val_sigcache* sigcache)
+{
+#ifdef THREADS_DISABLED
+	(void)num; (void)pkey_cache; (void)sigcache;
+	log_warn("val-crypto-threads: no thread support, signatures are "
+		"verified inline");
+	return NULL;
+#else
+	struct val_cryptopool* pool;
+	int i;
+	if(!sigcache) {
+		log_warn("val-crypto-threads needs the signature cache, "
+			"signatures are verified inline");
+		return NULL;
+	}
+	pool = (struct val_cryptopool*)calloc(1, sizeof(*pool));
+	if(!pool) {
+		log_err("malloc failure");
+		return NULL;
+	}
+	pool->threads = (struct val_crypto_thread*)calloc((size_t)num,
+		sizeof(*pool->threads));
+	if(!pool->threads) {
+		log_err("malloc failure");
+		free(pool);
+		return NULL;
+	}
+	lock_basic_init(&pool->lock);
+	lock_protect(&pool->lock, &pool->next, sizeof(pool->next));
+	pool->pkey_cache = pkey_cache;
+	pool->sigcache = sigcache;
+	for(i=0; i<num; i++) {
+		pool->threads[i].pool = pool;
+		if(!(pool->threads[i].tube = tube_create())) {
+			log_err("cryptopool: could not create tube");
+			val_cryptopool_delete(pool);
+			return NULL;
+		}
+		lock_basic_init(&pool->threads[i].write_lock);
+		ub_thread_create(&pool->threads[i].thr,
+			cryptopool_thread_main, &pool->threads[i]);
+		pool->num = i+1;
+	}
+	verbose(VERB_ALGO, "started %d crypto threads", num);
+	return pool;
+#endif /* THREADS_DISABLED */
+}
+
+void
+val_cryptopool_delete(struct val_cryptopool* pool)
+{
+	struct val_crypto_job* stop = NULL;
+	int i;
+	if(!pool)
+		return;
+	/* the threads finish the jobs before the stop message */
+	for(i=0; i<pool->num; i++) {
+		lock_basic_lock(&pool->threads[i].write_lock);
+		if(!tube_write_msg(pool->threads[i].tube, (uint8_t*)&stop,
+			sizeof(stop), 0))
+			log_err("cryptopool: could not stop thread");
+		lock_basic_unlock(&pool->threads[i].write_lock);
+	}
+	for(i=0; i<pool->num; i++)
+		ub_thread_join(pool->threads[i].thr);
+	for(i=0; i<pool->num; i++) {
+		tube_delete(pool->threads[i].tube);
+		lock_basic_destroy(&pool->threads[i].write_lock);
+	}
+	lock_basic_destroy(&pool->lock);
+	free(pool->threads);
+	free(pool);
+}
+
+struct val_crypto_batch*
+val_crypto_batch_create(struct module_qstate* qstate, int id)
+{
+	struct val_crypto_batch* b = (struct val_crypto_batch*)calloc(1,
+		sizeof(*b));
+	if(!b)
+		return NULL;
+	b->async.cb = &val_cryptopool_batch_done;
+	b->qstate = qstate;
+	b->mesh = qstate->env->mesh;
+	b->id = id;
+	return b;
+}
+
+void
+val_crypto_batch_delete(struct val_crypto_batch* batch)
+{
+	struct val_crypto_job* j, *n;
+	for(j = batch->jobs; j; j = n) {
+		n = j->next;
+		free(j);
+	}
+	free(batch);
+}
+
+int
+val_crypto_batch_add(struct val_crypto_batch* batch,
+	struct sigcache_key* sck, sldns_buffer* buf, int algo,
+	unsigned char* sig, unsigned int siglen, unsigned char* key,
+	unsigned int keylen, time_t ttl_secure, time_t ttl_bogus)
+{
+	size_t datalen = sldns_buffer_limit(buf);
+	struct val_crypto_job* j = (struct val_crypto_job*)malloc(
+		sizeof(*j) + datalen + siglen + keylen);
+	if(!j)
+		return 0;
+	j->batch = batch;
+	memmove(&j->sck, sck, sizeof(*sck));
+	j->algo = algo;
+	j->data = (uint8_t*)(j+1);
+	j->datalen = datalen;
+	memmove(j->data, sldns_buffer_begin(buf), datalen);
+	j->sig = (unsigned char*)j->data + datalen;
+	j->siglen = siglen;
+	memmove(j->sig, sig, siglen);
+	j->key = j->sig + siglen;
+	j->keylen = keylen;
+	memmove(j->key, key, keylen);
+	j->ttl_secure = ttl_secure;
+	j->ttl_bogus = ttl_bogus;
+	j->next = NULL;
+	if(batch->jobs_last)
+		batch->jobs_last->next = j;
+	else	batch->jobs = j;
+	batch->jobs_last = j;
+	batch->num_jobs++;
+	return 1;
+}
+
+int
+val_cryptopool_submit(struct val_cryptopool* pool,
+	struct val_crypto_batch* batch)
+{
+	struct val_crypto_job* j, *n;
+	int t;
+	if(batch->num_jobs == 0 || !mesh_async_setup(batch->mesh)) {
+		val_crypto_batch_delete(batch);
+		return 0;
+	}
+	lock_basic_lock(&pool->lock);
+	batch->outstanding = batch->num_jobs;
+	lock_basic_unlock(&pool->lock);
+	batch->mesh->async_waiting++;
+	verbose(VERB_ALGO, "validator: %d signatures to crypto threads",
+		(int)batch->num_jobs);
+	j = batch->jobs;
+	batch->jobs = NULL;
+	batch->jobs_last = NULL;
+	for(; j; j = n) {
+		int r;
+		n = j->next;
+		lock_basic_lock(&pool->lock);
+		t = pool->next;
+		pool->next = (pool->next+1)%pool->num;
+		lock_basic_unlock(&pool->lock);
+		/* the other workers write to the same tube */
+		lock_basic_lock(&pool->threads[t].write_lock);
+		r = tube_write_msg(pool->threads[t].tube, (uint8_t*)&j,
+			sizeof(j), 1);
+		lock_basic_unlock(&pool->threads[t].write_lock);
+		if(r != 1) {
+			/* the thread is busy, the validator does it inline */
+			free(j);
+			cryptopool_job_done(pool, batch);
+		}
+	}
+	return 1;
+}
+
+void
+val_cryptopool_cancel(struct val_cryptopool* pool,
+	struct val_crypto_batch* batch)
+{
+	lock_basic_lock(&pool->lock);
+	if(batch->posted) {
+		/* the mesh runs the item, and frees it */
+		batch->qstate = NULL;
+	} else {
+		/* the last job frees it */
+		batch->cancelled = 1;
+		if(batch->mesh->async_waiting > 0)
+			batch->mesh->async_waiting--;
+	}
+	lock_basic_unlock(&pool->lock);
+}
+
+struct module_qstate*
+val_cryptopool_batch_done(struct mesh_area* mesh, struct mesh_async* item)
+{
+	struct val_crypto_batch* b = (struct val_crypto_batch*)item;
+	struct module_qstate* qstate = b->qstate;
+	if(mesh && qstate) {
+		struct val_qstate* vq = (struct val_qstate*)qstate->minfo[b->id];
+		if(vq)
+			vq->crypto_batch = NULL;
+	} else	qstate = NULL;
+	free(b);
+	return qstate;
+}
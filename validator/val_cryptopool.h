@@ -0,0 +1,222 @@
+/*
+ * validator/val_cryptopool.h - threads that verify signatures for the validator
+ *
+ * Copyright (c) 2026, NLnet Labs. All rights reserved.
+ *
+ * This software is open source.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 
+ * Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ * 
+ * Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ * 
+ * Neither the name of the NLNET LABS nor the names of its contributors may
+ * be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ * TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+/**
+ * \file
+ *
+ * This file contains a pool of threads that perform the public key
+ * operations of signature verification, so that the worker thread can
+ * answer from the cache meanwhile.  The query collects the checks it needs
+ * in a batch, and continues when the batch is done, and the results are
+ * in the signature cache.
+ */
+
+#ifndef VALIDATOR_VAL_CRYPTOPOOL_H
+#define VALIDATOR_VAL_CRYPTOPOOL_H
+#include "util/locks.h"
+#include "services/mesh.h"
+#include "validator/val_sigcache.h"
+struct slabhash;
+struct module_qstate;
+struct tube;
+
+/**
+ * A signature check for a crypto thread.  Allocated with the data after
+ * it, and freed by the crypto thread.
+ */
+struct val_crypto_job {
+	/** the batch this job is part of */
+	struct val_crypto_batch* batch;
+	/** signature cache key, the result is stored under it */
+	struct sigcache_key sck;
+	/** DNSKEY algorithm */
+	int algo;
+	/** signed data, the RRSIG fields and canonical rrset */
+	uint8_t* data;
+	/** length of data */
+	size_t datalen;
+	/** the signature */
+	unsigned char* sig;
+	/** length of sig */
+	unsigned int siglen;
+	/** the public key */
+	unsigned char* key;
+	/** length of key */
+	unsigned int keylen;
+	/** absolute expiry time for a secure result */
+	time_t ttl_secure;
+	/** absolute expiry time for a bogus result */
+	time_t ttl_bogus;
+	/** next job in the batch, before it is submitted */
+	struct val_crypto_job* next;
+};
+
+/**
+ * The signature checks of a query, that it waits for.
+ */
+struct val_crypto_batch {
+	/** posted to the mesh when done, must be first */
+	struct mesh_async async;
+	/** the query to continue, NULL if it was deleted after the post */
+	struct module_qstate* qstate;
+	/** the mesh of the query */
+	struct mesh_area* mesh;
+	/** module id of the validator */
+	int id;
+	/** jobs that are collected, not yet submitted, in the order they
+	 * were collected */
+	struct val_crypto_job* jobs;
+	/** last collected job, to append to */
+	struct val_crypto_job* jobs_last;
+	/** number of collected jobs */
+	size_t num_jobs;
+	/** number of jobs not yet done, under the pool lock */
+	size_t outstanding;
+	/** if the query was deleted before the post, the last job frees the
+	 * batch, under the pool lock */
+	int cancelled;
+	/** if the batch is posted to the mesh, under the pool lock */
+	int posted;
+};
+
+/**
+ * A crypto thread.
+ */
+struct val_crypto_thread {
+	/** the pool it is part of */
+	struct val_cryptopool* pool;
+	/** the thread id */
+	ub_thread_type thr;
+	/** tube with job pointers for the thread, NULL stops it */
+	struct tube* tube;
+	/** lock on the writes to the tube, the worker threads write to it
+	 * and a message is written in more than one write call */
+	lock_basic_type write_lock;
+};
+
+/**
+ * The pool of crypto threads.
+ */
+struct val_cryptopool {
+	/** lock on the batches in flight */
+	lock_basic_type lock;
+	/** number of threads */
+	int num;
+	/** the threads */
+	struct val_crypto_thread* threads;
+	/** the thread that gets the next job, round robin */
+	int next;
+	/** cache of parsed public keys, shared with the validator */
+	struct slabhash* pkey_cache;
+	/** cache of signature results, where the results go */
+	struct val_sigcache* sigcache;
+};
+
+/**
+ * Create the crypto threads.
+ * @param num: number of threads.
+ * @param pkey_cache: the parsed public key cache.
+ * @param sigcache: the signature cache, for the results.
+ * @return new pool or NULL on failure (logged).
+ */
+struct val_cryptopool* val_cryptopool_create(int num,
+	struct slabhash* pkey_cache, struct val_sigcache* sigcache);
+
+/**
+ * Stop the crypto threads and delete the pool.  The queries that use
+ * it must have been cancelled.
+ * @param pool: to delete.
+ */
+void val_cryptopool_delete(struct val_cryptopool* pool);
+
+/**
+ * Create a batch for a query.
+ * @param qstate: the query state.
+ * @param id: module id of the validator.
+ * @return new batch or NULL on malloc failure.
+ */
+struct val_crypto_batch* val_crypto_batch_create(
+	struct module_qstate* qstate, int id);
+
+/**
+ * Delete a batch that is not submitted, and its jobs.
+ * @param batch: the batch.
+ */
+void val_crypto_batch_delete(struct val_crypto_batch* batch);
+
+/**
+ * Add a signature check to the batch, after the checks that are in it.
+ * @param batch: the batch.
+ * @param sck: signature cache key for the check, copied.
+ * @param buf: the signed data.
+ * @param algo: DNSKEY algorithm.
+ * @param sig: the signature.
+ * @param siglen: length of sig.
+ * @param key: the public key.
+ * @param keylen: length of key.
+ * @param ttl_secure: absolute time when a secure result expires.
+ * @param ttl_bogus: absolute time when a bogus result expires.
+ * @return false on malloc failure.
+ */
+int val_crypto_batch_add(struct val_crypto_batch* batch,
+	struct sigcache_key* sck, struct sldns_buffer* buf, int algo,
+	unsigned char* sig, unsigned int siglen, unsigned char* key,
+	unsigned int keylen, time_t ttl_secure, time_t ttl_bogus);
+
+/**
+ * Submit the jobs of the batch to the crypto threads, in the order they
+ * were added.  When the jobs are done the batch is posted to the mesh
+ * and the query continues.  If there are no jobs, the batch is freed.
+ * @param pool: the crypto threads.
+ * @param batch: the batch.
+ * @return true if the query has to wait for the batch.
+ */
+int val_cryptopool_submit(struct val_cryptopool* pool,
+	struct val_crypto_batch* batch);
+
+/**
+ * Cancel the batch of a query that is deleted.
+ * @param pool: the crypto threads.
+ * @param batch: the submitted batch.
+ */
+void val_cryptopool_cancel(struct val_cryptopool* pool,
+	struct val_crypto_batch* batch);
+
+/** mesh async callback, when the jobs of a batch are done */
+struct module_qstate* val_cryptopool_batch_done(struct mesh_area* mesh,
+	struct mesh_async* item);
+
+#endif /* VALIDATOR_VAL_CRYPTOPOOL_H */
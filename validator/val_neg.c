@@ -59,6 +59,7 @@
 #include "util/config_file.h"
 #include "services/cache/rrset.h"
 #include "services/cache/dns.h"
+#include "services/mesh.h"
 #include "sldns/rrdef.h"
 #include "sldns/sbuffer.h"
 
@@ -95,17 +96,18 @@ struct val_neg_cache* val_neg_create(struct config_file* cfg, size_t maxiter)
 	neg->max = 1024*1024; /* 1 M is thousands of entries */
 	if(cfg) neg->max = cfg->neg_cache_size;
 	rbtree_init(&neg->tree, &val_neg_zone_compare);
-	lock_basic_init(&neg->lock);
-	lock_protect(&neg->lock, neg, sizeof(*neg));
+	lock_rw_init(&neg->lock);
+	lock_basic_init(&neg->lru_lock);
+	lock_protect(&neg->lock, &neg->tree, sizeof(neg->tree));
 	return neg;
 }
 
 size_t val_neg_get_mem(struct val_neg_cache* neg)
 {
 	size_t result;
-	lock_basic_lock(&neg->lock);
+	lock_rw_rdlock(&neg->lock);
 	result = sizeof(*neg) + neg->use;
-	lock_basic_unlock(&neg->lock);
+	lock_rw_unlock(&neg->lock);
 	return result;
 }
 
@@ -133,7 +135,8 @@ neg_clear_zones(rbnode_type* n, void* ATTR_UNUSED(arg))
 void neg_cache_delete(struct val_neg_cache* neg)
 {
 	if(!neg) return;
-	lock_basic_destroy(&neg->lock);
+	lock_rw_destroy(&neg->lock);
+	lock_basic_destroy(&neg->lru_lock);
 	/* delete all the zones in the tree */
 	traverse_postorder(&neg->tree, &neg_clear_zones, NULL);
 	free(neg);
@@ -187,6 +190,20 @@ static void neg_lru_touch(struct val_neg_cache* neg,
 	neg_lru_front(neg, data);
 }
 
+/**
+ * Touch LRU for data element that a lookup used.  The lookups hold the
+ * big lock for reading, and the LRU list is changed under the lru lock.
+ * @param neg: negative cache with LRU start and end.
+ * @param data: this data is used.
+ */
+static void neg_lru_touch_read(struct val_neg_cache* neg, 
+	struct val_neg_data* data)
+{
+	lock_basic_lock(&neg->lru_lock);
+	neg_lru_touch(neg, data);
+	lock_basic_unlock(&neg->lru_lock);
+}
+
 /**
  * Delete a zone element from the negative cache.
  * May delete other zone elements to keep tree coherent, or
@@ -327,7 +344,8 @@ static size_t calc_data_need(struct reply_info* rep)
 	size_t i, len, res = 0;
 
 	for(i=rep->an_numrrsets; i<rep->an_numrrsets+rep->ns_numrrsets; i++) {
-		if(ntohs(rep->rrsets[i]->rk.type) == LDNS_RR_TYPE_NSEC) {
+		if(ntohs(rep->rrsets[i]->rk.type) == LDNS_RR_TYPE_NSEC ||
+			ntohs(rep->rrsets[i]->rk.type) == LDNS_RR_TYPE_NSEC3) {
 			d = rep->rrsets[i]->rk.dname;
 			len = rep->rrsets[i]->rk.dname_len;
 			res = sizeof(struct val_neg_data) + len;
@@ -573,7 +591,7 @@ static struct ub_packed_rrset_key* reply_find_soa(struct reply_info* rep)
 	return NULL;
 }
 
-/** see if the reply has NSEC records worthy of caching */
+/** see if the reply has NSEC or NSEC3 records worthy of caching */
 static int reply_has_nsec(struct reply_info* rep)
 {
 	size_t i;
@@ -581,7 +599,8 @@ static int reply_has_nsec(struct reply_info* rep)
 	if(rep->security != sec_status_secure)
 		return 0;
 	for(i=rep->an_numrrsets; i< rep->an_numrrsets+rep->ns_numrrsets; i++){
-		if(ntohs(rep->rrsets[i]->rk.type) == LDNS_RR_TYPE_NSEC) {
+		if(ntohs(rep->rrsets[i]->rk.type) == LDNS_RR_TYPE_NSEC ||
+			ntohs(rep->rrsets[i]->rk.type) == LDNS_RR_TYPE_NSEC3) {
 			d = (struct packed_rrset_data*)rep->rrsets[i]->
 				entry.data;
 			if(d->security == sec_status_secure)
@@ -905,7 +924,7 @@ void val_neg_addreply(struct val_neg_cache* neg, struct reply_info* rep)
 	/* ask for enough space to store all of it */
 	need = calc_data_need(rep) + 
 		calc_zone_need(dname, dname_len);
-	lock_basic_lock(&neg->lock);
+	lock_rw_wrlock(&neg->lock);
 	neg_make_space(neg, need);
 
 	/* find or create the zone entry */
@@ -913,16 +932,17 @@ void val_neg_addreply(struct val_neg_cache* neg, struct reply_info* rep)
 	if(!zone) {
 		if(!(zone = neg_create_zone(neg, dname, dname_len,
 			rrset_class))) {
-			lock_basic_unlock(&neg->lock);
+			lock_rw_unlock(&neg->lock);
 			log_err("out of memory adding negative zone");
 			return;
 		}
 	}
 	val_neg_zone_take_inuse(zone);
 
-	/* insert the NSECs */
+	/* insert the NSECs and NSEC3s */
 	for(i=rep->an_numrrsets; i< rep->an_numrrsets+rep->ns_numrrsets; i++){
-		if(ntohs(rep->rrsets[i]->rk.type) != LDNS_RR_TYPE_NSEC)
+		if(ntohs(rep->rrsets[i]->rk.type) != LDNS_RR_TYPE_NSEC &&
+			ntohs(rep->rrsets[i]->rk.type) != LDNS_RR_TYPE_NSEC3)
 			continue;
 		if(!dname_subdomain_c(rep->rrsets[i]->rk.dname, 
 			zone->name)) continue;
@@ -933,7 +953,7 @@ void val_neg_addreply(struct val_neg_cache* neg, struct reply_info* rep)
 		/* remove empty zone if inserts failed */
 		neg_delete_zone(neg, zone);
 	}
-	lock_basic_unlock(&neg->lock);
+	lock_rw_unlock(&neg->lock);
 }
 
 /**
@@ -983,12 +1003,12 @@ int val_neg_dlvlookup(struct val_neg_cache* neg, uint8_t* qname, size_t len,
 		LDNS_RR_TYPE_DLV, qclass);
 	
 	labs = dname_count_labels(qname);
-	lock_basic_lock(&neg->lock);
+	lock_rw_wrlock(&neg->lock);
 	zone = neg_closest_zone_parent(neg, qname, len, labs, qclass);
 	while(zone && !zone->in_use)
 		zone = zone->parent;
 	if(!zone) {
-		lock_basic_unlock(&neg->lock);
+		lock_rw_unlock(&neg->lock);
 		return 0;
 	}
 	log_nametypeclass(VERB_ALGO, "negcache zone", zone->name, 0, 
@@ -996,7 +1016,7 @@ int val_neg_dlvlookup(struct val_neg_cache* neg, uint8_t* qname, size_t len,
 
 	/* DLV is defined to use NSEC only */
 	if(zone->nsec3_hash) {
-		lock_basic_unlock(&neg->lock);
+		lock_rw_unlock(&neg->lock);
 		return 0;
 	}
 
@@ -1005,7 +1025,7 @@ int val_neg_dlvlookup(struct val_neg_cache* neg, uint8_t* qname, size_t len,
 	while(data && !data->in_use)
 		data = data->parent;
 	if(!data) {
-		lock_basic_unlock(&neg->lock);
+		lock_rw_unlock(&neg->lock);
 		return 0;
 	}
 	log_nametypeclass(VERB_ALGO, "negcache rr", data->name, 
@@ -1020,7 +1040,7 @@ int val_neg_dlvlookup(struct val_neg_cache* neg, uint8_t* qname, size_t len,
 
 	/* check if secure and TTL ok */
 	if(!nsec) {
-		lock_basic_unlock(&neg->lock);
+		lock_rw_unlock(&neg->lock);
 		return 0;
 	}
 	d = (struct packed_rrset_data*)nsec->entry.data;
@@ -1028,13 +1048,13 @@ int val_neg_dlvlookup(struct val_neg_cache* neg, uint8_t* qname, size_t len,
 		lock_rw_unlock(&nsec->entry.lock);
 		/* delete data record if expired */
 		neg_delete_data(neg, data);
-		lock_basic_unlock(&neg->lock);
+		lock_rw_unlock(&neg->lock);
 		return 0;
 	}
 	if(d->security != sec_status_secure) {
 		lock_rw_unlock(&nsec->entry.lock);
 		neg_delete_data(neg, data);
-		lock_basic_unlock(&neg->lock);
+		lock_rw_unlock(&neg->lock);
 		return 0;
 	}
 	verbose(VERB_ALGO, "negcache got secure rrset");
@@ -1050,7 +1070,7 @@ int val_neg_dlvlookup(struct val_neg_cache* neg, uint8_t* qname, size_t len,
 		!val_nsec_proves_name_error(nsec, qname)) {
 		/* the NSEC is not a denial for the DLV */
 		lock_rw_unlock(&nsec->entry.lock);
-		lock_basic_unlock(&neg->lock);
+		lock_rw_unlock(&neg->lock);
 		verbose(VERB_ALGO, "negcache not proven");
 		return 0;
 	}
@@ -1062,7 +1082,7 @@ int val_neg_dlvlookup(struct val_neg_cache* neg, uint8_t* qname, size_t len,
 	lock_rw_unlock(&nsec->entry.lock);
 	/* if OK touch the LRU for neg_data element */
 	neg_lru_touch(neg, data);
-	lock_basic_unlock(&neg->lock);
+	lock_rw_unlock(&neg->lock);
 	verbose(VERB_ALGO, "negcache DLV denial proven");
 	return 1;
 }
@@ -1090,7 +1110,7 @@ void val_neg_addreferral(struct val_neg_cache* neg, struct reply_info* rep,
 	
 	/* ask for enough space to store all of it */
 	need = calc_data_need(rep) + calc_zone_need(signer, signer_len);
-	lock_basic_lock(&neg->lock);
+	lock_rw_wrlock(&neg->lock);
 	neg_make_space(neg, need);
 
 	/* find or create the zone entry */
@@ -1098,7 +1118,7 @@ void val_neg_addreferral(struct val_neg_cache* neg, struct reply_info* rep,
 	if(!zone) {
 		if(!(zone = neg_create_zone(neg, signer, signer_len, 
 			dclass))) {
-			lock_basic_unlock(&neg->lock);
+			lock_rw_unlock(&neg->lock);
 			log_err("out of memory adding negative zone");
 			return;
 		}
@@ -1119,7 +1139,7 @@ void val_neg_addreferral(struct val_neg_cache* neg, struct reply_info* rep,
 		/* remove empty zone if inserts failed */
 		neg_delete_zone(neg, zone);
 	}
-	lock_basic_unlock(&neg->lock);
+	lock_rw_unlock(&neg->lock);
 }
 
 /**
@@ -1218,26 +1238,26 @@ neg_find_nsec(struct val_neg_cache* neg_cache, uint8_t* qname, size_t qname_len,
 	struct ub_packed_rrset_key* nsec;
 
 	labs = dname_count_labels(qname);
-	lock_basic_lock(&neg_cache->lock);
+	lock_rw_rdlock(&neg_cache->lock);
 	zone = neg_closest_zone_parent(neg_cache, qname, qname_len, labs,
 		qclass);
 	while(zone && !zone->in_use)
 		zone = zone->parent;
 	if(!zone) {
-		lock_basic_unlock(&neg_cache->lock);
+		lock_rw_unlock(&neg_cache->lock);
 		return NULL;
 	}
 
 	/* NSEC only for now */
 	if(zone->nsec3_hash) {
-		lock_basic_unlock(&neg_cache->lock);
+		lock_rw_unlock(&neg_cache->lock);
 		return NULL;
 	}
 
 	/* ignore return value, don't care if it is an exact or smaller match */
 	(void)neg_closest_data(zone, qname, qname_len, labs, &data);
 	if(!data) {
-		lock_basic_unlock(&neg_cache->lock);
+		lock_rw_unlock(&neg_cache->lock);
 		return NULL;
 	}
 
@@ -1246,7 +1266,7 @@ neg_find_nsec(struct val_neg_cache* neg_cache, uint8_t* qname, size_t qname_len,
 	if(!data->in_use) {
 		data = (struct val_neg_data*)rbtree_previous((rbnode_type*)data);
 		if((rbnode_type*)data == RBTREE_NULL || !data->in_use) {
-			lock_basic_unlock(&neg_cache->lock);
+			lock_rw_unlock(&neg_cache->lock);
 			return NULL;
 		}
 	}
@@ -1257,14 +1277,18 @@ neg_find_nsec(struct val_neg_cache* neg_cache, uint8_t* qname, size_t qname_len,
 
 	nsec = grab_nsec(rrset_cache, data->name, data->len, LDNS_RR_TYPE_NSEC,
 		zone->dclass, flags, region, 0, 0, now);
-	lock_basic_unlock(&neg_cache->lock);
+	if(nsec)
+		neg_lru_touch_read(neg_cache, data);
+	lock_rw_unlock(&neg_cache->lock);
 	return nsec;
 }
 
-/** find nsec3 closest encloser in neg cache */
+/** find nsec3 closest encloser in neg cache, the closest encloser name
+ * is returned in ce and ce_len, if not NULL */
 static struct val_neg_data*
 neg_find_nsec3_ce(struct val_neg_zone* zone, uint8_t* qname, size_t qname_len,
-		int qlabs, sldns_buffer* buf, uint8_t* hashnc, size_t* nclen)
+		int qlabs, sldns_buffer* buf, uint8_t* hashnc, size_t* nclen,
+		uint8_t** ce, size_t* ce_len)
 {
 	struct val_neg_data* data;
 	uint8_t hashce[NSEC3_SHA_LEN];
@@ -1286,6 +1310,10 @@ neg_find_nsec3_ce(struct val_neg_zone* zone, uint8_t* qname, size_t qname_len,
 		data = neg_find_data(zone, b32, b32len, zone->labs+1);
 		if(data && data->in_use) {
 			/* found ce match! */
+			if(ce) {
+				*ce = qname;
+				*ce_len = qname_len;
+			}
 			return data;
 		}
 
@@ -1370,7 +1398,7 @@ neg_nsec3_proof_ds(struct val_neg_zone* zone, uint8_t* qname, size_t qname_len,
 		return NULL; /* not nsec3 zone */
 
 	if(!(data=neg_find_nsec3_ce(zone, qname, qname_len, qlabs, buf,
-		hashnc, &nclen))) {
+		hashnc, &nclen, NULL, NULL))) {
 		return NULL;
 	}
 
@@ -1475,11 +1503,143 @@ static int add_soa(struct rrset_cache* rrset_cache, time_t now,
 	return 1;
 }
 
+/** get the nsec3 that covers the hash, or NULL if there is none */
+static struct ub_packed_rrset_key*
+neg_nsec3_getcover(struct val_neg_zone* zone, uint8_t* hash, size_t hashlen,
+	struct rrset_cache* rrset_cache, struct regional* region,
+	time_t now, sldns_buffer* buf)
+{
+	struct ub_packed_rrset_key* rrset;
+	struct nsec3_cached_hash c;
+	uint8_t b32[257];
+	rrset = neg_nsec3_getnc(zone, hash, hashlen, rrset_cache, region,
+		now, b32, sizeof(b32));
+	if(!rrset)
+		return NULL;
+	c.hash = hash;
+	c.hash_len = hashlen;
+	c.b32 = b32+1;
+	c.b32_len = (size_t)b32[0];
+	if(!nsec3_covers(zone->name, &c, rrset, 0, buf))
+		return NULL;
+	return rrset;
+}
+
+/**
+ * Synthesize a NODATA or NXDOMAIN answer from the NSEC3 records in the
+ * negative cache, RFC 8198.  The closest encloser of qname is looked up
+ * by hash, for NODATA it matches qname, otherwise the next closer name
+ * and the wildcard at the closest encloser must be covered.  Opt-out
+ * NSEC3 records do not prove that a name does not exist, and are not
+ * used.  The neg cache lock is held for reading by the caller.
+ * @param neg: negative cache, for statistics.
+ * @param zone: the NSEC3 zone of qname.
+ * @param qinfo: query name, type and class.
+ * @param region: where to allocate the reply.
+ * @param rrset_cache: to fetch the NSEC3 rrsets from.
+ * @param buf: temporary buffer.
+ * @param now: to check ttl against.
+ * @param mesh: per thread stats, or NULL.
+ * @return the message or NULL.
+ */
+static struct dns_msg*
+neg_nsec3_getmsg(struct val_neg_cache* neg, struct val_neg_zone* zone,
+	struct query_info* qinfo, struct regional* region,
+	struct rrset_cache* rrset_cache, sldns_buffer* buf, time_t now,
+	struct mesh_area* mesh)
+{
+	struct dns_msg* msg;
+	struct val_neg_data* data;
+	struct ub_packed_rrset_key* ce_rrset, *nc_rrset, *wc_rrset;
+	uint8_t hashnc[NSEC3_SHA_LEN], hashwc[NSEC3_SHA_LEN];
+	uint8_t wc[LDNS_MAX_DOMAINLEN+3];
+	uint8_t* ce;
+	size_t nclen, wclen, ce_len;
+	int qlabs = dname_count_labels(qinfo->qname);
+
+	if(!zone->nsec3_hash || qinfo->qtype == LDNS_RR_TYPE_ANY)
+		return NULL;
+	if(!(data=neg_find_nsec3_ce(zone, qinfo->qname, qinfo->qname_len,
+		qlabs - zone->labs + 1, buf, hashnc, &nclen, &ce, &ce_len)))
+		return NULL;
+	ce_rrset = grab_nsec(rrset_cache, data->name, data->len,
+		LDNS_RR_TYPE_NSEC3, zone->dclass, 0, region, 0, 0, now);
+	if(!ce_rrset || !neg_params_ok(zone, ce_rrset))
+		return NULL;
+	/* a delegation is answered with a referral, not from the parent
+	 * zone NSEC3 */
+	if(nsec3_has_type(ce_rrset, 0, LDNS_RR_TYPE_NS) &&
+		!nsec3_has_type(ce_rrset, 0, LDNS_RR_TYPE_SOA))
+		return NULL;
+
+	if(nclen == 0) {
+		/* qname exists, NODATA if the type and CNAME are absent */
+		if(!nsec3_no_type(ce_rrset, qinfo->qtype) ||
+			!nsec3_no_type(ce_rrset, LDNS_RR_TYPE_CNAME))
+			return NULL;
+		if(!(msg = dns_msg_create(qinfo->qname, qinfo->qname_len,
+			qinfo->qtype, qinfo->qclass, region, 2)))
+			return NULL;
+		/* now=0 because TTL was reduced in grab_nsec */
+		if(!dns_msg_authadd(msg, region, ce_rrset, 0))
+			return NULL;
+		neg_lru_touch_read(neg, data);
+		if(mesh) {
+			mesh->stats_neg_noerror++;
+			mesh->stats_neg_nsec3++;
+		}
+		return msg;
+	}
+
+	/* qname does not exist, below a closest encloser that is not a
+	 * DNAME, the next closer name is covered, without opt-out */
+	if(nsec3_has_type(ce_rrset, 0, LDNS_RR_TYPE_DNAME))
+		return NULL;
+	nc_rrset = neg_nsec3_getcover(zone, hashnc, nclen, rrset_cache,
+		region, now, buf);
+	if(!nc_rrset || nsec3_has_optout(nc_rrset, 0))
+		return NULL;
+	/* and there is no wildcard at the closest encloser */
+	wc[0] = 1;
+	wc[1] = (uint8_t)'*';
+	memmove(wc+2, ce, ce_len);
+	if(!(wclen=nsec3_get_hashed(buf, wc, ce_len+2, zone->nsec3_hash,
+		zone->nsec3_iter, zone->nsec3_salt, zone->nsec3_saltlen,
+		hashwc, sizeof(hashwc))))
+		return NULL;
+	wc_rrset = neg_nsec3_getcover(zone, hashwc, wclen, rrset_cache,
+		region, now, buf);
+	if(!wc_rrset)
+		return NULL;
+
+	/* capacity=4: ce + nc + wc + soa(if needed) */
+	if(!(msg = dns_msg_create(qinfo->qname, qinfo->qname_len,
+		qinfo->qtype, qinfo->qclass, region, 4)))
+		return NULL;
+	if(!dns_msg_authadd(msg, region, ce_rrset, 0))
+		return NULL;
+	if(query_dname_compare(nc_rrset->rk.dname, ce_rrset->rk.dname) != 0
+		&& !dns_msg_authadd(msg, region, nc_rrset, 0))
+		return NULL;
+	if(query_dname_compare(wc_rrset->rk.dname, ce_rrset->rk.dname) != 0
+		&& query_dname_compare(wc_rrset->rk.dname,
+		nc_rrset->rk.dname) != 0
+		&& !dns_msg_authadd(msg, region, wc_rrset, 0))
+		return NULL;
+	FLAGS_SET_RCODE(msg->rep->flags, LDNS_RCODE_NXDOMAIN);
+	neg_lru_touch_read(neg, data);
+	if(mesh) {
+		mesh->stats_neg_nxdomain++;
+		mesh->stats_neg_nsec3++;
+	}
+	return msg;
+}
+
 struct dns_msg* 
 val_neg_getmsg(struct val_neg_cache* neg, struct query_info* qinfo, 
 	struct regional* region, struct rrset_cache* rrset_cache, 
 	sldns_buffer* buf, time_t now, int addsoa, uint8_t* topname,
-	struct config_file* cfg)
+	struct config_file* cfg, struct mesh_area* mesh)
 {
 	struct dns_msg* msg;
 	struct ub_packed_rrset_key* nsec; /* qname matching/covering nsec */
@@ -1517,9 +1677,8 @@ val_neg_getmsg(struct val_neg_cache* neg, struct query_info* qinfo,
 		if(addsoa && !add_soa(rrset_cache, now, region, msg, NULL))
 			return NULL;
 
-		lock_basic_lock(&neg->lock);
-		neg->num_neg_cache_noerror++;
-		lock_basic_unlock(&neg->lock);
+		if(mesh)
+			mesh->stats_neg_noerror++;
 		return msg;
 	} else if(nsec && val_nsec_proves_name_error(nsec, qinfo->qname)) {
 		if(!(msg = dns_msg_create(qinfo->qname, qinfo->qname_len, 
@@ -1601,20 +1760,38 @@ val_neg_getmsg(struct val_neg_cache* neg, struct query_info* qinfo,
 			return NULL;
 
 		/* Increment statistic counters */
-		lock_basic_lock(&neg->lock);
-		if(rcode == LDNS_RCODE_NOERROR)
-			neg->num_neg_cache_noerror++;
-		else if(rcode == LDNS_RCODE_NXDOMAIN)
-			neg->num_neg_cache_nxdomain++;
-		lock_basic_unlock(&neg->lock);
+		if(mesh && rcode == LDNS_RCODE_NOERROR)
+			mesh->stats_neg_noerror++;
+		else if(mesh && rcode == LDNS_RCODE_NXDOMAIN)
+			mesh->stats_neg_nxdomain++;
 
 		FLAGS_SET_RCODE(msg->rep->flags, rcode);
 		return msg;
 	}
 
-	/* No aggressive use of NSEC3 for now, only proceed for DS types. */
-	if(qinfo->qtype != LDNS_RR_TYPE_DS){
-		return NULL;
+	/* Aggressive use of NSEC3, for other types than DS */
+	if(qinfo->qtype != LDNS_RR_TYPE_DS) {
+		int qlabs = dname_count_labels(qinfo->qname);
+		lock_rw_rdlock(&neg->lock);
+		zone = neg_closest_zone_parent(neg, qinfo->qname,
+			qinfo->qname_len, qlabs, qinfo->qclass);
+		while(zone && !zone->in_use)
+			zone = zone->parent;
+		if(zone && topname && !dname_subdomain_c(zone->name, topname))
+			zone = NULL;
+		if(!zone) {
+			lock_rw_unlock(&neg->lock);
+			return NULL;
+		}
+		msg = neg_nsec3_getmsg(neg, zone, qinfo, region, rrset_cache,
+			buf, now, mesh);
+		if(msg && addsoa && !add_soa(rrset_cache, now, region, msg,
+			zone)) {
+			lock_rw_unlock(&neg->lock);
+			return NULL;
+		}
+		lock_rw_unlock(&neg->lock);
+		return msg;
 	}
 	/* check NSEC3 neg cache for type DS */
 	/* need to look one zone higher for DS type */
@@ -1624,7 +1801,7 @@ val_neg_getmsg(struct val_neg_cache* neg, struct query_info* qinfo,
 	zname_labs = dname_count_labels(zname);
 
 	/* lookup closest zone */
-	lock_basic_lock(&neg->lock);
+	lock_rw_rdlock(&neg->lock);
 	zone = neg_closest_zone_parent(neg, zname, zname_len, zname_labs, 
 		qinfo->qclass);
 	while(zone && !zone->in_use)
@@ -1636,16 +1813,16 @@ val_neg_getmsg(struct val_neg_cache* neg, struct query_info* qinfo,
 			zone = NULL;
 	}
 	if(!zone) {
-		lock_basic_unlock(&neg->lock);
+		lock_rw_unlock(&neg->lock);
 		return NULL;
 	}
 
 	msg = neg_nsec3_proof_ds(zone, qinfo->qname, qinfo->qname_len, 
 		zname_labs+1, buf, rrset_cache, region, now, topname);
 	if(msg && addsoa && !add_soa(rrset_cache, now, region, msg, zone)) {
-		lock_basic_unlock(&neg->lock);
+		lock_rw_unlock(&neg->lock);
 		return NULL;
 	}
-	lock_basic_unlock(&neg->lock);
+	lock_rw_unlock(&neg->lock);
 	return msg;
 }
@@ -54,6 +54,7 @@ struct rrset_cache;
 struct regional;
 struct query_info;
 struct dns_msg;
+struct mesh_area;
 struct ub_packed_rrset_key;
 
 /**
@@ -66,8 +67,14 @@ struct ub_packed_rrset_key;
  */
 struct val_neg_cache {
 	/** the big lock on the negative cache.  Because we use a rbtree 
-	 * for the data (quick lookup), we need a big lock */
-	lock_basic_type lock;
+	 * for the data (quick lookup), we need a big lock.  Lookups hold
+	 * it for reading, and run at the same time, changes to the trees
+	 * hold it for writing. */
+	lock_rw_type lock;
+	/** lock on the LRU list, for lookups that hold
+	 * the big lock for reading.  With the big lock held for writing
+	 * the LRU list can be changed without it. */
+	lock_basic_type lru_lock;
 	/** The zone rbtree. contents sorted canonical, type val_neg_zone */
 	rbtree_type tree;
 	/** the first in linked list of LRU of val_neg_data */
@@ -80,12 +87,6 @@ struct val_neg_cache {
 	size_t max;
 	/** max nsec3 iterations allowed */
 	size_t nsec3_max_iter;
-	/** number of times neg cache records were used to generate NOERROR
-	 * responses. */
-	size_t num_neg_cache_noerror;
-	/** number of times neg cache records were used to generate NXDOMAIN
-	 * responses. */
-	size_t num_neg_cache_nxdomain;
 };
 
 /**
@@ -257,6 +258,8 @@ int val_neg_dlvlookup(struct val_neg_cache* neg, uint8_t* qname, size_t len,
  * 	may have a trust-anchor below the optout and thus the optout cannot
  * 	be used to create a proof from the negative cache.
  * @param cfg: config options.
+ * @param mesh: the answers made are counted in its per thread stats,
+ *	or NULL.
  * @return a reply message if something was found. 
  * 	This reply may still need validation.
  * 	NULL if nothing found (or out of memory).
@@ -264,7 +267,8 @@ int val_neg_dlvlookup(struct val_neg_cache* neg, uint8_t* qname, size_t len,
 struct dns_msg* val_neg_getmsg(struct val_neg_cache* neg, 
 	struct query_info* qinfo, struct regional* region, 
 	struct rrset_cache* rrset_cache, struct sldns_buffer* buf, time_t now,
-	int addsoa, uint8_t* topname, struct config_file* cfg);
+	int addsoa, uint8_t* topname, struct config_file* cfg,
+	struct mesh_area* mesh);
 
 
 /**** functions exposed for unit test ****/
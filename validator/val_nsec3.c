@@ -46,6 +46,7 @@
 #include "validator/val_secalgo.h"
 #include "validator/validator.h"
 #include "validator/val_kentry.h"
+#include "validator/val_nsec3cache.h"
 #include "services/cache/rrset.h"
 #include "util/regional.h"
 #include "util/rbtree.h"
@@ -105,6 +106,8 @@ struct nsec3_filter {
 	size_t num;
 	/** class of records for the NSEC3, only this class applies */
 	uint16_t fclass;
+	/** shared cache of hashes, NULL if none */
+	struct val_nsec3cache* hc;
 };
 
 /** return number of rrs in an rrset */
@@ -401,10 +404,11 @@ nsec3_rrset_has_known(struct ub_packed_rrset_key* s)
  *	query name to match a zone for.
  *	query type (if DS a higher zone must be chosen)
  *	qclass, to filter NSEC3s with.
+ * @param ve: validator environment with the hash cache.
  */
 static void
 filter_init(struct nsec3_filter* filter, struct ub_packed_rrset_key** list,
-	size_t num, struct query_info* qinfo)
+	size_t num, struct query_info* qinfo, struct val_env* ve)
 {
 	size_t i;
 	uint8_t* nm;
@@ -414,6 +418,7 @@ filter_init(struct nsec3_filter* filter, struct ub_packed_rrset_key** list,
 	filter->list = list;
 	filter->num = num;
 	filter->fclass = qinfo->qclass;
+	filter->hc = ve->nsec3cache;
 	for(i=0; i<num; i++) {
 		/* ignore other stuff in the list */
 		if(ntohs(list[i]->rk.type) != LDNS_RR_TYPE_NSEC3 ||
@@ -566,15 +571,16 @@ nsec3_get_hashed(sldns_buffer* buf, uint8_t* nm, size_t nmlen, int algo,
 	return hash_len;
 }
 
-/** perform hash of name */
+/** perform hash of name, or get it from the shared cache */
 static int
 nsec3_calc_hash(struct regional* region, sldns_buffer* buf, 
-	struct nsec3_cached_hash* c)
+	struct val_nsec3cache* hc, time_t now, struct nsec3_cached_hash* c)
 {
 	int algo = nsec3_get_algo(c->nsec3, c->rr);
 	size_t iter = nsec3_get_iter(c->nsec3, c->rr);
 	uint8_t* salt;
 	size_t saltlen, i;
+	struct nsec3cache_key k;
 	if(!nsec3_get_salt(c->nsec3, c->rr, &salt, &saltlen))
 		return -1;
 	/* prepare buffer for first iteration */
@@ -591,6 +597,22 @@ nsec3_calc_hash(struct regional* region, sldns_buffer* buf,
 	c->hash = (uint8_t*)regional_alloc(region, c->hash_len);
 	if(!c->hash)
 		return 0;
+	if(hc) {
+		/* the zone is the owner name without the hash label */
+		uint8_t* zone = c->nsec3->rk.dname;
+		size_t zonelen = c->nsec3->rk.dname_len;
+		val_nsec3cache_make_key(&k, algo, iter, salt, saltlen,
+			c->dname, c->dname_len);
+		if(val_nsec3cache_lookup(hc, &k, c->hash, c->hash_len) ==
+			c->hash_len)
+			return 1;
+		dname_remove_label(&zone, &zonelen);
+		if(!val_nsec3cache_rate_inc(hc, zone, zonelen, now)) {
+			verbose(VERB_ALGO, "nsec3: hash rate limit exceeded "
+				"for zone");
+			return -2;
+		}
+	}
 	(void)secalgo_nsec3_hash(algo, (unsigned char*)sldns_buffer_begin(buf),
 		sldns_buffer_limit(buf), (unsigned char*)c->hash);
 	for(i=0; i<iter; i++) {
@@ -602,6 +624,8 @@ nsec3_calc_hash(struct regional* region, sldns_buffer* buf,
 			(unsigned char*)sldns_buffer_begin(buf),
 			sldns_buffer_limit(buf), (unsigned char*)c->hash);
 	}
+	if(hc)
+		val_nsec3cache_insert(hc, &k, c->hash, c->hash_len);
 	return 1;
 }
 
@@ -628,6 +652,7 @@ nsec3_calc_b32(struct regional* region, sldns_buffer* buf,
 
 int
 nsec3_hash_name(rbtree_type* table, struct regional* region, sldns_buffer* buf,
+	struct val_nsec3cache* hc, time_t now,
 	struct ub_packed_rrset_key* nsec3, int rr, uint8_t* dname, 
 	size_t dname_len, struct nsec3_cached_hash** hash)
 {
@@ -656,7 +681,7 @@ nsec3_hash_name(rbtree_type* table, struct regional* region, sldns_buffer* buf,
 	c->rr = rr;
 	c->dname = dname;
 	c->dname_len = dname_len;
-	r = nsec3_calc_hash(region, buf, c);
+	r = nsec3_calc_hash(region, buf, hc, now, c);
 	if(r != 1)
 		return r;
 	r = nsec3_calc_b32(region, buf, c);
@@ -748,7 +773,7 @@ find_matching_nsec3(struct module_env* env, struct nsec3_filter* flt,
 		s=filter_next(flt, &i_rs, &i_rr)) {
 		/* get name hashed for this NSEC3 RR */
 		r = nsec3_hash_name(ct, env->scratch, env->scratch_buffer,
-			s, i_rr, nm, nmlen, &hash);
+			flt->hc, *env->now, s, i_rr, nm, nmlen, &hash);
 		if(r == 0) {
 			log_err("nsec3: malloc failure");
 			break; /* alloc failure */
@@ -841,7 +866,7 @@ find_covering_nsec3(struct module_env* env, struct nsec3_filter* flt,
 		s=filter_next(flt, &i_rs, &i_rr)) {
 		/* get name hashed for this NSEC3 RR */
 		r = nsec3_hash_name(ct, env->scratch, env->scratch_buffer,
-			s, i_rr, nm, nmlen, &hash);
+			flt->hc, *env->now, s, i_rr, nm, nmlen, &hash);
 		if(r == 0) {
 			log_err("nsec3: malloc failure");
 			break; /* alloc failure */
@@ -1072,7 +1097,7 @@ nsec3_prove_nameerror(struct module_env* env, struct val_env* ve,
 	if(!list || num == 0 || !kkey || !key_entry_isgood(kkey))
 		return sec_status_bogus; /* no valid NSEC3s, bogus */
 	rbtree_init(&ct, &nsec3_hash_cmp); /* init names-to-hash cache */
-	filter_init(&flt, list, num, qinfo); /* init RR iterator */
+	filter_init(&flt, list, num, qinfo, ve); /* init RR iterator */
 	if(!flt.zone)
 		return sec_status_bogus; /* no RRs */
 	if(nsec3_iteration_count_high(ve, &flt, kkey))
@@ -1231,7 +1256,7 @@ nsec3_prove_nodata(struct module_env* env, struct val_env* ve,
 	if(!list || num == 0 || !kkey || !key_entry_isgood(kkey))
 		return sec_status_bogus; /* no valid NSEC3s, bogus */
 	rbtree_init(&ct, &nsec3_hash_cmp); /* init names-to-hash cache */
-	filter_init(&flt, list, num, qinfo); /* init RR iterator */
+	filter_init(&flt, list, num, qinfo, ve); /* init RR iterator */
 	if(!flt.zone)
 		return sec_status_bogus; /* no RRs */
 	if(nsec3_iteration_count_high(ve, &flt, kkey))
@@ -1255,7 +1280,7 @@ nsec3_prove_wildcard(struct module_env* env, struct val_env* ve,
 	if(!list || num == 0 || !kkey || !key_entry_isgood(kkey))
 		return sec_status_bogus; /* no valid NSEC3s, bogus */
 	rbtree_init(&ct, &nsec3_hash_cmp); /* init names-to-hash cache */
-	filter_init(&flt, list, num, qinfo); /* init RR iterator */
+	filter_init(&flt, list, num, qinfo, ve); /* init RR iterator */
 	if(!flt.zone)
 		return sec_status_bogus; /* no RRs */
 	if(nsec3_iteration_count_high(ve, &flt, kkey))
@@ -1333,7 +1358,7 @@ nsec3_prove_nods(struct module_env* env, struct val_env* ve,
 	if(!list_is_secure(env, ve, list, num, kkey, reason, qstate))
 		return sec_status_bogus; /* not all NSEC3 records secure */
 	rbtree_init(&ct, &nsec3_hash_cmp); /* init names-to-hash cache */
-	filter_init(&flt, list, num, qinfo); /* init RR iterator */
+	filter_init(&flt, list, num, qinfo, ve); /* init RR iterator */
 	if(!flt.zone) {
 		*reason = "no NSEC3 records";
 		return sec_status_bogus; /* no RRs */
@@ -1415,7 +1440,7 @@ nsec3_prove_nxornodata(struct module_env* env, struct val_env* ve,
 	if(!list || num == 0 || !kkey || !key_entry_isgood(kkey))
 		return sec_status_bogus; /* no valid NSEC3s, bogus */
 	rbtree_init(&ct, &nsec3_hash_cmp); /* init names-to-hash cache */
-	filter_init(&flt, list, num, qinfo); /* init RR iterator */
+	filter_init(&flt, list, num, qinfo, ve); /* init RR iterator */
 	if(!flt.zone)
 		return sec_status_bogus; /* no RRs */
 	if(nsec3_iteration_count_high(ve, &flt, kkey))
@@ -77,6 +77,7 @@ struct reply_info;
 struct query_info;
 struct key_entry_key;
 struct sldns_buffer;
+struct val_nsec3cache;
 
 /**
  *     0 1 2 3 4 5 6 7
@@ -263,6 +264,8 @@ int nsec3_hash_cmp(const void* c1, const void* c2);
  * @param region: scratch region to use for allocation.
  * 	This region holds the tree, if you wipe the region, reinit the tree.
  * @param buf: temporary buffer.
+ * @param hc: shared hash cache, with the rate limit, or NULL.
+ * @param now: current time, for the rate limit.
  * @param nsec3: the rrset with parameters
  * @param rr: rr number from d that has the NSEC3 parameters to hash to.
  * @param dname: name to hash
@@ -273,9 +276,11 @@ int nsec3_hash_cmp(const void* c1, const void* c2);
  * 	1 on success, either from cache or newly hashed hash is returned.
  * 	0 on a malloc failure.
  * 	-1 if the NSEC3 rr was badly formatted (i.e. formerr).
+ * 	-2 if the hash rate limit of the zone is exceeded.
  */
 int nsec3_hash_name(rbtree_type* table, struct regional* region,
-	struct sldns_buffer* buf, struct ub_packed_rrset_key* nsec3, int rr,
+	struct sldns_buffer* buf, struct val_nsec3cache* hc, time_t now,
+	struct ub_packed_rrset_key* nsec3, int rr,
 	uint8_t* dname, size_t dname_len, struct nsec3_cached_hash** hash);
 
 /**
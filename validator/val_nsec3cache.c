@@ -0,0 +1,336 @@
+/*
+ * validator/val_nsec3cache.c - cache of NSEC3 hashes
+ *
+ * Copyright (c) 2026, NLnet Labs. All rights reserved.
+ *
+ * This software is open source.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 
+ * Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ * 
+ * Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ * 
+ * Neither the name of the NLNET LABS nor the names of its contributors may
+ * be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ * TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+/**
+ * \file
+ *
+ * This file contains the cache of NSEC3 hashes.
+ */
+#include "config.h"
+#include "validator/val_nsec3cache.h"
+#include "util/log.h"
+#include "util/config_file.h"
+#include "util/net_help.h"
+#include "util/data/dname.h"
+#include "util/storage/lookup3.h"
+
+/** size of the table with the hash rates of zones */
+#define NSEC3CACHE_RATE_SIZE (256*1024)
+
+struct val_nsec3cache*
+val_nsec3cache_create(struct config_file* cfg)
+{
+	struct val_nsec3cache* hc;
+	if(cfg->nsec3_hash_cache_size == 0 && cfg->nsec3_hash_ratelimit == 0)
+		return NULL;
+	hc = (struct val_nsec3cache*)calloc(1, sizeof(*hc));
+	if(!hc) {
+		log_err("malloc failure");
+		return NULL;
+	}
+	lock_basic_init(&hc->lock);
+	lock_protect(&hc->lock, &hc->num_hit, sizeof(hc->num_hit));
+	lock_protect(&hc->lock, &hc->num_miss, sizeof(hc->num_miss));
+	lock_protect(&hc->lock, &hc->num_ratelimited,
+		sizeof(hc->num_ratelimited));
+	hc->ratelimit = cfg->nsec3_hash_ratelimit;
+	if(cfg->nsec3_hash_cache_size != 0) {
+		hc->slab = slabhash_create(cfg->nsec3_hash_cache_slabs,
+			HASH_DEFAULT_STARTARRAY, cfg->nsec3_hash_cache_size,
+			&nsec3cache_sizefunc, &nsec3cache_compfunc,
+			&nsec3cache_delkeyfunc, &nsec3cache_deldatafunc, NULL);
+		if(!hc->slab) {
+			log_err("malloc failure");
+			val_nsec3cache_delete(hc);
+			return NULL;
+		}
+	}
+	if(hc->ratelimit != 0) {
+		hc->rate = slabhash_create(cfg->nsec3_hash_cache_slabs,
+			HASH_DEFAULT_STARTARRAY, NSEC3CACHE_RATE_SIZE,
+			&nsec3cache_rate_sizefunc, &nsec3cache_rate_compfunc,
+			&nsec3cache_rate_delkeyfunc, &nsec3cache_deldatafunc,
+			NULL);
+		if(!hc->rate) {
+			log_err("malloc failure");
+			val_nsec3cache_delete(hc);
+			return NULL;
+		}
+	}
+	return hc;
+}
+
+void
+val_nsec3cache_delete(struct val_nsec3cache* hc)
+{
+	if(!hc)
+		return;
+	lock_basic_destroy(&hc->lock);
+	slabhash_delete(hc->slab);
+	slabhash_delete(hc->rate);
+	free(hc);
+}
+
+void
+val_nsec3cache_make_key(struct nsec3cache_key* k, int algo, size_t iter,
+	uint8_t* salt, size_t saltlen, uint8_t* name, size_t namelen)
+{
+	hashvalue_type h;
+	memset(k, 0, sizeof(*k));
+	k->algo = algo;
+	k->iter = iter;
+	k->salt = salt;
+	k->saltlen = saltlen;
+	k->name = name;
+	k->namelen = namelen;
+	h = dname_query_hash(name, (hashvalue_type)(algo + (iter<<8)));
+	k->entry.hash = hashlittle(salt, saltlen, h);
+	k->entry.key = k;
+}
+
+size_t
+val_nsec3cache_lookup(struct val_nsec3cache* hc, struct nsec3cache_key* k,
+	uint8_t* res, size_t max)
+{
+	size_t len = 0;
+	struct lruhash_entry* e;
+	if(!hc->slab)
+		return 0;
+	e = slabhash_lookup(hc->slab, k->entry.hash, k, 0);
+	if(e) {
+		struct nsec3cache_data* d = (struct nsec3cache_data*)e->data;
+		if(d->hash_len <= max) {
+			memmove(res, d->hash, d->hash_len);
+			len = d->hash_len;
+		}
+		lock_rw_unlock(&e->lock);
+	}
+	lock_basic_lock(&hc->lock);
+	if(len == 0)
+		hc->num_miss++;
+	else	hc->num_hit++;
+	lock_basic_unlock(&hc->lock);
+	return len;
+}
+
+void
+val_nsec3cache_insert(struct val_nsec3cache* hc, struct nsec3cache_key* k,
+	uint8_t* hash, size_t hash_len)
+{
+	struct nsec3cache_key* nk;
+	struct nsec3cache_data* nd;
+	if(!hc->slab)
+		return;
+	nk = (struct nsec3cache_key*)malloc(sizeof(*nk) + k->saltlen +
+		k->namelen);
+	if(!nk)
+		return;
+	nd = (struct nsec3cache_data*)malloc(sizeof(*nd) + hash_len);
+	if(!nd) {
+		free(nk);
+		return;
+	}
+	memmove(nk, k, sizeof(*nk));
+	nk->salt = (uint8_t*)(nk+1);
+	memmove(nk->salt, k->salt, k->saltlen);
+	nk->name = nk->salt + k->saltlen;
+	memmove(nk->name, k->name, k->namelen);
+	nd->hash_len = hash_len;
+	nd->hash = (uint8_t*)(nd+1);
+	memmove(nd->hash, hash, hash_len);
+	lock_rw_init(&nk->entry.lock);
+	nk->entry.key = nk;
+	nk->entry.data = nd;
+	slabhash_insert(hc->slab, nk->entry.hash, &nk->entry, nd, NULL);
+}
+
+int
+val_nsec3cache_rate_inc(struct val_nsec3cache* hc, uint8_t* zone,
+	size_t zonelen, time_t now)
+{
+	struct nsec3cache_rate_key k, *nk;
+	struct nsec3cache_rate* d;
+	struct lruhash_entry* e;
+	int allow = 1;
+	if(!hc->rate)
+		return 1;
+	memset(&k, 0, sizeof(k));
+	k.zone = zone;
+	k.zonelen = zonelen;
+	k.entry.hash = dname_query_hash(zone, 0xab);
+	k.entry.key = &k;
+	e = slabhash_lookup(hc->rate, k.entry.hash, &k, 1);
+	if(e) {
+		d = (struct nsec3cache_rate*)e->data;
+		if(d->sec != now) {
+			d->sec = now;
+			d->count = 0;
+		}
+		if(d->count >= hc->ratelimit)
+			allow = 0;
+		else	d->count++;
+		lock_rw_unlock(&e->lock);
+		if(!allow) {
+			lock_basic_lock(&hc->lock);
+			hc->num_ratelimited++;
+			lock_basic_unlock(&hc->lock);
+		}
+		return allow;
+	}
+	/* first hash for the zone */
+	nk = (struct nsec3cache_rate_key*)malloc(sizeof(*nk) + zonelen);
+	if(!nk)
+		return 1;
+	d = (struct nsec3cache_rate*)malloc(sizeof(*d));
+	if(!d) {
+		free(nk);
+		return 1;
+	}
+	memmove(nk, &k, sizeof(*nk));
+	nk->zone = (uint8_t*)(nk+1);
+	memmove(nk->zone, zone, zonelen);
+	d->sec = now;
+	d->count = 1;
+	lock_rw_init(&nk->entry.lock);
+	nk->entry.key = nk;
+	nk->entry.data = d;
+	slabhash_insert(hc->rate, nk->entry.hash, &nk->entry, d, NULL);
+	return 1;
+}
+
+void
+val_nsec3cache_get_stats(struct val_nsec3cache* hc, size_t* hit,
+	size_t* miss, size_t* ratelimited, int reset)
+{
+	if(!hc) {
+		*hit = 0;
+		*miss = 0;
+		*ratelimited = 0;
+		return;
+	}
+	lock_basic_lock(&hc->lock);
+	*hit = hc->num_hit;
+	*miss = hc->num_miss;
+	*ratelimited = hc->num_ratelimited;
+	if(reset) {
+		hc->num_hit = 0;
+		hc->num_miss = 0;
+		hc->num_ratelimited = 0;
+	}
+	lock_basic_unlock(&hc->lock);
+}
+
+size_t
+val_nsec3cache_get_mem(struct val_nsec3cache* hc)
+{
+	size_t m;
+	if(!hc)
+		return 0;
+	m = sizeof(*hc);
+	if(hc->slab)
+		m += slabhash_get_mem(hc->slab);
+	if(hc->rate)
+		m += slabhash_get_mem(hc->rate);
+	return m;
+}
+
+size_t
+nsec3cache_sizefunc(void* key, void* data)
+{
+	struct nsec3cache_key* k = (struct nsec3cache_key*)key;
+	struct nsec3cache_data* d = (struct nsec3cache_data*)data;
+	return sizeof(*k) + k->saltlen + k->namelen + sizeof(*d) +
+		d->hash_len + lock_get_mem(&k->entry.lock);
+}
+
+int
+nsec3cache_compfunc(void* key1, void* key2)
+{
+	struct nsec3cache_key* k1 = (struct nsec3cache_key*)key1;
+	struct nsec3cache_key* k2 = (struct nsec3cache_key*)key2;
+	int c;
+	if(k1->algo != k2->algo)
+		return k1->algo < k2->algo ? -1 : 1;
+	if(k1->iter != k2->iter)
+		return k1->iter < k2->iter ? -1 : 1;
+	if(k1->saltlen != k2->saltlen)
+		return k1->saltlen < k2->saltlen ? -1 : 1;
+	if(k1->namelen != k2->namelen)
+		return k1->namelen < k2->namelen ? -1 : 1;
+	if((c=memcmp(k1->salt, k2->salt, k1->saltlen)) != 0)
+		return c;
+	return query_dname_compare(k1->name, k2->name);
+}
+
+void
+nsec3cache_delkeyfunc(void* key, void* ATTR_UNUSED(arg))
+{
+	struct nsec3cache_key* k = (struct nsec3cache_key*)key;
+	lock_rw_destroy(&k->entry.lock);
+	free(k);
+}
+
+void
+nsec3cache_deldatafunc(void* data, void* ATTR_UNUSED(arg))
+{
+	free(data);
+}
+
+size_t
+nsec3cache_rate_sizefunc(void* key, void* ATTR_UNUSED(data))
+{
+	struct nsec3cache_rate_key* k = (struct nsec3cache_rate_key*)key;
+	return sizeof(*k) + k->zonelen + sizeof(struct nsec3cache_rate) +
+		lock_get_mem(&k->entry.lock);
+}
+
+int
+nsec3cache_rate_compfunc(void* key1, void* key2)
+{
+	struct nsec3cache_rate_key* k1 = (struct nsec3cache_rate_key*)key1;
+	struct nsec3cache_rate_key* k2 = (struct nsec3cache_rate_key*)key2;
+	if(k1->zonelen != k2->zonelen)
+		return k1->zonelen < k2->zonelen ? -1 : 1;
+	return query_dname_compare(k1->zone, k2->zone);
+}
+
+void
+nsec3cache_rate_delkeyfunc(void* key, void* ATTR_UNUSED(arg))
+{
+	struct nsec3cache_rate_key* k = (struct nsec3cache_rate_key*)key;
+	lock_rw_destroy(&k->entry.lock);
+	free(k);
+}
@@ -0,0 +1,227 @@
+/*
+ * validator/val_nsec3cache.h - cache of NSEC3 hashes
+ *
+ * Copyright (c) 2026, NLnet Labs. All rights reserved.
+ *
+ * This software is open source.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 
+ * Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ * 
+ * Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ * 
+ * Neither the name of the NLNET LABS nor the names of its contributors may
+ * be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ * TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+/**
+ * \file
+ *
+ * This file contains the cache of NSEC3 hashes.  The iterated hash of a
+ * name with the parameters of a zone is the same for every query, and
+ * is stored here for other queries and threads.  The number of hashes
+ * computed for a zone per second can be limited.
+ */
+
+#ifndef VALIDATOR_VAL_NSEC3CACHE_H
+#define VALIDATOR_VAL_NSEC3CACHE_H
+#include "util/storage/slabhash.h"
+#include "util/locks.h"
+struct config_file;
+
+/**
+ * The NSEC3 hash cache.
+ */
+struct val_nsec3cache {
+	/** uses slabhash for storage, type nsec3cache_key, nsec3cache_data */
+	struct slabhash* slab;
+	/** hashes computed per zone, type nsec3cache_rate_key and
+	 * nsec3cache_rate, NULL if there is no limit */
+	struct slabhash* rate;
+	/** max number of hashes computed per zone per second, 0 is off */
+	int ratelimit;
+	/** lock on the statistics counters */
+	lock_basic_type lock;
+	/** number of hashes found in the cache */
+	size_t num_hit;
+	/** number of hashes that were computed */
+	size_t num_miss;
+	/** number of hashes refused by the rate limit */
+	size_t num_ratelimited;
+};
+
+/**
+ * Key of an NSEC3 hash cache entry.  Allocated with the salt and name
+ * after it.
+ */
+struct nsec3cache_key {
+	/** lru hash entry, data is struct nsec3cache_data */
+	struct lruhash_entry entry;
+	/** NSEC3 hash algorithm */
+	int algo;
+	/** number of extra iterations */
+	size_t iter;
+	/** the salt */
+	uint8_t* salt;
+	/** length of the salt */
+	size_t saltlen;
+	/** the name */
+	uint8_t* name;
+	/** length of the name */
+	size_t namelen;
+};
+
+/**
+ * Data of an NSEC3 hash cache entry.  Allocated with the hash after it.
+ */
+struct nsec3cache_data {
+	/** length of the hash */
+	size_t hash_len;
+	/** the hash, not base32 encoded */
+	uint8_t* hash;
+};
+
+/**
+ * Key of the hash rate of a zone.  Allocated with the name after it.
+ */
+struct nsec3cache_rate_key {
+	/** lru hash entry, data is struct nsec3cache_rate */
+	struct lruhash_entry entry;
+	/** the zone name */
+	uint8_t* zone;
+	/** length of the zone name */
+	size_t zonelen;
+};
+
+/**
+ * Hashes computed for a zone in the current second.
+ */
+struct nsec3cache_rate {
+	/** the second that is counted */
+	time_t sec;
+	/** number of hashes computed in it */
+	int count;
+};
+
+/**
+ * Create the NSEC3 hash cache.
+ * @param cfg: config settings, nsec3-hash-cache-size, nsec3-hash-cache-slabs
+ *	and nsec3-hash-ratelimit.
+ * @return new cache, or NULL if disabled or on malloc failure (logged).
+ */
+struct val_nsec3cache* val_nsec3cache_create(struct config_file* cfg);
+
+/**
+ * Delete the NSEC3 hash cache.
+ * @param hc: to delete.
+ */
+void val_nsec3cache_delete(struct val_nsec3cache* hc);
+
+/**
+ * Make the key for an NSEC3 hash.  The key points to the salt and name
+ * that are passed, it is copied on insert.
+ * @param k: key is filled in.
+ * @param algo: NSEC3 hash algorithm.
+ * @param iter: number of extra iterations.
+ * @param salt: the salt.
+ * @param saltlen: length of salt.
+ * @param name: the name.
+ * @param namelen: length of name.
+ */
+void val_nsec3cache_make_key(struct nsec3cache_key* k, int algo,
+	size_t iter, uint8_t* salt, size_t saltlen, uint8_t* name,
+	size_t namelen);
+
+/**
+ * Lookup an NSEC3 hash, and count a hit or miss.
+ * @param hc: the NSEC3 hash cache.
+ * @param k: key made by val_nsec3cache_make_key.
+ * @param res: the hash is copied here.
+ * @param max: size of res.
+ * @return length of the hash, or 0 if not found.
+ */
+size_t val_nsec3cache_lookup(struct val_nsec3cache* hc,
+	struct nsec3cache_key* k, uint8_t* res, size_t max);
+
+/**
+ * Store an NSEC3 hash.  Silently fails on malloc failure.
+ * @param hc: the NSEC3 hash cache.
+ * @param k: key made by val_nsec3cache_make_key, it is copied.
+ * @param hash: the hash.
+ * @param hash_len: length of the hash.
+ */
+void val_nsec3cache_insert(struct val_nsec3cache* hc,
+	struct nsec3cache_key* k, uint8_t* hash, size_t hash_len);
+
+/**
+ * Count a hash that is computed for a zone, and see if the zone is over
+ * its rate limit.
+ * @param hc: the NSEC3 hash cache.
+ * @param zone: the zone name.
+ * @param zonelen: length of zone.
+ * @param now: current time.
+ * @return false if the hash may not be computed.
+ */
+int val_nsec3cache_rate_inc(struct val_nsec3cache* hc, uint8_t* zone,
+	size_t zonelen, time_t now);
+
+/**
+ * Get the statistics counters, and reset them if asked.
+ * @param hc: the NSEC3 hash cache, may be NULL.
+ * @param hit: number of hits returned.
+ * @param miss: number of misses returned.
+ * @param ratelimited: number of hashes refused by the limit returned.
+ * @param reset: if true, the counters are zeroed.
+ */
+void val_nsec3cache_get_stats(struct val_nsec3cache* hc, size_t* hit,
+	size_t* miss, size_t* ratelimited, int reset);
+
+/**
+ * Get memory in use by the NSEC3 hash cache.
+ * @param hc: the NSEC3 hash cache.
+ * @return memory in use in bytes.
+ */
+size_t val_nsec3cache_get_mem(struct val_nsec3cache* hc);
+
+/** size function for the NSEC3 hash cache, for lruhash */
+size_t nsec3cache_sizefunc(void* key, void* data);
+
+/** compare function for the NSEC3 hash cache, for lruhash */
+int nsec3cache_compfunc(void* key1, void* key2);
+
+/** delete key function for the NSEC3 hash cache, for lruhash */
+void nsec3cache_delkeyfunc(void* key, void* arg);
+
+/** delete data function for the NSEC3 hash cache, for lruhash */
+void nsec3cache_deldatafunc(void* data, void* arg);
+
+/** size function for the NSEC3 zone rates, for lruhash */
+size_t nsec3cache_rate_sizefunc(void* key, void* data);
+
+/** compare function for the NSEC3 zone rates, for lruhash */
+int nsec3cache_rate_compfunc(void* key1, void* key2);
+
+/** delete key function for the NSEC3 zone rates, for lruhash */
+void nsec3cache_rate_delkeyfunc(void* key, void* arg);
+
+#endif /* VALIDATOR_VAL_NSEC3CACHE_H */
@@ -46,6 +46,9 @@
 #include "validator/val_secalgo.h"
 #include "validator/val_nsec3.h"
 #include "util/log.h"
+#include "util/net_help.h"
+#include "util/storage/slabhash.h"
+#include "util/storage/lookup3.h"
 #include "sldns/rrdef.h"
 #include "sldns/keyraw.h"
 #include "sldns/sbuffer.h"
@@ -622,43 +625,26 @@ setup_key_digest(int algo, EVP_PKEY** evp_key, const EVP_MD** digest_type,
 }
 
 /**
- * Check a canonical sig+rrset and signature against a dnskey
+ * Check a canonical sig+rrset and signature against a public key object.
  * @param buf: buffer with data to verify, the first rrsig part and the
  *	canonicalized rrset.
  * @param algo: DNSKEY algorithm.
  * @param sigblock: signature rdata field from RRSIG
  * @param sigblock_len: length of sigblock data.
- * @param key: public key data from DNSKEY RR.
- * @param keylen: length of keydata.
+ * @param evp_key: the public key, it is not changed.
+ * @param digest_type: digest to use with the key.
  * @param reason: bogus reason in more detail.
  * @return secure if verification succeeded, bogus on crypto failure,
  *	unchecked on format errors and alloc failures.
  */
-enum sec_status
-verify_canonrrset(sldns_buffer* buf, int algo, unsigned char* sigblock, 
-	unsigned int sigblock_len, unsigned char* key, unsigned int keylen,
-	char** reason)
+static enum sec_status
+verify_canon_pkey(sldns_buffer* buf, int algo, unsigned char* sigblock,
+	unsigned int sigblock_len, EVP_PKEY* evp_key,
+	const EVP_MD* digest_type, char** reason)
 {
-	const EVP_MD *digest_type;
 	EVP_MD_CTX* ctx;
 	int res, dofree = 0, docrypto_free = 0;
-	EVP_PKEY *evp_key = NULL;
 
-#ifndef USE_DSA
-	if((algo == LDNS_DSA || algo == LDNS_DSA_NSEC3) &&(fake_dsa||fake_sha1))
-		return sec_status_secure;
-#endif
-#ifndef USE_SHA1
-	if(fake_sha1 && (algo == LDNS_DSA || algo == LDNS_DSA_NSEC3 || algo == LDNS_RSASHA1 || algo == LDNS_RSASHA1_NSEC3))
-		return sec_status_secure;
-#endif
-	
-	if(!setup_key_digest(algo, &evp_key, &digest_type, key, keylen)) {
-		verbose(VERB_QUERY, "verify: failed to setup key");
-		*reason = "use of key for crypto failed";
-		EVP_PKEY_free(evp_key);
-		return sec_status_bogus;
-	}
 #ifdef USE_DSA
 	/* if it is a DSA signature in bind format, convert to DER format */
 	if((algo == LDNS_DSA || algo == LDNS_DSA_NSEC3) && 
@@ -666,7 +652,6 @@ verify_canonrrset(sldns_buffer* buf, int algo, unsigned char* sigblock,
 		if(!setup_dsa_sig(&sigblock, &sigblock_len)) {
 			verbose(VERB_QUERY, "verify: failed to setup DSA sig");
 			*reason = "use of key for DSA crypto failed";
-			EVP_PKEY_free(evp_key);
 			return sec_status_bogus;
 		}
 		docrypto_free = 1;
@@ -681,7 +666,6 @@ verify_canonrrset(sldns_buffer* buf, int algo, unsigned char* sigblock,
 		if(!setup_ecdsa_sig(&sigblock, &sigblock_len)) {
 			verbose(VERB_QUERY, "verify: failed to setup ECDSA sig");
 			*reason = "use of signature for ECDSA crypto failed";
-			EVP_PKEY_free(evp_key);
 			return sec_status_bogus;
 		}
 		dofree = 1;
@@ -697,7 +681,6 @@ verify_canonrrset(sldns_buffer* buf, int algo, unsigned char* sigblock,
 #endif
 	if(!ctx) {
 		log_err("EVP_MD_CTX_new: malloc failure");
-		EVP_PKEY_free(evp_key);
 		if(dofree) free(sigblock);
 		else if(docrypto_free) OPENSSL_free(sigblock);
 		return sec_status_unchecked;
@@ -711,7 +694,6 @@ verify_canonrrset(sldns_buffer* buf, int algo, unsigned char* sigblock,
 		EVP_MD_CTX_cleanup(ctx);
 		free(ctx);
 #endif
-		EVP_PKEY_free(evp_key);
 		if(dofree) free(sigblock);
 		else if(docrypto_free) OPENSSL_free(sigblock);
 		return sec_status_unchecked;
@@ -725,7 +707,6 @@ verify_canonrrset(sldns_buffer* buf, int algo, unsigned char* sigblock,
 		EVP_MD_CTX_cleanup(ctx);
 		free(ctx);
 #endif
-		EVP_PKEY_free(evp_key);
 		if(dofree) free(sigblock);
 		else if(docrypto_free) OPENSSL_free(sigblock);
 		return sec_status_unchecked;
@@ -741,7 +722,6 @@ verify_canonrrset(sldns_buffer* buf, int algo, unsigned char* sigblock,
 		EVP_MD_CTX_cleanup(ctx);
 		free(ctx);
 #endif
-		EVP_PKEY_free(evp_key);
 		if(dofree) free(sigblock);
 		else if(docrypto_free) OPENSSL_free(sigblock);
 		return sec_status_unchecked;
@@ -756,7 +736,6 @@ verify_canonrrset(sldns_buffer* buf, int algo, unsigned char* sigblock,
 	EVP_MD_CTX_cleanup(ctx);
 	free(ctx);
 #endif
-	EVP_PKEY_free(evp_key);
 
 	if(dofree) free(sigblock);
 	else if(docrypto_free) OPENSSL_free(sigblock);
@@ -773,6 +752,103 @@ verify_canonrrset(sldns_buffer* buf, int algo, unsigned char* sigblock,
 	return sec_status_unchecked;
 }
 
+/** lookup a parsed key in the cache, returns read locked entry or NULL */
+static struct lruhash_entry*
+keycache_lookup(struct slabhash* keycache, int algo, unsigned char* key,
+	unsigned int keylen)
+{
+	struct secalgo_keycache_key k;
+	k.algo = algo;
+	k.key = key;
+	k.keylen = keylen;
+	k.entry.hash = hashlittle(key, keylen, (uint32_t)algo);
+	k.entry.key = &k;
+	return slabhash_lookup(keycache, k.entry.hash, &k, 0);
+}
+
+/** store a parsed key in the cache, the cache owns evp_key afterwards */
+static void
+keycache_insert(struct slabhash* keycache, int algo, unsigned char* key,
+	unsigned int keylen, EVP_PKEY* evp_key, const EVP_MD* digest_type)
+{
+	struct secalgo_keycache_key* k = (struct secalgo_keycache_key*)
+		calloc(1, sizeof(*k));
+	struct secalgo_keycache_data* d = (struct secalgo_keycache_data*)
+		calloc(1, sizeof(*d));
+	if(!k || !d || !(k->key = memdup(key, keylen))) {
+		free(k);
+		free(d);
+		EVP_PKEY_free(evp_key);
+		return;
+	}
+	lock_rw_init(&k->entry.lock);
+	k->algo = algo;
+	k->keylen = keylen;
+	k->entry.hash = hashlittle(key, keylen, (uint32_t)algo);
+	k->entry.key = k;
+	k->entry.data = d;
+	d->pkey = evp_key;
+	d->digest = digest_type;
+	slabhash_insert(keycache, k->entry.hash, &k->entry, d, NULL);
+}
+
+/**
+ * Check a canonical sig+rrset and signature against a dnskey
+ * @param buf: buffer with data to verify, the first rrsig part and the
+ *	canonicalized rrset.
+ * @param algo: DNSKEY algorithm.
+ * @param sigblock: signature rdata field from RRSIG
+ * @param sigblock_len: length of sigblock data.
+ * @param key: public key data from DNSKEY RR.
+ * @param keylen: length of keydata.
+ * @param keycache: cache of parsed keys, or NULL.
+ * @param reason: bogus reason in more detail.
+ * @return secure if verification succeeded, bogus on crypto failure,
+ *	unchecked on format errors and alloc failures.
+ */
+enum sec_status
+verify_canonrrset(sldns_buffer* buf, int algo, unsigned char* sigblock, 
+	unsigned int sigblock_len, unsigned char* key, unsigned int keylen,
+	struct slabhash* keycache, char** reason)
+{
+	const EVP_MD *digest_type;
+	EVP_PKEY *evp_key = NULL;
+	struct lruhash_entry* e;
+	enum sec_status sec;
+
+#ifndef USE_DSA
+	if((algo == LDNS_DSA || algo == LDNS_DSA_NSEC3) &&(fake_dsa||fake_sha1))
+		return sec_status_secure;
+#endif
+#ifndef USE_SHA1
+	if(fake_sha1 && (algo == LDNS_DSA || algo == LDNS_DSA_NSEC3 || algo == LDNS_RSASHA1 || algo == LDNS_RSASHA1_NSEC3))
+		return sec_status_secure;
+#endif
+
+	/* the key is parsed once, and used while it is in the cache */
+	if(keycache && (e = keycache_lookup(keycache, algo, key, keylen))) {
+		struct secalgo_keycache_data* d =
+			(struct secalgo_keycache_data*)e->data;
+		sec = verify_canon_pkey(buf, algo, sigblock, sigblock_len,
+			(EVP_PKEY*)d->pkey, (const EVP_MD*)d->digest, reason);
+		lock_rw_unlock(&e->lock);
+		return sec;
+	}
+	if(!setup_key_digest(algo, &evp_key, &digest_type, key, keylen)) {
+		verbose(VERB_QUERY, "verify: failed to setup key");
+		*reason = "use of key for crypto failed";
+		EVP_PKEY_free(evp_key);
+		return sec_status_bogus;
+	}
+	sec = verify_canon_pkey(buf, algo, sigblock, sigblock_len, evp_key,
+		digest_type, reason);
+	if(keycache)
+		keycache_insert(keycache, algo, key, keylen, evp_key,
+			digest_type);
+	else	EVP_PKEY_free(evp_key);
+	return sec;
+}
+
 /**************************************************/
 #elif defined(HAVE_NSS)
 /* libnss implementation */
@@ -1239,6 +1315,7 @@ nss_setup_key_digest(int algo, SECKEYPublicKey** pubkey, HASH_HashType* htype,
  * @param sigblock_len: length of sigblock data.
  * @param key: public key data from DNSKEY RR.
  * @param keylen: length of keydata.
+ * @param keycache: cache of parsed keys, or NULL. Not used by NSS.
  * @param reason: bogus reason in more detail.
  * @return secure if verification succeeded, bogus on crypto failure,
  *	unchecked on format errors and alloc failures.
@@ -1246,7 +1323,7 @@ nss_setup_key_digest(int algo, SECKEYPublicKey** pubkey, HASH_HashType* htype,
 enum sec_status
 verify_canonrrset(sldns_buffer* buf, int algo, unsigned char* sigblock, 
 	unsigned int sigblock_len, unsigned char* key, unsigned int keylen,
-	char** reason)
+	struct slabhash* ATTR_UNUSED(keycache), char** reason)
 {
 	/* uses libNSS */
 	/* large enough for the different hashes */
@@ -1802,6 +1879,7 @@ _verify_nettle_ed25519(sldns_buffer* buf, unsigned char* sigblock,
  * @param sigblock_len: length of sigblock data.
  * @param key: public key data from DNSKEY RR.
  * @param keylen: length of keydata.
+ * @param keycache: cache of parsed keys, or NULL. Not used by nettle.
  * @param reason: bogus reason in more detail.
  * @return secure if verification succeeded, bogus on crypto failure,
  *	unchecked on format errors and alloc failures.
@@ -1809,7 +1887,7 @@ _verify_nettle_ed25519(sldns_buffer* buf, unsigned char* sigblock,
 enum sec_status
 verify_canonrrset(sldns_buffer* buf, int algo, unsigned char* sigblock,
 	unsigned int sigblock_len, unsigned char* key, unsigned int keylen,
-	char** reason)
+	struct slabhash* ATTR_UNUSED(keycache), char** reason)
 {
 	unsigned int digest_size = 0;
 
@@ -1883,3 +1961,53 @@ verify_canonrrset(sldns_buffer* buf, int algo, unsigned char* sigblock,
 }
 
 #endif /* HAVE_SSL or HAVE_NSS or HAVE_NETTLE */
+
+struct slabhash*
+secalgo_keycache_create(size_t maxmem, size_t slabs)
+{
+	return slabhash_create(slabs, HASH_DEFAULT_STARTARRAY, maxmem,
+		&secalgo_keycache_sizefunc, &secalgo_keycache_compfunc,
+		&secalgo_keycache_delkeyfunc, &secalgo_keycache_deldatafunc,
+		NULL);
+}
+
+size_t
+secalgo_keycache_sizefunc(void* key, void* ATTR_UNUSED(data))
+{
+	struct secalgo_keycache_key* k = (struct secalgo_keycache_key*)key;
+	/* the decoded key object is about the size of the key material,
+	 * plus the bignum and library overhead */
+	return sizeof(*k) + sizeof(struct secalgo_keycache_data) +
+		lock_get_mem(&k->entry.lock) + k->keylen*3 + 512;
+}
+
+int
+secalgo_keycache_compfunc(void* key1, void* key2)
+{
+	struct secalgo_keycache_key* k1 = (struct secalgo_keycache_key*)key1;
+	struct secalgo_keycache_key* k2 = (struct secalgo_keycache_key*)key2;
+	if(k1->algo != k2->algo)
+		return k1->algo < k2->algo ? -1 : 1;
+	if(k1->keylen != k2->keylen)
+		return k1->keylen < k2->keylen ? -1 : 1;
+	return memcmp(k1->key, k2->key, k1->keylen);
+}
+
+void
+secalgo_keycache_delkeyfunc(void* key, void* ATTR_UNUSED(arg))
+{
+	struct secalgo_keycache_key* k = (struct secalgo_keycache_key*)key;
+	lock_rw_destroy(&k->entry.lock);
+	free(k->key);
+	free(k);
+}
+
+void
+secalgo_keycache_deldatafunc(void* data, void* ATTR_UNUSED(arg))
+{
+	struct secalgo_keycache_data* d = (struct secalgo_keycache_data*)data;
+#ifdef HAVE_SSL
+	EVP_PKEY_free((EVP_PKEY*)d->pkey);
+#endif
+	free(d);
+}
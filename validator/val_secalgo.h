@@ -42,7 +42,33 @@
 
 #ifndef VALIDATOR_VAL_SECALGO_H
 #define VALIDATOR_VAL_SECALGO_H
+#include "util/storage/lruhash.h"
 struct sldns_buffer;
+struct slabhash;
+
+/**
+ * Key of an entry in the cache of parsed public keys.
+ */
+struct secalgo_keycache_key {
+	/** lru hash entry, data is struct secalgo_keycache_data */
+	struct lruhash_entry entry;
+	/** DNSKEY algorithm */
+	int algo;
+	/** public key rdata field, malloced */
+	unsigned char* key;
+	/** length of key */
+	size_t keylen;
+};
+
+/**
+ * Parsed public key, for the crypto library in use.
+ */
+struct secalgo_keycache_data {
+	/** the public key object, EVP_PKEY for openssl */
+	void* pkey;
+	/** the digest to use with it, EVP_MD for openssl */
+	const void* digest;
+};
 
 /** Return size of nsec3 hash algorithm, 0 if not supported */
 size_t nsec3_hash_algo_size_supported(int id);
@@ -102,6 +128,29 @@ int dnskey_algo_id_is_supported(int id);
  */
 enum sec_status verify_canonrrset(struct sldns_buffer* buf, int algo,
 	unsigned char* sigblock, unsigned int sigblock_len,
-	unsigned char* key, unsigned int keylen, char** reason);
+	unsigned char* key, unsigned int keylen, struct slabhash* keycache,
+	char** reason);
+
+/**
+ * Create the cache of parsed public keys. The keys are decoded once and
+ * used for the signatures that follow, until they are pushed out.
+ * Only the openssl implementation stores keys in it.
+ * @param maxmem: memory size of the cache.
+ * @param slabs: number of slabs, power of 2.
+ * @return new cache or NULL on alloc failure.
+ */
+struct slabhash* secalgo_keycache_create(size_t maxmem, size_t slabs);
+
+/** size function for the parsed key cache, for lruhash */
+size_t secalgo_keycache_sizefunc(void* key, void* data);
+
+/** compare function for the parsed key cache, for lruhash */
+int secalgo_keycache_compfunc(void* key1, void* key2);
+
+/** delete key function for the parsed key cache, for lruhash */
+void secalgo_keycache_delkeyfunc(void* key, void* arg);
+
+/** delete data function for the parsed key cache, for lruhash */
+void secalgo_keycache_deldatafunc(void* data, void* arg);
 
 #endif /* VALIDATOR_VAL_SECALGO_H */
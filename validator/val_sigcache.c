@@ -0,0 +1,229 @@
+/*
+ * validator/val_sigcache.c - cache of signature verification results
+ *
+ * Copyright (c) 2026, NLnet Labs. All rights reserved.
+ *
+ * This software is open source.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 
+ * Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ * 
+ * Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ * 
+ * Neither the name of the NLNET LABS nor the names of its contributors may
+ * be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ * TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+/**
+ * \file
+ *
+ * This file contains the cache of RRSIG verification results.
+ */
+#include "config.h"
+#include "validator/val_sigcache.h"
+#include "validator/val_secalgo.h"
+#include "util/log.h"
+#include "util/config_file.h"
+#include "util/net_help.h"
+#include "util/regional.h"
+#include "sldns/sbuffer.h"
+
+struct val_sigcache*
+val_sigcache_create(struct config_file* cfg)
+{
+	struct val_sigcache* sc;
+	if(cfg->sig_cache_size == 0)
+		return NULL;
+	sc = (struct val_sigcache*)calloc(1, sizeof(*sc));
+	if(!sc) {
+		log_err("malloc failure");
+		return NULL;
+	}
+	sc->slab = slabhash_create(cfg->sig_cache_slabs,
+		HASH_DEFAULT_STARTARRAY, cfg->sig_cache_size,
+		&sigcache_sizefunc, &sigcache_compfunc,
+		&sigcache_delkeyfunc, &sigcache_deldatafunc, NULL);
+	if(!sc->slab) {
+		log_err("malloc failure");
+		free(sc);
+		return NULL;
+	}
+	lock_basic_init(&sc->lock);
+	lock_protect(&sc->lock, &sc->num_hit, sizeof(sc->num_hit));
+	lock_protect(&sc->lock, &sc->num_miss, sizeof(sc->num_miss));
+	return sc;
+}
+
+void
+val_sigcache_delete(struct val_sigcache* sc)
+{
+	if(!sc)
+		return;
+	lock_basic_destroy(&sc->lock);
+	slabhash_delete(sc->slab);
+	free(sc);
+}
+
+int
+val_sigcache_make_key(struct sigcache_key* k, struct regional* region,
+	sldns_buffer* buf, int algo, uint16_t keytag,
+	unsigned char* sigblock, unsigned int sigblock_len,
+	unsigned char* key, unsigned int keylen)
+{
+	size_t len = sldns_buffer_limit(buf);
+	uint8_t* d = (uint8_t*)regional_alloc(region,
+		len + sigblock_len + keylen);
+	if(!d)
+		return 0;
+	/* the buffer holds the RRSIG fields and canonical rrset, that is
+	 * the signed data, and with the signature and key the digest
+	 * identifies the public key operation */
+	memmove(d, sldns_buffer_begin(buf), len);
+	memmove(d+len, sigblock, sigblock_len);
+	memmove(d+len+sigblock_len, key, keylen);
+	memset(k, 0, sizeof(*k));
+	k->algo = (uint8_t)algo;
+	k->keytag = keytag;
+	secalgo_hash_sha256(d, len + sigblock_len + keylen, k->digest);
+	memmove(&k->entry.hash, k->digest, sizeof(k->entry.hash));
+	k->entry.key = k;
+	return 1;
+}
+
+enum sec_status
+val_sigcache_lookup(struct val_sigcache* sc, struct sigcache_key* k,
+	time_t now)
+{
+	enum sec_status sec = sec_status_unchecked;
+	struct lruhash_entry* e = slabhash_lookup(sc->slab, k->entry.hash,
+		k, 0);
+	if(e) {
+		struct sigcache_data* d = (struct sigcache_data*)e->data;
+		if(d->ttl > now)
+			sec = d->sec;
+		lock_rw_unlock(&e->lock);
+	}
+	lock_basic_lock(&sc->lock);
+	if(sec == sec_status_unchecked)
+		sc->num_miss++;
+	else	sc->num_hit++;
+	lock_basic_unlock(&sc->lock);
+	return sec;
+}
+
+int
+val_sigcache_contains(struct val_sigcache* sc, struct sigcache_key* k,
+	time_t now)
+{
+	int found = 0;
+	struct lruhash_entry* e = slabhash_lookup(sc->slab, k->entry.hash,
+		k, 0);
+	if(e) {
+		found = (((struct sigcache_data*)e->data)->ttl > now);
+		lock_rw_unlock(&e->lock);
+	}
+	return found;
+}
+
+void
+val_sigcache_insert(struct val_sigcache* sc, struct sigcache_key* k,
+	enum sec_status sec, time_t ttl)
+{
+	struct sigcache_key* nk = (struct sigcache_key*)memdup(k,
+		sizeof(*k));
+	struct sigcache_data* nd;
+	if(!nk)
+		return;
+	nd = (struct sigcache_data*)malloc(sizeof(*nd));
+	if(!nd) {
+		free(nk);
+		return;
+	}
+	nd->sec = sec;
+	nd->ttl = ttl;
+	lock_rw_init(&nk->entry.lock);
+	nk->entry.key = nk;
+	nk->entry.data = nd;
+	slabhash_insert(sc->slab, nk->entry.hash, &nk->entry, nd, NULL);
+}
+
+void
+val_sigcache_get_stats(struct val_sigcache* sc, size_t* hit, size_t* miss,
+	int reset)
+{
+	if(!sc) {
+		*hit = 0;
+		*miss = 0;
+		return;
+	}
+	lock_basic_lock(&sc->lock);
+	*hit = sc->num_hit;
+	*miss = sc->num_miss;
+	if(reset) {
+		sc->num_hit = 0;
+		sc->num_miss = 0;
+	}
+	lock_basic_unlock(&sc->lock);
+}
+
+size_t
+val_sigcache_get_mem(struct val_sigcache* sc)
+{
+	if(!sc)
+		return 0;
+	return sizeof(*sc) + slabhash_get_mem(sc->slab);
+}
+
+size_t
+sigcache_sizefunc(void* key, void* ATTR_UNUSED(data))
+{
+	struct sigcache_key* k = (struct sigcache_key*)key;
+	return sizeof(*k) + sizeof(struct sigcache_data)
+		+ lock_get_mem(&k->entry.lock);
+}
+
+int
+sigcache_compfunc(void* key1, void* key2)
+{
+	struct sigcache_key* k1 = (struct sigcache_key*)key1;
+	struct sigcache_key* k2 = (struct sigcache_key*)key2;
+	if(k1->algo != k2->algo)
+		return k1->algo < k2->algo ? -1 : 1;
+	if(k1->keytag != k2->keytag)
+		return k1->keytag < k2->keytag ? -1 : 1;
+	return memcmp(k1->digest, k2->digest, sizeof(k1->digest));
+}
+
+void
+sigcache_delkeyfunc(void* key, void* ATTR_UNUSED(arg))
+{
+	struct sigcache_key* k = (struct sigcache_key*)key;
+	lock_rw_destroy(&k->entry.lock);
+	free(k);
+}
+
+void
+sigcache_deldatafunc(void* data, void* ATTR_UNUSED(arg))
+{
+	free(data);
+}
@@ -0,0 +1,187 @@
+/*
+ * validator/val_sigcache.h - cache of signature verification results
+ *
+ * Copyright (c) 2026, NLnet Labs. All rights reserved.
+ *
+ * This software is open source.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 
+ * Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ * 
+ * Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ * 
+ * Neither the name of the NLNET LABS nor the names of its contributors may
+ * be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ * TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+/**
+ * \file
+ *
+ * This file contains the cache of RRSIG verification results.  The same
+ * signed rrset is often checked again, from another query or another
+ * thread, and the result of the public key operation is stored here.
+ */
+
+#ifndef VALIDATOR_VAL_SIGCACHE_H
+#define VALIDATOR_VAL_SIGCACHE_H
+#include "util/storage/slabhash.h"
+#include "util/locks.h"
+#include "util/data/packed_rrset.h"
+struct config_file;
+struct regional;
+struct sldns_buffer;
+
+/** size of the digest that identifies a signature check */
+#define SIGCACHE_DIGEST_SIZE 32
+
+/**
+ * The signature cache.
+ */
+struct val_sigcache {
+	/** uses slabhash for storage, type sigcache_key, sigcache_data */
+	struct slabhash* slab;
+	/** lock on the statistics counters */
+	lock_basic_type lock;
+	/** number of lookups that found a result */
+	size_t num_hit;
+	/** number of lookups that had to do the public key operation */
+	size_t num_miss;
+};
+
+/**
+ * Key of a signature cache entry.  The digest is the sha256 of the
+ * canonical rrset with the RRSIG fields, the signature and the public key.
+ */
+struct sigcache_key {
+	/** lru hash entry, data is struct sigcache_data */
+	struct lruhash_entry entry;
+	/** DNSKEY algorithm */
+	uint8_t algo;
+	/** key tag of the DNSKEY */
+	uint16_t keytag;
+	/** digest of the signed data, signature and key */
+	uint8_t digest[SIGCACHE_DIGEST_SIZE];
+};
+
+/**
+ * Data of a signature cache entry.
+ */
+struct sigcache_data {
+	/** result of the check, secure or bogus */
+	enum sec_status sec;
+	/** absolute time when the entry expires */
+	time_t ttl;
+};
+
+/**
+ * Create the signature cache.
+ * @param cfg: config settings, sig-cache-size and sig-cache-slabs.
+ * @return new cache, or NULL if disabled or on malloc failure (logged).
+ */
+struct val_sigcache* val_sigcache_create(struct config_file* cfg);
+
+/**
+ * Delete the signature cache.
+ * @param sc: to delete.
+ */
+void val_sigcache_delete(struct val_sigcache* sc);
+
+/**
+ * Make the key for a signature check.
+ * @param k: key is filled in, the entry is not initialised.
+ * @param region: scratch space for the digest input.
+ * @param buf: the canonical rrset, after the first RRSIG fields.
+ * @param algo: DNSKEY algorithm.
+ * @param keytag: key tag of the DNSKEY.
+ * @param sigblock: the signature.
+ * @param sigblock_len: length of sigblock.
+ * @param key: the public key.
+ * @param keylen: length of key.
+ * @return false on alloc failure.
+ */
+int val_sigcache_make_key(struct sigcache_key* k, struct regional* region,
+	struct sldns_buffer* buf, int algo, uint16_t keytag,
+	unsigned char* sigblock, unsigned int sigblock_len,
+	unsigned char* key, unsigned int keylen);
+
+/**
+ * Lookup a signature check result.
+ * @param sc: the signature cache.
+ * @param k: key made by val_sigcache_make_key.
+ * @param now: current time.
+ * @return secure or bogus if cached, unchecked if not found.
+ */
+enum sec_status val_sigcache_lookup(struct val_sigcache* sc,
+	struct sigcache_key* k, time_t now);
+
+/**
+ * See if a signature check result is cached, without counting a hit or
+ * miss.
+ * @param sc: the signature cache.
+ * @param k: key made by val_sigcache_make_key.
+ * @param now: current time.
+ * @return true if a result is cached.
+ */
+int val_sigcache_contains(struct val_sigcache* sc, struct sigcache_key* k,
+	time_t now);
+
+/**
+ * Store a signature check result.  Silently fails on malloc failure.
+ * @param sc: the signature cache.
+ * @param k: key made by val_sigcache_make_key, it is copied.
+ * @param sec: secure or bogus.
+ * @param ttl: absolute time when the result expires.
+ */
+void val_sigcache_insert(struct val_sigcache* sc, struct sigcache_key* k,
+	enum sec_status sec, time_t ttl);
+
+/**
+ * Get the hit and miss counters, and reset them if asked.
+ * @param sc: the signature cache, may be NULL.
+ * @param hit: number of hits returned.
+ * @param miss: number of misses returned.
+ * @param reset: if true, the counters are zeroed.
+ */
+void val_sigcache_get_stats(struct val_sigcache* sc, size_t* hit,
+	size_t* miss, int reset);
+
+/**
+ * Get memory in use by the signature cache.
+ * @param sc: the signature cache.
+ * @return memory in use in bytes.
+ */
+size_t val_sigcache_get_mem(struct val_sigcache* sc);
+
+/** size function for the signature cache, for lruhash */
+size_t sigcache_sizefunc(void* key, void* data);
+
+/** compare function for the signature cache, for lruhash */
+int sigcache_compfunc(void* key1, void* key2);
+
+/** delete key function for the signature cache, for lruhash */
+void sigcache_delkeyfunc(void* key, void* arg);
+
+/** delete data function for the signature cache, for lruhash */
+void sigcache_deldatafunc(void* data, void* arg);
+
+#endif /* VALIDATOR_VAL_SIGCACHE_H */
@@ -43,6 +43,8 @@
 #include "config.h"
 #include "validator/val_sigcrypt.h"
 #include "validator/val_secalgo.h"
+#include "validator/val_sigcache.h"
+#include "validator/val_cryptopool.h"
 #include "validator/validator.h"
 #include "util/data/msgreply.h"
 #include "util/data/msgparse.h"
@@ -482,6 +484,119 @@ int algo_needs_missing(struct algo_needs* n)
 	return 0;
 }
 
+/** number of signatures that are ordered on the stack, more use scratch */
+#define SIG_ORDER_STACK 8
+
+/** a signature of the rrset, in the order it is checked */
+struct sig_order {
+	/** index of the signature in the rrset */
+	size_t idx;
+	/** estimated cost of the check */
+	unsigned int cost;
+	/** if the signature was checked */
+	int checked;
+};
+
+/**
+ * Estimate the cost of checking a signature, relative to RSA with a 2048
+ * bit key.  RSA with its small public exponent verifies fast, but grows
+ * with the square of the key size, that is taken from the signature
+ * length.  The elliptic curves cost about the same for every key.
+ * @param rrset: the rrset with signatures.
+ * @param sig_idx: signature index.
+ * @return cost in units of about a microsecond.
+ */
+static unsigned int
+sig_verify_cost(struct ub_packed_rrset_key* rrset, size_t sig_idx)
+{
+	struct packed_rrset_data* d = (struct packed_rrset_data*)
+		rrset->entry.data;
+	uint8_t* rdata = d->rr_data[d->count + sig_idx];
+	size_t len = d->rr_len[d->count + sig_idx];
+	size_t signerlen, bits;
+	switch(rrset_get_sig_algo(rrset, sig_idx)) {
+	case LDNS_RSAMD5:
+	case LDNS_RSASHA1:
+	case LDNS_RSASHA1_NSEC3:
+	case LDNS_RSASHA256:
+	case LDNS_RSASHA512:
+		if(len < 2+18+1)
+			return 0;
+		signerlen = dname_valid(rdata+2+18, len-2-18);
+		if(signerlen == 0)
+			return 0; /* fails quickly */
+		bits = (len-2-18-signerlen)*8;
+		/* 25 at 2048 bits, scaled by the square of the size */
+		return (unsigned int)(25*(bits/64)*(bits/64)/1024);
+	case LDNS_ED25519:
+		return 55;
+	case LDNS_ECDSAP256SHA256:
+		return 70;
+	case LDNS_DSA:
+	case LDNS_DSA_NSEC3:
+		return 100;
+	case LDNS_ED448:
+		return 200;
+	case LDNS_ECDSAP384SHA384:
+		return 300;
+	case LDNS_ECC_GOST:
+		return 400;
+	default:
+		/* unsupported algorithms do not check anything */
+		return 0;
+	}
+}
+
+/**
+ * Sort the signatures of the rrset, the cheapest check first, otherwise
+ * in the order of the message.
+ * @param rrset: the rrset with signatures.
+ * @param order: array with the signatures, num long.
+ * @param num: number of signatures.
+ */
+static void
+sig_order_sort(struct ub_packed_rrset_key* rrset, struct sig_order* order,
+	size_t num)
+{
+	size_t i, j;
+	for(i=0; i<num; i++) {
+		struct sig_order o;
+		o.idx = i;
+		o.cost = sig_verify_cost(rrset, i);
+		o.checked = 0;
+		/* insertion sort, there are few signatures */
+		for(j=i; j>0 && order[j-1].cost > o.cost; j--)
+			order[j] = order[j-1];
+		order[j] = o;
+	}
+}
+
+/**
+ * Count the signatures that were checked and skipped, by algorithm.
+ * @param ve: validator environment with the counters.
+ * @param rrset: the rrset with signatures.
+ * @param order: the signatures, with the ones checked marked.
+ * @param num: number of signatures.
+ */
+static void
+sig_order_count(struct val_env* ve, struct ub_packed_rrset_key* rrset,
+	struct sig_order* order, size_t num)
+{
+	size_t i;
+	if(!ve)
+		return;
+	lock_basic_lock(&ve->sigstat_lock);
+	for(i=0; i<num; i++) {
+		int algo = rrset_get_sig_algo(rrset, order[i].idx);
+		if(algo >= VAL_ALGO_STATS_NUM)
+			continue;
+		if(order[i].checked)
+			ve->num_sig_verify[algo]++;
+		else	ve->num_sig_skip[algo]++;
+	}
+	lock_basic_unlock(&ve->sigstat_lock);
+}
+
 enum sec_status 
 dnskeyset_verify_rrset(struct module_env* env, struct val_env* ve,
 	struct ub_packed_rrset_key* rrset, struct ub_packed_rrset_key* dnskey,
@@ -494,6 +609,8 @@ dnskeyset_verify_rrset(struct module_env* env, struct val_env* ve,
 	/* make sure that for all DNSKEY algorithms there are valid sigs */
 	struct algo_needs needs;
 	int alg;
+	struct sig_order stack_order[SIG_ORDER_STACK];
+	struct sig_order* order = stack_order;
 
 	num = rrset_get_sigcount(rrset);
 	if(num == 0) {
@@ -511,21 +628,36 @@ dnskeyset_verify_rrset(struct module_env* env, struct val_env* ve,
 			return sec_status_insecure;
 		}
 	}
+	/* check the cheapest signatures first, and stop when the
+	 * algorithms that are needed are secure */
+	if(num > SIG_ORDER_STACK) {
+		order = (struct sig_order*)regional_alloc(env->scratch,
+			sizeof(*order)*num);
+		if(!order) {
+			*reason = "out of memory";
+			return sec_status_bogus;
+		}
+	}
+	sig_order_sort(rrset, order, num);
 	for(i=0; i<num; i++) {
+		uint8_t a = (uint8_t)rrset_get_sig_algo(rrset, order[i].idx);
+		/* the algorithm is not needed, or is already secure */
+		if(sigalg && needs.needs[a] == 0)
+			continue;
+		order[i].checked = 1;
 		sec = dnskeyset_verify_rrset_sig(env, ve, *env->now, rrset, 
-			dnskey, i, &sortree, reason, section, qstate);
+			dnskey, order[i].idx, &sortree, reason, section, qstate);
 		/* see which algorithm has been fixed up */
 		if(sec == sec_status_secure) {
-			if(!sigalg)
-				return sec; /* done! */
-			else if(algo_needs_set_secure(&needs,
-				(uint8_t)rrset_get_sig_algo(rrset, i)))
+			if(!sigalg || algo_needs_set_secure(&needs, a)) {
+				sig_order_count(ve, rrset, order, num);
 				return sec; /* done! */
+			}
 		} else if(sigalg && sec == sec_status_bogus) {
-			algo_needs_set_bogus(&needs,
-				(uint8_t)rrset_get_sig_algo(rrset, i));
+			algo_needs_set_bogus(&needs, a);
 		}
 	}
+	sig_order_count(ve, rrset, order, num);
 	if(sigalg && (alg=algo_needs_missing(&needs)) != 0) {
 		verbose(VERB_ALGO, "rrset failed to verify: "
 			"no valid signatures for %d algorithms",
@@ -554,12 +686,11 @@ void algo_needs_reason(struct module_env* env, int alg, char** reason, char* s)
 enum sec_status 
 dnskey_verify_rrset(struct module_env* env, struct val_env* ve,
         struct ub_packed_rrset_key* rrset, struct ub_packed_rrset_key* dnskey,
-	size_t dnskey_idx, char** reason, sldns_pkt_section section,
-	struct module_qstate* qstate)
+	size_t dnskey_idx, struct rbtree_type** sortree, char** reason,
+	sldns_pkt_section section, struct module_qstate* qstate)
 {
 	enum sec_status sec;
 	size_t i, num, numchecked = 0;
-	rbtree_type* sortree = NULL;
 	int buf_canon = 0;
 	uint16_t tag = dnskey_calc_keytag(dnskey, dnskey_idx);
 	int algo = dnskey_get_algo(dnskey, dnskey_idx);
@@ -579,7 +710,7 @@ dnskey_verify_rrset(struct module_env* env, struct val_env* ve,
 		buf_canon = 0;
 		sec = dnskey_verify_rrset_sig(env->scratch, 
 			env->scratch_buffer, ve, *env->now, rrset, 
-			dnskey, dnskey_idx, i, &sortree, &buf_canon, reason,
+			dnskey, dnskey_idx, i, sortree, &buf_canon, reason,
 			section, qstate);
 		if(sec == sec_status_secure)
 			return sec;
@@ -642,6 +773,9 @@ struct canon_rr {
 	struct ub_packed_rrset_key* rrset;
 	/** which RR in the rrset */
 	size_t rr_idx;
+	/** the rdata, with rdata length, with the names in canonical form,
+	 * made once for the rrset and copied for every signature */
+	uint8_t* canon;
 };
 
 /**
@@ -1050,6 +1184,38 @@ canonicalize_rdata(sldns_buffer* buf, struct ub_packed_rrset_key* rrset,
 	}
 }
 
+/**
+ * Make the canonical form of the rdata of the sorted RRs, once for the
+ * rrset, so that the names are not lowercased again for every signature.
+ * @param region: where to allocate.
+ * @param k: the rrset.
+ * @param d: rrset data.
+ * @param sortree: the sorted RRs, the canon field is set.
+ * @return false on alloc error.
+ */
+static int
+canonical_rdata(struct regional* region, struct ub_packed_rrset_key* k,
+	struct packed_rrset_data* d, struct rbtree_type* sortree)
+{
+	struct canon_rr* walk;
+	sldns_buffer canon;
+	size_t total = 0;
+	uint8_t* block;
+	RBTREE_FOR(walk, struct canon_rr*, sortree) {
+		total += d->rr_len[walk->rr_idx];
+	}
+	if(!(block = regional_alloc(region, total?total:1)))
+		return 0;
+	sldns_buffer_init_frm_data(&canon, block, total);
+	RBTREE_FOR(walk, struct canon_rr*, sortree) {
+		walk->canon = sldns_buffer_current(&canon);
+		sldns_buffer_write(&canon, d->rr_data[walk->rr_idx],
+			d->rr_len[walk->rr_idx]);
+		canonicalize_rdata(&canon, k, d->rr_len[walk->rr_idx]);
+	}
+	return 1;
+}
+
 int rrset_canonical_equal(struct regional* region,
 	struct ub_packed_rrset_key* k1, struct ub_packed_rrset_key* k2)
 {
@@ -1155,6 +1321,10 @@ rrset_canonical(struct regional* region, sldns_buffer* buf,
 		}
 		rbtree_init(*sortree, &canonical_tree_compare);
 		canonical_sort(k, d, *sortree, rrs);
+		if(!canonical_rdata(region, k, d, *sortree)) {
+			*sortree = NULL;
+			return 0;
+		}
 	}
 
 	sldns_buffer_clear(buf);
@@ -1177,9 +1347,7 @@ rrset_canonical(struct regional* region, sldns_buffer* buf,
 		sldns_buffer_write(buf, &k->rk.type, 2);
 		sldns_buffer_write(buf, &k->rk.rrset_class, 2);
 		sldns_buffer_write(buf, sig+4, 4);
-		sldns_buffer_write(buf, d->rr_data[walk->rr_idx], 
-			d->rr_len[walk->rr_idx]);
-		canonicalize_rdata(buf, k, d->rr_len[walk->rr_idx]);
+		sldns_buffer_write(buf, walk->canon, d->rr_len[walk->rr_idx]);
 	}
 	sldns_buffer_flip(buf);
 
@@ -1372,13 +1540,21 @@ adjust_ttl(struct val_env* ve, uint32_t unow,
 	}
 }
 
-enum sec_status 
-dnskey_verify_rrset_sig(struct regional* region, sldns_buffer* buf, 
+/**
+ * Verify an RRSIG with a key, or with a batch, collect the check for the
+ * crypto threads.
+ * @param batch: if not NULL, the check is added to it, when it is not in
+ *	the signature cache, and unchecked is returned.
+ * The other arguments and the return value are as dnskey_verify_rrset_sig.
+ */
+static enum sec_status
+dnskey_verify_rrset_sig_batch(struct regional* region, sldns_buffer* buf,
 	struct val_env* ve, time_t now,
         struct ub_packed_rrset_key* rrset, struct ub_packed_rrset_key* dnskey,
         size_t dnskey_idx, size_t sig_idx,
 	struct rbtree_type** sortree, int* buf_canon, char** reason,
-	sldns_pkt_section section, struct module_qstate* qstate)
+	sldns_pkt_section section, struct module_qstate* qstate,
+	struct val_crypto_batch* batch)
 {
 	enum sec_status sec;
 	uint8_t* sig;		/* RRSIG rdata */
@@ -1391,6 +1567,7 @@ dnskey_verify_rrset_sig(struct regional* region, sldns_buffer* buf,
 	uint16_t ktag;		/* DNSKEY key tag */
 	unsigned char* key;	/* public key rdata field */
 	unsigned int keylen;
+	struct sigcache_key sck; /* signature cache lookup key */
 	rrset_get_rdata(rrset, rrnum + sig_idx, &sig, &siglen);
 	/* min length of rdatalen, fixed rrsig, root signer, 1 byte sig */
 	if(siglen < 2+20) {
@@ -1491,9 +1668,45 @@ dnskey_verify_rrset_sig(struct regional* region, sldns_buffer* buf,
 		return sec_status_unchecked;
 	}
 
-	/* verify */
-	sec = verify_canonrrset(buf, (int)sig[2+2],
-		sigblock, sigblock_len, key, keylen, reason);
+	if(batch) {
+		/* leave the check to a crypto thread, the result is put in
+		 * the signature cache */
+		if(!ve->sigcache || !val_sigcache_make_key(&sck, region, buf,
+			(int)sig[2+2], ntohs(ktag), sigblock, sigblock_len,
+			key, keylen))
+			return sec_status_unchecked;
+		if(!val_sigcache_contains(ve->sigcache, &sck, now) &&
+			!val_crypto_batch_add(batch, &sck, buf, (int)sig[2+2],
+			sigblock, sigblock_len, key, keylen,
+			now + (time_t)sldns_read_uint32(sig+2+4),
+			now + (time_t)ve->bogus_ttl))
+			log_err("verify: out of memory for crypto batch");
+		return sec_status_unchecked;
+	}
+
+	/* verify, or use the result of an earlier check of the same
+	 * signature over the same data with this key */
+	if(ve->sigcache && val_sigcache_make_key(&sck, region, buf,
+		(int)sig[2+2], ntohs(ktag), sigblock, sigblock_len,
+		key, keylen)) {
+		sec = val_sigcache_lookup(ve->sigcache, &sck, now);
+		if(sec == sec_status_bogus)
+			*reason = "signature crypto failed";
+		else if(sec == sec_status_unchecked) {
+			sec = verify_canonrrset(buf, (int)sig[2+2], sigblock,
+				sigblock_len, key, keylen, ve->pkey_cache,
+				reason);
+			if(sec == sec_status_secure)
+				val_sigcache_insert(ve->sigcache, &sck, sec,
+					now + (time_t)sldns_read_uint32(sig+2+4));
+			else if(sec == sec_status_bogus)
+				val_sigcache_insert(ve->sigcache, &sck, sec,
+					now + (time_t)ve->bogus_ttl);
+		}
+	} else {
+		sec = verify_canonrrset(buf, (int)sig[2+2], sigblock,
+			sigblock_len, key, keylen, ve->pkey_cache, reason);
+	}
 	
 	if(sec == sec_status_secure) {
 		/* check if TTL is too high - reduce if so */
@@ -1509,3 +1722,95 @@ dnskey_verify_rrset_sig(struct regional* region, sldns_buffer* buf,
 
 	return sec;
 }
+
+enum sec_status 
+dnskey_verify_rrset_sig(struct regional* region, sldns_buffer* buf, 
+	struct val_env* ve, time_t now,
+        struct ub_packed_rrset_key* rrset, struct ub_packed_rrset_key* dnskey,
+        size_t dnskey_idx, size_t sig_idx,
+	struct rbtree_type** sortree, int* buf_canon, char** reason,
+	sldns_pkt_section section, struct module_qstate* qstate)
+{
+	return dnskey_verify_rrset_sig_batch(region, buf, ve, now, rrset,
+		dnskey, dnskey_idx, sig_idx, sortree, buf_canon, reason,
+		section, qstate, NULL);
+}
+
+void
+dnskeyset_collect_rrset(struct module_env* env, struct val_env* ve,
+	struct ub_packed_rrset_key* rrset, struct ub_packed_rrset_key* dnskey,
+	uint8_t* sigalg, sldns_pkt_section section,
+	struct module_qstate* qstate, struct val_crypto_batch* batch)
+{
+	size_t i, j, num = rrset_get_sigcount(rrset);
+	size_t numkeys = rrset_get_count(dnskey);
+	rbtree_type* sortree = NULL;
+	char* reason = NULL;
+	struct algo_needs needs;
+	struct sig_order stack_order[SIG_ORDER_STACK];
+	struct sig_order* order = stack_order;
+	if(num == 0)
+		return;
+	if(sigalg) {
+		algo_needs_init_list(&needs, sigalg);
+		if(algo_needs_num_missing(&needs) == 0)
+			return;
+	}
+	/* the order and the stop of dnskeyset_verify_rrset, a check that
+	 * is collected or cached is taken to be secure */
+	if(num > SIG_ORDER_STACK) {
+		order = (struct sig_order*)regional_alloc(env->scratch,
+			sizeof(*order)*num);
+		if(!order)
+			return;
+	}
+	sig_order_sort(rrset, order, num);
+	for(i=0; i<num; i++) {
+		size_t idx = order[i].idx;
+		uint16_t tag = rrset_get_sig_keytag(rrset, idx);
+		int algo = rrset_get_sig_algo(rrset, idx);
+		int buf_canon = 0, collected = 0;
+		if(sigalg && needs.needs[(uint8_t)algo] == 0)
+			continue;
+		if(!dnskey_algo_id_is_supported(algo))
+			continue;
+		for(j=0; j<numkeys && !collected; j++) {
+			if(algo != dnskey_get_algo(dnskey, j) ||
+				tag != dnskey_calc_keytag(dnskey, j))
+				continue;
+			if(dnskey_verify_rrset_sig_batch(env->scratch,
+				env->scratch_buffer, ve, *env->now, rrset,
+				dnskey, j, idx, &sortree, &buf_canon, &reason,
+				section, qstate, batch) == sec_status_unchecked)
+				collected = 1;
+		}
+		if(collected && (!sigalg ||
+			algo_needs_set_secure(&needs, (uint8_t)algo)))
+			return;
+	}
+}
+
+int
+dnskey_collect_rrset(struct module_env* env, struct val_env* ve,
+	struct ub_packed_rrset_key* rrset, struct ub_packed_rrset_key* dnskey,
+	size_t dnskey_idx, struct rbtree_type** sortree,
+	struct module_qstate* qstate, struct val_crypto_batch* batch)
+{
+	size_t i, num = rrset_get_sigcount(rrset);
+	uint16_t tag = dnskey_calc_keytag(dnskey, dnskey_idx);
+	int algo = dnskey_get_algo(dnskey, dnskey_idx);
+	char* reason = NULL;
+	for(i=0; i<num; i++) {
+		int buf_canon = 0;
+		if(algo != rrset_get_sig_algo(rrset, i) ||
+			tag != rrset_get_sig_keytag(rrset, i))
+			continue;
+		if(dnskey_verify_rrset_sig_batch(env->scratch,
+			env->scratch_buffer, ve, *env->now, rrset, dnskey,
+			dnskey_idx, i, sortree, &buf_canon, &reason,
+			LDNS_SECTION_ANSWER, qstate, batch) ==
+			sec_status_unchecked)
+			return 1;
+	}
+	return 0;
+}
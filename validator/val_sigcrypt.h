@@ -52,6 +52,7 @@ struct ub_packed_rrset_key;
 struct rbtree_type;
 struct regional;
 struct sldns_buffer;
+struct val_crypto_batch;
 
 /** number of entries in algorithm needs array */
 #define ALGO_NEEDS_MAX 256
@@ -257,6 +258,9 @@ enum sec_status dnskeyset_verify_rrset(struct module_env* env,
  * @param rrset: to be validated.
  * @param dnskey: DNSKEY rrset, keyset.
  * @param dnskey_idx: which key from the rrset to try.
+ * @param sortree: reused sorted order and canonical rdata, stored in
+ *	scratch.  Pass NULL at start, and pass it again to try other keys
+ *	on the same rrset, while scratch is not freed.
  * @param reason: if bogus, a string returned, fixed or alloced in scratch.
  * @param section: section of packet where this rrset comes from.
  * @param qstate: qstate with region.
@@ -265,7 +269,8 @@ enum sec_status dnskeyset_verify_rrset(struct module_env* env,
  */
 enum sec_status dnskey_verify_rrset(struct module_env* env, 
 	struct val_env* ve, struct ub_packed_rrset_key* rrset, 
-	struct ub_packed_rrset_key* dnskey, size_t dnskey_idx, char** reason,
+	struct ub_packed_rrset_key* dnskey, size_t dnskey_idx,
+	struct rbtree_type** sortree, char** reason,
 	sldns_pkt_section section, struct module_qstate* qstate);
 
 /** 
@@ -318,6 +323,46 @@ enum sec_status dnskey_verify_rrset_sig(struct regional* region,
 	struct rbtree_type** sortree, int* buf_canon, char** reason,
 	sldns_pkt_section section, struct module_qstate* qstate);
 
+/**
+ * Collect the signature checks of an rrset that are not in the signature
+ * cache, for the crypto threads.  The signatures are taken in the order
+ * of dnskeyset_verify_rrset, and collecting stops where that check would
+ * stop if the collected checks are secure.  Nothing is verified and the
+ * rrset is not changed.  Uses the scratch region and buffer.
+ * @param env: module environment, scratch space is used.
+ * @param ve: validator environment, the signature cache.
+ * @param rrset: the rrset with signatures.
+ * @param dnskey: DNSKEY rrset, keyset to try.
+ * @param sigalg: if nonNULL provide downgrade protection otherwise one
+ *   algorithm is enough.
+ * @param section: section of packet where this rrset comes from.
+ * @param qstate: qstate with region.
+ * @param batch: the checks are added to it.
+ */
+void dnskeyset_collect_rrset(struct module_env* env, struct val_env* ve,
+	struct ub_packed_rrset_key* rrset, struct ub_packed_rrset_key* dnskey,
+	uint8_t* sigalg, sldns_pkt_section section,
+	struct module_qstate* qstate, struct val_crypto_batch* batch);
+
+/**
+ * Collect the check of the first signature of an rrset by one key, the
+ * check of dnskey_verify_rrset, for the crypto threads.
+ * @param env: module environment, scratch space is used.
+ * @param ve: validator environment, the signature cache.
+ * @param rrset: the rrset with signatures.
+ * @param dnskey: DNSKEY rrset, keyset.
+ * @param dnskey_idx: which key from the rrset to try.
+ * @param sortree: reused sorted order. Stored in region. Pass NULL at start,
+ * 	and for a new rrset.
+ * @param qstate: qstate with region.
+ * @param batch: the check is added to it.
+ * @return true if a check was collected, or is in the signature cache.
+ */
+int dnskey_collect_rrset(struct module_env* env, struct val_env* ve,
+	struct ub_packed_rrset_key* rrset, struct ub_packed_rrset_key* dnskey,
+	size_t dnskey_idx, struct rbtree_type** sortree,
+	struct module_qstate* qstate, struct val_crypto_batch* batch);
+
 /**
  * canonical compare for two tree entries
  */
@@ -414,7 +414,8 @@ val_verify_rrset_entry(struct module_env* env, struct val_env* ve,
 static enum sec_status
 verify_dnskeys_with_ds_rr(struct module_env* env, struct val_env* ve, 
 	struct ub_packed_rrset_key* dnskey_rrset, 
-        struct ub_packed_rrset_key* ds_rrset, size_t ds_idx, char** reason,
+        struct ub_packed_rrset_key* ds_rrset, size_t ds_idx,
+	struct rbtree_type** sortree, char** reason,
 	struct module_qstate* qstate)
 {
 	enum sec_status sec = sec_status_bogus;
@@ -446,7 +447,8 @@ verify_dnskeys_with_ds_rr(struct module_env* env, struct val_env* ve,
 		/* Otherwise, we have a match! Make sure that the DNSKEY 
 		 * verifies *with this key*  */
 		sec = dnskey_verify_rrset(env, ve, dnskey_rrset, 
-			dnskey_rrset, i, reason, LDNS_SECTION_ANSWER, qstate);
+			dnskey_rrset, i, sortree, reason, LDNS_SECTION_ANSWER,
+			qstate);
 		if(sec == sec_status_secure) {
 			return sec;
 		}
@@ -490,6 +492,9 @@ val_verify_DNSKEY_with_DS(struct module_env* env, struct val_env* ve,
 	int has_useful_ds = 0, digest_algo, alg;
 	struct algo_needs needs;
 	size_t i, num;
+	/* the DNSKEY rrset is sorted and canonicalized once, for all
+	 * the keys that are tried */
+	struct rbtree_type* sortree = NULL;
 	enum sec_status sec;
 
 	if(dnskey_rrset->rk.dname_len != ds_rrset->rk.dname_len ||
@@ -525,7 +530,7 @@ val_verify_DNSKEY_with_DS(struct module_env* env, struct val_env* ve,
 		has_useful_ds = 1;
 
 		sec = verify_dnskeys_with_ds_rr(env, ve, dnskey_rrset, 
-			ds_rrset, i, reason, qstate);
+			ds_rrset, i, &sortree, reason, qstate);
 		if(sec == sec_status_secure) {
 			if(!sigalg || algo_needs_set_secure(&needs,
 				(uint8_t)ds_get_key_algo(ds_rrset, i))) {
@@ -555,6 +560,52 @@ val_verify_DNSKEY_with_DS(struct module_env* env, struct val_env* ve,
 	return sec_status_bogus;
 }
 
+void
+val_collect_DNSKEY_with_DS(struct module_env* env, struct val_env* ve,
+	struct ub_packed_rrset_key* dnskey_rrset,
+	struct ub_packed_rrset_key* ds_rrset, int downprot,
+	struct module_qstate* qstate, struct val_crypto_batch* batch)
+{
+	uint8_t sigalg[ALGO_NEEDS_MAX+1];
+	int digest_algo = -1;
+	struct algo_needs needs;
+	size_t i, j, num, numkeys = rrset_get_count(dnskey_rrset);
+	struct rbtree_type* sortree = NULL;
+
+	if(dnskey_rrset->rk.dname_len != ds_rrset->rk.dname_len ||
+		query_dname_compare(dnskey_rrset->rk.dname, ds_rrset->rk.dname)
+		!= 0)
+		return;
+	if(downprot) {
+		digest_algo = val_favorite_ds_algo(ds_rrset);
+		algo_needs_init_ds(&needs, ds_rrset, digest_algo, sigalg);
+	}
+	/* the DS and keys in the order of val_verify_DNSKEY_with_DS */
+	num = rrset_get_count(ds_rrset);
+	for(i=0; i<num; i++) {
+		uint8_t algo = (uint8_t)ds_get_key_algo(ds_rrset, i);
+		int collected = 0;
+		if(!ds_digest_algo_is_supported(ds_rrset, i) ||
+			!ds_key_algo_is_supported(ds_rrset, i) ||
+			(downprot && ds_get_digest_algo(ds_rrset, i) !=
+			digest_algo))
+			continue;
+		for(j=0; j<numkeys && !collected; j++) {
+			if(algo != dnskey_get_algo(dnskey_rrset, j) ||
+				dnskey_calc_keytag(dnskey_rrset, j) !=
+				ds_get_keytag(ds_rrset, i) ||
+				!ds_digest_match_dnskey(env, dnskey_rrset, j,
+				ds_rrset, i))
+				continue;
+			collected = dnskey_collect_rrset(env, ve, dnskey_rrset,
+				dnskey_rrset, j, &sortree, qstate, batch);
+		}
+		if(collected && (!downprot ||
+			algo_needs_set_secure(&needs, algo)))
+			return;
+	}
+}
+
 struct key_entry_key* 
 val_verify_new_DNSKEYs(struct regional* region, struct module_env* env, 
 	struct val_env* ve, struct ub_packed_rrset_key* dnskey_rrset, 
@@ -593,6 +644,9 @@ val_verify_DNSKEY_with_TA(struct module_env* env, struct val_env* ve,
 	int has_useful_ta = 0, digest_algo = 0, alg;
 	struct algo_needs needs;
 	size_t i, num;
+	/* the DNSKEY rrset is sorted and canonicalized once, for all
+	 * the keys that are tried */
+	struct rbtree_type* sortree = NULL;
 	enum sec_status sec;
 
 	if(ta_ds && (dnskey_rrset->rk.dname_len != ta_ds->rk.dname_len ||
@@ -637,7 +691,7 @@ val_verify_DNSKEY_with_TA(struct module_env* env, struct val_env* ve,
 		has_useful_ta = 1;
 
 		sec = verify_dnskeys_with_ds_rr(env, ve, dnskey_rrset, 
-			ta_ds, i, reason, qstate);
+			ta_ds, i, &sortree, reason, qstate);
 		if(sec == sec_status_secure) {
 			if(!sigalg || algo_needs_set_secure(&needs,
 				(uint8_t)ds_get_key_algo(ta_ds, i))) {
@@ -663,7 +717,8 @@ val_verify_DNSKEY_with_TA(struct module_env* env, struct val_env* ve,
 		has_useful_ta = 1;
 
 		sec = dnskey_verify_rrset(env, ve, dnskey_rrset,
-			ta_dnskey, i, reason, LDNS_SECTION_ANSWER, qstate);
+			ta_dnskey, i, &sortree, reason, LDNS_SECTION_ANSWER,
+			qstate);
 		if(sec == sec_status_secure) {
 			if(!sigalg || algo_needs_set_secure(&needs,
 				(uint8_t)dnskey_get_algo(ta_dnskey, i))) {
@@ -1163,6 +1218,7 @@ val_find_DS(struct module_env* env, uint8_t* nm, size_t nmlen, uint16_t c,
 	qinfo.local_alias = NULL;
 	/* do not add SOA to reply message, it is going to be used internal */
 	msg = val_neg_getmsg(env->neg_cache, &qinfo, region, env->rrset_cache,
-		env->scratch_buffer, *env->now, 0, topname, env->cfg);
+		env->scratch_buffer, *env->now, 0, topname, env->cfg,
+		env->mesh);
 	return msg;
 }
@@ -54,6 +54,7 @@ struct regional;
 struct val_anchors;
 struct rrset_cache;
 struct sock_list;
+struct val_crypto_batch;
 
 /**
  * Response classifications for the validator. The different types of proofs.
@@ -168,6 +169,24 @@ enum sec_status val_verify_DNSKEY_with_DS(struct module_env* env,
 	struct ub_packed_rrset_key* ds_rrset, uint8_t* sigalg, char** reason,
 	struct module_qstate* qstate);
 
+/**
+ * Collect the signature checks of val_verify_DNSKEY_with_DS for the
+ * crypto threads, the checks that are not in the signature cache.
+ * Nothing is verified.
+ * @param env: module environment (scratch buffer)
+ * @param ve: validator environment, the signature cache.
+ * @param dnskey_rrset: DNSKEY rrset to verify
+ * @param ds_rrset: DS rrset to verify with.
+ * @param downprot: if true provide downgrade protection otherwise one
+ *   algorithm is enough.
+ * @param qstate: qstate with region.
+ * @param batch: the checks are added to it.
+ */
+void val_collect_DNSKEY_with_DS(struct module_env* env, struct val_env* ve,
+	struct ub_packed_rrset_key* dnskey_rrset,
+	struct ub_packed_rrset_key* ds_rrset, int downprot,
+	struct module_qstate* qstate, struct val_crypto_batch* batch);
+
 /**
  * Verify DNSKEYs with DS and DNSKEY rrset.  Like val_verify_DNSKEY_with_DS
  * but for a trust anchor.
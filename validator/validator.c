@@ -42,6 +42,10 @@
 #include "config.h"
 #include <ctype.h>
 #include "validator/validator.h"
+#include "validator/val_secalgo.h"
+#include "validator/val_sigcache.h"
+#include "validator/val_nsec3cache.h"
+#include "validator/val_cryptopool.h"
 #include "validator/val_anchor.h"
 #include "validator/val_kcache.h"
 #include "validator/val_kentry.h"
@@ -60,6 +64,7 @@
 #include "util/regional.h"
 #include "util/config_file.h"
 #include "util/fptr_wlist.h"
+#include "util/storage/slabhash.h"
 #include "sldns/rrdef.h"
 #include "sldns/wire2str.h"
 #include "sldns/str2wire.h"
@@ -68,6 +73,10 @@
 static void process_ds_response(struct module_qstate* qstate, 
 	struct val_qstate* vq, int id, int rcode, struct dns_msg* msg, 
 	struct query_info* qinfo, struct sock_list* origin);
+/* forward decl for a DNSKEY response that waited for the crypto threads */
+static void process_dnskey_response(struct module_qstate* qstate,
+	struct val_qstate* vq, int id, int rcode, struct dns_msg* msg,
+	struct query_info* qinfo, struct sock_list* origin);
 
 /** fill up nsec3 key iterations config entry */
 static int
@@ -128,6 +137,33 @@ val_apply_cfg(struct module_env* env, struct val_env* val_env,
 		return 0;
 	}
 	env->key_cache = val_env->kcache;
+	if(!val_env->pkey_cache)
+		val_env->pkey_cache = secalgo_keycache_create(
+			cfg->key_cache_size/4, cfg->key_cache_slabs);
+	if(!val_env->pkey_cache) {
+		log_err("out of memory");
+		return 0;
+	}
+	if(!val_env->sigcache && cfg->sig_cache_size != 0) {
+		val_env->sigcache = val_sigcache_create(cfg);
+		if(!val_env->sigcache) {
+			log_err("out of memory");
+			return 0;
+		}
+	}
+	if(!val_env->nsec3cache && (cfg->nsec3_hash_cache_size != 0 ||
+		cfg->nsec3_hash_ratelimit != 0)) {
+		val_env->nsec3cache = val_nsec3cache_create(cfg);
+		if(!val_env->nsec3cache) {
+			log_err("out of memory");
+			return 0;
+		}
+	}
+	if(!val_env->cryptopool && cfg->val_crypto_threads > 0 &&
+		val_env->sigcache)
+		val_env->cryptopool = val_cryptopool_create(
+			cfg->val_crypto_threads, val_env->pkey_cache,
+			val_env->sigcache);
 	if(!anchors_apply_cfg(env->anchors, cfg)) {
 		log_err("validator: error in trustanchors config");
 		return 0;
@@ -174,6 +210,11 @@ val_init(struct module_env* env, int id)
 	lock_basic_init(&val_env->bogus_lock);
 	lock_protect(&val_env->bogus_lock, &val_env->num_rrset_bogus,
 		sizeof(val_env->num_rrset_bogus));
+	lock_basic_init(&val_env->sigstat_lock);
+	lock_protect(&val_env->sigstat_lock, &val_env->num_sig_verify,
+		sizeof(val_env->num_sig_verify));
+	lock_protect(&val_env->sigstat_lock, &val_env->num_sig_skip,
+		sizeof(val_env->num_sig_skip));
 #ifdef USE_ECDSA_EVP_WORKAROUND
 	ecdsa_evp_workaround_init();
 #endif
@@ -193,9 +234,15 @@ val_deinit(struct module_env* env, int id)
 		return;
 	val_env = (struct val_env*)env->modinfo[id];
 	lock_basic_destroy(&val_env->bogus_lock);
+	lock_basic_destroy(&val_env->sigstat_lock);
+	/* stop the crypto threads before the caches they use go away */
+	val_cryptopool_delete(val_env->cryptopool);
 	anchors_delete(env->anchors);
 	env->anchors = NULL;
 	key_cache_delete(val_env->kcache);
+	slabhash_delete(val_env->pkey_cache);
+	val_sigcache_delete(val_env->sigcache);
+	val_nsec3cache_delete(val_env->nsec3cache);
 	neg_cache_delete(val_env->neg_cache);
 	free(val_env->nsec3_keysize);
 	free(val_env->nsec3_maxiter);
@@ -1799,6 +1846,148 @@ processFindKey(struct module_qstate* qstate, struct val_qstate* vq, int id)
 	return 0;
 }
 
+/**
+ * Collect the signature checks of the rrsets of a reply, that are not
+ * secure already, for the crypto threads.
+ * @param qstate: query state.
+ * @param ve: validator shared global environment.
+ * @param kkey: the key entry with the keys.
+ * @param rep: the reply.
+ * @param num: the number of rrsets to check, from the start.
+ * @param batch: the checks are added to it.
+ */
+static void
+val_crypto_collect_reply(struct module_qstate* qstate, struct val_env* ve,
+	struct key_entry_key* kkey, struct reply_info* rep, size_t num,
+	struct val_crypto_batch* batch)
+{
+	struct key_entry_data* kd = (struct key_entry_data*)kkey->entry.data;
+	struct ub_packed_rrset_key dnskey;
+	size_t i;
+	if(!kd->rrset_data)
+		return;
+	memset(&dnskey, 0, sizeof(dnskey));
+	dnskey.rk.type = htons(kd->rrset_type);
+	dnskey.rk.rrset_class = htons(kkey->key_class);
+	dnskey.rk.dname = kkey->name;
+	dnskey.rk.dname_len = kkey->namelen;
+	dnskey.entry.key = &dnskey;
+	dnskey.entry.data = kd->rrset_data;
+	for(i=0; i<num; i++) {
+		struct ub_packed_rrset_key* s = rep->rrsets[i];
+		struct packed_rrset_data* d = (struct packed_rrset_data*)
+			s->entry.data;
+		if(d->security == sec_status_secure)
+			continue;
+		rrset_check_sec_status(qstate->env->rrset_cache, s,
+			*qstate->env->now);
+		if(d->security == sec_status_secure)
+			continue;
+		dnskeyset_collect_rrset(qstate->env, ve, s, &dnskey,
+			kd->algo, i<rep->an_numrrsets?LDNS_SECTION_ANSWER:(
+			i<rep->an_numrrsets+rep->ns_numrrsets?
+			LDNS_SECTION_AUTHORITY:
+			LDNS_SECTION_ADDITIONAL), qstate, batch);
+		regional_free_all(qstate->env->scratch);
+	}
+}
+
+/**
+ * Give the signature checks of the message to the crypto threads.
+ * @param qstate: query state.
+ * @param vq: validator query state.
+ * @param ve: validator shared global environment.
+ * @param id: module id.
+ * @return true if the query waits for the crypto threads.
+ */
+static int
+val_crypto_offload(struct module_qstate* qstate, struct val_qstate* vq,
+	struct val_env* ve, int id)
+{
+	struct reply_info* rep = vq->chase_reply;
+	struct val_crypto_batch* batch;
+	size_t num = rep->an_numrrsets + rep->ns_numrrsets;
+	if(qstate->env->cfg->val_clean_additional)
+		num = rep->rrset_count;
+	if(!(batch = val_crypto_batch_create(qstate, id)))
+		return 0;
+	val_crypto_collect_reply(qstate, ve, vq->key_entry, rep, num, batch);
+	if(!val_cryptopool_submit(ve->cryptopool, batch))
+		return 0;
+	vq->crypto_batch = batch;
+	return 1;
+}
+
+/**
+ * Give the signature checks of a DS or DNSKEY response to the crypto
+ * threads.  The response is kept, and processed when the checks are done.
+ * Called from inform_supers.
+ * @param qstate: query state that is validating and asked for the DS or
+ *	DNSKEY.
+ * @param vq: validator query state.
+ * @param ve: validator shared global environment.
+ * @param id: module id.
+ * @param msg: the response, the checks for it are collected.
+ * @param qinfo: from the sub query state, query info.
+ * @param origin: the origin of msg.
+ * @return true if the query waits for the crypto threads.
+ */
+static int
+val_crypto_offload_key(struct module_qstate* qstate, struct val_qstate* vq,
+	struct val_env* ve, int id, struct dns_msg* msg,
+	struct query_info* qinfo, struct sock_list* origin)
+{
+	struct val_crypto_batch* batch;
+	struct ub_packed_rrset_key* dnskey;
+	struct dns_msg* m;
+	if(!vq->key_entry || !key_entry_isgood(vq->key_entry))
+		return 0;
+	if(!(batch = val_crypto_batch_create(qstate, id)))
+		return 0;
+	if(qinfo->qtype == LDNS_RR_TYPE_DNSKEY) {
+		/* the DNSKEY is checked with the DS */
+		if(vq->ds_rrset && (dnskey = reply_find_answer_rrset(qinfo,
+			msg->rep)) != NULL)
+			val_collect_DNSKEY_with_DS(qstate->env, ve, dnskey,
+				vq->ds_rrset,
+				qstate->env->cfg->harden_algo_downgrade,
+				qstate, batch);
+	} else {
+		/* the DS, or the denial of it, is checked with the keys
+		 * of the parent */
+		val_crypto_collect_reply(qstate, ve, vq->key_entry, msg->rep,
+			msg->rep->an_numrrsets + msg->rep->ns_numrrsets,
+			batch);
+	}
+	regional_free_all(qstate->env->scratch);
+	if(batch->num_jobs == 0) {
+		val_crypto_batch_delete(batch);
+		return 0;
+	}
+	/* keep the response, the sub query state is deleted */
+	if(!(m = (struct dns_msg*)regional_alloc(qstate->region,
+		sizeof(struct dns_msg))) ||
+		!(m->rep = reply_info_copy(msg->rep, NULL, qstate->region))) {
+		val_crypto_batch_delete(batch);
+		return 0;
+	}
+	m->qinfo = *qinfo;
+	if(!(m->qinfo.qname = regional_alloc_init(qstate->region,
+		qinfo->qname, qinfo->qname_len))) {
+		val_crypto_batch_delete(batch);
+		return 0;
+	}
+	vq->crypto_msg = m;
+	vq->crypto_origin = NULL;
+	sock_list_merge(&vq->crypto_origin, qstate->region, origin);
+	if(!val_cryptopool_submit(ve->cryptopool, batch)) {
+		vq->crypto_msg = NULL;
+		return 0;
+	}
+	vq->crypto_batch = batch;
+	return 1;
+}
+
 /**
  * Process the VALIDATE stage, the init and findkey stages are finished,
  * and the right keys are available to validate the response.
@@ -1863,6 +2052,17 @@ processValidate(struct module_qstate* qstate, struct val_qstate* vq,
 		vq->chase_reply->security = sec_status_bogus;
 		return 1;
 	}
+	/* let the crypto threads do the signature checks, and continue
+	 * with the results from the signature cache */
+	if(ve->cryptopool && !vq->crypto_done) {
+		if(val_crypto_offload(qstate, vq, ve, id)) {
+			vq->state = VAL_VALIDATE_STATE;
+			vq->crypto_done = 1;
+			qstate->ext_state[id] = module_wait_reply;
+			return 0;
+		}
+	}
+	vq->crypto_done = 0;
 	subtype = val_classify_response(qstate->query_flags, &qstate->qinfo,
 		&vq->qchase, vq->orig_msg->rep, vq->rrset_skip);
 	if(subtype != VAL_CLASS_REFERRAL)
@@ -2442,6 +2642,22 @@ val_handle(struct module_qstate* qstate, struct val_qstate* vq,
 	struct val_env* ve, int id)
 {
 	int cont = 1;
+	if(vq->crypto_batch) {
+		/* the crypto threads are not done yet */
+		qstate->ext_state[id] = module_wait_reply;
+		return;
+	}
+	if(vq->crypto_msg) {
+		/* the checks for the key response are in the cache */
+		struct dns_msg* m = vq->crypto_msg;
+		vq->crypto_msg = NULL;
+		if(m->qinfo.qtype == LDNS_RR_TYPE_DS)
+			process_ds_response(qstate, vq, id, LDNS_RCODE_NOERROR,
+				m, &m->qinfo, vq->crypto_origin);
+		else	process_dnskey_response(qstate, vq, id,
+				LDNS_RCODE_NOERROR, m, &m->qinfo,
+				vq->crypto_origin);
+	}
 	while(cont) {
 		verbose(VERB_ALGO, "val handle processing q with state %s",
 			val_state_to_string(vq->state));
@@ -3204,6 +3420,7 @@ val_inform_super(struct module_qstate* qstate, int id,
 	struct module_qstate* super)
 {
 	struct val_qstate* vq = (struct val_qstate*)super->minfo[id];
+	struct val_env* ve = (struct val_env*)super->env->modinfo[id];
 	log_query_info(VERB_ALGO, "validator: inform_super, sub is",
 		&qstate->qinfo);
 	log_query_info(VERB_ALGO, "super is", &super->qinfo);
@@ -3217,6 +3434,14 @@ val_inform_super(struct module_qstate* qstate, int id,
 			qstate->return_msg, qstate->reply_origin);
 		return;
 	}
+	if(ve->cryptopool && qstate->return_rcode == LDNS_RCODE_NOERROR &&
+		qstate->return_msg && (qstate->qinfo.qtype == LDNS_RR_TYPE_DS
+		|| qstate->qinfo.qtype == LDNS_RR_TYPE_DNSKEY) &&
+		val_crypto_offload_key(super, vq, ve, id, qstate->return_msg,
+		&qstate->qinfo, qstate->reply_origin)) {
+		/* the response is processed when the checks are done */
+		return;
+	}
 	if(qstate->qinfo.qtype == LDNS_RR_TYPE_DS) {
 		process_ds_response(super, vq, id, qstate->return_rcode,
 			qstate->return_msg, &qstate->qinfo, 
@@ -3238,8 +3463,15 @@ val_inform_super(struct module_qstate* qstate, int id,
 void
 val_clear(struct module_qstate* qstate, int id)
 {
+	struct val_qstate* vq;
 	if(!qstate)
 		return;
+	vq = (struct val_qstate*)qstate->minfo[id];
+	if(vq && vq->crypto_batch) {
+		struct val_env* ve = (struct val_env*)qstate->env->modinfo[id];
+		val_cryptopool_cancel(ve->cryptopool, vq->crypto_batch);
+		vq->crypto_batch = NULL;
+	}
 	/* everything is allocated in the region, so assign NULL */
 	qstate->minfo[id] = NULL;
 }
@@ -3251,6 +3483,9 @@ val_get_mem(struct module_env* env, int id)
 	if(!ve)
 		return 0;
 	return sizeof(*ve) + key_cache_get_mem(ve->kcache) + 
+		slabhash_get_mem(ve->pkey_cache) +
+		val_sigcache_get_mem(ve->sigcache) +
+		val_nsec3cache_get_mem(ve->nsec3cache) +
 		val_neg_get_mem(ve->neg_cache) +
 		sizeof(size_t)*2*ve->nsec3_keyiter_count;
 }
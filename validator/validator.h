@@ -50,6 +50,11 @@ struct key_cache;
 struct key_entry_key;
 struct val_neg_cache;
 struct config_strlist;
+struct slabhash;
+struct val_sigcache;
+struct val_nsec3cache;
+struct val_cryptopool;
+struct val_crypto_batch;
 
 /**
  * This is the TTL to use when a trust anchor fails to prime. A trust anchor
@@ -74,6 +79,9 @@ struct config_strlist;
 /** Root key sentinal keytag length */
 #define SENTINEL_KEYTAG_LEN	5
 
+/** number of DNSKEY algorithms with signature check counters */
+#define VAL_ALGO_STATS_NUM	32
+
 /**
  * Global state for the validator. 
  */
@@ -82,6 +90,19 @@ struct val_env {
 	 * end up here after being primed. */
 	struct key_cache* kcache;
 
+	/** cache of decoded public keys, for signature verification */
+	struct slabhash* pkey_cache;
+
+	/** cache of signature verification results, NULL if disabled */
+	struct val_sigcache* sigcache;
+
+	/** cache of NSEC3 hashes, with the hash rate limit, NULL if
+	 * disabled */
+	struct val_nsec3cache* nsec3cache;
+
+	/** threads that verify signatures, NULL verifies inline */
+	struct val_cryptopool* cryptopool;
+
 	/** aggressive negative cache. index into NSECs in rrset cache. */
 	struct val_neg_cache* neg_cache;
 
@@ -123,6 +144,14 @@ struct val_env {
 	lock_basic_type bogus_lock;
 	/** number of times rrsets marked bogus */
 	size_t num_rrset_bogus;
+
+	/** lock on the signature check counters */
+	lock_basic_type sigstat_lock;
+	/** number of signatures checked, by DNSKEY algorithm */
+	size_t num_sig_verify[VAL_ALGO_STATS_NUM];
+	/** number of signatures not checked, because the rrset was secure
+	 * with cheaper ones or the algorithm was not needed */
+	size_t num_sig_skip[VAL_ALGO_STATS_NUM];
 };
 
 /**
@@ -238,6 +267,18 @@ struct val_qstate {
 		dlv_ask_higher, /* ask again */
 		dlv_there_is_no_dlv /* got no DLV, sure of it */
 	} dlv_status;
+
+	/** signature checks that the crypto threads do for us, NULL if
+	 * not waiting for them */
+	struct val_crypto_batch* crypto_batch;
+	/** if the crypto threads have done the checks for the validate
+	 * state, so it can continue with the results in the cache */
+	int crypto_done;
+	/** DS or DNSKEY response that waits for the crypto threads, copied
+	 * into the region, NULL if none */
+	struct dns_msg* crypto_msg;
+	/** the origin of the crypto_msg */
+	struct sock_list* crypto_origin;
 };
 
 /**